@@ -20,16 +20,10 @@
 # available in CVODE.
 # ---------------------------------------------------------------
 
-if(ENABLE_CUDA OR ENABLE_HIP)
-  set(CUDA_OR_HIP TRUE)
-else()
-  set(CUDA_OR_HIP FALSE)
-endif()
-
 sundials_option(
   SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS BOOL
-  "Build specialized fused GPU kernels" OFF
-  DEPENDS_ON BUILD_CVODE CUDA_OR_HIP
+  "Build specialized fused kernels" OFF
+  DEPENDS_ON BUILD_CVODE
   DEPENDS_ON_THROW_ERROR)
 
 # ---------------------------------------------------------------
@@ -141,6 +135,8 @@ list(APPEND SUNDIALS_BUILD_LIST "BUILD_NVECTOR_KOKKOS")
 # required modules are in the build list, but cannot be disabled
 set(BUILD_SUNMATRIX_BAND TRUE)
 list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNMATRIX_BAND")
+set(BUILD_SUNMATRIX_BLOCKDENSE TRUE)
+list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNMATRIX_BLOCKDENSE")
 set(BUILD_SUNMATRIX_DENSE TRUE)
 list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNMATRIX_DENSE")
 set(BUILD_SUNMATRIX_SPARSE TRUE)
@@ -200,6 +196,8 @@ list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNMATRIX_SLUNRLOC")
 # required modules are in the build list, but cannot be disabled
 set(BUILD_SUNLINSOL_BAND TRUE)
 list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNLINSOL_BAND")
+set(BUILD_SUNLINSOL_BLOCKDENSE TRUE)
+list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNLINSOL_BLOCKDENSE")
 set(BUILD_SUNLINSOL_DENSE TRUE)
 list(APPEND SUNDIALS_BUILD_LIST "BUILD_SUNLINSOL_DENSE")
 set(BUILD_SUNLINSOL_PCG TRUE)
@@ -292,6 +292,83 @@ if(SUNDIALS_POSIX_TIMERS AND POSIX_TIMERS_NEED_POSIX_C_SOURCE)
       "${CMAKE_C_FLAGS} -D_POSIX_C_SOURCE=${SUNDIALS_POSIX_C_SOURCE}")
 endif()
 
+# ---------------------------------------------------------------
+# Check for Linux perf events (SUNProfiler hardware counters)
+# ---------------------------------------------------------------
+check_c_source_compiles(
+  "
+  #define _GNU_SOURCE
+  #include <linux/perf_event.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+  int main(void) {
+    struct perf_event_attr attr;
+    attr.type = PERF_TYPE_HARDWARE;
+    return (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+  }
+"
+  SUNDIALS_PERF_EVENTS)
+
+# ---------------------------------------------------------------
+# Check for memory-mapped files (file-backed SUNDataNode leaves)
+# ---------------------------------------------------------------
+check_c_source_compiles(
+  "
+  #define _GNU_SOURCE
+  #include <stdlib.h>
+  #include <sys/mman.h>
+  #include <unistd.h>
+  int main(void) {
+    char name[] = \"XXXXXX\";
+    int fd = mkstemp(name);
+    void* p = mmap(NULL, 4096, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    posix_madvise(p, 4096, POSIX_MADV_WILLNEED);
+    return ftruncate(fd, 0) + munmap(p, 4096) + (int)sysconf(_SC_PAGESIZE);
+  }
+"
+  SUNDIALS_MMAP)
+
+# ---------------------------------------------------------------
+# Check for aligned allocation (serial N_Vector data)
+# ---------------------------------------------------------------
+check_c_source_compiles(
+  "
+  #include <stdlib.h>
+  int main(void) {
+    void* p = NULL;
+    int err = posix_memalign(&p, 64, 1024);
+    free(p);
+    return err;
+  }
+"
+  SUNDIALS_POSIX_MEMALIGN)
+
+# ---------------------------------------------------------------
+# Check for x86 SIMD kernels selected at runtime (serial N_Vector)
+# ---------------------------------------------------------------
+check_c_source_compiles(
+  "
+  #include <immintrin.h>
+  __attribute__((target(\"avx2,fma\"))) static double f256(const double* x) {
+    __m256d v = _mm256_loadu_pd(x);
+    v = _mm256_fmadd_pd(v, v, v);
+    return _mm256_cvtsd_f64(v);
+  }
+  __attribute__((target(\"avx512f\"))) static double f512(const double* x) {
+    __m512d v = _mm512_loadu_pd(x);
+    v = _mm512_fmadd_pd(v, v, v);
+    return _mm512_reduce_add_pd(v);
+  }
+  int main(void) {
+    double x[8] = {0.0};
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports(\"avx512f\")) { return (int)f512(x); }
+    if (__builtin_cpu_supports(\"avx2\")) { return (int)f256(x); }
+    return 0;
+  }
+"
+  SUNDIALS_X86_SIMD)
+
 # ---------------------------------------------------------------
 # Check for deprecated attribute with message
 # ---------------------------------------------------------------
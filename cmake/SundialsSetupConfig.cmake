@@ -64,6 +64,11 @@ foreach(tpl ${SUNDIALS_TPL_LIST})
   set(SUNDIALS_${tpl}_ENABLED TRUE)
 endforeach()
 
+# the Pthreads TPL is listed as PTHREAD but sundials_config.h uses PTHREADS
+if(ENABLE_PTHREAD)
+  set(SUNDIALS_PTHREADS_ENABLED TRUE)
+endif()
+
 # prepare substitution variable SUNDIALS_TRILINOS_HAVE_MPI for sundials_config.h
 if(ENABLE_MPI)
   set(SUNDIALS_TRILINOS_HAVE_MPI TRUE)
@@ -89,6 +94,26 @@ if(SUNDIALS_POSIX_TIMERS) # set in SundialsPOSIXTimers.cmake
   set(SUNDIALS_HAVE_POSIX_TIMERS TRUE)
 endif()
 
+# prepare substitution variable SUNDIALS_HAVE_PERF_EVENTS for sundials_config.h
+if(SUNDIALS_PERF_EVENTS) # set in SundialsSetupCompilers.cmake
+  set(SUNDIALS_HAVE_PERF_EVENTS TRUE)
+endif()
+
+# prepare substitution variable SUNDIALS_HAVE_MMAP for sundials_config.h
+if(SUNDIALS_MMAP) # set in SundialsSetupCompilers.cmake
+  set(SUNDIALS_HAVE_MMAP TRUE)
+endif()
+
+# prepare substitution variable SUNDIALS_HAVE_POSIX_MEMALIGN for sundials_config.h
+if(SUNDIALS_POSIX_MEMALIGN) # set in SundialsSetupCompilers.cmake
+  set(SUNDIALS_HAVE_POSIX_MEMALIGN TRUE)
+endif()
+
+# prepare substitution variable SUNDIALS_HAVE_X86_SIMD for sundials_config.h
+if(SUNDIALS_X86_SIMD) # set in SundialsSetupCompilers.cmake
+  set(SUNDIALS_HAVE_X86_SIMD TRUE)
+endif()
+
 # =============================================================================
 # All required substitution variables should be available at this point.
 # Generate the header file and place it in the binary dir.
@@ -129,7 +129,7 @@ int main(int argc, char* argv[])
   const int ncheck                             = nsteps * order;
   const sunbooleantype keep_check              = args.keep_checks;
   SUNAdjointCheckpointScheme checkpoint_scheme = NULL;
-  SUNMemoryHelper mem_helper                   = SUNMemoryHelper_Sys(sunctx);
+  SUNMemoryHelper mem_helper                   = SUNMemoryHelper_SysPool(sunctx);
 
   retval = SUNAdjointCheckpointScheme_Create_Fixed(SUNDATAIOMODE_INMEM,
                                                    mem_helper, check_interval,
@@ -224,6 +224,13 @@ SUNDIALS_EXPORT int ARKodeResize(void* arkode_mem, N_Vector ynew,
                                  ARKVecResizeFn resize, void* resize_data);
 SUNDIALS_EXPORT int ARKodeReset(void* arkode_mem, sunrealtype tR, N_Vector yR);
 
+/* Integrator state functions */
+SUNDIALS_EXPORT int ARKodeGetStateSize(void* arkode_mem, size_t* bytes);
+SUNDIALS_EXPORT int ARKodeSaveState(void* arkode_mem, void* buffer,
+                                    size_t bytes);
+SUNDIALS_EXPORT int ARKodeLoadState(void* arkode_mem, const void* buffer,
+                                    size_t bytes);
+
 /* Utility to wrap ARKODE as an MRIStepInnerStepper */
 SUNDIALS_EXPORT int ARKodeCreateMRIStepInnerStepper(void* arkode_mem,
                                                     MRIStepInnerStepper* stepper);
@@ -262,6 +269,7 @@ SUNDIALS_EXPORT int ARKodeSetPostprocessStepFn(void* arkode_mem,
                                                ARKPostProcessFn ProcessStep);
 SUNDIALS_EXPORT int ARKodeSetPostprocessStageFn(void* arkode_mem,
                                                 ARKPostProcessFn ProcessStage);
+SUNDIALS_EXPORT int ARKodeSetStepStats(void* arkode_mem, SUNStepStats stats);
 
 /* Optional input functions (implicit solver) */
 SUNDIALS_EXPORT int ARKodeSetNonlinearSolver(void* arkode_mem,
@@ -330,6 +338,10 @@ SUNDIALS_EXPORT int ARKodeEvolve(void* arkode_mem, sunrealtype tout,
 SUNDIALS_EXPORT int ARKodeGetDky(void* arkode_mem, sunrealtype t, int k,
                                  N_Vector dky);
 
+/* Computes the kth derivative of the y function at each of nt times t */
+SUNDIALS_EXPORT int ARKodeGetDkyMulti(void* arkode_mem, int nt, sunrealtype* t,
+                                      int k, N_Vector* dky);
+
 /* Utility function to update/compute y based on zcor */
 SUNDIALS_EXPORT int ARKodeComputeState(void* arkode_mem, N_Vector zcor,
                                        N_Vector z);
@@ -110,6 +110,12 @@ SUNDIALS_EXPORT int CVodeResizeHistory(void* cvode_mem, sunrealtype* t_hist,
                                        N_Vector* y_hist, N_Vector* f_hist,
                                        int num_y_hist, int num_f_hist);
 
+/* Integrator state functions */
+SUNDIALS_EXPORT int CVodeGetStateSize(void* cvode_mem, size_t* bytes);
+SUNDIALS_EXPORT int CVodeSaveState(void* cvode_mem, void* buffer, size_t bytes);
+SUNDIALS_EXPORT int CVodeLoadState(void* cvode_mem, const void* buffer,
+                                   size_t bytes);
+
 /* Tolerance input functions */
 SUNDIALS_EXPORT int CVodeSStolerances(void* cvode_mem, sunrealtype reltol,
                                       sunrealtype abstol);
@@ -134,6 +140,7 @@ SUNDIALS_EXPORT int CVodeSetMaxStep(void* cvode_mem, sunrealtype hmax);
 SUNDIALS_EXPORT int CVodeSetMinStep(void* cvode_mem, sunrealtype hmin);
 SUNDIALS_EXPORT int CVodeSetMonitorFn(void* cvode_mem, CVMonitorFn fn);
 SUNDIALS_EXPORT int CVodeSetMonitorFrequency(void* cvode_mem, long int nst);
+SUNDIALS_EXPORT int CVodeSetStepStats(void* cvode_mem, SUNStepStats stats);
 SUNDIALS_EXPORT int CVodeSetNlsRhsFn(void* cvode_mem, CVRhsFn f);
 SUNDIALS_EXPORT int CVodeSetNonlinConvCoef(void* cvode_mem, sunrealtype nlscoef);
 SUNDIALS_EXPORT int CVodeSetNonlinearSolver(void* cvode_mem,
@@ -187,6 +194,8 @@ SUNDIALS_EXPORT int CVodeComputeState(void* cvode_mem, N_Vector ycor, N_Vector y
 /* Dense output function */
 SUNDIALS_EXPORT int CVodeGetDky(void* cvode_mem, sunrealtype t, int k,
                                 N_Vector dky);
+SUNDIALS_EXPORT int CVodeGetDkyMulti(void* cvode_mem, int nt, sunrealtype* t,
+                                     int k, N_Vector* dky);
 
 /* Optional output functions */
 SUNDIALS_DEPRECATED_EXPORT_MSG(
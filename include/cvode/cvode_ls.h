@@ -85,6 +85,9 @@ SUNDIALS_EXPORT int CVodeSetLinearSolver(void* cvode_mem, SUNLinearSolver LS,
 
 SUNDIALS_EXPORT int CVodeSetJacFn(void* cvode_mem, CVLsJacFn jac);
 SUNDIALS_EXPORT int CVodeSetJacEvalFrequency(void* cvode_mem, long int msbj);
+SUNDIALS_EXPORT int CVodeSetJacSparsity(void* cvode_mem, SUNMatrix S);
+SUNDIALS_EXPORT int CVodeSetJacSparsityDetection(void* cvode_mem,
+                                                 sunbooleantype onoff);
 SUNDIALS_EXPORT int CVodeSetLinearSolutionScaling(void* cvode_mem,
                                                   sunbooleantype onoff);
 SUNDIALS_EXPORT int CVodeSetDeltaGammaMaxBadJac(void* cvode_mem,
@@ -104,6 +104,12 @@ SUNDIALS_EXPORT int IDAInit(void* ida_mem, IDAResFn res, sunrealtype t0,
 SUNDIALS_EXPORT int IDAReInit(void* ida_mem, sunrealtype t0, N_Vector yy0,
                               N_Vector yp0);
 
+/* Integrator state functions */
+SUNDIALS_EXPORT int IDAGetStateSize(void* ida_mem, size_t* bytes);
+SUNDIALS_EXPORT int IDASaveState(void* ida_mem, void* buffer, size_t bytes);
+SUNDIALS_EXPORT int IDALoadState(void* ida_mem, const void* buffer,
+                                 size_t bytes);
+
 /* Tolerance input functions */
 SUNDIALS_EXPORT int IDASStolerances(void* ida_mem, sunrealtype reltol,
                                     sunrealtype abstol);
@@ -126,6 +132,7 @@ SUNDIALS_EXPORT int IDASetMaxBacksIC(void* ida_mem, int maxbacks);
 /* Optional input functions */
 SUNDIALS_EXPORT int IDASetDeltaCjLSetup(void* ida_max, sunrealtype dcj);
 SUNDIALS_EXPORT int IDASetUserData(void* ida_mem, void* user_data);
+SUNDIALS_EXPORT int IDASetStepStats(void* ida_mem, SUNStepStats stats);
 SUNDIALS_EXPORT int IDASetMaxOrd(void* ida_mem, int maxord);
 SUNDIALS_EXPORT int IDASetMaxNumSteps(void* ida_mem, long int mxsteps);
 SUNDIALS_EXPORT int IDASetInitStep(void* ida_mem, sunrealtype hin);
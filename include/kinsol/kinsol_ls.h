@@ -72,6 +72,9 @@ SUNDIALS_EXPORT int KINSetLinearSolver(void* kinmem, SUNLinearSolver LS,
   -----------------------------------------------------------------*/
 
 SUNDIALS_EXPORT int KINSetJacFn(void* kinmem, KINLsJacFn jac);
+SUNDIALS_EXPORT int KINSetJacSparsity(void* kinmem, SUNMatrix S);
+SUNDIALS_EXPORT int KINSetJacSparsityDetection(void* kinmem,
+                                               sunbooleantype onoff);
 SUNDIALS_EXPORT int KINSetPreconditioner(void* kinmem, KINLsPrecSetupFn psetup,
                                          KINLsPrecSolveFn psolve);
 SUNDIALS_EXPORT int KINSetJacTimesVecFn(void* kinmem, KINLsJacTimesVecFn jtv);
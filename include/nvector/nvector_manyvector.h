@@ -162,6 +162,17 @@ SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMulti_ManyVector(int nvec, N_Vector x, N_Vector* Y,
                                       sunrealtype* dotprods);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationWrmsNorm_ManyVector(int nvec, sunrealtype* c,
+                                                   N_Vector* X, N_Vector z,
+                                                   N_Vector w,
+                                                   sunrealtype* nrm);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationMulti_ManyVector(int nvec, int nsum,
+                                                sunrealtype* c, N_Vector* X,
+                                                N_Vector* Z);
+
 /* vector array operations */
 
 SUNDIALS_EXPORT
@@ -205,6 +216,12 @@ sunrealtype N_VWSqrSumLocal_ManyVector(N_Vector x, N_Vector w);
 SUNDIALS_EXPORT
 sunrealtype N_VWSqrSumMaskLocal_ManyVector(N_Vector x, N_Vector w, N_Vector id);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationWSqrSumLocal_ManyVector(int nvec, sunrealtype* c,
+                                                       N_Vector* X, N_Vector z,
+                                                       N_Vector w,
+                                                       sunrealtype* sum);
+
 SUNDIALS_EXPORT
 sunbooleantype N_VInvTestLocal_ManyVector(N_Vector x, N_Vector z);
 
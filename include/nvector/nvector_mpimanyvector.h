@@ -189,6 +189,17 @@ SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMulti_MPIManyVector(int nvec, N_Vector x, N_Vector* Y,
                                          sunrealtype* dotprods);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationWrmsNorm_MPIManyVector(int nvec, sunrealtype* c,
+                                                      N_Vector* X, N_Vector z,
+                                                      N_Vector w,
+                                                      sunrealtype* nrm);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationMulti_MPIManyVector(int nvec, int nsum,
+                                                   sunrealtype* c, N_Vector* X,
+                                                   N_Vector* Z);
+
 /* single buffer reduction operations */
 SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMultiLocal_MPIManyVector(int nvec, N_Vector x, N_Vector* Y,
@@ -198,6 +209,19 @@ SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMultiAllReduce_MPIManyVector(int nvec_total, N_Vector x,
                                                   sunrealtype* sum);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VSumMaxMultiAllReduce_MPIManyVector(int nsum, int nmax, N_Vector x,
+                                                 sunrealtype* vals);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VDotProdMultiAllReduceBegin_MPIManyVector(int nvec_total,
+                                                       N_Vector x,
+                                                       sunrealtype* sum,
+                                                       void** request);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VDotProdMultiAllReduceEnd_MPIManyVector(N_Vector x, void* request);
+
 /* vector array operations */
 SUNDIALS_EXPORT
 SUNErrCode N_VLinearSumVectorArray_MPIManyVector(int nvec, sunrealtype a,
@@ -240,6 +264,14 @@ SUNDIALS_EXPORT
 sunrealtype N_VWSqrSumMaskLocal_MPIManyVector(N_Vector x, N_Vector w,
                                               N_Vector id);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationWSqrSumLocal_MPIManyVector(int nvec,
+                                                          sunrealtype* c,
+                                                          N_Vector* X,
+                                                          N_Vector z,
+                                                          N_Vector w,
+                                                          sunrealtype* sum);
+
 SUNDIALS_EXPORT
 sunbooleantype N_VInvTestLocal_MPIManyVector(N_Vector x, N_Vector z);
 
@@ -205,6 +205,13 @@ SUNErrCode N_VScaleAddMulti_OpenMP(int nvec, sunrealtype* a, N_Vector x,
 SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMulti_OpenMP(int nvec, N_Vector x, N_Vector* Y,
                                   sunrealtype* dotprods);
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationWrmsNorm_OpenMP(int nvec, sunrealtype* c,
+                                               N_Vector* X, N_Vector z,
+                                               N_Vector w, sunrealtype* nrm);
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationMulti_OpenMP(int nvec, int nsum, sunrealtype* c,
+                                            N_Vector* X, N_Vector* Z);
 
 /* vector array operations */
 
@@ -243,6 +250,12 @@ sunrealtype N_VWSqrSumLocal_OpenMP(N_Vector x, N_Vector w);
 SUNDIALS_EXPORT
 sunrealtype N_VWSqrSumMaskLocal_OpenMP(N_Vector x, N_Vector w, N_Vector id);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationWSqrSumLocal_OpenMP(int nvec, sunrealtype* c,
+                                                   N_Vector* X, N_Vector z,
+                                                   N_Vector w,
+                                                   sunrealtype* sum);
+
 /* OPTIONAL XBraid interface operations */
 
 SUNDIALS_EXPORT
@@ -213,6 +213,14 @@ SUNErrCode N_VScaleAddMulti_Parallel(int nvec, sunrealtype* a, N_Vector x,
 SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMulti_Parallel(int nvec, N_Vector x, N_Vector* Y,
                                     sunrealtype* dotprods);
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationWrmsNorm_Parallel(int nvec, sunrealtype* c,
+                                                 N_Vector* X, N_Vector z,
+                                                 N_Vector w, sunrealtype* nrm);
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationMulti_Parallel(int nvec, int nsum,
+                                              sunrealtype* c, N_Vector* X,
+                                              N_Vector* Z);
 
 /* vector array operations */
 SUNDIALS_EXPORT
@@ -260,6 +268,12 @@ sunrealtype N_VWSqrSumLocal_Parallel(N_Vector x, N_Vector w);
 SUNDIALS_EXPORT
 sunrealtype N_VWSqrSumMaskLocal_Parallel(N_Vector x, N_Vector w, N_Vector id);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationWSqrSumLocal_Parallel(int nvec, sunrealtype* c,
+                                                     N_Vector* X, N_Vector z,
+                                                     N_Vector w,
+                                                     sunrealtype* sum);
+
 SUNDIALS_EXPORT
 sunbooleantype N_VInvTestLocal_Parallel(N_Vector x, N_Vector z);
 
@@ -279,6 +293,18 @@ SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMultiAllReduce_Parallel(int nvec_total, N_Vector x,
                                              sunrealtype* dotprods);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VSumMaxMultiAllReduce_Parallel(int nsum, int nmax, N_Vector x,
+                                            sunrealtype* vals);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VDotProdMultiAllReduceBegin_Parallel(int nvec_total, N_Vector x,
+                                                  sunrealtype* sum,
+                                                  void** request);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VDotProdMultiAllReduceEnd_Parallel(N_Vector x, void* request);
+
 /* OPTIONAL XBraid interface operations */
 
 SUNDIALS_EXPORT
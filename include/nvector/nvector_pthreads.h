@@ -57,12 +57,16 @@ extern "C" {
  * -----------------------------------------------------------------
  */
 
+/* Persistent pool of worker threads shared by a vector and its clones */
+struct _Pthreads_Pool;
+
 struct _N_VectorContent_Pthreads
 {
-  sunindextype length;     /* vector length           */
-  sunbooleantype own_data; /* data ownership flag     */
-  sunrealtype* data;       /* data array              */
-  int num_threads;         /* number of POSIX threads */
+  sunindextype length;         /* vector length           */
+  sunbooleantype own_data;     /* data ownership flag     */
+  sunrealtype* data;           /* data array              */
+  int num_threads;             /* number of POSIX threads */
+  struct _Pthreads_Pool* pool; /* worker thread pool      */
 };
 
 typedef struct _N_VectorContent_Pthreads* N_VectorContent_Pthreads;
@@ -70,8 +74,9 @@ typedef struct _N_VectorContent_Pthreads* N_VectorContent_Pthreads;
 /* Structure to hold parallelization information for each thread when
    calling "companion" functions to compute vector operations. The
    start and end vector (loop) indices are unique to each thread, the
-   sunrealtype variables are the same for each thread, and the mutex
-   variable is used to lock variables in reductions. */
+   sunrealtype variables are the same for each thread, and local_val
+   holds the thread's partial result in reductions. The mutex variable
+   is no longer used by the vector operations. */
 
 struct _Pthreads_Data
 {
@@ -81,6 +86,7 @@ struct _Pthreads_Data
   sunrealtype *v1, *v2, *v3;     /* vector data              */
   sunrealtype* global_val;       /* shared global variable   */
   pthread_mutex_t* global_mutex; /* lock for shared variable */
+  sunrealtype local_val;         /* thread-local reduction   */
 
   int nvec; /* number of vectors in fused op */
   int nsum; /* number of sums in fused op    */
@@ -239,6 +245,10 @@ SUNErrCode N_VScaleAddMulti_Pthreads(int nvec, sunrealtype* a, N_Vector x,
 SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMulti_Pthreads(int nvec, N_Vector x, N_Vector* Y,
                                     sunrealtype* dotprods);
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationWrmsNorm_Pthreads(int nvec, sunrealtype* c,
+                                                 N_Vector* X, N_Vector z,
+                                                 N_Vector w, sunrealtype* nrm);
 
 /* vector array operations */
 SUNDIALS_EXPORT
@@ -273,6 +283,12 @@ sunrealtype N_VWSqrSumLocal_Pthreads(N_Vector x, N_Vector w);
 SUNDIALS_EXPORT
 sunrealtype N_VWSqrSumMaskLocal_Pthreads(N_Vector x, N_Vector w, N_Vector id);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationWSqrSumLocal_Pthreads(int nvec, sunrealtype* c,
+                                                     N_Vector* X, N_Vector z,
+                                                     N_Vector w,
+                                                     sunrealtype* sum);
+
 /* OPTIONAL XBraid interface operations */
 SUNDIALS_EXPORT
 SUNErrCode N_VBufSize_Pthreads(N_Vector x, sunindextype* size);
@@ -192,6 +192,13 @@ SUNErrCode N_VScaleAddMulti_Serial(int nvec, sunrealtype* a, N_Vector x,
 SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMulti_Serial(int nvec, N_Vector x, N_Vector* Y,
                                   sunrealtype* dotprods);
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationWrmsNorm_Serial(int nvec, sunrealtype* c,
+                                               N_Vector* X, N_Vector z,
+                                               N_Vector w, sunrealtype* nrm);
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationMulti_Serial(int nvec, int nsum, sunrealtype* c,
+                                            N_Vector* X, N_Vector* Z);
 
 /* vector array operations */
 SUNDIALS_EXPORT
@@ -231,6 +238,12 @@ sunrealtype N_VWSqrSumLocal_Serial(N_Vector x, N_Vector w);
 SUNDIALS_EXPORT
 sunrealtype N_VWSqrSumMaskLocal_Serial(N_Vector x, N_Vector w, N_Vector id);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationWSqrSumLocal_Serial(int nvec, sunrealtype* c,
+                                                   N_Vector* X, N_Vector z,
+                                                   N_Vector w,
+                                                   sunrealtype* sum);
+
 /* OPTIONAL XBraid interface operations */
 SUNDIALS_EXPORT
 SUNErrCode N_VBufSize_Serial(N_Vector x, sunindextype* size);
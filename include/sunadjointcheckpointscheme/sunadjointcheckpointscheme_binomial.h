@@ -0,0 +1,64 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * SUNAdjointCheckpointScheme_Binomial class declaration.
+ * ----------------------------------------------------------------*/
+
+#ifndef _SUNADJOINTCHECKPOINTSCHEME_BINOMIAL_H
+#define _SUNADJOINTCHECKPOINTSCHEME_BINOMIAL_H
+
+#include <sundials/sundials_adjointcheckpointscheme.h>
+#include <sundials/sundials_core.h>
+#include <sundials/sundials_export.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+SUNDIALS_EXPORT
+SUNErrCode SUNAdjointCheckpointScheme_Create_Binomial(
+  SUNDataIOMode io_mode, SUNMemoryHelper mem_helper,
+  suncountertype max_checkpoints, SUNContext sunctx,
+  SUNAdjointCheckpointScheme* check_scheme_ptr);
+
+SUNDIALS_EXPORT SUNErrCode SUNAdjointCheckpointScheme_NeedsSaving_Binomial(
+  SUNAdjointCheckpointScheme check_scheme, suncountertype step_num,
+  suncountertype stage_num, sunrealtype t, sunbooleantype* yes_or_no);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNAdjointCheckpointScheme_InsertVector_Binomial(
+  SUNAdjointCheckpointScheme check_scheme, suncountertype step_num,
+  suncountertype stage_num, sunrealtype t, N_Vector state);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNAdjointCheckpointScheme_LoadVector_Binomial(
+  SUNAdjointCheckpointScheme check_scheme, suncountertype step_num,
+  suncountertype stage_num, sunbooleantype peek, N_Vector* out,
+  sunrealtype* tout);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNAdjointCheckpointScheme_Destroy_Binomial(
+  SUNAdjointCheckpointScheme* check_scheme_ptr);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNAdjointCheckpointScheme_EnableDense_Binomial(
+  SUNAdjointCheckpointScheme check_scheme, sunbooleantype on_or_off);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNAdjointCheckpointScheme_GetNumCheckpoints_Binomial(
+  SUNAdjointCheckpointScheme check_scheme, suncountertype* num_checkpoints);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SUNADJOINTCHECKPOINTSCHEME_BINOMIAL_H */
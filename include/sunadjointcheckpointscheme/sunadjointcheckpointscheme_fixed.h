@@ -53,6 +53,34 @@ SUNDIALS_EXPORT
 SUNErrCode SUNAdjointCheckpointScheme_EnableDense_Fixed(
   SUNAdjointCheckpointScheme check_scheme, sunbooleantype on_or_off);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNAdjointCheckpointScheme_SetErrorWeights_Fixed(
+  SUNAdjointCheckpointScheme check_scheme, N_Vector ewt);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNAdjointCheckpointScheme_EnableAsync_Fixed(
+  SUNAdjointCheckpointScheme check_scheme, int num_buffers);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNAdjointCheckpointScheme_EnableMultilevel_Fixed(
+  SUNAdjointCheckpointScheme check_scheme, suncountertype max_mem_steps,
+  suncountertype promote_steps);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNAdjointCheckpointScheme_GetMultilevelStats_Fixed(
+  SUNAdjointCheckpointScheme check_scheme, suncountertype* num_spilled,
+  suncountertype* num_promoted);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNAdjointCheckpointScheme_EnableCompression_Fixed(
+  SUNAdjointCheckpointScheme check_scheme, SUNDataCompression compression,
+  sunrealtype tol);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNAdjointCheckpointScheme_GetCompressionStats_Fixed(
+  SUNAdjointCheckpointScheme check_scheme, size_t* raw_bytes,
+  size_t* stored_bytes);
+
 #ifdef __cplusplus
 }
 #endif
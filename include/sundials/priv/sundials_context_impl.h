@@ -37,6 +37,9 @@ struct SUNContext_
   SUNErrCode last_err;
   SUNErrHandler err_handler;
   SUNComm comm;
+  struct SUNVectorPool_* vector_pool;
+  struct SUNMmapStore_* mmap_store;
+  struct SUNMPIReduce_* mpi_reduce;
 };
 
 #ifdef __cplusplus
@@ -0,0 +1,58 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * !!!!!!!!!!!!!!!!!!!!!!!!! WARNING !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ * This is a 'private' header file and should not be used in user
+ * code. It is subject to change without warning.
+ * !!!!!!!!!!!!!!!!!!!!!!!!! WARNING !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ * -----------------------------------------------------------------
+ * Mixed sum and max all-reduce shared by the MPI vectors. The MPI
+ * operation, datatype, and buffer it needs are created on first use
+ * and kept in the SUNContext until it is freed.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_MPI_REDUCE_IMPL_H
+#define _SUNDIALS_MPI_REDUCE_IMPL_H
+
+#include <mpi.h>
+#include <sundials/sundials_context.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+typedef struct SUNMPIReduce_* SUNMPIReduce;
+
+struct SUNMPIReduce_
+{
+  MPI_Op op;          /* sum/max operation, MPI_OP_NULL until created  */
+  MPI_Datatype dtype; /* contiguous type of dtype_len values or NULL   */
+  int dtype_len;      /* number of values in dtype                     */
+  sunrealtype* buf;   /* reduction buffer                              */
+  int buf_len;        /* number of values buf holds                    */
+};
+
+/* Sums the first nsum values in vals and takes the maximum of the next nmax
+   values across the ranks in comm */
+SUNDIALS_EXPORT
+SUNErrCode SUNMPIAllReduceSumMax(SUNContext sunctx, MPI_Comm comm, int nsum,
+                                 int nmax, sunrealtype* vals);
+
+/* Frees the MPI objects and buffer held for SUNMPIAllReduceSumMax */
+SUNDIALS_EXPORT
+void SUNMPIReduce_Destroy(SUNMPIReduce* reduce);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -43,6 +43,9 @@ typedef SUNErrCode (*SUNAdjointCheckpointSchemeDestroyFn)(
 typedef SUNErrCode (*SUNAdjointCheckpointSchemeEnableDenseFn)(
   SUNAdjointCheckpointScheme check_scheme, sunbooleantype on_or_off);
 
+typedef SUNErrCode (*SUNAdjointCheckpointSchemeSetErrorWeightsFn)(
+  SUNAdjointCheckpointScheme check_scheme, N_Vector ewt);
+
 /*
  * "static" base class methods
  */
@@ -79,6 +82,11 @@ SUNErrCode SUNAdjointCheckpointScheme_SetEnableDenseFn(
   SUNAdjointCheckpointScheme check_scheme,
   SUNAdjointCheckpointSchemeEnableDenseFn);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNAdjointCheckpointScheme_SetErrorWeightsFn(
+  SUNAdjointCheckpointScheme check_scheme,
+  SUNAdjointCheckpointSchemeSetErrorWeightsFn);
+
 SUNDIALS_EXPORT
 SUNErrCode SUNAdjointCheckpointScheme_SetContent(
   SUNAdjointCheckpointScheme check_scheme, void* content);
@@ -114,6 +122,10 @@ SUNDIALS_EXPORT
 SUNErrCode SUNAdjointCheckpointScheme_EnableDense(
   SUNAdjointCheckpointScheme check_scheme, sunbooleantype on_or_off);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNAdjointCheckpointScheme_SetErrorWeights(
+  SUNAdjointCheckpointScheme check_scheme, N_Vector ewt);
+
 #ifdef __cplusplus
 }
 #endif
@@ -56,6 +56,13 @@ SUNErrCode SUNContext_GetLogger(SUNContext sunctx, SUNLogger* logger);
 SUNDIALS_EXPORT
 SUNErrCode SUNContext_SetLogger(SUNContext sunctx, SUNLogger logger);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNContext_SetVectorPoolSize(SUNContext sunctx, int max_vectors);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNContext_GetVectorPoolStats(SUNContext sunctx, long int* num_reused,
+                                         long int* num_cloned);
+
 SUNDIALS_EXPORT
 SUNErrCode SUNContext_Free(SUNContext* ctx);
 
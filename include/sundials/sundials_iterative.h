@@ -72,13 +72,19 @@ enum
  * SUN_CLASSICAL_GS : The iterative solver uses the classical
  *                    Gram-Schmidt routine SUNClassicalGS listed in
  *                    this file.
+ *
+ * SUN_PIPELINED_GS : The iterative solver uses a pipelined classical
+ *                    Gram-Schmidt process that overlaps the global
+ *                    reduction for the inner products with the next
+ *                    matrix-vector product and preconditioner solve.
  * -----------------------------------------------------------------
  */
 
 enum
 {
   SUN_MODIFIED_GS  = 1,
-  SUN_CLASSICAL_GS = 2
+  SUN_CLASSICAL_GS = 2,
+  SUN_PIPELINED_GS = 3
 };
 
 /*
@@ -33,6 +33,18 @@ typedef enum
   SUN_LOGLEVEL_DEBUG   = 4
 } SUNLogLevel;
 
+typedef enum
+{
+  SUN_LOGOVERFLOW_BLOCK = 0,
+  SUN_LOGOVERFLOW_DROP  = 1
+} SUNLogOverflowPolicy;
+
+typedef enum
+{
+  SUN_LOGFORMAT_TEXT   = 0,
+  SUN_LOGFORMAT_BINARY = 1
+} SUNLogFormat;
+
 SUNDIALS_EXPORT
 SUNErrCode SUNLogger_Create(SUNComm comm, int output_rank, SUNLogger* logger);
 
@@ -62,6 +74,16 @@ SUNErrCode SUNLogger_QueueMsg(SUNLogger logger, SUNLogLevel lvl,
 SUNDIALS_EXPORT
 SUNErrCode SUNLogger_Flush(SUNLogger logger, SUNLogLevel lvl);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNLogger_EnableAsync(SUNLogger logger, int buffer_size,
+                                 SUNLogOverflowPolicy policy);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLogger_GetNumDroppedMsgs(SUNLogger logger, long int* ndropped);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLogger_SetFormat(SUNLogger logger, SUNLogFormat format);
+
 SUNDIALS_EXPORT
 SUNErrCode SUNLogger_GetOutputRank(SUNLogger logger, int* output_rank);
 
@@ -148,6 +148,10 @@ struct _generic_N_Vector_Ops
   SUNErrCode (*nvscaleaddmulti)(int, sunrealtype*, N_Vector, N_Vector*,
                                 N_Vector*);
   SUNErrCode (*nvdotprodmulti)(int, N_Vector, N_Vector*, sunrealtype*);
+  SUNErrCode (*nvlinearcombinationwrmsnorm)(int, sunrealtype*, N_Vector*,
+                                            N_Vector, N_Vector, sunrealtype*);
+  SUNErrCode (*nvlinearcombinationmulti)(int, int, sunrealtype*, N_Vector*,
+                                         N_Vector*);
 
   /* OPTIONAL vector array operations */
   SUNErrCode (*nvlinearsumvectorarray)(int, sunrealtype, N_Vector*, sunrealtype,
@@ -176,10 +180,17 @@ struct _generic_N_Vector_Ops
   sunrealtype (*nvminquotientlocal)(N_Vector, N_Vector);
   sunrealtype (*nvwsqrsumlocal)(N_Vector, N_Vector);
   sunrealtype (*nvwsqrsummasklocal)(N_Vector, N_Vector, N_Vector);
+  SUNErrCode (*nvlinearcombinationwsqrsumlocal)(int, sunrealtype*, N_Vector*,
+                                                N_Vector, N_Vector,
+                                                sunrealtype*);
 
   /* Single buffer reduction operations */
   SUNErrCode (*nvdotprodmultilocal)(int, N_Vector, N_Vector*, sunrealtype*);
   SUNErrCode (*nvdotprodmultiallreduce)(int, N_Vector, sunrealtype*);
+  SUNErrCode (*nvsummaxmultiallreduce)(int, int, N_Vector, sunrealtype*);
+  SUNErrCode (*nvdotprodmultiallreducebegin)(int, N_Vector, sunrealtype*,
+                                             void**);
+  SUNErrCode (*nvdotprodmultiallreduceend)(N_Vector, void*);
 
   /* XBraid interface operations */
   SUNErrCode (*nvbufsize)(N_Vector, sunindextype*);
@@ -199,6 +210,7 @@ struct _generic_N_Vector
   void* content;
   N_Vector_Ops ops;
   SUNContext sunctx;
+  sunbooleantype pooled; /* may be returned to the SUNContext vector pool */
 };
 
 /* -----------------------------------------------------------------
@@ -266,6 +278,15 @@ SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMulti(int nvec, N_Vector x, N_Vector* Y,
                            sunrealtype* dotprods);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationWrmsNorm(int nvec, sunrealtype* c, N_Vector* X,
+                                        N_Vector z, N_Vector w,
+                                        sunrealtype* nrm);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VLinearCombinationMulti(int nvec, int nsum, sunrealtype* c,
+                                     N_Vector* X, N_Vector* Z);
+
 /* vector array operations */
 SUNDIALS_EXPORT
 SUNErrCode N_VLinearSumVectorArray(int nvec, sunrealtype a, N_Vector* X,
@@ -310,12 +331,27 @@ SUNDIALS_EXPORT sunbooleantype N_VInvTestLocal(N_Vector x, N_Vector z);
 SUNDIALS_EXPORT sunbooleantype N_VConstrMaskLocal(N_Vector c, N_Vector x,
                                                   N_Vector m);
 SUNDIALS_EXPORT sunrealtype N_VMinQuotientLocal(N_Vector num, N_Vector denom);
+SUNDIALS_EXPORT SUNErrCode N_VLinearCombinationWSqrSumLocal(int nvec,
+                                                            sunrealtype* c,
+                                                            N_Vector* X,
+                                                            N_Vector z,
+                                                            N_Vector w,
+                                                            sunrealtype* sum);
 
 /* single buffer reduction operations */
 SUNDIALS_EXPORT SUNErrCode N_VDotProdMultiLocal(int nvec, N_Vector x, N_Vector* Y,
                                                 sunrealtype* dotprods);
 SUNDIALS_EXPORT SUNErrCode N_VDotProdMultiAllReduce(int nvec_total, N_Vector x,
                                                     sunrealtype* sum);
+SUNDIALS_EXPORT SUNErrCode N_VSumMaxMultiAllReduce(int nsum, int nmax,
+                                                   N_Vector x,
+                                                   sunrealtype* vals);
+SUNDIALS_EXPORT SUNErrCode N_VDotProdMultiAllReduceBegin(int nvec_total,
+                                                         N_Vector x,
+                                                         sunrealtype* sum,
+                                                         void** request);
+SUNDIALS_EXPORT SUNErrCode N_VDotProdMultiAllReduceEnd(N_Vector x,
+                                                       void* request);
 
 /* XBraid interface operations */
 SUNDIALS_EXPORT SUNErrCode N_VBufSize(N_Vector x, sunindextype* size);
@@ -38,6 +38,16 @@ SUNErrCode SUNProfiler_Begin(SUNProfiler p, const char* name);
 SUNDIALS_EXPORT
 SUNErrCode SUNProfiler_End(SUNProfiler p, const char* name);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_RegisterRegion(SUNProfiler p, const char* name,
+                                      int* region);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_BeginRegion(SUNProfiler p, int region);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_EndRegion(SUNProfiler p, int region);
+
 SUNDIALS_EXPORT
 SUNErrCode SUNProfiler_GetTimerResolution(SUNProfiler p, double* resolution);
 
@@ -51,6 +61,23 @@ SUNErrCode SUNProfiler_Print(SUNProfiler p, FILE* fp);
 SUNDIALS_EXPORT
 SUNErrCode SUNProfiler_Reset(SUNProfiler p);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_EnableTrace(SUNProfiler p, sunbooleantype onoff);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_WriteTrace(SUNProfiler p, FILE* fp);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_WriteFlameGraph(SUNProfiler p, FILE* fp);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_EnableCounters(SUNProfiler p, sunbooleantype onoff);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_GetCounters(SUNProfiler p, const char* name,
+                                   long int* cycles, long int* instructions,
+                                   long int* cache_misses);
+
 #if defined(SUNDIALS_BUILD_WITH_PROFILING) && defined(SUNDIALS_CALIPER_ENABLED)
 
 #define SUNDIALS_MARK_FUNCTION_BEGIN(profobj) CALI_MARK_FUNCTION_BEGIN
@@ -0,0 +1,84 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * SUNStepStats records one entry per integrator step (or nonlinear
+ * iteration in KINSOL) into a preallocated columnar buffer. Full
+ * buffers are handed to a user-supplied sink function and/or
+ * appended to a compact binary file.
+ * ----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_STEPSTATS_H
+#define _SUNDIALS_STEPSTATS_H
+
+#include <sundials/sundials_context.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* Forward reference for pointer to SUNStepStats object */
+typedef struct SUNStepStats_* SUNStepStats;
+
+/* A block of buffered records in columnar (structure of arrays) form. The
+   counter columns hold the change since the previous record and wall_time is
+   the elapsed time in seconds since the previous record. */
+typedef struct
+{
+  int num_records;
+  const sunrealtype* t;
+  const sunrealtype* h;
+  const int* order;
+  const long int* netf;
+  const long int* nni;
+  const long int* nli;
+  const long int* nsetups;
+  const double* wall_time;
+} SUNStepStatsBlock;
+
+typedef int (*SUNStepStatsSinkFn)(const SUNStepStatsBlock* block,
+                                  void* user_data);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNStepStats_Create(SUNContext sunctx, int buffer_size,
+                               SUNStepStats* stats);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNStepStats_SetFilename(SUNStepStats stats, const char* fname);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNStepStats_SetSink(SUNStepStats stats, SUNStepStatsSinkFn sink,
+                                void* user_data);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNStepStats_SetBaseline(SUNStepStats stats, long int netf,
+                                    long int nni, long int nli,
+                                    long int nsetups);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNStepStats_Record(SUNStepStats stats, sunrealtype t,
+                               sunrealtype h, int order, long int netf,
+                               long int nni, long int nli, long int nsetups);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNStepStats_Flush(SUNStepStats stats);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNStepStats_GetNumRecords(SUNStepStats stats, long int* num_records);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNStepStats_Destroy(SUNStepStats* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SUNDIALS_STEPSTATS_H */
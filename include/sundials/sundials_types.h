@@ -266,6 +266,23 @@ typedef int SUNComm;
 typedef enum
 {
   SUNDATAIOMODE_INMEM,
+  SUNDATAIOMODE_MMAP,
 } SUNDataIOMode;
 
+/*
+ *------------------------------------------------------------------
+ * Type : SUNDataCompression
+ *------------------------------------------------------------------
+ * Type that selects how vector data is compressed when it is
+ * stored, notably checkpoints for adjoints.
+ *------------------------------------------------------------------
+ */
+
+typedef enum
+{
+  SUNDATACOMPRESSION_NONE,
+  SUNDATACOMPRESSION_LOSSLESS,
+  SUNDATACOMPRESSION_LOSSY,
+} SUNDataCompression;
+
 #endif /* _SUNDIALS_TYPES_H */
@@ -0,0 +1,94 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the header file for the block-diagonal dense
+ * implementation of the SUNLINSOL module, SUNLINSOL_BLOCKDENSE.
+ *
+ * The solver factors all blocks of a SUNMATRIX_BLOCKDENSE matrix
+ * with LU factorization and partial pivoting. The factorization
+ * and triangular solves process the same entry of every block
+ * together, so the loops over the blocks are contiguous and can be
+ * vectorized by the compiler.
+ *
+ * Notes:
+ *   - The definition of the generic SUNLinearSolver structure can
+ *     be found in the header file sundials_linearsolver.h.
+ * -----------------------------------------------------------------
+ */
+
+#ifndef _SUNLINSOL_BLOCKDENSE_H
+#define _SUNLINSOL_BLOCKDENSE_H
+
+#include <sundials/sundials_linearsolver.h>
+#include <sundials/sundials_matrix.h>
+#include <sundials/sundials_nvector.h>
+#include <sunmatrix/sunmatrix_blockdense.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* -----------------------------------------------------
+ * Block-diagonal dense Implementation of SUNLinearSolver
+ * ----------------------------------------------------- */
+
+struct _SUNLinearSolverContent_BlockDense
+{
+  sunindextype N;         /* size of each block                  */
+  sunindextype nblocks;   /* number of blocks                    */
+  sunindextype* pivots;   /* interleaved pivots of all blocks    */
+  sunrealtype* work;      /* workspace with one entry per block  */
+  sunindextype last_flag; /* last error return flag              */
+};
+
+typedef struct _SUNLinearSolverContent_BlockDense* SUNLinearSolverContent_BlockDense;
+
+/* ---------------------------------------------
+ * Exported Functions for SUNLINSOL_BLOCKDENSE
+ * --------------------------------------------- */
+
+SUNDIALS_EXPORT
+SUNLinearSolver SUNLinSol_BlockDense(N_Vector y, SUNMatrix A,
+                                     SUNContext sunctx);
+
+SUNDIALS_EXPORT
+SUNLinearSolver_Type SUNLinSolGetType_BlockDense(SUNLinearSolver S);
+
+SUNDIALS_EXPORT
+SUNLinearSolver_ID SUNLinSolGetID_BlockDense(SUNLinearSolver S);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSolInitialize_BlockDense(SUNLinearSolver S);
+
+SUNDIALS_EXPORT
+int SUNLinSolSetup_BlockDense(SUNLinearSolver S, SUNMatrix A);
+
+SUNDIALS_EXPORT
+int SUNLinSolSolve_BlockDense(SUNLinearSolver S, SUNMatrix A, N_Vector x,
+                              N_Vector b, sunrealtype tol);
+
+SUNDIALS_EXPORT
+sunindextype SUNLinSolLastFlag_BlockDense(SUNLinearSolver S);
+
+SUNDIALS_DEPRECATED_EXPORT_MSG(
+  "Work space functions will be removed in version 8.0.0")
+SUNErrCode SUNLinSolSpace_BlockDense(SUNLinearSolver S, long int* lenrwLS,
+                                     long int* leniwLS);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSolFree_BlockDense(SUNLinearSolver S);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
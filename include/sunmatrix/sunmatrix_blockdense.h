@@ -0,0 +1,122 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the header file for the block-diagonal dense
+ * implementation of the SUNMATRIX module, SUNMATRIX_BLOCKDENSE.
+ *
+ * The matrix holds nblocks dense M by N blocks on its diagonal.
+ * The blocks are stored interleaved: entry (i,j) of block k is at
+ *
+ *   data[(j * M + i) * nblocks + k]
+ *
+ * so the same entry of all blocks is contiguous. The matching
+ * vectors store component i of system k at index i * nblocks + k.
+ * Every operation loops over the blocks innermost, so the blocks
+ * occupy the SIMD lanes.
+ *
+ * Notes:
+ *   - The definition of the generic SUNMatrix structure can be found
+ *     in the header file sundials_matrix.h.
+ * -----------------------------------------------------------------
+ */
+
+#ifndef _SUNMATRIX_BLOCKDENSE_H
+#define _SUNMATRIX_BLOCKDENSE_H
+
+#include <stdio.h>
+#include <sundials/sundials_matrix.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* ------------------------------------------------
+ * Block-diagonal dense implementation of SUNMatrix
+ * ------------------------------------------------ */
+
+struct _SUNMatrixContent_BlockDense
+{
+  sunindextype nblocks; /* number of blocks                */
+  sunindextype M;       /* number of rows in each block    */
+  sunindextype N;       /* number of columns in each block */
+  sunindextype ldata;   /* length of data array            */
+  sunrealtype* data;    /* interleaved block data          */
+};
+
+typedef struct _SUNMatrixContent_BlockDense* SUNMatrixContent_BlockDense;
+
+/* -----------------------------------------
+ * Macros for access to SUNMATRIX_BLOCKDENSE
+ * ----------------------------------------- */
+
+#define SM_CONTENT_BD(A) ((SUNMatrixContent_BlockDense)(A->content))
+
+#define SM_NBLOCKS_BD(A) (SM_CONTENT_BD(A)->nblocks)
+
+#define SM_BLOCKROWS_BD(A) (SM_CONTENT_BD(A)->M)
+
+#define SM_BLOCKCOLUMNS_BD(A) (SM_CONTENT_BD(A)->N)
+
+#define SM_LDATA_BD(A) (SM_CONTENT_BD(A)->ldata)
+
+#define SM_DATA_BD(A) (SM_CONTENT_BD(A)->data)
+
+#define SM_ENTRY_BD(A, i, j) \
+  (SM_DATA_BD(A) + ((j) * SM_BLOCKROWS_BD(A) + (i)) * SM_NBLOCKS_BD(A))
+
+#define SM_ELEMENT_BD(A, k, i, j) (SM_ENTRY_BD(A, i, j)[k])
+
+/* --------------------------------------------
+ * Exported Functions for SUNMATRIX_BLOCKDENSE
+ * -------------------------------------------- */
+
+SUNDIALS_EXPORT SUNMatrix SUNBlockDenseMatrix(sunindextype nblocks,
+                                              sunindextype M, sunindextype N,
+                                              SUNContext sunctx);
+
+SUNDIALS_EXPORT void SUNBlockDenseMatrix_Print(SUNMatrix A, FILE* outfile);
+
+SUNDIALS_EXPORT sunindextype SUNBlockDenseMatrix_Rows(SUNMatrix A);
+SUNDIALS_EXPORT sunindextype SUNBlockDenseMatrix_Columns(SUNMatrix A);
+SUNDIALS_EXPORT sunindextype SUNBlockDenseMatrix_BlockRows(SUNMatrix A);
+SUNDIALS_EXPORT sunindextype SUNBlockDenseMatrix_BlockColumns(SUNMatrix A);
+SUNDIALS_EXPORT sunindextype SUNBlockDenseMatrix_NumBlocks(SUNMatrix A);
+SUNDIALS_EXPORT sunindextype SUNBlockDenseMatrix_LData(SUNMatrix A);
+SUNDIALS_EXPORT sunrealtype* SUNBlockDenseMatrix_Data(SUNMatrix A);
+SUNDIALS_EXPORT sunrealtype* SUNBlockDenseMatrix_Entry(SUNMatrix A,
+                                                       sunindextype i,
+                                                       sunindextype j);
+
+SUNDIALS_EXPORT SUNMatrix_ID SUNMatGetID_BlockDense(SUNMatrix A);
+SUNDIALS_EXPORT SUNMatrix SUNMatClone_BlockDense(SUNMatrix A);
+SUNDIALS_EXPORT void SUNMatDestroy_BlockDense(SUNMatrix A);
+SUNDIALS_EXPORT SUNErrCode SUNMatZero_BlockDense(SUNMatrix A);
+SUNDIALS_EXPORT SUNErrCode SUNMatCopy_BlockDense(SUNMatrix A, SUNMatrix B);
+SUNDIALS_EXPORT SUNErrCode SUNMatScaleAdd_BlockDense(sunrealtype c, SUNMatrix A,
+                                                     SUNMatrix B);
+SUNDIALS_EXPORT SUNErrCode SUNMatScaleAddI_BlockDense(sunrealtype c,
+                                                      SUNMatrix A);
+SUNDIALS_EXPORT SUNErrCode SUNMatMatvec_BlockDense(SUNMatrix A, N_Vector x,
+                                                   N_Vector y);
+SUNDIALS_EXPORT SUNErrCode SUNMatHermitianTransposeVec_BlockDense(SUNMatrix A,
+                                                                  N_Vector x,
+                                                                  N_Vector y);
+SUNDIALS_DEPRECATED_EXPORT_MSG(
+  "Work space functions will be removed in version 8.0.0")
+SUNErrCode SUNMatSpace_BlockDense(SUNMatrix A, long int* lenrw,
+                                  long int* leniw);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
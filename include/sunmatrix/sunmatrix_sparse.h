@@ -70,6 +70,10 @@ struct _SUNMatrixContent_Sparse
   /* CSR indices */
   sunindextype** colvals;
   sunindextype** rowptrs;
+  /* cached location in this matrix of each nonzero in the matrix most
+     recently added with SUNMatScaleAdd */
+  sunindextype* scaleadd_map;
+  sunindextype scaleadd_nnz;
 };
 
 typedef struct _SUNMatrixContent_Sparse* SUNMatrixContent_Sparse;
@@ -28,6 +28,13 @@ extern "C" {
 SUNDIALS_EXPORT
 SUNMemoryHelper SUNMemoryHelper_Sys(SUNContext sunctx);
 
+SUNDIALS_EXPORT
+SUNMemoryHelper SUNMemoryHelper_SysPool(SUNContext sunctx);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMemoryHelper_SetArenaSize_Sys(SUNMemoryHelper helper,
+                                            size_t arena_size);
+
 /* SUNMemoryHelper functions */
 
 SUNDIALS_EXPORT
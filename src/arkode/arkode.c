@@ -656,9 +656,10 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
 {
   long int nstloc;
   int retval, kflag, istate, ir;
-  int ewtsetOK;
+  int ewtsetOK, rwtsetOK;
   sunrealtype troundoff, nrm;
   sunbooleantype inactive_roots;
+  sunReduceBatch rb;
   sunrealtype dsm;
   int nflag, ncf, nef, constrfails;
   int relax_fails;
@@ -773,10 +774,40 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
   {
     ark_mem->next_h = ark_mem->h;
 
-    /* Reset and check ewt and rwt */
+    /* Reset ewt and rwt and compute the norm for the accuracy test below.
+       The norm and the positivity tests of ewt and rwt share one global
+       reduction. */
+    sunReduceBatch_Init(&rb);
+    ark_mem->ewt_min = ONE;
+    ark_mem->rwt_min = ONE;
+    ewtsetOK         = 0;
+    rwtsetOK         = 0;
     if (!ark_mem->initsetup)
     {
+      ark_mem->wt_batch = &rb;
       ewtsetOK = ark_mem->efun(ark_mem->yn, ark_mem->ewt, ark_mem->e_data);
+      if (ewtsetOK == 0 && !ark_mem->rwt_is_ewt)
+      {
+        rwtsetOK = ark_mem->rfun(ark_mem->yn, ark_mem->rwt, ark_mem->r_data);
+      }
+      ark_mem->wt_batch = NULL;
+    }
+    sunReduceBatch_WrmsNorm(&rb, ark_mem->yn, ark_mem->ewt, &nrm);
+    if (sunReduceBatch_Finalize(&rb))
+    {
+      arkProcessError(ark_mem, ARK_VECTOROP_ERR, __LINE__, __func__, __FILE__,
+                      MSG_ARK_VECTOROP_ERR, ark_mem->tcur);
+      istate            = ARK_VECTOROP_ERR;
+      ark_mem->tretlast = *tret = ark_mem->tcur;
+      N_VScale(ONE, ark_mem->yn, yout);
+      break;
+    }
+    if (ark_mem->ewt_min <= ZERO) { ewtsetOK = -1; }
+    if (ark_mem->rwt_min <= ZERO) { rwtsetOK = -1; }
+
+    /* Check ewt and rwt */
+    if (!ark_mem->initsetup)
+    {
       if (ewtsetOK != 0)
       {
         if (ark_mem->itol == ARK_WF)
@@ -798,8 +829,7 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
 
       if (!ark_mem->rwt_is_ewt)
       {
-        ewtsetOK = ark_mem->rfun(ark_mem->yn, ark_mem->rwt, ark_mem->r_data);
-        if (ewtsetOK != 0)
+        if (rwtsetOK != 0)
         {
           if (ark_mem->itol == ARK_WF)
           {
@@ -820,6 +850,28 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
       }
     }
 
+    /* Pass the current error weights to the checkpointing scheme (there are
+       none when the error is not controlled) */
+    if (ark_mem->checkpoint_scheme)
+    {
+      N_Vector ewt = (ark_mem->efun == arkEwtSetSmallReal) ? NULL
+                                                           : ark_mem->ewt;
+      SUNErrCode errcode =
+        SUNAdjointCheckpointScheme_SetErrorWeights(ark_mem->checkpoint_scheme,
+                                                   ewt);
+      if (errcode)
+      {
+        arkProcessError(ark_mem, ARK_ADJ_CHECKPOINT_FAIL, __LINE__, __func__,
+                        __FILE__,
+                        "SUNAdjointCheckpointScheme_SetErrorWeights returned %d",
+                        errcode);
+        istate            = ARK_ADJ_CHECKPOINT_FAIL;
+        ark_mem->tretlast = *tret = ark_mem->tcur;
+        N_VScale(ONE, ark_mem->yn, yout);
+        break;
+      }
+    }
+
     /* Check for too many steps */
     if ((ark_mem->mxstep > 0) && (nstloc >= ark_mem->mxstep))
     {
@@ -832,7 +884,6 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
     }
 
     /* Check for too much accuracy requested */
-    nrm            = N_VWrmsNorm(ark_mem->yn, ark_mem->ewt);
     ark_mem->tolsf = ark_mem->uround * nrm;
     if (ark_mem->tolsf > ONE && !ark_mem->fixedstep)
     {
@@ -1225,6 +1276,101 @@ int ARKodeGetDky(void* arkode_mem, sunrealtype t, int k, N_Vector dky)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  ARKodeGetDkyMulti:
+
+  This routine computes the k-th derivative of the interpolating
+  polynomial at each of the nt times t[m] and stores the results
+  in the vectors dky[m].  It matches nt calls to ARKodeGetDky,
+  but evaluates all of the times together through
+  arkInterpEvaluateMulti, so that the interpolation data is
+  read once for the whole batch.
+  ---------------------------------------------------------------*/
+int ARKodeGetDkyMulti(void* arkode_mem, int nt, sunrealtype* t, int k,
+                      N_Vector* dky)
+{
+  sunrealtype *s, tfuzz, tp, tn1;
+  int m, retval;
+  ARKodeMem ark_mem;
+
+  /* Check if ark_mem exists */
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* Check all inputs for legality */
+  if ((nt < 1) || (t == NULL))
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "nt < 1 or t = NULL illegal.");
+    return (ARK_ILL_INPUT);
+  }
+  if (dky == NULL)
+  {
+    arkProcessError(ark_mem, ARK_BAD_DKY, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NULL_DKY);
+    return (ARK_BAD_DKY);
+  }
+  for (m = 0; m < nt; m++)
+  {
+    if (dky[m] == NULL)
+    {
+      arkProcessError(ark_mem, ARK_BAD_DKY, __LINE__, __func__, __FILE__,
+                      MSG_ARK_NULL_DKY);
+      return (ARK_BAD_DKY);
+    }
+  }
+  if (ark_mem->interp == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    "Missing interpolation structure");
+    return (ARK_MEM_NULL);
+  }
+
+  /* Allow for some slack */
+  tfuzz = FUZZ_FACTOR * ark_mem->uround *
+          (SUNRabs(ark_mem->tcur) + SUNRabs(ark_mem->hold));
+  if (ark_mem->hold < ZERO) { tfuzz = -tfuzz; }
+  tp  = ark_mem->tcur - ark_mem->hold - tfuzz;
+  tn1 = ark_mem->tcur + tfuzz;
+  for (m = 0; m < nt; m++)
+  {
+    if ((t[m] - tp) * (t[m] - tn1) > ZERO)
+    {
+      arkProcessError(ark_mem, ARK_BAD_T, __LINE__, __func__, __FILE__,
+                      MSG_ARK_BAD_T, t[m], ark_mem->tcur - ark_mem->hold,
+                      ark_mem->tcur);
+      return (ARK_BAD_T);
+    }
+  }
+
+  /* convert the times to the normalized interpolation variable */
+  s = (sunrealtype*)malloc(nt * sizeof(sunrealtype));
+  if (s == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_MEM_FAIL);
+    return (ARK_MEM_FAIL);
+  }
+  for (m = 0; m < nt; m++) { s[m] = (t[m] - ark_mem->tcur) / ark_mem->h; }
+
+  /* call arkInterpEvaluateMulti to evaluate the results */
+  retval = arkInterpEvaluateMulti(ark_mem, ark_mem->interp, nt, s, k,
+                                  ARK_INTERP_MAX_DEGREE, dky);
+  free(s);
+  if (retval != ARK_SUCCESS)
+  {
+    arkProcessError(ark_mem, retval, __LINE__, __func__, __FILE__,
+                    "Error calling arkInterpEvaluateMulti");
+    return (retval);
+  }
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   ARKodeFree:
 
@@ -1587,6 +1733,9 @@ ARKodeMem arkCreate(SUNContext sunctx)
   ark_mem->ProcessStep = NULL;
   ark_mem->ps_data     = NULL;
 
+  /* No per-step statistics stream yet */
+  ark_mem->stepstats = NULL;
+
   /* No user-supplied stage postprocessing function yet */
   ark_mem->ProcessStage = NULL;
 
@@ -1809,6 +1958,12 @@ int arkInit(ARKodeMem ark_mem, sunrealtype t0, N_Vector y0, int init_type)
     ark_mem->netf         = 0;
     ark_mem->nconstrfails = 0;
 
+    /* Counts in the statistics stream restart from zero */
+    if (ark_mem->stepstats != NULL)
+    {
+      (void)SUNStepStats_SetBaseline(ark_mem->stepstats, 0, 0, 0, 0);
+    }
+
     /* Initial, old, and next step sizes */
     ark_mem->h0u    = ZERO;
     ark_mem->hold   = ZERO;
@@ -2763,9 +2918,45 @@ int arkCompleteStep(ARKodeMem ark_mem, sunrealtype dsm)
   ark_mem->initsetup  = SUNFALSE;
   ark_mem->firststage = SUNFALSE;
 
+  /* Append this step to the statistics stream */
+  if (ark_mem->stepstats != NULL)
+  {
+    long int nni, nli, nsetups;
+    arkGetStepStatsCounters(ark_mem, &nni, &nli, &nsetups);
+    (void)SUNStepStats_Record(ark_mem->stepstats, ark_mem->tn, ark_mem->hold,
+                              ark_mem->hadapt_mem->q, ark_mem->netf, nni, nli,
+                              nsetups);
+  }
+
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  arkGetStepStatsCounters
+
+  This routine collects the cumulative solver counters recorded
+  by the per-step statistics stream. Counters that the time
+  stepper or linear solver interface do not provide are zero.
+  ---------------------------------------------------------------*/
+void arkGetStepStatsCounters(ARKodeMem ark_mem, long int* nni, long int* nli,
+                             long int* nsetups)
+{
+  *nni = *nli = *nsetups = 0;
+  if (ark_mem->step_getnumnonlinsolviters)
+  {
+    (void)ark_mem->step_getnumnonlinsolviters(ark_mem, nni);
+  }
+  if (ark_mem->step_getnumlinsolvsetups)
+  {
+    (void)ark_mem->step_getnumlinsolvsetups(ark_mem, nsetups);
+  }
+  if (ark_mem->step_supports_implicit && ark_mem->step_getlinmem &&
+      ark_mem->step_getlinmem(ark_mem) != NULL)
+  {
+    (void)ARKodeGetNumLinIters(ark_mem, nli);
+  }
+}
+
 /*---------------------------------------------------------------
   arkHandleFailure
 
@@ -2915,6 +3106,23 @@ int arkHandleFailure(ARKodeMem ark_mem, int flag)
   return (flag);
 }
 
+/*---------------------------------------------------------------
+  arkWtMin
+
+  This routine returns the minimum of the tolerance vector in
+  tempv1 for the positivity tests of the ewt and rwt functions.
+  If the test is part of a batch of reductions, the global
+  minimum is stored in min when the batch is finalized and the
+  task-local minimum is returned, so that tempv1 is never
+  inverted where it has non-positive components.
+  ---------------------------------------------------------------*/
+sunrealtype arkWtMin(ARKodeMem ark_mem, sunrealtype* min)
+{
+  if (ark_mem->wt_batch == NULL) { return (N_VMin(ark_mem->tempv1)); }
+
+  return (sunReduceBatch_Min(ark_mem->wt_batch, ark_mem->tempv1, min));
+}
+
 /*---------------------------------------------------------------
   arkEwtSetSS
 
@@ -2936,7 +3144,7 @@ int arkEwtSetSS(N_Vector ycur, N_Vector weight, void* arkode_mem)
   N_VAddConst(ark_mem->tempv1, ark_mem->Sabstol, ark_mem->tempv1);
   if (ark_mem->atolmin0)
   {
-    if (N_VMin(ark_mem->tempv1) <= ZERO) { return (-1); }
+    if (arkWtMin(ark_mem, &ark_mem->ewt_min) <= ZERO) { return (-1); }
   }
   N_VInv(ark_mem->tempv1, weight);
   return (0);
@@ -2963,7 +3171,7 @@ int arkEwtSetSV(N_Vector ycur, N_Vector weight, void* arkode_mem)
                ark_mem->tempv1);
   if (ark_mem->atolmin0)
   {
-    if (N_VMin(ark_mem->tempv1) <= ZERO) { return (-1); }
+    if (arkWtMin(ark_mem, &ark_mem->ewt_min) <= ZERO) { return (-1); }
   }
   N_VInv(ark_mem->tempv1, weight);
   return (0);
@@ -3004,7 +3212,7 @@ int arkRwtSetSS(ARKodeMem ark_mem, N_Vector My, N_Vector weight)
   N_VAddConst(ark_mem->tempv1, ark_mem->SRabstol, ark_mem->tempv1);
   if (ark_mem->Ratolmin0)
   {
-    if (N_VMin(ark_mem->tempv1) <= ZERO) { return (-1); }
+    if (arkWtMin(ark_mem, &ark_mem->rwt_min) <= ZERO) { return (-1); }
   }
   N_VInv(ark_mem->tempv1, weight);
   return (0);
@@ -3026,7 +3234,7 @@ int arkRwtSetSV(ARKodeMem ark_mem, N_Vector My, N_Vector weight)
                ark_mem->tempv1);
   if (ark_mem->Ratolmin0)
   {
-    if (N_VMin(ark_mem->tempv1) <= ZERO) { return (-1); }
+    if (arkWtMin(ark_mem, &ark_mem->rwt_min) <= ZERO) { return (-1); }
   }
   N_VInv(ark_mem->tempv1, weight);
   return (0);
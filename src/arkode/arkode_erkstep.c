@@ -1489,12 +1489,10 @@ int erkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsmPtr)
                            step_mem->stage_coefs, step_mem->stages, &nvec);
     }
 
-    /* call fused vector operation to do the work */
-    retval = N_VLinearCombination(nvec, cvals, Xvecs, yerr);
+    /* call fused vector operation to do the work and fill error norm */
+    retval = N_VLinearCombinationWrmsNorm(nvec, cvals, Xvecs, yerr,
+                                          ark_mem->ewt, dsmPtr);
     if (retval != 0) { return (ARK_VECTOROP_ERR); }
-
-    /* fill error norm */
-    *dsmPtr = N_VWrmsNorm(yerr, ark_mem->ewt);
   }
 
   return (ARK_SUCCESS);
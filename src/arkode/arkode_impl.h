@@ -40,6 +40,7 @@
 #include "arkode_types_impl.h"
 #include "sundials_logger_impl.h"
 #include "sundials_macros.h"
+#include "sundials_reducebatch.h"
 #include "sundials_stepper_impl.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
@@ -322,6 +323,8 @@ struct _generic_ARKInterpOps
   int (*update)(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tnew);
   int (*evaluate)(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tau, int d,
                   int order, N_Vector yout);
+  int (*evaluatemulti)(ARKodeMem ark_mem, ARKInterp interp, int ntau,
+                       sunrealtype* tau, int d, int order, N_Vector* yout);
 };
 
 /* An interpolation module consists of an implementation-dependent 'content'
@@ -343,6 +346,8 @@ int arkInterpInit(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tnew);
 int arkInterpUpdate(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tnew);
 int arkInterpEvaluate(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tau,
                       int d, int order, N_Vector yout);
+int arkInterpEvaluateMulti(ARKodeMem ark_mem, ARKInterp interp, int ntau,
+                           sunrealtype* tau, int d, int order, N_Vector* yout);
 
 /*===============================================================
   ARKODE data structures
@@ -402,6 +407,10 @@ struct ARKodeMemRec
   sunbooleantype user_rfun;      /* SUNTRUE if user sets rfun             */
   ARKRwtFn rfun;                 /* function to set rwt                   */
   void* r_data;                  /* user pointer passed to rfun           */
+  sunReduceBatch* wt_batch;      /* if not NULL, the positivity tests of
+                                    ewt and rwt are added to this batch   */
+  sunrealtype ewt_min;           /* min of the tolerance vector for ewt   */
+  sunrealtype rwt_min;           /* min of the tolerance vector for rwt   */
   sunbooleantype constraintsSet; /* check inequality constraints          */
 
   /* Time stepper module -- general */
@@ -566,6 +575,9 @@ struct ARKodeMemRec
   ARKPostProcessFn ProcessStep;
   void* ps_data; /* pointer to user_data */
 
+  /* Per-step statistics stream (not owned) */
+  SUNStepStats stepstats;
+
   /* User-supplied stage solution post-processing function */
   ARKPostProcessFn ProcessStage;
 
@@ -649,7 +661,10 @@ int arkYddNorm(ARKodeMem ark_mem, sunrealtype hg, sunrealtype* yddnrm);
 
 int arkCompleteStep(ARKodeMem ark_mem, sunrealtype dsm);
 int arkHandleFailure(ARKodeMem ark_mem, int flag);
+void arkGetStepStatsCounters(ARKodeMem ark_mem, long int* nni, long int* nli,
+                             long int* nsetups);
 
+sunrealtype arkWtMin(ARKodeMem ark_mem, sunrealtype* min);
 int arkEwtSetSS(N_Vector ycur, N_Vector weight, void* arkode_mem);
 int arkEwtSetSV(N_Vector ycur, N_Vector weight, void* arkode_mem);
 int arkEwtSetSmallReal(N_Vector ycur, N_Vector weight, void* arkode_mem);
@@ -80,6 +80,24 @@ int arkInterpEvaluate(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tau,
   return ((int)interp->ops->evaluate(ark_mem, interp, tau, d, order, yout));
 }
 
+int arkInterpEvaluateMulti(ARKodeMem ark_mem, ARKInterp interp, int ntau,
+                           sunrealtype* tau, int d, int order, N_Vector* yout)
+{
+  int m, retval;
+  if (interp == NULL) { return (ARK_SUCCESS); }
+  if (interp->ops->evaluatemulti)
+  {
+    return ((int)interp->ops->evaluatemulti(ark_mem, interp, ntau, tau, d,
+                                            order, yout));
+  }
+  for (m = 0; m < ntau; m++)
+  {
+    retval = interp->ops->evaluate(ark_mem, interp, tau[m], d, order, yout[m]);
+    if (retval != ARK_SUCCESS) { return (retval); }
+  }
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   Section II: Hermite interpolation module implementation
   ---------------------------------------------------------------*/
@@ -113,13 +131,14 @@ ARKInterp arkInterpCreate_Hermite(ARKodeMem ark_mem, int degree)
     free(interp);
     return (NULL);
   }
-  ops->resize    = arkInterpResize_Hermite;
-  ops->free      = arkInterpFree_Hermite;
-  ops->print     = arkInterpPrintMem_Hermite;
-  ops->setdegree = arkInterpSetDegree_Hermite;
-  ops->init      = arkInterpInit_Hermite;
-  ops->update    = arkInterpUpdate_Hermite;
-  ops->evaluate  = arkInterpEvaluate_Hermite;
+  ops->resize        = arkInterpResize_Hermite;
+  ops->free          = arkInterpFree_Hermite;
+  ops->print         = arkInterpPrintMem_Hermite;
+  ops->setdegree     = arkInterpSetDegree_Hermite;
+  ops->init          = arkInterpInit_Hermite;
+  ops->update        = arkInterpUpdate_Hermite;
+  ops->evaluate      = arkInterpEvaluate_Hermite;
+  ops->evaluatemulti = arkInterpEvaluateMulti_Hermite;
 
   /* create content, and initialize everything to zero/NULL */
   content = NULL;
@@ -439,24 +458,10 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
                               sunrealtype tau, int d, int order, N_Vector yout)
 {
   /* local variables */
-  int q, retval;
-  sunrealtype tval, a0, a1, tau2, tau3, tau4, tau5;
-  sunrealtype h, h2, h3, h4, h5;
+  int q, nvec, retval;
   sunrealtype a[6];
   N_Vector X[6];
 
-  /* set constants */
-  tau2 = tau * tau;
-  tau3 = tau * tau2;
-  tau4 = tau * tau3;
-  tau5 = tau * tau4;
-
-  h  = HINT_H(interp);
-  h2 = h * h;
-  h3 = h * h2;
-  h4 = h * h3;
-  h5 = h * h4;
-
   /* determine polynomial order q */
   q = SUNMAX(order, 0);               /* respect lower bound  */
   q = SUNMIN(q, HINT_DEGREE(interp)); /* respect max possible */
@@ -464,6 +469,105 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
   SUNLogDebug(ARK_LOGGER, "interp-eval",
               "tau = " SUN_FORMAT_G ", d = %i, q = %i", tau, d, q);
 
+  /* prepare the interpolation data, using yout as temporary storage */
+  retval = arkInterpPrepare_Hermite(ark_mem, interp, d, q, yout);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* if d is too high, just return zeros */
+  if (d > q)
+  {
+    N_VConst(ZERO, yout);
+    return (ARK_SUCCESS);
+  }
+
+  /* evaluate the polynomial as a linear combination of the data */
+  nvec = arkInterpVecs_Hermite(ark_mem, interp, q, X);
+  arkInterpCoeffs_Hermite(interp, tau, d, q, a);
+  if (nvec == 2) { N_VLinearSum(a[0], X[0], a[1], X[1], yout); }
+  else
+  {
+    retval = N_VLinearCombination(nvec, a, X, yout);
+    if (retval != 0) { return (ARK_VECTOROP_ERR); }
+  }
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  arkInterpEvaluateMulti_Hermite
+
+  This routine evaluates the Hermite polynomial of
+  arkInterpEvaluate_Hermite at the ntau values tau[m], storing
+  the results in yout[m].  The data needed for degrees 4 and 5
+  is computed once for all values, and the results are formed
+  together by N_VLinearCombinationMulti, so the interpolation
+  data is read once rather than once per value.
+  ---------------------------------------------------------------*/
+int arkInterpEvaluateMulti_Hermite(ARKodeMem ark_mem, ARKInterp interp,
+                                   int ntau, sunrealtype* tau, int d, int order,
+                                   N_Vector* yout)
+{
+  /* local variables */
+  int q, m, nvec, retval;
+  sunrealtype* a;
+  N_Vector X[6];
+
+  /* determine polynomial order q */
+  q = SUNMAX(order, 0);               /* respect lower bound  */
+  q = SUNMIN(q, HINT_DEGREE(interp)); /* respect max possible */
+
+  SUNLogDebug(ARK_LOGGER, "interp-eval-multi", "ntau = %i, d = %i, q = %i",
+              ntau, d, q);
+
+  /* prepare the interpolation data, using yout[0] as temporary storage */
+  retval = arkInterpPrepare_Hermite(ark_mem, interp, d, q, yout[0]);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* if d is too high, just return zeros */
+  if (d > q)
+  {
+    retval = N_VConstVectorArray(ntau, ZERO, yout);
+    if (retval != 0) { return (ARK_VECTOROP_ERR); }
+    return (ARK_SUCCESS);
+  }
+
+  /* form the coefficients for all values of tau */
+  nvec = arkInterpVecs_Hermite(ark_mem, interp, q, X);
+  a    = (sunrealtype*)malloc(ntau * nvec * sizeof(sunrealtype));
+  if (a == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_MEM_FAIL);
+    return (ARK_MEM_FAIL);
+  }
+  for (m = 0; m < ntau; m++)
+  {
+    arkInterpCoeffs_Hermite(interp, tau[m], d, q, a + m * nvec);
+  }
+
+  /* evaluate the polynomial at all values of tau */
+  retval = N_VLinearCombinationMulti(nvec, ntau, a, X, yout);
+  free(a);
+  if (retval != 0) { return (ARK_VECTOROP_ERR); }
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  arkInterpPrepare_Hermite
+
+  This routine updates fn if needed, checks the requested
+  derivative, and for degrees 4 and 5 evaluates the additional
+  RHS data fa and fb used by the polynomial.  The vector ytmp is
+  used as temporary storage.
+  ---------------------------------------------------------------*/
+int arkInterpPrepare_Hermite(ARKodeMem ark_mem, ARKInterp interp, int d, int q,
+                             N_Vector ytmp)
+{
+  /* local variables */
+  int retval;
+  sunrealtype tval, h;
+
   /* call full RHS if needed -- called just AFTER the end of a step, so yn has
      been updated to ycur */
   if (!(ark_mem->fn_is_current))
@@ -482,32 +586,136 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
     return (ARK_ILL_INPUT);
   }
 
-  /* if d is too high, just return zeros */
-  if (d > q)
+  /* error on illegal polynomial order */
+  if (q > 5)
   {
-    N_VConst(ZERO, yout);
-    return (ARK_SUCCESS);
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Illegal polynomial order");
+    return (ARK_ILL_INPUT);
+  }
+
+  /* nothing else is needed when zeros are returned */
+  if (d > q) { return (ARK_SUCCESS); }
+
+  h = HINT_H(interp);
+
+  if (q == 4)
+  {
+    /* first, evaluate cubic interpolant at tau=-1/3 */
+    tval   = -ONE / THREE;
+    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 3, ytmp);
+    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+
+    /* second, evaluate RHS at tau=-1/3, storing the result in fa */
+    tval   = HINT_TNEW(interp) - h / THREE;
+    retval = ark_mem->step_fullrhs(ark_mem, tval, ytmp, HINT_FA(interp),
+                                   ARK_FULLRHS_OTHER);
+    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+  }
+  else if (q == 5)
+  {
+    /* first, evaluate quartic interpolant at tau=-1/3 */
+    tval   = -ONE / THREE;
+    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 4, ytmp);
+    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+
+    /* second, evaluate RHS at tau=-1/3, storing the result in fa */
+    tval   = HINT_TNEW(interp) - h / THREE;
+    retval = ark_mem->step_fullrhs(ark_mem, tval, ytmp, HINT_FA(interp),
+                                   ARK_FULLRHS_OTHER);
+    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+
+    /* third, evaluate quartic interpolant at tau=-2/3 */
+    tval   = -TWO / THREE;
+    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 4, ytmp);
+    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+
+    /* fourth, evaluate RHS at tau=-2/3, storing the result in fb */
+    tval   = HINT_TNEW(interp) - h * TWO / THREE;
+    retval = ark_mem->step_fullrhs(ark_mem, tval, ytmp, HINT_FB(interp),
+                                   ARK_FULLRHS_OTHER);
+    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+  }
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  arkInterpVecs_Hermite
+
+  This routine sets the vectors combined by the Hermite
+  polynomial of degree q and returns their number:
+     {yold,ynew} for constant and linear
+     {yold,ynew,fnew} for quadratic
+     {yold,ynew,fold,fnew} for cubic
+     {yold,ynew,fold,fnew,fa} for quartic
+     {yold,ynew,fold,fnew,fa,fb} for quintic
+  ---------------------------------------------------------------*/
+int arkInterpVecs_Hermite(ARKodeMem ark_mem, ARKInterp interp, int q,
+                          N_Vector* X)
+{
+  X[0] = HINT_YOLD(interp);
+  X[1] = ark_mem->yn;
+  if (q < 2) { return (2); }
+  if (q == 2)
+  {
+    X[2] = ark_mem->fn;
+    return (3);
   }
+  X[2] = HINT_FOLD(interp);
+  X[3] = ark_mem->fn;
+  if (q == 3) { return (4); }
+  X[4] = HINT_FA(interp);
+  if (q == 4) { return (5); }
+  X[5] = HINT_FB(interp);
+  return (6);
+}
+
+/*---------------------------------------------------------------
+  arkInterpCoeffs_Hermite
+
+  This routine computes the coefficients of the vectors set by
+  arkInterpVecs_Hermite for the d-th derivative of the Hermite
+  polynomial of degree q at tau, where 0 <= d <= q <= 5.
+  ---------------------------------------------------------------*/
+void arkInterpCoeffs_Hermite(ARKInterp interp, sunrealtype tau, int d, int q,
+                             sunrealtype* a)
+{
+  /* local variables */
+  sunrealtype tau2, tau3, tau4, tau5;
+  sunrealtype h, h2, h3, h4, h5;
+
+  /* set constants */
+  tau2 = tau * tau;
+  tau3 = tau * tau2;
+  tau4 = tau * tau3;
+  tau5 = tau * tau4;
+
+  h  = HINT_H(interp);
+  h2 = h * h;
+  h3 = h * h2;
+  h4 = h * h3;
+  h5 = h * h4;
 
   /* build polynomial based on order */
   switch (q)
   {
   case (0): /* constant interpolant, yout = 0.5*(yn+yp) */
-    N_VLinearSum(HALF, HINT_YOLD(interp), HALF, ark_mem->yn, yout);
+    a[0] = HALF;
+    a[1] = HALF;
     break;
 
   case (1): /* linear interpolant */
     if (d == 0)
     {
-      a0 = -tau;
-      a1 = ONE + tau;
+      a[0] = -tau;
+      a[1] = ONE + tau;
     }
     else
     { /* d=1 */
-      a0 = -ONE / h;
-      a1 = ONE / h;
+      a[0] = -ONE / h;
+      a[1] = ONE / h;
     }
-    N_VLinearSum(a0, HINT_YOLD(interp), a1, ark_mem->yn, yout);
     break;
 
   case (2): /* quadratic interpolant */
@@ -529,11 +737,6 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
       a[1] = -TWO / h / h;
       a[2] = TWO / h;
     }
-    X[0]   = HINT_YOLD(interp);
-    X[1]   = ark_mem->yn;
-    X[2]   = ark_mem->fn;
-    retval = N_VLinearCombination(3, a, X, yout);
-    if (retval != 0) { return (ARK_VECTOROP_ERR); }
     break;
 
   case (3): /* cubic interpolant */
@@ -565,28 +768,9 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
       a[2] = SIX / h2;
       a[3] = SIX / h2;
     }
-    X[0]   = HINT_YOLD(interp);
-    X[1]   = ark_mem->yn;
-    X[2]   = HINT_FOLD(interp);
-    X[3]   = ark_mem->fn;
-    retval = N_VLinearCombination(4, a, X, yout);
-    if (retval != 0) { return (ARK_VECTOROP_ERR); }
     break;
 
   case (4): /* quartic interpolant */
-
-    /* first, evaluate cubic interpolant at tau=-1/3 */
-    tval   = -ONE / THREE;
-    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 3, yout);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* second, evaluate RHS at tau=-1/3, storing the result in fa */
-    tval   = HINT_TNEW(interp) - h / THREE;
-    retval = ark_mem->step_fullrhs(ark_mem, tval, yout, HINT_FA(interp),
-                                   ARK_FULLRHS_OTHER);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* evaluate desired function */
     if (d == 0)
     {
       a[0] = -SIX * tau2 - SUN_RCONST(16.0) * tau3 - SUN_RCONST(9.0) * tau4;
@@ -634,40 +818,9 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
       a[3] = ZERO;
       a[4] = -SUN_RCONST(162.0) / h3;
     }
-    X[0]   = HINT_YOLD(interp);
-    X[1]   = ark_mem->yn;
-    X[2]   = HINT_FOLD(interp);
-    X[3]   = ark_mem->fn;
-    X[4]   = HINT_FA(interp);
-    retval = N_VLinearCombination(5, a, X, yout);
-    if (retval != 0) { return (ARK_VECTOROP_ERR); }
     break;
 
-  case (5): /* quintic interpolant */
-
-    /* first, evaluate quartic interpolant at tau=-1/3 */
-    tval   = -ONE / THREE;
-    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 4, yout);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* second, evaluate RHS at tau=-1/3, storing the result in fa */
-    tval   = HINT_TNEW(interp) - h / THREE;
-    retval = ark_mem->step_fullrhs(ark_mem, tval, yout, HINT_FA(interp),
-                                   ARK_FULLRHS_OTHER);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* third, evaluate quartic interpolant at tau=-2/3 */
-    tval   = -TWO / THREE;
-    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 4, yout);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* fourth, evaluate RHS at tau=-2/3, storing the result in fb */
-    tval   = HINT_TNEW(interp) - h * TWO / THREE;
-    retval = ark_mem->step_fullrhs(ark_mem, tval, yout, HINT_FB(interp),
-                                   ARK_FULLRHS_OTHER);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* evaluate desired function */
+  default: /* quintic interpolant */
     if (d == 0)
     {
       a[0] = SUN_RCONST(54.0) * tau5 + SUN_RCONST(135.0) * tau4 +
@@ -761,23 +914,8 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
       a[4] = SUN_RCONST(2430.0) / h4;
       a[5] = a[4];
     }
-    X[0]   = HINT_YOLD(interp);
-    X[1]   = ark_mem->yn;
-    X[2]   = HINT_FOLD(interp);
-    X[3]   = ark_mem->fn;
-    X[4]   = HINT_FA(interp);
-    X[5]   = HINT_FB(interp);
-    retval = N_VLinearCombination(6, a, X, yout);
-    if (retval != 0) { return (ARK_VECTOROP_ERR); }
     break;
-
-  default:
-    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
-                    "Illegal polynomial order");
-    return (ARK_ILL_INPUT);
   }
-
-  return (ARK_SUCCESS);
 }
 
 /*---------------------------------------------------------------
@@ -813,13 +951,14 @@ ARKInterp arkInterpCreate_Lagrange(ARKodeMem ark_mem, int degree)
     free(interp);
     return (NULL);
   }
-  ops->resize    = arkInterpResize_Lagrange;
-  ops->free      = arkInterpFree_Lagrange;
-  ops->print     = arkInterpPrintMem_Lagrange;
-  ops->setdegree = arkInterpSetDegree_Lagrange;
-  ops->init      = arkInterpInit_Lagrange;
-  ops->update    = arkInterpUpdate_Lagrange;
-  ops->evaluate  = arkInterpEvaluate_Lagrange;
+  ops->resize        = arkInterpResize_Lagrange;
+  ops->free          = arkInterpFree_Lagrange;
+  ops->print         = arkInterpPrintMem_Lagrange;
+  ops->setdegree     = arkInterpSetDegree_Lagrange;
+  ops->init          = arkInterpInit_Lagrange;
+  ops->update        = arkInterpUpdate_Lagrange;
+  ops->evaluate      = arkInterpEvaluate_Lagrange;
+  ops->evaluatemulti = arkInterpEvaluateMulti_Lagrange;
 
   /* create content, and initialize everything to zero/NULL */
   content = NULL;
@@ -1184,17 +1323,13 @@ int arkInterpEvaluate_Lagrange(ARKodeMem ark_mem, ARKInterp I, sunrealtype tau,
                                int deriv, int degree, N_Vector yout)
 {
   /* local variables */
-  int q, retval, i, j;
-  sunrealtype tval;
+  int q, retval;
   sunrealtype a[6];
-  N_Vector X[6];
   int nhist;
-  sunrealtype* thist;
   N_Vector* yhist;
 
   /* set readability shortcuts */
   nhist = LINT_NHIST(I);
-  thist = LINT_THIST(I);
   yhist = LINT_YHIST(I);
 
   /* determine polynomial degree q */
@@ -1226,35 +1361,109 @@ int arkInterpEvaluate_Lagrange(ARKodeMem ark_mem, ARKInterp I, sunrealtype tau,
     return (ARK_SUCCESS);
   }
 
-  /* convert from tau back to t (both tnew and told are valid since q>0 => NHIST>1) */
-  tval = thist[0] + tau * (thist[0] - thist[1]);
+  /* construct linear combination coefficients based on derivative requested */
+  arkInterpCoeffs_Lagrange(I, tau, deriv, q, a);
 
   /* linear interpolant */
   if (q == 1)
   {
-    if (deriv == 0)
-    {
-      a[0] = LBasis(I, 0, tval);
-      a[1] = LBasis(I, 1, tval);
-    }
-    else
-    { /* deriv == 1 */
-      a[0] = LBasisD(I, 0, tval);
-      a[1] = LBasisD(I, 1, tval);
-    }
     N_VLinearSum(a[0], yhist[0], a[1], yhist[1], yout);
     return (ARK_SUCCESS);
   }
 
-  /* higher-degree interpolant */
-  /*    initialize arguments for N_VLinearCombination */
-  for (i = 0; i < q + 1; i++)
+  /* higher-degree interpolant, call N_VLinearCombination to evaluate the
+     result, and return */
+  retval = N_VLinearCombination(q + 1, a, yhist, yout);
+  if (retval != 0) { return (ARK_VECTOROP_ERR); }
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  arkInterpEvaluateMulti_Lagrange
+
+  This routine evaluates the Lagrange polynomial of
+  arkInterpEvaluate_Lagrange at the ntau values tau[m], storing
+  the results in yout[m].  The results are formed together by
+  N_VLinearCombinationMulti, so the solution history is read
+  once rather than once per value.
+  ---------------------------------------------------------------*/
+int arkInterpEvaluateMulti_Lagrange(ARKodeMem ark_mem, ARKInterp I, int ntau,
+                                    sunrealtype* tau, int deriv, int degree,
+                                    N_Vector* yout)
+{
+  /* local variables */
+  int q, m, retval;
+  sunrealtype* a;
+
+  /* determine polynomial degree q */
+  q = SUNMAX(degree, 0);            /* respect lower bound */
+  q = SUNMIN(q, LINT_NHIST(I) - 1); /* respect max possible */
+
+  SUNLogDebug(ARK_LOGGER, "interp-eval-multi", "ntau = %i, d = %i, q = %i",
+              ntau, deriv, q);
+
+  /* error on illegal deriv */
+  if ((deriv < 0) || (deriv > 3))
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Requested illegal derivative.");
+    return (ARK_ILL_INPUT);
+  }
+
+  /* if deriv is too high, just return zeros */
+  if (deriv > q)
+  {
+    retval = N_VConstVectorArray(ntau, ZERO, yout);
+    if (retval != 0) { return (ARK_VECTOROP_ERR); }
+    return (ARK_SUCCESS);
+  }
+
+  /* form the coefficients for all values of tau */
+  a = (sunrealtype*)malloc(ntau * (q + 1) * sizeof(sunrealtype));
+  if (a == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_MEM_FAIL);
+    return (ARK_MEM_FAIL);
+  }
+  for (m = 0; m < ntau; m++)
   {
-    a[i] = ZERO;
-    X[i] = yhist[i];
+    arkInterpCoeffs_Lagrange(I, tau[m], deriv, q, a + m * (q + 1));
   }
 
-  /*    construct linear combination coefficients based on derivative requested */
+  /* evaluate the polynomial at all values of tau */
+  retval = N_VLinearCombinationMulti(q + 1, ntau, a, LINT_YHIST(I), yout);
+  free(a);
+  if (retval != 0) { return (ARK_VECTOROP_ERR); }
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  arkInterpCoeffs_Lagrange
+
+  This routine computes the coefficients of the q+1 most recent
+  solutions for the deriv-th derivative of the Lagrange
+  polynomial of degree q at tau, where 0 <= deriv <= q.
+  ---------------------------------------------------------------*/
+void arkInterpCoeffs_Lagrange(ARKInterp I, sunrealtype tau, int deriv, int q,
+                              sunrealtype* a)
+{
+  /* local variables */
+  int j;
+  sunrealtype tval;
+
+  /* constant interpolant is just ynew */
+  if (q == 0)
+  {
+    a[0] = ONE;
+    return;
+  }
+
+  /* convert from tau back to t (both tnew and told are valid since q>0 => NHIST>1) */
+  tval = LINT_TJ(I, 0) + tau * (LINT_TJ(I, 0) - LINT_TJ(I, 1));
+
   switch (deriv)
   {
   case (0): /* p(t) */
@@ -1269,16 +1478,10 @@ int arkInterpEvaluate_Lagrange(ARKodeMem ark_mem, ARKInterp I, sunrealtype tau,
     for (j = 0; j < q + 1; j++) { a[j] = LBasisD2(I, j, tval); }
     break;
 
-  case (3): /* p'''(t) */
+  default: /* p'''(t) */
     for (j = 0; j < q + 1; j++) { a[j] = LBasisD3(I, j, tval); }
     break;
   }
-
-  /*    call N_VLinearCombination to evaluate the result, and return */
-  retval = N_VLinearCombination(q + 1, a, X, yout);
-  if (retval != 0) { return (ARK_VECTOROP_ERR); }
-
-  return (ARK_SUCCESS);
 }
 
 /* Lagrange utility routines (basis functions and their derivatives) */
@@ -84,6 +84,17 @@ int arkInterpUpdate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
                             sunrealtype tnew);
 int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
                               sunrealtype tau, int d, int order, N_Vector yout);
+int arkInterpEvaluateMulti_Hermite(ARKodeMem ark_mem, ARKInterp interp,
+                                   int ntau, sunrealtype* tau, int d, int order,
+                                   N_Vector* yout);
+
+/* Hermite structure utility routines */
+int arkInterpPrepare_Hermite(ARKodeMem ark_mem, ARKInterp interp, int d, int q,
+                             N_Vector ytmp);
+int arkInterpVecs_Hermite(ARKodeMem ark_mem, ARKInterp interp, int q,
+                          N_Vector* X);
+void arkInterpCoeffs_Hermite(ARKInterp interp, sunrealtype tau, int d, int q,
+                             sunrealtype* a);
 
 /*===============================================================
   ARKODE Lagrange Temporal Interpolation Data Structure
@@ -130,12 +141,17 @@ int arkInterpUpdate_Lagrange(ARKodeMem ark_mem, ARKInterp interp,
                              sunrealtype tnew);
 int arkInterpEvaluate_Lagrange(ARKodeMem ark_mem, ARKInterp interp,
                                sunrealtype tau, int d, int order, N_Vector yout);
+int arkInterpEvaluateMulti_Lagrange(ARKodeMem ark_mem, ARKInterp interp,
+                                    int ntau, sunrealtype* tau, int d,
+                                    int order, N_Vector* yout);
 
 /* Lagrange structure utility routines */
 sunrealtype LBasis(ARKInterp interp, int idx, sunrealtype t);
 sunrealtype LBasisD(ARKInterp interp, int idx, sunrealtype t);
 sunrealtype LBasisD2(ARKInterp interp, int idx, sunrealtype t);
 sunrealtype LBasisD3(ARKInterp interp, int idx, sunrealtype t);
+void arkInterpCoeffs_Lagrange(ARKInterp interp, sunrealtype tau, int deriv,
+                              int q, sunrealtype* a);
 
 #ifdef __cplusplus
 }
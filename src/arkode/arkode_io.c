@@ -1550,6 +1550,37 @@ int ARKodeSetPostprocessStageFn(void* arkode_mem, ARKPostProcessFn ProcessStage)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  ARKodeSetStepStats:
+
+  Attaches a SUNStepStats object that records the statistics of
+  every successful step. Counts are taken relative to their
+  values when the object is attached. A NULL input detaches the
+  current object.
+  ---------------------------------------------------------------*/
+int ARKodeSetStepStats(void* arkode_mem, SUNStepStats stats)
+{
+  ARKodeMem ark_mem;
+  long int nni, nli, nsetups;
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  if (stats != NULL)
+  {
+    arkGetStepStatsCounters(ark_mem, &nni, &nli, &nsetups);
+    (void)SUNStepStats_SetBaseline(stats, ark_mem->netf, nni, nli, nsetups);
+  }
+
+  ark_mem->stepstats = stats;
+
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   ARKodeSetConstraints:
 
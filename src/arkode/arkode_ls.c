@@ -19,6 +19,7 @@
 #include <string.h>
 #include <sundials/sundials_math.h>
 #include <sunmatrix/sunmatrix_band.h>
+#include <sunmatrix/sunmatrix_blockdense.h>
 #include <sunmatrix/sunmatrix_dense.h>
 #include <sunmatrix/sunmatrix_sparse.h>
 
@@ -596,6 +597,111 @@ int ARKodeSetJacFn(void* arkode_mem, ARKLsJacFn jac)
   return (ARKLS_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  ARKodeSetJacSparsity specifies the nonzero pattern used by the
+  difference quotient Jacobian with a sparse SUNMatrix. The
+  pattern is copied from S, whose values are not used, and a NULL
+  S removes it.
+  ---------------------------------------------------------------*/
+int ARKodeSetJacSparsity(void* arkode_mem, SUNMatrix S)
+{
+  ARKodeMem ark_mem;
+  ARKLsMem arkls_mem;
+  sunSparseDQ sparseDQ;
+  int retval;
+
+  /* Return immediately if arkode_mem is NULL */
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* Guard against use for time steppers that do not need an algebraic solver */
+  if (!ark_mem->step_supports_implicit)
+  {
+    arkProcessError(ark_mem, ARK_STEPPER_UNSUPPORTED, __LINE__, __func__,
+                    __FILE__, "time-stepping module does not require an algebraic solver");
+    return (ARK_STEPPER_UNSUPPORTED);
+  }
+
+  /* access ARKLsMem structure */
+  retval = arkLs_AccessLMem(ark_mem, __func__, &arkls_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  if (S == NULL)
+  {
+    sunSparseDQ_Destroy(&arkls_mem->sparseDQ);
+    return (ARKLS_SUCCESS);
+  }
+
+  if (S->ops->getid == NULL || SUNMatGetID(S) != SUNMATRIX_SPARSE)
+  {
+    arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The sparsity pattern must be a sparse SUNMatrix");
+    return (ARKLS_ILL_INPUT);
+  }
+
+  /* compute the column groups for the new pattern */
+  retval = sunSparseDQ_Create(S, &sparseDQ);
+  if (retval == SUN_ERR_MALLOC_FAIL)
+  {
+    arkProcessError(ark_mem, ARKLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (ARKLS_MEM_FAIL);
+  }
+  if (retval)
+  {
+    arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The sparsity pattern is not square or is malformed");
+    return (ARKLS_ILL_INPUT);
+  }
+
+  sunSparseDQ_Destroy(&arkls_mem->sparseDQ);
+  arkls_mem->sparseDQ = sparseDQ;
+
+  return (ARKLS_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  ARKodeSetJacSparsityDetection enables or disables detecting the
+  nonzero pattern for the sparse difference quotient Jacobian when
+  no pattern is given. The pattern is detected at initialization.
+  ---------------------------------------------------------------*/
+int ARKodeSetJacSparsityDetection(void* arkode_mem, sunbooleantype onoff)
+{
+  ARKodeMem ark_mem;
+  ARKLsMem arkls_mem;
+  int retval;
+
+  /* Return immediately if arkode_mem is NULL */
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* Guard against use for time steppers that do not need an algebraic solver */
+  if (!ark_mem->step_supports_implicit)
+  {
+    arkProcessError(ark_mem, ARK_STEPPER_UNSUPPORTED, __LINE__, __func__,
+                    __FILE__, "time-stepping module does not require an algebraic solver");
+    return (ARK_STEPPER_UNSUPPORTED);
+  }
+
+  /* access ARKLsMem structure */
+  retval = arkLs_AccessLMem(ark_mem, __func__, &arkls_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  arkls_mem->detect_sparsity = onoff;
+
+  return (ARKLS_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   ARKodeSetMassFn specifies the mass matrix function.
   ---------------------------------------------------------------*/
@@ -2558,7 +2664,7 @@ int arkLsMPSolve(void* arkode_mem, N_Vector r, N_Vector z, sunrealtype tol, int
 /*---------------------------------------------------------------
   arkLsDQJac:
 
-  This routine is a wrapper for the Dense and Band
+  This routine is a wrapper for the Dense, Band, and Sparse
   implementations of the difference quotient Jacobian
   approximation routines.
   ---------------------------------------------------------------*/
@@ -2615,6 +2721,16 @@ int arkLsDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   {
     retval = arkLsBandDQJac(t, y, fy, Jac, ark_mem, arkls_mem, fi, tmp1, tmp2);
   }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_BLOCKDENSE)
+  {
+    retval = arkLsBlockDenseDQJac(t, y, fy, Jac, ark_mem, arkls_mem, fi, tmp1,
+                                  tmp2);
+  }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_SPARSE)
+  {
+    retval = arkLsSparseDQJac(t, y, fy, Jac, ark_mem, arkls_mem, fi, tmp1,
+                              tmp2);
+  }
   else
   {
     arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
@@ -2829,6 +2945,370 @@ int arkLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   return (retval);
 }
 
+/*---------------------------------------------------------------
+  arkLsBlockDenseDQJac:
+
+  This routine generates a block-diagonal dense difference quotient
+  approximation to the Jacobian of f(t,y). It assumes that the
+  blocks of a SUNMATRIX_BLOCKDENSE matrix are interleaved, so that
+  component i of block k is y[i * nblocks + k]. As the blocks are
+  uncoupled, column j of all blocks is perturbed at once and the
+  Jacobian requires one evaluation of f per block column.
+  ---------------------------------------------------------------*/
+int arkLsBlockDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                         ARKodeMem ark_mem, ARKLsMem arkls_mem, ARKRhsFn fi,
+                         N_Vector tmp1, N_Vector tmp2)
+{
+  N_Vector ftemp, ytemp;
+  sunrealtype fnorm, minInc, inc, inc_inv, srur, conj;
+  sunrealtype *ewt_data, *fy_data, *ftemp_data, *y_data, *ytemp_data;
+  sunrealtype* cns_data;
+  sunindextype i, j, k, jk, M, nblocks;
+  int retval = 0;
+
+  /* access matrix dimensions */
+  M       = SUNBlockDenseMatrix_BlockColumns(Jac);
+  nblocks = SUNBlockDenseMatrix_NumBlocks(Jac);
+
+  /* Rename work vectors for use as temporary values of y and f */
+  ftemp = tmp1;
+  ytemp = tmp2;
+
+  /* Obtain pointers to the data for ewt, fy, ftemp, y, ytemp */
+  ewt_data   = N_VGetArrayPointer(ark_mem->ewt);
+  fy_data    = N_VGetArrayPointer(fy);
+  ftemp_data = N_VGetArrayPointer(ftemp);
+  y_data     = N_VGetArrayPointer(y);
+  ytemp_data = N_VGetArrayPointer(ytemp);
+  cns_data = (ark_mem->constraintsSet) ? N_VGetArrayPointer(ark_mem->constraints)
+                                       : NULL;
+
+  /* Load ytemp with y = predicted y vector */
+  N_VScale(ONE, y, ytemp);
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(ark_mem->uround);
+  fnorm  = N_VWrmsNorm(fy, ark_mem->rwt);
+  minInc = (fnorm != ZERO) ? (MIN_INC_MULT * SUNRabs(ark_mem->h) *
+                              ark_mem->uround * M * nblocks * fnorm)
+                           : ONE;
+
+  /* Loop over block columns */
+  for (j = 0; j < M; j++)
+  {
+    /* Increment y_j of all blocks */
+    for (k = 0; k < nblocks; k++)
+    {
+      jk  = j * nblocks + k;
+      inc = SUNMAX(srur * SUNRabs(y_data[jk]), minInc / ewt_data[jk]);
+
+      /* Adjust sign(inc) if yj has an inequality constraint. */
+      if (ark_mem->constraintsSet)
+      {
+        conj = cns_data[jk];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[jk] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[jk] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      ytemp_data[jk] += inc;
+    }
+
+    /* Evaluate f with incremented y */
+    retval = fi(t, ytemp, ftemp, ark_mem->user_data);
+    arkls_mem->nfeDQ++;
+    if (retval != 0) { break; }
+
+    /* Restore ytemp, then form and load difference quotients */
+    for (k = 0; k < nblocks; k++)
+    {
+      jk             = j * nblocks + k;
+      ytemp_data[jk] = y_data[jk];
+
+      inc = SUNMAX(srur * SUNRabs(y_data[jk]), minInc / ewt_data[jk]);
+
+      /* Adjust sign(inc) as before. */
+      if (ark_mem->constraintsSet)
+      {
+        conj = cns_data[jk];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[jk] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[jk] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      inc_inv = ONE / inc;
+      for (i = 0; i < M; i++)
+      {
+        SM_ELEMENT_BD(Jac, k, i, j) =
+          inc_inv * (ftemp_data[i * nblocks + k] - fy_data[i * nblocks + k]);
+      }
+    }
+  }
+
+  return (retval);
+}
+
+/*---------------------------------------------------------------
+  arkLsSparseDQJac:
+
+  This routine generates a sparse difference quotient
+  approximation to the Jacobian of f(t,y) with the nonzero pattern
+  given to ARKodeSetJacSparsity. The columns are split into groups
+  that do not share a row, so the columns in a group are perturbed
+  together and each group needs a single call to f. The pattern is
+  written into Jac, which may be a CSC or CSR matrix, before its
+  entries are set.
+  ---------------------------------------------------------------*/
+int arkLsSparseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                     ARKodeMem ark_mem, ARKLsMem arkls_mem, ARKRhsFn fi,
+                     N_Vector tmp1, N_Vector tmp2)
+{
+  N_Vector ftemp, ytemp;
+  sunrealtype fnorm, minInc, inc, inc_inv, srur, conj;
+  sunrealtype *J_data, *ewt_data, *fy_data, *ftemp_data, *y_data, *ytemp_data;
+  sunrealtype* cns_data;
+  sunindextype color, i, j, k, p, q, N;
+  sunSparseDQ sdq;
+  int retval = 0;
+
+  /* verify that the pattern matches the matrix */
+  sdq = arkls_mem->sparseDQ;
+  if (sdq == NULL || !sunSparseDQ_Compatible(sdq, Jac))
+  {
+    arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The sparsity pattern does not match the SUNMatrix");
+    return (ARKLS_ILL_INPUT);
+  }
+
+  /* write the pattern into Jac */
+  if (sunSparseDQ_SetPattern(sdq, Jac))
+  {
+    arkProcessError(ark_mem, ARKLS_SUNMAT_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_SUNMAT_FAILED);
+    return (ARKLS_SUNMAT_FAIL);
+  }
+
+  /* access matrix dimension and data */
+  N      = SUNSparseMatrix_Columns(Jac);
+  J_data = SUNSparseMatrix_Data(Jac);
+
+  /* Rename work vectors for use as temporary values of y and f */
+  ftemp = tmp1;
+  ytemp = tmp2;
+
+  /* Obtain pointers to the data for ewt, fy, ftemp, y, ytemp */
+  ewt_data   = N_VGetArrayPointer(ark_mem->ewt);
+  fy_data    = N_VGetArrayPointer(fy);
+  ftemp_data = N_VGetArrayPointer(ftemp);
+  y_data     = N_VGetArrayPointer(y);
+  ytemp_data = N_VGetArrayPointer(ytemp);
+  cns_data = (ark_mem->constraintsSet) ? N_VGetArrayPointer(ark_mem->constraints)
+                                       : NULL;
+
+  /* Load ytemp with y = predicted y vector */
+  N_VScale(ONE, y, ytemp);
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(ark_mem->uround);
+  fnorm  = N_VWrmsNorm(fy, ark_mem->rwt);
+  minInc = (fnorm != ZERO)
+             ? (MIN_INC_MULT * SUNRabs(ark_mem->h) * ark_mem->uround * N * fnorm)
+             : ONE;
+
+  /* Loop over column groups. */
+  for (color = 0; color < sdq->ncolors; color++)
+  {
+    /* Increment all y_j in group */
+    for (k = sdq->colorptrs[color]; k < sdq->colorptrs[color + 1]; k++)
+    {
+      j   = sdq->colorcols[k];
+      inc = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+      /* Adjust sign(inc) if yj has an inequality constraint. */
+      if (ark_mem->constraintsSet)
+      {
+        conj = cns_data[j];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[j] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      ytemp_data[j] += inc;
+    }
+
+    /* Evaluate f with incremented y */
+    retval = fi(t, ytemp, ftemp, ark_mem->user_data);
+    arkls_mem->nfeDQ++;
+    if (retval != 0) { break; }
+
+    /* Restore ytemp, then form and load difference quotients */
+    for (k = sdq->colorptrs[color]; k < sdq->colorptrs[color + 1]; k++)
+    {
+      j             = sdq->colorcols[k];
+      ytemp_data[j] = y_data[j];
+      inc           = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+      /* Adjust sign(inc) as before. */
+      if (ark_mem->constraintsSet)
+      {
+        conj = cns_data[j];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[j] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      inc_inv = ONE / inc;
+      for (p = sdq->colptrs[j]; p < sdq->colptrs[j + 1]; p++)
+      {
+        i         = sdq->rowvals[p];
+        q         = sunSparseDQ_Position(sdq, Jac, p);
+        J_data[q] = inc_inv * (ftemp_data[i] - fy_data[i]);
+      }
+    }
+  }
+
+  return (retval);
+}
+
+/*---------------------------------------------------------------
+  arkLsDetectSparsity:
+
+  This routine detects the nonzero pattern of the Jacobian of
+  fi(t,y) at the initial condition for the sparse difference
+  quotient Jacobian. Each y_j is set to NaN and then perturbed by
+  a random amount, and the rows of fi that become NaN or change
+  are taken as the nonzeros of column j. This requires 2N+1 calls
+  to fi, which are counted in nfeDQ.
+  ---------------------------------------------------------------*/
+int arkLsDetectSparsity(ARKodeMem ark_mem, ARKLsMem arkls_mem)
+{
+  N_Vector ytemp, f0, fnan, fpert;
+  sunrealtype *y_data, *ytemp_data, *f0_data, *fnan_data, *fpert_data;
+  sunrealtype t;
+  sunindextype j, N;
+  unsigned long state = 1;
+  SUNMatrix P;
+  ARKRhsFn fi;
+  int retval, nanretval, fretval;
+
+  /* Access implicit RHS function */
+  fi = ark_mem->step_getimplicitrhs((void*)ark_mem);
+  if (fi == NULL)
+  {
+    arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Time step module is missing implicit RHS fcn");
+    return (ARKLS_ILL_INPUT);
+  }
+
+  /* create the pattern matrix and work vectors */
+  N     = SUNSparseMatrix_Columns(arkls_mem->A);
+  P     = SUNSparseMatrix(N, N, SUNMAX(N, 1), CSC_MAT, ark_mem->sunctx);
+  ytemp = N_VClone(ark_mem->ewt);
+  f0    = N_VClone(ark_mem->ewt);
+  fnan  = N_VClone(ark_mem->ewt);
+  fpert = N_VClone(ark_mem->ewt);
+
+  retval = ARKLS_SUCCESS;
+  if (P == NULL || ytemp == NULL || f0 == NULL || fnan == NULL || fpert == NULL)
+  {
+    retval = ARKLS_MEM_FAIL;
+  }
+
+  /* evaluate fi at the initial condition */
+  t       = ark_mem->tcur;
+  fretval = 0;
+  if (retval == ARKLS_SUCCESS)
+  {
+    N_VScale(ONE, ark_mem->yn, ytemp);
+    fretval = fi(t, ytemp, f0, ark_mem->user_data);
+    arkls_mem->nfeDQ++;
+  }
+
+  if (retval == ARKLS_SUCCESS && fretval == 0)
+  {
+    y_data     = N_VGetArrayPointer(ark_mem->yn);
+    ytemp_data = N_VGetArrayPointer(ytemp);
+    f0_data    = N_VGetArrayPointer(f0);
+    fnan_data  = N_VGetArrayPointer(fnan);
+    fpert_data = N_VGetArrayPointer(fpert);
+
+    for (j = 0; j < N; j++)
+    {
+      /* Probe with y_j = NaN, a failure of fi only skips this probe */
+      ytemp_data[j] = NAN;
+      nanretval     = fi(t, ytemp, fnan, ark_mem->user_data);
+      arkls_mem->nfeDQ++;
+
+      /* Probe with a random perturbation of y_j */
+      ytemp_data[j] = y_data[j] + sunSparseDQ_ProbeIncrement(y_data[j], &state);
+      fretval       = fi(t, ytemp, fpert, ark_mem->user_data);
+      arkls_mem->nfeDQ++;
+      if (fretval != 0) { break; }
+
+      ytemp_data[j] = y_data[j];
+
+      /* Add the rows that became NaN or changed to column j */
+      if (sunSparseDQ_DetectColumn(P, j, f0_data,
+                                   (nanretval == 0) ? fnan_data : NULL,
+                                   fpert_data))
+      {
+        retval = ARKLS_MEM_FAIL;
+        break;
+      }
+    }
+  }
+
+  /* compute the column groups for the detected pattern */
+  if (retval == ARKLS_SUCCESS && fretval == 0)
+  {
+    sunSparseDQ_Destroy(&arkls_mem->sparseDQ);
+    if (sunSparseDQ_Create(P, &arkls_mem->sparseDQ))
+    {
+      retval = ARKLS_MEM_FAIL;
+    }
+  }
+
+  if (retval == ARKLS_MEM_FAIL)
+  {
+    arkProcessError(ark_mem, ARKLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+  }
+  else if (fretval != 0)
+  {
+    arkProcessError(ark_mem, ARKLS_JACFUNC_UNRECVR, __LINE__, __func__,
+                    __FILE__, "The implicit RHS routine failed while detecting the Jacobian sparsity pattern");
+    retval = ARKLS_JACFUNC_UNRECVR;
+  }
+
+  N_VDestroy(fpert);
+  N_VDestroy(fnan);
+  N_VDestroy(f0);
+  N_VDestroy(ytemp);
+  if (P) { SUNMatDestroy(P); }
+
+  return (retval);
+}
+
 /*---------------------------------------------------------------
   arkLsDQJtimes:
 
@@ -3012,12 +3492,18 @@ int arkLsInitialize(ARKodeMem ark_mem)
       if (arkls_mem->jacDQ)
       {
         /* Internal difference quotient Jacobian. Check that A is dense or band,
-           otherwise return an error */
+           or sparse with a matching or detected sparsity pattern, otherwise
+           return an error */
         retval = 0;
         if (arkls_mem->A->ops->getid)
         {
           if ((SUNMatGetID(arkls_mem->A) == SUNMATRIX_DENSE) ||
-              (SUNMatGetID(arkls_mem->A) == SUNMATRIX_BAND))
+              (SUNMatGetID(arkls_mem->A) == SUNMATRIX_BAND) ||
+              (SUNMatGetID(arkls_mem->A) == SUNMATRIX_BLOCKDENSE) ||
+              (arkls_mem->sparseDQ &&
+               sunSparseDQ_Compatible(arkls_mem->sparseDQ, arkls_mem->A)) ||
+              (arkls_mem->detect_sparsity &&
+               SUNMatGetID(arkls_mem->A) == SUNMATRIX_SPARSE))
           {
             arkls_mem->jac    = arkLsDQJac;
             arkls_mem->J_data = ark_mem;
@@ -3120,6 +3606,21 @@ int arkLsInitialize(ARKodeMem ark_mem)
   /* reset counters */
   arkLsInitializeCounters(arkls_mem);
 
+  /* Detect the sparsity pattern for the DQ Jacobian if it is not known */
+  if (arkls_mem->jacDQ && !arkls_mem->user_linsys &&
+      arkls_mem->detect_sparsity &&
+      SUNMatGetID(arkls_mem->A) == SUNMATRIX_SPARSE &&
+      !(arkls_mem->sparseDQ &&
+        sunSparseDQ_Compatible(arkls_mem->sparseDQ, arkls_mem->A)))
+  {
+    retval = arkLsDetectSparsity(ark_mem, arkls_mem);
+    if (retval != ARKLS_SUCCESS)
+    {
+      arkls_mem->last_flag = retval;
+      return (retval);
+    }
+  }
+
   /* Set Jacobian-vector product related fields, based on jtimesDQ */
   if (arkls_mem->jtimesDQ)
   {
@@ -3550,6 +4051,9 @@ int arkLsFree(ARKodeMem ark_mem)
     arkls_mem->savedJ = NULL;
   }
 
+  /* Free sparse DQ Jacobian memory */
+  sunSparseDQ_Destroy(&arkls_mem->sparseDQ);
+
   /* Nullify other N_Vector pointers */
   arkls_mem->ycur = NULL;
   arkls_mem->fcur = NULL;
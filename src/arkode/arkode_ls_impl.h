@@ -21,6 +21,7 @@
 #include <arkode/arkode_ls.h>
 
 #include "arkode_impl.h"
+#include "sundials_sparsedq.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -55,6 +56,10 @@ typedef struct ARKLsMemRec
   ARKLsJacFn jac;       /* Jacobian routine to be called                 */
   void* J_data;         /* user data is passed to jac                    */
   sunbooleantype jbad;  /* heuristic suggestion for pset                 */
+  sunSparseDQ sparseDQ; /* column groups for a sparse DQ Jacobian        */
+
+  /* Detect the sparsity pattern for the DQ Jacobian if it is not given */
+  sunbooleantype detect_sparsity;
 
   /* Matrix-based solver, scale solution to account for change in gamma */
   sunbooleantype scalesol;
@@ -216,6 +221,13 @@ int arkLsDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
 int arkLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
                    ARKodeMem ark_mem, ARKLsMem arkls_mem, ARKRhsFn fi,
                    N_Vector tmp1, N_Vector tmp2);
+int arkLsBlockDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                         ARKodeMem ark_mem, ARKLsMem arkls_mem, ARKRhsFn fi,
+                         N_Vector tmp1, N_Vector tmp2);
+int arkLsSparseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                     ARKodeMem ark_mem, ARKLsMem arkls_mem, ARKRhsFn fi,
+                     N_Vector tmp1, N_Vector tmp2);
+int arkLsDetectSparsity(ARKodeMem ark_mem, ARKLsMem arkls_mem);
 
 /* Generic linit/lsetup/lsolve/lfree interface routines for ARKODE to call */
 int arkLsInitialize(ARKodeMem ark_mem);
@@ -738,14 +738,14 @@ int lsrkStep_TakeStepRKC(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
     cvals[3] = p4 * ark_mem->h;
     Xvecs[3] = ark_mem->tempv2;
 
-    retval = N_VLinearCombination(4, cvals, Xvecs, ark_mem->tempv1);
+    retval = N_VLinearCombinationWrmsNorm(4, cvals, Xvecs, ark_mem->tempv1,
+                                          ark_mem->ewt, dsmPtr);
     if (retval != 0)
     {
       SUNLogInfo(ARK_LOGGER, "end-compute-embedding",
                  "status = failed vector op, retval = %i", retval);
       return ARK_VECTOROP_ERR;
     }
-    *dsmPtr = N_VWrmsNorm(ark_mem->tempv1, ark_mem->ewt);
     lsrkStep_DomEigUpdateLogic(ark_mem, step_mem, *dsmPtr);
   }
   else
@@ -1026,14 +1026,14 @@ int lsrkStep_TakeStepRKL(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
     cvals[3] = p4 * ark_mem->h;
     Xvecs[3] = ark_mem->tempv2;
 
-    retval = N_VLinearCombination(4, cvals, Xvecs, ark_mem->tempv1);
+    retval = N_VLinearCombinationWrmsNorm(4, cvals, Xvecs, ark_mem->tempv1,
+                                          ark_mem->ewt, dsmPtr);
     if (retval != 0)
     {
       SUNLogInfo(ARK_LOGGER, "end-compute-embedding",
                  "status = failed vector op, retval = %i", retval);
       return ARK_VECTOROP_ERR;
     }
-    *dsmPtr = N_VWrmsNorm(ark_mem->tempv1, ark_mem->ewt);
     lsrkStep_DomEigUpdateLogic(ark_mem, step_mem, *dsmPtr);
   }
   else
@@ -1244,8 +1244,13 @@ int lsrkStep_TakeStepSSPs2(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr
     SUNLogExtraDebugVec(ARK_LOGGER, "embedded solution", ark_mem->tempv1,
                         "y_embedded(:) =");
 
-    N_VLinearSum(ONE, ark_mem->ycur, -ONE, ark_mem->tempv1, ark_mem->tempv1);
-    *dsmPtr = N_VWrmsNorm(ark_mem->tempv1, ark_mem->ewt);
+    cvals[0] = -ONE;
+    Xvecs[0] = ark_mem->tempv1;
+    cvals[1] = ONE;
+    Xvecs[1] = ark_mem->ycur;
+    retval   = N_VLinearCombinationWrmsNorm(2, cvals, Xvecs, ark_mem->tempv1,
+                                            ark_mem->ewt, dsmPtr);
+    if (retval != 0) { return ARK_VECTOROP_ERR; }
   }
 
   return ARK_SUCCESS;
@@ -1526,8 +1531,13 @@ int lsrkStep_TakeStepSSPs3(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr
   {
     SUNLogExtraDebugVec(ARK_LOGGER, "embedded solution", ark_mem->tempv1,
                         "y_embedded(:) =");
-    N_VLinearSum(ONE, ark_mem->ycur, -ONE, ark_mem->tempv1, ark_mem->tempv1);
-    *dsmPtr = N_VWrmsNorm(ark_mem->tempv1, ark_mem->ewt);
+    cvals[0] = -ONE;
+    Xvecs[0] = ark_mem->tempv1;
+    cvals[1] = ONE;
+    Xvecs[1] = ark_mem->ycur;
+    retval   = N_VLinearCombinationWrmsNorm(2, cvals, Xvecs, ark_mem->tempv1,
+                                            ark_mem->ewt, dsmPtr);
+    if (retval != 0) { return ARK_VECTOROP_ERR; }
   }
 
   SUNLogInfo(ARK_LOGGER, "end-compute-embedding", "status = success");
@@ -1738,8 +1748,13 @@ int lsrkStep_TakeStepSSP43(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr
     SUNLogExtraDebugVec(ARK_LOGGER, "embedded solution", ark_mem->tempv1,
                         "y_embedded(:) =");
 
-    N_VLinearSum(ONE, ark_mem->ycur, -ONE, ark_mem->tempv1, ark_mem->tempv1);
-    *dsmPtr = N_VWrmsNorm(ark_mem->tempv1, ark_mem->ewt);
+    cvals[0] = -ONE;
+    Xvecs[0] = ark_mem->tempv1;
+    cvals[1] = ONE;
+    Xvecs[1] = ark_mem->ycur;
+    retval   = N_VLinearCombinationWrmsNorm(2, cvals, Xvecs, ark_mem->tempv1,
+                                            ark_mem->ewt, dsmPtr);
+    if (retval != 0) { return ARK_VECTOROP_ERR; }
   }
 
   return ARK_SUCCESS;
@@ -1967,8 +1982,13 @@ int lsrkStep_TakeStepSSP104(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPt
   {
     SUNLogExtraDebugVec(ARK_LOGGER, "embedded solution", ark_mem->tempv1,
                         "y_embedded(:) =");
-    N_VLinearSum(ONE, ark_mem->ycur, -ONE, ark_mem->tempv1, ark_mem->tempv1);
-    *dsmPtr = N_VWrmsNorm(ark_mem->tempv1, ark_mem->ewt);
+    cvals[0] = -ONE;
+    Xvecs[0] = ark_mem->tempv1;
+    cvals[1] = ONE;
+    Xvecs[1] = ark_mem->ycur;
+    retval   = N_VLinearCombinationWrmsNorm(2, cvals, Xvecs, ark_mem->tempv1,
+                                            ark_mem->ewt, dsmPtr);
+    if (retval != 0) { return ARK_VECTOROP_ERR; }
   }
 
   return ARK_SUCCESS;
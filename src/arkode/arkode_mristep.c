@@ -2229,8 +2229,14 @@ int mriStep_TakeStepMRIGARK(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPt
        solution and embedding, store in ark_mem->tempv1, and take norm. */
     if (do_embedding)
     {
-      N_VLinearSum(ONE, ark_mem->tempv4, -ONE, ark_mem->ycur, ark_mem->tempv1);
-      *dsmPtr = N_VWrmsNorm(ark_mem->tempv1, ark_mem->ewt);
+      step_mem->cvals[0] = ONE;
+      step_mem->Xvecs[0] = ark_mem->tempv4;
+      step_mem->cvals[1] = -ONE;
+      step_mem->Xvecs[1] = ark_mem->ycur;
+      retval = N_VLinearCombinationWrmsNorm(2, step_mem->cvals, step_mem->Xvecs,
+                                            ark_mem->tempv1, ark_mem->ewt,
+                                            dsmPtr);
+      if (retval != 0) { return (ARK_VECTOROP_ERR); }
     }
 
     SUNLogInfo(ARK_LOGGER, "end-stage", "status = success");
@@ -2694,8 +2700,14 @@ int mriStep_TakeStepMRISR(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
      copy solution back to ycur */
   if (!ark_mem->fixedstep || (ark_mem->AccumErrorType != ARK_ACCUMERROR_NONE))
   {
-    N_VLinearSum(ONE, ytilde, -ONE, ark_mem->ycur, ark_mem->tempv1);
-    *dsmPtr = N_VWrmsNorm(ark_mem->tempv1, ark_mem->ewt);
+    step_mem->cvals[0] = ONE;
+    step_mem->Xvecs[0] = ytilde;
+    step_mem->cvals[1] = -ONE;
+    step_mem->Xvecs[1] = ark_mem->ycur;
+    retval = N_VLinearCombinationWrmsNorm(2, step_mem->cvals, step_mem->Xvecs,
+                                          ark_mem->tempv1, ark_mem->ewt,
+                                          dsmPtr);
+    if (retval != 0) { return (ARK_VECTOROP_ERR); }
     N_VScale(ONE, ytilde, ark_mem->ycur);
   }
 
@@ -3033,8 +3045,14 @@ int mriStep_TakeStepMERK(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
      step solution and embedding, store in ark_mem->tempv1, and store norm in dsmPtr */
   if (!ark_mem->fixedstep || (ark_mem->AccumErrorType != ARK_ACCUMERROR_NONE))
   {
-    N_VLinearSum(ONE, ytilde, -ONE, ark_mem->ycur, ark_mem->tempv1);
-    *dsmPtr = N_VWrmsNorm(ark_mem->tempv1, ark_mem->ewt);
+    step_mem->cvals[0] = ONE;
+    step_mem->Xvecs[0] = ytilde;
+    step_mem->cvals[1] = -ONE;
+    step_mem->Xvecs[1] = ark_mem->ycur;
+    retval = N_VLinearCombinationWrmsNorm(2, step_mem->cvals, step_mem->Xvecs,
+                                          ark_mem->tempv1, ark_mem->ewt,
+                                          dsmPtr);
+    if (retval != 0) { return (ARK_VECTOROP_ERR); }
   }
 
   return (ARK_SUCCESS);
@@ -0,0 +1,272 @@
+/*---------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ *---------------------------------------------------------------
+ * This is the implementation file for saving and loading the
+ * ARKODE integrator state for restarting a run.
+ *--------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <sundials/sundials_types.h>
+
+#include "arkode_impl.h"
+#include "sundials_statebuffer.h"
+
+#define ITEM(sb, x) sunStateBuffer_Item(sb, &(x), sizeof(x))
+
+/*---------------------------------------------------------------
+  arkStateItems:
+
+  This routine describes the state shared by all time stepping
+  modules as a sequence of buffer items.
+  ---------------------------------------------------------------*/
+static int arkStateItems(ARKodeMem ark_mem, sunStateBuffer* sb)
+{
+  sunStateBuffer_Header(sb, "ARKODE");
+
+  /* Counters */
+  ITEM(sb, ark_mem->nst_attempts);
+  ITEM(sb, ark_mem->nst);
+  ITEM(sb, ark_mem->nhnil);
+  ITEM(sb, ark_mem->ncfn);
+  ITEM(sb, ark_mem->netf);
+  ITEM(sb, ark_mem->nconstrfails);
+  ITEM(sb, ark_mem->hadapt_mem->nst_acc);
+  ITEM(sb, ark_mem->hadapt_mem->nst_exp);
+  ITEM(sb, ark_mem->checkpoint_step_idx);
+
+  /* Time and step size data */
+  ITEM(sb, ark_mem->tn);
+  ITEM(sb, ark_mem->terr);
+  ITEM(sb, ark_mem->tretlast);
+  ITEM(sb, ark_mem->h);
+  ITEM(sb, ark_mem->hprime);
+  ITEM(sb, ark_mem->next_h);
+  ITEM(sb, ark_mem->eta);
+  ITEM(sb, ark_mem->hold);
+  ITEM(sb, ark_mem->h0u);
+  ITEM(sb, ark_mem->hadapt_mem->etamax);
+  ITEM(sb, ark_mem->tolsf);
+  ITEM(sb, ark_mem->AccumErrorStart);
+  ITEM(sb, ark_mem->AccumError);
+
+  /* Solution */
+  if (sunStateBuffer_Vector(sb, ark_mem->yn)) { return ARK_VECTOROP_ERR; }
+
+  return ARK_SUCCESS;
+}
+
+/*---------------------------------------------------------------
+  arkStateCheckMem:
+
+  This routine checks the inputs shared by the state functions.
+  ---------------------------------------------------------------*/
+static int arkStateCheckMem(void* arkode_mem, const char* func,
+                            ARKodeMem* ark_mem)
+{
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, func, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  *ark_mem = (ARKodeMem)arkode_mem;
+
+  if (!(*ark_mem)->MallocDone)
+  {
+    arkProcessError(*ark_mem, ARK_NO_MALLOC, __LINE__, func, __FILE__,
+                    MSG_ARK_NO_MALLOC);
+    return (ARK_NO_MALLOC);
+  }
+
+  return (ARK_SUCCESS);
+}
+
+/*===============================================================
+  Exported functions
+  ===============================================================*/
+
+/*---------------------------------------------------------------
+  ARKodeGetStateSize:
+
+  This routine returns the size of the buffer needed by
+  ARKodeSaveState and ARKodeLoadState.
+  ---------------------------------------------------------------*/
+int ARKodeGetStateSize(void* arkode_mem, size_t* bytes)
+{
+  ARKodeMem ark_mem;
+  sunStateBuffer sb;
+  int retval;
+
+  retval = arkStateCheckMem(arkode_mem, __func__, &ark_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  if (bytes == NULL)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "bytes = NULL illegal.");
+    return (ARK_ILL_INPUT);
+  }
+
+  sunStateBuffer_Init(&sb, NULL, 0, SUNFALSE);
+  retval = arkStateItems(ark_mem, &sb);
+  if (retval != ARK_SUCCESS)
+  {
+    arkProcessError(ark_mem, retval, __LINE__, __func__, __FILE__,
+                    "A vector operation failed");
+    return (retval);
+  }
+
+  *bytes = sb.pos;
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  ARKodeSaveState:
+
+  This routine writes the integrator state into a buffer of the
+  size returned by ARKodeGetStateSize.
+  ---------------------------------------------------------------*/
+int ARKodeSaveState(void* arkode_mem, void* buffer, size_t bytes)
+{
+  ARKodeMem ark_mem;
+  sunStateBuffer sb;
+  int retval;
+
+  retval = arkStateCheckMem(arkode_mem, __func__, &ark_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  if (buffer == NULL)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "buffer = NULL illegal.");
+    return (ARK_ILL_INPUT);
+  }
+
+  sunStateBuffer_Init(&sb, buffer, bytes, SUNFALSE);
+  retval = arkStateItems(ark_mem, &sb);
+  if (retval != ARK_SUCCESS)
+  {
+    arkProcessError(ark_mem, retval, __LINE__, __func__, __FILE__,
+                    "A vector operation failed");
+    return (retval);
+  }
+
+  if (sb.invalid)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The buffer is too small to hold the state");
+    return (ARK_ILL_INPUT);
+  }
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  ARKodeLoadState:
+
+  This routine restores an integrator state written by
+  ARKodeSaveState. The stepper is reset to the loaded solution
+  as in ARKodeReset, while the step size, counters, and other
+  shared data continue from their saved values.
+  ---------------------------------------------------------------*/
+int ARKodeLoadState(void* arkode_mem, const void* buffer, size_t bytes)
+{
+  ARKodeMem ark_mem;
+  sunStateBuffer sb;
+  size_t state_bytes = 0;
+  void* backup       = NULL;
+  int retval;
+
+  retval = ARKodeGetStateSize(arkode_mem, &state_bytes);
+  if (retval != ARK_SUCCESS) { return (retval); }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  if (buffer == NULL)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "buffer = NULL illegal.");
+    return (ARK_ILL_INPUT);
+  }
+
+  if (bytes != state_bytes)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The buffer size does not match the state of this problem");
+    return (ARK_ILL_INPUT);
+  }
+
+  /* Keep the current state to restore it if the buffer does not match */
+  backup = malloc(state_bytes);
+  if (backup == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_MEM_FAIL);
+    return (ARK_MEM_FAIL);
+  }
+
+  retval = ARKodeSaveState(arkode_mem, backup, state_bytes);
+  if (retval != ARK_SUCCESS)
+  {
+    free(backup);
+    return (retval);
+  }
+
+  sunStateBuffer_InitLoad(&sb, buffer, bytes);
+  retval = arkStateItems(ark_mem, &sb);
+
+  if (retval == ARK_SUCCESS && sb.invalid)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The buffer does not hold a state of this problem");
+    retval = ARK_ILL_INPUT;
+  }
+
+  /* Reset the stepper to the loaded solution. Resetting an integrator that has
+     not taken a step clears the shared data, so it is loaded again after. */
+  if (retval == ARK_SUCCESS)
+  {
+    retval = ARKodeReset(arkode_mem, ark_mem->tn, ark_mem->yn);
+  }
+
+  if (retval == ARK_SUCCESS)
+  {
+    sunStateBuffer_InitLoad(&sb, buffer, bytes);
+    retval = arkStateItems(ark_mem, &sb);
+  }
+
+  if (retval != ARK_SUCCESS)
+  {
+    sunStateBuffer_Init(&sb, backup, state_bytes, SUNTRUE);
+    (void)arkStateItems(ark_mem, &sb);
+    free(backup);
+    return (retval);
+  }
+
+  free(backup);
+
+  /* The controller history is not part of the state, so the next step starts
+     the controller over as after a reinitialization */
+  if (ark_mem->hadapt_mem->hcontroller)
+  {
+    if (SUNAdaptController_Reset(ark_mem->hadapt_mem->hcontroller))
+    {
+      arkProcessError(ark_mem, ARK_CONTROLLER_ERR, __LINE__, __func__,
+                      __FILE__, "Unable to reset error controller object");
+      return (ARK_CONTROLLER_ERR);
+    }
+  }
+
+  return (ARK_SUCCESS);
+}
+
+/*===============================================================
+  EOF
+  ===============================================================*/
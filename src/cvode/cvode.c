@@ -126,10 +126,6 @@
 
 static sunbooleantype cvCheckNvector(N_Vector tmpl);
 
-/* Initial setup */
-
-static int cvInitialSetup(CVodeMem cv_mem);
-
 /* Memory allocation/deallocation */
 
 static sunbooleantype cvAllocVectors(CVodeMem cv_mem, N_Vector tmpl);
@@ -137,6 +133,7 @@ static void cvFreeVectors(CVodeMem cv_mem);
 
 static int cvEwtSetSS(CVodeMem cv_mem, N_Vector ycur, N_Vector weight);
 static int cvEwtSetSV(CVodeMem cv_mem, N_Vector ycur, N_Vector weight);
+static sunrealtype cvEwtMin(CVodeMem cv_mem);
 
 /* Initial stepsize calculation */
 
@@ -187,8 +184,7 @@ static int cvDoErrorTest(CVodeMem cv_mem, int* nflagPtr, sunrealtype saved_t,
 static void cvCompleteStep(CVodeMem cv_mem);
 static void cvPrepareNextStep(CVodeMem cv_mem, sunrealtype dsm);
 static void cvSetEta(CVodeMem cv_mem);
-static sunrealtype cvComputeEtaqm1(CVodeMem cv_mem);
-static sunrealtype cvComputeEtaqp1(CVodeMem cv_mem);
+static void cvComputeEtaqm1qp1(CVodeMem cv_mem);
 static void cvChooseEta(CVodeMem cv_mem);
 
 /* Function to handle failures */
@@ -277,8 +273,10 @@ void* CVodeCreate(int lmm, SUNContext sunctx)
   cv_mem->cv_user_efun        = SUNFALSE;
   cv_mem->cv_efun             = NULL;
   cv_mem->cv_e_data           = NULL;
+  cv_mem->cv_ewt_batch        = NULL;
   cv_mem->cv_monitorfun       = NULL;
   cv_mem->cv_monitor_interval = 0;
+  cv_mem->cv_stepstats        = NULL;
   cv_mem->cv_qmax             = maxord;
   cv_mem->cv_mxstep           = MXSTEP_DEFAULT;
   cv_mem->cv_mxhnil           = MXHNIL_DEFAULT;
@@ -328,6 +326,9 @@ void* CVodeCreate(int lmm, SUNContext sunctx)
   /* Initialize resize variables */
   cv_mem->first_step_after_resize = SUNFALSE;
 
+  /* Initialize saved state variables */
+  cv_mem->first_step_after_load = SUNFALSE;
+
   /* Set the saved value for qmax_alloc */
 
   cv_mem->cv_qmax_alloc = maxord;
@@ -621,6 +622,12 @@ int CVodeReInit(void* cvode_mem, sunrealtype t0, N_Vector y0)
   cv_mem->cv_nscon   = 0;
   cv_mem->cv_nge     = 0;
 
+  /* Counts in the statistics stream restart from zero */
+  if (cv_mem->cv_stepstats != NULL)
+  {
+    (void)SUNStepStats_SetBaseline(cv_mem->cv_stepstats, 0, 0, 0, 0);
+  }
+
   cv_mem->cv_irfnd = 0;
 
   /* Initialize other integrator optional outputs */
@@ -1039,6 +1046,7 @@ int CVode(void* cvode_mem, sunrealtype tout, N_Vector yout, sunrealtype* tret,
   int ewtsetOK;
   sunrealtype troundoff, tout_hin, rh, nrm;
   sunbooleantype inactive_roots;
+  sunReduceBatch rb;
 
   /*
    * -------------------------------------
@@ -1442,12 +1450,33 @@ int CVode(void* cvode_mem, sunrealtype tout, N_Vector yout, sunrealtype* tret,
     cv_mem->cv_next_h = cv_mem->cv_h;
     cv_mem->cv_next_q = cv_mem->cv_q;
 
-    /* Reset and check ewt */
+    /* Reset ewt and compute the norm for the accuracy test below. The norm
+       and the positivity test of ewt share one global reduction. */
+    sunReduceBatch_Init(&rb);
+    cv_mem->cv_ewt_min = ONE;
+    ewtsetOK           = 0;
     if (cv_mem->cv_nst > 0)
     {
+      cv_mem->cv_ewt_batch = &rb;
       ewtsetOK = cv_mem->cv_efun(cv_mem->cv_zn[0], cv_mem->cv_ewt,
                                  cv_mem->cv_e_data);
+      cv_mem->cv_ewt_batch = NULL;
+    }
+    sunReduceBatch_WrmsNorm(&rb, cv_mem->cv_zn[0], cv_mem->cv_ewt, &nrm);
+    if (sunReduceBatch_Finalize(&rb))
+    {
+      cvProcessError(cv_mem, CV_VECTOROP_ERR, __LINE__, __func__, __FILE__,
+                     MSGCV_VECTOROP_ERR, cv_mem->cv_tn);
+      istate              = CV_VECTOROP_ERR;
+      cv_mem->cv_tretlast = *tret = cv_mem->cv_tn;
+      N_VScale(ONE, cv_mem->cv_zn[0], yout);
+      break;
+    }
+    if (cv_mem->cv_ewt_min <= ZERO) { ewtsetOK = -1; }
 
+    /* Check ewt */
+    if (cv_mem->cv_nst > 0)
+    {
       if (ewtsetOK != 0)
       {
         if (cv_mem->cv_itol == CV_WF)
@@ -1480,7 +1509,6 @@ int CVode(void* cvode_mem, sunrealtype tout, N_Vector yout, sunrealtype* tret,
     }
 
     /* Check for too much accuracy requested */
-    nrm              = N_VWrmsNorm(cv_mem->cv_zn[0], cv_mem->cv_ewt);
     cv_mem->cv_tolsf = cv_mem->cv_uround * nrm;
     if (cv_mem->cv_tolsf > ONE)
     {
@@ -1742,6 +1770,131 @@ int CVodeGetDky(void* cvode_mem, sunrealtype t, int k, N_Vector dky)
   return (CV_SUCCESS);
 }
 
+/*
+ * CVodeGetDkyMulti
+ *
+ * This routine computes the k-th derivative of the interpolating
+ * polynomial at each of the nt times t[m] and stores the result in
+ * the vector dky[m], using the same formula as CVodeGetDky. The
+ * coefficients for all times are formed first, with the factor
+ * h^(-k) included, and the results are computed together by
+ * N_VLinearCombinationMulti, so the Nordsieck history array is read
+ * once rather than once per output time.
+ */
+
+int CVodeGetDkyMulti(void* cvode_mem, int nt, sunrealtype* t, int k,
+                     N_Vector* dky)
+{
+  sunrealtype s, r, cval;
+  sunrealtype tfuzz, tp, tn1;
+  sunrealtype* cvals;
+  int i, j, m, nvec, ier;
+  CVodeMem cv_mem;
+
+  /* Check all inputs for legality */
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+  cv_mem = (CVodeMem)cvode_mem;
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(CV_PROFILER);
+
+  if ((nt < 1) || (t == NULL))
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "nt < 1 or t = NULL illegal.");
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_ILL_INPUT);
+  }
+
+  if (dky == NULL)
+  {
+    cvProcessError(cv_mem, CV_BAD_DKY, __LINE__, __func__, __FILE__,
+                   MSGCV_NULL_DKY);
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_BAD_DKY);
+  }
+
+  for (m = 0; m < nt; m++)
+  {
+    if (dky[m] == NULL)
+    {
+      cvProcessError(cv_mem, CV_BAD_DKY, __LINE__, __func__, __FILE__,
+                     MSGCV_NULL_DKY);
+      SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+      return (CV_BAD_DKY);
+    }
+  }
+
+  if ((k < 0) || (k > cv_mem->cv_q))
+  {
+    cvProcessError(cv_mem, CV_BAD_K, __LINE__, __func__, __FILE__, MSGCV_BAD_K);
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_BAD_K);
+  }
+
+  /* Allow for some slack */
+  tfuzz = FUZZ_FACTOR * cv_mem->cv_uround *
+          (SUNRabs(cv_mem->cv_tn) + SUNRabs(cv_mem->cv_hu));
+  if (cv_mem->cv_hu < ZERO) { tfuzz = -tfuzz; }
+  tp  = cv_mem->cv_tn - cv_mem->cv_hu - tfuzz;
+  tn1 = cv_mem->cv_tn + tfuzz;
+  for (m = 0; m < nt; m++)
+  {
+    if ((t[m] - tp) * (t[m] - tn1) > ZERO)
+    {
+      cvProcessError(cv_mem, CV_BAD_T, __LINE__, __func__, __FILE__,
+                     MSGCV_BAD_T, t[m], cv_mem->cv_tn - cv_mem->cv_hu,
+                     cv_mem->cv_tn);
+      SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+      return (CV_BAD_T);
+    }
+  }
+
+  /* Coefficients of the differentiated interpolating polynomial, one row of
+     nvec values per output time */
+  nvec  = cv_mem->cv_q - k + 1;
+  cvals = (sunrealtype*)malloc(nt * nvec * sizeof(sunrealtype));
+  if (cvals == NULL)
+  {
+    cvProcessError(cv_mem, CV_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   MSGCV_MEM_FAIL);
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_MEM_FAIL);
+  }
+
+  r = (k == 0) ? ONE : SUNRpowerI(cv_mem->cv_h, -k);
+
+  for (m = 0; m < nt; m++)
+  {
+    s = (t[m] - cv_mem->cv_tn) / cv_mem->cv_h;
+    for (j = cv_mem->cv_q; j >= k; j--)
+    {
+      cval = ONE;
+      for (i = j; i >= j - k + 1; i--) { cval *= i; }
+      for (i = 0; i < j - k; i++) { cval *= s; }
+      cvals[m * nvec + cv_mem->cv_q - j] = r * cval;
+    }
+  }
+
+  for (j = cv_mem->cv_q; j >= k; j--)
+  {
+    cv_mem->cv_Xvecs[cv_mem->cv_q - j] = cv_mem->cv_zn[j];
+  }
+
+  /* Sum the differentiated interpolating polynomial at all times */
+  ier = N_VLinearCombinationMulti(nvec, nt, cvals, cv_mem->cv_Xvecs, dky);
+
+  free(cvals);
+
+  SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+  if (ier != CV_SUCCESS) { return (CV_VECTOROP_ERR); }
+  return (CV_SUCCESS);
+}
+
 /*
  * CVodeComputeState
  *
@@ -2011,7 +2164,7 @@ static void cvFreeVectors(CVodeMem cv_mem)
  * linear solver initialization routine.
  */
 
-static int cvInitialSetup(CVodeMem cv_mem)
+int cvInitialSetup(CVodeMem cv_mem)
 {
   int ier;
   sunbooleantype conOK;
@@ -3078,6 +3231,7 @@ static int cvNls(CVodeMem cv_mem, int nflag)
 
     callSetup = (nflag == PREV_CONV_FAIL) || (nflag == PREV_ERR_FAIL) ||
                 (cv_mem->cv_nst == 0) || (cv_mem->first_step_after_resize) ||
+                (cv_mem->first_step_after_load) ||
                 (cv_mem->cv_nst >= cv_mem->cv_nstlp + cv_mem->cv_msbp) ||
                 (SUNRabs(cv_mem->cv_gamrat - ONE) > cv_mem->cv_dgmax_lsetup);
   }
@@ -3470,6 +3624,7 @@ static void cvCompleteStep(CVodeMem cv_mem)
   cv_mem->cv_qu = cv_mem->cv_q;
 
   cv_mem->first_step_after_resize = SUNFALSE;
+  cv_mem->first_step_after_load   = SUNFALSE;
 
   for (i = cv_mem->cv_q; i >= 2; i--)
   {
@@ -3510,6 +3665,16 @@ static void cvCompleteStep(CVodeMem cv_mem)
   }
 #endif
 
+  /* Append this step to the statistics stream */
+  if (cv_mem->cv_stepstats != NULL)
+  {
+    long int nli = 0;
+    if (cv_mem->cv_lmem != NULL) { (void)CVodeGetNumLinIters(cv_mem, &nli); }
+    (void)SUNStepStats_Record(cv_mem->cv_stepstats, cv_mem->cv_tn,
+                              cv_mem->cv_hu, cv_mem->cv_qu, cv_mem->cv_netf,
+                              cv_mem->cv_nni, nli, cv_mem->cv_nsetups);
+  }
+
   SUNLogDebug(CV_LOGGER, "return", "nst = %d, nscon = %d", cv_mem->cv_nst,
               cv_mem->cv_nscon);
 }
@@ -3550,9 +3715,8 @@ static void cvPrepareNextStep(CVodeMem cv_mem, sunrealtype dsm)
       /* If qwait = 0, consider an order change.   etaqm1 and etaqp1 are
         the ratios of new to old h at orders q-1 and q+1, respectively.
         cvChooseEta selects the largest; cvSetEta adjusts eta and acor */
-      cv_mem->cv_qwait  = 2;
-      cv_mem->cv_etaqm1 = cvComputeEtaqm1(cv_mem);
-      cv_mem->cv_etaqp1 = cvComputeEtaqp1(cv_mem);
+      cv_mem->cv_qwait = 2;
+      cvComputeEtaqm1qp1(cv_mem);
       cvChooseEta(cv_mem);
       cvSetEta(cv_mem);
     }
@@ -3604,51 +3768,65 @@ static void cvSetEta(CVodeMem cv_mem)
 }
 
 /*
- * cvComputeEtaqm1
+ * cvComputeEtaqm1qp1
  *
- * This routine computes and returns the value of etaqm1 for a
- * possible decrease in order by 1.
+ * This routine computes the values of etaqm1 and etaqp1 for a
+ * possible decrease or increase in order by 1. The norms for both
+ * orders are combined into a single reduction. An eta is left at
+ * zero when the order change is not possible or a vector operation
+ * fails.
  */
 
-static sunrealtype cvComputeEtaqm1(CVodeMem cv_mem)
+static void cvComputeEtaqm1qp1(CVodeMem cv_mem)
 {
-  sunrealtype ddn;
+  sunReduceBatch rb;
+  sunbooleantype qm1, qp1;
+  sunrealtype ddn = ZERO;
+  sunrealtype dup = ZERO;
+  sunrealtype cquot;
 
   cv_mem->cv_etaqm1 = ZERO;
-  if (cv_mem->cv_q > 1)
-  {
-    ddn = N_VWrmsNorm(cv_mem->cv_zn[cv_mem->cv_q], cv_mem->cv_ewt) *
-          cv_mem->cv_tq[1];
-    cv_mem->cv_etaqm1 = ONE /
-                        (SUNRpowerR(BIAS1 * ddn, ONE / cv_mem->cv_q) + ADDON);
-  }
-  return (cv_mem->cv_etaqm1);
-}
+  cv_mem->cv_etaqp1 = ZERO;
 
-/*
- * cvComputeEtaqp1
- *
- * This routine computes and returns the value of etaqp1 for a
- * possible increase in order by 1.
- */
+  qm1 = (cv_mem->cv_q > 1);
+  qp1 = (cv_mem->cv_q != cv_mem->cv_qmax) && (cv_mem->cv_saved_tq5 != ZERO);
 
-static sunrealtype cvComputeEtaqp1(CVodeMem cv_mem)
-{
-  sunrealtype dup, cquot;
+  sunReduceBatch_Init(&rb);
 
-  cv_mem->cv_etaqp1 = ZERO;
-  if (cv_mem->cv_q != cv_mem->cv_qmax)
+  if (qm1)
+  {
+    sunReduceBatch_WrmsNorm(&rb, cv_mem->cv_zn[cv_mem->cv_q], cv_mem->cv_ewt,
+                            &ddn);
+  }
+
+  if (qp1)
   {
-    if (cv_mem->cv_saved_tq5 == ZERO) { return (cv_mem->cv_etaqp1); }
     cquot = (cv_mem->cv_tq[5] / cv_mem->cv_saved_tq5) *
             SUNRpowerI(cv_mem->cv_h / cv_mem->cv_tau[2], cv_mem->cv_L);
-    N_VLinearSum(-cquot, cv_mem->cv_zn[cv_mem->cv_qmax], ONE, cv_mem->cv_acor,
-                 cv_mem->cv_tempv);
-    dup = N_VWrmsNorm(cv_mem->cv_tempv, cv_mem->cv_ewt) * cv_mem->cv_tq[3];
+    cv_mem->cv_cvals[0] = -cquot;
+    cv_mem->cv_Xvecs[0] = cv_mem->cv_zn[cv_mem->cv_qmax];
+    cv_mem->cv_cvals[1] = ONE;
+    cv_mem->cv_Xvecs[1] = cv_mem->cv_acor;
+    sunReduceBatch_LinearCombinationWrmsNorm(&rb, 2, cv_mem->cv_cvals,
+                                             cv_mem->cv_Xvecs, cv_mem->cv_tempv,
+                                             cv_mem->cv_ewt, &dup);
+  }
+
+  if (sunReduceBatch_Finalize(&rb)) { return; }
+
+  if (qm1)
+  {
+    ddn *= cv_mem->cv_tq[1];
+    cv_mem->cv_etaqm1 = ONE /
+                        (SUNRpowerR(BIAS1 * ddn, ONE / cv_mem->cv_q) + ADDON);
+  }
+
+  if (qp1)
+  {
+    dup *= cv_mem->cv_tq[3];
     cv_mem->cv_etaqp1 =
       ONE / (SUNRpowerR(BIAS3 * dup, ONE / (cv_mem->cv_L + 1)) + ADDON);
   }
-  return (cv_mem->cv_etaqp1);
 }
 
 /*
@@ -3829,7 +4007,10 @@ static int cvHandleFailure(CVodeMem cv_mem, int flag)
 static void cvBDFStab(CVodeMem cv_mem)
 {
   int i, k, ldflag, factorial;
-  sunrealtype sq, sqm1, sqm2;
+  sunrealtype sq;
+  sunrealtype sqm1 = ZERO;
+  sunrealtype sqm2 = ZERO;
+  sunReduceBatch rb;
 
   /* If order is 3 or greater, then save scaled derivative data,
      push old data down in i, then add current values to top.    */
@@ -3847,10 +4028,14 @@ static void cvBDFStab(CVodeMem cv_mem)
     for (i = 1; i <= cv_mem->cv_q - 1; i++) { factorial *= i; }
     sq = factorial * cv_mem->cv_q * (cv_mem->cv_q + 1) * cv_mem->cv_acnrm /
          SUNMAX(cv_mem->cv_tq[5], TINY);
-    sqm1 = factorial * cv_mem->cv_q *
-           N_VWrmsNorm(cv_mem->cv_zn[cv_mem->cv_q], cv_mem->cv_ewt);
-    sqm2 = factorial *
-           N_VWrmsNorm(cv_mem->cv_zn[cv_mem->cv_q - 1], cv_mem->cv_ewt);
+    sunReduceBatch_Init(&rb);
+    sunReduceBatch_WrmsNorm(&rb, cv_mem->cv_zn[cv_mem->cv_q], cv_mem->cv_ewt,
+                            &sqm1);
+    sunReduceBatch_WrmsNorm(&rb, cv_mem->cv_zn[cv_mem->cv_q - 1],
+                            cv_mem->cv_ewt, &sqm2);
+    (void)sunReduceBatch_Finalize(&rb);
+    sqm1 = factorial * cv_mem->cv_q * sqm1;
+    sqm2 = factorial * sqm2;
     cv_mem->cv_ssdat[1][1] = sqm2 * sqm2;
     cv_mem->cv_ssdat[1][2] = sqm1 * sqm1;
     cv_mem->cv_ssdat[1][3] = sq * sq;
@@ -4776,6 +4961,24 @@ int cvEwtSet(N_Vector ycur, N_Vector weight, void* data)
   return (flag);
 }
 
+/*
+ * cvEwtMin
+ *
+ * This routine returns the minimum of the tolerance vector in tempv for
+ * the positivity test of cvEwtSetSS and cvEwtSetSV. If the test is part
+ * of a batch of reductions, the global minimum is stored in cv_ewt_min
+ * when the batch is finalized and the task-local minimum is returned, so
+ * that tempv is never inverted where it has non-positive components.
+ */
+
+static sunrealtype cvEwtMin(CVodeMem cv_mem)
+{
+  if (cv_mem->cv_ewt_batch == NULL) { return N_VMin(cv_mem->cv_tempv); }
+
+  return sunReduceBatch_Min(cv_mem->cv_ewt_batch, cv_mem->cv_tempv,
+                            &cv_mem->cv_ewt_min);
+}
+
 /*
  * cvEwtSetSS
  *
@@ -4797,7 +5000,7 @@ static int cvEwtSetSS(CVodeMem cv_mem, N_Vector ycur, N_Vector weight)
                      ycur, cv_mem->cv_tempv, weight);
     if (cv_mem->cv_atolmin0)
     {
-      if (N_VMin(cv_mem->cv_tempv) <= ZERO) return (-1);
+      if (cvEwtMin(cv_mem) <= ZERO) return (-1);
     }
   }
   else
@@ -4808,7 +5011,7 @@ static int cvEwtSetSS(CVodeMem cv_mem, N_Vector ycur, N_Vector weight)
     N_VAddConst(cv_mem->cv_tempv, cv_mem->cv_Sabstol, cv_mem->cv_tempv);
     if (cv_mem->cv_atolmin0)
     {
-      if (N_VMin(cv_mem->cv_tempv) <= ZERO) { return (-1); }
+      if (cvEwtMin(cv_mem) <= ZERO) { return (-1); }
     }
     N_VInv(cv_mem->cv_tempv, weight);
   }
@@ -4837,7 +5040,7 @@ static int cvEwtSetSV(CVodeMem cv_mem, N_Vector ycur, N_Vector weight)
                      ycur, cv_mem->cv_tempv, weight);
     if (cv_mem->cv_atolmin0)
     {
-      if (N_VMin(cv_mem->cv_tempv) <= ZERO) return (-1);
+      if (cvEwtMin(cv_mem) <= ZERO) return (-1);
     }
   }
   else
@@ -4848,7 +5051,7 @@ static int cvEwtSetSV(CVodeMem cv_mem, N_Vector ycur, N_Vector weight)
                  cv_mem->cv_tempv);
     if (cv_mem->cv_atolmin0)
     {
-      if (N_VMin(cv_mem->cv_tempv) <= ZERO) { return (-1); }
+      if (cvEwtMin(cv_mem) <= ZERO) { return (-1); }
     }
     N_VInv(cv_mem->cv_tempv, weight);
   }
@@ -0,0 +1,264 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This file implements fused CPU kernels for CVODE with the serial
+ * and OpenMP vectors. Each kernel computes in a single loop what
+ * the unfused code computes with a sequence of vector operations,
+ * so the vectors are read and written once. With an OpenMP vector
+ * the loop is split over the threads of the vector.
+ *
+ * The arithmetic is applied in the same order as in the vector
+ * operations the kernels replace.
+ * -----------------------------------------------------------------*/
+
+#include <nvector/nvector_openmp.h>
+#include <sundials/sundials_math.h>
+
+#include "cvode_fused_cpu.h"
+
+#define ZERO   SUN_RCONST(0.0)
+#define PT1    SUN_RCONST(0.1)
+#define ONEPT5 SUN_RCONST(1.50)
+#define ONE    SUN_RCONST(1.0)
+
+/* Loop over the vector entries, split over nthreads OpenMP threads */
+#ifdef _OPENMP
+#define CV_FUSED_FOR \
+  _Pragma("omp parallel for schedule(static) num_threads(nthreads) if (nthreads > 1)")
+#else
+#define CV_FUSED_FOR ((void)nthreads);
+#endif
+
+/* Number of threads used for the loops over the entries of v */
+static int cvFusedNumThreads(N_Vector v)
+{
+#ifdef _OPENMP
+  if (N_VGetVectorID(v) == SUNDIALS_NVEC_OPENMP)
+  {
+    return NV_NUM_THREADS_OMP(v);
+  }
+#endif
+  return 1;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Check if the fused CPU kernels support the vector v.
+ * -----------------------------------------------------------------
+ */
+
+sunbooleantype cvFusedCPU_Supported(N_Vector v)
+{
+  N_Vector_ID id = N_VGetVectorID(v);
+  return (id == SUNDIALS_NVEC_SERIAL || id == SUNDIALS_NVEC_OPENMP);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Compute the ewt vector when the tol type is CV_SS.
+ * -----------------------------------------------------------------
+ */
+
+int cvEwtSetSS_cpu(const sunrealtype reltol, const sunrealtype Sabstol,
+                   const N_Vector ycur, N_Vector tempv, N_Vector weight)
+{
+  sunindextype i;
+  sunindextype N      = N_VGetLength(weight);
+  int nthreads        = cvFusedNumThreads(weight);
+  sunrealtype* y_data = N_VGetArrayPointer(ycur);
+  sunrealtype* t_data = N_VGetArrayPointer(tempv);
+  sunrealtype* w_data = N_VGetArrayPointer(weight);
+
+  /* tempv = reltol * |ycur| + Sabstol, weight = 1 / tempv */
+  CV_FUSED_FOR
+  for (i = 0; i < N; i++)
+  {
+    t_data[i] = reltol * SUNRabs(y_data[i]) + Sabstol;
+    w_data[i] = ONE / t_data[i];
+  }
+
+  return 0;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Compute the ewt vector when the tol type is CV_SV.
+ * -----------------------------------------------------------------
+ */
+
+int cvEwtSetSV_cpu(const sunrealtype reltol, const N_Vector Vabstol,
+                   const N_Vector ycur, N_Vector tempv, N_Vector weight)
+{
+  sunindextype i;
+  sunindextype N      = N_VGetLength(weight);
+  int nthreads        = cvFusedNumThreads(weight);
+  sunrealtype* a_data = N_VGetArrayPointer(Vabstol);
+  sunrealtype* y_data = N_VGetArrayPointer(ycur);
+  sunrealtype* t_data = N_VGetArrayPointer(tempv);
+  sunrealtype* w_data = N_VGetArrayPointer(weight);
+
+  /* tempv = reltol * |ycur| + Vabstol, weight = 1 / tempv */
+  CV_FUSED_FOR
+  for (i = 0; i < N; i++)
+  {
+    t_data[i] = reltol * SUNRabs(y_data[i]) + a_data[i];
+    w_data[i] = ONE / t_data[i];
+  }
+
+  return 0;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Determine if the constraints of the problem are satisfied by
+ * the proposed step.
+ * -----------------------------------------------------------------
+ */
+
+int cvCheckConstraints_cpu(const N_Vector c, const N_Vector ewt,
+                           const N_Vector y, const N_Vector mm, N_Vector tempv)
+{
+  sunindextype i;
+  sunindextype N        = N_VGetLength(tempv);
+  int nthreads          = cvFusedNumThreads(tempv);
+  sunrealtype* c_data   = N_VGetArrayPointer(c);
+  sunrealtype* ewt_data = N_VGetArrayPointer(ewt);
+  sunrealtype* y_data   = N_VGetArrayPointer(y);
+  sunrealtype* mm_data  = N_VGetArrayPointer(mm);
+  sunrealtype* t_data   = N_VGetArrayPointer(tempv);
+
+  /* tempv = mm * (y - 0.1 * a * c * wt) with a = 1 when |c| = 2 */
+  CV_FUSED_FOR
+  for (i = 0; i < N; i++)
+  {
+    sunrealtype tmp = (SUNRabs(c_data[i]) >= ONEPT5) ? c_data[i] : ZERO;
+    tmp             = tmp / ewt_data[i];
+    t_data[i]       = (y_data[i] - PT1 * tmp) * mm_data[i];
+  }
+
+  return 0;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Compute the nonlinear residual.
+ * -----------------------------------------------------------------
+ */
+
+int cvNlsResid_cpu(const sunrealtype rl1, const sunrealtype ngamma,
+                   const N_Vector zn1, const N_Vector ycor,
+                   const N_Vector ftemp, N_Vector res)
+{
+  sunindextype i;
+  sunindextype N          = N_VGetLength(res);
+  int nthreads            = cvFusedNumThreads(res);
+  sunrealtype* zn1_data   = N_VGetArrayPointer(zn1);
+  sunrealtype* ycor_data  = N_VGetArrayPointer(ycor);
+  sunrealtype* ftemp_data = N_VGetArrayPointer(ftemp);
+  sunrealtype* res_data   = N_VGetArrayPointer(res);
+
+  /* res = rl1 * zn1 + ycor - gamma * ftemp */
+  CV_FUSED_FOR
+  for (i = 0; i < N; i++)
+  {
+    res_data[i] = ngamma * ftemp_data[i] + (rl1 * zn1_data[i] + ycor_data[i]);
+  }
+
+  return 0;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Form y with perturbation = FRACT*(func. iter. correction)
+ * -----------------------------------------------------------------
+ */
+
+int cvDiagSetup_formY_cpu(const sunrealtype h, const sunrealtype r,
+                          const N_Vector fpred, const N_Vector zn1,
+                          const N_Vector ypred, N_Vector ftemp, N_Vector y)
+{
+  sunindextype i;
+  sunindextype N          = N_VGetLength(y);
+  int nthreads            = cvFusedNumThreads(y);
+  sunrealtype* fpred_data = N_VGetArrayPointer(fpred);
+  sunrealtype* zn1_data   = N_VGetArrayPointer(zn1);
+  sunrealtype* ypred_data = N_VGetArrayPointer(ypred);
+  sunrealtype* ftemp_data = N_VGetArrayPointer(ftemp);
+  sunrealtype* y_data     = N_VGetArrayPointer(y);
+
+  /* ftemp = h * fpred - zn1, y = r * ftemp + ypred */
+  CV_FUSED_FOR
+  for (i = 0; i < N; i++)
+  {
+    ftemp_data[i] = h * fpred_data[i] - zn1_data[i];
+    y_data[i]     = r * ftemp_data[i] + ypred_data[i];
+  }
+
+  return 0;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Construct M = I - gamma*J with J = diag(deltaf_i/deltay_i)
+ * protecting against deltay_i being at roundoff level. Unlike the
+ * unfused code, the masks and the perturbation are not stored in
+ * work vectors.
+ * -----------------------------------------------------------------
+ */
+
+int cvDiagSetup_buildM_cpu(const sunrealtype fract, const sunrealtype uround,
+                           const sunrealtype h, const N_Vector ftemp,
+                           const N_Vector fpred, const N_Vector ewt, N_Vector M)
+{
+  sunindextype i;
+  sunindextype N          = N_VGetLength(M);
+  int nthreads            = cvFusedNumThreads(M);
+  sunrealtype* ftemp_data = N_VGetArrayPointer(ftemp);
+  sunrealtype* fpred_data = N_VGetArrayPointer(fpred);
+  sunrealtype* ewt_data   = N_VGetArrayPointer(ewt);
+  sunrealtype* M_data     = N_VGetArrayPointer(M);
+
+  /* M = (fract * ftemp - h * (M - fpred)) / (fract * ftemp), or 1 when the
+     weighted perturbation ftemp * ewt is below uround */
+  CV_FUSED_FOR
+  for (i = 0; i < N; i++)
+  {
+    if (SUNRabs(ftemp_data[i] * ewt_data[i]) >= uround)
+    {
+      sunrealtype num = fract * ftemp_data[i] -
+                        h * (M_data[i] - fpred_data[i]);
+      M_data[i]       = num / (fract * ftemp_data[i]);
+    }
+    else { M_data[i] = ONE; }
+  }
+
+  return 0;
+}
+
+/*
+ * -----------------------------------------------------------------
+ *  Update M with changed gamma so that M = I - gamma*J.
+ * -----------------------------------------------------------------
+ */
+
+int cvDiagSolve_updateM_cpu(const sunrealtype r, N_Vector M)
+{
+  sunindextype i;
+  sunindextype N      = N_VGetLength(M);
+  int nthreads        = cvFusedNumThreads(M);
+  sunrealtype* M_data = N_VGetArrayPointer(M);
+
+  /* M = r * (1 / M - 1) + 1 */
+  CV_FUSED_FOR
+  for (i = 0; i < N; i++) { M_data[i] = r * (ONE / M_data[i] - ONE) + ONE; }
+
+  return 0;
+}
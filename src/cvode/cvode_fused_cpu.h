@@ -0,0 +1,57 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Private header file for the fused CPU kernels of CVODE. These
+ * kernels are used by all fused kernel libraries for the serial
+ * and OpenMP vectors.
+ * -----------------------------------------------------------------*/
+
+#ifndef _CVODE_FUSED_CPU_H
+#define _CVODE_FUSED_CPU_H
+
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+sunbooleantype cvFusedCPU_Supported(N_Vector v);
+
+int cvEwtSetSS_cpu(const sunrealtype reltol, const sunrealtype Sabstol,
+                   const N_Vector ycur, N_Vector tempv, N_Vector weight);
+
+int cvEwtSetSV_cpu(const sunrealtype reltol, const N_Vector Vabstol,
+                   const N_Vector ycur, N_Vector tempv, N_Vector weight);
+
+int cvCheckConstraints_cpu(const N_Vector c, const N_Vector ewt,
+                           const N_Vector y, const N_Vector mm, N_Vector tempv);
+
+int cvNlsResid_cpu(const sunrealtype rl1, const sunrealtype ngamma,
+                   const N_Vector zn1, const N_Vector ycor,
+                   const N_Vector ftemp, N_Vector res);
+
+int cvDiagSetup_formY_cpu(const sunrealtype h, const sunrealtype r,
+                          const N_Vector fpred, const N_Vector zn1,
+                          const N_Vector ypred, N_Vector ftemp, N_Vector y);
+
+int cvDiagSetup_buildM_cpu(const sunrealtype fract, const sunrealtype uround,
+                           const sunrealtype h, const N_Vector ftemp,
+                           const N_Vector fpred, const N_Vector ewt,
+                           N_Vector M);
+
+int cvDiagSolve_updateM_cpu(const sunrealtype r, N_Vector M);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -11,7 +11,8 @@
  * SPDX-License-Identifier: BSD-3-Clause
  * SUNDIALS Copyright End
  * -----------------------------------------------------------------
- * This file implements fused CUDA/HIP kernels for CVODE.
+ * This file implements fused CUDA/HIP kernels for CVODE. The serial
+ * and OpenMP vectors use the fused CPU kernels.
  * -----------------------------------------------------------------*/
 
 #ifdef USE_CUDA
@@ -46,6 +47,8 @@ constexpr auto gpuAssert            = SUNDIALS_HIP_Assert;
 #error Incompatible GPU option for fused kernels
 #endif
 
+#include "cvode_fused_cpu.h"
+
 /*
  * -----------------------------------------------------------------
  * Compute the ewt vector when the tol type is CV_SS.
@@ -76,6 +79,11 @@ extern "C" int cvEwtSetSS_fused(const sunbooleantype atolMin0,
                                 const sunrealtype Sabstol, const N_Vector ycur,
                                 N_Vector tempv, N_Vector weight)
 {
+  if (cvFusedCPU_Supported(weight))
+  {
+    return cvEwtSetSS_cpu(reltol, Sabstol, ycur, tempv, weight);
+  }
+
   const SUNExecPolicy* exec_policy =
     ((NVectorContent)weight->content)->stream_exec_policy;
   const sunindextype N = N_VGetLength(weight);
@@ -126,6 +134,11 @@ extern "C" int cvEwtSetSV_fused(const sunbooleantype atolMin0,
                                 const N_Vector Vabstol, const N_Vector ycur,
                                 N_Vector tempv, N_Vector weight)
 {
+  if (cvFusedCPU_Supported(weight))
+  {
+    return cvEwtSetSV_cpu(reltol, Vabstol, ycur, tempv, weight);
+  }
+
   const SUNExecPolicy* exec_policy =
     ((NVectorContent)weight->content)->stream_exec_policy;
   const sunindextype N = N_VGetLength(weight);
@@ -181,6 +194,11 @@ extern "C" int cvCheckConstraints_fused(const N_Vector c, const N_Vector ewt,
                                         const N_Vector y, const N_Vector mm,
                                         N_Vector tempv)
 {
+  if (cvFusedCPU_Supported(tempv))
+  {
+    return cvCheckConstraints_cpu(c, ewt, y, mm, tempv);
+  }
+
   const SUNExecPolicy* exec_policy =
     ((NVectorContent)c->content)->stream_exec_policy;
   const sunindextype N = N_VGetLength(c);
@@ -226,6 +244,11 @@ extern "C" int cvNlsResid_fused(const sunrealtype rl1, const sunrealtype ngamma,
                                 const N_Vector zn1, const N_Vector ycor,
                                 const N_Vector ftemp, N_Vector res)
 {
+  if (cvFusedCPU_Supported(res))
+  {
+    return cvNlsResid_cpu(rl1, ngamma, zn1, ycor, ftemp, res);
+  }
+
   const SUNExecPolicy* exec_policy =
     ((NVectorContent)res->content)->stream_exec_policy;
   const sunindextype N = N_VGetLength(res);
@@ -273,6 +296,11 @@ extern "C" int cvDiagSetup_formY(const sunrealtype h, const sunrealtype r,
                                  const N_Vector fpred, const N_Vector zn1,
                                  const N_Vector ypred, N_Vector ftemp, N_Vector y)
 {
+  if (cvFusedCPU_Supported(y))
+  {
+    return cvDiagSetup_formY_cpu(h, r, fpred, zn1, ypred, ftemp, y);
+  }
+
   const SUNExecPolicy* exec_policy =
     ((NVectorContent)y->content)->stream_exec_policy;
   const sunindextype N = N_VGetLength(y);
@@ -340,6 +368,11 @@ extern "C" int cvDiagSetup_buildM(const sunrealtype fract,
                                   const N_Vector ewt, N_Vector bit,
                                   N_Vector bitcomp, N_Vector y, N_Vector M)
 {
+  if (cvFusedCPU_Supported(M))
+  {
+    return cvDiagSetup_buildM_cpu(fract, uround, h, ftemp, fpred, ewt, M);
+  }
+
   const SUNExecPolicy* exec_policy =
     ((NVectorContent)M->content)->stream_exec_policy;
   const sunindextype N = N_VGetLength(M);
@@ -387,6 +420,8 @@ __global__ void cvDiagSolve_updateM_kernel(const sunindextype length,
 
 extern "C" int cvDiagSolve_updateM(const sunrealtype r, N_Vector M)
 {
+  if (cvFusedCPU_Supported(M)) { return cvDiagSolve_updateM_cpu(r, M); }
+
   const SUNExecPolicy* exec_policy =
     ((NVectorContent)M->content)->stream_exec_policy;
   const sunindextype N = N_VGetLength(M);
@@ -12,17 +12,18 @@
  * SPDX-License-Identifier: BSD-3-Clause
  * SUNDIALS Copyright End
  * -----------------------------------------------------------------
- * This file implements fused stub kernels for CVODE.
+ * This file implements fused stub kernels for CVODE. The serial and
+ * OpenMP vectors use the fused CPU kernels, other vectors use a
+ * sequence of vector operations.
  * -----------------------------------------------------------------
  */
 
 #include "cvode_diag_impl.h"
+#include "cvode_fused_cpu.h"
 #include "cvode_impl.h"
-#include "sundials_macros.h"
 
 #define ZERO   SUN_RCONST(0.0)
 #define PT1    SUN_RCONST(0.1)
-#define FRACT  SUN_RCONST(0.1)
 #define ONEPT5 SUN_RCONST(1.50)
 #define ONE    SUN_RCONST(1.0)
 
@@ -36,6 +37,11 @@ int cvEwtSetSS_fused(const sunbooleantype atolmin0, const sunrealtype reltol,
                      const sunrealtype Sabstol, const N_Vector ycur,
                      N_Vector tempv, N_Vector weight)
 {
+  if (cvFusedCPU_Supported(weight))
+  {
+    return cvEwtSetSS_cpu(reltol, Sabstol, ycur, tempv, weight);
+  }
+
   N_VAbs(ycur, tempv);
   N_VScale(reltol, tempv, tempv);
   N_VAddConst(tempv, Sabstol, tempv);
@@ -57,6 +63,11 @@ int cvEwtSetSV_fused(const sunbooleantype atolmin0, const sunrealtype reltol,
                      const N_Vector Vabstol, const N_Vector ycur,
                      N_Vector tempv, N_Vector weight)
 {
+  if (cvFusedCPU_Supported(weight))
+  {
+    return cvEwtSetSV_cpu(reltol, Vabstol, ycur, tempv, weight);
+  }
+
   N_VAbs(ycur, tempv);
   N_VLinearSum(reltol, tempv, ONE, Vabstol, tempv);
   if (atolmin0)
@@ -77,6 +88,11 @@ int cvEwtSetSV_fused(const sunbooleantype atolmin0, const sunrealtype reltol,
 int cvCheckConstraints_fused(const N_Vector c, const N_Vector ewt,
                              const N_Vector y, const N_Vector mm, N_Vector tmp)
 {
+  if (cvFusedCPU_Supported(tmp))
+  {
+    return cvCheckConstraints_cpu(c, ewt, y, mm, tmp);
+  }
+
   N_VCompare(ONEPT5, c, tmp);           /* a[i]=1 when |c[i]|=2  */
   N_VProd(tmp, c, tmp);                 /* a * c                 */
   N_VDiv(tmp, ewt, tmp);                /* a * c * wt            */
@@ -95,6 +111,11 @@ int cvNlsResid_fused(const sunrealtype rl1, const sunrealtype ngamma,
                      const N_Vector zn1, const N_Vector ycor,
                      const N_Vector ftemp, N_Vector res)
 {
+  if (cvFusedCPU_Supported(res))
+  {
+    return cvNlsResid_cpu(rl1, ngamma, zn1, ycor, ftemp, res);
+  }
+
   N_VLinearSum(rl1, zn1, ONE, ycor, res);
   N_VLinearSum(ngamma, ftemp, ONE, res, res);
   return 0;
@@ -110,6 +131,11 @@ int cvDiagSetup_formY(const sunrealtype h, const sunrealtype r,
                       const N_Vector fpred, const N_Vector zn1,
                       const N_Vector ypred, N_Vector ftemp, N_Vector y)
 {
+  if (cvFusedCPU_Supported(y))
+  {
+    return cvDiagSetup_formY_cpu(h, r, fpred, zn1, ypred, ftemp, y);
+  }
+
   N_VLinearSum(h, fpred, -ONE, zn1, ftemp);
   N_VLinearSum(r, ftemp, ONE, ypred, y);
   return 0;
@@ -122,20 +148,24 @@ int cvDiagSetup_formY(const sunrealtype h, const sunrealtype r,
  * -----------------------------------------------------------------
  */
 
-int cvDiagSetup_buildM(SUNDIALS_MAYBE_UNUSED const sunrealtype fract,
-                       const sunrealtype uround, const sunrealtype h,
-                       const N_Vector ftemp, const N_Vector fpred,
-                       const N_Vector ewt, N_Vector bit, N_Vector bitcomp,
-                       N_Vector y, N_Vector M)
+int cvDiagSetup_buildM(const sunrealtype fract, const sunrealtype uround,
+                       const sunrealtype h, const N_Vector ftemp,
+                       const N_Vector fpred, const N_Vector ewt, N_Vector bit,
+                       N_Vector bitcomp, N_Vector y, N_Vector M)
 {
+  if (cvFusedCPU_Supported(M))
+  {
+    return cvDiagSetup_buildM_cpu(fract, uround, h, ftemp, fpred, ewt, M);
+  }
+
   N_VLinearSum(ONE, M, -ONE, fpred, M);
-  N_VLinearSum(FRACT, ftemp, -h, M, M);
+  N_VLinearSum(fract, ftemp, -h, M, M);
   N_VProd(ftemp, ewt, y);
   /* Protect against deltay_i being at roundoff level */
   N_VCompare(uround, y, bit);
   N_VAddConst(bit, -ONE, bitcomp);
   N_VProd(ftemp, bit, y);
-  N_VLinearSum(FRACT, y, -ONE, bitcomp, y);
+  N_VLinearSum(fract, y, -ONE, bitcomp, y);
   N_VDiv(M, y, M);
   N_VProd(M, bit, M);
   N_VLinearSum(ONE, M, -ONE, bitcomp, M);
@@ -150,6 +180,8 @@ int cvDiagSetup_buildM(SUNDIALS_MAYBE_UNUSED const sunrealtype fract,
 
 int cvDiagSolve_updateM(const sunrealtype r, N_Vector M)
 {
+  if (cvFusedCPU_Supported(M)) { return cvDiagSolve_updateM_cpu(r, M); }
+
   N_VInv(M, M);
   N_VAddConst(M, -ONE, M);
   N_VScale(r, M, M);
@@ -27,6 +27,7 @@
 #include "cvode_proj_impl.h"
 #include "sundials_logger_impl.h"
 #include "sundials_macros.h"
+#include "sundials_reducebatch.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -212,6 +213,9 @@ typedef struct CVodeMemRec
   sunbooleantype cv_user_efun; /* SUNTRUE if user sets efun                     */
   CVEwtFn cv_efun; /* function to set ewt                           */
   void* cv_e_data; /* user pointer passed to efun                   */
+  sunReduceBatch* cv_ewt_batch; /* if not NULL, the positivity test of ewt
+                                   is added to this batch                     */
+  sunrealtype cv_ewt_min;       /* min of the tolerance vector in the test    */
 
   sunbooleantype cv_constraintsSet; /* constraints vector present:
                                     do constraints calc                       */
@@ -409,6 +413,7 @@ typedef struct CVodeMemRec
     -------------------------------------------*/
   CVMonitorFn cv_monitorfun;    /* func called with CVODE mem and user data  */
   long int cv_monitor_interval; /* step interval to call cv_monitorfun       */
+  SUNStepStats cv_stepstats;    /* per-step statistics stream (not owned)    */
 
   /*-------------------------
     Stability Limit Detection
@@ -465,6 +470,12 @@ typedef struct CVodeMemRec
 
   sunbooleantype first_step_after_resize; /* Flag to signal a resize happened */
 
+  /*-------------
+    Saved State
+    -------------*/
+
+  sunbooleantype first_step_after_load; /* Flag to signal a state was loaded */
+
 }* CVodeMem;
 
 /*
@@ -614,6 +625,10 @@ int cvEwtSet(N_Vector ycur, N_Vector weight, void* data);
 void cvProcessError(CVodeMem cv_mem, int error_code, int line, const char* func,
                     const char* file, const char* msgfmt, ...);
 
+/* Initial setup */
+
+int cvInitialSetup(CVodeMem cv_mem);
+
 /* Nonlinear solver initialization */
 
 int cvNlsInit(CVodeMem cv_mem);
@@ -730,6 +745,7 @@ int cvDiagSolve_updateM(const sunrealtype r, N_Vector M);
 #define MSGCV_MAX_STEPS \
   "At " MSG_TIME ", mxstep steps taken before reaching tout."
 #define MSGCV_TOO_MUCH_ACC "At " MSG_TIME ", too much accuracy requested."
+#define MSGCV_VECTOROP_ERR "At " MSG_TIME ", a vector operation failed."
 #define MSGCV_HNIL                                                         \
   "Internal " MSG_TIME_H " are such that t + h = t on the next step. The " \
   "solver will continue anyway."
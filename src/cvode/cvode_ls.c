@@ -20,6 +20,7 @@
 #include <string.h>
 #include <sundials/sundials_math.h>
 #include <sunmatrix/sunmatrix_band.h>
+#include <sunmatrix/sunmatrix_blockdense.h>
 #include <sunmatrix/sunmatrix_dense.h>
 #include <sunmatrix/sunmatrix_sparse.h>
 
@@ -320,6 +321,72 @@ int CVodeSetJacFn(void* cvode_mem, CVLsJacFn jac)
   return (CVLS_SUCCESS);
 }
 
+/* CVodeSetJacSparsity specifies the nonzero pattern used by the
+ * difference quotient Jacobian with a sparse SUNMatrix. The pattern is
+ * copied from S, whose values are not used, and a NULL S removes it. */
+int CVodeSetJacSparsity(void* cvode_mem, SUNMatrix S)
+{
+  CVodeMem cv_mem;
+  CVLsMem cvls_mem;
+  sunSparseDQ sparseDQ;
+  int retval;
+
+  /* access CVLsMem structure */
+  retval = cvLs_AccessLMem(cvode_mem, __func__, &cv_mem, &cvls_mem);
+  if (retval != CVLS_SUCCESS) { return (retval); }
+
+  if (S == NULL)
+  {
+    sunSparseDQ_Destroy(&cvls_mem->sparseDQ);
+    return (CVLS_SUCCESS);
+  }
+
+  if (S->ops->getid == NULL || SUNMatGetID(S) != SUNMATRIX_SPARSE)
+  {
+    cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "The sparsity pattern must be a sparse SUNMatrix");
+    return (CVLS_ILL_INPUT);
+  }
+
+  /* compute the column groups for the new pattern */
+  retval = sunSparseDQ_Create(S, &sparseDQ);
+  if (retval == SUN_ERR_MALLOC_FAIL)
+  {
+    cvProcessError(cv_mem, CVLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   MSG_LS_MEM_FAIL);
+    return (CVLS_MEM_FAIL);
+  }
+  if (retval)
+  {
+    cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "The sparsity pattern is not square or is malformed");
+    return (CVLS_ILL_INPUT);
+  }
+
+  sunSparseDQ_Destroy(&cvls_mem->sparseDQ);
+  cvls_mem->sparseDQ = sparseDQ;
+
+  return (CVLS_SUCCESS);
+}
+
+/* CVodeSetJacSparsityDetection enables or disables detecting the
+ * nonzero pattern for the sparse difference quotient Jacobian when
+ * no pattern is given. The pattern is detected at initialization. */
+int CVodeSetJacSparsityDetection(void* cvode_mem, sunbooleantype onoff)
+{
+  CVodeMem cv_mem;
+  CVLsMem cvls_mem;
+  int retval;
+
+  /* access CVLsMem structure */
+  retval = cvLs_AccessLMem(cvode_mem, __func__, &cv_mem, &cvls_mem);
+  if (retval != CVLS_SUCCESS) { return (retval); }
+
+  cvls_mem->detect_sparsity = onoff;
+
+  return (CVLS_SUCCESS);
+}
+
 /* CVodeSetDeltaGammaMaxBadJac specifies the maximum gamma ratio change
  * after a NLS convergence failure with a potentially bad Jacobian. If
  * |gamma/gammap-1| < dgmax_jbad then the Jacobian is marked as bad */
@@ -972,7 +1039,7 @@ int cvLsPSolve(void* cvode_mem, N_Vector r, N_Vector z, sunrealtype tol, int lr)
 /*-----------------------------------------------------------------
   cvLsDQJac
 
-  This routine is a wrapper for the Dense and Band
+  This routine is a wrapper for the Dense, Band, and Sparse
   implementations of the difference quotient Jacobian
   approximation routines.
   ---------------------------------------------------------------*/
@@ -1023,6 +1090,14 @@ int cvLsDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   {
     retval = cvLsBandDQJac(t, y, fy, Jac, cv_mem, tmp1, tmp2);
   }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_BLOCKDENSE)
+  {
+    retval = cvLsBlockDenseDQJac(t, y, fy, Jac, cv_mem, tmp1, tmp2);
+  }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_SPARSE)
+  {
+    retval = cvLsSparseDQJac(t, y, fy, Jac, cv_mem, tmp1, tmp2);
+  }
   else
   {
     cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
@@ -1252,6 +1327,379 @@ int cvLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   return (retval);
 }
 
+/*-----------------------------------------------------------------
+  cvLsBlockDenseDQJac
+
+  This routine generates a block-diagonal dense difference quotient
+  approximation to the Jacobian of f(t,y). It assumes that the
+  blocks of a SUNMATRIX_BLOCKDENSE matrix are interleaved, so that
+  component i of block k is y[i * nblocks + k]. As the blocks are
+  uncoupled, column j of all blocks is perturbed at once and the
+  Jacobian requires one evaluation of f per block column.
+  -----------------------------------------------------------------*/
+int cvLsBlockDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                        CVodeMem cv_mem, N_Vector tmp1, N_Vector tmp2)
+{
+  N_Vector ftemp, ytemp;
+  sunrealtype fnorm, minInc, inc, inc_inv, srur, conj;
+  sunrealtype *ewt_data, *fy_data, *ftemp_data, *y_data, *ytemp_data;
+  sunrealtype* cns_data;
+  sunindextype i, j, k, jk, M, nblocks;
+  CVLsMem cvls_mem;
+  int retval = 0;
+
+  /* initialize cns_data to avoid compiler warning */
+  cns_data = NULL;
+
+  /* access LsMem interface structure */
+  cvls_mem = (CVLsMem)cv_mem->cv_lmem;
+
+  /* access matrix dimensions */
+  M       = SUNBlockDenseMatrix_BlockColumns(Jac);
+  nblocks = SUNBlockDenseMatrix_NumBlocks(Jac);
+
+  /* Rename work vectors for use as temporary values of y and f */
+  ftemp = tmp1;
+  ytemp = tmp2;
+
+  /* Obtain pointers to the data for ewt, fy, ftemp, y, ytemp */
+  ewt_data   = N_VGetArrayPointer(cv_mem->cv_ewt);
+  fy_data    = N_VGetArrayPointer(fy);
+  ftemp_data = N_VGetArrayPointer(ftemp);
+  y_data     = N_VGetArrayPointer(y);
+  ytemp_data = N_VGetArrayPointer(ytemp);
+  if (cv_mem->cv_constraintsSet)
+  {
+    cns_data = N_VGetArrayPointer(cv_mem->cv_constraints);
+  }
+
+  /* Load ytemp with y = predicted y vector */
+  N_VScale(ONE, y, ytemp);
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(cv_mem->cv_uround);
+  fnorm  = N_VWrmsNorm(fy, cv_mem->cv_ewt);
+  minInc = (fnorm != ZERO) ? (MIN_INC_MULT * SUNRabs(cv_mem->cv_h) *
+                              cv_mem->cv_uround * M * nblocks * fnorm)
+                           : ONE;
+
+  /* Loop over block columns */
+  for (j = 0; j < M; j++)
+  {
+    /* Increment y_j of all blocks */
+    for (k = 0; k < nblocks; k++)
+    {
+      jk  = j * nblocks + k;
+      inc = SUNMAX(srur * SUNRabs(y_data[jk]), minInc / ewt_data[jk]);
+
+      /* Adjust sign(inc) if yj has an inequality constraint. */
+      if (cv_mem->cv_constraintsSet)
+      {
+        conj = cns_data[jk];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[jk] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[jk] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      ytemp_data[jk] += inc;
+    }
+
+    /* Evaluate f with incremented y */
+    retval = cv_mem->cv_f(t, ytemp, ftemp, cv_mem->cv_user_data);
+    cvls_mem->nfeDQ++;
+    if (retval != 0) { break; }
+
+    /* Restore ytemp, then form and load difference quotients */
+    for (k = 0; k < nblocks; k++)
+    {
+      jk             = j * nblocks + k;
+      ytemp_data[jk] = y_data[jk];
+
+      inc = SUNMAX(srur * SUNRabs(y_data[jk]), minInc / ewt_data[jk]);
+
+      /* Adjust sign(inc) as before. */
+      if (cv_mem->cv_constraintsSet)
+      {
+        conj = cns_data[jk];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[jk] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[jk] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      inc_inv = ONE / inc;
+      for (i = 0; i < M; i++)
+      {
+        SM_ELEMENT_BD(Jac, k, i, j) =
+          inc_inv * (ftemp_data[i * nblocks + k] - fy_data[i * nblocks + k]);
+      }
+    }
+  }
+
+  return (retval);
+}
+
+/*-----------------------------------------------------------------
+  cvLsSparseDQJac
+
+  This routine generates a sparse difference quotient approximation
+  to the Jacobian of f(t,y) with the nonzero pattern given to
+  CVodeSetJacSparsity. The columns are split into groups that do not
+  share a row, so the columns in a group are perturbed together and
+  each group needs a single call to f. The pattern is written into
+  Jac, which may be a CSC or CSR matrix, before its entries are set.
+  -----------------------------------------------------------------*/
+int cvLsSparseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                    CVodeMem cv_mem, N_Vector tmp1, N_Vector tmp2)
+{
+  N_Vector ftemp, ytemp;
+  sunrealtype fnorm, minInc, inc, inc_inv, srur, conj;
+  sunrealtype *J_data, *ewt_data, *fy_data, *ftemp_data;
+  sunrealtype *y_data, *ytemp_data, *cns_data;
+  sunindextype color, i, j, k, p, q, N;
+  sunSparseDQ sdq;
+  CVLsMem cvls_mem;
+  int retval = 0;
+
+  /* initialize cns_data to avoid compiler warning */
+  cns_data = NULL;
+
+  /* access LsMem interface structure */
+  cvls_mem = (CVLsMem)cv_mem->cv_lmem;
+  sdq      = cvls_mem->sparseDQ;
+
+  /* verify that the pattern matches the matrix */
+  if (sdq == NULL || !sunSparseDQ_Compatible(sdq, Jac))
+  {
+    cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "The sparsity pattern does not match the SUNMatrix");
+    return (CVLS_ILL_INPUT);
+  }
+
+  /* write the pattern into Jac */
+  if (sunSparseDQ_SetPattern(sdq, Jac))
+  {
+    cvProcessError(cv_mem, CVLS_SUNMAT_FAIL, __LINE__, __func__, __FILE__,
+                   MSG_LS_SUNMAT_FAILED);
+    return (CVLS_SUNMAT_FAIL);
+  }
+
+  /* access matrix dimension and data */
+  N      = SUNSparseMatrix_Columns(Jac);
+  J_data = SUNSparseMatrix_Data(Jac);
+
+  /* Rename work vectors for use as temporary values of y and f */
+  ftemp = tmp1;
+  ytemp = tmp2;
+
+  /* Obtain pointers to the data for ewt, fy, ftemp, y, ytemp */
+  ewt_data   = N_VGetArrayPointer(cv_mem->cv_ewt);
+  fy_data    = N_VGetArrayPointer(fy);
+  ftemp_data = N_VGetArrayPointer(ftemp);
+  y_data     = N_VGetArrayPointer(y);
+  ytemp_data = N_VGetArrayPointer(ytemp);
+  if (cv_mem->cv_constraintsSet)
+  {
+    cns_data = N_VGetArrayPointer(cv_mem->cv_constraints);
+  }
+
+  /* Load ytemp with y = predicted y vector */
+  N_VScale(ONE, y, ytemp);
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(cv_mem->cv_uround);
+  fnorm  = N_VWrmsNorm(fy, cv_mem->cv_ewt);
+  minInc = (fnorm != ZERO) ? (MIN_INC_MULT * SUNRabs(cv_mem->cv_h) *
+                              cv_mem->cv_uround * N * fnorm)
+                           : ONE;
+
+  /* Loop over column groups. */
+  for (color = 0; color < sdq->ncolors; color++)
+  {
+    /* Increment all y_j in group */
+    for (k = sdq->colorptrs[color]; k < sdq->colorptrs[color + 1]; k++)
+    {
+      j   = sdq->colorcols[k];
+      inc = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+      /* Adjust sign(inc) if yj has an inequality constraint. */
+      if (cv_mem->cv_constraintsSet)
+      {
+        conj = cns_data[j];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[j] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      ytemp_data[j] += inc;
+    }
+
+    /* Evaluate f with incremented y */
+    retval = cv_mem->cv_f(t, ytemp, ftemp, cv_mem->cv_user_data);
+    cvls_mem->nfeDQ++;
+    if (retval != 0) { break; }
+
+    /* Restore ytemp, then form and load difference quotients */
+    for (k = sdq->colorptrs[color]; k < sdq->colorptrs[color + 1]; k++)
+    {
+      j             = sdq->colorcols[k];
+      ytemp_data[j] = y_data[j];
+      inc           = SUNMAX(srur * SUNRabs(y_data[j]), minInc / ewt_data[j]);
+
+      /* Adjust sign(inc) as before. */
+      if (cv_mem->cv_constraintsSet)
+      {
+        conj = cns_data[j];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((ytemp_data[j] + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((ytemp_data[j] + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      inc_inv = ONE / inc;
+      for (p = sdq->colptrs[j]; p < sdq->colptrs[j + 1]; p++)
+      {
+        i         = sdq->rowvals[p];
+        q         = sunSparseDQ_Position(sdq, Jac, p);
+        J_data[q] = inc_inv * (ftemp_data[i] - fy_data[i]);
+      }
+    }
+  }
+
+  return (retval);
+}
+
+/*-----------------------------------------------------------------
+  cvLsDetectSparsity
+
+  This routine detects the nonzero pattern of the Jacobian of f(t,y)
+  at the initial condition for the sparse difference quotient
+  Jacobian. Each y_j is set to NaN and then perturbed by a random
+  amount, and the rows of f that become NaN or change are taken as
+  the nonzeros of column j. The NaN probe finds dependencies that
+  vanish at the initial condition while the random probe finds
+  those hidden from NaN propagation, e.g., by min or max functions.
+  This requires 2N+1 calls to f, which are counted in nfeDQ.
+  -----------------------------------------------------------------*/
+int cvLsDetectSparsity(CVodeMem cv_mem)
+{
+  N_Vector ytemp, f0, fnan, fpert;
+  sunrealtype *y_data, *ytemp_data, *f0_data, *fnan_data, *fpert_data;
+  sunrealtype t;
+  sunindextype j, N;
+  unsigned long state = 1;
+  SUNMatrix P;
+  CVLsMem cvls_mem;
+  int retval, nanretval, fretval;
+
+  /* access LsMem interface structure */
+  cvls_mem = (CVLsMem)cv_mem->cv_lmem;
+
+  /* create the pattern matrix and work vectors */
+  N     = SUNSparseMatrix_Columns(cvls_mem->A);
+  P     = SUNSparseMatrix(N, N, SUNMAX(N, 1), CSC_MAT, cv_mem->cv_sunctx);
+  ytemp = N_VClone(cv_mem->cv_ewt);
+  f0    = N_VClone(cv_mem->cv_ewt);
+  fnan  = N_VClone(cv_mem->cv_ewt);
+  fpert = N_VClone(cv_mem->cv_ewt);
+
+  retval = CVLS_SUCCESS;
+  if (P == NULL || ytemp == NULL || f0 == NULL || fnan == NULL || fpert == NULL)
+  {
+    retval = CVLS_MEM_FAIL;
+  }
+
+  /* evaluate f at the initial condition */
+  t       = cv_mem->cv_tn;
+  fretval = 0;
+  if (retval == CVLS_SUCCESS)
+  {
+    N_VScale(ONE, cv_mem->cv_zn[0], ytemp);
+    fretval = cv_mem->cv_f(t, ytemp, f0, cv_mem->cv_user_data);
+    cvls_mem->nfeDQ++;
+  }
+
+  if (retval == CVLS_SUCCESS && fretval == 0)
+  {
+    y_data     = N_VGetArrayPointer(cv_mem->cv_zn[0]);
+    ytemp_data = N_VGetArrayPointer(ytemp);
+    f0_data    = N_VGetArrayPointer(f0);
+    fnan_data  = N_VGetArrayPointer(fnan);
+    fpert_data = N_VGetArrayPointer(fpert);
+
+    for (j = 0; j < N; j++)
+    {
+      /* Probe with y_j = NaN, a failure of f only skips this probe */
+      ytemp_data[j] = NAN;
+      nanretval     = cv_mem->cv_f(t, ytemp, fnan, cv_mem->cv_user_data);
+      cvls_mem->nfeDQ++;
+
+      /* Probe with a random perturbation of y_j */
+      ytemp_data[j] = y_data[j] + sunSparseDQ_ProbeIncrement(y_data[j], &state);
+      fretval       = cv_mem->cv_f(t, ytemp, fpert, cv_mem->cv_user_data);
+      cvls_mem->nfeDQ++;
+      if (fretval != 0) { break; }
+
+      ytemp_data[j] = y_data[j];
+
+      /* Add the rows that became NaN or changed to column j */
+      if (sunSparseDQ_DetectColumn(P, j, f0_data,
+                                   (nanretval == 0) ? fnan_data : NULL,
+                                   fpert_data))
+      {
+        retval = CVLS_MEM_FAIL;
+        break;
+      }
+    }
+  }
+
+  /* compute the column groups for the detected pattern */
+  if (retval == CVLS_SUCCESS && fretval == 0)
+  {
+    sunSparseDQ_Destroy(&cvls_mem->sparseDQ);
+    if (sunSparseDQ_Create(P, &cvls_mem->sparseDQ)) { retval = CVLS_MEM_FAIL; }
+  }
+
+  if (retval == CVLS_MEM_FAIL)
+  {
+    cvProcessError(cv_mem, CVLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   MSG_LS_MEM_FAIL);
+  }
+  else if (fretval != 0)
+  {
+    cvProcessError(cv_mem, CVLS_JACFUNC_UNRECVR, __LINE__, __func__, __FILE__,
+                   "The right-hand side routine failed while detecting the "
+                   "Jacobian sparsity pattern");
+    retval = CVLS_JACFUNC_UNRECVR;
+  }
+
+  N_VDestroy(fpert);
+  N_VDestroy(fnan);
+  N_VDestroy(f0);
+  N_VDestroy(ytemp);
+  if (P) { SUNMatDestroy(P); }
+
+  return (retval);
+}
+
 /*-----------------------------------------------------------------
   cvLsDQJtimes
 
@@ -1431,12 +1879,18 @@ int cvLsInitialize(CVodeMem cv_mem)
       if (cvls_mem->jacDQ)
       {
         /* Internal difference quotient Jacobian. Check that A is dense or band,
-           otherwise return an error */
+           or sparse with a matching or detected sparsity pattern, otherwise
+           return an error */
         retval = 0;
         if (cvls_mem->A->ops->getid)
         {
           if ((SUNMatGetID(cvls_mem->A) == SUNMATRIX_DENSE) ||
-              (SUNMatGetID(cvls_mem->A) == SUNMATRIX_BAND))
+              (SUNMatGetID(cvls_mem->A) == SUNMATRIX_BAND) ||
+              (SUNMatGetID(cvls_mem->A) == SUNMATRIX_BLOCKDENSE) ||
+              (cvls_mem->sparseDQ &&
+               sunSparseDQ_Compatible(cvls_mem->sparseDQ, cvls_mem->A)) ||
+              (cvls_mem->detect_sparsity &&
+               SUNMatGetID(cvls_mem->A) == SUNMATRIX_SPARSE))
           {
             cvls_mem->jac    = cvLsDQJac;
             cvls_mem->J_data = cv_mem;
@@ -1488,6 +1942,20 @@ int cvLsInitialize(CVodeMem cv_mem)
   /* reset counters */
   cvLsInitializeCounters(cvls_mem);
 
+  /* Detect the sparsity pattern for the DQ Jacobian if it is not known */
+  if (cvls_mem->jacDQ && !cvls_mem->user_linsys && cvls_mem->detect_sparsity &&
+      SUNMatGetID(cvls_mem->A) == SUNMATRIX_SPARSE &&
+      !(cvls_mem->sparseDQ &&
+        sunSparseDQ_Compatible(cvls_mem->sparseDQ, cvls_mem->A)))
+  {
+    retval = cvLsDetectSparsity(cv_mem);
+    if (retval != CVLS_SUCCESS)
+    {
+      cvls_mem->last_flag = retval;
+      return (retval);
+    }
+  }
+
   /* Set Jacobian-vector product related fields, based on jtimesDQ */
   if (cvls_mem->jtimesDQ)
   {
@@ -1561,6 +2029,7 @@ int cvLsSetup(CVodeMem cv_mem, int convfail, N_Vector ypred, N_Vector fpred,
   /* Use nst, gamma/gammap, and convfail to set J/P eval. flag jok */
   dgamma         = SUNRabs((cv_mem->cv_gamma / cv_mem->cv_gammap) - ONE);
   cvls_mem->jbad = (cv_mem->cv_nst == 0) || (cv_mem->first_step_after_resize) ||
+                   (cv_mem->first_step_after_load) ||
                    (cv_mem->cv_nst >= cvls_mem->nstlj + cvls_mem->msbj) ||
                    ((convfail == CV_FAIL_BAD_J) &&
                     (dgamma < cvls_mem->dgmax_jbad)) ||
@@ -1880,6 +2349,9 @@ int cvLsFree(CVodeMem cv_mem)
     cvls_mem->savedJ = NULL;
   }
 
+  /* Free sparse DQ Jacobian memory */
+  sunSparseDQ_Destroy(&cvls_mem->sparseDQ);
+
   /* Nullify other N_Vector pointers */
   cvls_mem->ycur = NULL;
   cvls_mem->fcur = NULL;
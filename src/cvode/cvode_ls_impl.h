@@ -21,6 +21,7 @@
 #include <cvode/cvode_ls.h>
 
 #include "cvode_impl.h"
+#include "sundials_sparsedq.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -59,6 +60,10 @@ typedef struct CVLsMemRec
   sunbooleantype jbad;    /* heuristic suggestion for pset                */
   sunrealtype dgmax_jbad; /* if convfail = FAIL_BAD_J and the gamma ratio *
                         * |gamma/gammap-1| < dgmax_jbad then J is bad  */
+  sunSparseDQ sparseDQ;   /* column groups for a sparse DQ Jacobian       */
+
+  /* Detect the sparsity pattern for the DQ Jacobian if it is not given */
+  sunbooleantype detect_sparsity;
 
   /* Matrix-based solver, scale solution to account for change in gamma */
   sunbooleantype scalesol;
@@ -150,6 +155,11 @@ int cvLsDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
                    CVodeMem cv_mem, N_Vector tmp1);
 int cvLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
                   CVodeMem cv_mem, N_Vector tmp1, N_Vector tmp2);
+int cvLsBlockDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                        CVodeMem cv_mem, N_Vector tmp1, N_Vector tmp2);
+int cvLsSparseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
+                    CVodeMem cv_mem, N_Vector tmp1, N_Vector tmp2);
+int cvLsDetectSparsity(CVodeMem cv_mem);
 
 /* Generic linit/lsetup/lsolve/lfree interface routines for CVode to call */
 int cvLsInitialize(CVodeMem cv_mem);
@@ -0,0 +1,319 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Save and load the integrator state for restarting a run
+ * ---------------------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <sundials/sundials_types.h>
+
+#include "cvode/cvode.h"
+#include "cvode_impl.h"
+#include "cvode_ls_impl.h"
+#include "sundials_statebuffer.h"
+
+#define ITEM(sb, x) sunStateBuffer_Item(sb, &(x), sizeof(x))
+
+/* -----------------------------------------------------------------------------
+ * Describe the state as a sequence of buffer items
+ * ---------------------------------------------------------------------------*/
+
+/* Method, step and history data. The data needed to interpret the rest of the
+   buffer comes first so a mismatched buffer is detected before anything is
+   loaded into the vectors. */
+static int cvStateMain(CVodeMem cv_mem, sunStateBuffer* sb)
+{
+  int has_ls = (cv_mem->cv_linit == cvLsInitialize);
+  int i;
+
+  sunStateBuffer_Header(sb, "CVODE");
+  sunStateBuffer_Check(sb, &cv_mem->cv_lmm, sizeof(int));
+  sunStateBuffer_Check(sb, &cv_mem->cv_qmax, sizeof(int));
+  sunStateBuffer_Check(sb, &cv_mem->cv_nrtfn, sizeof(int));
+  sunStateBuffer_Check(sb, &has_ls, sizeof(int));
+
+  /* counters */
+  ITEM(sb, cv_mem->cv_nst);
+  ITEM(sb, cv_mem->cv_nfe);
+  ITEM(sb, cv_mem->cv_ncfn);
+  ITEM(sb, cv_mem->cv_nni);
+  ITEM(sb, cv_mem->cv_nnf);
+  ITEM(sb, cv_mem->cv_netf);
+  ITEM(sb, cv_mem->cv_nsetups);
+  ITEM(sb, cv_mem->cv_nhnil);
+  ITEM(sb, cv_mem->cv_nstlp);
+  ITEM(sb, cv_mem->cv_nscon);
+  ITEM(sb, cv_mem->cv_nor);
+
+  /* order and step size */
+  ITEM(sb, cv_mem->cv_q);
+  ITEM(sb, cv_mem->cv_qprime);
+  ITEM(sb, cv_mem->cv_next_q);
+  ITEM(sb, cv_mem->cv_qwait);
+  ITEM(sb, cv_mem->cv_L);
+  ITEM(sb, cv_mem->cv_qu);
+  ITEM(sb, cv_mem->cv_indx_acor);
+  ITEM(sb, cv_mem->cv_h);
+  ITEM(sb, cv_mem->cv_hprime);
+  ITEM(sb, cv_mem->cv_next_h);
+  ITEM(sb, cv_mem->cv_eta);
+  ITEM(sb, cv_mem->cv_hscale);
+  ITEM(sb, cv_mem->cv_tn);
+  ITEM(sb, cv_mem->cv_tretlast);
+  ITEM(sb, cv_mem->cv_h0u);
+  ITEM(sb, cv_mem->cv_hu);
+  ITEM(sb, cv_mem->cv_etamax);
+  ITEM(sb, cv_mem->cv_etaqm1);
+  ITEM(sb, cv_mem->cv_etaq);
+  ITEM(sb, cv_mem->cv_etaqp1);
+
+  /* method coefficients and error test data */
+  ITEM(sb, cv_mem->cv_tau);
+  ITEM(sb, cv_mem->cv_tq);
+  ITEM(sb, cv_mem->cv_l);
+  ITEM(sb, cv_mem->cv_rl1);
+  ITEM(sb, cv_mem->cv_gamma);
+  ITEM(sb, cv_mem->cv_gammap);
+  ITEM(sb, cv_mem->cv_gamrat);
+  ITEM(sb, cv_mem->cv_saved_tq5);
+  ITEM(sb, cv_mem->cv_tolsf);
+
+  /* nonlinear solver data */
+  ITEM(sb, cv_mem->cv_crate);
+  ITEM(sb, cv_mem->cv_delp);
+  ITEM(sb, cv_mem->cv_acnrm);
+  ITEM(sb, cv_mem->cv_acnrmcur);
+  ITEM(sb, cv_mem->cv_jcur);
+
+  /* stability limit detection data */
+  ITEM(sb, cv_mem->cv_ssdat);
+
+  /* rootfinding data */
+  if (cv_mem->cv_nrtfn > 0)
+  {
+    size_t nrtfn = (size_t)cv_mem->cv_nrtfn;
+
+    ITEM(sb, cv_mem->cv_nge);
+    ITEM(sb, cv_mem->cv_tlo);
+    ITEM(sb, cv_mem->cv_thi);
+    ITEM(sb, cv_mem->cv_trout);
+    ITEM(sb, cv_mem->cv_toutc);
+    ITEM(sb, cv_mem->cv_ttol);
+    ITEM(sb, cv_mem->cv_taskc);
+    ITEM(sb, cv_mem->cv_irfnd);
+    sunStateBuffer_Item(sb, cv_mem->cv_glo, nrtfn * sizeof(sunrealtype));
+    sunStateBuffer_Item(sb, cv_mem->cv_ghi, nrtfn * sizeof(sunrealtype));
+    sunStateBuffer_Item(sb, cv_mem->cv_grout, nrtfn * sizeof(sunrealtype));
+    sunStateBuffer_Item(sb, cv_mem->cv_iroots, nrtfn * sizeof(int));
+    sunStateBuffer_Item(sb, cv_mem->cv_gactive, nrtfn * sizeof(sunbooleantype));
+  }
+
+  /* Nordsieck history array, including the saved correction in zn[qmax] */
+  for (i = 0; i <= cv_mem->cv_qmax; i++)
+  {
+    if (sunStateBuffer_Vector(sb, cv_mem->cv_zn[i])) { return CV_VECTOROP_ERR; }
+  }
+
+  return CV_SUCCESS;
+}
+
+/* Linear solver interface counters */
+static void cvStateLs(CVodeMem cv_mem, sunStateBuffer* sb)
+{
+  CVLsMem cvls_mem;
+
+  if (cv_mem->cv_linit != cvLsInitialize) { return; }
+  cvls_mem = (CVLsMem)cv_mem->cv_lmem;
+
+  ITEM(sb, cvls_mem->nje);
+  ITEM(sb, cvls_mem->nfeDQ);
+  ITEM(sb, cvls_mem->nstlj);
+  ITEM(sb, cvls_mem->npe);
+  ITEM(sb, cvls_mem->nli);
+  ITEM(sb, cvls_mem->nps);
+  ITEM(sb, cvls_mem->ncfl);
+  ITEM(sb, cvls_mem->njtsetup);
+  ITEM(sb, cvls_mem->njtimes);
+}
+
+static int cvStateAll(CVodeMem cv_mem, sunStateBuffer* sb)
+{
+  int retval = cvStateMain(cv_mem, sb);
+  if (retval != CV_SUCCESS) { return retval; }
+  cvStateLs(cv_mem, sb);
+  return CV_SUCCESS;
+}
+
+/* Checks the inputs shared by the state functions */
+static int cvStateCheckMem(void* cvode_mem, const char* func, CVodeMem* cv_mem)
+{
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, func, __FILE__, MSGCV_NO_MEM);
+    return CV_MEM_NULL;
+  }
+  *cv_mem = (CVodeMem)cvode_mem;
+
+  if (!(*cv_mem)->cv_MallocDone)
+  {
+    cvProcessError(*cv_mem, CV_NO_MALLOC, __LINE__, func, __FILE__,
+                   MSGCV_NO_MALLOC);
+    return CV_NO_MALLOC;
+  }
+
+  return CV_SUCCESS;
+}
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+int CVodeGetStateSize(void* cvode_mem, size_t* bytes)
+{
+  CVodeMem cv_mem;
+  sunStateBuffer sb;
+  int retval;
+
+  retval = cvStateCheckMem(cvode_mem, __func__, &cv_mem);
+  if (retval != CV_SUCCESS) { return retval; }
+
+  if (bytes == NULL)
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "bytes = NULL illegal.");
+    return CV_ILL_INPUT;
+  }
+
+  sunStateBuffer_Init(&sb, NULL, 0, SUNFALSE);
+  retval = cvStateAll(cv_mem, &sb);
+  if (retval != CV_SUCCESS)
+  {
+    cvProcessError(cv_mem, retval, __LINE__, __func__, __FILE__,
+                   "A vector operation failed");
+    return retval;
+  }
+
+  *bytes = sb.pos;
+  return CV_SUCCESS;
+}
+
+int CVodeSaveState(void* cvode_mem, void* buffer, size_t bytes)
+{
+  CVodeMem cv_mem;
+  sunStateBuffer sb;
+  int retval;
+
+  retval = cvStateCheckMem(cvode_mem, __func__, &cv_mem);
+  if (retval != CV_SUCCESS) { return retval; }
+
+  if (buffer == NULL)
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "buffer = NULL illegal.");
+    return CV_ILL_INPUT;
+  }
+
+  sunStateBuffer_Init(&sb, buffer, bytes, SUNFALSE);
+  retval = cvStateAll(cv_mem, &sb);
+  if (retval != CV_SUCCESS)
+  {
+    cvProcessError(cv_mem, retval, __LINE__, __func__, __FILE__,
+                   "A vector operation failed");
+    return retval;
+  }
+
+  if (sb.invalid)
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "The buffer is too small to hold the state");
+    return CV_ILL_INPUT;
+  }
+
+  return CV_SUCCESS;
+}
+
+int CVodeLoadState(void* cvode_mem, const void* buffer, size_t bytes)
+{
+  CVodeMem cv_mem;
+  sunStateBuffer sb;
+  size_t state_bytes = 0;
+  void* backup       = NULL;
+  int retval;
+
+  retval = CVodeGetStateSize(cvode_mem, &state_bytes);
+  if (retval != CV_SUCCESS) { return retval; }
+  cv_mem = (CVodeMem)cvode_mem;
+
+  if (buffer == NULL)
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "buffer = NULL illegal.");
+    return CV_ILL_INPUT;
+  }
+
+  if (bytes != state_bytes)
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "The buffer size does not match the state of this problem");
+    return CV_ILL_INPUT;
+  }
+
+  /* Keep the current state to restore it if the buffer does not match */
+  backup = malloc(state_bytes);
+  if (backup == NULL)
+  {
+    cvProcessError(cv_mem, CV_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   MSGCV_MEM_FAIL);
+    return CV_MEM_FAIL;
+  }
+
+  retval = CVodeSaveState(cvode_mem, backup, state_bytes);
+  if (retval != CV_SUCCESS)
+  {
+    free(backup);
+    return retval;
+  }
+
+  sunStateBuffer_InitLoad(&sb, buffer, bytes);
+  retval = cvStateMain(cv_mem, &sb);
+
+  if (retval == CV_SUCCESS && sb.invalid)
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "The buffer does not hold a state of this problem");
+    retval = CV_ILL_INPUT;
+  }
+
+  /* CVode only performs the initial setup on the first step, do it here for a
+     state past the first step. This also resets the linear solver counters, so
+     they are loaded afterwards. */
+  if (retval == CV_SUCCESS && cv_mem->cv_nst > 0)
+  {
+    retval = cvInitialSetup(cv_mem);
+  }
+
+  if (retval == CV_SUCCESS) { cvStateLs(cv_mem, &sb); }
+
+  if (retval != CV_SUCCESS)
+  {
+    sunStateBuffer_Init(&sb, backup, state_bytes, SUNTRUE);
+    (void)cvStateAll(cv_mem, &sb);
+    free(backup);
+    return retval;
+  }
+
+  free(backup);
+
+  /* The Jacobian is not part of the state, evaluate it on the next step */
+  cv_mem->first_step_after_load = (cv_mem->cv_nst > 0);
+
+  return CV_SUCCESS;
+}
@@ -142,8 +142,7 @@
  *      cvCompleteStep
  *      cvPrepareNextStep
  *      cvSetEta
- *      cvComputeEtaqm1
- *      cvComputeEtaqp1
+ *      cvComputeEtaqm1qp1
  *      cvChooseEta
  *
  *   Function to handle failures
@@ -195,6 +194,7 @@
 #include "cvodes_impl.h"
 #include "sundials/priv/sundials_errors_impl.h"
 #include "sundials/sundials_context.h"
+#include "sundials_reducebatch.h"
 
 /*=================================================================*/
 /* CVODE Private Constants                                         */
@@ -403,8 +403,7 @@ static int cvDoErrorTest(CVodeMem cv_mem, int* nflagPtr, sunrealtype saved_t,
 static void cvCompleteStep(CVodeMem cv_mem);
 static void cvPrepareNextStep(CVodeMem cv_mem, sunrealtype dsm);
 static void cvSetEta(CVodeMem cv_mem);
-static sunrealtype cvComputeEtaqm1(CVodeMem cv_mem);
-static sunrealtype cvComputeEtaqp1(CVodeMem cv_mem);
+static void cvComputeEtaqm1qp1(CVodeMem cv_mem);
 static void cvChooseEta(CVodeMem cv_mem);
 
 /* Function to handle failures */
@@ -514,6 +513,7 @@ void* CVodeCreate(int lmm, SUNContext sunctx)
   cv_mem->cv_e_data           = NULL;
   cv_mem->cv_monitorfun       = NULL;
   cv_mem->cv_monitor_interval = 0;
+  cv_mem->cv_stepstats        = NULL;
   cv_mem->cv_qmax             = maxord;
   cv_mem->cv_mxstep           = MXSTEP_DEFAULT;
   cv_mem->cv_mxhnil           = MXHNIL_DEFAULT;
@@ -960,6 +960,12 @@ int CVodeReInit(void* cvode_mem, sunrealtype t0, N_Vector y0)
   cv_mem->cv_nscon   = 0;
   cv_mem->cv_nge     = 0;
 
+  /* Counts in the statistics stream restart from zero */
+  if (cv_mem->cv_stepstats != NULL)
+  {
+    (void)SUNStepStats_SetBaseline(cv_mem->cv_stepstats, 0, 0, 0, 0);
+  }
+
   cv_mem->cv_irfnd = 0;
 
   /* Initialize other integrator optional outputs */
@@ -3863,6 +3869,131 @@ int CVodeGetDky(void* cvode_mem, sunrealtype t, int k, N_Vector dky)
   return (CV_SUCCESS);
 }
 
+/*
+ * CVodeGetDkyMulti
+ *
+ * This routine computes the k-th derivative of the interpolating
+ * polynomial at each of the nt times t[m] and stores the result in
+ * the vector dky[m], using the same formula as CVodeGetDky. The
+ * coefficients for all times are formed first, with the factor
+ * h^(-k) included, and the results are computed together by
+ * N_VLinearCombinationMulti, so the Nordsieck history array is read
+ * once rather than once per output time.
+ */
+
+int CVodeGetDkyMulti(void* cvode_mem, int nt, sunrealtype* t, int k,
+                     N_Vector* dky)
+{
+  sunrealtype s, r, cval;
+  sunrealtype tfuzz, tp, tn1;
+  sunrealtype* cvals;
+  int i, j, m, nvec, ier;
+  CVodeMem cv_mem;
+
+  /* Check all inputs for legality */
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+  cv_mem = (CVodeMem)cvode_mem;
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(CV_PROFILER);
+
+  if ((nt < 1) || (t == NULL))
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "nt < 1 or t = NULL illegal.");
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_ILL_INPUT);
+  }
+
+  if (dky == NULL)
+  {
+    cvProcessError(cv_mem, CV_BAD_DKY, __LINE__, __func__, __FILE__,
+                   MSGCV_NULL_DKY);
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_BAD_DKY);
+  }
+
+  for (m = 0; m < nt; m++)
+  {
+    if (dky[m] == NULL)
+    {
+      cvProcessError(cv_mem, CV_BAD_DKY, __LINE__, __func__, __FILE__,
+                     MSGCV_NULL_DKY);
+      SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+      return (CV_BAD_DKY);
+    }
+  }
+
+  if ((k < 0) || (k > cv_mem->cv_q))
+  {
+    cvProcessError(cv_mem, CV_BAD_K, __LINE__, __func__, __FILE__, MSGCV_BAD_K);
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_BAD_K);
+  }
+
+  /* Allow for some slack */
+  tfuzz = FUZZ_FACTOR * cv_mem->cv_uround *
+          (SUNRabs(cv_mem->cv_tn) + SUNRabs(cv_mem->cv_hu));
+  if (cv_mem->cv_hu < ZERO) { tfuzz = -tfuzz; }
+  tp  = cv_mem->cv_tn - cv_mem->cv_hu - tfuzz;
+  tn1 = cv_mem->cv_tn + tfuzz;
+  for (m = 0; m < nt; m++)
+  {
+    if ((t[m] - tp) * (t[m] - tn1) > ZERO)
+    {
+      cvProcessError(cv_mem, CV_BAD_T, __LINE__, __func__, __FILE__,
+                     MSGCV_BAD_T, t[m], cv_mem->cv_tn - cv_mem->cv_hu,
+                     cv_mem->cv_tn);
+      SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+      return (CV_BAD_T);
+    }
+  }
+
+  /* Coefficients of the differentiated interpolating polynomial, one row of
+     nvec values per output time */
+  nvec  = cv_mem->cv_q - k + 1;
+  cvals = (sunrealtype*)malloc(nt * nvec * sizeof(sunrealtype));
+  if (cvals == NULL)
+  {
+    cvProcessError(cv_mem, CV_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   MSGCV_MEM_FAIL);
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_MEM_FAIL);
+  }
+
+  r = (k == 0) ? ONE : SUNRpowerI(cv_mem->cv_h, -k);
+
+  for (m = 0; m < nt; m++)
+  {
+    s = (t[m] - cv_mem->cv_tn) / cv_mem->cv_h;
+    for (j = cv_mem->cv_q; j >= k; j--)
+    {
+      cval = ONE;
+      for (i = j; i >= j - k + 1; i--) { cval *= i; }
+      for (i = 0; i < j - k; i++) { cval *= s; }
+      cvals[m * nvec + cv_mem->cv_q - j] = r * cval;
+    }
+  }
+
+  for (j = cv_mem->cv_q; j >= k; j--)
+  {
+    cv_mem->cv_Xvecs[cv_mem->cv_q - j] = cv_mem->cv_zn[j];
+  }
+
+  /* Sum the differentiated interpolating polynomial at all times */
+  ier = N_VLinearCombinationMulti(nvec, nt, cvals, cv_mem->cv_Xvecs, dky);
+
+  free(cvals);
+
+  SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+  if (ier != CV_SUCCESS) { return (CV_VECTOROP_ERR); }
+  return (CV_SUCCESS);
+}
+
 /*
  * CVodeGetQuad
  *
@@ -7802,6 +7933,16 @@ static void cvCompleteStep(CVodeMem cv_mem)
   }
 #endif
 
+  /* Append this step to the statistics stream */
+  if (cv_mem->cv_stepstats != NULL)
+  {
+    long int nli = 0;
+    if (cv_mem->cv_lmem != NULL) { (void)CVodeGetNumLinIters(cv_mem, &nli); }
+    (void)SUNStepStats_Record(cv_mem->cv_stepstats, cv_mem->cv_tn,
+                              cv_mem->cv_hu, cv_mem->cv_qu, cv_mem->cv_netf,
+                              cv_mem->cv_nni, nli, cv_mem->cv_nsetups);
+  }
+
   SUNLogDebug(CV_LOGGER, "return", "nst = %d, nscon = %d", cv_mem->cv_nst,
               cv_mem->cv_nscon);
 }
@@ -7842,9 +7983,8 @@ static void cvPrepareNextStep(CVodeMem cv_mem, sunrealtype dsm)
       /* If qwait = 0, consider an order change.   etaqm1 and etaqp1 are
         the ratios of new to old h at orders q-1 and q+1, respectively.
         cvChooseEta selects the largest; cvSetEta adjusts eta and acor */
-      cv_mem->cv_qwait  = 2;
-      cv_mem->cv_etaqm1 = cvComputeEtaqm1(cv_mem);
-      cv_mem->cv_etaqp1 = cvComputeEtaqp1(cv_mem);
+      cv_mem->cv_qwait = 2;
+      cvComputeEtaqm1qp1(cv_mem);
       cvChooseEta(cv_mem);
       cvSetEta(cv_mem);
     }
@@ -7896,97 +8036,135 @@ static void cvSetEta(CVodeMem cv_mem)
 }
 
 /*
- * cvComputeEtaqm1
+ * cvComputeEtaqm1qp1
  *
- * This routine computes and returns the value of etaqm1 for a
- * possible decrease in order by 1.
+ * This routine computes the values of etaqm1 and etaqp1 for a
+ * possible decrease or increase in order by 1. The norms of all
+ * variables included in the error test, for both orders, are
+ * combined into a single reduction. The sensitivity norms are stored
+ * in cvals, starting with those for order q-1. An eta is left at zero
+ * when the order change is not possible or a vector operation fails.
  */
 
-static sunrealtype cvComputeEtaqm1(CVodeMem cv_mem)
+static void cvComputeEtaqm1qp1(CVodeMem cv_mem)
 {
-  sunrealtype ddn;
+  sunReduceBatch rb;
+  sunbooleantype qm1, qp1, quad, sens, qsens;
+  sunrealtype ddn  = ZERO;
+  sunrealtype dup  = ZERO;
+  sunrealtype ddnQ = ZERO;
+  sunrealtype dupQ = ZERO;
+  sunrealtype cquot;
+  sunrealtype *ddnS, *ddnQS, *dupS, *dupQS;
+  int is, Ns;
 
   cv_mem->cv_etaqm1 = ZERO;
-  if (cv_mem->cv_q > 1)
-  {
-    ddn = N_VWrmsNorm(cv_mem->cv_zn[cv_mem->cv_q], cv_mem->cv_ewt);
+  cv_mem->cv_etaqp1 = ZERO;
 
-    if (cv_mem->cv_quadr && cv_mem->cv_errconQ)
-    {
-      ddn = cvQuadUpdateNorm(cv_mem, ddn, cv_mem->cv_znQ[cv_mem->cv_q],
-                             cv_mem->cv_ewtQ);
-    }
+  qm1   = (cv_mem->cv_q > 1);
+  qp1   = (cv_mem->cv_q != cv_mem->cv_qmax) && (cv_mem->cv_saved_tq5 != ZERO);
+  quad  = cv_mem->cv_quadr && cv_mem->cv_errconQ;
+  sens  = cv_mem->cv_sensi && cv_mem->cv_errconS;
+  qsens = cv_mem->cv_quadr_sensi && cv_mem->cv_errconQS;
 
-    if (cv_mem->cv_sensi && cv_mem->cv_errconS)
-    {
-      ddn = cvSensUpdateNorm(cv_mem, ddn, cv_mem->cv_znS[cv_mem->cv_q],
-                             cv_mem->cv_ewtS);
-    }
+  if (!qm1 && !qp1) { return; }
 
-    if (cv_mem->cv_quadr_sensi && cv_mem->cv_errconQS)
-    {
-      ddn = cvQuadSensUpdateNorm(cv_mem, ddn, cv_mem->cv_znQS[cv_mem->cv_q],
-                                 cv_mem->cv_ewtQS);
-    }
+  Ns    = cv_mem->cv_Ns;
+  ddnS  = cv_mem->cv_cvals;
+  ddnQS = cv_mem->cv_cvals + Ns;
+  dupS  = cv_mem->cv_cvals + 2 * Ns;
+  dupQS = cv_mem->cv_cvals + 3 * Ns;
 
-    ddn               = ddn * cv_mem->cv_tq[1];
-    cv_mem->cv_etaqm1 = ONE /
-                        (SUNRpowerR(BIAS1 * ddn, ONE / cv_mem->cv_q) + ADDON);
-  }
-  return (cv_mem->cv_etaqm1);
-}
+  sunReduceBatch_Init(&rb);
 
-/*
- * cvComputeEtaqp1
- *
- * This routine computes and returns the value of etaqp1 for a
- * possible increase in order by 1.
- */
-
-static sunrealtype cvComputeEtaqp1(CVodeMem cv_mem)
-{
-  sunrealtype dup, cquot;
-
-  cv_mem->cv_etaqp1 = ZERO;
-  if (cv_mem->cv_q != cv_mem->cv_qmax)
+  /* The coefficients in cvals are used before it holds any norms */
+  if (qp1)
   {
-    if (cv_mem->cv_saved_tq5 == ZERO) { return (cv_mem->cv_etaqp1); }
     cquot = (cv_mem->cv_tq[5] / cv_mem->cv_saved_tq5) *
             SUNRpowerI(cv_mem->cv_h / cv_mem->cv_tau[2], cv_mem->cv_L);
-    N_VLinearSum(-cquot, cv_mem->cv_zn[cv_mem->cv_qmax], ONE, cv_mem->cv_acor,
-                 cv_mem->cv_tempv);
-    dup = N_VWrmsNorm(cv_mem->cv_tempv, cv_mem->cv_ewt);
+    cv_mem->cv_cvals[0] = -cquot;
+    cv_mem->cv_Xvecs[0] = cv_mem->cv_zn[cv_mem->cv_qmax];
+    cv_mem->cv_cvals[1] = ONE;
+    cv_mem->cv_Xvecs[1] = cv_mem->cv_acor;
+    sunReduceBatch_LinearCombinationWrmsNorm(&rb, 2, cv_mem->cv_cvals,
+                                             cv_mem->cv_Xvecs, cv_mem->cv_tempv,
+                                             cv_mem->cv_ewt, &dup);
 
-    if (cv_mem->cv_quadr && cv_mem->cv_errconQ)
+    if (quad)
     {
       N_VLinearSum(-cquot, cv_mem->cv_znQ[cv_mem->cv_qmax], ONE,
                    cv_mem->cv_acorQ, cv_mem->cv_tempvQ);
-      dup = cvQuadUpdateNorm(cv_mem, dup, cv_mem->cv_tempvQ, cv_mem->cv_ewtQ);
+      sunReduceBatch_WrmsNorm(&rb, cv_mem->cv_tempvQ, cv_mem->cv_ewtQ, &dupQ);
     }
 
-    if (cv_mem->cv_sensi && cv_mem->cv_errconS)
+    if (sens)
     {
-      (void)N_VLinearSumVectorArray(cv_mem->cv_Ns, -cquot,
-                                    cv_mem->cv_znS[cv_mem->cv_qmax], ONE,
-                                    cv_mem->cv_acorS, cv_mem->cv_tempvS);
-
-      dup = cvSensUpdateNorm(cv_mem, dup, cv_mem->cv_tempvS, cv_mem->cv_ewtS);
+      (void)N_VLinearSumVectorArray(Ns, -cquot, cv_mem->cv_znS[cv_mem->cv_qmax],
+                                    ONE, cv_mem->cv_acorS, cv_mem->cv_tempvS);
+      sunReduceBatch_WrmsNormVectorArray(&rb, Ns, cv_mem->cv_tempvS,
+                                         cv_mem->cv_ewtS, dupS);
     }
 
-    if (cv_mem->cv_quadr_sensi && cv_mem->cv_errconQS)
+    if (qsens)
     {
-      (void)N_VLinearSumVectorArray(cv_mem->cv_Ns, -cquot,
+      (void)N_VLinearSumVectorArray(Ns, -cquot,
                                     cv_mem->cv_znQS[cv_mem->cv_qmax], ONE,
                                     cv_mem->cv_acorQS, cv_mem->cv_tempvQS);
+      sunReduceBatch_WrmsNormVectorArray(&rb, Ns, cv_mem->cv_tempvQS,
+                                         cv_mem->cv_ewtQS, dupQS);
+    }
+  }
 
-      dup = cvSensUpdateNorm(cv_mem, dup, cv_mem->cv_tempvQS, cv_mem->cv_ewtQS);
+  if (qm1)
+  {
+    sunReduceBatch_WrmsNorm(&rb, cv_mem->cv_zn[cv_mem->cv_q], cv_mem->cv_ewt,
+                            &ddn);
+
+    if (quad)
+    {
+      sunReduceBatch_WrmsNorm(&rb, cv_mem->cv_znQ[cv_mem->cv_q],
+                              cv_mem->cv_ewtQ, &ddnQ);
     }
 
+    if (sens)
+    {
+      sunReduceBatch_WrmsNormVectorArray(&rb, Ns, cv_mem->cv_znS[cv_mem->cv_q],
+                                         cv_mem->cv_ewtS, ddnS);
+    }
+
+    if (qsens)
+    {
+      sunReduceBatch_WrmsNormVectorArray(&rb, Ns, cv_mem->cv_znQS[cv_mem->cv_q],
+                                         cv_mem->cv_ewtQS, ddnQS);
+    }
+  }
+
+  if (sunReduceBatch_Finalize(&rb)) { return; }
+
+  /* Take the maximum over all variables included in the error test */
+  ddn = SUNMAX(ddn, ddnQ);
+  dup = SUNMAX(dup, dupQ);
+  for (is = 0; is < Ns; is++)
+  {
+    if (qm1 && sens) { ddn = SUNMAX(ddn, ddnS[is]); }
+    if (qm1 && qsens) { ddn = SUNMAX(ddn, ddnQS[is]); }
+    if (qp1 && sens) { dup = SUNMAX(dup, dupS[is]); }
+    if (qp1 && qsens) { dup = SUNMAX(dup, dupQS[is]); }
+  }
+
+  if (qm1)
+  {
+    ddn               = ddn * cv_mem->cv_tq[1];
+    cv_mem->cv_etaqm1 = ONE /
+                        (SUNRpowerR(BIAS1 * ddn, ONE / cv_mem->cv_q) + ADDON);
+  }
+
+  if (qp1)
+  {
     dup = dup * cv_mem->cv_tq[3];
     cv_mem->cv_etaqp1 =
       ONE / (SUNRpowerR(BIAS3 * dup, ONE / (cv_mem->cv_L + 1)) + ADDON);
   }
-  return (cv_mem->cv_etaqp1);
 }
 
 /*
@@ -8227,7 +8405,10 @@ static int cvHandleFailure(CVodeMem cv_mem, int flag)
 static void cvBDFStab(CVodeMem cv_mem)
 {
   int i, k, ldflag, factorial;
-  sunrealtype sq, sqm1, sqm2;
+  sunrealtype sq;
+  sunrealtype sqm1 = ZERO;
+  sunrealtype sqm2 = ZERO;
+  sunReduceBatch rb;
 
   /* If order is 3 or greater, then save scaled derivative data,
      push old data down in i, then add current values to top.    */
@@ -8245,10 +8426,14 @@ static void cvBDFStab(CVodeMem cv_mem)
     for (i = 1; i <= cv_mem->cv_q - 1; i++) { factorial *= i; }
     sq = factorial * cv_mem->cv_q * (cv_mem->cv_q + 1) * cv_mem->cv_acnrm /
          SUNMAX(cv_mem->cv_tq[5], TINY);
-    sqm1 = factorial * cv_mem->cv_q *
-           N_VWrmsNorm(cv_mem->cv_zn[cv_mem->cv_q], cv_mem->cv_ewt);
-    sqm2 = factorial *
-           N_VWrmsNorm(cv_mem->cv_zn[cv_mem->cv_q - 1], cv_mem->cv_ewt);
+    sunReduceBatch_Init(&rb);
+    sunReduceBatch_WrmsNorm(&rb, cv_mem->cv_zn[cv_mem->cv_q], cv_mem->cv_ewt,
+                            &sqm1);
+    sunReduceBatch_WrmsNorm(&rb, cv_mem->cv_zn[cv_mem->cv_q - 1],
+                            cv_mem->cv_ewt, &sqm2);
+    (void)sunReduceBatch_Finalize(&rb);
+    sqm1 = factorial * cv_mem->cv_q * sqm1;
+    sqm2 = factorial * sqm2;
     cv_mem->cv_ssdat[1][1] = sqm2 * sqm2;
     cv_mem->cv_ssdat[1][2] = sqm1 * sqm1;
     cv_mem->cv_ssdat[1][3] = sq * sq;
@@ -619,6 +619,7 @@ typedef struct CVodeMemRec
     -------------------------------------------*/
   CVMonitorFn cv_monitorfun;    /* func called with CVODE mem and user data  */
   long int cv_monitor_interval; /* step interval to call cv_monitorfun       */
+  SUNStepStats cv_stepstats;    /* per-step statistics stream (not owned)    */
 
   /*-------------------------
     Stability Limit Detection
@@ -147,6 +147,39 @@ int CVodeSetMonitorFrequency(void* cvode_mem, long int nst)
 #endif
 }
 
+/*
+ * CVodeSetStepStats
+ *
+ * Attaches a SUNStepStats object that records the statistics of
+ * every successful step. Counts are taken relative to their
+ * values when the object is attached. Pass NULL to detach.
+ */
+
+int CVodeSetStepStats(void* cvode_mem, SUNStepStats stats)
+{
+  CVodeMem cv_mem;
+  long int nli = 0;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+
+  cv_mem = (CVodeMem)cvode_mem;
+
+  if (stats != NULL)
+  {
+    if (cv_mem->cv_lmem != NULL) { (void)CVodeGetNumLinIters(cv_mem, &nli); }
+    (void)SUNStepStats_SetBaseline(stats, cv_mem->cv_netf, cv_mem->cv_nni, nli,
+                                   cv_mem->cv_nsetups);
+  }
+
+  cv_mem->cv_stepstats = stats;
+
+  return (CV_SUCCESS);
+}
+
 /*
  * CVodeSetMaxOrd
  *
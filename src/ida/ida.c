@@ -90,6 +90,7 @@
 
 #include "ida_impl.h"
 #include "sundials/priv/sundials_errors_impl.h"
+#include "sundials_reducebatch.h"
 
 /*
  * =================================================================
@@ -215,6 +216,8 @@ static int IDANls(IDAMem IDA_mem);
 
 static int IDATestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
                         sunrealtype* err_km1);
+static void IDAWrmsNormBatch(IDAMem IDA_mem, sunReduceBatch* rb, N_Vector x,
+                             sunrealtype* nrm);
 
 /* Handling of convergence and/or error test failures */
 
@@ -301,6 +304,7 @@ void* IDACreate(SUNContext sunctx)
   /* Set default values for integrator optional inputs */
   IDA_mem->ida_res            = NULL;
   IDA_mem->ida_user_data      = NULL;
+  IDA_mem->ida_stepstats      = NULL;
   IDA_mem->ida_itol           = IDA_NN;
   IDA_mem->ida_atolmin0       = SUNTRUE;
   IDA_mem->ida_user_efun      = SUNFALSE;
@@ -534,7 +538,8 @@ int IDAInit(void* ida_mem, IDAResFn res, sunrealtype t0, N_Vector yy0,
 
   /* Initial setup not done yet */
 
-  IDA_mem->ida_SetupDone = SUNFALSE;
+  IDA_mem->ida_SetupDone             = SUNFALSE;
+  IDA_mem->ida_first_step_after_load = SUNFALSE;
 
   /* Problem memory has been successfully allocated */
 
@@ -622,6 +627,12 @@ int IDAReInit(void* ida_mem, sunrealtype t0, N_Vector yy0, N_Vector yp0)
   IDA_mem->ida_nnf     = 0;
   IDA_mem->ida_nsetups = 0;
 
+  /* Counts in the statistics stream restart from zero */
+  if (IDA_mem->ida_stepstats != NULL)
+  {
+    (void)SUNStepStats_SetBaseline(IDA_mem->ida_stepstats, 0, 0, 0, 0);
+  }
+
   IDA_mem->ida_kused = 0;
   IDA_mem->ida_hused = ZERO;
   IDA_mem->ida_tolsf = ONE;
@@ -632,7 +643,8 @@ int IDAReInit(void* ida_mem, sunrealtype t0, N_Vector yy0, N_Vector yp0)
 
   /* Initial setup not done yet */
 
-  IDA_mem->ida_SetupDone = SUNFALSE;
+  IDA_mem->ida_SetupDone             = SUNFALSE;
+  IDA_mem->ida_first_step_after_load = SUNFALSE;
 
   /* Problem has been successfully re-initialized */
 
@@ -2407,6 +2419,10 @@ static int IDAHandleFailure(IDAMem IDA_mem, int sflag)
     IDAProcessError(IDA_mem, IDA_NLS_FAIL, __LINE__, __func__, __FILE__,
                     MSG_NLS_FAIL, IDA_mem->ida_tn);
     return (IDA_NLS_FAIL);
+  case IDA_VECTOROP_ERR:
+    IDAProcessError(IDA_mem, IDA_VECTOROP_ERR, __LINE__, __func__, __FILE__,
+                    MSG_VECTOROP_ERR, IDA_mem->ida_tn);
+    return (IDA_VECTOROP_ERR);
   }
 
   /* This return should never happen */
@@ -2722,6 +2738,13 @@ static int IDANls(IDAMem IDA_mem)
     if (IDA_mem->ida_lsetup) { callLSetup = SUNTRUE; }
   }
 
+  /* The Jacobian is not part of a loaded state */
+
+  if (IDA_mem->ida_first_step_after_load && IDA_mem->ida_lsetup)
+  {
+    callLSetup = SUNTRUE;
+  }
+
   /* Decide if lsetup is to be called */
 
   if (IDA_mem->ida_lsetup)
@@ -2863,23 +2886,42 @@ static void IDAPredict(IDAMem IDA_mem)
  *
  * This routine estimates errors at orders k, k-1, k-2, decides
  * whether or not to suggest an order decrease, and performs
- * the local error test.
+ * the local error test. The three error norms are combined into a
+ * single reduction.
  *
- * IDATestError returns either IDA_SUCCESS or ERROR_TEST_FAIL.
+ * IDATestError returns IDA_SUCCESS, ERROR_TEST_FAIL, or IDA_VECTOROP_ERR
+ * if the reduction fails.
  */
 
 static int IDATestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
                         sunrealtype* err_km1)
 {
-  sunrealtype err_km2;                       /* estimated error at k-2 */
-  sunrealtype enorm_k, enorm_km1, enorm_km2; /* error norms */
-  sunrealtype terr_k, terr_km1, terr_km2;    /* local truncation error norms */
+  sunrealtype err_km2;                   /* estimated error at k-2 */
+  sunrealtype enorm_k, enorm_km1 = ZERO; /* error norms */
+  sunrealtype enorm_km2 = ZERO;
+  sunrealtype terr_k, terr_km1, terr_km2; /* local truncation error norms */
+  sunReduceBatch rb;
+
+  /* Compute the error norms for orders k, k-1, and k-2 with one reduction */
+  sunReduceBatch_Init(&rb);
+  IDAWrmsNormBatch(IDA_mem, &rb, IDA_mem->ida_ee, &enorm_k);
+  if (IDA_mem->ida_kk > 1)
+  {
+    N_VLinearSum(ONE, IDA_mem->ida_phi[IDA_mem->ida_kk], ONE, IDA_mem->ida_ee,
+                 IDA_mem->ida_delta);
+    IDAWrmsNormBatch(IDA_mem, &rb, IDA_mem->ida_delta, &enorm_km1);
+    if (IDA_mem->ida_kk > 2)
+    {
+      N_VLinearSum(ONE, IDA_mem->ida_phi[IDA_mem->ida_kk - 1], ONE,
+                   IDA_mem->ida_delta, IDA_mem->ida_delta);
+      IDAWrmsNormBatch(IDA_mem, &rb, IDA_mem->ida_delta, &enorm_km2);
+    }
+  }
+  if (sunReduceBatch_Finalize(&rb)) { return (IDA_VECTOROP_ERR); }
 
   /* Compute error for order k. */
-  enorm_k = IDAWrmsNorm(IDA_mem, IDA_mem->ida_ee, IDA_mem->ida_ewt,
-                        IDA_mem->ida_suppressalg);
-  *err_k  = IDA_mem->ida_sigma[IDA_mem->ida_kk] * enorm_k;
-  terr_k  = (IDA_mem->ida_kk + 1) * (*err_k);
+  *err_k = IDA_mem->ida_sigma[IDA_mem->ida_kk] * enorm_k;
+  terr_k = (IDA_mem->ida_kk + 1) * (*err_k);
 
   SUNLogDebug(IDA_LOGGER, "estimate-error-order-k",
               "err_k = " SUN_FORMAT_G ", terr_k = " SUN_FORMAT_G, *err_k, terr_k);
@@ -2889,12 +2931,8 @@ static int IDATestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
   if (IDA_mem->ida_kk > 1)
   {
     /* Compute error at order k-1 */
-    N_VLinearSum(ONE, IDA_mem->ida_phi[IDA_mem->ida_kk], ONE, IDA_mem->ida_ee,
-                 IDA_mem->ida_delta);
-    enorm_km1 = IDAWrmsNorm(IDA_mem, IDA_mem->ida_delta, IDA_mem->ida_ewt,
-                            IDA_mem->ida_suppressalg);
-    *err_km1  = IDA_mem->ida_sigma[IDA_mem->ida_kk - 1] * enorm_km1;
-    terr_km1  = IDA_mem->ida_kk * (*err_km1);
+    *err_km1 = IDA_mem->ida_sigma[IDA_mem->ida_kk - 1] * enorm_km1;
+    terr_km1 = IDA_mem->ida_kk * (*err_km1);
 
     SUNLogDebug(IDA_LOGGER, "estimate-error-order-km1",
                 "err_km1 = " SUN_FORMAT_G ", terr_km1 = " SUN_FORMAT_G,
@@ -2903,12 +2941,8 @@ static int IDATestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
     if (IDA_mem->ida_kk > 2)
     {
       /* Compute error at order k-2 */
-      N_VLinearSum(ONE, IDA_mem->ida_phi[IDA_mem->ida_kk - 1], ONE,
-                   IDA_mem->ida_delta, IDA_mem->ida_delta);
-      enorm_km2 = IDAWrmsNorm(IDA_mem, IDA_mem->ida_delta, IDA_mem->ida_ewt,
-                              IDA_mem->ida_suppressalg);
-      err_km2   = IDA_mem->ida_sigma[IDA_mem->ida_kk - 2] * enorm_km2;
-      terr_km2  = (IDA_mem->ida_kk - 1) * err_km2;
+      err_km2  = IDA_mem->ida_sigma[IDA_mem->ida_kk - 2] * enorm_km2;
+      terr_km2 = (IDA_mem->ida_kk - 1) * err_km2;
 
       SUNLogDebug(IDA_LOGGER, "estimate-error-order-km2",
                   "err_km2 = " SUN_FORMAT_G ", terr_km2 = " SUN_FORMAT_G,
@@ -2997,6 +3031,7 @@ static void IDARestore(IDAMem IDA_mem, sunrealtype saved_t)
  *   IDA_RES_FAIL               < 0
  *   IDA_LSOLVE_FAIL            < 0
  *   IDA_LSETUP_FAIL            < 0
+ *   IDA_VECTOROP_ERR           < 0
  *
  *   --error test failure--
  *   ERROR_TEST_FAIL            > 0
@@ -3014,6 +3049,7 @@ static void IDARestore(IDAMem IDA_mem, sunrealtype saved_t)
  *   IDA_RES_FAIL
  *   IDA_LSETUP_FAIL
  *   IDA_LSOLVE_FAIL
+ *   IDA_VECTOROP_ERR
  */
 
 static int IDAHandleNFlag(IDAMem IDA_mem, int nflag, sunrealtype err_k,
@@ -3040,6 +3076,7 @@ static int IDAHandleNFlag(IDAMem IDA_mem, int nflag, sunrealtype err_k,
       else if (nflag == IDA_LSETUP_FAIL) { return (IDA_LSETUP_FAIL); }
       else if (nflag == IDA_RES_FAIL) { return (IDA_RES_FAIL); }
       else if (nflag == IDA_CONSTR_FAIL) { return (IDA_CONSTR_FAIL); }
+      else if (nflag == IDA_VECTOROP_ERR) { return (IDA_VECTOROP_ERR); }
       else { return (IDA_NLS_FAIL); }
     }
     else
@@ -3172,10 +3209,23 @@ static void IDACompleteStep(IDAMem IDA_mem, sunrealtype err_k, sunrealtype err_k
   sunrealtype enorm, tmp, hnew;
 
   IDA_mem->ida_nst++;
+  IDA_mem->ida_first_step_after_load = SUNFALSE;
+
   kdiff              = IDA_mem->ida_kk - IDA_mem->ida_kused;
   IDA_mem->ida_kused = IDA_mem->ida_kk;
   IDA_mem->ida_hused = IDA_mem->ida_hh;
 
+  /* Append this step to the statistics stream */
+  if (IDA_mem->ida_stepstats != NULL)
+  {
+    long int nli = 0;
+    if (IDA_mem->ida_lmem != NULL) { (void)IDAGetNumLinIters(IDA_mem, &nli); }
+    (void)SUNStepStats_Record(IDA_mem->ida_stepstats, IDA_mem->ida_tn,
+                              IDA_mem->ida_hused, IDA_mem->ida_kused,
+                              IDA_mem->ida_netf, IDA_mem->ida_nni, nli,
+                              IDA_mem->ida_nsetups);
+  }
+
   if ((IDA_mem->ida_knew == IDA_mem->ida_kk - 1) ||
       (IDA_mem->ida_kk == IDA_mem->ida_maxord))
   {
@@ -3445,6 +3495,23 @@ sunrealtype IDAWrmsNorm(IDAMem IDA_mem, N_Vector x, N_Vector w,
   return (nrm);
 }
 
+/*
+ * IDAWrmsNormBatch
+ *
+ *  Adds the norm IDAWrmsNorm(IDA_mem, x, ewt, suppressalg) to the batch
+ *  rb, the result is stored in nrm by sunReduceBatch_Finalize.
+ */
+
+static void IDAWrmsNormBatch(IDAMem IDA_mem, sunReduceBatch* rb, N_Vector x,
+                             sunrealtype* nrm)
+{
+  if (IDA_mem->ida_suppressalg)
+  {
+    sunReduceBatch_WrmsNormMask(rb, x, IDA_mem->ida_ewt, IDA_mem->ida_id, nrm);
+  }
+  else { sunReduceBatch_WrmsNorm(rb, x, IDA_mem->ida_ewt, nrm); }
+}
+
 /*
  * -----------------------------------------------------------------
  * Functions for rootfinding
@@ -230,6 +230,8 @@ typedef struct IDAMemRec
   long int ida_nnf;     /* number of Newton convergence failures             */
   long int ida_nsetups; /* number of lsetup calls                            */
 
+  SUNStepStats ida_stepstats; /* per-step statistics stream (not owned)     */
+
   /*------------------
     Space requirements
     ------------------*/
@@ -254,6 +256,9 @@ typedef struct IDAMemRec
                                  set to SUNTRUE by IDAMAlloc
                                  tested by IDAReInit and IDASolve             */
 
+  sunbooleantype ida_first_step_after_load; /* set by IDALoadState to force
+                                               lsetup on the next step */
+
   /*---------------------
     Nonlinear Solver Data
     ---------------------*/
@@ -564,6 +569,7 @@ int idaNlsInit(IDAMem IDA_mem);
   "At " MSG_TIME ", the nonlinear solver setup failed unrecoverably."
 #define MSG_NLS_FAIL \
   "At " MSG_TIME ", the nonlinear solver failed in an unrecoverable manner."
+#define MSG_VECTOROP_ERR "At " MSG_TIME ", a vector operation failed."
 
 /* IDASet* / IDAGet* error messages */
 
@@ -323,6 +323,72 @@ int IDASetJacFn(void* ida_mem, IDALsJacFn jac)
   return (IDALS_SUCCESS);
 }
 
+/* IDASetJacSparsity specifies the nonzero pattern used by the difference
+   quotient Jacobian with a sparse SUNMatrix. The pattern is copied from S,
+   whose values are not used, and a NULL S removes it. */
+int IDASetJacSparsity(void* ida_mem, SUNMatrix S)
+{
+  IDAMem IDA_mem;
+  IDALsMem idals_mem;
+  sunSparseDQ sparseDQ;
+  int retval;
+
+  /* access IDALsMem structure */
+  retval = idaLs_AccessLMem(ida_mem, __func__, &IDA_mem, &idals_mem);
+  if (retval != IDALS_SUCCESS) { return (retval); }
+
+  if (S == NULL)
+  {
+    sunSparseDQ_Destroy(&idals_mem->sparseDQ);
+    return (IDALS_SUCCESS);
+  }
+
+  if (S->ops->getid == NULL || SUNMatGetID(S) != SUNMATRIX_SPARSE)
+  {
+    IDAProcessError(IDA_mem, IDALS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The sparsity pattern must be a sparse SUNMatrix");
+    return (IDALS_ILL_INPUT);
+  }
+
+  /* compute the column groups for the new pattern */
+  retval = sunSparseDQ_Create(S, &sparseDQ);
+  if (retval == SUN_ERR_MALLOC_FAIL)
+  {
+    IDAProcessError(IDA_mem, IDALS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (IDALS_MEM_FAIL);
+  }
+  if (retval)
+  {
+    IDAProcessError(IDA_mem, IDALS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The sparsity pattern is not square or is malformed");
+    return (IDALS_ILL_INPUT);
+  }
+
+  sunSparseDQ_Destroy(&idals_mem->sparseDQ);
+  idals_mem->sparseDQ = sparseDQ;
+
+  return (IDALS_SUCCESS);
+}
+
+/* IDASetJacSparsityDetection enables or disables detecting the nonzero
+   pattern for the sparse difference quotient Jacobian when no pattern is
+   given. The pattern is detected at initialization. */
+int IDASetJacSparsityDetection(void* ida_mem, sunbooleantype onoff)
+{
+  IDAMem IDA_mem;
+  IDALsMem idals_mem;
+  int retval;
+
+  /* access IDALsMem structure */
+  retval = idaLs_AccessLMem(ida_mem, __func__, &IDA_mem, &idals_mem);
+  if (retval != IDALS_SUCCESS) { return (retval); }
+
+  idals_mem->detect_sparsity = onoff;
+
+  return (IDALS_SUCCESS);
+}
+
 /* IDASetEpsLin specifies the nonlinear -> linear tolerance scale factor */
 int IDASetEpsLin(void* ida_mem, sunrealtype eplifac)
 {
@@ -882,7 +948,7 @@ int idaLsPSolve(void* ida_mem, N_Vector r, N_Vector z, sunrealtype tol,
 /*---------------------------------------------------------------
   idaLsDQJac:
 
-  This routine is a wrapper for the Dense and Band
+  This routine is a wrapper for the Dense, Band, and Sparse
   implementations of the difference quotient Jacobian
   approximation routines.
 ---------------------------------------------------------------*/
@@ -932,6 +998,10 @@ int idaLsDQJac(sunrealtype t, sunrealtype c_j, N_Vector y, N_Vector yp,
   {
     retval = idaLsBandDQJac(t, c_j, y, yp, r, Jac, IDA_mem, tmp1, tmp2, tmp3);
   }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_SPARSE)
+  {
+    retval = idaLsSparseDQJac(t, c_j, y, yp, r, Jac, IDA_mem, tmp1, tmp2, tmp3);
+  }
   else
   {
     IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
@@ -1188,6 +1258,289 @@ int idaLsBandDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
   return (retval);
 }
 
+/*---------------------------------------------------------------
+  idaLsSparseDQJac
+
+  This routine generates a sparse difference quotient approximation
+  JJ to the DAE system Jacobian J with the nonzero pattern given to
+  IDASetJacSparsity. The columns are split into groups that do not
+  share a row, so the columns in a group are perturbed together and
+  each group needs a single call to the res routine. The pattern is
+  written into JJ, which may be a CSC or CSR matrix, before its
+  entries are set. The return value is either 0 or the nonzero
+  value returned by the res routine, if any.
+  ---------------------------------------------------------------*/
+int idaLsSparseDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
+                     N_Vector rr, SUNMatrix Jac, IDAMem IDA_mem, N_Vector tmp1,
+                     N_Vector tmp2, N_Vector tmp3)
+{
+  sunrealtype inc, inc_inv, yj, ypj, srur, conj, ewtj;
+  sunrealtype *y_data, *yp_data, *ewt_data, *cns_data = NULL;
+  sunrealtype *ytemp_data, *yptemp_data, *rtemp_data, *r_data, *J_data;
+  N_Vector rtemp, ytemp, yptemp;
+  sunindextype color, i, j, k, p, q;
+  sunSparseDQ sdq;
+  IDALsMem idals_mem;
+  int retval = 0;
+
+  /* access LsMem interface structure */
+  idals_mem = (IDALsMem)IDA_mem->ida_lmem;
+  sdq       = idals_mem->sparseDQ;
+
+  /* verify that the pattern matches the matrix */
+  if (sdq == NULL || !sunSparseDQ_Compatible(sdq, Jac))
+  {
+    IDAProcessError(IDA_mem, IDALS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The sparsity pattern does not match the SUNMatrix");
+    return (IDALS_ILL_INPUT);
+  }
+
+  /* write the pattern into Jac */
+  if (sunSparseDQ_SetPattern(sdq, Jac))
+  {
+    IDAProcessError(IDA_mem, IDALS_SUNMAT_FAIL, __LINE__, __func__, __FILE__,
+                    "The sparsity pattern could not be set in the SUNMatrix");
+    return (IDALS_SUNMAT_FAIL);
+  }
+  J_data = SUNSparseMatrix_Data(Jac);
+
+  /* Rename work vectors for use as temporary values of r, y and yp */
+  rtemp  = tmp1;
+  ytemp  = tmp2;
+  yptemp = tmp3;
+
+  /* Obtain pointers to the data for all eight vectors used.  */
+  ewt_data    = N_VGetArrayPointer(IDA_mem->ida_ewt);
+  r_data      = N_VGetArrayPointer(rr);
+  y_data      = N_VGetArrayPointer(yy);
+  yp_data     = N_VGetArrayPointer(yp);
+  rtemp_data  = N_VGetArrayPointer(rtemp);
+  ytemp_data  = N_VGetArrayPointer(ytemp);
+  yptemp_data = N_VGetArrayPointer(yptemp);
+  if (IDA_mem->ida_constraintsSet)
+  {
+    cns_data = N_VGetArrayPointer(IDA_mem->ida_constraints);
+  }
+
+  /* Initialize ytemp and yptemp. */
+  N_VScale(ONE, yy, ytemp);
+  N_VScale(ONE, yp, yptemp);
+
+  /* Compute miscellaneous values for the Jacobian computation. */
+  srur = SUNRsqrt(IDA_mem->ida_uround);
+
+  /* Loop over column groups. */
+  for (color = 0; color < sdq->ncolors; color++)
+  {
+    /* Increment all yy[j] and yp[j] for j in this group. */
+    for (k = sdq->colorptrs[color]; k < sdq->colorptrs[color + 1]; k++)
+    {
+      j    = sdq->colorcols[k];
+      yj   = y_data[j];
+      ypj  = yp_data[j];
+      ewtj = ewt_data[j];
+
+      /* Set increment inc to yj based on sqrt(uround)*abs(yj), with
+        adjustments using ypj and ewtj if this is small, and a further
+        adjustment to give it the same sign as hh*ypj. */
+      inc = SUNMAX(srur * SUNMAX(SUNRabs(yj), SUNRabs(IDA_mem->ida_hh * ypj)),
+                   ONE / ewtj);
+      if (IDA_mem->ida_hh * ypj < ZERO) { inc = -inc; }
+      inc = (yj + inc) - yj;
+
+      /* Adjust sign(inc) again if yj has an inequality constraint. */
+      if (IDA_mem->ida_constraintsSet)
+      {
+        conj = cns_data[j];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((yj + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      /* Increment yj and ypj. */
+      ytemp_data[j] += inc;
+      yptemp_data[j] += c_j * inc;
+    }
+
+    /* Call res routine with incremented arguments. */
+    retval = IDA_mem->ida_res(tt, ytemp, yptemp, rtemp, IDA_mem->ida_user_data);
+    idals_mem->nreDQ++;
+    if (retval != 0) { break; }
+
+    /* Loop over the indices j in this group again. */
+    for (k = sdq->colorptrs[color]; k < sdq->colorptrs[color + 1]; k++)
+    {
+      /* Reset ytemp and yptemp components that were perturbed. */
+      j  = sdq->colorcols[k];
+      yj = ytemp_data[j] = y_data[j];
+      ypj = yptemp_data[j] = yp_data[j];
+      ewtj                 = ewt_data[j];
+
+      /* Set increment inc exactly as above. */
+      inc = SUNMAX(srur * SUNMAX(SUNRabs(yj), SUNRabs(IDA_mem->ida_hh * ypj)),
+                   ONE / ewtj);
+      if (IDA_mem->ida_hh * ypj < ZERO) { inc = -inc; }
+      inc = (yj + inc) - yj;
+      if (IDA_mem->ida_constraintsSet)
+      {
+        conj = cns_data[j];
+        if (SUNRabs(conj) == ONE)
+        {
+          if ((yj + inc) * conj < ZERO) { inc = -inc; }
+        }
+        else if (SUNRabs(conj) == TWO)
+        {
+          if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+        }
+      }
+
+      /* Load the difference quotient Jacobian elements for column j */
+      inc_inv = ONE / inc;
+      for (p = sdq->colptrs[j]; p < sdq->colptrs[j + 1]; p++)
+      {
+        i         = sdq->rowvals[p];
+        q         = sunSparseDQ_Position(sdq, Jac, p);
+        J_data[q] = inc_inv * (rtemp_data[i] - r_data[i]);
+      }
+    }
+  }
+
+  return (retval);
+}
+
+/*---------------------------------------------------------------
+  idaLsDetectSparsity
+
+  This routine detects the nonzero pattern of the Jacobian
+  F_y + c_j F_y' at the initial condition for the sparse
+  difference quotient Jacobian. Each y_j and y'_j are set to NaN
+  and then perturbed by random amounts, and the rows of F that
+  become NaN or change are taken as the nonzeros of column j.
+  This requires 2N+1 calls to res, which are counted in nreDQ.
+  ---------------------------------------------------------------*/
+int idaLsDetectSparsity(IDAMem IDA_mem)
+{
+  N_Vector ytemp, yptemp, r0, rnan, rpert;
+  sunrealtype *y_data, *yp_data, *ytemp_data, *yptemp_data;
+  sunrealtype *r0_data, *rnan_data, *rpert_data;
+  sunrealtype tt, inc;
+  sunindextype j, N;
+  unsigned long state = 1;
+  SUNMatrix P;
+  IDALsMem idals_mem;
+  int retval, nanretval, rretval;
+
+  /* access LsMem interface structure */
+  idals_mem = (IDALsMem)IDA_mem->ida_lmem;
+
+  /* create the pattern matrix and work vectors */
+  N      = SUNSparseMatrix_Columns(idals_mem->J);
+  P      = SUNSparseMatrix(N, N, SUNMAX(N, 1), CSC_MAT, IDA_mem->ida_sunctx);
+  ytemp  = N_VClone(IDA_mem->ida_ewt);
+  yptemp = N_VClone(IDA_mem->ida_ewt);
+  r0     = N_VClone(IDA_mem->ida_ewt);
+  rnan   = N_VClone(IDA_mem->ida_ewt);
+  rpert  = N_VClone(IDA_mem->ida_ewt);
+
+  retval = IDALS_SUCCESS;
+  if (P == NULL || ytemp == NULL || yptemp == NULL || r0 == NULL ||
+      rnan == NULL || rpert == NULL)
+  {
+    retval = IDALS_MEM_FAIL;
+  }
+
+  /* evaluate the residual at the initial condition */
+  tt      = IDA_mem->ida_tn;
+  rretval = 0;
+  if (retval == IDALS_SUCCESS)
+  {
+    N_VScale(ONE, IDA_mem->ida_phi[0], ytemp);
+    N_VScale(ONE, IDA_mem->ida_phi[1], yptemp);
+    rretval = IDA_mem->ida_res(tt, ytemp, yptemp, r0, IDA_mem->ida_user_data);
+    idals_mem->nreDQ++;
+  }
+
+  if (retval == IDALS_SUCCESS && rretval == 0)
+  {
+    y_data      = N_VGetArrayPointer(IDA_mem->ida_phi[0]);
+    yp_data     = N_VGetArrayPointer(IDA_mem->ida_phi[1]);
+    ytemp_data  = N_VGetArrayPointer(ytemp);
+    yptemp_data = N_VGetArrayPointer(yptemp);
+    r0_data     = N_VGetArrayPointer(r0);
+    rnan_data   = N_VGetArrayPointer(rnan);
+    rpert_data  = N_VGetArrayPointer(rpert);
+
+    for (j = 0; j < N; j++)
+    {
+      /* Probe with y_j = y'_j = NaN, a failure of res only skips this probe */
+      ytemp_data[j]  = NAN;
+      yptemp_data[j] = NAN;
+      nanretval      = IDA_mem->ida_res(tt, ytemp, yptemp, rnan,
+                                        IDA_mem->ida_user_data);
+      idals_mem->nreDQ++;
+
+      /* Probe with random perturbations of y_j and y'_j */
+      inc            = sunSparseDQ_ProbeIncrement(y_data[j], &state);
+      ytemp_data[j]  = y_data[j] + inc;
+      inc            = sunSparseDQ_ProbeIncrement(yp_data[j], &state);
+      yptemp_data[j] = yp_data[j] + inc;
+      rretval        = IDA_mem->ida_res(tt, ytemp, yptemp, rpert,
+                                        IDA_mem->ida_user_data);
+      idals_mem->nreDQ++;
+      if (rretval != 0) { break; }
+
+      ytemp_data[j]  = y_data[j];
+      yptemp_data[j] = yp_data[j];
+
+      /* Add the rows that became NaN or changed to column j */
+      if (sunSparseDQ_DetectColumn(P, j, r0_data,
+                                   (nanretval == 0) ? rnan_data : NULL,
+                                   rpert_data))
+      {
+        retval = IDALS_MEM_FAIL;
+        break;
+      }
+    }
+  }
+
+  /* compute the column groups for the detected pattern */
+  if (retval == IDALS_SUCCESS && rretval == 0)
+  {
+    sunSparseDQ_Destroy(&idals_mem->sparseDQ);
+    if (sunSparseDQ_Create(P, &idals_mem->sparseDQ))
+    {
+      retval = IDALS_MEM_FAIL;
+    }
+  }
+
+  if (retval == IDALS_MEM_FAIL)
+  {
+    IDAProcessError(IDA_mem, IDALS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+  }
+  else if (rretval != 0)
+  {
+    IDAProcessError(IDA_mem, IDALS_JACFUNC_UNRECVR, __LINE__, __func__,
+                    __FILE__, "The residual routine failed while detecting the "
+                              "Jacobian sparsity pattern");
+    retval = IDALS_JACFUNC_UNRECVR;
+  }
+
+  N_VDestroy(rpert);
+  N_VDestroy(rnan);
+  N_VDestroy(r0);
+  N_VDestroy(yptemp);
+  N_VDestroy(ytemp);
+  if (P) { SUNMatDestroy(P); }
+
+  return (retval);
+}
+
 /*---------------------------------------------------------------
   idaLsDQJtimes
 
@@ -1282,13 +1635,18 @@ int idaLsInitialize(IDAMem IDA_mem)
   else if (idals_mem->jacDQ)
   {
     /* If J is non-NULL, and 'jac' is not user-supplied:
-       - if J is dense or band, ensure that our DQ approx. is used
+       - if J is dense or band, or sparse with a matching or detected
+         sparsity pattern, ensure that our DQ approx. is used
        - otherwise => error */
     retval = 0;
     if (idals_mem->J->ops->getid)
     {
       if ((SUNMatGetID(idals_mem->J) == SUNMATRIX_DENSE) ||
-          (SUNMatGetID(idals_mem->J) == SUNMATRIX_BAND))
+          (SUNMatGetID(idals_mem->J) == SUNMATRIX_BAND) ||
+          (idals_mem->sparseDQ &&
+           sunSparseDQ_Compatible(idals_mem->sparseDQ, idals_mem->J)) ||
+          (idals_mem->detect_sparsity &&
+           SUNMatGetID(idals_mem->J) == SUNMATRIX_SPARSE))
       {
         idals_mem->jac    = idaLsDQJac;
         idals_mem->J_data = IDA_mem;
@@ -1314,6 +1672,20 @@ int idaLsInitialize(IDAMem IDA_mem)
   /* reset counters */
   idaLsInitializeCounters(idals_mem);
 
+  /* Detect the sparsity pattern for the DQ Jacobian if it is not known */
+  if (idals_mem->jacDQ && idals_mem->detect_sparsity &&
+      SUNMatGetID(idals_mem->J) == SUNMATRIX_SPARSE &&
+      !(idals_mem->sparseDQ &&
+        sunSparseDQ_Compatible(idals_mem->sparseDQ, idals_mem->J)))
+  {
+    retval = idaLsDetectSparsity(IDA_mem);
+    if (retval != IDALS_SUCCESS)
+    {
+      idals_mem->last_flag = retval;
+      return (retval);
+    }
+  }
+
   /* Set Jacobian-related fields, based on jtimesDQ */
   if (idals_mem->jtimesDQ)
   {
@@ -1717,6 +2089,9 @@ int idaLsFree(IDAMem IDA_mem)
     idals_mem->x = NULL;
   }
 
+  /* Free sparse DQ Jacobian memory */
+  sunSparseDQ_Destroy(&idals_mem->sparseDQ);
+
   /* Nullify other N_Vector pointers */
   idals_mem->ycur  = NULL;
   idals_mem->ypcur = NULL;
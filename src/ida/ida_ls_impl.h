@@ -21,6 +21,7 @@
 #include <ida/ida_ls.h>
 
 #include "ida_impl.h"
+#include "sundials_sparsedq.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -43,6 +44,10 @@ typedef struct IDALsMemRec
   sunbooleantype jacDQ; /* SUNTRUE if using internal DQ Jacobian approx. */
   IDALsJacFn jac;       /* Jacobian routine to be called                 */
   void* J_data;         /* J_data is passed to jac                       */
+  sunSparseDQ sparseDQ; /* column groups for a sparse DQ Jacobian        */
+
+  /* Detect the sparsity pattern for the DQ Jacobian if it is not given */
+  sunbooleantype detect_sparsity;
 
   /* Linear solver, matrix and vector objects/pointers */
   SUNLinearSolver LS; /* generic linear solver object                  */
@@ -131,6 +136,10 @@ int idaLsDenseDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
 int idaLsBandDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
                    N_Vector rr, SUNMatrix Jac, IDAMem IDA_mem, N_Vector tmp1,
                    N_Vector tmp2, N_Vector tmp3);
+int idaLsSparseDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
+                     N_Vector rr, SUNMatrix Jac, IDAMem IDA_mem, N_Vector tmp1,
+                     N_Vector tmp2, N_Vector tmp3);
+int idaLsDetectSparsity(IDAMem IDA_mem);
 
 /* Generic linit/lsetup/lsolve/lperf/lfree interface routines for IDA to call */
 int idaLsInitialize(IDAMem IDA_mem);
@@ -0,0 +1,313 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Save and load the integrator state for restarting a run
+ * ---------------------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <sundials/sundials_types.h>
+
+#include "ida/ida.h"
+#include "ida_impl.h"
+#include "ida_ls_impl.h"
+#include "sundials_statebuffer.h"
+
+#define ITEM(sb, x) sunStateBuffer_Item(sb, &(x), sizeof(x))
+
+extern int IDAInitialSetup(IDAMem IDA_mem);
+
+/* -----------------------------------------------------------------------------
+ * Describe the state as a sequence of buffer items
+ * ---------------------------------------------------------------------------*/
+
+/* Method, step and history data. The data needed to interpret the rest of the
+   buffer comes first so a mismatched buffer is detected before anything is
+   loaded into the vectors. */
+static int idaStateMain(IDAMem IDA_mem, sunStateBuffer* sb)
+{
+  int has_ls = (IDA_mem->ida_linit == idaLsInitialize);
+  int j;
+
+  sunStateBuffer_Header(sb, "IDA");
+  sunStateBuffer_Check(sb, &IDA_mem->ida_maxord, sizeof(int));
+  sunStateBuffer_Check(sb, &IDA_mem->ida_nrtfn, sizeof(int));
+  sunStateBuffer_Check(sb, &has_ls, sizeof(int));
+
+  /* counters */
+  ITEM(sb, IDA_mem->ida_nst);
+  ITEM(sb, IDA_mem->ida_nre);
+  ITEM(sb, IDA_mem->ida_ncfn);
+  ITEM(sb, IDA_mem->ida_netf);
+  ITEM(sb, IDA_mem->ida_nni);
+  ITEM(sb, IDA_mem->ida_nnf);
+  ITEM(sb, IDA_mem->ida_nsetups);
+
+  /* order and step size */
+  ITEM(sb, IDA_mem->ida_kk);
+  ITEM(sb, IDA_mem->ida_kused);
+  ITEM(sb, IDA_mem->ida_knew);
+  ITEM(sb, IDA_mem->ida_phase);
+  ITEM(sb, IDA_mem->ida_ns);
+  ITEM(sb, IDA_mem->ida_hh);
+  ITEM(sb, IDA_mem->ida_hused);
+  ITEM(sb, IDA_mem->ida_h0u);
+  ITEM(sb, IDA_mem->ida_eta);
+  ITEM(sb, IDA_mem->ida_tn);
+  ITEM(sb, IDA_mem->ida_tretlast);
+  ITEM(sb, IDA_mem->ida_tolsf);
+
+  /* method coefficients */
+  ITEM(sb, IDA_mem->ida_psi);
+  ITEM(sb, IDA_mem->ida_alpha);
+  ITEM(sb, IDA_mem->ida_beta);
+  ITEM(sb, IDA_mem->ida_sigma);
+  ITEM(sb, IDA_mem->ida_gamma);
+
+  /* nonlinear solver data */
+  ITEM(sb, IDA_mem->ida_cj);
+  ITEM(sb, IDA_mem->ida_cjlast);
+  ITEM(sb, IDA_mem->ida_cjold);
+  ITEM(sb, IDA_mem->ida_cjratio);
+  ITEM(sb, IDA_mem->ida_ss);
+  ITEM(sb, IDA_mem->ida_oldnrm);
+
+  /* rootfinding data */
+  if (IDA_mem->ida_nrtfn > 0)
+  {
+    size_t nrtfn = (size_t)IDA_mem->ida_nrtfn;
+
+    ITEM(sb, IDA_mem->ida_nge);
+    ITEM(sb, IDA_mem->ida_tlo);
+    ITEM(sb, IDA_mem->ida_thi);
+    ITEM(sb, IDA_mem->ida_trout);
+    ITEM(sb, IDA_mem->ida_toutc);
+    ITEM(sb, IDA_mem->ida_ttol);
+    ITEM(sb, IDA_mem->ida_taskc);
+    ITEM(sb, IDA_mem->ida_irfnd);
+    sunStateBuffer_Item(sb, IDA_mem->ida_glo, nrtfn * sizeof(sunrealtype));
+    sunStateBuffer_Item(sb, IDA_mem->ida_ghi, nrtfn * sizeof(sunrealtype));
+    sunStateBuffer_Item(sb, IDA_mem->ida_grout, nrtfn * sizeof(sunrealtype));
+    sunStateBuffer_Item(sb, IDA_mem->ida_iroots, nrtfn * sizeof(int));
+    sunStateBuffer_Item(sb, IDA_mem->ida_gactive,
+                        nrtfn * sizeof(sunbooleantype));
+  }
+
+  /* modified divided differences */
+  for (j = 0; j <= IDA_mem->ida_maxord; j++)
+  {
+    if (sunStateBuffer_Vector(sb, IDA_mem->ida_phi[j]))
+    {
+      return IDA_VECTOROP_ERR;
+    }
+  }
+
+  return IDA_SUCCESS;
+}
+
+/* Linear solver interface counters */
+static void idaStateLs(IDAMem IDA_mem, sunStateBuffer* sb)
+{
+  IDALsMem idals_mem;
+
+  if (IDA_mem->ida_linit != idaLsInitialize) { return; }
+  idals_mem = (IDALsMem)IDA_mem->ida_lmem;
+
+  ITEM(sb, idals_mem->nje);
+  ITEM(sb, idals_mem->npe);
+  ITEM(sb, idals_mem->nli);
+  ITEM(sb, idals_mem->nps);
+  ITEM(sb, idals_mem->ncfl);
+  ITEM(sb, idals_mem->nreDQ);
+  ITEM(sb, idals_mem->njtsetup);
+  ITEM(sb, idals_mem->njtimes);
+  ITEM(sb, idals_mem->nstlj);
+}
+
+static int idaStateAll(IDAMem IDA_mem, sunStateBuffer* sb)
+{
+  int retval = idaStateMain(IDA_mem, sb);
+  if (retval != IDA_SUCCESS) { return retval; }
+  idaStateLs(IDA_mem, sb);
+  return IDA_SUCCESS;
+}
+
+/* Checks the inputs shared by the state functions */
+static int idaStateCheckMem(void* ida_mem, const char* func, IDAMem* IDA_mem)
+{
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, func, __FILE__, MSG_NO_MEM);
+    return IDA_MEM_NULL;
+  }
+  *IDA_mem = (IDAMem)ida_mem;
+
+  if (!(*IDA_mem)->ida_MallocDone)
+  {
+    IDAProcessError(*IDA_mem, IDA_NO_MALLOC, __LINE__, func, __FILE__,
+                    MSG_NO_MALLOC);
+    return IDA_NO_MALLOC;
+  }
+
+  return IDA_SUCCESS;
+}
+
+/* -----------------------------------------------------------------------------
+ * Exported functions
+ * ---------------------------------------------------------------------------*/
+
+int IDAGetStateSize(void* ida_mem, size_t* bytes)
+{
+  IDAMem IDA_mem;
+  sunStateBuffer sb;
+  int retval;
+
+  retval = idaStateCheckMem(ida_mem, __func__, &IDA_mem);
+  if (retval != IDA_SUCCESS) { return retval; }
+
+  if (bytes == NULL)
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "bytes = NULL illegal.");
+    return IDA_ILL_INPUT;
+  }
+
+  sunStateBuffer_Init(&sb, NULL, 0, SUNFALSE);
+  retval = idaStateAll(IDA_mem, &sb);
+  if (retval != IDA_SUCCESS)
+  {
+    IDAProcessError(IDA_mem, retval, __LINE__, __func__, __FILE__,
+                    "A vector operation failed");
+    return retval;
+  }
+
+  *bytes = sb.pos;
+  return IDA_SUCCESS;
+}
+
+int IDASaveState(void* ida_mem, void* buffer, size_t bytes)
+{
+  IDAMem IDA_mem;
+  sunStateBuffer sb;
+  int retval;
+
+  retval = idaStateCheckMem(ida_mem, __func__, &IDA_mem);
+  if (retval != IDA_SUCCESS) { return retval; }
+
+  if (buffer == NULL)
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "buffer = NULL illegal.");
+    return IDA_ILL_INPUT;
+  }
+
+  sunStateBuffer_Init(&sb, buffer, bytes, SUNFALSE);
+  retval = idaStateAll(IDA_mem, &sb);
+  if (retval != IDA_SUCCESS)
+  {
+    IDAProcessError(IDA_mem, retval, __LINE__, __func__, __FILE__,
+                    "A vector operation failed");
+    return retval;
+  }
+
+  if (sb.invalid)
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The buffer is too small to hold the state");
+    return IDA_ILL_INPUT;
+  }
+
+  return IDA_SUCCESS;
+}
+
+int IDALoadState(void* ida_mem, const void* buffer, size_t bytes)
+{
+  IDAMem IDA_mem;
+  sunStateBuffer sb;
+  size_t state_bytes = 0;
+  void* backup       = NULL;
+  int retval;
+
+  retval = IDAGetStateSize(ida_mem, &state_bytes);
+  if (retval != IDA_SUCCESS) { return retval; }
+  IDA_mem = (IDAMem)ida_mem;
+
+  if (buffer == NULL)
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "buffer = NULL illegal.");
+    return IDA_ILL_INPUT;
+  }
+
+  if (bytes != state_bytes)
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The buffer size does not match the state of this problem");
+    return IDA_ILL_INPUT;
+  }
+
+  /* Keep the current state to restore it if the buffer does not match */
+  backup = malloc(state_bytes);
+  if (backup == NULL)
+  {
+    IDAProcessError(IDA_mem, IDA_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_MEM_FAIL);
+    return IDA_MEM_FAIL;
+  }
+
+  retval = IDASaveState(ida_mem, backup, state_bytes);
+  if (retval != IDA_SUCCESS)
+  {
+    free(backup);
+    return retval;
+  }
+
+  sunStateBuffer_InitLoad(&sb, buffer, bytes);
+  retval = idaStateMain(IDA_mem, &sb);
+
+  if (retval == IDA_SUCCESS && sb.invalid)
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The buffer does not hold a state of this problem");
+    retval = IDA_ILL_INPUT;
+  }
+
+  /* IDASolve only performs the initial setup and sets the convergence test
+     constants on the first step, do it here for a state past the first step.
+     The setup also resets the linear solver counters, so they are loaded
+     afterwards. */
+  if (retval == IDA_SUCCESS && IDA_mem->ida_nst > 0)
+  {
+    retval = IDAInitialSetup(IDA_mem);
+    if (retval == IDA_SUCCESS)
+    {
+      IDA_mem->ida_SetupDone = SUNTRUE;
+      IDA_mem->ida_epsNewt   = IDA_mem->ida_epcon;
+      IDA_mem->ida_toldel    = SUN_RCONST(0.0001) * IDA_mem->ida_epsNewt;
+    }
+  }
+
+  if (retval == IDA_SUCCESS) { idaStateLs(IDA_mem, &sb); }
+
+  if (retval != IDA_SUCCESS)
+  {
+    sunStateBuffer_Init(&sb, backup, state_bytes, SUNTRUE);
+    (void)idaStateAll(IDA_mem, &sb);
+    free(backup);
+    return retval;
+  }
+
+  free(backup);
+
+  /* The Jacobian is not part of the state, evaluate it on the next step */
+  IDA_mem->ida_first_step_after_load = (IDA_mem->ida_nst > 0);
+
+  return IDA_SUCCESS;
+}
@@ -148,6 +148,7 @@
 
 #include "idas_impl.h"
 #include "sundials/priv/sundials_errors_impl.h"
+#include "sundials_reducebatch.h"
 
 /*
  * =================================================================
@@ -308,6 +309,8 @@ static int IDAQuadSensNls(IDAMem IDA_mem);
 
 static int IDATestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
                         sunrealtype* err_km1, sunrealtype* err_km2);
+static void IDAWrmsNormBatch(IDAMem IDA_mem, sunReduceBatch* rb, N_Vector x,
+                             sunrealtype* nrm);
 static int IDAQuadTestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
                             sunrealtype* err_km1, sunrealtype* err_km2);
 static int IDASensTestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
@@ -430,6 +433,7 @@ void* IDACreate(SUNContext sunctx)
   /* Set default values for integrator optional inputs */
   IDA_mem->ida_res            = NULL;
   IDA_mem->ida_user_data      = NULL;
+  IDA_mem->ida_stepstats      = NULL;
   IDA_mem->ida_itol           = IDA_NN;
   IDA_mem->ida_atolmin0       = SUNTRUE;
   IDA_mem->ida_user_efun      = SUNFALSE;
@@ -841,6 +845,12 @@ int IDAReInit(void* ida_mem, sunrealtype t0, N_Vector yy0, N_Vector yp0)
   IDA_mem->ida_nnf     = 0;
   IDA_mem->ida_nsetups = 0;
 
+  /* Counts in the statistics stream restart from zero */
+  if (IDA_mem->ida_stepstats != NULL)
+  {
+    (void)SUNStepStats_SetBaseline(IDA_mem->ida_stepstats, 0, 0, 0, 0);
+  }
+
   IDA_mem->ida_kused = 0;
   IDA_mem->ida_hused = ZERO;
   IDA_mem->ida_tolsf = ONE;
@@ -5806,6 +5816,10 @@ static int IDAHandleFailure(IDAMem IDA_mem, int sflag)
     IDAProcessError(IDA_mem, IDA_NLS_FAIL, __LINE__, __func__, __FILE__,
                     MSG_NLS_FAIL, IDA_mem->ida_tn);
     return (IDA_NLS_FAIL);
+  case IDA_VECTOROP_ERR:
+    IDAProcessError(IDA_mem, IDA_VECTOROP_ERR, __LINE__, __func__, __FILE__,
+                    MSG_VECTOROP_ERR, IDA_mem->ida_tn);
+    return (IDA_VECTOROP_ERR);
   }
 
   /* This return should never happen */
@@ -6701,22 +6715,41 @@ static void IDAQuadSensPredict(IDAMem IDA_mem, N_Vector* yQS, N_Vector* ypQS)
  *
  * This routine estimates errors at orders k, k-1, k-2, decides
  * whether or not to suggest an order decrease, and performs
- * the local error test.
+ * the local error test. The three error norms are combined into a
+ * single reduction.
  *
- * IDATestError returns either IDA_SUCCESS or ERROR_TEST_FAIL.
+ * IDATestError returns IDA_SUCCESS, ERROR_TEST_FAIL, or IDA_VECTOROP_ERR
+ * if the reduction fails.
  */
 
 static int IDATestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
                         sunrealtype* err_km1, sunrealtype* err_km2)
 {
-  sunrealtype enorm_k, enorm_km1, enorm_km2; /* error norms */
-  sunrealtype terr_k, terr_km1, terr_km2;    /* local truncation error norms */
+  sunrealtype enorm_k, enorm_km1 = ZERO; /* error norms */
+  sunrealtype enorm_km2 = ZERO;
+  sunrealtype terr_k, terr_km1, terr_km2; /* local truncation error norms */
+  sunReduceBatch rb;
+
+  /* Compute the error norms for orders k, k-1, and k-2 with one reduction */
+  sunReduceBatch_Init(&rb);
+  IDAWrmsNormBatch(IDA_mem, &rb, IDA_mem->ida_ee, &enorm_k);
+  if (IDA_mem->ida_kk > 1)
+  {
+    N_VLinearSum(ONE, IDA_mem->ida_phi[IDA_mem->ida_kk], ONE, IDA_mem->ida_ee,
+                 IDA_mem->ida_delta);
+    IDAWrmsNormBatch(IDA_mem, &rb, IDA_mem->ida_delta, &enorm_km1);
+    if (IDA_mem->ida_kk > 2)
+    {
+      N_VLinearSum(ONE, IDA_mem->ida_phi[IDA_mem->ida_kk - 1], ONE,
+                   IDA_mem->ida_delta, IDA_mem->ida_delta);
+      IDAWrmsNormBatch(IDA_mem, &rb, IDA_mem->ida_delta, &enorm_km2);
+    }
+  }
+  if (sunReduceBatch_Finalize(&rb)) { return (IDA_VECTOROP_ERR); }
 
   /* Compute error for order k. */
-  enorm_k = IDAWrmsNorm(IDA_mem, IDA_mem->ida_ee, IDA_mem->ida_ewt,
-                        IDA_mem->ida_suppressalg);
-  *err_k  = IDA_mem->ida_sigma[IDA_mem->ida_kk] * enorm_k;
-  terr_k  = (IDA_mem->ida_kk + 1) * (*err_k);
+  *err_k = IDA_mem->ida_sigma[IDA_mem->ida_kk] * enorm_k;
+  terr_k = (IDA_mem->ida_kk + 1) * (*err_k);
 
   SUNLogDebug(IDA_LOGGER, "estimate-error-order-k",
               "err_k = " SUN_FORMAT_G ", terr_k = " SUN_FORMAT_G, *err_k, terr_k);
@@ -6726,12 +6759,8 @@ static int IDATestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
   if (IDA_mem->ida_kk > 1)
   {
     /* Compute error at order k-1 */
-    N_VLinearSum(ONE, IDA_mem->ida_phi[IDA_mem->ida_kk], ONE, IDA_mem->ida_ee,
-                 IDA_mem->ida_delta);
-    enorm_km1 = IDAWrmsNorm(IDA_mem, IDA_mem->ida_delta, IDA_mem->ida_ewt,
-                            IDA_mem->ida_suppressalg);
-    *err_km1  = IDA_mem->ida_sigma[IDA_mem->ida_kk - 1] * enorm_km1;
-    terr_km1  = IDA_mem->ida_kk * (*err_km1);
+    *err_km1 = IDA_mem->ida_sigma[IDA_mem->ida_kk - 1] * enorm_km1;
+    terr_km1 = IDA_mem->ida_kk * (*err_km1);
 
     SUNLogDebug(IDA_LOGGER, "estimate-error-order-km1",
                 "err_km1 = " SUN_FORMAT_G ", terr_km1 = " SUN_FORMAT_G,
@@ -6740,12 +6769,8 @@ static int IDATestError(IDAMem IDA_mem, sunrealtype ck, sunrealtype* err_k,
     if (IDA_mem->ida_kk > 2)
     {
       /* Compute error at order k-2 */
-      N_VLinearSum(ONE, IDA_mem->ida_phi[IDA_mem->ida_kk - 1], ONE,
-                   IDA_mem->ida_delta, IDA_mem->ida_delta);
-      enorm_km2 = IDAWrmsNorm(IDA_mem, IDA_mem->ida_delta, IDA_mem->ida_ewt,
-                              IDA_mem->ida_suppressalg);
-      *err_km2  = IDA_mem->ida_sigma[IDA_mem->ida_kk - 2] * enorm_km2;
-      terr_km2  = (IDA_mem->ida_kk - 1) * (*err_km2);
+      *err_km2 = IDA_mem->ida_sigma[IDA_mem->ida_kk - 2] * enorm_km2;
+      terr_km2 = (IDA_mem->ida_kk - 1) * (*err_km2);
 
       SUNLogDebug(IDA_LOGGER, "estimate-error-order-km2",
                   "err_km2 = " SUN_FORMAT_G ", terr_km2 = " SUN_FORMAT_G,
@@ -7180,6 +7205,7 @@ static void IDARestore(IDAMem IDA_mem, sunrealtype saved_t)
  *   IDA_LSOLVE_FAIL            < 0
  *   IDA_LSETUP_FAIL            < 0
  *   IDA_QRHS_FAIL              < 0
+ *   IDA_VECTOROP_ERR           < 0
  *
  *   --error test failure--
  *   ERROR_TEST_FAIL            > 0
@@ -7199,6 +7225,7 @@ static void IDARestore(IDAMem IDA_mem, sunrealtype saved_t)
  *   IDA_LSOLVE_FAIL
  *   IDA_QRHS_FAIL
  *   IDA_REP_QRHS_ERR
+ *   IDA_VECTOROP_ERR
  */
 
 static int IDAHandleNFlag(IDAMem IDA_mem, int nflag, sunrealtype err_k,
@@ -7228,6 +7255,7 @@ static int IDAHandleNFlag(IDAMem IDA_mem, int nflag, sunrealtype err_k,
       else if (nflag == IDA_QRHS_FAIL) { return (IDA_QRHS_FAIL); }
       else if (nflag == IDA_SRES_FAIL) { return (IDA_SRES_FAIL); }
       else if (nflag == IDA_QSRHS_FAIL) { return (IDA_QSRHS_FAIL); }
+      else if (nflag == IDA_VECTOROP_ERR) { return (IDA_VECTOROP_ERR); }
       else { return (IDA_NLS_FAIL); }
     }
     else
@@ -7395,6 +7423,17 @@ static void IDACompleteStep(IDAMem IDA_mem, sunrealtype err_k, sunrealtype err_k
   IDA_mem->ida_kused = IDA_mem->ida_kk;
   IDA_mem->ida_hused = IDA_mem->ida_hh;
 
+  /* Append this step to the statistics stream */
+  if (IDA_mem->ida_stepstats != NULL)
+  {
+    long int nli = 0;
+    if (IDA_mem->ida_lmem != NULL) { (void)IDAGetNumLinIters(IDA_mem, &nli); }
+    (void)SUNStepStats_Record(IDA_mem->ida_stepstats, IDA_mem->ida_tn,
+                              IDA_mem->ida_hused, IDA_mem->ida_kused,
+                              IDA_mem->ida_netf, IDA_mem->ida_nni, nli,
+                              IDA_mem->ida_nsetups);
+  }
+
   if ((IDA_mem->ida_knew == IDA_mem->ida_kk - 1) ||
       (IDA_mem->ida_kk == IDA_mem->ida_maxord))
   {
@@ -7777,6 +7816,23 @@ sunrealtype IDAWrmsNorm(IDAMem IDA_mem, N_Vector x, N_Vector w,
   return (nrm);
 }
 
+/*
+ * IDAWrmsNormBatch
+ *
+ *  Adds the norm IDAWrmsNorm(IDA_mem, x, ewt, suppressalg) to the batch
+ *  rb, the result is stored in nrm by sunReduceBatch_Finalize.
+ */
+
+static void IDAWrmsNormBatch(IDAMem IDA_mem, sunReduceBatch* rb, N_Vector x,
+                             sunrealtype* nrm)
+{
+  if (IDA_mem->ida_suppressalg)
+  {
+    sunReduceBatch_WrmsNormMask(rb, x, IDA_mem->ida_ewt, IDA_mem->ida_id, nrm);
+  }
+  else { sunReduceBatch_WrmsNorm(rb, x, IDA_mem->ida_ewt, nrm); }
+}
+
 /*
  * IDASensWrmsNorm
  *
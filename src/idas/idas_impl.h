@@ -373,6 +373,8 @@ typedef struct IDAMemRec
   long int ida_nsetups; /* number of lsetup calls                            */
   long int ida_nsetupsS;
 
+  SUNStepStats ida_stepstats; /* per-step statistics stream (not owned)     */
+
   /*------------------
     Space requirements
     ------------------*/
@@ -1133,6 +1135,7 @@ int IDASensResDQ(int Ns, sunrealtype t, N_Vector yy, N_Vector yp,
   "At " MSG_TIME ", the nonlinear solver setup failed unrecoverably."
 #define MSG_NLS_FAIL \
   "At " MSG_TIME ", the nonlinear solver failed in an unrecoverable manner."
+#define MSG_VECTOROP_ERR "At " MSG_TIME ", a vector operation failed."
 
 #define MSG_EWTQ_NOW_BAD "At " MSG_TIME ", a component of ewtQ has become <= 0."
 #define MSG_QRHSFUNC_FAILED                                               \
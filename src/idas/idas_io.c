@@ -73,6 +73,34 @@ int IDASetUserData(void* ida_mem, void* user_data)
 
 /*-----------------------------------------------------------------*/
 
+int IDASetStepStats(void* ida_mem, SUNStepStats stats)
+{
+  IDAMem IDA_mem;
+  long int nli = 0;
+
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (IDA_MEM_NULL);
+  }
+
+  IDA_mem = (IDAMem)ida_mem;
+
+  /* counts in the stream are relative to their values now */
+  if (stats != NULL)
+  {
+    if (IDA_mem->ida_lmem != NULL) { (void)IDAGetNumLinIters(IDA_mem, &nli); }
+    (void)SUNStepStats_SetBaseline(stats, IDA_mem->ida_netf, IDA_mem->ida_nni,
+                                   nli, IDA_mem->ida_nsetups);
+  }
+
+  IDA_mem->ida_stepstats = stats;
+
+  return (IDA_SUCCESS);
+}
+
+/*-----------------------------------------------------------------*/
+
 int IDASetEtaFixedStepBounds(void* ida_mem, sunrealtype eta_min_fx,
                              sunrealtype eta_max_fx)
 {
@@ -184,6 +184,7 @@ static int KINPicardFcnEval(KINMem kin_mem, N_Vector gval, N_Vector uval,
 static sunrealtype KINScFNorm(KINMem kin_mem, N_Vector v, N_Vector scale);
 static sunrealtype KINScSNorm(KINMem kin_mem, N_Vector v, N_Vector u);
 static int KINStop(KINMem kin_mem, sunbooleantype maxStepTaken, int sflag);
+static void KINRecordStepStats(KINMem kin_mem, sunrealtype stepl);
 static int AndersonAcc(KINMem kin_mem, N_Vector gval, N_Vector fv, N_Vector x,
                        N_Vector x_old, long int iter, sunrealtype* R,
                        sunrealtype* gamma);
@@ -243,6 +244,7 @@ void* KINCreate(SUNContext sunctx)
 
   kin_mem->kin_func             = NULL;
   kin_mem->kin_user_data        = NULL;
+  kin_mem->kin_stepstats        = NULL;
   kin_mem->kin_uu               = NULL;
   kin_mem->kin_unew             = NULL;
   kin_mem->kin_fval             = NULL;
@@ -553,7 +555,12 @@ int KINSol(void* kinmem, N_Vector u, int strategy_in, N_Vector u_scale,
 #endif
 
     kin_mem->kin_nfe = kin_mem->kin_nnilset = kin_mem->kin_nnilset_sub =
-      kin_mem->kin_nni = kin_mem->kin_nbcf = kin_mem->kin_nbktrk = 0;
+      kin_mem->kin_nni = kin_mem->kin_nbcf = kin_mem->kin_nbktrk =
+        kin_mem->kin_nsetups = 0;
+    if (kin_mem->kin_stepstats != NULL)
+    {
+      (void)SUNStepStats_SetBaseline(kin_mem->kin_stepstats, 0, 0, 0, 0);
+    }
     ret = KINFP(kin_mem);
 
     switch (ret)
@@ -724,6 +731,8 @@ int KINSol(void* kinmem, N_Vector u, int strategy_in, N_Vector u_scale,
                  kin_mem->kin_nni, kin_mem->kin_nfe, kin_mem->kin_fnorm);
 #endif
 
+    KINRecordStepStats(kin_mem, kin_mem->kin_stepl);
+
     if (ret != CONTINUE_ITERATIONS) { break; }
 
   } /* end of loop; return */
@@ -1540,7 +1549,14 @@ static int KINSolInit(KINMem kin_mem)
   /* initialize counters */
 
   kin_mem->kin_nfe = kin_mem->kin_nnilset = kin_mem->kin_nnilset_sub =
-    kin_mem->kin_nni = kin_mem->kin_nbcf = kin_mem->kin_nbktrk = 0;
+    kin_mem->kin_nni = kin_mem->kin_nbcf = kin_mem->kin_nbktrk =
+      kin_mem->kin_nsetups = 0;
+
+  /* counts in the statistics stream restart from zero */
+  if (kin_mem->kin_stepstats != NULL)
+  {
+    (void)SUNStepStats_SetBaseline(kin_mem->kin_stepstats, 0, 0, 0, 0);
+  }
 
   /* see if the initial guess uu satisfies the nonlinear system */
   retval = kin_mem->kin_func(kin_mem->kin_uu, kin_mem->kin_fval,
@@ -1633,6 +1649,7 @@ static int KINLinSolDrv(KINMem kin_mem)
     {
       retval                   = kin_mem->kin_lsetup(kin_mem);
       kin_mem->kin_jacCurrent  = SUNTRUE;
+      kin_mem->kin_nsetups++;
       kin_mem->kin_nnilset     = kin_mem->kin_nni;
       kin_mem->kin_nnilset_sub = kin_mem->kin_nni;
       if (retval != 0) { return (KIN_LSETUP_FAIL); }
@@ -2180,6 +2197,28 @@ static int KINConstraint(KINMem kin_mem)
   return (CONSTR_VIOLATED);
 }
 
+/*
+ * KINRecordStepStats
+ *
+ * This routine appends the current iteration to the statistics
+ * stream (if attached). The time and step size columns hold the
+ * scaled residual norm fnorm and the scaled step length, the order
+ * column is zero, and the error test failure column holds the
+ * number of line search backtracks.
+ */
+
+static void KINRecordStepStats(KINMem kin_mem, sunrealtype stepl)
+{
+  long int nli = 0;
+
+  if (kin_mem->kin_stepstats == NULL) { return; }
+
+  if (kin_mem->kin_lmem != NULL) { (void)KINGetNumLinIters(kin_mem, &nli); }
+  (void)SUNStepStats_Record(kin_mem->kin_stepstats, kin_mem->kin_fnorm, stepl,
+                            0, kin_mem->kin_nbktrk, kin_mem->kin_nni, nli,
+                            kin_mem->kin_nsetups);
+}
+
 /*
  * -----------------------------------------------------------------
  * Stopping tests
@@ -2733,6 +2772,8 @@ static int KINPicardAA(KINMem kin_mem)
                  kin_mem->kin_nni, kin_mem->kin_nfe, kin_mem->kin_fnorm);
 #endif
 
+    KINRecordStepStats(kin_mem, ZERO);
+
     /* Check if the maximum number of iterations is reached */
     if (kin_mem->kin_nni >= kin_mem->kin_mxiter) { ret = KIN_MAXITER_REACHED; }
     if (kin_mem->kin_fnorm <= kin_mem->kin_fnormtol) { ret = KIN_SUCCESS; }
@@ -2789,6 +2830,7 @@ static int KINPicardFcnEval(KINMem kin_mem, N_Vector gval, N_Vector uval,
     {
       retval                   = kin_mem->kin_lsetup(kin_mem);
       kin_mem->kin_jacCurrent  = SUNTRUE;
+      kin_mem->kin_nsetups++;
       kin_mem->kin_nnilset     = kin_mem->kin_nni;
       kin_mem->kin_nnilset_sub = kin_mem->kin_nni;
       if (retval != 0) { return (KIN_LSETUP_FAIL); }
@@ -2952,6 +2994,8 @@ static int KINFP(KINMem kin_mem)
                  kin_mem->kin_nni, kin_mem->kin_nfe, kin_mem->kin_fnorm);
 #endif
 
+    KINRecordStepStats(kin_mem, ZERO);
+
     /* Check if the maximum number of iterations is reached */
     if (kin_mem->kin_nni >= kin_mem->kin_mxiter) { ret = KIN_MAXITER_REACHED; }
     if (kin_mem->kin_fnorm <= (tolfac * kin_mem->kin_fnormtol))
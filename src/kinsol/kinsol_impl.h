@@ -139,9 +139,15 @@ typedef struct KINMemRec
                                   be met in KINLineSearch                      */
   long int kin_nbktrk;      /* number of backtracks performed by
                                   KINLineSearch                                */
+  long int kin_nsetups;     /* number of calls to the linear solver setup
+                                  routine                                      */
   long int kin_ncscmx;      /* number of consecutive steps of size
                                   mxnewtstep taken                             */
 
+  /* per-iteration statistics stream (not owned) */
+
+  SUNStepStats kin_stepstats;
+
   /* vectors */
 
   N_Vector kin_uu;     /* solution vector/current iterate (initially
@@ -62,6 +62,28 @@ int KINSetUserData(void* kinmem, void* user_data)
   return (KIN_SUCCESS);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Function : KINSetStepStats
+ * -----------------------------------------------------------------
+ */
+
+int KINSetStepStats(void* kinmem, SUNStepStats stats)
+{
+  KINMem kin_mem;
+
+  if (kinmem == NULL)
+  {
+    KINProcessError(NULL, KIN_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (KIN_MEM_NULL);
+  }
+
+  kin_mem                = (KINMem)kinmem;
+  kin_mem->kin_stepstats = stats;
+
+  return (KIN_SUCCESS);
+}
+
 /*
  * -----------------------------------------------------------------
  * Function : KINSetDamping
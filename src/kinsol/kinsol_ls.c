@@ -262,6 +262,77 @@ int KINSetJacFn(void* kinmem, KINLsJacFn jac)
   return (KINLS_SUCCESS);
 }
 
+/*------------------------------------------------------------------
+  KINSetJacSparsity specifies the nonzero pattern used by the
+  difference quotient Jacobian with a sparse SUNMatrix. The pattern
+  is copied from S, whose values are not used, and a NULL S removes
+  it.
+  ------------------------------------------------------------------*/
+int KINSetJacSparsity(void* kinmem, SUNMatrix S)
+{
+  KINMem kin_mem;
+  KINLsMem kinls_mem;
+  sunSparseDQ sparseDQ;
+  int retval;
+
+  /* access KINLsMem structure */
+  retval = kinLs_AccessLMem(kinmem, __func__, &kin_mem, &kinls_mem);
+  if (retval != KIN_SUCCESS) { return (retval); }
+
+  if (S == NULL)
+  {
+    sunSparseDQ_Destroy(&kinls_mem->sparseDQ);
+    return (KINLS_SUCCESS);
+  }
+
+  if (S->ops->getid == NULL || SUNMatGetID(S) != SUNMATRIX_SPARSE)
+  {
+    KINProcessError(kin_mem, KINLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The sparsity pattern must be a sparse SUNMatrix");
+    return (KINLS_ILL_INPUT);
+  }
+
+  /* compute the column groups for the new pattern */
+  retval = sunSparseDQ_Create(S, &sparseDQ);
+  if (retval == SUN_ERR_MALLOC_FAIL)
+  {
+    KINProcessError(kin_mem, KINLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (KINLS_MEM_FAIL);
+  }
+  if (retval)
+  {
+    KINProcessError(kin_mem, KINLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The sparsity pattern is not square or is malformed");
+    return (KINLS_ILL_INPUT);
+  }
+
+  sunSparseDQ_Destroy(&kinls_mem->sparseDQ);
+  kinls_mem->sparseDQ = sparseDQ;
+
+  return (KINLS_SUCCESS);
+}
+
+/*------------------------------------------------------------------
+  KINSetJacSparsityDetection enables or disables detecting the
+  nonzero pattern for the sparse difference quotient Jacobian when
+  no pattern is given. The pattern is detected at initialization.
+  ------------------------------------------------------------------*/
+int KINSetJacSparsityDetection(void* kinmem, sunbooleantype onoff)
+{
+  KINMem kin_mem;
+  KINLsMem kinls_mem;
+  int retval;
+
+  /* access KINLsMem structure */
+  retval = kinLs_AccessLMem(kinmem, __func__, &kin_mem, &kinls_mem);
+  if (retval != KIN_SUCCESS) { return (retval); }
+
+  kinls_mem->detect_sparsity = onoff;
+
+  return (KINLS_SUCCESS);
+}
+
 /*------------------------------------------------------------------
   KINSetPreconditioner sets the preconditioner setup and solve
   functions
@@ -704,8 +775,9 @@ int kinLsPSolve(void* kinmem, N_Vector r, N_Vector z,
 /*------------------------------------------------------------------
   kinLsDQJac
 
-  This routine is a wrapper for the Dense and Band implementations
-  of the difference quotient Jacobian approximation routines.
+  This routine is a wrapper for the Dense, Band, and Sparse
+  implementations of the difference quotient Jacobian approximation
+  routines.
   ------------------------------------------------------------------*/
 int kinLsDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, void* kinmem,
                N_Vector tmp1, N_Vector tmp2)
@@ -739,6 +811,10 @@ int kinLsDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, void* kinmem,
   {
     retval = kinLsBandDQJac(u, fu, Jac, kin_mem, tmp1, tmp2);
   }
+  else if (SUNMatGetID(Jac) == SUNMATRIX_SPARSE)
+  {
+    retval = kinLsSparseDQJac(u, fu, Jac, kin_mem, tmp1, tmp2);
+  }
   else
   {
     KINProcessError(kin_mem, KIN_ILL_INPUT, __LINE__, __func__, __FILE__,
@@ -923,6 +999,215 @@ int kinLsBandDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
   return (0);
 }
 
+/*------------------------------------------------------------------
+  kinLsSparseDQJac
+
+  This routine generates a sparse difference quotient approximation
+  to the Jacobian of F(u) with the nonzero pattern given to
+  KINSetJacSparsity. The columns are split into groups that do not
+  share a row, so the columns in a group are perturbed together and
+  each group needs a single call to F. The pattern is written into
+  Jac, which may be a CSC or CSR matrix, before its entries are set.
+
+  NOTE: Any type of failure of the system function here leads to an
+        unrecoverable failure of the Jacobian function and thus of
+        the linear solver setup function, stopping KINSOL.
+  ------------------------------------------------------------------*/
+int kinLsSparseDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
+                     N_Vector tmp1, N_Vector tmp2)
+{
+  sunrealtype inc, inc_inv;
+  N_Vector futemp, utemp;
+  sunindextype color, i, j, k, p, q;
+  sunrealtype *J_data, *fu_data, *futemp_data, *u_data, *utemp_data;
+  sunrealtype* uscale_data;
+  sunSparseDQ sdq;
+  KINLsMem kinls_mem;
+  int retval = 0;
+
+  /* access LsMem interface structure */
+  kinls_mem = (KINLsMem)kin_mem->kin_lmem;
+  sdq       = kinls_mem->sparseDQ;
+
+  /* verify that the pattern matches the matrix */
+  if (sdq == NULL || !sunSparseDQ_Compatible(sdq, Jac))
+  {
+    KINProcessError(kin_mem, KINLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The sparsity pattern does not match the SUNMatrix");
+    return (KINLS_ILL_INPUT);
+  }
+
+  /* write the pattern into Jac */
+  if (sunSparseDQ_SetPattern(sdq, Jac))
+  {
+    KINProcessError(kin_mem, KINLS_SUNMAT_FAIL, __LINE__, __func__, __FILE__,
+                    "The sparsity pattern could not be set in the SUNMatrix");
+    return (KINLS_SUNMAT_FAIL);
+  }
+  J_data = SUNSparseMatrix_Data(Jac);
+
+  /* Rename work vectors for use as temporary values of u and fu */
+  futemp = tmp1;
+  utemp  = tmp2;
+
+  /* Obtain pointers to the data for fu, futemp, u, utemp, uscale */
+  fu_data     = N_VGetArrayPointer(fu);
+  futemp_data = N_VGetArrayPointer(futemp);
+  u_data      = N_VGetArrayPointer(u);
+  uscale_data = N_VGetArrayPointer(kin_mem->kin_uscale);
+  utemp_data  = N_VGetArrayPointer(utemp);
+
+  /* Load utemp with u */
+  N_VScale(ONE, u, utemp);
+
+  for (color = 0; color < sdq->ncolors; color++)
+  {
+    /* Increment all utemp components in group */
+    for (k = sdq->colorptrs[color]; k < sdq->colorptrs[color + 1]; k++)
+    {
+      j   = sdq->colorcols[k];
+      inc = kin_mem->kin_sqrt_relfunc *
+            SUNMAX(SUNRabs(u_data[j]), ONE / SUNRabs(uscale_data[j]));
+      utemp_data[j] += inc;
+    }
+
+    /* Evaluate f with incremented u */
+    retval = kin_mem->kin_func(utemp, futemp, kin_mem->kin_user_data);
+    kinls_mem->nfeDQ++;
+    if (retval != 0) { return (retval); }
+
+    /* Restore utemp components, then form and load difference quotients */
+    for (k = sdq->colorptrs[color]; k < sdq->colorptrs[color + 1]; k++)
+    {
+      j             = sdq->colorcols[k];
+      utemp_data[j] = u_data[j];
+      inc           = kin_mem->kin_sqrt_relfunc *
+            SUNMAX(SUNRabs(u_data[j]), ONE / SUNRabs(uscale_data[j]));
+      inc_inv = ONE / inc;
+      for (p = sdq->colptrs[j]; p < sdq->colptrs[j + 1]; p++)
+      {
+        i         = sdq->rowvals[p];
+        q         = sunSparseDQ_Position(sdq, Jac, p);
+        J_data[q] = inc_inv * (futemp_data[i] - fu_data[i]);
+      }
+    }
+  }
+
+  return (0);
+}
+
+/*------------------------------------------------------------------
+  kinLsDetectSparsity
+
+  This routine detects the nonzero pattern of the Jacobian of F(u)
+  at the initial guess for the sparse difference quotient Jacobian.
+  Each u_j is set to NaN and then perturbed by a random amount, and
+  the rows of F that become NaN or change are taken as the nonzeros
+  of column j. This requires 2N+1 calls to F, which are counted in
+  nfeDQ.
+  ------------------------------------------------------------------*/
+int kinLsDetectSparsity(KINMem kin_mem)
+{
+  N_Vector utemp, f0, fnan, fpert;
+  sunrealtype *u_data, *utemp_data, *f0_data, *fnan_data, *fpert_data;
+  sunindextype j, N;
+  unsigned long state = 1;
+  SUNMatrix P;
+  KINLsMem kinls_mem;
+  int retval, nanretval, fretval;
+
+  /* access LsMem interface structure */
+  kinls_mem = (KINLsMem)kin_mem->kin_lmem;
+
+  /* create the pattern matrix and work vectors */
+  N     = SUNSparseMatrix_Columns(kinls_mem->J);
+  P     = SUNSparseMatrix(N, N, SUNMAX(N, 1), CSC_MAT, kin_mem->kin_sunctx);
+  utemp = N_VClone(kin_mem->kin_uu);
+  f0    = N_VClone(kin_mem->kin_uu);
+  fnan  = N_VClone(kin_mem->kin_uu);
+  fpert = N_VClone(kin_mem->kin_uu);
+
+  retval = KINLS_SUCCESS;
+  if (P == NULL || utemp == NULL || f0 == NULL || fnan == NULL || fpert == NULL)
+  {
+    retval = KINLS_MEM_FAIL;
+  }
+
+  /* evaluate F at the initial guess */
+  fretval = 0;
+  if (retval == KINLS_SUCCESS)
+  {
+    N_VScale(ONE, kin_mem->kin_uu, utemp);
+    fretval = kin_mem->kin_func(utemp, f0, kin_mem->kin_user_data);
+    kinls_mem->nfeDQ++;
+  }
+
+  if (retval == KINLS_SUCCESS && fretval == 0)
+  {
+    u_data     = N_VGetArrayPointer(kin_mem->kin_uu);
+    utemp_data = N_VGetArrayPointer(utemp);
+    f0_data    = N_VGetArrayPointer(f0);
+    fnan_data  = N_VGetArrayPointer(fnan);
+    fpert_data = N_VGetArrayPointer(fpert);
+
+    for (j = 0; j < N; j++)
+    {
+      /* Probe with u_j = NaN, a failure of F only skips this probe */
+      utemp_data[j] = NAN;
+      nanretval     = kin_mem->kin_func(utemp, fnan, kin_mem->kin_user_data);
+      kinls_mem->nfeDQ++;
+
+      /* Probe with a random perturbation of u_j */
+      utemp_data[j] = u_data[j] + sunSparseDQ_ProbeIncrement(u_data[j], &state);
+      fretval       = kin_mem->kin_func(utemp, fpert, kin_mem->kin_user_data);
+      kinls_mem->nfeDQ++;
+      if (fretval != 0) { break; }
+
+      utemp_data[j] = u_data[j];
+
+      /* Add the rows that became NaN or changed to column j */
+      if (sunSparseDQ_DetectColumn(P, j, f0_data,
+                                   (nanretval == 0) ? fnan_data : NULL,
+                                   fpert_data))
+      {
+        retval = KINLS_MEM_FAIL;
+        break;
+      }
+    }
+  }
+
+  /* compute the column groups for the detected pattern */
+  if (retval == KINLS_SUCCESS && fretval == 0)
+  {
+    sunSparseDQ_Destroy(&kinls_mem->sparseDQ);
+    if (sunSparseDQ_Create(P, &kinls_mem->sparseDQ))
+    {
+      retval = KINLS_MEM_FAIL;
+    }
+  }
+
+  if (retval == KINLS_MEM_FAIL)
+  {
+    KINProcessError(kin_mem, KINLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+  }
+  else if (fretval != 0)
+  {
+    KINProcessError(kin_mem, KINLS_JACFUNC_ERR, __LINE__, __func__, __FILE__,
+                    "The system function failed while detecting the Jacobian "
+                    "sparsity pattern");
+    retval = KINLS_JACFUNC_ERR;
+  }
+
+  N_VDestroy(fpert);
+  N_VDestroy(fnan);
+  N_VDestroy(f0);
+  N_VDestroy(utemp);
+  if (P) { SUNMatDestroy(P); }
+
+  return (retval);
+}
+
 /*------------------------------------------------------------------
   kinLsDQJtimes
 
@@ -1025,13 +1310,18 @@ int kinLsInitialize(KINMem kin_mem)
   else if (kinls_mem->jacDQ)
   {
     /* If J is non-NULL, and 'jac' is not user-supplied:
-       - if A is dense or band, ensure that our DQ approx. is used
+       - if A is dense or band, or sparse with a matching or detected
+         sparsity pattern, ensure that our DQ approx. is used
        - otherwise => error */
     retval = 0;
     if (kinls_mem->J->ops->getid)
     {
       if ((SUNMatGetID(kinls_mem->J) == SUNMATRIX_DENSE) ||
-          (SUNMatGetID(kinls_mem->J) == SUNMATRIX_BAND))
+          (SUNMatGetID(kinls_mem->J) == SUNMATRIX_BAND) ||
+          (kinls_mem->sparseDQ &&
+           sunSparseDQ_Compatible(kinls_mem->sparseDQ, kinls_mem->J)) ||
+          (kinls_mem->detect_sparsity &&
+           SUNMatGetID(kinls_mem->J) == SUNMATRIX_SPARSE))
       {
         kinls_mem->jac    = kinLsDQJac;
         kinls_mem->J_data = kin_mem;
@@ -1079,6 +1369,20 @@ int kinLsInitialize(KINMem kin_mem)
   /* Initialize counters */
   kinLsInitializeCounters(kinls_mem);
 
+  /* Detect the sparsity pattern for the DQ Jacobian if it is not known */
+  if (kinls_mem->jacDQ && kinls_mem->detect_sparsity &&
+      SUNMatGetID(kinls_mem->J) == SUNMATRIX_SPARSE &&
+      !(kinls_mem->sparseDQ &&
+        sunSparseDQ_Compatible(kinls_mem->sparseDQ, kinls_mem->J)))
+  {
+    retval = kinLsDetectSparsity(kin_mem);
+    if (retval != KINLS_SUCCESS)
+    {
+      kinls_mem->last_flag = retval;
+      return (retval);
+    }
+  }
+
   /* Set Jacobian-related fields, based on jtimesDQ */
   if (kinls_mem->jtimesDQ)
   {
@@ -1358,6 +1662,9 @@ int kinLsFree(KINMem kin_mem)
   /* Nullify SUNMatrix pointer */
   kinls_mem->J = NULL;
 
+  /* Free sparse DQ Jacobian memory */
+  sunSparseDQ_Destroy(&kinls_mem->sparseDQ);
+
   /* Free preconditioner memory (if applicable) */
   if (kinls_mem->pfree) { kinls_mem->pfree(kin_mem); }
 
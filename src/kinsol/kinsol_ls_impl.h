@@ -21,6 +21,7 @@
 #include <kinsol/kinsol_ls.h>
 
 #include "kinsol_impl.h"
+#include "sundials_sparsedq.h"
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
@@ -49,6 +50,10 @@ typedef struct KINLsMemRec
   sunbooleantype jacDQ; /* SUNTRUE if using internal DQ Jacobian approx. */
   KINLsJacFn jac;       /* Jacobian routine to be called                 */
   void* J_data;         /* J_data is passed to jac                       */
+  sunSparseDQ sparseDQ; /* column groups for a sparse DQ Jacobian        */
+
+  /* Detect the sparsity pattern for the DQ Jacobian if it is not given */
+  sunbooleantype detect_sparsity;
 
   /* Linear solver, matrix and vector objects/pointers */
   SUNLinearSolver LS; /* generic iterative linear solver object        */
@@ -123,6 +128,11 @@ int kinLsDenseDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
 int kinLsBandDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
                    N_Vector tmp1, N_Vector tmp2);
 
+int kinLsSparseDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
+                     N_Vector tmp1, N_Vector tmp2);
+
+int kinLsDetectSparsity(KINMem kin_mem);
+
 /* Generic linit/lsetup/lsolve/lfree interface routines for KINSOL to call */
 int kinLsInitialize(KINMem kin_mem);
 int kinLsSetup(KINMem kin_mem);
@@ -24,6 +24,7 @@
 #ifdef MANYVECTOR_BUILD_WITH_MPI
 #include <nvector/nvector_mpimanyvector.h>
 #include <sundials/priv/sundials_mpi_errors_impl.h>
+#include <sundials/priv/sundials_mpi_reduce_impl.h>
 #else
 #include <nvector/nvector_manyvector.h>
 #endif
@@ -135,6 +136,10 @@ N_Vector N_VMake_MPIManyVector(MPI_Comm comm, sunindextype num_subvectors,
   v->ops->nvscaleaddmulti     = N_VScaleAddMulti_MPIManyVector;
   v->ops->nvdotprodmulti      = N_VDotProdMulti_MPIManyVector;
 
+  v->ops->nvlinearcombinationwrmsnorm =
+    N_VLinearCombinationWrmsNorm_MPIManyVector;
+  v->ops->nvlinearcombinationmulti = N_VLinearCombinationMulti_MPIManyVector;
+
   /* vector array operations */
   v->ops->nvwrmsnormvectorarray     = N_VWrmsNormVectorArray_MPIManyVector;
   v->ops->nvwrmsnormmaskvectorarray = N_VWrmsNormMaskVectorArray_MPIManyVector;
@@ -149,10 +154,17 @@ N_Vector N_VMake_MPIManyVector(MPI_Comm comm, sunindextype num_subvectors,
   v->ops->nvminquotientlocal = N_VMinQuotientLocal_MPIManyVector;
   v->ops->nvwsqrsumlocal     = N_VWSqrSumLocal_MPIManyVector;
   v->ops->nvwsqrsummasklocal = N_VWSqrSumMaskLocal_MPIManyVector;
+  v->ops->nvlinearcombinationwsqrsumlocal =
+    N_VLinearCombinationWSqrSumLocal_MPIManyVector;
 
   /* single buffer reduction operations */
   v->ops->nvdotprodmultilocal     = N_VDotProdMultiLocal_MPIManyVector;
   v->ops->nvdotprodmultiallreduce = N_VDotProdMultiAllReduce_MPIManyVector;
+  v->ops->nvsummaxmultiallreduce  = N_VSumMaxMultiAllReduce_MPIManyVector;
+  v->ops->nvdotprodmultiallreducebegin =
+    N_VDotProdMultiAllReduceBegin_MPIManyVector;
+  v->ops->nvdotprodmultiallreduceend =
+    N_VDotProdMultiAllReduceEnd_MPIManyVector;
 
   /* XBraid interface operations */
   v->ops->nvbufsize   = N_VBufSize_MPIManyVector;
@@ -355,6 +367,10 @@ N_Vector N_VNew_ManyVector(sunindextype num_subvectors, N_Vector* vec_array,
   v->ops->nvscaleaddmulti     = N_VScaleAddMulti_ManyVector;
   v->ops->nvdotprodmulti      = N_VDotProdMulti_ManyVector;
 
+  v->ops->nvlinearcombinationwrmsnorm =
+    N_VLinearCombinationWrmsNorm_ManyVector;
+  v->ops->nvlinearcombinationmulti = N_VLinearCombinationMulti_ManyVector;
+
   /* vector array operations */
   v->ops->nvwrmsnormvectorarray     = N_VWrmsNormVectorArray_ManyVector;
   v->ops->nvwrmsnormmaskvectorarray = N_VWrmsNormMaskVectorArray_ManyVector;
@@ -369,6 +385,8 @@ N_Vector N_VNew_ManyVector(sunindextype num_subvectors, N_Vector* vec_array,
   v->ops->nvminquotientlocal = N_VMinQuotientLocal_ManyVector;
   v->ops->nvwsqrsumlocal     = N_VWSqrSumLocal_ManyVector;
   v->ops->nvwsqrsummasklocal = N_VWSqrSumMaskLocal_ManyVector;
+  v->ops->nvlinearcombinationwsqrsumlocal =
+    N_VLinearCombinationWSqrSumLocal_ManyVector;
 
   /* single buffer reduction operations */
   v->ops->nvdotprodmultilocal = N_VDotProdMultiLocal_ManyVector;
@@ -1460,6 +1478,63 @@ SUNErrCode N_VDotProdMultiAllReduce_MPIManyVector(int nvec_total, N_Vector x,
 
   return SUN_SUCCESS;
 }
+
+SUNErrCode N_VSumMaxMultiAllReduce_MPIManyVector(int nsum, int nmax, N_Vector x,
+                                                 sunrealtype* vals)
+{
+  SUNFunctionBegin(x->sunctx);
+
+  if (MANYVECTOR_COMM(x) == MPI_COMM_NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  SUNCheckCall(
+    SUNMPIAllReduceSumMax(x->sunctx, MANYVECTOR_COMM(x), nsum, nmax, vals));
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VDotProdMultiAllReduceBegin_MPIManyVector(int nvec_total,
+                                                       N_Vector x,
+                                                       sunrealtype* sum,
+                                                       void** request)
+{
+  SUNFunctionBegin(x->sunctx);
+  MPI_Request* req = NULL;
+
+  SUNAssert(request, SUN_ERR_ARG_CORRUPT);
+
+  if (MANYVECTOR_COMM(x) == MPI_COMM_NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  req = (MPI_Request*)malloc(sizeof(MPI_Request));
+  SUNAssert(req, SUN_ERR_MALLOC_FAIL);
+
+  /* start the reduction, sum must not be accessed until it completes */
+  if (MPI_Iallreduce(MPI_IN_PLACE, sum, nvec_total, MPI_SUNREALTYPE, MPI_SUM,
+                     MANYVECTOR_COMM(x), req) != MPI_SUCCESS)
+  {
+    free(req);
+    return SUN_ERR_MPI_FAIL;
+  }
+
+  *request = (void*)req;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VDotProdMultiAllReduceEnd_MPIManyVector(N_Vector x, void* request)
+{
+  SUNFunctionBegin(x->sunctx);
+  int retval;
+
+  SUNAssert(request, SUN_ERR_ARG_CORRUPT);
+
+  /* wait for the reduction to complete and release the request */
+  retval = MPI_Wait((MPI_Request*)request, MPI_STATUS_IGNORE);
+  free(request);
+
+  SUNCheckMPICall(retval);
+
+  return SUN_SUCCESS;
+}
 #endif
 
 /* -----------------------------------------------------------------
@@ -1502,6 +1577,166 @@ SUNErrCode MVAPPEND(N_VLinearCombination)(int nvec, sunrealtype* c, N_Vector* X,
   return SUN_SUCCESS;
 }
 
+/* Performs the linear combinations Z[k] = sum c[k*nvec+j] X[j] by calling
+   N_VLinearCombinationMulti on all subvectors; this routine does not check
+   that the components of X and Z are ManyVectors, if they have the same
+   number of subvectors, or if these subvectors are compatible. */
+SUNErrCode MVAPPEND(N_VLinearCombinationMulti)(int nvec, int nsum,
+                                               sunrealtype* c, N_Vector* X,
+                                               N_Vector* Z)
+{
+  SUNFunctionBegin(Z[0]->sunctx);
+  sunindextype i, j;
+  N_Vector* Xsub;
+  N_Vector* Zsub;
+
+  /* create arrays of nvec and nsum N_Vector pointers for reuse within loop */
+  Xsub = NULL;
+  Xsub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  SUNAssert(Xsub, SUN_ERR_MALLOC_FAIL);
+
+  Zsub = NULL;
+  Zsub = (N_Vector*)malloc(nsum * sizeof(N_Vector));
+  if (Zsub == NULL)
+  {
+    free(Xsub);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  /* perform operation by calling N_VLinearCombinationMulti for each
+     subvector */
+  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(Z[0]); i++)
+  {
+    /* for each subvector, create the arrays of subvectors of X and Z */
+    for (j = 0; j < nvec; j++) { Xsub[j] = MANYVECTOR_SUBVEC(X[j], i); }
+    for (j = 0; j < nsum; j++) { Zsub[j] = MANYVECTOR_SUBVEC(Z[j], i); }
+
+    /* now call N_VLinearCombinationMulti for these arrays of subvectors */
+    SUNCheckCall(N_VLinearCombinationMulti(nvec, nsum, c, Xsub, Zsub));
+  }
+
+  /* clean up and return */
+  free(Zsub);
+  free(Xsub);
+  return SUN_SUCCESS;
+}
+
+/* Performs the linear combination z = sum c[j] X[j] and the MPI task-local
+   weighted squared sum of z by calling N_VLinearCombinationWSqrSumLocal on all
+   subvectors; this routine does not check that z, w, and the components of X
+   are ManyVectors, if they have the same number of subvectors, or if these
+   subvectors are compatible.
+
+   As in N_VWSqrSumLocal, subvectors that do not implement a local weighted
+   squared sum use the fused WRMS norm instead and unravel the squared sum of
+   the subvector components. */
+SUNErrCode MVAPPEND(N_VLinearCombinationWSqrSumLocal)(int nvec, sunrealtype* c,
+                                                      N_Vector* X, N_Vector z,
+                                                      N_Vector w,
+                                                      sunrealtype* sum)
+{
+  SUNFunctionBegin(z->sunctx);
+  sunindextype i, j, N;
+  sunrealtype lsum, contrib;
+  N_Vector* Xsub;
+  N_Vector zsub, wsub;
+#ifdef MANYVECTOR_BUILD_WITH_MPI
+  int rank;
+#endif
+
+  /* create array of nvec N_Vector pointers for reuse within loop */
+  Xsub = NULL;
+  Xsub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  SUNAssert(Xsub, SUN_ERR_MALLOC_FAIL);
+
+  lsum = ZERO;
+  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(z); i++)
+  {
+    /* for each subvector, create the array of subvectors of X */
+    for (j = 0; j < nvec; j++) { Xsub[j] = MANYVECTOR_SUBVEC(X[j], i); }
+    zsub = MANYVECTOR_SUBVEC(z, i);
+    wsub = MANYVECTOR_SUBVEC(w, i);
+
+#ifdef MANYVECTOR_BUILD_WITH_MPI
+
+    /* check for a local weighted squared sum in the subvector */
+    if (zsub->ops->nvlinearcombinationwsqrsumlocal || zsub->ops->nvwsqrsumlocal)
+    {
+      SUNCheckCall(
+        N_VLinearCombinationWSqrSumLocal(nvec, c, Xsub, zsub, wsub, &contrib));
+      lsum += contrib;
+
+      /* otherwise, compute the norm and accumulate to overall sum on root
+         task */
+    }
+    else
+    {
+      SUNCheckCall(
+        N_VLinearCombinationWrmsNorm(nvec, c, Xsub, zsub, wsub, &contrib));
+
+      /* get this task's rank in subvector communicator (note: serial
+         subvectors will result in rank==0) */
+      rank = SubvectorMPIRank(zsub);
+      if (rank < 0)
+      {
+        free(Xsub);
+        return SUN_ERR_MPI_FAIL;
+      }
+      if (rank == 0)
+      {
+        N = N_VGetLength(zsub);
+        SUNCheckLastErr();
+        lsum += (contrib * contrib * N);
+      }
+    }
+
+#else
+
+    /* accumulate subvector contribution to overall sum */
+    SUNCheckCall(
+      N_VLinearCombinationWrmsNorm(nvec, c, Xsub, zsub, wsub, &contrib));
+    N = N_VGetLength(zsub);
+    SUNCheckLastErr();
+    lsum += (contrib * contrib * N);
+
+#endif
+  }
+
+  /* clean up and return */
+  free(Xsub);
+  *sum = lsum;
+  return SUN_SUCCESS;
+}
+
+/* Performs the linear combination z = sum c[j] X[j] and the WRMS norm of z by
+   calling N_VLinearCombinationWSqrSumLocal and combining the results; this
+   routine does not check that z, w, and the components of X are ManyVectors,
+   if they have the same number of subvectors, or if these subvectors are
+   compatible. */
+SUNErrCode MVAPPEND(N_VLinearCombinationWrmsNorm)(int nvec, sunrealtype* c,
+                                                  N_Vector* X, N_Vector z,
+                                                  N_Vector w, sunrealtype* nrm)
+{
+  SUNFunctionBegin(z->sunctx);
+  sunrealtype gsum;
+#ifdef MANYVECTOR_BUILD_WITH_MPI
+  sunrealtype lsum;
+  SUNCheckCall(
+    N_VLinearCombinationWSqrSumLocal_MPIManyVector(nvec, c, X, z, w, &lsum));
+  gsum = lsum;
+  if (MANYVECTOR_COMM(z) != MPI_COMM_NULL)
+  {
+    SUNCheckMPICall(MPI_Allreduce(&lsum, &gsum, 1, MPI_SUNREALTYPE, MPI_SUM,
+                                  MANYVECTOR_COMM(z)));
+  }
+#else
+  SUNCheckCall(
+    N_VLinearCombinationWSqrSumLocal_ManyVector(nvec, c, X, z, w, &gsum));
+#endif
+  *nrm = SUNRsqrt(gsum / (MANYVECTOR_GLOBLENGTH(z)));
+  return SUN_SUCCESS;
+}
+
 /* Performs the ScaleAddMulti operation by calling N_VScaleAddMulti on all
    subvectors; this routine does not check that x, or the components of X and Z are
    ManyVectors, if they have the same number of subvectors, or if these subvectors
@@ -38,6 +38,9 @@
 #define ONE    SUN_RCONST(1.0)
 #define ONEPT5 SUN_RCONST(1.5)
 
+/* Number of entries per block in N_VLinearCombinationMulti */
+#define LINCOMB_BLOCK 256
+
 /* Private functions for special cases of vector operations */
 static void VCopy_OpenMP(N_Vector x, N_Vector z);             /* z=x */
 static void VSum_OpenMP(N_Vector x, N_Vector y, N_Vector z);  /* z=x+y     */
@@ -141,7 +144,11 @@ N_Vector N_VNewEmpty_OpenMP(sunindextype length, int num_threads,
   v->ops->nvconstrmask   = N_VConstrMask_OpenMP;
   v->ops->nvminquotient  = N_VMinQuotient_OpenMP;
 
-  /* fused and vector array operations are disabled (NULL) by default */
+  /* fused and vector array operations are disabled (NULL) by default, except
+     for the fused update and norm, and the multiple linear combination, which
+     replace several passes over the data */
+  v->ops->nvlinearcombinationwrmsnorm = N_VLinearCombinationWrmsNorm_OpenMP;
+  v->ops->nvlinearcombinationmulti    = N_VLinearCombinationMulti_OpenMP;
 
   /* local reduction kernels */
   v->ops->nvdotprodlocal     = N_VDotProd_OpenMP;
@@ -153,6 +160,8 @@ N_Vector N_VNewEmpty_OpenMP(sunindextype length, int num_threads,
   v->ops->nvminquotientlocal = N_VMinQuotient_OpenMP;
   v->ops->nvwsqrsumlocal     = N_VWSqrSumLocal_OpenMP;
   v->ops->nvwsqrsummasklocal = N_VWSqrSumMaskLocal_OpenMP;
+  v->ops->nvlinearcombinationwsqrsumlocal =
+    N_VLinearCombinationWSqrSumLocal_OpenMP;
 
   /* single buffer reduction operations */
   v->ops->nvdotprodmultilocal = N_VDotProdMulti_OpenMP;
@@ -1260,6 +1269,134 @@ SUNErrCode N_VDotProdMulti_OpenMP(int nvec, N_Vector x, N_Vector* Y,
   return SUN_SUCCESS;
 }
 
+SUNErrCode N_VLinearCombinationWrmsNorm_OpenMP(int nvec, sunrealtype* c,
+                                               N_Vector* X, N_Vector z,
+                                               N_Vector w, sunrealtype* nrm)
+{
+  SUNFunctionBegin(z->sunctx);
+  sunrealtype sum = ZERO;
+
+  SUNCheckCall(N_VLinearCombinationWSqrSumLocal_OpenMP(nvec, c, X, z, w, &sum));
+  *nrm = SUNRsqrt(sum / NV_LENGTH_OMP(z));
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VLinearCombinationWSqrSumLocal_OpenMP(int nvec, sunrealtype* c,
+                                                   N_Vector* X, N_Vector z,
+                                                   N_Vector w,
+                                                   sunrealtype* sum)
+{
+  SUNFunctionBegin(z->sunctx);
+
+  int i;
+  sunindextype j, N;
+  sunrealtype wsum, prodj;
+  sunrealtype* zd = NULL;
+  sunrealtype* wd = NULL;
+  sunrealtype* Xd_stack[16];
+  sunrealtype** Xd = Xd_stack;
+
+  i = 0; /* initialize to suppress clang warning */
+  j = 0;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* get vector length and data arrays */
+  N  = NV_LENGTH_OMP(z);
+  zd = NV_DATA_OMP(z);
+  wd = NV_DATA_OMP(w);
+
+  if (nvec > 16)
+  {
+    Xd = (sunrealtype**)malloc(nvec * sizeof(sunrealtype*));
+    SUNAssert(Xd, SUN_ERR_MALLOC_FAIL);
+  }
+  for (i = 0; i < nvec; i++) { Xd[i] = NV_DATA_OMP(X[i]); }
+
+  /*
+   * z = sum{ c[i] * X[i] } and sum{ (z * w)^2 } in a single pass over the
+   * data
+   */
+  wsum = ZERO;
+#pragma omp parallel for default(none) private(i, j, prodj) \
+  shared(nvec, Xd, N, c, zd, wd) reduction(+ : wsum) schedule(static) \
+  num_threads(NV_NUM_THREADS_OMP(z))
+  for (j = 0; j < N; j++)
+  {
+    prodj = c[0] * Xd[0][j];
+    for (i = 1; i < nvec; i++) { prodj += c[i] * Xd[i][j]; }
+    zd[j] = prodj;
+    prodj *= wd[j];
+    wsum += SUNSQR(prodj);
+  }
+
+  if (Xd != Xd_stack) { free(Xd); }
+
+  *sum = wsum;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VLinearCombinationMulti_OpenMP(int nvec, int nsum, sunrealtype* c,
+                                            N_Vector* X, N_Vector* Z)
+{
+  SUNFunctionBegin(Z[0]->sunctx);
+
+  int i, k;
+  sunindextype b, j, jb, jend, N, nblocks;
+  sunrealtype* ck = NULL;
+  sunrealtype* zd = NULL;
+  sunrealtype* Xd_stack[16];
+  sunrealtype** Xd = Xd_stack;
+
+  i = 0; /* initialize to suppress clang warning */
+  j = 0;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssert(nsum >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* get vector length and data arrays */
+  N       = NV_LENGTH_OMP(Z[0]);
+  nblocks = (N + LINCOMB_BLOCK - 1) / LINCOMB_BLOCK;
+
+  if (nvec > 16)
+  {
+    Xd = (sunrealtype**)malloc(nvec * sizeof(sunrealtype*));
+    SUNAssert(Xd, SUN_ERR_MALLOC_FAIL);
+  }
+  for (i = 0; i < nvec; i++) { Xd[i] = NV_DATA_OMP(X[i]); }
+
+  /*
+   * Z[k] = sum{ c[k*nvec+i] * X[i] }, k = 0,...,nsum-1, over blocks of
+   * entries so each block of X stays in cache while all Z[k] are formed
+   */
+#pragma omp parallel for default(none) private(b, i, j, jb, jend, k, ck, zd) \
+  shared(nvec, nsum, nblocks, Xd, Z, N, c) schedule(static)                  \
+  num_threads(NV_NUM_THREADS_OMP(Z[0]))
+  for (b = 0; b < nblocks; b++)
+  {
+    jb   = b * LINCOMB_BLOCK;
+    jend = SUNMIN(jb + LINCOMB_BLOCK, N);
+    for (k = 0; k < nsum; k++)
+    {
+      ck = c + k * nvec;
+      zd = NV_DATA_OMP(Z[k]);
+      for (j = jb; j < jend; j++) { zd[j] = ck[0] * Xd[0][j]; }
+      for (i = 1; i < nvec; i++)
+      {
+        for (j = jb; j < jend; j++) { zd[j] += ck[i] * Xd[i][j]; }
+      }
+    }
+  }
+
+  if (Xd != Xd_stack) { free(Xd); }
+
+  return SUN_SUCCESS;
+}
+
 /*
  * -----------------------------------------------------------------
  * vector array operations
@@ -22,6 +22,7 @@
 #include <nvector/nvector_parallel.h>
 #include <sundials/priv/sundials_errors_impl.h>
 #include <sundials/priv/sundials_mpi_errors_impl.h>
+#include <sundials/priv/sundials_mpi_reduce_impl.h>
 #include <sundials/sundials_errors.h>
 #include <sundials/sundials_types.h>
 
@@ -32,6 +33,9 @@
 #define ONE    SUN_RCONST(1.0)
 #define ONEPT5 SUN_RCONST(1.5)
 
+/* Number of entries per block in N_VLinearCombinationMulti */
+#define LINCOMB_BLOCK 256
+
 /* Private functions for special cases of vector operations */
 static void VCopy_Parallel(N_Vector x, N_Vector z);             /* z=x       */
 static void VSum_Parallel(N_Vector x, N_Vector y, N_Vector z);  /* z=x+y     */
@@ -138,7 +142,11 @@ N_Vector N_VNewEmpty_Parallel(MPI_Comm comm, sunindextype local_length,
   v->ops->nvconstrmask   = N_VConstrMask_Parallel;
   v->ops->nvminquotient  = N_VMinQuotient_Parallel;
 
-  /* fused and vector array operations are disabled (NULL) by default */
+  /* fused and vector array operations are disabled (NULL) by default, except
+     for the fused update and norm, and the multiple linear combination, which
+     replace several passes over the data */
+  v->ops->nvlinearcombinationwrmsnorm = N_VLinearCombinationWrmsNorm_Parallel;
+  v->ops->nvlinearcombinationmulti    = N_VLinearCombinationMulti_Parallel;
 
   /* local reduction operations */
   v->ops->nvdotprodlocal     = N_VDotProdLocal_Parallel;
@@ -150,10 +158,16 @@ N_Vector N_VNewEmpty_Parallel(MPI_Comm comm, sunindextype local_length,
   v->ops->nvminquotientlocal = N_VMinQuotientLocal_Parallel;
   v->ops->nvwsqrsumlocal     = N_VWSqrSumLocal_Parallel;
   v->ops->nvwsqrsummasklocal = N_VWSqrSumMaskLocal_Parallel;
+  v->ops->nvlinearcombinationwsqrsumlocal =
+    N_VLinearCombinationWSqrSumLocal_Parallel;
 
   /* single buffer reduction operations */
   v->ops->nvdotprodmultilocal     = N_VDotProdMultiLocal_Parallel;
   v->ops->nvdotprodmultiallreduce = N_VDotProdMultiAllReduce_Parallel;
+  v->ops->nvsummaxmultiallreduce  = N_VSumMaxMultiAllReduce_Parallel;
+  v->ops->nvdotprodmultiallreducebegin =
+    N_VDotProdMultiAllReduceBegin_Parallel;
+  v->ops->nvdotprodmultiallreduceend = N_VDotProdMultiAllReduceEnd_Parallel;
 
   /* XBraid interface operations */
   v->ops->nvbufsize   = N_VBufSize_Parallel;
@@ -1188,6 +1202,173 @@ SUNErrCode N_VDotProdMultiAllReduce_Parallel(int nvec, N_Vector x,
   return SUN_SUCCESS;
 }
 
+SUNErrCode N_VSumMaxMultiAllReduce_Parallel(int nsum, int nmax, N_Vector x,
+                                            sunrealtype* vals)
+{
+  SUNFunctionBegin(x->sunctx);
+  SUNCheckCall(
+    SUNMPIAllReduceSumMax(x->sunctx, NV_COMM_P(x), nsum, nmax, vals));
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VDotProdMultiAllReduceBegin_Parallel(int nvec_total, N_Vector x,
+                                                  sunrealtype* sum,
+                                                  void** request)
+{
+  SUNFunctionBegin(x->sunctx);
+  MPI_Request* req = NULL;
+
+  SUNAssert(request, SUN_ERR_ARG_CORRUPT);
+
+  req = (MPI_Request*)malloc(sizeof(MPI_Request));
+  SUNAssert(req, SUN_ERR_MALLOC_FAIL);
+
+  /* start the reduction, sum must not be accessed until it completes */
+  if (MPI_Iallreduce(MPI_IN_PLACE, sum, nvec_total, MPI_SUNREALTYPE, MPI_SUM,
+                     NV_COMM_P(x), req) != MPI_SUCCESS)
+  {
+    free(req);
+    return SUN_ERR_MPI_FAIL;
+  }
+
+  *request = (void*)req;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VDotProdMultiAllReduceEnd_Parallel(N_Vector x, void* request)
+{
+  SUNFunctionBegin(x->sunctx);
+  int retval;
+
+  SUNAssert(request, SUN_ERR_ARG_CORRUPT);
+
+  /* wait for the reduction to complete and release the request */
+  retval = MPI_Wait((MPI_Request*)request, MPI_STATUS_IGNORE);
+  free(request);
+
+  SUNCheckMPICall(retval);
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VLinearCombinationWrmsNorm_Parallel(int nvec, sunrealtype* c,
+                                                 N_Vector* X, N_Vector z,
+                                                 N_Vector w, sunrealtype* nrm)
+{
+  SUNFunctionBegin(z->sunctx);
+  sunrealtype lsum = ZERO;
+  sunrealtype gsum = ZERO;
+
+  SUNCheckCall(
+    N_VLinearCombinationWSqrSumLocal_Parallel(nvec, c, X, z, w, &lsum));
+  SUNCheckMPICall(
+    MPI_Allreduce(&lsum, &gsum, 1, MPI_SUNREALTYPE, MPI_SUM, NV_COMM_P(z)));
+  *nrm = SUNRsqrt(gsum / NV_GLOBLENGTH_P(z));
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VLinearCombinationWSqrSumLocal_Parallel(int nvec, sunrealtype* c,
+                                                     N_Vector* X, N_Vector z,
+                                                     N_Vector w,
+                                                     sunrealtype* sum)
+{
+  SUNFunctionBegin(z->sunctx);
+
+  int i;
+  sunindextype j, N;
+  sunrealtype wsum, prodj, *zd, *wd;
+  sunrealtype* Xd_stack[16];
+  sunrealtype** Xd = Xd_stack;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* get vector length and data arrays */
+  N  = NV_LOCLENGTH_P(z);
+  zd = NV_DATA_P(z);
+  wd = NV_DATA_P(w);
+
+  if (nvec > 16)
+  {
+    Xd = (sunrealtype**)malloc(nvec * sizeof(sunrealtype*));
+    SUNAssert(Xd, SUN_ERR_MALLOC_FAIL);
+  }
+  for (i = 0; i < nvec; i++) { Xd[i] = NV_DATA_P(X[i]); }
+
+  /*
+   * z = sum{ c[i] * X[i] } and sum{ (z * w)^2 } in a single pass over the
+   * data
+   */
+  wsum = ZERO;
+  for (j = 0; j < N; j++)
+  {
+    prodj = c[0] * Xd[0][j];
+    for (i = 1; i < nvec; i++) { prodj += c[i] * Xd[i][j]; }
+    zd[j] = prodj;
+    prodj *= wd[j];
+    wsum += SUNSQR(prodj);
+  }
+
+  if (Xd != Xd_stack) { free(Xd); }
+
+  *sum = wsum;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VLinearCombinationMulti_Parallel(int nvec, int nsum,
+                                              sunrealtype* c, N_Vector* X,
+                                              N_Vector* Z)
+{
+  SUNFunctionBegin(Z[0]->sunctx);
+
+  int i, k;
+  sunindextype j, jb, jend, N;
+  sunrealtype* ck = NULL;
+  sunrealtype* zd = NULL;
+  sunrealtype* Xd_stack[16];
+  sunrealtype** Xd = Xd_stack;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssert(nsum >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* get vector length and data arrays */
+  N = NV_LOCLENGTH_P(Z[0]);
+
+  if (nvec > 16)
+  {
+    Xd = (sunrealtype**)malloc(nvec * sizeof(sunrealtype*));
+    SUNAssert(Xd, SUN_ERR_MALLOC_FAIL);
+  }
+  for (i = 0; i < nvec; i++) { Xd[i] = NV_DATA_P(X[i]); }
+
+  /*
+   * Z[k] = sum{ c[k*nvec+i] * X[i] }, k = 0,...,nsum-1, over blocks of
+   * entries so each block of X stays in cache while all Z[k] are formed
+   */
+  for (jb = 0; jb < N; jb += LINCOMB_BLOCK)
+  {
+    jend = SUNMIN(jb + LINCOMB_BLOCK, N);
+    for (k = 0; k < nsum; k++)
+    {
+      ck = c + k * nvec;
+      zd = NV_DATA_P(Z[k]);
+      for (j = jb; j < jend; j++) { zd[j] = ck[0] * Xd[0][j]; }
+      for (i = 1; i < nvec; i++)
+      {
+        for (j = jb; j < jend; j++) { zd[j] += ck[i] * Xd[i][j]; }
+      }
+    }
+  }
+
+  if (Xd != Xd_stack) { free(Xd); }
+
+  return SUN_SUCCESS;
+}
+
 /*
  * -----------------------------------------------------------------
  * vector array operations
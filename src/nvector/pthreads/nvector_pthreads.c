@@ -38,6 +38,38 @@
 #define ONE    SUN_RCONST(1.0)
 #define ONEPT5 SUN_RCONST(1.5)
 
+/* Argument passed to each worker thread in the pool */
+struct _Pthreads_Worker
+{
+  int id;                      /* chunk index computed by the worker */
+  unsigned long generation;    /* last operation seen by the worker  */
+  struct _Pthreads_Pool* pool; /* pool the worker belongs to         */
+};
+
+/* Persistent pool of worker threads shared by a vector and its clones. The
+   threads are created on the first vector operation and are parked on a
+   condition variable between operations. In each operation the calling
+   thread computes the first chunk of the loop while worker k computes chunk
+   k. */
+struct _Pthreads_Pool
+{
+  int nthreads;                     /* number of chunks in an operation  */
+  int nworkers;                     /* number of worker threads created  */
+  int refcount;                     /* number of vectors sharing pool    */
+  sunbooleantype started;           /* have the workers been created     */
+  sunbooleantype shutdown;          /* signal the workers to exit        */
+  unsigned long generation;         /* identifies the current operation  */
+  int pending;                      /* workers still running operation   */
+  void* (*fn)(void*);               /* companion function for operation  */
+  Pthreads_Data* data;              /* thread data for operation         */
+  pthread_t* threads;               /* worker thread handles             */
+  struct _Pthreads_Worker* workers; /* worker thread arguments           */
+  pthread_mutex_t lock;             /* protects the fields above         */
+  pthread_mutex_t run_lock;         /* serializes operations on the pool */
+  pthread_cond_t work_cond;         /* signals workers to start          */
+  pthread_cond_t done_cond;         /* signals caller workers are done   */
+};
+
 /* Private functions for special cases of vector operations */
 static void VCopy_Pthreads(N_Vector x, N_Vector z);             /* z=x       */
 static void VSum_Pthreads(N_Vector x, N_Vector y, N_Vector z);  /* z=x+y     */
@@ -114,6 +146,7 @@ static void* Vaxpy_PT(void* thread_data);
 static void* nvLinearCombinationPt(void* thread_data);
 static void* nvScaleAddMultiPt(void* thread_data);
 static void* nvDotProdMultiPt(void* thread_data);
+static void* nvLinearCombinationWSqrSumPt(void* thread_data);
 
 /* Pthread companion functions for vector array operations */
 static void* nvLinearSumVectorArrayPt(void* thread_data);
@@ -144,6 +177,15 @@ static void nvSplitLoop(int myid, int* nthreads, sunindextype* N,
 /* Function to initialize thread data */
 static void nvInitThreadData(Pthreads_Data* thread_data);
 
+/* Functions to manage the persistent pool of worker threads */
+static struct _Pthreads_Pool* nvPoolCreate(int nthreads);
+static void nvPoolRetain(struct _Pthreads_Pool* pool);
+static void nvPoolRelease(struct _Pthreads_Pool* pool);
+static void* nvPoolWorker(void* arg);
+static void nvPoolStart(struct _Pthreads_Pool* pool);
+static void nvRunThreads(N_Vector v, void* (*fn)(void*),
+                         Pthreads_Data* thread_data);
+
 /*
  * -----------------------------------------------------------------
  * exported functions
@@ -212,7 +254,9 @@ N_Vector N_VNewEmpty_Pthreads(sunindextype length, int num_threads,
   v->ops->nvconstrmask   = N_VConstrMask_Pthreads;
   v->ops->nvminquotient  = N_VMinQuotient_Pthreads;
 
-  /* fused and vector array operations are disabled (NULL) by default */
+  /* fused and vector array operations are disabled (NULL) by default, except
+     for the fused update and norm which replaces two passes over the data */
+  v->ops->nvlinearcombinationwrmsnorm = N_VLinearCombinationWrmsNorm_Pthreads;
 
   /* local reduction operations */
   v->ops->nvdotprodlocal     = N_VDotProd_Pthreads;
@@ -224,6 +268,8 @@ N_Vector N_VNewEmpty_Pthreads(sunindextype length, int num_threads,
   v->ops->nvminquotientlocal = N_VMinQuotient_Pthreads;
   v->ops->nvwsqrsumlocal     = N_VWSqrSumLocal_Pthreads;
   v->ops->nvwsqrsummasklocal = N_VWSqrSumMaskLocal_Pthreads;
+  v->ops->nvlinearcombinationwsqrsumlocal =
+    N_VLinearCombinationWSqrSumLocal_Pthreads;
 
   /* single buffer reduction operations */
   v->ops->nvdotprodmultilocal = N_VDotProdMulti_Pthreads;
@@ -250,6 +296,14 @@ N_Vector N_VNewEmpty_Pthreads(sunindextype length, int num_threads,
   content->num_threads = num_threads;
   content->own_data    = SUNFALSE;
   content->data        = NULL;
+  content->pool        = NULL;
+
+  /* Create the thread pool (threads are started on first use) */
+  if (num_threads > 1)
+  {
+    content->pool = nvPoolCreate(num_threads);
+    SUNAssertNull(content->pool, SUN_ERR_MALLOC_FAIL);
+  }
 
   return (v);
 }
@@ -383,6 +437,10 @@ N_Vector N_VCloneEmpty_Pthreads(N_Vector w)
   content->num_threads = NV_NUM_THREADS_PT(w);
   content->own_data    = SUNFALSE;
   content->data        = NULL;
+  content->pool        = NV_CONTENT_PT(w)->pool;
+
+  /* Share the thread pool with w */
+  nvPoolRetain(content->pool);
 
   return (v);
 }
@@ -437,6 +495,8 @@ void N_VDestroy_Pthreads(N_Vector v)
       free(NV_DATA_PT(v));
       NV_DATA_PT(v) = NULL;
     }
+    nvPoolRelease(NV_CONTENT_PT(v)->pool);
+    NV_CONTENT_PT(v)->pool = NULL;
     free(v->content);
     v->content = NULL;
   }
@@ -501,9 +561,7 @@ void N_VLinearSum_Pthreads(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   sunrealtype c;
   N_Vector v1, v2;
@@ -584,18 +642,12 @@ void N_VLinearSum_Pthreads(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y,
      (2) a == 0.0, b == other - user should have called N_VScale
      (3) a,b == other, a !=b, a != -b */
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = (pthread_t*)malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -610,17 +662,12 @@ void N_VLinearSum_Pthreads(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y,
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvLinearSumPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, nvLinearSumPt, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return;
@@ -653,7 +700,7 @@ static void* nvLinearSumPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = (a * xd[i]) + (b * yd[i]); }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -666,22 +713,14 @@ void N_VConst_Pthreads(sunrealtype c, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(z);
-  nthreads = NV_NUM_THREADS_PT(z);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(z);
+  nthreads    = NV_NUM_THREADS_PT(z);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -693,17 +732,12 @@ void N_VConst_Pthreads(sunrealtype c, N_Vector z)
     /* pack thread data */
     thread_data[i].c1 = c;
     thread_data[i].v1 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvConstPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(z, nvConstPt, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return;
@@ -733,7 +767,7 @@ static void* nvConstPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = c; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -746,22 +780,14 @@ void N_VProd_Pthreads(N_Vector x, N_Vector y, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -774,17 +800,12 @@ void N_VProd_Pthreads(N_Vector x, N_Vector y, N_Vector z)
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvProdPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, nvProdPt, thread_data);
 
   /* clean up and exit */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return;
@@ -814,7 +835,7 @@ static void* nvProdPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = xd[i] * yd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -827,22 +848,14 @@ void N_VDiv_Pthreads(N_Vector x, N_Vector y, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -855,17 +868,12 @@ void N_VDiv_Pthreads(N_Vector x, N_Vector y, N_Vector z)
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvDivPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, nvDivPt, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return;
@@ -895,7 +903,7 @@ static void* nvDivPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = xd[i] / yd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -908,9 +916,7 @@ void N_VScale_Pthreads(sunrealtype c, N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   if (z == x)
   { /* BLAS usage: scale x <- cx */
@@ -930,18 +936,12 @@ void N_VScale_Pthreads(sunrealtype c, N_Vector x, N_Vector z)
   }
   else
   {
-    /* allocate threads and thread data structs */
-    N        = NV_LENGTH_PT(x);
-    nthreads = NV_NUM_THREADS_PT(x);
-    threads  = malloc(nthreads * sizeof(pthread_t));
-    SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+    /* allocate thread data structs */
+    N           = NV_LENGTH_PT(x);
+    nthreads    = NV_NUM_THREADS_PT(x);
     thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
     SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-    /* set thread attributes */
-    pthread_attr_init(&attr);
-    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
     for (i = 0; i < nthreads; i++)
     {
       /* initialize thread data */
@@ -954,17 +954,12 @@ void N_VScale_Pthreads(sunrealtype c, N_Vector x, N_Vector z)
       thread_data[i].c1 = c;
       thread_data[i].v1 = NV_DATA_PT(x);
       thread_data[i].v2 = NV_DATA_PT(z);
-
-      /* create threads and call pthread companion function */
-      pthread_create(&threads[i], &attr, nvScalePt, (void*)&thread_data[i]);
     }
 
-    /* wait for all threads to finish */
-    for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+    /* run companion function on the thread pool */
+    nvRunThreads(x, nvScalePt, thread_data);
 
     /* clean up */
-    pthread_attr_destroy(&attr);
-    free(threads);
     free(thread_data);
   }
 
@@ -996,7 +991,7 @@ static void* nvScalePt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = c * xd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1009,22 +1004,14 @@ void N_VAbs_Pthreads(N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -1036,17 +1023,12 @@ void N_VAbs_Pthreads(N_Vector x, N_Vector z)
     /* pack thread data */
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvAbsPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, nvAbsPt, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return;
@@ -1075,7 +1057,7 @@ static void* nvAbsPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = SUNRabs(xd[i]); }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1088,22 +1070,14 @@ void N_VInv_Pthreads(N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -1115,17 +1089,12 @@ void N_VInv_Pthreads(N_Vector x, N_Vector z)
     /* pack thread data */
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvInvPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, nvInvPt, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return;
@@ -1154,7 +1123,7 @@ static void* nvInvPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = ONE / xd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1167,22 +1136,14 @@ void N_VAddConst_Pthreads(N_Vector x, sunrealtype b, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -1195,17 +1156,12 @@ void N_VAddConst_Pthreads(N_Vector x, sunrealtype b, N_Vector z)
     thread_data[i].c1 = b;
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvAddConstPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, nvAddConstPt, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return;
@@ -1236,7 +1192,7 @@ static void* nvAddConstPt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = xd[i] + b; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1249,27 +1205,15 @@ sunrealtype N_VDotProd_Pthreads(N_Vector x, N_Vector y)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
   sunrealtype sum = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -1279,22 +1223,17 @@ sunrealtype N_VDotProd_Pthreads(N_Vector x, N_Vector y)
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].v1           = NV_DATA_PT(x);
-    thread_data[i].v2           = NV_DATA_PT(y);
-    thread_data[i].global_val   = &sum;
-    thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvDotProdPt, (void*)&thread_data[i]);
+    thread_data[i].v1 = NV_DATA_PT(x);
+    thread_data[i].v2 = NV_DATA_PT(y);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, nvDotProdPt, thread_data);
+
+  /* combine thread-local results */
+  for (i = 0; i < nthreads; i++) { sum += thread_data[i].local_val; }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
   free(thread_data);
 
   return (sum);
@@ -1308,9 +1247,8 @@ static void* nvDotProdPt(void* thread_data)
 {
   sunindextype i, start, end;
   sunrealtype *xd, *yd;
-  sunrealtype local_sum, *global_sum;
+  sunrealtype local_sum;
   Pthreads_Data* my_data;
-  pthread_mutex_t* global_mutex;
 
   /* extract thread data */
   my_data = (Pthreads_Data*)thread_data;
@@ -1318,9 +1256,6 @@ static void* nvDotProdPt(void* thread_data)
   xd = my_data->v1;
   yd = my_data->v2;
 
-  global_sum   = my_data->global_val;
-  global_mutex = my_data->global_mutex;
-
   start = my_data->start;
   end   = my_data->end;
 
@@ -1328,13 +1263,11 @@ static void* nvDotProdPt(void* thread_data)
   local_sum = ZERO;
   for (i = start; i < end; i++) { local_sum += xd[i] * yd[i]; }
 
-  /* update global sum */
-  pthread_mutex_lock(global_mutex);
-  *global_sum += local_sum;
-  pthread_mutex_unlock(global_mutex);
+  /* store thread-local sum */
+  my_data->local_val = local_sum;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1347,27 +1280,15 @@ sunrealtype N_VMaxNorm_Pthreads(N_Vector x)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
   sunrealtype max = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -1378,20 +1299,18 @@ sunrealtype N_VMaxNorm_Pthreads(N_Vector x)
 
     /* pack thread data */
     thread_data[i].v1           = NV_DATA_PT(x);
-    thread_data[i].global_val   = &max;
-    thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvMaxNormPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, nvMaxNormPt, thread_data);
+
+  /* combine thread-local results */
+  for (i = 0; i < nthreads; i++)
+  {
+    if (thread_data[i].local_val > max) { max = thread_data[i].local_val; }
+  }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
   free(thread_data);
 
   return (max);
@@ -1405,18 +1324,14 @@ static void* nvMaxNormPt(void* thread_data)
 {
   sunindextype i, start, end;
   sunrealtype* xd;
-  sunrealtype local_max, *global_max;
+  sunrealtype local_max;
   Pthreads_Data* my_data;
-  pthread_mutex_t* global_mutex;
 
   /* extract thread data */
   my_data = (Pthreads_Data*)thread_data;
 
   xd = my_data->v1;
 
-  global_max   = my_data->global_val;
-  global_mutex = my_data->global_mutex;
-
   start = my_data->start;
   end   = my_data->end;
 
@@ -1427,13 +1342,11 @@ static void* nvMaxNormPt(void* thread_data)
     if (SUNRabs(xd[i]) > local_max) { local_max = SUNRabs(xd[i]); }
   }
 
-  /* update global max */
-  pthread_mutex_lock(global_mutex);
-  if (local_max > *global_max) { *global_max = local_max; }
-  pthread_mutex_unlock(global_mutex);
+  /* store thread-local max */
+  my_data->local_val = local_max;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1458,27 +1371,15 @@ sunrealtype N_VWSqrSumLocal_Pthreads(N_Vector x, N_Vector w)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
   sunrealtype sum = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -1488,22 +1389,17 @@ sunrealtype N_VWSqrSumLocal_Pthreads(N_Vector x, N_Vector w)
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].v1           = NV_DATA_PT(x);
-    thread_data[i].v2           = NV_DATA_PT(w);
-    thread_data[i].global_val   = &sum;
-    thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvWSqrSumPt, (void*)&thread_data[i]);
+    thread_data[i].v1 = NV_DATA_PT(x);
+    thread_data[i].v2 = NV_DATA_PT(w);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, nvWSqrSumPt, thread_data);
+
+  /* combine thread-local results */
+  for (i = 0; i < nthreads; i++) { sum += thread_data[i].local_val; }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
   free(thread_data);
 
   return (sum);
@@ -1517,9 +1413,8 @@ static void* nvWSqrSumPt(void* thread_data)
 {
   sunindextype i, start, end;
   sunrealtype *xd, *wd;
-  sunrealtype local_sum, *global_sum;
+  sunrealtype local_sum;
   Pthreads_Data* my_data;
-  pthread_mutex_t* global_mutex;
 
   /* extract thread data */
   my_data = (Pthreads_Data*)thread_data;
@@ -1527,9 +1422,6 @@ static void* nvWSqrSumPt(void* thread_data)
   xd = my_data->v1;
   wd = my_data->v2;
 
-  global_sum   = my_data->global_val;
-  global_mutex = my_data->global_mutex;
-
   start = my_data->start;
   end   = my_data->end;
 
@@ -1537,13 +1429,11 @@ static void* nvWSqrSumPt(void* thread_data)
   local_sum = ZERO;
   for (i = start; i < end; i++) { local_sum += SUNSQR(xd[i] * wd[i]); }
 
-  /* update global sum */
-  pthread_mutex_lock(global_mutex);
-  *global_sum += local_sum;
-  pthread_mutex_unlock(global_mutex);
+  /* store thread-local sum */
+  my_data->local_val = local_sum;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1568,27 +1458,15 @@ sunrealtype N_VWSqrSumMaskLocal_Pthreads(N_Vector x, N_Vector w, N_Vector id)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
   sunrealtype sum = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -1598,23 +1476,18 @@ sunrealtype N_VWSqrSumMaskLocal_Pthreads(N_Vector x, N_Vector w, N_Vector id)
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].v1           = NV_DATA_PT(x);
-    thread_data[i].v2           = NV_DATA_PT(w);
-    thread_data[i].v3           = NV_DATA_PT(id);
-    thread_data[i].global_val   = &sum;
-    thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvWSqrSumMaskPt, (void*)&thread_data[i]);
+    thread_data[i].v1 = NV_DATA_PT(x);
+    thread_data[i].v2 = NV_DATA_PT(w);
+    thread_data[i].v3 = NV_DATA_PT(id);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, nvWSqrSumMaskPt, thread_data);
+
+  /* combine thread-local results */
+  for (i = 0; i < nthreads; i++) { sum += thread_data[i].local_val; }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
   free(thread_data);
 
   return (sum);
@@ -1628,9 +1501,8 @@ static void* nvWSqrSumMaskPt(void* thread_data)
 {
   sunindextype i, start, end;
   sunrealtype *xd, *wd, *idd;
-  sunrealtype local_sum, *global_sum;
+  sunrealtype local_sum;
   Pthreads_Data* my_data;
-  pthread_mutex_t* global_mutex;
 
   /* extract thread data */
   my_data = (Pthreads_Data*)thread_data;
@@ -1639,9 +1511,6 @@ static void* nvWSqrSumMaskPt(void* thread_data)
   wd  = my_data->v2;
   idd = my_data->v3;
 
-  global_sum   = my_data->global_val;
-  global_mutex = my_data->global_mutex;
-
   start = my_data->start;
   end   = my_data->end;
 
@@ -1652,13 +1521,11 @@ static void* nvWSqrSumMaskPt(void* thread_data)
     if (idd[i] > ZERO) { local_sum += SUNSQR(xd[i] * wd[i]); }
   }
 
-  /* update global sum */
-  pthread_mutex_lock(global_mutex);
-  *global_sum += local_sum;
-  pthread_mutex_unlock(global_mutex);
+  /* store thread-local sum */
+  my_data->local_val = local_sum;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1671,30 +1538,18 @@ sunrealtype N_VMin_Pthreads(N_Vector x)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
   sunrealtype min;
 
   /* initialize global min */
   min = NV_Ith_PT(x, 0);
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -1704,21 +1559,20 @@ sunrealtype N_VMin_Pthreads(N_Vector x)
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].v1           = NV_DATA_PT(x);
-    thread_data[i].global_val   = &min;
-    thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvMinPt, (void*)&thread_data[i]);
+    thread_data[i].v1         = NV_DATA_PT(x);
+    thread_data[i].global_val = &min;
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, nvMinPt, thread_data);
+
+  /* combine thread-local results */
+  for (i = 0; i < nthreads; i++)
+  {
+    if (thread_data[i].local_val < min) { min = thread_data[i].local_val; }
+  }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
   free(thread_data);
 
   return (min);
@@ -1732,35 +1586,29 @@ static void* nvMinPt(void* thread_data)
 {
   sunindextype i, start, end;
   sunrealtype* xd;
-  sunrealtype local_min, *global_min;
+  sunrealtype local_min;
   Pthreads_Data* my_data;
-  pthread_mutex_t* global_mutex;
 
   /* extract thread data */
   my_data = (Pthreads_Data*)thread_data;
 
   xd = my_data->v1;
 
-  global_min   = my_data->global_val;
-  global_mutex = my_data->global_mutex;
-
   start = my_data->start;
   end   = my_data->end;
 
   /* find local min */
-  local_min = *global_min;
+  local_min = *(my_data->global_val);
   for (i = start; i < end; i++)
   {
     if (xd[i] < local_min) { local_min = xd[i]; }
   }
 
-  /* update global min */
-  pthread_mutex_lock(global_mutex);
-  if (local_min < *global_min) { *global_min = local_min; }
-  pthread_mutex_unlock(global_mutex);
+  /* store thread-local min */
+  my_data->local_val = local_min;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1773,27 +1621,15 @@ sunrealtype N_VWL2Norm_Pthreads(N_Vector x, N_Vector w)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
   sunrealtype sum = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -1803,22 +1639,17 @@ sunrealtype N_VWL2Norm_Pthreads(N_Vector x, N_Vector w)
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].v1           = NV_DATA_PT(x);
-    thread_data[i].v2           = NV_DATA_PT(w);
-    thread_data[i].global_val   = &sum;
-    thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvWL2NormPt, (void*)&thread_data[i]);
+    thread_data[i].v1 = NV_DATA_PT(x);
+    thread_data[i].v2 = NV_DATA_PT(w);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, nvWL2NormPt, thread_data);
+
+  /* combine thread-local results */
+  for (i = 0; i < nthreads; i++) { sum += thread_data[i].local_val; }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
   free(thread_data);
 
   return (SUNRsqrt(sum));
@@ -1832,9 +1663,8 @@ static void* nvWL2NormPt(void* thread_data)
 {
   sunindextype i, start, end;
   sunrealtype *xd, *wd;
-  sunrealtype local_sum, *global_sum;
+  sunrealtype local_sum;
   Pthreads_Data* my_data;
-  pthread_mutex_t* global_mutex;
 
   /* extract thread data */
   my_data = (Pthreads_Data*)thread_data;
@@ -1842,9 +1672,6 @@ static void* nvWL2NormPt(void* thread_data)
   xd = my_data->v1;
   wd = my_data->v2;
 
-  global_sum   = my_data->global_val;
-  global_mutex = my_data->global_mutex;
-
   start = my_data->start;
   end   = my_data->end;
 
@@ -1852,13 +1679,11 @@ static void* nvWL2NormPt(void* thread_data)
   local_sum = ZERO;
   for (i = start; i < end; i++) { local_sum += SUNSQR(xd[i] * wd[i]); }
 
-  /* update global sum */
-  pthread_mutex_lock(global_mutex);
-  *global_sum += local_sum;
-  pthread_mutex_unlock(global_mutex);
+  /* store thread-local sum */
+  my_data->local_val = local_sum;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1871,27 +1696,15 @@ sunrealtype N_VL1Norm_Pthreads(N_Vector x)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
   sunrealtype sum = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -1902,20 +1715,15 @@ sunrealtype N_VL1Norm_Pthreads(N_Vector x)
 
     /* pack thread data */
     thread_data[i].v1           = NV_DATA_PT(x);
-    thread_data[i].global_val   = &sum;
-    thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvL1NormPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, nvL1NormPt, thread_data);
+
+  /* combine thread-local results */
+  for (i = 0; i < nthreads; i++) { sum += thread_data[i].local_val; }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
   free(thread_data);
 
   return (sum);
@@ -1929,18 +1737,14 @@ static void* nvL1NormPt(void* thread_data)
 {
   sunindextype i, start, end;
   sunrealtype* xd;
-  sunrealtype local_sum, *global_sum;
+  sunrealtype local_sum;
   Pthreads_Data* my_data;
-  pthread_mutex_t* global_mutex;
 
   /* extract thread data */
   my_data = (Pthreads_Data*)thread_data;
 
   xd = my_data->v1;
 
-  global_sum   = my_data->global_val;
-  global_mutex = my_data->global_mutex;
-
   start = my_data->start;
   end   = my_data->end;
 
@@ -1948,13 +1752,11 @@ static void* nvL1NormPt(void* thread_data)
   local_sum = ZERO;
   for (i = start; i < end; i++) { local_sum += SUNRabs(xd[i]); }
 
-  /* update global sum */
-  pthread_mutex_lock(global_mutex);
-  *global_sum += local_sum;
-  pthread_mutex_unlock(global_mutex);
+  /* store thread-local sum */
+  my_data->local_val = local_sum;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -1967,22 +1769,14 @@ void N_VCompare_Pthreads(sunrealtype c, N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -1995,17 +1789,12 @@ void N_VCompare_Pthreads(sunrealtype c, N_Vector x, N_Vector z)
     thread_data[i].c1 = c;
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvComparePt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, nvComparePt, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return;
@@ -2036,7 +1825,7 @@ static void* nvComparePt(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = (SUNRabs(xd[i]) >= c) ? ONE : ZERO; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -2049,24 +1838,16 @@ sunbooleantype N_VInvTest_Pthreads(N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   sunrealtype val = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -2076,20 +1857,20 @@ sunbooleantype N_VInvTest_Pthreads(N_Vector x, N_Vector z)
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].v1         = NV_DATA_PT(x);
-    thread_data[i].v2         = NV_DATA_PT(z);
-    thread_data[i].global_val = &val;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvInvTestPt, (void*)&thread_data[i]);
+    thread_data[i].v1 = NV_DATA_PT(x);
+    thread_data[i].v2 = NV_DATA_PT(z);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, nvInvTestPt, thread_data);
+
+  /* combine thread-local results */
+  for (i = 0; i < nthreads; i++)
+  {
+    if (thread_data[i].local_val > ZERO) { val = thread_data[i].local_val; }
+  }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   if (val > ZERO) { return (SUNFALSE); }
@@ -2104,7 +1885,7 @@ static void* nvInvTestPt(void* thread_data)
 {
   sunindextype i, start, end;
   sunrealtype *xd, *zd;
-  sunrealtype local_val, *global_val;
+  sunrealtype local_val;
   Pthreads_Data* my_data;
 
   /* extract thread data */
@@ -2113,8 +1894,6 @@ static void* nvInvTestPt(void* thread_data)
   xd = my_data->v1;
   zd = my_data->v2;
 
-  global_val = my_data->global_val;
-
   start = my_data->start;
   end   = my_data->end;
 
@@ -2126,11 +1905,11 @@ static void* nvInvTestPt(void* thread_data)
     else { zd[i] = ONE / xd[i]; }
   }
 
-  /* update global val */
-  if (local_val > ZERO) { *global_val = local_val; }
+  /* store thread-local val */
+  my_data->local_val = local_val;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -2143,24 +1922,16 @@ sunbooleantype N_VConstrMask_Pthreads(N_Vector c, N_Vector x, N_Vector m)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   sunrealtype val = ZERO;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -2170,21 +1941,21 @@ sunbooleantype N_VConstrMask_Pthreads(N_Vector c, N_Vector x, N_Vector m)
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].v1         = NV_DATA_PT(c);
-    thread_data[i].v2         = NV_DATA_PT(x);
-    thread_data[i].v3         = NV_DATA_PT(m);
-    thread_data[i].global_val = &val;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvConstrMaskPt, (void*)&thread_data[i]);
+    thread_data[i].v1 = NV_DATA_PT(c);
+    thread_data[i].v2 = NV_DATA_PT(x);
+    thread_data[i].v3 = NV_DATA_PT(m);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, nvConstrMaskPt, thread_data);
+
+  /* combine thread-local results */
+  for (i = 0; i < nthreads; i++)
+  {
+    if (thread_data[i].local_val > ZERO) { val = thread_data[i].local_val; }
+  }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   if (val > ZERO) { return (SUNFALSE); }
@@ -2199,7 +1970,7 @@ static void* nvConstrMaskPt(void* thread_data)
 {
   sunindextype i, start, end;
   sunrealtype *cd, *xd, *md;
-  sunrealtype local_val, *global_val;
+  sunrealtype local_val;
   Pthreads_Data* my_data;
 
   /* extract thread data */
@@ -2209,8 +1980,6 @@ static void* nvConstrMaskPt(void* thread_data)
   xd = my_data->v2;
   md = my_data->v3;
 
-  global_val = my_data->global_val;
-
   start = my_data->start;
   end   = my_data->end;
 
@@ -2231,11 +2000,11 @@ static void* nvConstrMaskPt(void* thread_data)
     }
   }
 
-  /* update global val */
-  if (local_val > ZERO) { *global_val = local_val; }
+  /* store thread-local val */
+  my_data->local_val = local_val;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -2248,27 +2017,15 @@ sunrealtype N_VMinQuotient_Pthreads(N_Vector num, N_Vector denom)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
   sunrealtype min = SUN_BIG_REAL;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(num);
-  nthreads = NV_NUM_THREADS_PT(num);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(num);
+  nthreads    = NV_NUM_THREADS_PT(num);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -2278,22 +2035,20 @@ sunrealtype N_VMinQuotient_Pthreads(N_Vector num, N_Vector denom)
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].v1           = NV_DATA_PT(num);
-    thread_data[i].v2           = NV_DATA_PT(denom);
-    thread_data[i].global_val   = &min;
-    thread_data[i].global_mutex = &global_mutex;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvMinQuotientPt, (void*)&thread_data[i]);
+    thread_data[i].v1 = NV_DATA_PT(num);
+    thread_data[i].v2 = NV_DATA_PT(denom);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(num, nvMinQuotientPt, thread_data);
+
+  /* combine thread-local results */
+  for (i = 0; i < nthreads; i++)
+  {
+    if (thread_data[i].local_val < min) { min = thread_data[i].local_val; }
+  }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
   free(thread_data);
 
   return (min);
@@ -2307,9 +2062,8 @@ static void* nvMinQuotientPt(void* thread_data)
 {
   sunindextype i, start, end;
   sunrealtype *nd, *dd;
-  sunrealtype local_min, *global_min;
+  sunrealtype local_min;
   Pthreads_Data* my_data;
-  pthread_mutex_t* global_mutex;
 
   /* extract thread data */
   my_data = (Pthreads_Data*)thread_data;
@@ -2317,9 +2071,6 @@ static void* nvMinQuotientPt(void* thread_data)
   nd = my_data->v1;
   dd = my_data->v2;
 
-  global_min   = my_data->global_val;
-  global_mutex = my_data->global_mutex;
-
   start = my_data->start;
   end   = my_data->end;
 
@@ -2331,13 +2082,11 @@ static void* nvMinQuotientPt(void* thread_data)
     local_min = SUNMIN(local_min, nd[i] / dd[i]);
   }
 
-  /* update global min */
-  pthread_mutex_lock(global_mutex);
-  if (local_min < *global_min) { *global_min = local_min; }
-  pthread_mutex_unlock(global_mutex);
+  /* store thread-local min */
+  my_data->local_val = local_min;
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /*
@@ -2357,9 +2106,7 @@ SUNErrCode N_VLinearCombination_Pthreads(int nvec, sunrealtype* c, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -2381,17 +2128,11 @@ SUNErrCode N_VLinearCombination_Pthreads(int nvec, sunrealtype* c, N_Vector* X,
   }
 
   /* get vector length and data array */
-  N        = NV_LENGTH_PT(z);
-  nthreads = NV_NUM_THREADS_PT(z);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  N           = NV_LENGTH_PT(z);
+  nthreads    = NV_NUM_THREADS_PT(z);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -2405,18 +2146,12 @@ SUNErrCode N_VLinearCombination_Pthreads(int nvec, sunrealtype* c, N_Vector* X,
     thread_data[i].cvals = c;
     thread_data[i].Y1    = X;
     thread_data[i].x1    = z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvLinearCombinationPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(z, nvLinearCombinationPt, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return SUN_SUCCESS;
@@ -2455,7 +2190,7 @@ static void* nvLinearCombinationPt(void* thread_data)
       xd = NV_DATA_PT(my_data->Y1[i]);
       for (j = start; j < end; j++) { zd[j] += c[i] * xd[j]; }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -2469,7 +2204,7 @@ static void* nvLinearCombinationPt(void* thread_data)
       xd = NV_DATA_PT(my_data->Y1[i]);
       for (j = start; j < end; j++) { zd[j] += c[i] * xd[j]; }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -2482,7 +2217,7 @@ static void* nvLinearCombinationPt(void* thread_data)
     xd = NV_DATA_PT(my_data->Y1[i]);
     for (j = start; j < end; j++) { zd[j] += c[i] * xd[j]; }
   }
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -2496,9 +2231,7 @@ SUNErrCode N_VScaleAddMulti_Pthreads(int nvec, sunrealtype* a, N_Vector x,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -2512,17 +2245,11 @@ SUNErrCode N_VScaleAddMulti_Pthreads(int nvec, sunrealtype* a, N_Vector x,
   }
 
   /* get vector length and data array */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -2537,17 +2264,12 @@ SUNErrCode N_VScaleAddMulti_Pthreads(int nvec, sunrealtype* a, N_Vector x,
     thread_data[i].x1    = x;
     thread_data[i].Y1    = Y;
     thread_data[i].Y2    = Z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvScaleAddMultiPt, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, nvScaleAddMultiPt, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return SUN_SUCCESS;
@@ -2587,7 +2309,7 @@ static void* nvScaleAddMultiPt(void* thread_data)
       yd = NV_DATA_PT(my_data->Y1[i]);
       for (j = start; j < end; j++) { yd[j] += a[i] * xd[j]; }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -2599,7 +2321,7 @@ static void* nvScaleAddMultiPt(void* thread_data)
     zd = NV_DATA_PT(my_data->Y2[i]);
     for (j = start; j < end; j++) { zd[j] = a[i] * xd[j] + yd[j]; }
   }
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -2612,11 +2334,9 @@ SUNErrCode N_VDotProdMulti_Pthreads(int nvec, N_Vector x, N_Vector* Y,
   SUNFunctionBegin(x->sunctx);
 
   sunindextype N;
-  int i, nthreads;
-  pthread_t* threads;
+  int i, j, nthreads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
+  sunrealtype* partials;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -2632,20 +2352,15 @@ SUNErrCode N_VDotProdMulti_Pthreads(int nvec, N_Vector x, N_Vector* Y,
   /* initialize output array */
   for (i = 0; i < nvec; i++) { dotprods[i] = ZERO; }
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
+  /* allocate thread-local partial results */
+  partials = (sunrealtype*)malloc(nthreads * nvec * sizeof(sunrealtype));
+  SUNAssert(partials, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -2656,25 +2371,24 @@ SUNErrCode N_VDotProdMulti_Pthreads(int nvec, N_Vector x, N_Vector* Y,
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].nvec  = nvec;
-    thread_data[i].x1    = x;
-    thread_data[i].Y1    = Y;
-    thread_data[i].cvals = dotprods;
+    thread_data[i].nvec       = nvec;
+    thread_data[i].x1         = x;
+    thread_data[i].Y1         = Y;
+    thread_data[i].global_val = partials + i * nvec;
+  }
 
-    thread_data[i].global_mutex = &global_mutex;
+  /* run companion function on the thread pool */
+  nvRunThreads(x, nvDotProdMultiPt, thread_data);
 
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvDotProdMultiPt, (void*)&thread_data[i]);
+  /* combine thread-local results */
+  for (j = 0; j < nthreads; j++)
+  {
+    for (i = 0; i < nvec; i++) { dotprods[i] += partials[j * nvec + i]; }
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
   free(thread_data);
+  free(partials);
 
   return SUN_SUCCESS;
 }
@@ -2687,7 +2401,6 @@ static void* nvDotProdMultiPt(void* thread_data)
 {
   Pthreads_Data* my_data;
   sunindextype j, start, end;
-  pthread_mutex_t* lock;
 
   int i;
   sunrealtype sum;
@@ -2700,10 +2413,9 @@ static void* nvDotProdMultiPt(void* thread_data)
 
   start = my_data->start;
   end   = my_data->end;
-  lock  = my_data->global_mutex;
 
   xd       = NV_DATA_PT(my_data->x1);
-  dotprods = my_data->cvals;
+  dotprods = my_data->global_val;
 
   /* compute multiple dot products */
   for (i = 0; i < my_data->nvec; i++)
@@ -2711,14 +2423,146 @@ static void* nvDotProdMultiPt(void* thread_data)
     yd  = NV_DATA_PT(my_data->Y1[i]);
     sum = ZERO;
     for (j = start; j < end; j++) { sum += xd[j] * yd[j]; }
-    /* update global sum */
-    pthread_mutex_lock(lock);
-    dotprods[i] += sum;
-    pthread_mutex_unlock(lock);
+    /* store thread-local sum */
+    dotprods[i] = sum;
+  }
+
+  /* exit */
+  return (NULL);
+}
+
+/* -----------------------------------------------------------------------------
+ * Compute the linear combination z = c[i]*X[i] and its weighted root mean
+ * square norm
+ */
+
+SUNErrCode N_VLinearCombinationWrmsNorm_Pthreads(int nvec, sunrealtype* c,
+                                                 N_Vector* X, N_Vector z,
+                                                 N_Vector w, sunrealtype* nrm)
+{
+  SUNFunctionBegin(z->sunctx);
+  sunrealtype sum = ZERO;
+
+  SUNCheckCall(
+    N_VLinearCombinationWSqrSumLocal_Pthreads(nvec, c, X, z, w, &sum));
+  *nrm = SUNRsqrt(sum / NV_LENGTH_PT(z));
+
+  return SUN_SUCCESS;
+}
+
+/* -----------------------------------------------------------------------------
+ * Compute the linear combination z = c[i]*X[i] and its weighted square sum
+ */
+
+SUNErrCode N_VLinearCombinationWSqrSumLocal_Pthreads(int nvec, sunrealtype* c,
+                                                     N_Vector* X, N_Vector z,
+                                                     N_Vector w,
+                                                     sunrealtype* sum)
+{
+  SUNFunctionBegin(z->sunctx);
+
+  sunindextype N;
+  int i, nthreads;
+  Pthreads_Data* thread_data;
+  sunrealtype wsum = ZERO;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(z);
+  nthreads    = NV_NUM_THREADS_PT(z);
+  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
+  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
+
+  for (i = 0; i < nthreads; i++)
+  {
+    /* initialize thread data */
+    nvInitThreadData(&thread_data[i]);
+
+    /* compute start and end loop index for thread */
+    nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
+
+    /* pack thread data */
+    thread_data[i].nvec  = nvec;
+    thread_data[i].cvals = c;
+    thread_data[i].Y1    = X;
+    thread_data[i].x1    = z;
+    thread_data[i].v2    = NV_DATA_PT(w);
+  }
+
+  /* run companion function on the thread pool */
+  nvRunThreads(z, nvLinearCombinationWSqrSumPt, thread_data);
+
+  /* combine thread-local results */
+  for (i = 0; i < nthreads; i++) { wsum += thread_data[i].local_val; }
+
+  /* clean up and return */
+  free(thread_data);
+
+  *sum = wsum;
+
+  return SUN_SUCCESS;
+}
+
+/* -----------------------------------------------------------------------------
+ * Pthread companion function to N_VLinearCombinationWSqrSumLocal
+ *
+ * The thread's range is processed in blocks small enough to stay in cache, so
+ * the weighted square sum of a block is computed before it is evicted.
+ */
+
+static void* nvLinearCombinationWSqrSumPt(void* thread_data)
+{
+  Pthreads_Data* my_data;
+  sunindextype j, start, end, bstart, bend;
+
+  int i;
+  sunrealtype local_sum;
+  sunrealtype* c  = NULL;
+  sunrealtype* xd = NULL;
+  sunrealtype* zd = NULL;
+  sunrealtype* wd = NULL;
+
+  /* extract thread data */
+  my_data = (Pthreads_Data*)thread_data;
+
+  start = my_data->start;
+  end   = my_data->end;
+
+  c  = my_data->cvals;
+  zd = NV_DATA_PT(my_data->x1);
+  wd = my_data->v2;
+
+  local_sum = ZERO;
+  for (bstart = start; bstart < end; bstart += 1024)
+  {
+    bend = SUNMIN(bstart + 1024, end);
+
+    /* z = sum{ c[i] * X[i] }, z may be the same as X[0] */
+    if (my_data->Y1[0] != my_data->x1)
+    {
+      xd = NV_DATA_PT(my_data->Y1[0]);
+      for (j = bstart; j < bend; j++) { zd[j] = c[0] * xd[j]; }
+    }
+    else if (c[0] != ONE)
+    {
+      for (j = bstart; j < bend; j++) { zd[j] *= c[0]; }
+    }
+    for (i = 1; i < my_data->nvec; i++)
+    {
+      xd = NV_DATA_PT(my_data->Y1[i]);
+      for (j = bstart; j < bend; j++) { zd[j] += c[i] * xd[j]; }
+    }
+
+    for (j = bstart; j < bend; j++) { local_sum += SUNSQR(zd[j] * wd[j]); }
   }
 
+  /* store thread-local sum */
+  my_data->local_val = local_sum;
+
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /*
@@ -2739,9 +2583,7 @@ SUNErrCode N_VLinearSumVectorArray_Pthreads(int nvec, sunrealtype a,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   sunrealtype c;
   N_Vector* V1;
@@ -2837,17 +2679,11 @@ SUNErrCode N_VLinearSumVectorArray_Pthreads(int nvec, sunrealtype a,
   /*   (3) a,b == other, a !=b, a != -b                            */
 
   /* get vector length and data array */
-  N        = NV_LENGTH_PT(Z[0]);
-  nthreads = NV_NUM_THREADS_PT(Z[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  N           = NV_LENGTH_PT(Z[0]);
+  nthreads    = NV_NUM_THREADS_PT(Z[0]);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -2863,18 +2699,12 @@ SUNErrCode N_VLinearSumVectorArray_Pthreads(int nvec, sunrealtype a,
     thread_data[i].Y1   = X;
     thread_data[i].Y2   = Y;
     thread_data[i].Y3   = Z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvLinearSumVectorArrayPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(Z[0], nvLinearSumVectorArrayPt, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return SUN_SUCCESS;
@@ -2914,7 +2744,7 @@ static void* nvLinearSumVectorArrayPt(void* thread_data)
   }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -2928,9 +2758,7 @@ SUNErrCode N_VScaleVectorArray_Pthreads(int nvec, sunrealtype* c, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -2944,17 +2772,11 @@ SUNErrCode N_VScaleVectorArray_Pthreads(int nvec, sunrealtype* c, N_Vector* X,
   }
 
   /* get vector length and data array */
-  N        = NV_LENGTH_PT(Z[0]);
-  nthreads = NV_NUM_THREADS_PT(Z[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  N           = NV_LENGTH_PT(Z[0]);
+  nthreads    = NV_NUM_THREADS_PT(Z[0]);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -2968,18 +2790,12 @@ SUNErrCode N_VScaleVectorArray_Pthreads(int nvec, sunrealtype* c, N_Vector* X,
     thread_data[i].cvals = c;
     thread_data[i].Y1    = X;
     thread_data[i].Y2    = Z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvScaleVectorArrayPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(Z[0], nvScaleVectorArrayPt, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return SUN_SUCCESS;
@@ -3017,7 +2833,7 @@ static void* nvScaleVectorArrayPt(void* thread_data)
       xd = NV_DATA_PT(my_data->Y1[i]);
       for (j = start; j < end; j++) { xd[j] *= c[i]; }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -3029,7 +2845,7 @@ static void* nvScaleVectorArrayPt(void* thread_data)
     zd = NV_DATA_PT(my_data->Y2[i]);
     for (j = start; j < end; j++) { zd[j] = c[i] * xd[j]; }
   }
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -3042,9 +2858,7 @@ SUNErrCode N_VConstVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* Z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -3058,17 +2872,11 @@ SUNErrCode N_VConstVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* Z)
   }
 
   /* get vector length and data array */
-  N        = NV_LENGTH_PT(Z[0]);
-  nthreads = NV_NUM_THREADS_PT(Z[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  N           = NV_LENGTH_PT(Z[0]);
+  nthreads    = NV_NUM_THREADS_PT(Z[0]);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -3081,18 +2889,12 @@ SUNErrCode N_VConstVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* Z)
     thread_data[i].nvec = nvec;
     thread_data[i].c1   = c;
     thread_data[i].Y1   = Z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvConstVectorArrayPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(Z[0], nvConstVectorArrayPt, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return SUN_SUCCESS;
@@ -3124,7 +2926,7 @@ static void* nvConstVectorArrayPt(void* thread_data)
   }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -3137,11 +2939,9 @@ SUNErrCode N_VWrmsNormVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* W,
   SUNFunctionBegin(X[0]->sunctx);
 
   sunindextype N;
-  int i, nthreads;
-  pthread_t* threads;
+  int i, j, nthreads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
+  sunrealtype* partials;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -3157,20 +2957,15 @@ SUNErrCode N_VWrmsNormVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* W,
   /* initialize output array */
   for (i = 0; i < nvec; i++) { nrm[i] = ZERO; }
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
+  /* allocate thread-local partial results */
+  partials = (sunrealtype*)malloc(nthreads * nvec * sizeof(sunrealtype));
+  SUNAssert(partials, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -3181,29 +2976,27 @@ SUNErrCode N_VWrmsNormVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* W,
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].nvec  = nvec;
-    thread_data[i].Y1    = X;
-    thread_data[i].Y2    = W;
-    thread_data[i].cvals = nrm;
+    thread_data[i].nvec       = nvec;
+    thread_data[i].Y1         = X;
+    thread_data[i].Y2         = W;
+    thread_data[i].global_val = partials + i * nvec;
+  }
 
-    thread_data[i].global_mutex = &global_mutex;
+  /* run companion function on the thread pool */
+  nvRunThreads(X[0], nvWrmsNormVectorArrayPt, thread_data);
 
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvWrmsNormVectorArrayPt,
-                   (void*)&thread_data[i]);
+  /* combine thread-local results */
+  for (j = 0; j < nthreads; j++)
+  {
+    for (i = 0; i < nvec; i++) { nrm[i] += partials[j * nvec + i]; }
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
   /* finalize wrms calculation */
   for (i = 0; i < nvec; i++) { nrm[i] = SUNRsqrt(nrm[i] / N); }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
   free(thread_data);
+  free(partials);
 
   return SUN_SUCCESS;
 }
@@ -3216,7 +3009,6 @@ static void* nvWrmsNormVectorArrayPt(void* thread_data)
 {
   Pthreads_Data* my_data;
   sunindextype j, start, end;
-  pthread_mutex_t* lock;
 
   int i;
   sunrealtype sum;
@@ -3229,9 +3021,8 @@ static void* nvWrmsNormVectorArrayPt(void* thread_data)
 
   start = my_data->start;
   end   = my_data->end;
-  lock  = my_data->global_mutex;
 
-  nrm = my_data->cvals;
+  nrm = my_data->global_val;
 
   /* compute the WRMS norm for each vector in the vector array */
   for (i = 0; i < my_data->nvec; i++)
@@ -3240,14 +3031,12 @@ static void* nvWrmsNormVectorArrayPt(void* thread_data)
     wd  = NV_DATA_PT(my_data->Y2[i]);
     sum = ZERO;
     for (j = start; j < end; j++) { sum += SUNSQR(xd[j] * wd[j]); }
-    /* update global sum */
-    pthread_mutex_lock(lock);
-    nrm[i] += sum;
-    pthread_mutex_unlock(lock);
+    /* store thread-local sum */
+    nrm[i] = sum;
   }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -3260,11 +3049,9 @@ SUNErrCode N_VWrmsNormMaskVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector*
   SUNFunctionBegin(X[0]->sunctx);
 
   sunindextype N;
-  int i, nthreads;
-  pthread_t* threads;
+  int i, j, nthreads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
-  pthread_mutex_t global_mutex;
+  sunrealtype* partials;
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -3280,20 +3067,15 @@ SUNErrCode N_VWrmsNormMaskVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector*
   /* initialize output array */
   for (i = 0; i < nvec; i++) { nrm[i] = ZERO; }
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
-  /* lock for reduction */
-  pthread_mutex_init(&global_mutex, NULL);
+  /* allocate thread-local partial results */
+  partials = (sunrealtype*)malloc(nthreads * nvec * sizeof(sunrealtype));
+  SUNAssert(partials, SUN_ERR_MALLOC_FAIL);
 
   for (i = 0; i < nthreads; i++)
   {
@@ -3304,30 +3086,28 @@ SUNErrCode N_VWrmsNormMaskVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector*
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
 
     /* pack thread data */
-    thread_data[i].nvec  = nvec;
-    thread_data[i].Y1    = X;
-    thread_data[i].Y2    = W;
-    thread_data[i].x1    = id;
-    thread_data[i].cvals = nrm;
+    thread_data[i].nvec       = nvec;
+    thread_data[i].Y1         = X;
+    thread_data[i].Y2         = W;
+    thread_data[i].x1         = id;
+    thread_data[i].global_val = partials + i * nvec;
+  }
 
-    thread_data[i].global_mutex = &global_mutex;
+  /* run companion function on the thread pool */
+  nvRunThreads(X[0], nvWrmsNormMaskVectorArrayPt, thread_data);
 
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvWrmsNormMaskVectorArrayPt,
-                   (void*)&thread_data[i]);
+  /* combine thread-local results */
+  for (j = 0; j < nthreads; j++)
+  {
+    for (i = 0; i < nvec; i++) { nrm[i] += partials[j * nvec + i]; }
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
-
   /* finalize wrms calculation */
   for (i = 0; i < nvec; i++) { nrm[i] = SUNRsqrt(nrm[i] / N); }
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  pthread_mutex_destroy(&global_mutex);
-  free(threads);
   free(thread_data);
+  free(partials);
 
   return SUN_SUCCESS;
 }
@@ -3340,7 +3120,6 @@ static void* nvWrmsNormMaskVectorArrayPt(void* thread_data)
 {
   Pthreads_Data* my_data;
   sunindextype j, start, end;
-  pthread_mutex_t* lock;
 
   int i;
   sunrealtype sum;
@@ -3354,9 +3133,8 @@ static void* nvWrmsNormMaskVectorArrayPt(void* thread_data)
 
   start = my_data->start;
   end   = my_data->end;
-  lock  = my_data->global_mutex;
 
-  nrm = my_data->cvals;
+  nrm = my_data->global_val;
   idd = NV_DATA_PT(my_data->x1);
 
   /* compute the WRMS norm for each vector in the vector array */
@@ -3369,14 +3147,12 @@ static void* nvWrmsNormMaskVectorArrayPt(void* thread_data)
     {
       if (idd[j] > ZERO) { sum += SUNSQR(xd[j] * wd[j]); }
     }
-    /* update global sum */
-    pthread_mutex_lock(lock);
-    nrm[i] += sum;
-    pthread_mutex_unlock(lock);
+    /* store thread-local sum */
+    nrm[i] = sum;
   }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -3391,9 +3167,7 @@ SUNErrCode N_VScaleAddMultiVectorArray_Pthreads(int nvec, int nsum,
 
   sunindextype N;
   int i, j, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   N_Vector* YY;
   N_Vector* ZZ;
@@ -3450,17 +3224,11 @@ SUNErrCode N_VScaleAddMultiVectorArray_Pthreads(int nvec, int nsum,
    * ---------------------------- */
 
   /* get vector length and data array */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -3476,18 +3244,12 @@ SUNErrCode N_VScaleAddMultiVectorArray_Pthreads(int nvec, int nsum,
     thread_data[i].Y1    = X;
     thread_data[i].ZZ1   = Y;
     thread_data[i].ZZ2   = Z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvScaleAddMultiVectorArrayPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(X[0], nvScaleAddMultiVectorArrayPt, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return SUN_SUCCESS;
@@ -3530,7 +3292,7 @@ static void* nvScaleAddMultiVectorArrayPt(void* thread_data)
         for (k = start; k < end; k++) { yd[k] += a[j] * xd[k]; }
       }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -3546,7 +3308,7 @@ static void* nvScaleAddMultiVectorArrayPt(void* thread_data)
       for (k = start; k < end; k++) { zd[k] = a[j] * xd[k] + yd[k]; }
     }
   }
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -3561,9 +3323,7 @@ SUNErrCode N_VLinearCombinationVectorArray_Pthreads(int nvec, int nsum,
 
   sunindextype N;
   int i, j, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   sunrealtype* ctmp;
   N_Vector* Y;
@@ -3635,17 +3395,11 @@ SUNErrCode N_VLinearCombinationVectorArray_Pthreads(int nvec, int nsum,
    * -------------------------- */
 
   /* get vector length and data array */
-  N        = NV_LENGTH_PT(Z[0]);
-  nthreads = NV_NUM_THREADS_PT(Z[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  N           = NV_LENGTH_PT(Z[0]);
+  nthreads    = NV_NUM_THREADS_PT(Z[0]);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -3660,18 +3414,12 @@ SUNErrCode N_VLinearCombinationVectorArray_Pthreads(int nvec, int nsum,
     thread_data[i].cvals = c;
     thread_data[i].ZZ1   = X;
     thread_data[i].Y1    = Z;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, nvLinearCombinationVectorArrayPt,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(Z[0], nvLinearCombinationVectorArrayPt, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return SUN_SUCCESS;
@@ -3714,7 +3462,7 @@ static void* nvLinearCombinationVectorArrayPt(void* thread_data)
         for (k = start; k < end; k++) { zd[k] += c[i] * xd[k]; }
       }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -3732,7 +3480,7 @@ static void* nvLinearCombinationVectorArrayPt(void* thread_data)
         for (k = start; k < end; k++) { zd[k] += c[i] * xd[k]; }
       }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   /*
@@ -3749,7 +3497,7 @@ static void* nvLinearCombinationVectorArrayPt(void* thread_data)
       for (k = start; k < end; k++) { zd[k] += c[i] * xd[k]; }
     }
   }
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /*
@@ -3778,24 +3526,16 @@ SUNErrCode N_VBufPack_Pthreads(N_Vector x, void* buf)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   SUNAssert(buf, SUN_ERR_ARG_CORRUPT);
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -3807,17 +3547,12 @@ SUNErrCode N_VBufPack_Pthreads(N_Vector x, void* buf)
     /* pack thread data */
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = (sunrealtype*)buf;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VBufPack_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, VBufPack_PT, thread_data);
 
   /* clean up */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return SUN_SUCCESS;
@@ -3846,7 +3581,7 @@ static void* VBufPack_PT(void* thread_data)
   for (i = start; i < end; i++) { bd[i] = xd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* -----------------------------------------------------------------------------
@@ -3859,24 +3594,16 @@ SUNErrCode N_VBufUnpack_Pthreads(N_Vector x, void* buf)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
   SUNAssert(buf, SUN_ERR_ARG_CORRUPT);
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -3888,17 +3615,12 @@ SUNErrCode N_VBufUnpack_Pthreads(N_Vector x, void* buf)
     /* pack thread data */
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = (sunrealtype*)buf;
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VBufUnpack_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, VBufUnpack_PT, thread_data);
 
   /* clean up */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return SUN_SUCCESS;
@@ -3927,7 +3649,7 @@ static void* VBufUnpack_PT(void* thread_data)
   for (i = start; i < end; i++) { xd[i] = bd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /*
@@ -3946,22 +3668,14 @@ static void VCopy_Pthreads(N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -3973,17 +3687,12 @@ static void VCopy_Pthreads(N_Vector x, N_Vector z)
     /* pack thread data */
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VCopy_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, VCopy_PT, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return;
@@ -4012,7 +3721,7 @@ static void* VCopy_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = xd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4025,22 +3734,14 @@ static void VSum_Pthreads(N_Vector x, N_Vector y, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -4053,17 +3754,12 @@ static void VSum_Pthreads(N_Vector x, N_Vector y, N_Vector z)
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VSum_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, VSum_PT, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return;
@@ -4093,7 +3789,7 @@ static void* VSum_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = xd[i] + yd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4106,22 +3802,14 @@ static void VDiff_Pthreads(N_Vector x, N_Vector y, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -4134,17 +3822,12 @@ static void VDiff_Pthreads(N_Vector x, N_Vector y, N_Vector z)
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VDiff_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, VDiff_PT, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return;
@@ -4174,7 +3857,7 @@ static void* VDiff_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = xd[i] - yd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4187,22 +3870,14 @@ static void VNeg_Pthreads(N_Vector x, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -4214,17 +3889,12 @@ static void VNeg_Pthreads(N_Vector x, N_Vector z)
     /* pack thread data */
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VNeg_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, VNeg_PT, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return;
@@ -4253,7 +3923,7 @@ static void* VNeg_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = -xd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4266,22 +3936,14 @@ static void VScaleSum_Pthreads(sunrealtype c, N_Vector x, N_Vector y, N_Vector z
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -4295,17 +3957,12 @@ static void VScaleSum_Pthreads(sunrealtype c, N_Vector x, N_Vector y, N_Vector z
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VScaleSum_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, VScaleSum_PT, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return;
@@ -4337,7 +3994,7 @@ static void* VScaleSum_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = c * (xd[i] + yd[i]); }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4350,22 +4007,14 @@ static void VScaleDiff_Pthreads(sunrealtype c, N_Vector x, N_Vector y, N_Vector
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -4379,17 +4028,12 @@ static void VScaleDiff_Pthreads(sunrealtype c, N_Vector x, N_Vector y, N_Vector
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VScaleDiff_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, VScaleDiff_PT, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return;
@@ -4421,7 +4065,7 @@ static void* VScaleDiff_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = c * (xd[i] - yd[i]); }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4434,22 +4078,14 @@ static void VLin1_Pthreads(sunrealtype a, N_Vector x, N_Vector y, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -4463,17 +4099,12 @@ static void VLin1_Pthreads(sunrealtype a, N_Vector x, N_Vector y, N_Vector z)
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VLin1_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, VLin1_PT, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return;
@@ -4505,7 +4136,7 @@ static void* VLin1_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = (a * xd[i]) + yd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4518,22 +4149,14 @@ static void VLin2_Pthreads(sunrealtype a, N_Vector x, N_Vector y, N_Vector z)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -4547,17 +4170,12 @@ static void VLin2_Pthreads(sunrealtype a, N_Vector x, N_Vector y, N_Vector z)
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
     thread_data[i].v3 = NV_DATA_PT(z);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VLin2_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, VLin2_PT, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return;
@@ -4589,7 +4207,7 @@ static void* VLin2_PT(void* thread_data)
   for (i = start; i < end; i++) { zd[i] = (a * xd[i]) - yd[i]; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4602,22 +4220,14 @@ static void Vaxpy_Pthreads(sunrealtype a, N_Vector x, N_Vector y)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -4630,17 +4240,12 @@ static void Vaxpy_Pthreads(sunrealtype a, N_Vector x, N_Vector y)
     thread_data[i].c1 = a;
     thread_data[i].v1 = NV_DATA_PT(x);
     thread_data[i].v2 = NV_DATA_PT(y);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, Vaxpy_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, Vaxpy_PT, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return;
@@ -4673,7 +4278,7 @@ static void* Vaxpy_PT(void* thread_data)
     for (i = start; i < end; i++) { yd[i] += xd[i]; }
 
     /* exit */
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   if (a == -ONE)
@@ -4681,13 +4286,13 @@ static void* Vaxpy_PT(void* thread_data)
     for (i = start; i < end; i++) { yd[i] -= xd[i]; }
 
     /* exit */
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   for (i = start; i < end; i++) { yd[i] += a * xd[i]; }
 
   /* return */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /* ----------------------------------------------------------------------------
@@ -4700,22 +4305,14 @@ static void VScaleBy_Pthreads(sunrealtype a, N_Vector x)
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(x);
-  nthreads = NV_NUM_THREADS_PT(x);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(x);
+  nthreads    = NV_NUM_THREADS_PT(x);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   for (i = 0; i < nthreads; i++)
   {
     /* initialize thread data */
@@ -4727,17 +4324,12 @@ static void VScaleBy_Pthreads(sunrealtype a, N_Vector x)
     /* pack thread data */
     thread_data[i].c1 = a;
     thread_data[i].v1 = NV_DATA_PT(x);
-
-    /* create threads and call pthread companion function */
-    pthread_create(&threads[i], &attr, VScaleBy_PT, (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(x, VScaleBy_PT, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 
   return;
@@ -4767,7 +4359,7 @@ static void* VScaleBy_PT(void* thread_data)
   for (i = start; i < end; i++) { xd[i] *= a; }
 
   /* exit */
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /*
@@ -4783,22 +4375,14 @@ static void VSumVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* Y,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   /* pack thread data, distribute loop indices, and create threads/call kernel */
   for (i = 0; i < nthreads; i++)
   {
@@ -4810,17 +4394,12 @@ static void VSumVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* Y,
     thread_data[i].Y3   = Z;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VSumVectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(X[0], VSumVectorArray_PT, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 }
 
@@ -4846,7 +4425,7 @@ static void* VSumVectorArray_PT(void* thread_data)
     for (j = start; j < end; j++) { zd[j] = xd[j] + yd[j]; }
   }
 
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 static void VDiffVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* Y,
@@ -4856,22 +4435,14 @@ static void VDiffVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* Y,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   /* pack thread data, distribute loop indices, and create threads/call kernel */
   for (i = 0; i < nthreads; i++)
   {
@@ -4883,17 +4454,12 @@ static void VDiffVectorArray_Pthreads(int nvec, N_Vector* X, N_Vector* Y,
     thread_data[i].Y3   = Z;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VDiffVectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(X[0], VDiffVectorArray_PT, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 }
 
@@ -4919,7 +4485,7 @@ static void* VDiffVectorArray_PT(void* thread_data)
     for (j = start; j < end; j++) { zd[j] = xd[j] - yd[j]; }
   }
 
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 static void VScaleSumVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* X,
@@ -4929,22 +4495,14 @@ static void VScaleSumVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   /* pack thread data, distribute loop indices, and create threads/call kernel */
   for (i = 0; i < nthreads; i++)
   {
@@ -4957,17 +4515,12 @@ static void VScaleSumVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* X,
     thread_data[i].Y3   = Z;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VScaleSumVectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(X[0], VScaleSumVectorArray_PT, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 }
 
@@ -4995,7 +4548,7 @@ static void* VScaleSumVectorArray_PT(void* thread_data)
     for (j = start; j < end; j++) { zd[j] = c * (xd[j] + yd[j]); }
   }
 
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 static void VScaleDiffVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* X,
@@ -5005,22 +4558,14 @@ static void VScaleDiffVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   /* pack thread data, distribute loop indices, and create threads/call kernel */
   for (i = 0; i < nthreads; i++)
   {
@@ -5033,17 +4578,12 @@ static void VScaleDiffVectorArray_Pthreads(int nvec, sunrealtype c, N_Vector* X,
     thread_data[i].Y3   = Z;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VScaleDiffVectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(X[0], VScaleDiffVectorArray_PT, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 }
 
@@ -5071,7 +4611,7 @@ static void* VScaleDiffVectorArray_PT(void* thread_data)
     for (j = start; j < end; j++) { zd[j] = c * (xd[j] - yd[j]); }
   }
 
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 static void VLin1VectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
@@ -5081,22 +4621,14 @@ static void VLin1VectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   /* pack thread data, distribute loop indices, and create threads/call kernel */
   for (i = 0; i < nthreads; i++)
   {
@@ -5109,17 +4641,12 @@ static void VLin1VectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
     thread_data[i].Y3   = Z;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VLin1VectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(X[0], VLin1VectorArray_PT, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 }
 
@@ -5147,7 +4674,7 @@ static void* VLin1VectorArray_PT(void* thread_data)
     for (j = start; j < end; j++) { zd[j] = (a * xd[j]) + yd[j]; }
   }
 
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 static void VLin2VectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
@@ -5157,22 +4684,14 @@ static void VLin2VectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   /* pack thread data, distribute loop indices, and create threads/call kernel */
   for (i = 0; i < nthreads; i++)
   {
@@ -5185,17 +4704,12 @@ static void VLin2VectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
     thread_data[i].Y3   = Z;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VLin2VectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(X[0], VLin2VectorArray_PT, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 }
 
@@ -5223,7 +4737,7 @@ static void* VLin2VectorArray_PT(void* thread_data)
     for (j = start; j < end; j++) { zd[j] = (a * xd[j]) - yd[j]; }
   }
 
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 static void VaxpyVectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
@@ -5233,22 +4747,14 @@ static void VaxpyVectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
 
   sunindextype N;
   int i, nthreads;
-  pthread_t* threads;
   Pthreads_Data* thread_data;
-  pthread_attr_t attr;
 
-  /* allocate threads and thread data structs */
-  N        = NV_LENGTH_PT(X[0]);
-  nthreads = NV_NUM_THREADS_PT(X[0]);
-  threads  = malloc(nthreads * sizeof(pthread_t));
-  SUNAssertVoid(threads, SUN_ERR_MALLOC_FAIL);
+  /* allocate thread data structs */
+  N           = NV_LENGTH_PT(X[0]);
+  nthreads    = NV_NUM_THREADS_PT(X[0]);
   thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
   SUNAssertVoid(thread_data, SUN_ERR_MALLOC_FAIL);
 
-  /* set thread attributes */
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-
   /* pack thread data, distribute loop indices, and create threads/call kernel */
   for (i = 0; i < nthreads; i++)
   {
@@ -5260,17 +4766,12 @@ static void VaxpyVectorArray_Pthreads(int nvec, sunrealtype a, N_Vector* X,
     thread_data[i].Y2   = Y;
 
     nvSplitLoop(i, &nthreads, &N, &thread_data[i].start, &thread_data[i].end);
-
-    pthread_create(&threads[i], &attr, VaxpyVectorArray_PT,
-                   (void*)&thread_data[i]);
   }
 
-  /* wait for all threads to finish */
-  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+  /* run companion function on the thread pool */
+  nvRunThreads(X[0], VaxpyVectorArray_PT, thread_data);
 
   /* clean up and return */
-  pthread_attr_destroy(&attr);
-  free(threads);
   free(thread_data);
 }
 
@@ -5297,7 +4798,7 @@ static void* VaxpyVectorArray_PT(void* thread_data)
       yd = NV_DATA_PT(my_data->Y2[i]);
       for (j = start; j < end; j++) { yd[j] += xd[j]; }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   if (a == -ONE)
@@ -5308,7 +4809,7 @@ static void* VaxpyVectorArray_PT(void* thread_data)
       yd = NV_DATA_PT(my_data->Y2[i]);
       for (j = start; j < end; j++) { yd[j] -= xd[j]; }
     }
-    pthread_exit(NULL);
+    return (NULL);
   }
 
   for (i = 0; i < my_data->nvec; i++)
@@ -5317,7 +4818,7 @@ static void* VaxpyVectorArray_PT(void* thread_data)
     yd = NV_DATA_PT(my_data->Y2[i]);
     for (j = start; j < end; j++) { yd[j] += a * xd[j]; }
   }
-  pthread_exit(NULL);
+  return (NULL);
 }
 
 /*
@@ -5374,6 +4875,7 @@ static void nvInitThreadData(Pthreads_Data* thread_data)
   thread_data->v3           = NULL;
   thread_data->global_val   = NULL;
   thread_data->global_mutex = NULL;
+  thread_data->local_val    = ZERO;
 
   thread_data->nvec  = ZERO;
   thread_data->nsum  = ZERO;
@@ -5383,6 +4885,205 @@ static void nvInitThreadData(Pthreads_Data* thread_data)
   thread_data->Y3    = NULL;
 }
 
+/* ----------------------------------------------------------------------------
+ * Create a thread pool for operations split into nthreads chunks
+ */
+
+static struct _Pthreads_Pool* nvPoolCreate(int nthreads)
+{
+  struct _Pthreads_Pool* pool;
+
+  pool = (struct _Pthreads_Pool*)malloc(sizeof(struct _Pthreads_Pool));
+  if (pool == NULL) { return (NULL); }
+
+  pool->nthreads   = nthreads;
+  pool->nworkers   = 0;
+  pool->refcount   = 1;
+  pool->started    = SUNFALSE;
+  pool->shutdown   = SUNFALSE;
+  pool->generation = 0;
+  pool->pending    = 0;
+  pool->fn         = NULL;
+  pool->data       = NULL;
+  pool->threads    = NULL;
+  pool->workers    = NULL;
+
+  pthread_mutex_init(&pool->lock, NULL);
+  pthread_mutex_init(&pool->run_lock, NULL);
+  pthread_cond_init(&pool->work_cond, NULL);
+  pthread_cond_init(&pool->done_cond, NULL);
+
+  return (pool);
+}
+
+/* ----------------------------------------------------------------------------
+ * Add a reference to a thread pool
+ */
+
+static void nvPoolRetain(struct _Pthreads_Pool* pool)
+{
+  if (pool == NULL) { return; }
+
+  pthread_mutex_lock(&pool->lock);
+  pool->refcount++;
+  pthread_mutex_unlock(&pool->lock);
+}
+
+/* ----------------------------------------------------------------------------
+ * Remove a reference to a thread pool, stopping the workers and freeing the
+ * pool when no vectors remain
+ */
+
+static void nvPoolRelease(struct _Pthreads_Pool* pool)
+{
+  int i, refcount;
+
+  if (pool == NULL) { return; }
+
+  pthread_mutex_lock(&pool->lock);
+  refcount = --(pool->refcount);
+  if (refcount == 0)
+  {
+    pool->shutdown = SUNTRUE;
+    pthread_cond_broadcast(&pool->work_cond);
+  }
+  pthread_mutex_unlock(&pool->lock);
+
+  if (refcount > 0) { return; }
+
+  for (i = 0; i < pool->nworkers; i++) { pthread_join(pool->threads[i], NULL); }
+
+  pthread_mutex_destroy(&pool->lock);
+  pthread_mutex_destroy(&pool->run_lock);
+  pthread_cond_destroy(&pool->work_cond);
+  pthread_cond_destroy(&pool->done_cond);
+  free(pool->threads);
+  free(pool->workers);
+  free(pool);
+}
+
+/* ----------------------------------------------------------------------------
+ * Worker thread main loop: wait for an operation, compute the assigned chunk,
+ * and signal completion
+ */
+
+static void* nvPoolWorker(void* arg)
+{
+  int id;
+  unsigned long generation;
+  void* (*fn)(void*);
+  Pthreads_Data* data;
+  struct _Pthreads_Pool* pool;
+
+  id         = ((struct _Pthreads_Worker*)arg)->id;
+  generation = ((struct _Pthreads_Worker*)arg)->generation;
+  pool       = ((struct _Pthreads_Worker*)arg)->pool;
+
+  pthread_mutex_lock(&pool->lock);
+
+  for (;;)
+  {
+    /* park until a new operation is posted or the pool is shut down */
+    while (pool->generation == generation && !pool->shutdown)
+    {
+      pthread_cond_wait(&pool->work_cond, &pool->lock);
+    }
+    if (pool->shutdown) { break; }
+
+    generation = pool->generation;
+    fn         = pool->fn;
+    data       = pool->data;
+    pthread_mutex_unlock(&pool->lock);
+
+    /* compute this worker's chunk */
+    fn((void*)&data[id]);
+
+    pthread_mutex_lock(&pool->lock);
+    if (--(pool->pending) == 0) { pthread_cond_signal(&pool->done_cond); }
+  }
+
+  pthread_mutex_unlock(&pool->lock);
+
+  return (NULL);
+}
+
+/* ----------------------------------------------------------------------------
+ * Start the worker threads in a pool (called with the pool lock held). If a
+ * thread cannot be created the remaining chunks are computed by the caller.
+ */
+
+static void nvPoolStart(struct _Pthreads_Pool* pool)
+{
+  int i, nworkers;
+
+  pool->started = SUNTRUE;
+  nworkers      = pool->nthreads - 1;
+
+  pool->threads = (pthread_t*)malloc(nworkers * sizeof(pthread_t));
+  pool->workers = (struct _Pthreads_Worker*)malloc(
+    nworkers * sizeof(struct _Pthreads_Worker));
+  if (pool->threads == NULL || pool->workers == NULL) { return; }
+
+  for (i = 0; i < nworkers; i++)
+  {
+    pool->workers[i].id         = i + 1;
+    pool->workers[i].generation = pool->generation;
+    pool->workers[i].pool       = pool;
+    if (pthread_create(&pool->threads[i], NULL, nvPoolWorker,
+                       (void*)&pool->workers[i]) != 0)
+    {
+      break;
+    }
+    pool->nworkers++;
+  }
+}
+
+/* ----------------------------------------------------------------------------
+ * Run a companion function on each chunk of thread_data using the thread pool
+ * attached to v and wait for all chunks to complete
+ */
+
+static void nvRunThreads(N_Vector v, void* (*fn)(void*),
+                         Pthreads_Data* thread_data)
+{
+  int i;
+  struct _Pthreads_Pool* pool = NV_CONTENT_PT(v)->pool;
+
+  /* compute serially if no pool is available */
+  if (pool == NULL)
+  {
+    for (i = 0; i < NV_NUM_THREADS_PT(v); i++) { fn((void*)&thread_data[i]); }
+    return;
+  }
+
+  /* only one operation may use the pool at a time */
+  pthread_mutex_lock(&pool->run_lock);
+
+  /* post the operation to the workers */
+  pthread_mutex_lock(&pool->lock);
+  if (!pool->started) { nvPoolStart(pool); }
+  pool->fn      = fn;
+  pool->data    = thread_data;
+  pool->pending = pool->nworkers;
+  pool->generation++;
+  pthread_cond_broadcast(&pool->work_cond);
+  pthread_mutex_unlock(&pool->lock);
+
+  /* compute the first chunk and any chunks without a worker */
+  fn((void*)&thread_data[0]);
+  for (i = pool->nworkers + 1; i < pool->nthreads; i++)
+  {
+    fn((void*)&thread_data[i]);
+  }
+
+  /* wait for the workers to finish */
+  pthread_mutex_lock(&pool->lock);
+  while (pool->pending > 0) { pthread_cond_wait(&pool->done_cond, &pool->lock); }
+  pthread_mutex_unlock(&pool->lock);
+
+  pthread_mutex_unlock(&pool->run_lock);
+}
+
 /*
  * -----------------------------------------------------------------
  * Enable / Disable fused and vector array operations
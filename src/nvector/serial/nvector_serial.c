@@ -25,6 +25,7 @@
 #include <sundials/sundials_core.h>
 #include <sundials/sundials_errors.h>
 
+#include "nvector_serial_simd.h"
 #include "sundials_macros.h"
 
 #define ZERO   SUN_RCONST(0.0)
@@ -32,6 +33,12 @@
 #define ONE    SUN_RCONST(1.0)
 #define ONEPT5 SUN_RCONST(1.5)
 
+/* Number of entries per block in N_VLinearCombinationMulti */
+#define LINCOMB_BLOCK 256
+
+/* Private function to allocate vector data */
+static sunrealtype* VAllocData_Serial(sunindextype length);
+
 /* Private functions for special cases of vector operations */
 static void VCopy_Serial(N_Vector x, N_Vector z);             /* z=x       */
 static void VSum_Serial(N_Vector x, N_Vector y, N_Vector z);  /* z=x+y     */
@@ -121,7 +128,11 @@ N_Vector N_VNewEmpty_Serial(sunindextype length, SUNContext sunctx)
   v->ops->nvconstrmask   = N_VConstrMask_Serial;
   v->ops->nvminquotient  = N_VMinQuotient_Serial;
 
-  /* fused and vector array operations are disabled (NULL) by default */
+  /* fused and vector array operations are disabled (NULL) by default, except
+     for the fused update and norm, and the multiple linear combination, which
+     replace several passes over the data */
+  v->ops->nvlinearcombinationwrmsnorm = N_VLinearCombinationWrmsNorm_Serial;
+  v->ops->nvlinearcombinationmulti    = N_VLinearCombinationMulti_Serial;
 
   /* local reduction operations */
   v->ops->nvdotprodlocal     = N_VDotProd_Serial;
@@ -133,6 +144,8 @@ N_Vector N_VNewEmpty_Serial(sunindextype length, SUNContext sunctx)
   v->ops->nvminquotientlocal = N_VMinQuotient_Serial;
   v->ops->nvwsqrsumlocal     = N_VWSqrSumLocal_Serial;
   v->ops->nvwsqrsummasklocal = N_VWSqrSumMaskLocal_Serial;
+  v->ops->nvlinearcombinationwsqrsumlocal =
+    N_VLinearCombinationWSqrSumLocal_Serial;
 
   /* single buffer reduction operations */
   v->ops->nvdotprodmultilocal = N_VDotProdMulti_Serial;
@@ -182,7 +195,7 @@ N_Vector N_VNew_Serial(sunindextype length, SUNContext sunctx)
   data = NULL;
   if (length > 0)
   {
-    data = (sunrealtype*)malloc(length * sizeof(sunrealtype));
+    data = VAllocData_Serial(length);
     SUNAssertNull(data, SUN_ERR_MALLOC_FAIL);
   }
 
@@ -316,7 +329,7 @@ N_Vector N_VClone_Serial(N_Vector w)
   data = NULL;
   if (length > 0)
   {
-    data = (sunrealtype*)malloc(length * sizeof(sunrealtype));
+    data = VAllocData_Serial(length);
     SUNAssertNull(data, SUN_ERR_MALLOC_FAIL);
 
     /* Attach data */
@@ -388,9 +401,17 @@ void N_VLinearSum_Serial(sunrealtype a, N_Vector x, sunrealtype b, N_Vector y,
   sunrealtype c, *xd, *yd, *zd;
   N_Vector v1, v2;
   sunbooleantype test;
+  const nvSerialSimdKernels* simd = nvSerialSimd();
 
   xd = yd = zd = NULL;
 
+  /* the SIMD kernel covers all of the special cases below */
+  if (simd)
+  {
+    simd->axpby(NV_LENGTH_S(x), a, NV_DATA_S(x), b, NV_DATA_S(y), NV_DATA_S(z));
+    return;
+  }
+
   if ((b == ONE) && (z == y))
   { /* BLAS usage: axpy y <- ax+y */
     Vaxpy_Serial(a, x, y);
@@ -529,9 +550,16 @@ void N_VScale_Serial(sunrealtype c, N_Vector x, N_Vector z)
 {
   sunindextype i, N;
   sunrealtype *xd, *zd;
+  const nvSerialSimdKernels* simd = nvSerialSimd();
 
   xd = zd = NULL;
 
+  if (simd)
+  {
+    simd->scale(NV_LENGTH_S(x), c, NV_DATA_S(x), NV_DATA_S(z));
+    return;
+  }
+
   if (z == x)
   { /* BLAS usage: scale x <- cx */
     VScaleBy_Serial(c, x);
@@ -603,6 +631,7 @@ sunrealtype N_VDotProd_Serial(N_Vector x, N_Vector y)
 {
   sunindextype i, N;
   sunrealtype sum, *xd, *yd;
+  const nvSerialSimdKernels* simd = nvSerialSimd();
 
   sum = ZERO;
   xd = yd = NULL;
@@ -611,6 +640,8 @@ sunrealtype N_VDotProd_Serial(N_Vector x, N_Vector y)
   xd = NV_DATA_S(x);
   yd = NV_DATA_S(y);
 
+  if (simd) { return (simd->dot(N, xd, yd)); }
+
   for (i = 0; i < N; i++) { sum += xd[i] * yd[i]; }
 
   return (sum);
@@ -620,6 +651,7 @@ sunrealtype N_VMaxNorm_Serial(N_Vector x)
 {
   sunindextype i, N;
   sunrealtype max, *xd;
+  const nvSerialSimdKernels* simd = nvSerialSimd();
 
   max = ZERO;
   xd  = NULL;
@@ -627,6 +659,8 @@ sunrealtype N_VMaxNorm_Serial(N_Vector x)
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
 
+  if (simd) { return (simd->maxnorm(N, xd)); }
+
   for (i = 0; i < N; i++)
   {
     if (SUNRabs(xd[i]) > max) { max = SUNRabs(xd[i]); }
@@ -648,6 +682,7 @@ sunrealtype N_VWSqrSumLocal_Serial(N_Vector x, N_Vector w)
 {
   sunindextype i, N;
   sunrealtype sum, prodi, *xd, *wd;
+  const nvSerialSimdKernels* simd = nvSerialSimd();
 
   sum = ZERO;
   xd = wd = NULL;
@@ -656,6 +691,8 @@ sunrealtype N_VWSqrSumLocal_Serial(N_Vector x, N_Vector w)
   xd = NV_DATA_S(x);
   wd = NV_DATA_S(w);
 
+  if (simd) { return (simd->wsqrsum(N, xd, wd)); }
+
   for (i = 0; i < N; i++)
   {
     prodi = xd[i] * wd[i];
@@ -678,6 +715,7 @@ sunrealtype N_VWSqrSumMaskLocal_Serial(N_Vector x, N_Vector w, N_Vector id)
 {
   sunindextype i, N;
   sunrealtype sum, prodi, *xd, *wd, *idd;
+  const nvSerialSimdKernels* simd = nvSerialSimd();
 
   sum = ZERO;
   xd = wd = idd = NULL;
@@ -687,6 +725,8 @@ sunrealtype N_VWSqrSumMaskLocal_Serial(N_Vector x, N_Vector w, N_Vector id)
   wd  = NV_DATA_S(w);
   idd = NV_DATA_S(id);
 
+  if (simd) { return (simd->wsqrsummask(N, xd, wd, idd)); }
+
   for (i = 0; i < N; i++)
   {
     if (idd[i] > ZERO)
@@ -723,6 +763,7 @@ sunrealtype N_VWL2Norm_Serial(N_Vector x, N_Vector w)
 {
   sunindextype i, N;
   sunrealtype sum, prodi, *xd, *wd;
+  const nvSerialSimdKernels* simd = nvSerialSimd();
 
   sum = ZERO;
   xd = wd = NULL;
@@ -731,6 +772,8 @@ sunrealtype N_VWL2Norm_Serial(N_Vector x, N_Vector w)
   xd = NV_DATA_S(x);
   wd = NV_DATA_S(w);
 
+  if (simd) { return (SUNRsqrt(simd->wsqrsum(N, xd, wd))); }
+
   for (i = 0; i < N; i++)
   {
     prodi = xd[i] * wd[i];
@@ -744,6 +787,7 @@ sunrealtype N_VL1Norm_Serial(N_Vector x)
 {
   sunindextype i, N;
   sunrealtype sum, *xd;
+  const nvSerialSimdKernels* simd = nvSerialSimd();
 
   sum = ZERO;
   xd  = NULL;
@@ -751,6 +795,8 @@ sunrealtype N_VL1Norm_Serial(N_Vector x)
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
 
+  if (simd) { return (simd->l1norm(N, xd)); }
+
   for (i = 0; i < N; i++) { sum += SUNRabs(xd[i]); }
 
   return (sum);
@@ -872,8 +918,11 @@ SUNErrCode N_VLinearCombination_Serial(int nvec, sunrealtype* c, N_Vector* X,
 
   int i;
   sunindextype j, N;
-  sunrealtype* zd = NULL;
-  sunrealtype* xd = NULL;
+  sunrealtype* zd                 = NULL;
+  sunrealtype* xd                 = NULL;
+  sunrealtype* Xd_stack[16];
+  sunrealtype** Xd                = Xd_stack;
+  const nvSerialSimdKernels* simd = nvSerialSimd();
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -898,6 +947,22 @@ SUNErrCode N_VLinearCombination_Serial(int nvec, sunrealtype* c, N_Vector* X,
   N  = NV_LENGTH_S(z);
   zd = NV_DATA_S(z);
 
+  /*
+   * z = sum{ c[i] * X[i] } in a single pass over the data
+   */
+  if (simd)
+  {
+    if (nvec > 16)
+    {
+      Xd = (sunrealtype**)malloc(nvec * sizeof(sunrealtype*));
+      SUNAssert(Xd, SUN_ERR_MALLOC_FAIL);
+    }
+    for (i = 0; i < nvec; i++) { Xd[i] = NV_DATA_S(X[i]); }
+    simd->lincomb(N, nvec, c, Xd, zd);
+    if (Xd != Xd_stack) { free(Xd); }
+    return SUN_SUCCESS;
+  }
+
   /*
    * X[0] += c[i]*X[i], i = 1,...,nvec-1
    */
@@ -944,9 +1009,10 @@ SUNErrCode N_VScaleAddMulti_Serial(int nvec, sunrealtype* a, N_Vector x,
   SUNFunctionBegin(x->sunctx);
   int i;
   sunindextype j, N;
-  sunrealtype* xd = NULL;
-  sunrealtype* yd = NULL;
-  sunrealtype* zd = NULL;
+  sunrealtype* xd                 = NULL;
+  sunrealtype* yd                 = NULL;
+  sunrealtype* zd                 = NULL;
+  const nvSerialSimdKernels* simd = nvSerialSimd();
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -963,6 +1029,15 @@ SUNErrCode N_VScaleAddMulti_Serial(int nvec, sunrealtype* a, N_Vector x,
   N  = NV_LENGTH_S(x);
   xd = NV_DATA_S(x);
 
+  if (simd)
+  {
+    for (i = 0; i < nvec; i++)
+    {
+      simd->axpby(N, a[i], xd, ONE, NV_DATA_S(Y[i]), NV_DATA_S(Z[i]));
+    }
+    return SUN_SUCCESS;
+  }
+
   /*
    * Y[i][j] += a[i] * x[j]
    */
@@ -994,8 +1069,9 @@ SUNErrCode N_VDotProdMulti_Serial(int nvec, N_Vector x, N_Vector* Y,
   SUNFunctionBegin(x->sunctx);
   int i;
   sunindextype j, N;
-  sunrealtype* xd = NULL;
-  sunrealtype* yd = NULL;
+  sunrealtype* xd                 = NULL;
+  sunrealtype* yd                 = NULL;
+  const nvSerialSimdKernels* simd = nvSerialSimd();
 
   /* invalid number of vectors */
   SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
@@ -1013,6 +1089,15 @@ SUNErrCode N_VDotProdMulti_Serial(int nvec, N_Vector x, N_Vector* Y,
   xd = NV_DATA_S(x);
 
   /* compute multiple dot products */
+  if (simd)
+  {
+    for (i = 0; i < nvec; i++)
+    {
+      dotprods[i] = simd->dot(N, xd, NV_DATA_S(Y[i]));
+    }
+    return SUN_SUCCESS;
+  }
+
   for (i = 0; i < nvec; i++)
   {
     yd          = NV_DATA_S(Y[i]);
@@ -1023,6 +1108,123 @@ SUNErrCode N_VDotProdMulti_Serial(int nvec, N_Vector x, N_Vector* Y,
   return SUN_SUCCESS;
 }
 
+SUNErrCode N_VLinearCombinationWrmsNorm_Serial(int nvec, sunrealtype* c,
+                                               N_Vector* X, N_Vector z,
+                                               N_Vector w, sunrealtype* nrm)
+{
+  SUNFunctionBegin(z->sunctx);
+  sunrealtype sum = ZERO;
+
+  SUNCheckCall(N_VLinearCombinationWSqrSumLocal_Serial(nvec, c, X, z, w, &sum));
+  *nrm = SUNRsqrt(sum / NV_LENGTH_S(z));
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VLinearCombinationWSqrSumLocal_Serial(int nvec, sunrealtype* c,
+                                                   N_Vector* X, N_Vector z,
+                                                   N_Vector w,
+                                                   sunrealtype* sum)
+{
+  SUNFunctionBegin(z->sunctx);
+
+  int i;
+  sunindextype j, N;
+  sunrealtype wsum, prodj, *zd, *wd;
+  sunrealtype* Xd_stack[16];
+  sunrealtype** Xd                = Xd_stack;
+  const nvSerialSimdKernels* simd = nvSerialSimd();
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* get vector length and data arrays */
+  N  = NV_LENGTH_S(z);
+  zd = NV_DATA_S(z);
+  wd = NV_DATA_S(w);
+
+  if (nvec > 16)
+  {
+    Xd = (sunrealtype**)malloc(nvec * sizeof(sunrealtype*));
+    SUNAssert(Xd, SUN_ERR_MALLOC_FAIL);
+  }
+  for (i = 0; i < nvec; i++) { Xd[i] = NV_DATA_S(X[i]); }
+
+  /*
+   * z = sum{ c[i] * X[i] } and sum{ (z * w)^2 } in a single pass over the
+   * data
+   */
+  if (simd) { wsum = simd->lincombwsqrsum(N, nvec, c, Xd, zd, wd); }
+  else
+  {
+    wsum = ZERO;
+    for (j = 0; j < N; j++)
+    {
+      prodj = c[0] * Xd[0][j];
+      for (i = 1; i < nvec; i++) { prodj += c[i] * Xd[i][j]; }
+      zd[j] = prodj;
+      prodj *= wd[j];
+      wsum += SUNSQR(prodj);
+    }
+  }
+
+  if (Xd != Xd_stack) { free(Xd); }
+
+  *sum = wsum;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VLinearCombinationMulti_Serial(int nvec, int nsum, sunrealtype* c,
+                                            N_Vector* X, N_Vector* Z)
+{
+  SUNFunctionBegin(Z[0]->sunctx);
+
+  int i, k;
+  sunindextype j, jb, jend, N;
+  sunrealtype* ck = NULL;
+  sunrealtype* zd = NULL;
+  sunrealtype* Xd_stack[16];
+  sunrealtype** Xd = Xd_stack;
+
+  /* invalid number of vectors */
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssert(nsum >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* get vector length and data arrays */
+  N = NV_LENGTH_S(Z[0]);
+
+  if (nvec > 16)
+  {
+    Xd = (sunrealtype**)malloc(nvec * sizeof(sunrealtype*));
+    SUNAssert(Xd, SUN_ERR_MALLOC_FAIL);
+  }
+  for (i = 0; i < nvec; i++) { Xd[i] = NV_DATA_S(X[i]); }
+
+  /*
+   * Z[k] = sum{ c[k*nvec+i] * X[i] }, k = 0,...,nsum-1, over blocks of
+   * entries so each block of X stays in cache while all Z[k] are formed
+   */
+  for (jb = 0; jb < N; jb += LINCOMB_BLOCK)
+  {
+    jend = SUNMIN(jb + LINCOMB_BLOCK, N);
+    for (k = 0; k < nsum; k++)
+    {
+      ck = c + k * nvec;
+      zd = NV_DATA_S(Z[k]);
+      for (j = jb; j < jend; j++) { zd[j] = ck[0] * Xd[0][j]; }
+      for (i = 1; i < nvec; i++)
+      {
+        for (j = jb; j < jend; j++) { zd[j] += ck[i] * Xd[i][j]; }
+      }
+    }
+  }
+
+  if (Xd != Xd_stack) { free(Xd); }
+
+  return SUN_SUCCESS;
+}
+
 /*
  * -----------------------------------------------------------------
  * vector array operations
@@ -1594,6 +1796,22 @@ SUNErrCode N_VBufUnpack_Serial(N_Vector x, void* buf)
  * -----------------------------------------------------------------
  */
 
+static sunrealtype* VAllocData_Serial(sunindextype length)
+{
+#if defined(SUNDIALS_HAVE_POSIX_MEMALIGN)
+  /* align the data to a cache line so the SIMD kernels do not load values
+     that are split across two lines, the data is still released with free */
+  void* data = NULL;
+  if (posix_memalign(&data, NV_SERIAL_ALIGNMENT, length * sizeof(sunrealtype)))
+  {
+    return NULL;
+  }
+  return (sunrealtype*)data;
+#else
+  return (sunrealtype*)malloc(length * sizeof(sunrealtype));
+#endif
+}
+
 static void VCopy_Serial(N_Vector x, N_Vector z)
 {
   sunindextype i, N;
@@ -0,0 +1,1021 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation file for the explicitly vectorized
+ * (SIMD) kernels of the serial NVECTOR.
+ *
+ * The AVX2 and AVX-512 kernels are compiled with function target
+ * attributes, so the library itself does not require these
+ * instruction sets, and the kernels are selected at runtime from
+ * the features reported by the CPU. NEON is part of the baseline
+ * AArch64 instruction set and is used whenever it is available.
+ *
+ * Reductions keep several independent partial sums so consecutive
+ * iterations do not wait on the same accumulator. The result is
+ * deterministic but may differ in the last bits from the sequential
+ * sum of the scalar loops. For this reason the kernels are opt-in:
+ * the scalar loops are used unless the environment variable
+ * SUNDIALS_SIMD is set to "auto" (the best kernels the CPU supports)
+ * or "avx2" (limits the kernels to AVX2).
+ * -----------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+
+#include "nvector_serial_simd.h"
+
+#if defined(SUNDIALS_DOUBLE_PRECISION) && defined(SUNDIALS_HAVE_X86_SIMD)
+#define NV_SIMD_X86
+#include <immintrin.h>
+#endif
+
+#if defined(SUNDIALS_DOUBLE_PRECISION) && defined(__aarch64__) && \
+  defined(__ARM_NEON)
+#define NV_SIMD_NEON
+#include <arm_neon.h>
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+
+/*
+ * -----------------------------------------------------------------
+ * AVX2 kernels (4 doubles per register)
+ * -----------------------------------------------------------------
+ */
+
+#if defined(NV_SIMD_X86)
+
+#define NV_AVX2 __attribute__((target("avx2,fma")))
+
+NV_AVX2 static inline double hsum_avx2(__m256d v)
+{
+  __m128d lo = _mm256_castpd256_pd128(v);
+  __m128d hi = _mm256_extractf128_pd(v, 1);
+  lo         = _mm_add_pd(lo, hi);
+  hi         = _mm_unpackhi_pd(lo, lo);
+  return _mm_cvtsd_f64(_mm_add_sd(lo, hi));
+}
+
+NV_AVX2 static inline double hmax_avx2(__m256d v)
+{
+  __m128d lo = _mm256_castpd256_pd128(v);
+  __m128d hi = _mm256_extractf128_pd(v, 1);
+  lo         = _mm_max_pd(lo, hi);
+  hi         = _mm_unpackhi_pd(lo, lo);
+  return _mm_cvtsd_f64(_mm_max_sd(lo, hi));
+}
+
+NV_AVX2 static inline __m256d abs_avx2(__m256d v)
+{
+  return _mm256_andnot_pd(_mm256_set1_pd(-0.0), v);
+}
+
+NV_AVX2 static void axpby_avx2(sunindextype n, sunrealtype a,
+                               const sunrealtype* x, sunrealtype b,
+                               const sunrealtype* y, sunrealtype* z)
+{
+  const __m256d va = _mm256_set1_pd(a);
+  const __m256d vb = _mm256_set1_pd(b);
+  sunindextype i   = 0;
+
+  for (; i + 4 <= n; i += 4)
+  {
+    __m256d by = _mm256_mul_pd(vb, _mm256_loadu_pd(y + i));
+    _mm256_storeu_pd(z + i, _mm256_fmadd_pd(va, _mm256_loadu_pd(x + i), by));
+  }
+  for (; i < n; i++) { z[i] = a * x[i] + b * y[i]; }
+}
+
+NV_AVX2 static void scale_avx2(sunindextype n, sunrealtype c,
+                               const sunrealtype* x, sunrealtype* z)
+{
+  const __m256d vc = _mm256_set1_pd(c);
+  sunindextype i   = 0;
+
+  for (; i + 4 <= n; i += 4)
+  {
+    _mm256_storeu_pd(z + i, _mm256_mul_pd(vc, _mm256_loadu_pd(x + i)));
+  }
+  for (; i < n; i++) { z[i] = c * x[i]; }
+}
+
+NV_AVX2 static void lincomb_avx2(sunindextype n, int nvec, const sunrealtype* c,
+                                 sunrealtype* const* X, sunrealtype* z)
+{
+  sunindextype i = 0;
+  sunrealtype sum;
+  int k;
+
+  for (; i + 4 <= n; i += 4)
+  {
+    __m256d acc = _mm256_mul_pd(_mm256_set1_pd(c[0]),
+                                _mm256_loadu_pd(X[0] + i));
+    for (k = 1; k < nvec; k++)
+    {
+      acc = _mm256_fmadd_pd(_mm256_set1_pd(c[k]), _mm256_loadu_pd(X[k] + i),
+                            acc);
+    }
+    _mm256_storeu_pd(z + i, acc);
+  }
+  for (; i < n; i++)
+  {
+    sum = c[0] * X[0][i];
+    for (k = 1; k < nvec; k++) { sum += c[k] * X[k][i]; }
+    z[i] = sum;
+  }
+}
+
+NV_AVX2 static sunrealtype dot_avx2(sunindextype n, const sunrealtype* x,
+                                    const sunrealtype* y)
+{
+  __m256d s0     = _mm256_setzero_pd();
+  __m256d s1     = _mm256_setzero_pd();
+  __m256d s2     = _mm256_setzero_pd();
+  __m256d s3     = _mm256_setzero_pd();
+  sunindextype i = 0;
+  sunrealtype sum;
+
+  for (; i + 16 <= n; i += 16)
+  {
+    s0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i), s0);
+    s1 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i + 4), _mm256_loadu_pd(y + i + 4),
+                         s1);
+    s2 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i + 8), _mm256_loadu_pd(y + i + 8),
+                         s2);
+    s3 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i + 12),
+                         _mm256_loadu_pd(y + i + 12), s3);
+  }
+  for (; i + 4 <= n; i += 4)
+  {
+    s0 = _mm256_fmadd_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(y + i), s0);
+  }
+
+  sum = hsum_avx2(_mm256_add_pd(_mm256_add_pd(s0, s1), _mm256_add_pd(s2, s3)));
+  for (; i < n; i++) { sum += x[i] * y[i]; }
+
+  return sum;
+}
+
+NV_AVX2 static sunrealtype wsqrsum_avx2(sunindextype n, const sunrealtype* x,
+                                        const sunrealtype* w)
+{
+  __m256d s0     = _mm256_setzero_pd();
+  __m256d s1     = _mm256_setzero_pd();
+  __m256d s2     = _mm256_setzero_pd();
+  __m256d s3     = _mm256_setzero_pd();
+  __m256d p0, p1, p2, p3;
+  sunindextype i = 0;
+  sunrealtype sum, prodi;
+
+  for (; i + 16 <= n; i += 16)
+  {
+    p0 = _mm256_mul_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(w + i));
+    p1 = _mm256_mul_pd(_mm256_loadu_pd(x + i + 4), _mm256_loadu_pd(w + i + 4));
+    p2 = _mm256_mul_pd(_mm256_loadu_pd(x + i + 8), _mm256_loadu_pd(w + i + 8));
+    p3 = _mm256_mul_pd(_mm256_loadu_pd(x + i + 12),
+                       _mm256_loadu_pd(w + i + 12));
+    s0 = _mm256_fmadd_pd(p0, p0, s0);
+    s1 = _mm256_fmadd_pd(p1, p1, s1);
+    s2 = _mm256_fmadd_pd(p2, p2, s2);
+    s3 = _mm256_fmadd_pd(p3, p3, s3);
+  }
+  for (; i + 4 <= n; i += 4)
+  {
+    p0 = _mm256_mul_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(w + i));
+    s0 = _mm256_fmadd_pd(p0, p0, s0);
+  }
+
+  sum = hsum_avx2(_mm256_add_pd(_mm256_add_pd(s0, s1), _mm256_add_pd(s2, s3)));
+  for (; i < n; i++)
+  {
+    prodi = x[i] * w[i];
+    sum += prodi * prodi;
+  }
+
+  return sum;
+}
+
+NV_AVX2 static sunrealtype wsqrsummask_avx2(sunindextype n,
+                                            const sunrealtype* x,
+                                            const sunrealtype* w,
+                                            const sunrealtype* id)
+{
+  const __m256d zero = _mm256_setzero_pd();
+  __m256d s0         = _mm256_setzero_pd();
+  __m256d s1         = _mm256_setzero_pd();
+  __m256d p0, p1, m0, m1;
+  sunindextype i = 0;
+  sunrealtype sum, prodi;
+
+  /* products with id <= 0 are zeroed by the comparison mask */
+  for (; i + 8 <= n; i += 8)
+  {
+    m0 = _mm256_cmp_pd(_mm256_loadu_pd(id + i), zero, _CMP_GT_OQ);
+    m1 = _mm256_cmp_pd(_mm256_loadu_pd(id + i + 4), zero, _CMP_GT_OQ);
+    p0 = _mm256_mul_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(w + i));
+    p1 = _mm256_mul_pd(_mm256_loadu_pd(x + i + 4), _mm256_loadu_pd(w + i + 4));
+    p0 = _mm256_and_pd(p0, m0);
+    p1 = _mm256_and_pd(p1, m1);
+    s0 = _mm256_fmadd_pd(p0, p0, s0);
+    s1 = _mm256_fmadd_pd(p1, p1, s1);
+  }
+  for (; i + 4 <= n; i += 4)
+  {
+    m0 = _mm256_cmp_pd(_mm256_loadu_pd(id + i), zero, _CMP_GT_OQ);
+    p0 = _mm256_mul_pd(_mm256_loadu_pd(x + i), _mm256_loadu_pd(w + i));
+    p0 = _mm256_and_pd(p0, m0);
+    s0 = _mm256_fmadd_pd(p0, p0, s0);
+  }
+
+  sum = hsum_avx2(_mm256_add_pd(s0, s1));
+  for (; i < n; i++)
+  {
+    if (id[i] > ZERO)
+    {
+      prodi = x[i] * w[i];
+      sum += prodi * prodi;
+    }
+  }
+
+  return sum;
+}
+
+NV_AVX2 static sunrealtype maxnorm_avx2(sunindextype n, const sunrealtype* x)
+{
+  __m256d m0     = _mm256_setzero_pd();
+  __m256d m1     = _mm256_setzero_pd();
+  __m256d m2     = _mm256_setzero_pd();
+  __m256d m3     = _mm256_setzero_pd();
+  sunindextype i = 0;
+  sunrealtype max;
+
+  /* the accumulator is the second operand so NaN entries are skipped as in
+     the scalar loop */
+  for (; i + 16 <= n; i += 16)
+  {
+    m0 = _mm256_max_pd(abs_avx2(_mm256_loadu_pd(x + i)), m0);
+    m1 = _mm256_max_pd(abs_avx2(_mm256_loadu_pd(x + i + 4)), m1);
+    m2 = _mm256_max_pd(abs_avx2(_mm256_loadu_pd(x + i + 8)), m2);
+    m3 = _mm256_max_pd(abs_avx2(_mm256_loadu_pd(x + i + 12)), m3);
+  }
+  for (; i + 4 <= n; i += 4)
+  {
+    m0 = _mm256_max_pd(abs_avx2(_mm256_loadu_pd(x + i)), m0);
+  }
+
+  max = hmax_avx2(_mm256_max_pd(_mm256_max_pd(m0, m1), _mm256_max_pd(m2, m3)));
+  for (; i < n; i++)
+  {
+    if (SUNRabs(x[i]) > max) { max = SUNRabs(x[i]); }
+  }
+
+  return max;
+}
+
+NV_AVX2 static sunrealtype l1norm_avx2(sunindextype n, const sunrealtype* x)
+{
+  __m256d s0     = _mm256_setzero_pd();
+  __m256d s1     = _mm256_setzero_pd();
+  __m256d s2     = _mm256_setzero_pd();
+  __m256d s3     = _mm256_setzero_pd();
+  sunindextype i = 0;
+  sunrealtype sum;
+
+  for (; i + 16 <= n; i += 16)
+  {
+    s0 = _mm256_add_pd(abs_avx2(_mm256_loadu_pd(x + i)), s0);
+    s1 = _mm256_add_pd(abs_avx2(_mm256_loadu_pd(x + i + 4)), s1);
+    s2 = _mm256_add_pd(abs_avx2(_mm256_loadu_pd(x + i + 8)), s2);
+    s3 = _mm256_add_pd(abs_avx2(_mm256_loadu_pd(x + i + 12)), s3);
+  }
+  for (; i + 4 <= n; i += 4)
+  {
+    s0 = _mm256_add_pd(abs_avx2(_mm256_loadu_pd(x + i)), s0);
+  }
+
+  sum = hsum_avx2(_mm256_add_pd(_mm256_add_pd(s0, s1), _mm256_add_pd(s2, s3)));
+  for (; i < n; i++) { sum += SUNRabs(x[i]); }
+
+  return sum;
+}
+
+NV_AVX2 static sunrealtype lincombwsqrsum_avx2(sunindextype n, int nvec,
+                                               const sunrealtype* c,
+                                               sunrealtype* const* X,
+                                               sunrealtype* z,
+                                               const sunrealtype* w)
+{
+  __m256d s      = _mm256_setzero_pd();
+  __m256d acc, p;
+  sunindextype i = 0;
+  sunrealtype sum, prodi;
+  int k;
+
+  for (; i + 4 <= n; i += 4)
+  {
+    acc = _mm256_mul_pd(_mm256_set1_pd(c[0]), _mm256_loadu_pd(X[0] + i));
+    for (k = 1; k < nvec; k++)
+    {
+      acc = _mm256_fmadd_pd(_mm256_set1_pd(c[k]), _mm256_loadu_pd(X[k] + i),
+                            acc);
+    }
+    _mm256_storeu_pd(z + i, acc);
+    p = _mm256_mul_pd(acc, _mm256_loadu_pd(w + i));
+    s = _mm256_fmadd_pd(p, p, s);
+  }
+
+  sum = hsum_avx2(s);
+  for (; i < n; i++)
+  {
+    prodi = c[0] * X[0][i];
+    for (k = 1; k < nvec; k++) { prodi += c[k] * X[k][i]; }
+    z[i] = prodi;
+    prodi *= w[i];
+    sum += prodi * prodi;
+  }
+
+  return sum;
+}
+
+static const nvSerialSimdKernels kernels_avx2 = {"avx2",
+                                                 axpby_avx2,
+                                                 scale_avx2,
+                                                 lincomb_avx2,
+                                                 dot_avx2,
+                                                 wsqrsum_avx2,
+                                                 wsqrsummask_avx2,
+                                                 maxnorm_avx2,
+                                                 l1norm_avx2,
+                                                 lincombwsqrsum_avx2};
+
+/*
+ * -----------------------------------------------------------------
+ * AVX-512 kernels (8 doubles per register)
+ *
+ * The remainder of each loop is handled with masked loads and
+ * stores. Masked out lanes load as zero, which does not change the
+ * sums or the maximum of absolute values.
+ * -----------------------------------------------------------------
+ */
+
+#define NV_AVX512 __attribute__((target("avx512f")))
+
+NV_AVX512 static inline __mmask8 tail_avx512(sunindextype remaining)
+{
+  return (__mmask8)((1u << remaining) - 1u);
+}
+
+NV_AVX512 static void axpby_avx512(sunindextype n, sunrealtype a,
+                                   const sunrealtype* x, sunrealtype b,
+                                   const sunrealtype* y, sunrealtype* z)
+{
+  const __m512d va = _mm512_set1_pd(a);
+  const __m512d vb = _mm512_set1_pd(b);
+  __m512d by;
+  __mmask8 k;
+  sunindextype i = 0;
+
+  for (; i + 8 <= n; i += 8)
+  {
+    by = _mm512_mul_pd(vb, _mm512_loadu_pd(y + i));
+    _mm512_storeu_pd(z + i, _mm512_fmadd_pd(va, _mm512_loadu_pd(x + i), by));
+  }
+  if (i < n)
+  {
+    k  = tail_avx512(n - i);
+    by = _mm512_mul_pd(vb, _mm512_maskz_loadu_pd(k, y + i));
+    _mm512_mask_storeu_pd(z + i, k,
+                          _mm512_fmadd_pd(va, _mm512_maskz_loadu_pd(k, x + i),
+                                          by));
+  }
+}
+
+NV_AVX512 static void scale_avx512(sunindextype n, sunrealtype c,
+                                   const sunrealtype* x, sunrealtype* z)
+{
+  const __m512d vc = _mm512_set1_pd(c);
+  __mmask8 k;
+  sunindextype i = 0;
+
+  for (; i + 8 <= n; i += 8)
+  {
+    _mm512_storeu_pd(z + i, _mm512_mul_pd(vc, _mm512_loadu_pd(x + i)));
+  }
+  if (i < n)
+  {
+    k = tail_avx512(n - i);
+    _mm512_mask_storeu_pd(z + i, k,
+                          _mm512_mul_pd(vc, _mm512_maskz_loadu_pd(k, x + i)));
+  }
+}
+
+NV_AVX512 static void lincomb_avx512(sunindextype n, int nvec,
+                                     const sunrealtype* c,
+                                     sunrealtype* const* X, sunrealtype* z)
+{
+  __m512d acc;
+  __mmask8 k;
+  sunindextype i = 0;
+  int j;
+
+  for (; i + 8 <= n; i += 8)
+  {
+    acc = _mm512_mul_pd(_mm512_set1_pd(c[0]), _mm512_loadu_pd(X[0] + i));
+    for (j = 1; j < nvec; j++)
+    {
+      acc = _mm512_fmadd_pd(_mm512_set1_pd(c[j]), _mm512_loadu_pd(X[j] + i),
+                            acc);
+    }
+    _mm512_storeu_pd(z + i, acc);
+  }
+  if (i < n)
+  {
+    k   = tail_avx512(n - i);
+    acc = _mm512_mul_pd(_mm512_set1_pd(c[0]),
+                        _mm512_maskz_loadu_pd(k, X[0] + i));
+    for (j = 1; j < nvec; j++)
+    {
+      acc = _mm512_fmadd_pd(_mm512_set1_pd(c[j]),
+                            _mm512_maskz_loadu_pd(k, X[j] + i), acc);
+    }
+    _mm512_mask_storeu_pd(z + i, k, acc);
+  }
+}
+
+NV_AVX512 static sunrealtype dot_avx512(sunindextype n, const sunrealtype* x,
+                                        const sunrealtype* y)
+{
+  __m512d s0     = _mm512_setzero_pd();
+  __m512d s1     = _mm512_setzero_pd();
+  __m512d s2     = _mm512_setzero_pd();
+  __m512d s3     = _mm512_setzero_pd();
+  __mmask8 k;
+  sunindextype i = 0;
+
+  for (; i + 32 <= n; i += 32)
+  {
+    s0 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i), s0);
+    s1 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i + 8), _mm512_loadu_pd(y + i + 8),
+                         s1);
+    s2 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i + 16),
+                         _mm512_loadu_pd(y + i + 16), s2);
+    s3 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i + 24),
+                         _mm512_loadu_pd(y + i + 24), s3);
+  }
+  for (; i + 8 <= n; i += 8)
+  {
+    s0 = _mm512_fmadd_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(y + i), s0);
+  }
+  if (i < n)
+  {
+    k  = tail_avx512(n - i);
+    s1 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(k, x + i),
+                         _mm512_maskz_loadu_pd(k, y + i), s1);
+  }
+
+  return _mm512_reduce_add_pd(
+    _mm512_add_pd(_mm512_add_pd(s0, s1), _mm512_add_pd(s2, s3)));
+}
+
+NV_AVX512 static sunrealtype wsqrsum_avx512(sunindextype n,
+                                            const sunrealtype* x,
+                                            const sunrealtype* w)
+{
+  __m512d s0     = _mm512_setzero_pd();
+  __m512d s1     = _mm512_setzero_pd();
+  __m512d s2     = _mm512_setzero_pd();
+  __m512d s3     = _mm512_setzero_pd();
+  __m512d p0, p1, p2, p3;
+  __mmask8 k;
+  sunindextype i = 0;
+
+  for (; i + 32 <= n; i += 32)
+  {
+    p0 = _mm512_mul_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(w + i));
+    p1 = _mm512_mul_pd(_mm512_loadu_pd(x + i + 8), _mm512_loadu_pd(w + i + 8));
+    p2 = _mm512_mul_pd(_mm512_loadu_pd(x + i + 16),
+                       _mm512_loadu_pd(w + i + 16));
+    p3 = _mm512_mul_pd(_mm512_loadu_pd(x + i + 24),
+                       _mm512_loadu_pd(w + i + 24));
+    s0 = _mm512_fmadd_pd(p0, p0, s0);
+    s1 = _mm512_fmadd_pd(p1, p1, s1);
+    s2 = _mm512_fmadd_pd(p2, p2, s2);
+    s3 = _mm512_fmadd_pd(p3, p3, s3);
+  }
+  for (; i + 8 <= n; i += 8)
+  {
+    p0 = _mm512_mul_pd(_mm512_loadu_pd(x + i), _mm512_loadu_pd(w + i));
+    s0 = _mm512_fmadd_pd(p0, p0, s0);
+  }
+  if (i < n)
+  {
+    k  = tail_avx512(n - i);
+    p1 = _mm512_mul_pd(_mm512_maskz_loadu_pd(k, x + i),
+                       _mm512_maskz_loadu_pd(k, w + i));
+    s1 = _mm512_fmadd_pd(p1, p1, s1);
+  }
+
+  return _mm512_reduce_add_pd(
+    _mm512_add_pd(_mm512_add_pd(s0, s1), _mm512_add_pd(s2, s3)));
+}
+
+NV_AVX512 static sunrealtype wsqrsummask_avx512(sunindextype n,
+                                                const sunrealtype* x,
+                                                const sunrealtype* w,
+                                                const sunrealtype* id)
+{
+  const __m512d zero = _mm512_setzero_pd();
+  __m512d s0         = _mm512_setzero_pd();
+  __m512d s1         = _mm512_setzero_pd();
+  __m512d p0, p1;
+  __mmask8 m0, m1;
+  sunindextype i = 0;
+
+  /* products with id <= 0 are zeroed by the comparison mask */
+  for (; i + 16 <= n; i += 16)
+  {
+    m0 = _mm512_cmp_pd_mask(_mm512_loadu_pd(id + i), zero, _CMP_GT_OQ);
+    m1 = _mm512_cmp_pd_mask(_mm512_loadu_pd(id + i + 8), zero, _CMP_GT_OQ);
+    p0 = _mm512_maskz_mul_pd(m0, _mm512_loadu_pd(x + i),
+                             _mm512_loadu_pd(w + i));
+    p1 = _mm512_maskz_mul_pd(m1, _mm512_loadu_pd(x + i + 8),
+                             _mm512_loadu_pd(w + i + 8));
+    s0 = _mm512_fmadd_pd(p0, p0, s0);
+    s1 = _mm512_fmadd_pd(p1, p1, s1);
+  }
+  for (; i + 8 <= n; i += 8)
+  {
+    m0 = _mm512_cmp_pd_mask(_mm512_loadu_pd(id + i), zero, _CMP_GT_OQ);
+    p0 = _mm512_maskz_mul_pd(m0, _mm512_loadu_pd(x + i),
+                             _mm512_loadu_pd(w + i));
+    s0 = _mm512_fmadd_pd(p0, p0, s0);
+  }
+  if (i < n)
+  {
+    m0 = tail_avx512(n - i);
+    m1 = _mm512_mask_cmp_pd_mask(m0, _mm512_maskz_loadu_pd(m0, id + i), zero,
+                                 _CMP_GT_OQ);
+    p1 = _mm512_maskz_mul_pd(m1, _mm512_maskz_loadu_pd(m0, x + i),
+                             _mm512_maskz_loadu_pd(m0, w + i));
+    s1 = _mm512_fmadd_pd(p1, p1, s1);
+  }
+
+  return _mm512_reduce_add_pd(_mm512_add_pd(s0, s1));
+}
+
+NV_AVX512 static sunrealtype maxnorm_avx512(sunindextype n,
+                                            const sunrealtype* x)
+{
+  __m512d m0     = _mm512_setzero_pd();
+  __m512d m1     = _mm512_setzero_pd();
+  __m512d m2     = _mm512_setzero_pd();
+  __m512d m3     = _mm512_setzero_pd();
+  sunindextype i = 0;
+
+  /* the accumulator is the second operand so NaN entries are skipped as in
+     the scalar loop */
+  for (; i + 32 <= n; i += 32)
+  {
+    m0 = _mm512_max_pd(_mm512_abs_pd(_mm512_loadu_pd(x + i)), m0);
+    m1 = _mm512_max_pd(_mm512_abs_pd(_mm512_loadu_pd(x + i + 8)), m1);
+    m2 = _mm512_max_pd(_mm512_abs_pd(_mm512_loadu_pd(x + i + 16)), m2);
+    m3 = _mm512_max_pd(_mm512_abs_pd(_mm512_loadu_pd(x + i + 24)), m3);
+  }
+  for (; i + 8 <= n; i += 8)
+  {
+    m0 = _mm512_max_pd(_mm512_abs_pd(_mm512_loadu_pd(x + i)), m0);
+  }
+  if (i < n)
+  {
+    m1 = _mm512_max_pd(_mm512_abs_pd(
+                         _mm512_maskz_loadu_pd(tail_avx512(n - i), x + i)),
+                       m1);
+  }
+
+  return _mm512_reduce_max_pd(
+    _mm512_max_pd(_mm512_max_pd(m0, m1), _mm512_max_pd(m2, m3)));
+}
+
+NV_AVX512 static sunrealtype l1norm_avx512(sunindextype n, const sunrealtype* x)
+{
+  __m512d s0     = _mm512_setzero_pd();
+  __m512d s1     = _mm512_setzero_pd();
+  __m512d s2     = _mm512_setzero_pd();
+  __m512d s3     = _mm512_setzero_pd();
+  sunindextype i = 0;
+
+  for (; i + 32 <= n; i += 32)
+  {
+    s0 = _mm512_add_pd(_mm512_abs_pd(_mm512_loadu_pd(x + i)), s0);
+    s1 = _mm512_add_pd(_mm512_abs_pd(_mm512_loadu_pd(x + i + 8)), s1);
+    s2 = _mm512_add_pd(_mm512_abs_pd(_mm512_loadu_pd(x + i + 16)), s2);
+    s3 = _mm512_add_pd(_mm512_abs_pd(_mm512_loadu_pd(x + i + 24)), s3);
+  }
+  for (; i + 8 <= n; i += 8)
+  {
+    s0 = _mm512_add_pd(_mm512_abs_pd(_mm512_loadu_pd(x + i)), s0);
+  }
+  if (i < n)
+  {
+    s1 = _mm512_add_pd(_mm512_abs_pd(
+                         _mm512_maskz_loadu_pd(tail_avx512(n - i), x + i)),
+                       s1);
+  }
+
+  return _mm512_reduce_add_pd(
+    _mm512_add_pd(_mm512_add_pd(s0, s1), _mm512_add_pd(s2, s3)));
+}
+
+NV_AVX512 static sunrealtype lincombwsqrsum_avx512(sunindextype n, int nvec,
+                                                   const sunrealtype* c,
+                                                   sunrealtype* const* X,
+                                                   sunrealtype* z,
+                                                   const sunrealtype* w)
+{
+  __m512d s      = _mm512_setzero_pd();
+  __m512d acc, p;
+  __mmask8 m;
+  sunindextype i = 0;
+  int k;
+
+  for (; i + 8 <= n; i += 8)
+  {
+    acc = _mm512_mul_pd(_mm512_set1_pd(c[0]), _mm512_loadu_pd(X[0] + i));
+    for (k = 1; k < nvec; k++)
+    {
+      acc = _mm512_fmadd_pd(_mm512_set1_pd(c[k]), _mm512_loadu_pd(X[k] + i),
+                            acc);
+    }
+    _mm512_storeu_pd(z + i, acc);
+    p = _mm512_mul_pd(acc, _mm512_loadu_pd(w + i));
+    s = _mm512_fmadd_pd(p, p, s);
+  }
+  if (i < n)
+  {
+    m   = tail_avx512(n - i);
+    acc = _mm512_mul_pd(_mm512_set1_pd(c[0]),
+                        _mm512_maskz_loadu_pd(m, X[0] + i));
+    for (k = 1; k < nvec; k++)
+    {
+      acc = _mm512_fmadd_pd(_mm512_set1_pd(c[k]),
+                            _mm512_maskz_loadu_pd(m, X[k] + i), acc);
+    }
+    _mm512_mask_storeu_pd(z + i, m, acc);
+    p   = _mm512_mul_pd(acc, _mm512_maskz_loadu_pd(m, w + i));
+    s   = _mm512_fmadd_pd(p, p, s);
+  }
+
+  return _mm512_reduce_add_pd(s);
+}
+
+static const nvSerialSimdKernels kernels_avx512 = {"avx512",
+                                                   axpby_avx512,
+                                                   scale_avx512,
+                                                   lincomb_avx512,
+                                                   dot_avx512,
+                                                   wsqrsum_avx512,
+                                                   wsqrsummask_avx512,
+                                                   maxnorm_avx512,
+                                                   l1norm_avx512,
+                                                   lincombwsqrsum_avx512};
+
+#endif
+
+/*
+ * -----------------------------------------------------------------
+ * NEON kernels (2 doubles per register)
+ * -----------------------------------------------------------------
+ */
+
+#if defined(NV_SIMD_NEON)
+
+static void axpby_neon(sunindextype n, sunrealtype a, const sunrealtype* x,
+                       sunrealtype b, const sunrealtype* y, sunrealtype* z)
+{
+  const float64x2_t va = vdupq_n_f64(a);
+  const float64x2_t vb = vdupq_n_f64(b);
+  sunindextype i       = 0;
+
+  for (; i + 2 <= n; i += 2)
+  {
+    float64x2_t by = vmulq_f64(vb, vld1q_f64(y + i));
+    vst1q_f64(z + i, vfmaq_f64(by, va, vld1q_f64(x + i)));
+  }
+  for (; i < n; i++) { z[i] = a * x[i] + b * y[i]; }
+}
+
+static void scale_neon(sunindextype n, sunrealtype c, const sunrealtype* x,
+                       sunrealtype* z)
+{
+  const float64x2_t vc = vdupq_n_f64(c);
+  sunindextype i       = 0;
+
+  for (; i + 2 <= n; i += 2)
+  {
+    vst1q_f64(z + i, vmulq_f64(vc, vld1q_f64(x + i)));
+  }
+  for (; i < n; i++) { z[i] = c * x[i]; }
+}
+
+static void lincomb_neon(sunindextype n, int nvec, const sunrealtype* c,
+                         sunrealtype* const* X, sunrealtype* z)
+{
+  float64x2_t acc;
+  sunindextype i = 0;
+  sunrealtype sum;
+  int k;
+
+  for (; i + 2 <= n; i += 2)
+  {
+    acc = vmulq_f64(vdupq_n_f64(c[0]), vld1q_f64(X[0] + i));
+    for (k = 1; k < nvec; k++)
+    {
+      acc = vfmaq_f64(acc, vdupq_n_f64(c[k]), vld1q_f64(X[k] + i));
+    }
+    vst1q_f64(z + i, acc);
+  }
+  for (; i < n; i++)
+  {
+    sum = c[0] * X[0][i];
+    for (k = 1; k < nvec; k++) { sum += c[k] * X[k][i]; }
+    z[i] = sum;
+  }
+}
+
+static sunrealtype dot_neon(sunindextype n, const sunrealtype* x,
+                            const sunrealtype* y)
+{
+  float64x2_t s0 = vdupq_n_f64(0.0);
+  float64x2_t s1 = vdupq_n_f64(0.0);
+  float64x2_t s2 = vdupq_n_f64(0.0);
+  float64x2_t s3 = vdupq_n_f64(0.0);
+  sunindextype i = 0;
+  sunrealtype sum;
+
+  for (; i + 8 <= n; i += 8)
+  {
+    s0 = vfmaq_f64(s0, vld1q_f64(x + i), vld1q_f64(y + i));
+    s1 = vfmaq_f64(s1, vld1q_f64(x + i + 2), vld1q_f64(y + i + 2));
+    s2 = vfmaq_f64(s2, vld1q_f64(x + i + 4), vld1q_f64(y + i + 4));
+    s3 = vfmaq_f64(s3, vld1q_f64(x + i + 6), vld1q_f64(y + i + 6));
+  }
+  for (; i + 2 <= n; i += 2)
+  {
+    s0 = vfmaq_f64(s0, vld1q_f64(x + i), vld1q_f64(y + i));
+  }
+
+  sum = vaddvq_f64(vaddq_f64(vaddq_f64(s0, s1), vaddq_f64(s2, s3)));
+  for (; i < n; i++) { sum += x[i] * y[i]; }
+
+  return sum;
+}
+
+static sunrealtype wsqrsum_neon(sunindextype n, const sunrealtype* x,
+                                const sunrealtype* w)
+{
+  float64x2_t s0 = vdupq_n_f64(0.0);
+  float64x2_t s1 = vdupq_n_f64(0.0);
+  float64x2_t s2 = vdupq_n_f64(0.0);
+  float64x2_t s3 = vdupq_n_f64(0.0);
+  float64x2_t p0, p1, p2, p3;
+  sunindextype i = 0;
+  sunrealtype sum, prodi;
+
+  for (; i + 8 <= n; i += 8)
+  {
+    p0 = vmulq_f64(vld1q_f64(x + i), vld1q_f64(w + i));
+    p1 = vmulq_f64(vld1q_f64(x + i + 2), vld1q_f64(w + i + 2));
+    p2 = vmulq_f64(vld1q_f64(x + i + 4), vld1q_f64(w + i + 4));
+    p3 = vmulq_f64(vld1q_f64(x + i + 6), vld1q_f64(w + i + 6));
+    s0 = vfmaq_f64(s0, p0, p0);
+    s1 = vfmaq_f64(s1, p1, p1);
+    s2 = vfmaq_f64(s2, p2, p2);
+    s3 = vfmaq_f64(s3, p3, p3);
+  }
+  for (; i + 2 <= n; i += 2)
+  {
+    p0 = vmulq_f64(vld1q_f64(x + i), vld1q_f64(w + i));
+    s0 = vfmaq_f64(s0, p0, p0);
+  }
+
+  sum = vaddvq_f64(vaddq_f64(vaddq_f64(s0, s1), vaddq_f64(s2, s3)));
+  for (; i < n; i++)
+  {
+    prodi = x[i] * w[i];
+    sum += prodi * prodi;
+  }
+
+  return sum;
+}
+
+static sunrealtype wsqrsummask_neon(sunindextype n, const sunrealtype* x,
+                                    const sunrealtype* w, const sunrealtype* id)
+{
+  const float64x2_t zero = vdupq_n_f64(0.0);
+  float64x2_t s0         = vdupq_n_f64(0.0);
+  float64x2_t s1         = vdupq_n_f64(0.0);
+  float64x2_t p0, p1;
+  uint64x2_t m0, m1;
+  sunindextype i = 0;
+  sunrealtype sum, prodi;
+
+  /* products with id <= 0 are zeroed by the comparison mask */
+  for (; i + 4 <= n; i += 4)
+  {
+    m0 = vcgtq_f64(vld1q_f64(id + i), zero);
+    m1 = vcgtq_f64(vld1q_f64(id + i + 2), zero);
+    p0 = vmulq_f64(vld1q_f64(x + i), vld1q_f64(w + i));
+    p1 = vmulq_f64(vld1q_f64(x + i + 2), vld1q_f64(w + i + 2));
+    p0 = vreinterpretq_f64_u64(vandq_u64(vreinterpretq_u64_f64(p0), m0));
+    p1 = vreinterpretq_f64_u64(vandq_u64(vreinterpretq_u64_f64(p1), m1));
+    s0 = vfmaq_f64(s0, p0, p0);
+    s1 = vfmaq_f64(s1, p1, p1);
+  }
+
+  sum = vaddvq_f64(vaddq_f64(s0, s1));
+  for (; i < n; i++)
+  {
+    if (id[i] > ZERO)
+    {
+      prodi = x[i] * w[i];
+      sum += prodi * prodi;
+    }
+  }
+
+  return sum;
+}
+
+static sunrealtype maxnorm_neon(sunindextype n, const sunrealtype* x)
+{
+  float64x2_t m0 = vdupq_n_f64(0.0);
+  float64x2_t m1 = vdupq_n_f64(0.0);
+  float64x2_t m2 = vdupq_n_f64(0.0);
+  float64x2_t m3 = vdupq_n_f64(0.0);
+  sunindextype i = 0;
+  sunrealtype max;
+
+  /* maxnm returns the number when one operand is NaN, so NaN entries are
+     skipped as in the scalar loop */
+  for (; i + 8 <= n; i += 8)
+  {
+    m0 = vmaxnmq_f64(m0, vabsq_f64(vld1q_f64(x + i)));
+    m1 = vmaxnmq_f64(m1, vabsq_f64(vld1q_f64(x + i + 2)));
+    m2 = vmaxnmq_f64(m2, vabsq_f64(vld1q_f64(x + i + 4)));
+    m3 = vmaxnmq_f64(m3, vabsq_f64(vld1q_f64(x + i + 6)));
+  }
+  for (; i + 2 <= n; i += 2)
+  {
+    m0 = vmaxnmq_f64(m0, vabsq_f64(vld1q_f64(x + i)));
+  }
+
+  max = vmaxnmvq_f64(vmaxnmq_f64(vmaxnmq_f64(m0, m1), vmaxnmq_f64(m2, m3)));
+  for (; i < n; i++)
+  {
+    if (SUNRabs(x[i]) > max) { max = SUNRabs(x[i]); }
+  }
+
+  return max;
+}
+
+static sunrealtype l1norm_neon(sunindextype n, const sunrealtype* x)
+{
+  float64x2_t s0 = vdupq_n_f64(0.0);
+  float64x2_t s1 = vdupq_n_f64(0.0);
+  float64x2_t s2 = vdupq_n_f64(0.0);
+  float64x2_t s3 = vdupq_n_f64(0.0);
+  sunindextype i = 0;
+  sunrealtype sum;
+
+  for (; i + 8 <= n; i += 8)
+  {
+    s0 = vaddq_f64(s0, vabsq_f64(vld1q_f64(x + i)));
+    s1 = vaddq_f64(s1, vabsq_f64(vld1q_f64(x + i + 2)));
+    s2 = vaddq_f64(s2, vabsq_f64(vld1q_f64(x + i + 4)));
+    s3 = vaddq_f64(s3, vabsq_f64(vld1q_f64(x + i + 6)));
+  }
+  for (; i + 2 <= n; i += 2)
+  {
+    s0 = vaddq_f64(s0, vabsq_f64(vld1q_f64(x + i)));
+  }
+
+  sum = vaddvq_f64(vaddq_f64(vaddq_f64(s0, s1), vaddq_f64(s2, s3)));
+  for (; i < n; i++) { sum += SUNRabs(x[i]); }
+
+  return sum;
+}
+
+static sunrealtype lincombwsqrsum_neon(sunindextype n, int nvec,
+                                       const sunrealtype* c,
+                                       sunrealtype* const* X, sunrealtype* z,
+                                       const sunrealtype* w)
+{
+  float64x2_t s  = vdupq_n_f64(0.0);
+  float64x2_t acc, p;
+  sunindextype i = 0;
+  sunrealtype sum, prodi;
+  int k;
+
+  for (; i + 2 <= n; i += 2)
+  {
+    acc = vmulq_f64(vdupq_n_f64(c[0]), vld1q_f64(X[0] + i));
+    for (k = 1; k < nvec; k++)
+    {
+      acc = vfmaq_f64(acc, vdupq_n_f64(c[k]), vld1q_f64(X[k] + i));
+    }
+    vst1q_f64(z + i, acc);
+    p = vmulq_f64(acc, vld1q_f64(w + i));
+    s = vfmaq_f64(s, p, p);
+  }
+
+  sum = vaddvq_f64(s);
+  for (; i < n; i++)
+  {
+    prodi = c[0] * X[0][i];
+    for (k = 1; k < nvec; k++) { prodi += c[k] * X[k][i]; }
+    z[i] = prodi;
+    prodi *= w[i];
+    sum += prodi * prodi;
+  }
+
+  return sum;
+}
+
+static const nvSerialSimdKernels kernels_neon = {"neon",
+                                                 axpby_neon,
+                                                 scale_neon,
+                                                 lincomb_neon,
+                                                 dot_neon,
+                                                 wsqrsum_neon,
+                                                 wsqrsummask_neon,
+                                                 maxnorm_neon,
+                                                 l1norm_neon,
+                                                 lincombwsqrsum_neon};
+
+#endif
+
+/*
+ * -----------------------------------------------------------------
+ * runtime dispatch
+ * -----------------------------------------------------------------
+ */
+
+#if defined(NV_SIMD_X86) || defined(NV_SIMD_NEON)
+
+static const nvSerialSimdKernels* nvSerialSimdSelect(void)
+{
+  const char* level = getenv("SUNDIALS_SIMD");
+
+  /* the kernels are only used when requested */
+  if (level == NULL || strcmp(level, "none") == 0) { return NULL; }
+
+#if defined(NV_SIMD_X86)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && strcmp(level, "avx2") != 0)
+  {
+    return &kernels_avx512;
+  }
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+  {
+    return &kernels_avx2;
+  }
+  return NULL;
+#else
+  return &kernels_neon;
+#endif
+}
+
+const nvSerialSimdKernels* nvSerialSimd(void)
+{
+  /* Marks that the kernels have not been selected yet. Vectors may be used
+     from several threads, so the selection is stored and read atomically.
+     Concurrent first calls all select the same kernels. */
+  static const nvSerialSimdKernels unselected = {NULL, NULL, NULL, NULL, NULL,
+                                                 NULL, NULL, NULL, NULL, NULL};
+  static const nvSerialSimdKernels* kernels   = &unselected;
+
+  const nvSerialSimdKernels* selected = __atomic_load_n(&kernels,
+                                                        __ATOMIC_ACQUIRE);
+  if (selected == &unselected)
+  {
+    selected = nvSerialSimdSelect();
+    __atomic_store_n(&kernels, selected, __ATOMIC_RELEASE);
+  }
+
+  return selected;
+}
+
+#else
+
+const nvSerialSimdKernels* nvSerialSimd(void) { return NULL; }
+
+#endif
@@ -0,0 +1,72 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Private header for the explicitly vectorized (SIMD) kernels of the
+ * serial NVECTOR. The kernels operate on raw data arrays and are
+ * selected once, at runtime, based on the instruction sets supported
+ * by the CPU.
+ * -----------------------------------------------------------------*/
+
+#ifndef _NVECTOR_SERIAL_SIMD_H
+#define _NVECTOR_SERIAL_SIMD_H
+
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Alignment (in bytes) of the data allocated by serial vectors */
+#define NV_SERIAL_ALIGNMENT 64
+
+typedef struct
+{
+  /* name of the instruction set, e.g., "avx2" */
+  const char* name;
+
+  /* z = a x + b y, z may be the same array as x or y */
+  void (*axpby)(sunindextype n, sunrealtype a, const sunrealtype* x,
+                sunrealtype b, const sunrealtype* y, sunrealtype* z);
+
+  /* z = c x, z may be the same array as x */
+  void (*scale)(sunindextype n, sunrealtype c, const sunrealtype* x,
+                sunrealtype* z);
+
+  /* z = sum_k c[k] X[k], z may be the same array as X[0] */
+  void (*lincomb)(sunindextype n, int nvec, const sunrealtype* c,
+                  sunrealtype* const* X, sunrealtype* z);
+
+  /* reductions: sum x y, sum (x w)^2, sum_{id > 0} (x w)^2, max |x|, and
+     sum |x| */
+  sunrealtype (*dot)(sunindextype n, const sunrealtype* x, const sunrealtype* y);
+  sunrealtype (*wsqrsum)(sunindextype n, const sunrealtype* x,
+                         const sunrealtype* w);
+  sunrealtype (*wsqrsummask)(sunindextype n, const sunrealtype* x,
+                             const sunrealtype* w, const sunrealtype* id);
+  sunrealtype (*maxnorm)(sunindextype n, const sunrealtype* x);
+  sunrealtype (*l1norm)(sunindextype n, const sunrealtype* x);
+
+  /* z = sum_k c[k] X[k] and returns sum (z w)^2, z may be the same array as
+     X[0] */
+  sunrealtype (*lincombwsqrsum)(sunindextype n, int nvec, const sunrealtype* c,
+                                sunrealtype* const* X, sunrealtype* z,
+                                const sunrealtype* w);
+} nvSerialSimdKernels;
+
+/* Returns the kernels for the best instruction set supported by the CPU or
+   NULL when the scalar loops should be used */
+const nvSerialSimdKernels* nvSerialSimd(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
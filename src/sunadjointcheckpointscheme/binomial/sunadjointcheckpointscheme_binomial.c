@@ -0,0 +1,612 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * SUNAdjointCheckpointScheme_Binomial class definition.
+ *
+ * During the forward integration every step is checkpointed and,
+ * once max_checks steps are stored, an older checkpoint is evicted
+ * using the dynamic checkpointing algorithm of Wang, Moin, and
+ * Iaccarino (SIAM J. Sci. Comput. 31(4), 2009). Each checkpoint
+ * has a level. The first checkpoint is never evicted. A checkpoint
+ * is dispensable if a later checkpoint has a higher level. If there
+ * is a dispensable checkpoint, it is evicted and the new step gets
+ * level 0, otherwise the most recent checkpoint is evicted and the
+ * new step gets its level plus one. This gives a binomial
+ * distribution of the checkpoints without knowing the number of
+ * steps in advance.
+ *
+ * During the backward integration a step that was not stored is
+ * recomputed from the closest earlier checkpoint. The recomputation
+ * stores the missing step and uses the remaining free checkpoints
+ * at the positions chosen by the Revolve algorithm of Griewank and
+ * Walther (ACM TOMS 26(1), 2000) for that segment.
+ * ----------------------------------------------------------------*/
+
+#include <limits.h>
+#include <string.h>
+
+#include <sunadjointcheckpointscheme/sunadjointcheckpointscheme_binomial.h>
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_adjointcheckpointscheme.h>
+#include <sundials/sundials_core.h>
+
+#include "sundials_adjointcheckpointscheme_impl.h"
+#include "sundials_datanode.h"
+#include "sundials_logger_impl.h"
+#include "sundials_macros.h"
+#include "sundials_utils.h"
+
+struct SUNAdjointCheckpointScheme_Binomial_Content_
+{
+  suncountertype max_checks;
+  suncountertype num_checks;
+  suncountertype check_capacity;
+  suncountertype* check_steps; /* stored steps in increasing order */
+  int* check_levels;           /* level of each stored step        */
+
+  sunbooleantype recompute;      /* recomputing a segment of steps   */
+  sunbooleantype schedule_ready; /* schedule set for the segment     */
+  sunbooleantype tail_is_extra;  /* last step stored only as a tail  */
+  suncountertype missing_step;   /* last step that failed to load    */
+  suncountertype num_schedule;
+  suncountertype schedule_pos;
+  suncountertype* schedule; /* steps to store while recomputing */
+
+  suncountertype step_num_of_current_insert;
+  suncountertype step_num_of_current_load;
+  SUNMemoryHelper mem_helper;
+  SUNDataNode root_node;
+  SUNDataNode current_insert_step_node;
+  SUNDataNode current_load_step_node;
+  SUNDataIOMode io_mode;
+};
+
+typedef struct SUNAdjointCheckpointScheme_Binomial_Content_*
+  SUNAdjointCheckpointScheme_Binomial_Content;
+
+#define GET_CONTENT(S) ((SUNAdjointCheckpointScheme_Binomial_Content)S->content)
+#define IMPL_MEMBER(S, prop) (GET_CONTENT(S)->prop)
+
+/* Returns the number of steps to advance from the current checkpoint before
+   storing the next one, when steps steps must be reversed with snaps
+   checkpoints (including the current one). This is the schedule of the
+   Revolve algorithm. */
+static suncountertype sunBinomialAdvance(suncountertype steps,
+                                         suncountertype snaps)
+{
+  suncountertype reps, range, bino1, bino2, bino3, bino4, bino5, advance;
+
+  if (snaps > steps) { snaps = steps; }
+
+  /* find the number of repetitions needed for this many steps */
+  reps  = 0;
+  range = 1;
+  while (range < steps)
+  {
+    reps++;
+    range = range * (reps + snaps) / reps;
+  }
+
+  bino1 = range * reps / (snaps + reps);
+  bino2 = (snaps > 1) ? bino1 * snaps / (snaps + reps - 1) : 1;
+  if (snaps == 1) { bino3 = 0; }
+  else { bino3 = (snaps > 2) ? bino2 * (snaps - 1) / (snaps + reps - 2) : 1; }
+  bino4 = bino2 * (reps - 1) / snaps;
+  if (snaps < 3) { bino5 = 0; }
+  else { bino5 = (snaps > 3) ? bino3 * (snaps - 2) / reps : 1; }
+
+  if (steps <= bino1 + bino3) { advance = bino4; }
+  else if (steps >= range - bino5) { advance = bino1; }
+  else { advance = steps - bino2 - bino3; }
+
+  if (advance < 1) { advance = 1; }
+  if (advance > steps - 1) { advance = steps - 1; }
+
+  return advance;
+}
+
+/* Forgets the cached load node, e.g., when its step is removed */
+static void sunResetLoadCache(SUNAdjointCheckpointScheme self)
+{
+  IMPL_MEMBER(self, current_load_step_node)   = NULL;
+  IMPL_MEMBER(self, step_num_of_current_load) = -2;
+}
+
+/* Removes the i-th stored checkpoint from the bookkeeping arrays */
+static void sunForgetCheckpoint(SUNAdjointCheckpointScheme self,
+                                suncountertype i)
+{
+  suncountertype num_after = IMPL_MEMBER(self, num_checks) - i - 1;
+  if (num_after > 0)
+  {
+    memmove(&IMPL_MEMBER(self, check_steps)[i],
+            &IMPL_MEMBER(self, check_steps)[i + 1],
+            num_after * sizeof(suncountertype));
+    memmove(&IMPL_MEMBER(self, check_levels)[i],
+            &IMPL_MEMBER(self, check_levels)[i + 1], num_after * sizeof(int));
+  }
+  IMPL_MEMBER(self, num_checks)--;
+}
+
+/* Removes the i-th stored checkpoint and destroys its data */
+static SUNErrCode sunEvictCheckpoint(SUNAdjointCheckpointScheme self,
+                                     suncountertype i)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  suncountertype step_num    = IMPL_MEMBER(self, check_steps)[i];
+  SUNDataNode step_data_node = NULL;
+
+  char* key = sunSignedToString(step_num);
+  SUNLogExtraDebug(SUNCTX_->logger, "evict-step", "step_num = %d, level = %d",
+                   step_num, IMPL_MEMBER(self, check_levels)[i]);
+  SUNCheckCall(SUNDataNode_RemoveNamedChild(IMPL_MEMBER(self, root_node), key,
+                                            &step_data_node));
+  free(key);
+  SUNCheckCall(SUNDataNode_Destroy(&step_data_node));
+
+  sunForgetCheckpoint(self, i);
+  if (step_num == IMPL_MEMBER(self, step_num_of_current_load))
+  {
+    sunResetLoadCache(self);
+  }
+
+  return SUN_SUCCESS;
+}
+
+/* Doubles the size of the bookkeeping arrays. This is only needed when a
+   recomputation ends before the missing step and the missing step is then
+   recomputed from the last step, which can store max_checks + 1 steps. */
+static SUNErrCode sunGrowCheckpoints(SUNAdjointCheckpointScheme self)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  suncountertype capacity = 2 * IMPL_MEMBER(self, check_capacity);
+
+  suncountertype* steps = realloc(IMPL_MEMBER(self, check_steps),
+                                  capacity * sizeof(suncountertype));
+  SUNAssert(steps, SUN_ERR_MALLOC_FAIL);
+  IMPL_MEMBER(self, check_steps) = steps;
+
+  int* levels = realloc(IMPL_MEMBER(self, check_levels), capacity * sizeof(int));
+  SUNAssert(levels, SUN_ERR_MALLOC_FAIL);
+  IMPL_MEMBER(self, check_levels) = levels;
+
+  IMPL_MEMBER(self, check_capacity) = capacity;
+
+  return SUN_SUCCESS;
+}
+
+/* Makes room for a new step in the forward integration and returns its
+   level */
+static SUNErrCode sunMakeRoomForStep(SUNAdjointCheckpointScheme self,
+                                     suncountertype step_num, int* level)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  suncountertype num_checks = IMPL_MEMBER(self, num_checks);
+  suncountertype* steps     = IMPL_MEMBER(self, check_steps);
+  int* levels               = IMPL_MEMBER(self, check_levels);
+
+  /* A step that is not after the last checkpoint starts a new forward
+     integration, the old checkpoints are not needed anymore */
+  if (num_checks > 0 && step_num <= steps[num_checks - 1])
+  {
+    while (IMPL_MEMBER(self, num_checks) > 0)
+    {
+      SUNCheckCall(
+        sunEvictCheckpoint(self, IMPL_MEMBER(self, num_checks) - 1));
+    }
+    num_checks = 0;
+  }
+
+  /* The first checkpoint is the starting point for every recomputation */
+  if (num_checks == 0)
+  {
+    *level = INT_MAX;
+    return SUN_SUCCESS;
+  }
+
+  *level = 0;
+  if (num_checks < IMPL_MEMBER(self, max_checks)) { return SUN_SUCCESS; }
+
+  /* Look for the dispensable checkpoint with the lowest level */
+  suncountertype evict = -1;
+  int later_level      = -1;
+  for (suncountertype i = num_checks - 1; i >= 0; i--)
+  {
+    if (levels[i] < later_level &&
+        (evict < 0 || levels[i] <= levels[evict]))
+    {
+      evict = i;
+    }
+    if (levels[i] > later_level) { later_level = levels[i]; }
+  }
+
+  /* Otherwise replace the most recent checkpoint with a higher level */
+  if (evict < 0)
+  {
+    evict  = num_checks - 1;
+    *level = levels[evict] + 1;
+  }
+
+  SUNCheckCall(sunEvictCheckpoint(self, evict));
+
+  return SUN_SUCCESS;
+}
+
+/* Chooses the steps to store while recomputing from start_step up to the
+   step that could not be loaded */
+static void sunScheduleRecompute(SUNAdjointCheckpointScheme self,
+                                 suncountertype start_step)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  suncountertype end_step = IMPL_MEMBER(self, missing_step);
+
+  IMPL_MEMBER(self, schedule_ready) = SUNTRUE;
+  IMPL_MEMBER(self, schedule_pos)   = 0;
+  IMPL_MEMBER(self, num_schedule)   = 0;
+
+  /* Without a missing step only the last recomputed step is kept */
+  if (end_step < start_step) { return; }
+
+  /* One checkpoint is needed for the missing step itself */
+  suncountertype num_free = IMPL_MEMBER(self, max_checks) -
+                            IMPL_MEMBER(self, num_checks) - 1;
+
+  /* The states before each step are stored at the end of the previous step,
+     so the Revolve positions (in states) are shifted by one */
+  suncountertype capo = start_step;
+  suncountertype fine = end_step + 1;
+  while (num_free > 0 && fine - capo > 1)
+  {
+    capo += sunBinomialAdvance(fine - capo, num_free + 1);
+    IMPL_MEMBER(self, schedule)[IMPL_MEMBER(self, num_schedule)++] = capo - 1;
+    num_free--;
+  }
+  IMPL_MEMBER(self, schedule)[IMPL_MEMBER(self, num_schedule)++] = end_step;
+
+  SUNLogDebug(SUNCTX_->logger, "recompute-schedule",
+              "start_step = %ld, end_step = %ld, num_stored = %ld",
+              (long int)start_step, (long int)end_step,
+              (long int)IMPL_MEMBER(self, num_schedule));
+}
+
+/* Makes room for a recomputed step. The most recent step is always kept
+   because the recomputation may end before the missing step, e.g., when the
+   adjoint integration starts inside the last forward step. A step that is not
+   in the schedule is removed again when the next step is inserted. */
+static SUNErrCode sunMakeRoomForRecomputedStep(SUNAdjointCheckpointScheme self,
+                                               suncountertype step_num)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  if (!IMPL_MEMBER(self, schedule_ready))
+  {
+    sunScheduleRecompute(self, step_num);
+  }
+
+  if (IMPL_MEMBER(self, tail_is_extra))
+  {
+    SUNCheckCall(sunEvictCheckpoint(self, IMPL_MEMBER(self, num_checks) - 1));
+  }
+
+  suncountertype* schedule = IMPL_MEMBER(self, schedule);
+  while (IMPL_MEMBER(self, schedule_pos) < IMPL_MEMBER(self, num_schedule) &&
+         schedule[IMPL_MEMBER(self, schedule_pos)] < step_num)
+  {
+    IMPL_MEMBER(self, schedule_pos)++;
+  }
+
+  IMPL_MEMBER(self, tail_is_extra) =
+    IMPL_MEMBER(self, schedule_pos) == IMPL_MEMBER(self, num_schedule) ||
+    schedule[IMPL_MEMBER(self, schedule_pos)] != step_num;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_Create_Binomial(
+  SUNDataIOMode io_mode, SUNMemoryHelper mem_helper,
+  suncountertype max_checkpoints, SUNContext sunctx,
+  SUNAdjointCheckpointScheme* check_scheme_ptr)
+{
+  SUNFunctionBegin(sunctx);
+
+  /* The first checkpoint and the most recent step are always stored */
+  if (max_checkpoints < 2) { return SUN_ERR_ARG_OUTOFRANGE; }
+
+  SUNAdjointCheckpointScheme check_scheme = NULL;
+  SUNCheckCall(SUNAdjointCheckpointScheme_NewEmpty(sunctx, &check_scheme));
+
+  check_scheme->ops->needssaving = SUNAdjointCheckpointScheme_NeedsSaving_Binomial;
+  check_scheme->ops->insertvector =
+    SUNAdjointCheckpointScheme_InsertVector_Binomial;
+  check_scheme->ops->loadvector = SUNAdjointCheckpointScheme_LoadVector_Binomial;
+  check_scheme->ops->enableDense =
+    SUNAdjointCheckpointScheme_EnableDense_Binomial;
+  check_scheme->ops->destroy = SUNAdjointCheckpointScheme_Destroy_Binomial;
+
+  SUNAdjointCheckpointScheme_Binomial_Content content = NULL;
+
+  content = malloc(sizeof(*content));
+  SUNAssert(content, SUN_ERR_MALLOC_FAIL);
+
+  content->max_checks                 = max_checkpoints;
+  content->num_checks                 = 0;
+  content->check_capacity             = max_checkpoints;
+  content->recompute                  = SUNFALSE;
+  content->schedule_ready             = SUNFALSE;
+  content->tail_is_extra              = SUNFALSE;
+  content->missing_step               = -1;
+  content->num_schedule               = 0;
+  content->schedule_pos               = 0;
+  content->mem_helper                 = mem_helper;
+  content->root_node                  = NULL;
+  content->current_insert_step_node   = NULL;
+  content->step_num_of_current_insert = -2;
+  content->current_load_step_node     = NULL;
+  content->step_num_of_current_load   = -2;
+  content->io_mode                    = io_mode;
+
+  content->check_steps  = malloc(max_checkpoints * sizeof(suncountertype));
+  content->check_levels = malloc(max_checkpoints * sizeof(int));
+  content->schedule     = malloc(max_checkpoints * sizeof(suncountertype));
+  if (!content->check_steps || !content->check_levels || !content->schedule)
+  {
+    free(content->check_steps);
+    free(content->check_levels);
+    free(content->schedule);
+    free(content);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  SUNCheckCall(SUNDataNode_CreateObject(io_mode, max_checkpoints, sunctx,
+                                        &content->root_node));
+
+  check_scheme->content = content;
+  *check_scheme_ptr     = check_scheme;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_NeedsSaving_Binomial(
+  SUNAdjointCheckpointScheme self, SUNDIALS_MAYBE_UNUSED suncountertype step_num,
+  SUNDIALS_MAYBE_UNUSED suncountertype stage_num,
+  SUNDIALS_MAYBE_UNUSED sunrealtype t, sunbooleantype* yes_or_no)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  /* Every step is offered, the eviction happens when the step is inserted */
+  *yes_or_no = SUNTRUE;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_InsertVector_Binomial(
+  SUNAdjointCheckpointScheme self, suncountertype step_num,
+  SUNDIALS_MAYBE_UNUSED suncountertype stage_num, sunrealtype t, N_Vector y)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  /* If this is the first state for a step, then we need to create a
+     list node first to store the step and all stage solutions in.
+     We keep a pointer to the list node until this step is over for
+     fast access when inserting stages. */
+  SUNDataNode step_data_node = NULL;
+  if (step_num != IMPL_MEMBER(self, step_num_of_current_insert))
+  {
+    int level = 0;
+    if (IMPL_MEMBER(self, recompute))
+    {
+      SUNCheckCall(sunMakeRoomForRecomputedStep(self, step_num));
+    }
+    else { SUNCheckCall(sunMakeRoomForStep(self, step_num, &level)); }
+
+    SUNCheckCall(SUNDataNode_CreateList(IMPL_MEMBER(self, io_mode), 0, SUNCTX_,
+                                        &step_data_node));
+    IMPL_MEMBER(self, current_insert_step_node)   = step_data_node;
+    IMPL_MEMBER(self, step_num_of_current_insert) = step_num;
+
+    /* Store the step node in the root node object. */
+    char* key = sunSignedToString(step_num);
+    SUNLogExtraDebug(SUNCTX_->logger, "insert-new-step",
+                     "step_num = %d, key = %s, level = %d", step_num, key,
+                     level);
+    SUNCheckCall(SUNDataNode_AddNamedChild(IMPL_MEMBER(self, root_node), key,
+                                           step_data_node));
+    free(key);
+
+    suncountertype num_checks = IMPL_MEMBER(self, num_checks);
+    if (num_checks == IMPL_MEMBER(self, check_capacity))
+    {
+      SUNCheckCall(sunGrowCheckpoints(self));
+    }
+    IMPL_MEMBER(self, check_steps)[num_checks]  = step_num;
+    IMPL_MEMBER(self, check_levels)[num_checks] = level;
+    IMPL_MEMBER(self, num_checks)++;
+  }
+  else { step_data_node = IMPL_MEMBER(self, current_insert_step_node); }
+
+  /* Add the state data as a leaf node in the step node's list of children. */
+  SUNLogExtraDebug(SUNCTX_->logger, "insert-stage",
+                   "step_num = %d, stage_num = %d, t = %g", step_num, stage_num,
+                   t);
+  SUNDataNode solution_node = NULL;
+  SUNCheckCall(SUNDataNode_CreateLeaf(IMPL_MEMBER(self, io_mode),
+                                      IMPL_MEMBER(self, mem_helper), SUNCTX_,
+                                      &solution_node));
+  SUNCheckCall(SUNDataNode_SetDataNvector(solution_node, y, t));
+  SUNCheckCall(SUNDataNode_AddChild(step_data_node, solution_node));
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_LoadVector_Binomial(
+  SUNAdjointCheckpointScheme self, suncountertype step_num,
+  suncountertype stage_num, sunbooleantype peek, N_Vector* yout,
+  sunrealtype* tout)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  SUNErrCode errcode = SUN_SUCCESS;
+
+  /* If we are trying to load the step solution, we need to load the list which holds
+     the step and stage solutions. We keep a pointer to the list node until
+     this step is over for fast access when loading stages. */
+  SUNDataNode step_data_node = NULL;
+  if (step_num != IMPL_MEMBER(self, step_num_of_current_load))
+  {
+    char* key = sunSignedToString(step_num);
+    SUNLogExtraDebug(SUNCTX_->logger, "try-load-new-step",
+                     "step_num = %d, stage_num = %d", step_num, stage_num);
+    errcode = SUNDataNode_GetNamedChild(IMPL_MEMBER(self, root_node), key,
+                                        &step_data_node);
+    free(key);
+    if (errcode == SUN_SUCCESS)
+    {
+      IMPL_MEMBER(self, current_load_step_node)   = step_data_node;
+      IMPL_MEMBER(self, step_num_of_current_load) = step_num;
+    }
+    else if (errcode == SUN_ERR_DATANODE_NODENOTFOUND)
+    {
+      step_data_node = NULL;
+    }
+    else { SUNCheckCall(errcode); }
+  }
+  else { step_data_node = IMPL_MEMBER(self, current_load_step_node); }
+
+  if (!step_data_node)
+  {
+    SUNLogExtraDebug(SUNCTX_->logger, "step-not-found",
+                     "step_num = %d, stage_num = %d", step_num, stage_num);
+    /* the recomputation that follows ends with this step */
+    if (!peek) { IMPL_MEMBER(self, missing_step) = step_num; }
+    return SUN_ERR_CHECKPOINT_NOT_FOUND;
+  }
+
+  SUNLogExtraDebug(SUNCTX_->logger, "step-loaded",
+                   "step_num = %d, stage_num = %d", step_num, stage_num);
+
+  SUNDataNode solution_node = NULL;
+  if (peek)
+  {
+    SUNLogExtraDebug(SUNCTX_->logger, "try-load-stage",
+                     "peek = 1, step_num = %d, stage_num = %d", step_num,
+                     stage_num);
+    errcode = SUNDataNode_GetChild(step_data_node, stage_num, &solution_node);
+    if (errcode == SUN_ERR_DATANODE_NODENOTFOUND) { solution_node = NULL; }
+    else { SUNCheckCall(errcode); }
+  }
+  else
+  {
+    sunbooleantype has_children = SUNFALSE;
+    SUNCheckCall(SUNDataNode_HasChildren(step_data_node, &has_children));
+
+    if (has_children)
+    {
+      SUNLogExtraDebug(SUNCTX_->logger, "try-load-stage",
+                       "peek = 0, step_num = %d, stage_num = %d", step_num,
+                       stage_num);
+      errcode = SUNDataNode_RemoveChild(step_data_node, stage_num,
+                                        &solution_node);
+      if (errcode == SUN_ERR_DATANODE_NODENOTFOUND) { solution_node = NULL; }
+      else { SUNCheckCall(errcode); }
+    }
+
+    /* If we just removed the last stage (so has_children==false),
+       then we should remove the step too. */
+    SUNCheckCall(SUNDataNode_HasChildren(step_data_node, &has_children));
+    if (!has_children)
+    {
+      char* key = sunSignedToString(step_num);
+      SUNLogExtraDebug(SUNCTX_->logger, "remove-step", "step_num = %d", step_num);
+      SUNCheckCall(SUNDataNode_RemoveNamedChild(IMPL_MEMBER(self, root_node),
+                                                key, &step_data_node));
+      free(key);
+      SUNCheckCall(SUNDataNode_Destroy(&step_data_node));
+      sunResetLoadCache(self);
+
+      for (suncountertype i = IMPL_MEMBER(self, num_checks) - 1; i >= 0; i--)
+      {
+        if (IMPL_MEMBER(self, check_steps)[i] == step_num)
+        {
+          sunForgetCheckpoint(self, i);
+          break;
+        }
+      }
+    }
+  }
+
+  if (!solution_node)
+  {
+    SUNLogExtraDebug(SUNCTX_->logger, "stage-not-found",
+                     "step_num = %d, stage_num = %d", step_num, stage_num);
+    return SUN_ERR_CHECKPOINT_NOT_FOUND;
+  }
+
+  SUNCheckCall(SUNDataNode_GetDataNvector(solution_node, *yout, tout));
+  SUNLogExtraDebug(SUNCTX_->logger, "stage-loaded",
+                   "step_num = %d, stage_num = %d, t = %g", step_num, stage_num,
+                   *tout);
+
+  /* Cleanup the checkpoint memory if need be */
+  if (!peek) { SUNCheckCall(SUNDataNode_Destroy(&solution_node)); }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_Destroy_Binomial(
+  SUNAdjointCheckpointScheme* self_ptr)
+{
+  SUNFunctionBegin((*self_ptr)->sunctx);
+
+  SUNAdjointCheckpointScheme self = *self_ptr;
+
+  SUNCheckCall(SUNDataNode_Destroy(&IMPL_MEMBER(self, root_node)));
+
+  free(IMPL_MEMBER(self, check_steps));
+  free(IMPL_MEMBER(self, check_levels));
+  free(IMPL_MEMBER(self, schedule));
+  free(self->content);
+  free(self->ops);
+  free(self);
+
+  *self_ptr = NULL;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_EnableDense_Binomial(
+  SUNAdjointCheckpointScheme check_scheme, sunbooleantype on_or_off)
+{
+  SUNFunctionBegin(check_scheme->sunctx);
+
+  /* Dense checkpointing is requested while the adjoint integrator recomputes
+     the steps leading up to a missing step, the steps to store are chosen
+     when the first of them is reached */
+  IMPL_MEMBER(check_scheme, recompute)      = on_or_off;
+  IMPL_MEMBER(check_scheme, schedule_ready) = SUNFALSE;
+  IMPL_MEMBER(check_scheme, tail_is_extra)  = SUNFALSE;
+  if (!on_or_off) { IMPL_MEMBER(check_scheme, missing_step) = -1; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_GetNumCheckpoints_Binomial(
+  SUNAdjointCheckpointScheme check_scheme, suncountertype* num_checkpoints)
+{
+  SUNFunctionBegin(check_scheme->sunctx);
+
+  *num_checkpoints = IMPL_MEMBER(check_scheme, num_checks);
+
+  return SUN_SUCCESS;
+}
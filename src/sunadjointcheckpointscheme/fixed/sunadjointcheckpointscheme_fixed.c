@@ -14,17 +14,35 @@
  * SUNAdjointCheckpointScheme_Fixed class definition.
  * ----------------------------------------------------------------*/
 
+#include <string.h>
+
 #include <sunadjointcheckpointscheme/sunadjointcheckpointscheme_fixed.h>
 #include <sundials/sundials_adjointcheckpointscheme.h>
 #include <sundials/sundials_core.h>
 
 #include "sundatanode/sundatanode_inmem.h"
+#include "sundatanode/sundatanode_mmap.h"
 #include "sundials_adjointcheckpointscheme_impl.h"
 #include "sundials_datanode.h"
 #include "sundials_logger_impl.h"
 #include "sundials_macros.h"
 #include "sundials_utils.h"
 
+/* Asynchronous inserts and prefetches use a Pthreads helper thread */
+#if defined(SUNDIALS_PTHREADS_ENABLED)
+#define SUN_CHECKPOINT_ASYNC_ENABLED
+#include <pthread.h>
+#endif
+
+/* Maximum number of leaves of a step that are prefetched */
+#define SUN_CHECKPOINT_PREFETCH_MAX 64
+
+/* Distance between the bytes touched to fault in a prefetched leaf */
+#define SUN_CHECKPOINT_PAGE_BYTES 4096
+
+typedef struct sunCheckpointAsync_ sunCheckpointAsync;
+typedef struct sunCheckpointTier_ sunCheckpointTier;
+
 struct SUNAdjointCheckpointScheme_Fixed_Content_
 {
   suncountertype backup_interval;
@@ -37,6 +55,13 @@ struct SUNAdjointCheckpointScheme_Fixed_Content_
   SUNDataNode current_load_step_node;
   SUNDataIOMode io_mode;
   sunbooleantype keep;
+  sunCheckpointAsync* async;
+  sunCheckpointTier* tier;
+  SUNDataCompression compression;
+  sunrealtype compression_tol;
+  N_Vector ewt;        /* error weights of the integrator (not owned) */
+  size_t raw_bytes;    /* bytes of the inserted states                */
+  size_t stored_bytes; /* bytes of the leaves holding them            */
 };
 
 typedef struct SUNAdjointCheckpointScheme_Fixed_Content_*
@@ -45,6 +70,416 @@ typedef struct SUNAdjointCheckpointScheme_Fixed_Content_*
 #define GET_CONTENT(S)       ((SUNAdjointCheckpointScheme_Fixed_Content)S->content)
 #define IMPL_MEMBER(S, prop) (GET_CONTENT(S)->prop)
 
+#if defined(SUN_CHECKPOINT_ASYNC_ENABLED)
+
+/* A staging buffer holding a packed state (t followed by the vector data) until
+   the helper thread copies it into the storage of its checkpoint leaf */
+typedef struct
+{
+  sunrealtype* buffer;
+  size_t capacity; /* size of buffer in bytes        */
+  size_t bytes;    /* bytes of data in buffer        */
+  void* dst;       /* storage reserved for the leaf  */
+} sunCheckpointSlot;
+
+struct sunCheckpointAsync_
+{
+  pthread_t worker;
+  pthread_mutex_t lock;
+  pthread_cond_t work_cond; /* signaled when there is work for the worker */
+  pthread_cond_t done_cond; /* signaled when the worker finishes a task   */
+  sunbooleantype shutdown;
+
+  /* staging buffers, used in order */
+  int num_slots;
+  sunCheckpointSlot* slots;
+  long int num_posted; /* inserts handed to the worker */
+  long int num_copied; /* inserts stored by the worker */
+
+  /* leaves of the step the backward sweep is expected to load next */
+  sunbooleantype prefetch_pending;
+  suncountertype prefetch_step;
+  int num_prefetch;
+  const char* prefetch_data[SUN_CHECKPOINT_PREFETCH_MAX];
+  size_t prefetch_bytes[SUN_CHECKPOINT_PREFETCH_MAX];
+  unsigned char prefetch_sum;
+};
+
+/* The worker only copies and reads raw memory. All SUNDIALS objects (nodes,
+   memory helpers, the context and its profiler) are used from the calling
+   thread only. */
+static void* sunCheckpointWorker(void* arg)
+{
+  sunCheckpointAsync* async = (sunCheckpointAsync*)arg;
+
+  pthread_mutex_lock(&async->lock);
+  for (;;)
+  {
+    if (async->num_copied < async->num_posted)
+    {
+      sunCheckpointSlot* slot =
+        &async->slots[async->num_copied % async->num_slots];
+      pthread_mutex_unlock(&async->lock);
+
+      memcpy(slot->dst, slot->buffer, slot->bytes);
+
+      pthread_mutex_lock(&async->lock);
+      async->num_copied++;
+      pthread_cond_broadcast(&async->done_cond);
+    }
+    else if (async->prefetch_pending)
+    {
+      unsigned char sum = 0;
+      int i;
+      pthread_mutex_unlock(&async->lock);
+
+      /* touch every page so that paged out or file-backed data is read in */
+      for (i = 0; i < async->num_prefetch; i++)
+      {
+        const volatile char* data = async->prefetch_data[i];
+        size_t j;
+        for (j = 0; j < async->prefetch_bytes[i];
+             j += SUN_CHECKPOINT_PAGE_BYTES)
+        {
+          sum = (unsigned char)(sum + data[j]);
+        }
+      }
+
+      pthread_mutex_lock(&async->lock);
+      async->prefetch_sum     = sum;
+      async->prefetch_pending = SUNFALSE;
+      pthread_cond_broadcast(&async->done_cond);
+    }
+    else if (async->shutdown) { break; }
+    else { pthread_cond_wait(&async->work_cond, &async->lock); }
+  }
+  pthread_mutex_unlock(&async->lock);
+
+  return NULL;
+}
+
+/* Waits until all posted inserts are stored */
+static void sunCheckpointAsync_WaitCopies(sunCheckpointAsync* async)
+{
+  pthread_mutex_lock(&async->lock);
+  while (async->num_copied < async->num_posted)
+  {
+    pthread_cond_wait(&async->done_cond, &async->lock);
+  }
+  pthread_mutex_unlock(&async->lock);
+}
+
+/* Waits until a prefetch of the given step (or of any step if step_num < 0)
+   is done so that its leaves can be destroyed */
+static void sunCheckpointAsync_WaitPrefetch(sunCheckpointAsync* async,
+                                            suncountertype step_num)
+{
+  pthread_mutex_lock(&async->lock);
+  while (async->prefetch_pending &&
+         (step_num < 0 || async->prefetch_step == step_num))
+  {
+    pthread_cond_wait(&async->done_cond, &async->lock);
+  }
+  pthread_mutex_unlock(&async->lock);
+}
+
+static void sunCheckpointAsync_Free(sunCheckpointAsync** async_ptr)
+{
+  sunCheckpointAsync* async = *async_ptr;
+  int i;
+
+  if (async == NULL) { return; }
+
+  /* the worker finishes all posted work before exiting */
+  pthread_mutex_lock(&async->lock);
+  async->shutdown = SUNTRUE;
+  pthread_cond_signal(&async->work_cond);
+  pthread_mutex_unlock(&async->lock);
+  pthread_join(async->worker, NULL);
+
+  pthread_mutex_destroy(&async->lock);
+  pthread_cond_destroy(&async->work_cond);
+  pthread_cond_destroy(&async->done_cond);
+
+  for (i = 0; i < async->num_slots; i++) { free(async->slots[i].buffer); }
+  free(async->slots);
+  free(async);
+
+  *async_ptr = NULL;
+}
+
+#endif
+
+/* A checkpointed step and whether its leaves are in memory or in the file */
+typedef struct
+{
+  suncountertype step_num;
+  sunbooleantype spilled;
+} sunCheckpointTierStep;
+
+/* Bookkeeping for holding at most max_mem_steps checkpointed steps in memory
+   and spilling the others to a memory-mapped file */
+struct sunCheckpointTier_
+{
+  suncountertype max_mem_steps; /* steps held in memory at most */
+  suncountertype promote_steps; /* steps promoted ahead of the sweep */
+  suncountertype num_mem_steps; /* steps currently held in memory */
+  suncountertype num_spilled;   /* steps moved to the file so far */
+  suncountertype num_promoted;  /* steps moved back to memory so far */
+  suncountertype load_step;     /* last step loaded by the backward sweep */
+  sunbooleantype recomputing;   /* inserts come from a recomputation */
+
+  /* all checkpointed steps sorted by step number */
+  sunCheckpointTierStep* steps;
+  suncountertype num_steps;
+  suncountertype max_steps;
+};
+
+/* Returns the position of a step in the sorted list of steps or the position
+   where it would be inserted */
+static suncountertype sunTierFind(const sunCheckpointTier* tier,
+                                  suncountertype step_num,
+                                  sunbooleantype* found)
+{
+  suncountertype lo = 0;
+  suncountertype hi = tier->num_steps;
+  while (lo < hi)
+  {
+    suncountertype mid = lo + (hi - lo) / 2;
+    if (tier->steps[mid].step_num < step_num) { lo = mid + 1; }
+    else { hi = mid; }
+  }
+  *found = lo < tier->num_steps && tier->steps[lo].step_num == step_num;
+  return lo;
+}
+
+/* Picks the in-memory step the backward sweep needs last. Steps after
+   passed_step (if nonnegative) were already loaded, so the latest of those is
+   picked first. Otherwise the earliest step before before_step is picked.
+   Returns -1 if no step qualifies. */
+static suncountertype sunTierPickVictim(const sunCheckpointTier* tier,
+                                        suncountertype passed_step,
+                                        suncountertype before_step)
+{
+  suncountertype i;
+
+  if (passed_step >= 0)
+  {
+    for (i = tier->num_steps - 1; i >= 0; i--)
+    {
+      if (tier->steps[i].step_num <= passed_step) { break; }
+      if (!tier->steps[i].spilled) { return i; }
+    }
+  }
+
+  for (i = 0; i < tier->num_steps; i++)
+  {
+    if (tier->steps[i].step_num >= before_step) { break; }
+    if (!tier->steps[i].spilled) { return i; }
+  }
+
+  return -1;
+}
+
+/* Moves all leaves of the step at the given position to the file or back to
+   memory */
+static SUNErrCode sunTierMoveStep(SUNAdjointCheckpointScheme self,
+                                  suncountertype pos, sunbooleantype spill)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  sunCheckpointTier* tier     = IMPL_MEMBER(self, tier);
+  sunCheckpointTierStep* step = &tier->steps[pos];
+  SUNDataNode step_data_node  = NULL;
+  SUNErrCode errcode          = SUN_SUCCESS;
+
+#if defined(SUN_CHECKPOINT_ASYNC_ENABLED)
+  /* the helper thread may still be writing or reading the leaves */
+  if (IMPL_MEMBER(self, async))
+  {
+    sunCheckpointAsync_WaitCopies(IMPL_MEMBER(self, async));
+    sunCheckpointAsync_WaitPrefetch(IMPL_MEMBER(self, async), -1);
+  }
+#endif
+
+  char* key = sunSignedToString(step->step_num);
+  errcode   = SUNDataNode_GetNamedChild(IMPL_MEMBER(self, root_node), key,
+                                        &step_data_node);
+  free(key);
+  SUNCheckCall(errcode);
+
+  sundataindex i;
+  for (i = 0;; i++)
+  {
+    SUNDataNode solution_node = NULL;
+    errcode = SUNDataNode_GetChild(step_data_node, i, &solution_node);
+    if (errcode == SUN_ERR_DATANODE_NODENOTFOUND) { break; }
+    SUNCheckCall(errcode);
+
+    if (spill) { SUNCheckCall(SUNDataNode_Spill_Mmap(solution_node)); }
+    else { SUNCheckCall(SUNDataNode_Promote_Mmap(solution_node)); }
+  }
+
+  step->spilled = spill;
+  if (spill)
+  {
+    SUNLogExtraDebug(SUNCTX_->logger, "spill-step", "step_num = %d",
+                     step->step_num);
+    tier->num_mem_steps--;
+    tier->num_spilled++;
+  }
+  else
+  {
+    SUNLogExtraDebug(SUNCTX_->logger, "promote-step", "step_num = %d",
+                     step->step_num);
+    tier->num_mem_steps++;
+    tier->num_promoted++;
+  }
+
+  return SUN_SUCCESS;
+}
+
+/* Records a new in-memory step and spills steps while there are too many */
+static SUNErrCode sunTierAddStep(SUNAdjointCheckpointScheme self,
+                                 suncountertype step_num)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  sunCheckpointTier* tier = IMPL_MEMBER(self, tier);
+  sunbooleantype found    = SUNFALSE;
+  suncountertype pos      = sunTierFind(tier, step_num, &found);
+
+  if (found)
+  {
+    /* the step was inserted again and its new leaves are in memory */
+    if (tier->steps[pos].spilled) { tier->num_mem_steps++; }
+    tier->steps[pos].spilled = SUNFALSE;
+  }
+  else
+  {
+    if (tier->num_steps == tier->max_steps)
+    {
+      suncountertype max_steps    = tier->max_steps ? 2 * tier->max_steps : 64;
+      sunCheckpointTierStep* steps = (sunCheckpointTierStep*)
+        realloc(tier->steps, (size_t)max_steps * sizeof(*steps));
+      SUNAssert(steps, SUN_ERR_MALLOC_FAIL);
+      tier->steps     = steps;
+      tier->max_steps = max_steps;
+    }
+    memmove(&tier->steps[pos + 1], &tier->steps[pos],
+            (size_t)(tier->num_steps - pos) * sizeof(*tier->steps));
+    tier->steps[pos].step_num = step_num;
+    tier->steps[pos].spilled  = SUNFALSE;
+    tier->num_steps++;
+    tier->num_mem_steps++;
+  }
+
+  /* A forward sweep needs the earliest steps last. While recomputing, the
+     steps after the backward sweep's position are not needed anymore. */
+  while (tier->num_mem_steps > tier->max_mem_steps)
+  {
+    suncountertype victim =
+      sunTierPickVictim(tier, tier->recomputing ? tier->load_step : -1,
+                        step_num);
+    if (victim < 0) { break; }
+    SUNCheckCall(sunTierMoveStep(self, victim, SUNTRUE));
+  }
+
+  return SUN_SUCCESS;
+}
+
+/* Forgets a step whose checkpoints were removed */
+static void sunTierRemoveStep(sunCheckpointTier* tier, suncountertype step_num)
+{
+  sunbooleantype found = SUNFALSE;
+  suncountertype pos   = sunTierFind(tier, step_num, &found);
+
+  if (!found) { return; }
+
+  if (!tier->steps[pos].spilled) { tier->num_mem_steps--; }
+  memmove(&tier->steps[pos], &tier->steps[pos + 1],
+          (size_t)(tier->num_steps - pos - 1) * sizeof(*tier->steps));
+  tier->num_steps--;
+}
+
+/* Promotes the step the backward sweep loads and up to promote_steps of the
+   checkpointed steps before it, spilling steps that are needed later */
+static SUNErrCode sunTierLoadStep(SUNAdjointCheckpointScheme self,
+                                  suncountertype step_num)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  sunCheckpointTier* tier = IMPL_MEMBER(self, tier);
+  sunbooleantype found    = SUNFALSE;
+  suncountertype pos      = sunTierFind(tier, step_num, &found);
+  suncountertype k;
+
+  tier->load_step = step_num;
+
+  /* the step was stored before the tiers were enabled */
+  if (!found) { return SUN_SUCCESS; }
+
+  for (k = 0; k <= tier->promote_steps && pos - k >= 0; k++)
+  {
+    if (!tier->steps[pos - k].spilled) { continue; }
+
+    if (tier->num_mem_steps >= tier->max_mem_steps)
+    {
+      suncountertype victim =
+        sunTierPickVictim(tier, step_num, tier->steps[pos - k].step_num);
+      if (victim < 0) { break; }
+      SUNCheckCall(sunTierMoveStep(self, victim, SUNTRUE));
+    }
+    SUNCheckCall(sunTierMoveStep(self, pos - k, SUNFALSE));
+  }
+
+  return SUN_SUCCESS;
+}
+
+/* Adds a leaf holding the state for a step/stage to the step's list node */
+static SUNErrCode sunCheckpointAddLeaf(
+  SUNAdjointCheckpointScheme self, suncountertype step_num,
+  SUNDIALS_MAYBE_UNUSED suncountertype stage_num,
+  SUNDIALS_MAYBE_UNUSED sunrealtype t, SUNDataNode solution_node)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  /* If this is the first state for a step, then we need to create a
+     list node first to store the step and all stage solutions in.
+     We keep a pointer to the list node until this step is over for
+     fast access when inserting stages. */
+  SUNDataNode step_data_node = NULL;
+  if (step_num != IMPL_MEMBER(self, step_num_of_current_insert))
+  {
+    SUNCheckCall(SUNDataNode_CreateList(IMPL_MEMBER(self, io_mode), 0, SUNCTX_,
+                                        &step_data_node));
+    IMPL_MEMBER(self, current_insert_step_node)   = step_data_node;
+    IMPL_MEMBER(self, step_num_of_current_insert) = step_num;
+
+    /* Store the step node in the root node object. */
+    char* key = sunSignedToString(step_num);
+    SUNLogExtraDebug(SUNCTX_->logger, "insert-new-step",
+                     "step_num = %d, key = %s", step_num, key);
+    SUNCheckCall(SUNDataNode_AddNamedChild(IMPL_MEMBER(self, root_node), key,
+                                           step_data_node));
+    free(key);
+
+    if (IMPL_MEMBER(self, tier))
+    {
+      SUNCheckCall(sunTierAddStep(self, step_num));
+    }
+  }
+  else { step_data_node = IMPL_MEMBER(self, current_insert_step_node); }
+
+  /* Add the state data as a leaf node in the step node's list of children. */
+  SUNLogExtraDebug(SUNCTX_->logger, "insert-stage",
+                   "step_num = %d, stage_num = %d, t = %g", step_num, stage_num,
+                   t);
+  SUNCheckCall(SUNDataNode_AddChild(step_data_node, solution_node));
+
+  return SUN_SUCCESS;
+}
+
 SUNErrCode SUNAdjointCheckpointScheme_Create_Fixed(
   SUNDataIOMode io_mode, SUNMemoryHelper mem_helper, suncountertype interval,
   suncountertype estimate, sunbooleantype keep, SUNContext sunctx,
@@ -59,7 +494,9 @@ SUNErrCode SUNAdjointCheckpointScheme_Create_Fixed(
   check_scheme->ops->insertvector = SUNAdjointCheckpointScheme_InsertVector_Fixed;
   check_scheme->ops->loadvector  = SUNAdjointCheckpointScheme_LoadVector_Fixed;
   check_scheme->ops->enableDense = SUNAdjointCheckpointScheme_EnableDense_Fixed;
-  check_scheme->ops->destroy     = SUNAdjointCheckpointScheme_Destroy_Fixed;
+  check_scheme->ops->seterrorweights =
+    SUNAdjointCheckpointScheme_SetErrorWeights_Fixed;
+  check_scheme->ops->destroy = SUNAdjointCheckpointScheme_Destroy_Fixed;
 
   SUNAdjointCheckpointScheme_Fixed_Content content = NULL;
 
@@ -75,6 +512,13 @@ SUNErrCode SUNAdjointCheckpointScheme_Create_Fixed(
   content->current_load_step_node     = NULL;
   content->step_num_of_current_load   = -2;
   content->io_mode                    = io_mode;
+  content->async                      = NULL;
+  content->tier                       = NULL;
+  content->compression                = SUNDATACOMPRESSION_NONE;
+  content->compression_tol            = SUN_RCONST(0.0);
+  content->ewt                        = NULL;
+  content->raw_bytes                  = 0;
+  content->stored_bytes               = 0;
 
   SUNCheckCall(
     SUNDataNode_CreateObject(io_mode, estimate, sunctx, &content->root_node));
@@ -98,45 +542,170 @@ SUNErrCode SUNAdjointCheckpointScheme_NeedsSaving_Fixed(
   return SUN_SUCCESS;
 }
 
+#if defined(SUN_CHECKPOINT_ASYNC_ENABLED)
+
+/* Packs the state into a staging buffer and reserves the leaf storage, the
+   copy into the storage is left to the helper thread */
+static SUNErrCode sunInsertVectorAsync(SUNAdjointCheckpointScheme self,
+                                       suncountertype step_num,
+                                       suncountertype stage_num, sunrealtype t,
+                                       N_Vector y)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  sunCheckpointAsync* async = IMPL_MEMBER(self, async);
+
+  sunindextype buffer_size = 0;
+  SUNCheckCall(N_VBufSize(y, &buffer_size));
+  size_t bytes = buffer_size + sizeof(sunrealtype);
+
+  /* wait for the worker to free a staging buffer */
+  pthread_mutex_lock(&async->lock);
+  while (async->num_posted - async->num_copied == async->num_slots)
+  {
+    pthread_cond_wait(&async->done_cond, &async->lock);
+  }
+  sunCheckpointSlot* slot = &async->slots[async->num_posted % async->num_slots];
+  pthread_mutex_unlock(&async->lock);
+
+  if (slot->capacity < bytes)
+  {
+    free(slot->buffer);
+    slot->buffer   = (sunrealtype*)malloc(bytes);
+    slot->capacity = slot->buffer ? bytes : 0;
+    SUNAssert(slot->buffer, SUN_ERR_MALLOC_FAIL);
+  }
+
+  /* Same layout as SUNDataNode_SetDataNvector: t followed by the vector */
+  slot->buffer[0] = t;
+  SUNCheckCall(N_VBufPack(y, &slot->buffer[1]));
+  slot->bytes = bytes;
+
+  SUNDataNode solution_node = NULL;
+  SUNCheckCall(SUNDataNode_CreateLeaf(IMPL_MEMBER(self, io_mode),
+                                      IMPL_MEMBER(self, mem_helper), SUNCTX_,
+                                      &solution_node));
+  SUNCheckCall(SUNDataNode_ReserveData(solution_node, SUNMEMTYPE_HOST,
+                                       sizeof(sunrealtype), bytes, &slot->dst));
+  SUNCheckCall(
+    sunCheckpointAddLeaf(self, step_num, stage_num, t, solution_node));
+
+  pthread_mutex_lock(&async->lock);
+  async->num_posted++;
+  pthread_cond_signal(&async->work_cond);
+  pthread_mutex_unlock(&async->lock);
+
+  return SUN_SUCCESS;
+}
+
+/* Hands the leaves of the given step to the worker to be read in */
+static SUNErrCode sunPrefetchStepAsync(SUNAdjointCheckpointScheme self,
+                                       suncountertype step_num)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  sunCheckpointAsync* async = IMPL_MEMBER(self, async);
+  SUNDataNode step_data_node = NULL;
+  SUNErrCode errcode         = SUN_SUCCESS;
+
+  if (step_num < 0) { return SUN_SUCCESS; }
+
+  /* the prefetch arrays are in use until the previous prefetch is done */
+  sunCheckpointAsync_WaitPrefetch(async, -1);
+
+  char* key = sunSignedToString(step_num);
+  errcode   = SUNDataNode_GetNamedChild(IMPL_MEMBER(self, root_node), key,
+                                        &step_data_node);
+  free(key);
+  if (errcode == SUN_ERR_DATANODE_NODENOTFOUND) { return SUN_SUCCESS; }
+  SUNCheckCall(errcode);
+
+  int num_prefetch = 0;
+  while (num_prefetch < SUN_CHECKPOINT_PREFETCH_MAX)
+  {
+    SUNDataNode solution_node = NULL;
+    void* data                = NULL;
+    size_t data_stride        = 0;
+    size_t data_bytes         = 0;
+
+    errcode = SUNDataNode_GetChild(step_data_node, num_prefetch,
+                                   &solution_node);
+    if (errcode == SUN_ERR_DATANODE_NODENOTFOUND) { break; }
+    SUNCheckCall(errcode);
+
+    SUNCheckCall(
+      SUNDataNode_GetData(solution_node, &data, &data_stride, &data_bytes));
+    async->prefetch_data[num_prefetch]  = (const char*)data;
+    async->prefetch_bytes[num_prefetch] = data_bytes;
+    num_prefetch++;
+  }
+
+  if (num_prefetch == 0) { return SUN_SUCCESS; }
+
+  SUNLogExtraDebug(SUNCTX_->logger, "prefetch-step",
+                   "step_num = %d, num_leaves = %d", step_num, num_prefetch);
+
+  pthread_mutex_lock(&async->lock);
+  async->num_prefetch     = num_prefetch;
+  async->prefetch_step    = step_num;
+  async->prefetch_pending = SUNTRUE;
+  pthread_cond_signal(&async->work_cond);
+  pthread_mutex_unlock(&async->lock);
+
+  return SUN_SUCCESS;
+}
+
+#endif
+
 SUNErrCode SUNAdjointCheckpointScheme_InsertVector_Fixed(
   SUNAdjointCheckpointScheme self, suncountertype step_num,
   SUNDIALS_MAYBE_UNUSED suncountertype stage_num, sunrealtype t, N_Vector y)
 {
   SUNFunctionBegin(self->sunctx);
 
-  /* If this is the first state for a step, then we need to create a
-     list node first to store the step and all stage solutions in.
-     We keep a pointer to the list node until this step is over for
-     fast access when inserting stages. */
-  SUNDataNode step_data_node = NULL;
-  if (step_num != IMPL_MEMBER(self, step_num_of_current_insert))
+  sunindextype buffer_size = 0;
+  SUNCheckCall(N_VBufSize(y, &buffer_size));
+  IMPL_MEMBER(self, raw_bytes) += buffer_size + sizeof(sunrealtype);
+
+  SUNDataCompression compression = IMPL_MEMBER(self, compression);
+
+#if defined(SUN_CHECKPOINT_ASYNC_ENABLED)
+  /* compressed states are encoded here, so they are stored synchronously */
+  if (IMPL_MEMBER(self, async) && compression == SUNDATACOMPRESSION_NONE)
   {
-    SUNCheckCall(SUNDataNode_CreateList(IMPL_MEMBER(self, io_mode), 0, SUNCTX_,
-                                        &step_data_node));
-    IMPL_MEMBER(self, current_insert_step_node)   = step_data_node;
-    IMPL_MEMBER(self, step_num_of_current_insert) = step_num;
+    SUNCheckCall(sunInsertVectorAsync(self, step_num, stage_num, t, y));
+    IMPL_MEMBER(self, stored_bytes) += buffer_size + sizeof(sunrealtype);
+    return SUN_SUCCESS;
+  }
+#endif
 
-    /* Store the step node in the root node object. */
-    char* key = sunSignedToString(step_num);
-    SUNLogExtraDebug(SUNCTX_->logger, "insert-new-step",
-                     "step_num = %d, key = %s", step_num, key);
-    SUNCheckCall(SUNDataNode_AddNamedChild(IMPL_MEMBER(self, root_node), key,
-                                           step_data_node));
-    free(key);
+  /* The weights belong to the integrator's current problem, which is the
+     adjoint system during the backward sweep. States the weights do not
+     match are stored losslessly. */
+  N_Vector ewt = IMPL_MEMBER(self, ewt);
+  if (ewt && compression == SUNDATACOMPRESSION_LOSSY)
+  {
+    sunindextype ewt_size = 0;
+    SUNCheckCall(N_VBufSize(ewt, &ewt_size));
+    if (ewt_size != buffer_size) { ewt = NULL; }
   }
-  else { step_data_node = IMPL_MEMBER(self, current_insert_step_node); }
 
-  /* Add the state data as a leaf node in the step node's list of children. */
   SUNDataNode solution_node = NULL;
   SUNCheckCall(SUNDataNode_CreateLeaf(IMPL_MEMBER(self, io_mode),
                                       IMPL_MEMBER(self, mem_helper), SUNCTX_,
                                       &solution_node));
-  SUNCheckCall(SUNDataNode_SetDataNvector(solution_node, y, t));
+  SUNCheckCall(SUNDataNode_SetDataNvectorCompressed(solution_node, y, t,
+                                                    compression, ewt,
+                                                    IMPL_MEMBER(self,
+                                                                compression_tol)));
+  SUNCheckCall(
+    sunCheckpointAddLeaf(self, step_num, stage_num, t, solution_node));
 
-  SUNLogExtraDebug(SUNCTX_->logger, "insert-stage",
-                   "step_num = %d, stage_num = %d, t = %g", step_num, stage_num,
-                   t);
-  SUNCheckCall(SUNDataNode_AddChild(step_data_node, solution_node));
+  void* data        = NULL;
+  size_t data_bytes = 0;
+  size_t stride     = 0;
+  SUNCheckCall(SUNDataNode_GetData(solution_node, &data, &stride, &data_bytes));
+  IMPL_MEMBER(self, stored_bytes) += data_bytes;
 
   return SUN_SUCCESS;
 }
@@ -150,6 +719,14 @@ SUNErrCode SUNAdjointCheckpointScheme_LoadVector_Fixed(
 
   SUNErrCode errcode = SUN_SUCCESS;
 
+#if defined(SUN_CHECKPOINT_ASYNC_ENABLED)
+  /* the leaves must be stored before they can be loaded */
+  if (IMPL_MEMBER(self, async))
+  {
+    sunCheckpointAsync_WaitCopies(IMPL_MEMBER(self, async));
+  }
+#endif
+
   /* If we are trying to load the step solution, we need to load the list which holds
      the step and stage solutions. We keep a pointer to the list node until
      this step is over for fast access when loading stages. */
@@ -166,6 +743,15 @@ SUNErrCode SUNAdjointCheckpointScheme_LoadVector_Fixed(
     {
       IMPL_MEMBER(self, current_load_step_node)   = step_data_node;
       IMPL_MEMBER(self, step_num_of_current_load) = step_num;
+
+#if defined(SUN_CHECKPOINT_ASYNC_ENABLED)
+      /* the backward sweep loads the previous checkpointed step next */
+      if (IMPL_MEMBER(self, async))
+      {
+        SUNCheckCall(
+          sunPrefetchStepAsync(self, step_num - IMPL_MEMBER(self, interval)));
+      }
+#endif
     }
     else if (errcode == SUN_ERR_DATANODE_NODENOTFOUND)
     {
@@ -185,6 +771,14 @@ SUNErrCode SUNAdjointCheckpointScheme_LoadVector_Fixed(
   SUNLogExtraDebug(SUNCTX_->logger, "step-loaded",
                    "step_num = %d, stage_num = %d", step_num, stage_num);
 
+  /* Peeks are how the integrator looks for a step to recompute from, so only
+     actual loads move the backward sweep's position */
+  if (IMPL_MEMBER(self, tier) && !peek &&
+      step_num != IMPL_MEMBER(self, tier)->load_step)
+  {
+    SUNCheckCall(sunTierLoadStep(self, step_num));
+  }
+
   SUNDataNode solution_node = NULL;
   if (IMPL_MEMBER(self, keep) || peek)
   {
@@ -197,6 +791,14 @@ SUNErrCode SUNAdjointCheckpointScheme_LoadVector_Fixed(
   }
   else
   {
+#if defined(SUN_CHECKPOINT_ASYNC_ENABLED)
+    /* the worker may still be reading the leaves we are about to destroy */
+    if (IMPL_MEMBER(self, async))
+    {
+      sunCheckpointAsync_WaitPrefetch(IMPL_MEMBER(self, async), step_num);
+    }
+#endif
+
     sunbooleantype has_children = SUNFALSE;
     SUNCheckCall(SUNDataNode_HasChildren(step_data_node, &has_children));
 
@@ -222,6 +824,11 @@ SUNErrCode SUNAdjointCheckpointScheme_LoadVector_Fixed(
                                                 key, &step_data_node));
       free(key);
       SUNCheckCall(SUNDataNode_Destroy(&step_data_node));
+
+      if (IMPL_MEMBER(self, tier))
+      {
+        sunTierRemoveStep(IMPL_MEMBER(self, tier), step_num);
+      }
     }
   }
 
@@ -253,8 +860,18 @@ SUNErrCode SUNAdjointCheckpointScheme_Destroy_Fixed(
 
   SUNAdjointCheckpointScheme self = *self_ptr;
 
+#if defined(SUN_CHECKPOINT_ASYNC_ENABLED)
+  sunCheckpointAsync_Free(&IMPL_MEMBER(self, async));
+#endif
+
   SUNCheckCall(SUNDataNode_Destroy(&IMPL_MEMBER(self, root_node)));
 
+  if (IMPL_MEMBER(self, tier))
+  {
+    free(IMPL_MEMBER(self, tier)->steps);
+    free(IMPL_MEMBER(self, tier));
+  }
+
   free(self->content);
   free(self->ops);
   free(self);
@@ -281,5 +898,158 @@ SUNErrCode SUNAdjointCheckpointScheme_EnableDense_Fixed(
                                                       backup_interval);
   }
 
+  if (IMPL_MEMBER(check_scheme, tier))
+  {
+    IMPL_MEMBER(check_scheme, tier)->recomputing = on_or_off;
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_SetErrorWeights_Fixed(
+  SUNAdjointCheckpointScheme check_scheme, N_Vector ewt)
+{
+  SUNFunctionBegin(check_scheme->sunctx);
+
+  IMPL_MEMBER(check_scheme, ewt) = ewt;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_EnableAsync_Fixed(
+  SUNAdjointCheckpointScheme check_scheme, int num_buffers)
+{
+  SUNFunctionBegin(check_scheme->sunctx);
+
+#if defined(SUN_CHECKPOINT_ASYNC_ENABLED)
+  /* finish any outstanding work with the current settings */
+  sunCheckpointAsync_Free(&IMPL_MEMBER(check_scheme, async));
+
+  if (num_buffers <= 0) { return SUN_SUCCESS; }
+
+  sunCheckpointAsync* async = (sunCheckpointAsync*)calloc(1, sizeof(*async));
+  SUNAssert(async, SUN_ERR_MALLOC_FAIL);
+
+  async->slots = (sunCheckpointSlot*)calloc((size_t)num_buffers,
+                                            sizeof(sunCheckpointSlot));
+  if (async->slots == NULL)
+  {
+    free(async);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+  async->num_slots     = num_buffers;
+  async->prefetch_step = -1;
+
+  pthread_mutex_init(&async->lock, NULL);
+  pthread_cond_init(&async->work_cond, NULL);
+  pthread_cond_init(&async->done_cond, NULL);
+
+  if (pthread_create(&async->worker, NULL, sunCheckpointWorker, (void*)async))
+  {
+    pthread_mutex_destroy(&async->lock);
+    pthread_cond_destroy(&async->work_cond);
+    pthread_cond_destroy(&async->done_cond);
+    free(async->slots);
+    free(async);
+    return SUN_ERR_OP_FAIL;
+  }
+
+  IMPL_MEMBER(check_scheme, async) = async;
+
+  return SUN_SUCCESS;
+#else
+  return (num_buffers > 0) ? SUN_ERR_NOT_IMPLEMENTED : SUN_SUCCESS;
+#endif
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_EnableMultilevel_Fixed(
+  SUNAdjointCheckpointScheme check_scheme, suncountertype max_mem_steps,
+  suncountertype promote_steps)
+{
+  SUNFunctionBegin(check_scheme->sunctx);
+
+  sunCheckpointTier* tier = IMPL_MEMBER(check_scheme, tier);
+
+  if (max_mem_steps < 0 || promote_steps < 0) { return SUN_ERR_ARG_OUTOFRANGE; }
+
+  /* leaves already in the file stay there */
+  if (max_mem_steps == 0)
+  {
+    if (tier)
+    {
+      free(tier->steps);
+      free(tier);
+      IMPL_MEMBER(check_scheme, tier) = NULL;
+    }
+    return SUN_SUCCESS;
+  }
+
+#if defined(SUNDIALS_HAVE_MMAP)
+  /* the memory tier holds the in-memory leaves */
+  if (IMPL_MEMBER(check_scheme, io_mode) != SUNDATAIOMODE_INMEM)
+  {
+    return SUN_ERR_ARG_INCOMPATIBLE;
+  }
+
+  if (tier == NULL)
+  {
+    tier = (sunCheckpointTier*)calloc(1, sizeof(*tier));
+    SUNAssert(tier, SUN_ERR_MALLOC_FAIL);
+    tier->load_step                 = -1;
+    IMPL_MEMBER(check_scheme, tier) = tier;
+  }
+
+  tier->max_mem_steps = max_mem_steps;
+  tier->promote_steps = promote_steps;
+
+  return SUN_SUCCESS;
+#else
+  return SUN_ERR_NOT_IMPLEMENTED;
+#endif
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_GetMultilevelStats_Fixed(
+  SUNAdjointCheckpointScheme check_scheme, suncountertype* num_spilled,
+  suncountertype* num_promoted)
+{
+  SUNFunctionBegin(check_scheme->sunctx);
+
+  sunCheckpointTier* tier = IMPL_MEMBER(check_scheme, tier);
+
+  *num_spilled  = tier ? tier->num_spilled : 0;
+  *num_promoted = tier ? tier->num_promoted : 0;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_EnableCompression_Fixed(
+  SUNAdjointCheckpointScheme check_scheme, SUNDataCompression compression,
+  sunrealtype tol)
+{
+  SUNFunctionBegin(check_scheme->sunctx);
+
+  if (compression != SUNDATACOMPRESSION_NONE &&
+      compression != SUNDATACOMPRESSION_LOSSLESS &&
+      compression != SUNDATACOMPRESSION_LOSSY)
+  {
+    return SUN_ERR_ARG_OUTOFRANGE;
+  }
+  if (!(tol >= SUN_RCONST(0.0))) { return SUN_ERR_ARG_OUTOFRANGE; }
+
+  IMPL_MEMBER(check_scheme, compression)     = compression;
+  IMPL_MEMBER(check_scheme, compression_tol) = tol;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNAdjointCheckpointScheme_GetCompressionStats_Fixed(
+  SUNAdjointCheckpointScheme check_scheme, size_t* raw_bytes,
+  size_t* stored_bytes)
+{
+  SUNFunctionBegin(check_scheme->sunctx);
+
+  *raw_bytes    = IMPL_MEMBER(check_scheme, raw_bytes);
+  *stored_bytes = IMPL_MEMBER(check_scheme, stored_bytes);
+
   return SUN_SUCCESS;
 }
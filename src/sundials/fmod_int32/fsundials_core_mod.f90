@@ -59,9 +59,10 @@ module fsundials_core_mod
  ! typedef enum SUNDataIOMode
  enum, bind(c)
   enumerator :: SUNDATAIOMODE_INMEM
+  enumerator :: SUNDATAIOMODE_MMAP
  end enum
  integer, parameter, public :: SUNDataIOMode = kind(SUNDATAIOMODE_INMEM)
- public :: SUNDATAIOMODE_INMEM
+ public :: SUNDATAIOMODE_INMEM, SUNDATAIOMODE_MMAP
  enum, bind(c)
   enumerator :: SUN_ERR_MINIMUM = -10000
   enumerator :: SUN_ERR_ARG_CORRUPT
@@ -214,6 +215,8 @@ module fsundials_core_mod
   type(C_FUNPTR), public :: nvlinearcombination
   type(C_FUNPTR), public :: nvscaleaddmulti
   type(C_FUNPTR), public :: nvdotprodmulti
+  type(C_FUNPTR), public :: nvlinearcombinationwrmsnorm
+  type(C_FUNPTR), public :: nvlinearcombinationmulti
   type(C_FUNPTR), public :: nvlinearsumvectorarray
   type(C_FUNPTR), public :: nvscalevectorarray
   type(C_FUNPTR), public :: nvconstvectorarray
@@ -230,8 +233,12 @@ module fsundials_core_mod
   type(C_FUNPTR), public :: nvminquotientlocal
   type(C_FUNPTR), public :: nvwsqrsumlocal
   type(C_FUNPTR), public :: nvwsqrsummasklocal
+  type(C_FUNPTR), public :: nvlinearcombinationwsqrsumlocal
   type(C_FUNPTR), public :: nvdotprodmultilocal
   type(C_FUNPTR), public :: nvdotprodmultiallreduce
+  type(C_FUNPTR), public :: nvsummaxmultiallreduce
+  type(C_FUNPTR), public :: nvdotprodmultiallreducebegin
+  type(C_FUNPTR), public :: nvdotprodmultiallreduceend
   type(C_FUNPTR), public :: nvbufsize
   type(C_FUNPTR), public :: nvbufpack
   type(C_FUNPTR), public :: nvbufunpack
@@ -320,11 +327,12 @@ module fsundials_core_mod
   enumerator :: SUNMATRIX_CUSPARSE
   enumerator :: SUNMATRIX_GINKGO
   enumerator :: SUNMATRIX_KOKKOSDENSE
+  enumerator :: SUNMATRIX_BLOCKDENSE
   enumerator :: SUNMATRIX_CUSTOM
  end enum
  integer, parameter, public :: SUNMatrix_ID = kind(SUNMATRIX_DENSE)
  public :: SUNMATRIX_DENSE, SUNMATRIX_MAGMADENSE, SUNMATRIX_ONEMKLDENSE, SUNMATRIX_BAND, SUNMATRIX_SPARSE, SUNMATRIX_SLUNRLOC, &
-    SUNMATRIX_CUSPARSE, SUNMATRIX_GINKGO, SUNMATRIX_KOKKOSDENSE, SUNMATRIX_CUSTOM
+    SUNMATRIX_CUSPARSE, SUNMATRIX_GINKGO, SUNMATRIX_KOKKOSDENSE, SUNMATRIX_BLOCKDENSE, SUNMATRIX_CUSTOM
  ! struct struct _generic_SUNMatrix_Ops
  type, bind(C), public :: SUNMatrix_Ops
   type(C_FUNPTR), public :: getid
@@ -369,8 +377,9 @@ module fsundials_core_mod
  enum, bind(c)
   enumerator :: SUN_MODIFIED_GS = 1
   enumerator :: SUN_CLASSICAL_GS = 2
+  enumerator :: SUN_PIPELINED_GS = 3
  end enum
- public :: SUN_MODIFIED_GS, SUN_CLASSICAL_GS
+ public :: SUN_MODIFIED_GS, SUN_CLASSICAL_GS, SUN_PIPELINED_GS
  public :: FSUNModifiedGS
  public :: FSUNClassicalGS
  public :: FSUNQRfact
@@ -410,6 +419,7 @@ module fsundials_core_mod
   enumerator :: SUNLINEARSOLVER_ONEMKLDENSE
   enumerator :: SUNLINEARSOLVER_GINKGO
   enumerator :: SUNLINEARSOLVER_KOKKOSDENSE
+  enumerator :: SUNLINEARSOLVER_BLOCKDENSE
   enumerator :: SUNLINEARSOLVER_CUSTOM
  end enum
  integer, parameter, public :: SUNLinearSolver_ID = kind(SUNLINEARSOLVER_BAND)
@@ -417,7 +427,7 @@ module fsundials_core_mod
     SUNLINEARSOLVER_LAPACKDENSE, SUNLINEARSOLVER_PCG, SUNLINEARSOLVER_SPBCGS, SUNLINEARSOLVER_SPFGMR, SUNLINEARSOLVER_SPGMR, &
     SUNLINEARSOLVER_SPTFQMR, SUNLINEARSOLVER_SUPERLUDIST, SUNLINEARSOLVER_SUPERLUMT, SUNLINEARSOLVER_CUSOLVERSP_BATCHQR, &
     SUNLINEARSOLVER_MAGMADENSE, SUNLINEARSOLVER_ONEMKLDENSE, SUNLINEARSOLVER_GINKGO, SUNLINEARSOLVER_KOKKOSDENSE, &
-    SUNLINEARSOLVER_CUSTOM
+    SUNLINEARSOLVER_BLOCKDENSE, SUNLINEARSOLVER_CUSTOM
  ! struct struct _generic_SUNLinearSolver_Ops
  type, bind(C), public :: SUNLinearSolver_Ops
   type(C_FUNPTR), public :: gettype
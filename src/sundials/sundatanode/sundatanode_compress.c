@@ -0,0 +1,312 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Compression of vectors stored in SUNDataNode leaves.
+ *
+ * Neighboring entries of smooth states share their sign, exponent
+ * and leading mantissa bits. XORing each value with the previous one
+ * turns those bits into zeros, and shuffling the bytes into planes
+ * gathers them into long runs that are cheap to run-length encode.
+ * The vector is processed in blocks that fit in the cache, and each
+ * pass is a simple loop over contiguous memory.
+ * -----------------------------------------------------------------*/
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_math.h>
+
+#include "sundatanode/sundatanode_compress.h"
+
+/* "SUNZ" in ASCII, marks a buffer as compressed */
+#define SUN_COMPRESS_MAGIC UINT32_C(0x5A4E5553)
+
+/* Leading data of a compressed buffer */
+typedef struct
+{
+  uint32_t magic;
+  uint32_t value_bytes;
+  uint64_t num_values;
+  sunrealtype t;
+  uint32_t block_values;
+} sunCompressHeader;
+
+/* Longest literal or zero run a token can describe */
+#define SUN_COMPRESS_MAX_RUN 128
+
+size_t sunCompressBound(size_t num_values)
+{
+  size_t bytes      = num_values * sizeof(sunrealtype);
+  size_t num_blocks = (num_values + SUN_COMPRESS_BLOCK_VALUES - 1) /
+                      SUN_COMPRESS_BLOCK_VALUES;
+
+  /* a literal run adds one token per SUN_COMPRESS_MAX_RUN bytes */
+  return sizeof(sunCompressHeader) + bytes + bytes / SUN_COMPRESS_MAX_RUN +
+         2 * num_blocks;
+}
+
+void sunQuantizeValues(sunrealtype* values, const sunrealtype* weights,
+                       sunrealtype tol, size_t num_values)
+{
+  size_t i;
+  for (i = 0; i < num_values; i++)
+  {
+    sunrealtype bound = tol / weights[i];
+    sunrealtype scale = SUN_RCONST(0.0);
+    int exponent      = 0;
+
+    if (!(weights[i] > SUN_RCONST(0.0)) || !(bound > SUN_RCONST(0.0)) ||
+        !(bound <= SUN_BIG_REAL / SUN_RCONST(2.0)))
+    {
+      continue;
+    }
+
+    /* the largest power of two not above twice the bound, rounding to a
+       multiple of it changes the value by at most the bound */
+    frexp((double)(SUN_RCONST(2.0) * bound), &exponent);
+    scale = (sunrealtype)ldexp(1.0, exponent - 1);
+
+    /* skip values that would not lose any bits, this also keeps the scaled
+       value from overflowing */
+    if (!(scale > SUN_UNIT_ROUNDOFF * SUNRabs(values[i]))) { continue; }
+
+    values[i] = SUNRround(values[i] / scale) * scale;
+  }
+}
+
+/* XORs each value with the previous one and stores byte b of value j of the
+   block at planes[b * block_values + j] */
+static void sunShuffleDelta(const unsigned char* bytes, size_t start,
+                            size_t block_values, unsigned char* planes)
+{
+  const size_t value_bytes = sizeof(sunrealtype);
+  size_t b, j;
+
+  for (b = 0; b < value_bytes; b++)
+  {
+    const unsigned char* in = bytes + start * value_bytes + b;
+    unsigned char* plane    = planes + b * block_values;
+    unsigned char prev      = (start > 0) ? *(in - value_bytes) : 0;
+
+    for (j = 0; j < block_values; j++)
+    {
+      unsigned char c = in[j * value_bytes];
+      plane[j]        = c ^ prev;
+      prev            = c;
+    }
+  }
+}
+
+/* Inverse of sunShuffleDelta */
+static void sunUnshuffleDelta(const unsigned char* planes, size_t start,
+                              size_t block_values, unsigned char* bytes)
+{
+  const size_t value_bytes = sizeof(sunrealtype);
+  size_t b, j;
+
+  for (b = 0; b < value_bytes; b++)
+  {
+    unsigned char* out         = bytes + start * value_bytes + b;
+    const unsigned char* plane = planes + b * block_values;
+    unsigned char prev         = (start > 0) ? *(out - value_bytes) : 0;
+
+    for (j = 0; j < block_values; j++)
+    {
+      prev                 = prev ^ plane[j];
+      out[j * value_bytes] = prev;
+    }
+  }
+}
+
+/* Run-length encodes zeros. A token below 128 is followed by token + 1
+   literal bytes and a token of 128 or more stands for token - 127 zeros. */
+static size_t sunEncodeRuns(const unsigned char* in, size_t len,
+                            unsigned char* out)
+{
+  size_t i   = 0;
+  size_t pos = 0;
+
+  while (i < len)
+  {
+    size_t run = 0;
+    while (i + run < len && in[i + run] == 0 && run < SUN_COMPRESS_MAX_RUN)
+    {
+      run++;
+    }
+
+    if (run >= 2)
+    {
+      out[pos++] = (unsigned char)(127 + run);
+      i += run;
+      continue;
+    }
+
+    /* single zeros are cheaper to keep in the literal run */
+    size_t lit = 0;
+    while (i + lit < len && lit < SUN_COMPRESS_MAX_RUN)
+    {
+      if (in[i + lit] == 0 && i + lit + 1 < len && in[i + lit + 1] == 0)
+      {
+        break;
+      }
+      lit++;
+    }
+
+    out[pos++] = (unsigned char)(lit - 1);
+    memcpy(out + pos, in + i, lit);
+    pos += lit;
+    i += lit;
+  }
+
+  return pos;
+}
+
+/* Decodes runs from in starting at *in_pos until len bytes are produced */
+static SUNErrCode sunDecodeRuns(const unsigned char* in, size_t in_len,
+                                size_t* in_pos, unsigned char* out, size_t len)
+{
+  size_t pos = *in_pos;
+  size_t o   = 0;
+
+  while (o < len)
+  {
+    if (pos >= in_len) { return SUN_ERR_CORRUPT; }
+
+    size_t token = in[pos++];
+    if (token >= 128)
+    {
+      size_t run = token - 127;
+      if (o + run > len) { return SUN_ERR_CORRUPT; }
+      memset(out + o, 0, run);
+      o += run;
+    }
+    else
+    {
+      size_t lit = token + 1;
+      if (o + lit > len || pos + lit > in_len) { return SUN_ERR_CORRUPT; }
+      memcpy(out + o, in + pos, lit);
+      o += lit;
+      pos += lit;
+    }
+  }
+
+  *in_pos = pos;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode sunCompressValues(sunrealtype t, const sunrealtype* values,
+                             size_t num_values, char* out, size_t* out_bytes)
+{
+  const unsigned char* bytes = (const unsigned char*)values;
+  unsigned char* planes      = NULL;
+  sunCompressHeader header;
+  size_t start;
+  size_t pos = sizeof(header);
+
+  planes = (unsigned char*)malloc(SUN_COMPRESS_BLOCK_VALUES *
+                                  sizeof(sunrealtype));
+  if (planes == NULL) { return SUN_ERR_MALLOC_FAIL; }
+
+  memset(&header, 0, sizeof(header));
+  header.magic        = SUN_COMPRESS_MAGIC;
+  header.t            = t;
+  header.num_values   = (uint64_t)num_values;
+  header.value_bytes  = (uint32_t)sizeof(sunrealtype);
+  header.block_values = (uint32_t)SUN_COMPRESS_BLOCK_VALUES;
+  memcpy(out, &header, sizeof(header));
+
+  for (start = 0; start < num_values; start += SUN_COMPRESS_BLOCK_VALUES)
+  {
+    size_t block_values = num_values - start;
+    if (block_values > SUN_COMPRESS_BLOCK_VALUES)
+    {
+      block_values = SUN_COMPRESS_BLOCK_VALUES;
+    }
+
+    sunShuffleDelta(bytes, start, block_values, planes);
+    pos += sunEncodeRuns(planes, block_values * sizeof(sunrealtype),
+                         (unsigned char*)out + pos);
+  }
+
+  free(planes);
+
+  *out_bytes = pos;
+  return SUN_SUCCESS;
+}
+
+sunbooleantype sunIsCompressed(const char* in, size_t in_bytes)
+{
+  uint32_t magic;
+
+  if (in == NULL || in_bytes < sizeof(sunCompressHeader)) { return SUNFALSE; }
+  memcpy(&magic, in, sizeof(magic));
+  return magic == SUN_COMPRESS_MAGIC ? SUNTRUE : SUNFALSE;
+}
+
+SUNErrCode sunCompressedNumValues(const char* in, size_t in_bytes,
+                                  size_t* num_values)
+{
+  sunCompressHeader header;
+
+  if (in_bytes < sizeof(header)) { return SUN_ERR_CORRUPT; }
+  memcpy(&header, in, sizeof(header));
+  if (header.magic != SUN_COMPRESS_MAGIC ||
+      header.value_bytes != sizeof(sunrealtype) ||
+      header.block_values != SUN_COMPRESS_BLOCK_VALUES)
+  {
+    return SUN_ERR_CORRUPT;
+  }
+
+  *num_values = (size_t)header.num_values;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode sunDecompressValues(const char* in, size_t in_bytes, sunrealtype* t,
+                               sunrealtype* values, size_t num_values)
+{
+  unsigned char* bytes  = (unsigned char*)values;
+  unsigned char* planes = NULL;
+  sunCompressHeader header;
+  size_t start;
+  size_t pos     = sizeof(header);
+  SUNErrCode err = SUN_SUCCESS;
+
+  err = sunCompressedNumValues(in, in_bytes, &start);
+  if (err != SUN_SUCCESS) { return err; }
+  if (start != num_values) { return SUN_ERR_ARG_INCOMPATIBLE; }
+  memcpy(&header, in, sizeof(header));
+
+  planes = (unsigned char*)malloc(SUN_COMPRESS_BLOCK_VALUES *
+                                  sizeof(sunrealtype));
+  if (planes == NULL) { return SUN_ERR_MALLOC_FAIL; }
+
+  for (start = 0; start < num_values; start += SUN_COMPRESS_BLOCK_VALUES)
+  {
+    size_t block_values = num_values - start;
+    if (block_values > SUN_COMPRESS_BLOCK_VALUES)
+    {
+      block_values = SUN_COMPRESS_BLOCK_VALUES;
+    }
+
+    err = sunDecodeRuns((const unsigned char*)in, in_bytes, &pos, planes,
+                        block_values * sizeof(sunrealtype));
+    if (err != SUN_SUCCESS) { break; }
+    sunUnshuffleDelta(planes, start, block_values, bytes);
+  }
+
+  free(planes);
+
+  *t = header.t;
+  return err;
+}
@@ -0,0 +1,64 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Codec for SUNDataNode leaves holding compressed vectors. The
+ * values are stored as the XOR of consecutive values with the bytes
+ * shuffled into planes (all first bytes, then all second bytes, ...)
+ * so that the bytes the values share become runs of zeros, which are
+ * then run-length encoded. The lossy mode first rounds each value to
+ * a multiple of a power of two within its error bound, which zeros
+ * the trailing mantissa bits.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDATANODE_COMPRESS_H
+#define _SUNDATANODE_COMPRESS_H
+
+#include <stddef.h>
+
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Number of values shuffled and run-length encoded at a time */
+#define SUN_COMPRESS_BLOCK_VALUES 2048
+
+/* Upper bound on the size of num_values compressed values */
+size_t sunCompressBound(size_t num_values);
+
+/* Rounds each value to a multiple of a power of two such that
+   |new - old| <= tol / weights[i]. Values with nonpositive or
+   nonfinite bounds are kept. */
+void sunQuantizeValues(sunrealtype* values, const sunrealtype* weights,
+                       sunrealtype tol, size_t num_values);
+
+/* Compresses t and the values into out, which must hold at least
+   sunCompressBound(num_values) bytes, and returns the size used */
+SUNErrCode sunCompressValues(sunrealtype t, const sunrealtype* values,
+                             size_t num_values, char* out, size_t* out_bytes);
+
+/* Checks whether a buffer starts with the header of a compressed buffer */
+sunbooleantype sunIsCompressed(const char* in, size_t in_bytes);
+
+/* Returns the number of values held by a compressed buffer */
+SUNErrCode sunCompressedNumValues(const char* in, size_t in_bytes,
+                                  size_t* num_values);
+
+/* Decompresses t and the values from in */
+SUNErrCode sunDecompressValues(const char* in, size_t in_bytes, sunrealtype* t,
+                               sunrealtype* values, size_t num_values);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _SUNDATANODE_COMPRESS_H
@@ -10,8 +10,10 @@
  * SUNDIALS Copyright End
  * -----------------------------------------------------------------*/
 
+#include <stdlib.h>
 #include <string.h>
 
+#include "sundatanode/sundatanode_compress.h"
 #include "sundatanode/sundatanode_inmem.h"
 #include "sundials/priv/sundials_errors_impl.h"
 #include "sundials/sundials_errors.h"
@@ -47,6 +49,7 @@ static SUNDataNode sunDataNode_CreateCommon_InMem(SUNContext sunctx)
   node->ops->getdatanvector   = SUNDataNode_GetDataNvector_InMem;
   node->ops->setdata          = SUNDataNode_SetData_InMem;
   node->ops->setdatanvector   = SUNDataNode_SetDataNvector_InMem;
+  node->ops->reservedata      = SUNDataNode_ReserveData_InMem;
   node->ops->destroy          = SUNDataNode_Destroy_InMem;
 
   SUNDataNode_InMemContent content =
@@ -76,7 +79,7 @@ static void sunDataNode_DestroyCommon_InMem(SUNDataNode* node)
   *node = NULL;
 }
 
-static SUNErrCode sunDataNode_FreeKeyValue_InMem(SUNHashMapKeyValue* kv_ptr);
+static SUNErrCode sunDataNode_FreeNamedChild_InMem(void* node);
 static SUNErrCode sunDataNode_FreeValue_InMem(SUNDataNode* nodeptr);
 
 SUNErrCode SUNDataNode_CreateList_InMem(sundataindex init_size,
@@ -110,7 +113,7 @@ SUNErrCode SUNDataNode_CreateObject_InMem(sundataindex init_size,
   BASE_MEMBER(node, dtype) = SUNDATANODE_OBJECT;
 
   SUNHashMap map;
-  SUNCheckCall(SUNHashMap_New(init_size, sunDataNode_FreeKeyValue_InMem, &map));
+  SUNCheckCall(SUNHashMap_New(init_size, sunDataNode_FreeNamedChild_InMem, &map));
 
   IMPL_MEMBER(node, named_children) = map;
 
@@ -327,6 +330,30 @@ SUNErrCode SUNDataNode_GetDataNvector_InMem(const SUNDataNode self, N_Vector v,
 
   sunindextype buffer_size = 0;
   SUNCheckCall(N_VBufSize(v, &buffer_size));
+
+  /* Compressed leaves are byte streams on the host led by a magic word */
+  if (leaf_data->stride == 1 && leaf_mem_type == SUNMEMTYPE_HOST &&
+      sunIsCompressed(leaf_data->ptr, leaf_data->bytes))
+  {
+    size_t num_values = 0;
+    SUNCheckCall(
+      sunCompressedNumValues(leaf_data->ptr, leaf_data->bytes, &num_values));
+    if (num_values * sizeof(sunrealtype) != (size_t)buffer_size)
+    {
+      return SUN_ERR_ARG_INCOMPATIBLE;
+    }
+
+    sunrealtype* values = (sunrealtype*)malloc(buffer_size);
+    if (values == NULL && buffer_size > 0) { return SUN_ERR_MALLOC_FAIL; }
+
+    SUNErrCode err = sunDecompressValues(leaf_data->ptr, leaf_data->bytes, t,
+                                         values, num_values);
+    if (err == SUN_SUCCESS) { err = N_VBufUnpack(v, values); }
+    free(values);
+
+    return err;
+  }
+
   SUNAssert((buffer_size + sizeof(sunrealtype)) == leaf_data->bytes,
             SUN_ERR_ARG_INCOMPATIBLE);
 
@@ -420,6 +447,29 @@ SUNErrCode SUNDataNode_SetDataNvector_InMem(SUNDataNode self, N_Vector v,
   return SUN_SUCCESS;
 }
 
+SUNErrCode SUNDataNode_ReserveData_InMem(SUNDataNode self,
+                                         SUNMemoryType node_mem_type,
+                                         size_t data_stride, size_t data_bytes,
+                                         void** data)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  /* Use the default queue for the memory helper */
+  void* queue = NULL;
+
+  SUNAssert(BASE_MEMBER(self, dtype) == SUNDATANODE_LEAF, SUN_ERR_ARG_WRONGTYPE);
+
+  SUNMemory leaf_data = NULL;
+  SUNCheckCall(SUNMemoryHelper_AllocStrided(IMPL_MEMBER(self, mem_helper),
+                                            &leaf_data, data_bytes, data_stride,
+                                            node_mem_type, queue));
+
+  IMPL_MEMBER(self, leaf_data) = leaf_data;
+  *data                        = leaf_data->ptr;
+
+  return SUN_SUCCESS;
+}
+
 SUNErrCode SUNDataNode_Destroy_InMem(SUNDataNode* node)
 {
   SUNFunctionBegin((*node)->sunctx);
@@ -452,19 +502,16 @@ SUNErrCode SUNDataNode_Destroy_InMem(SUNDataNode* node)
 }
 
 /* This function is the callback provided to the child hashmap as the destroy function. */
-static SUNErrCode sunDataNode_FreeKeyValue_InMem(SUNHashMapKeyValue* kv_ptr)
+static SUNErrCode sunDataNode_FreeNamedChild_InMem(void* node)
 {
-  if (!kv_ptr || !(*kv_ptr)) { return SUN_SUCCESS; }
-  SUNDataNode node = (SUNDataNode)((*kv_ptr)->value);
-  free((*kv_ptr)->key);
-  free(*kv_ptr);
-  SUNDataNode_Destroy_InMem(&node);
+  SUNDataNode child = (SUNDataNode)node;
+  SUNDataNode_Destroy(&child);
   return SUN_SUCCESS;
 }
 
 /* This function is the callback provided to the child stlvector as the destroy function. */
 static SUNErrCode sunDataNode_FreeValue_InMem(SUNDataNode* nodeptr)
 {
-  SUNDataNode_Destroy_InMem(nodeptr);
+  SUNDataNode_Destroy(nodeptr);
   return SUN_SUCCESS;
 }
@@ -104,6 +104,11 @@ SUNErrCode SUNDataNode_SetData_InMem(SUNDataNode self, SUNMemoryType src_mem_typ
 SUNErrCode SUNDataNode_SetDataNvector_InMem(SUNDataNode self, N_Vector v,
                                             sunrealtype t);
 
+SUNErrCode SUNDataNode_ReserveData_InMem(SUNDataNode self,
+                                         SUNMemoryType node_mem_type,
+                                         size_t data_stride, size_t data_bytes,
+                                         void** data);
+
 SUNErrCode SUNDataNode_Destroy_InMem(SUNDataNode* node);
 
 #ifdef __cplusplus
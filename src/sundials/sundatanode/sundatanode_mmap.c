@@ -0,0 +1,611 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * File-backed SUNDataNode leaves.
+ *
+ * Leaf data is appended to a temporary file that is grown one
+ * segment at a time, each segment mapped separately, so the address
+ * of a leaf never changes and the kernel can page checkpoints out
+ * to the file when memory is short. Adjoint checkpoints are written
+ * in order during the forward sweep and read back in reverse during
+ * the backward sweep, so the default forward readahead of the
+ * kernel is disabled and loading a leaf instead prefetches the
+ * leaves written just before it.
+ *
+ * A segment is unmapped once all of its leaves are destroyed and
+ * the file is truncated when the store becomes empty.
+ *
+ * In-memory leaves can also be spilled to the file and promoted
+ * back, which lets a checkpoint scheme keep a bounded number of
+ * checkpoints in memory and the rest in the file.
+ * -----------------------------------------------------------------*/
+
+/* mkstemp is not declared when only _POSIX_C_SOURCE is defined */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <sundials/priv/sundials_context_impl.h>
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_config.h>
+#include <sundials/sundials_errors.h>
+
+#include "sundatanode/sundatanode_inmem.h"
+#include "sundatanode/sundatanode_mmap.h"
+#include "sundials_macros.h"
+
+#if defined(SUNDIALS_HAVE_MMAP)
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#define GET_CONTENT(node)       ((SUNDataNode_InMemContent)(node)->content)
+#define IMPL_MEMBER(node, prop) (GET_CONTENT(node)->prop)
+
+/* Leaves start on a cache line boundary within the file */
+#define SUN_MMAP_LEAF_ALIGN ((size_t)64)
+
+typedef struct
+{
+  char* base;        /* start of the mapping, NULL once unmapped */
+  size_t bytes;      /* size of the mapping                      */
+  size_t used;       /* bytes handed out to leaves               */
+  long int num_live; /* leaves in the segment not yet destroyed  */
+} sunMmapSegment;
+
+struct SUNMmapStore_
+{
+  int fd;
+  size_t page_bytes;
+  size_t segment_bytes;
+  off_t file_bytes;
+  sunMmapSegment* segments;
+  int num_segments;
+  int max_segments;
+  long int num_live;
+};
+
+static size_t sunRoundUp(size_t bytes, size_t align)
+{
+  return ((bytes + align - 1) / align) * align;
+}
+
+SUNErrCode SUNMmapStore_Create(size_t segment_bytes, SUNMmapStore* store_out)
+{
+  static const char suffix[] = "/sundials-checkpoint-XXXXXX";
+  const char* dir            = getenv("SUNDIALS_CHECKPOINT_DIR");
+  SUNMmapStore store         = NULL;
+  char* path                 = NULL;
+  long page_bytes            = sysconf(_SC_PAGESIZE);
+
+  *store_out = NULL;
+
+  if (dir == NULL || dir[0] == '\0') { dir = getenv("TMPDIR"); }
+  if (dir == NULL || dir[0] == '\0') { dir = "/tmp"; }
+
+  store = (SUNMmapStore)calloc(1, sizeof(*store));
+  if (store == NULL) { return SUN_ERR_MALLOC_FAIL; }
+
+  path = (char*)malloc(strlen(dir) + sizeof(suffix));
+  if (path == NULL)
+  {
+    free(store);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+  strcpy(path, dir);
+  strcat(path, suffix);
+
+  /* the file is unlinked right away so it is removed when closed, even if the
+     program does not exit cleanly */
+  store->fd = mkstemp(path);
+  if (store->fd >= 0) { unlink(path); }
+  free(path);
+
+  if (store->fd < 0)
+  {
+    free(store);
+    return SUN_ERR_FILE_OPEN;
+  }
+
+  store->page_bytes    = (page_bytes > 0) ? (size_t)page_bytes : 4096;
+  store->segment_bytes = sunRoundUp(segment_bytes, store->page_bytes);
+
+  *store_out = store;
+  return SUN_SUCCESS;
+}
+
+/* Unmaps every segment and gives the file space back */
+static void sunMmapStore_Reset(SUNMmapStore store)
+{
+  int i;
+  for (i = 0; i < store->num_segments; i++)
+  {
+    if (store->segments[i].base)
+    {
+      munmap(store->segments[i].base, store->segments[i].bytes);
+    }
+  }
+  store->num_segments = 0;
+  store->num_live     = 0;
+  store->file_bytes   = 0;
+  if (ftruncate(store->fd, 0)) { /* nothing to recover, the space leaks */ }
+}
+
+SUNErrCode SUNMmapStore_Destroy(SUNMmapStore* store)
+{
+  if (store == NULL || *store == NULL) { return SUN_SUCCESS; }
+
+  sunMmapStore_Reset(*store);
+  close((*store)->fd);
+  free((*store)->segments);
+  free(*store);
+  *store = NULL;
+
+  return SUN_SUCCESS;
+}
+
+/* Maps a new segment at the end of the file with room for at least bytes */
+static SUNErrCode sunMmapStore_AddSegment(SUNMmapStore store, size_t bytes)
+{
+  sunMmapSegment* seg = NULL;
+  size_t seg_bytes    = sunRoundUp(bytes, store->page_bytes);
+  void* base          = NULL;
+
+  if (seg_bytes < store->segment_bytes) { seg_bytes = store->segment_bytes; }
+
+  if (store->num_segments == store->max_segments)
+  {
+    int max_segments = store->max_segments ? 2 * store->max_segments : 8;
+    seg              = (sunMmapSegment*)realloc(store->segments,
+                                                (size_t)max_segments *
+                                                  sizeof(sunMmapSegment));
+    if (seg == NULL) { return SUN_ERR_MALLOC_FAIL; }
+    store->segments     = seg;
+    store->max_segments = max_segments;
+  }
+
+  if (ftruncate(store->fd, store->file_bytes + (off_t)seg_bytes))
+  {
+    return SUN_ERR_MEM_FAIL;
+  }
+
+  base = mmap(NULL, seg_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, store->fd,
+              store->file_bytes);
+  if (base == MAP_FAILED)
+  {
+    if (ftruncate(store->fd, store->file_bytes)) { /* keep the larger file */ }
+    return SUN_ERR_MEM_FAIL;
+  }
+
+  /* loads run backwards, so the kernel's forward readahead only wastes I/O */
+  posix_madvise(base, seg_bytes, POSIX_MADV_RANDOM);
+
+  seg           = &store->segments[store->num_segments++];
+  seg->base     = (char*)base;
+  seg->bytes    = seg_bytes;
+  seg->used     = 0;
+  seg->num_live = 0;
+
+  store->file_bytes += (off_t)seg_bytes;
+
+  return SUN_SUCCESS;
+}
+
+/* Appends a region of the given size to the file */
+static SUNErrCode sunMmapStore_Alloc(SUNMmapStore store, size_t bytes,
+                                     void** ptr)
+{
+  sunMmapSegment* seg = NULL;
+  SUNErrCode err      = SUN_SUCCESS;
+
+  bytes = sunRoundUp(bytes ? bytes : 1, SUN_MMAP_LEAF_ALIGN);
+
+  if (store->num_segments > 0)
+  {
+    seg = &store->segments[store->num_segments - 1];
+    if (seg->base == NULL || seg->used + bytes > seg->bytes) { seg = NULL; }
+  }
+
+  if (seg == NULL)
+  {
+    err = sunMmapStore_AddSegment(store, bytes);
+    if (err != SUN_SUCCESS) { return err; }
+    seg = &store->segments[store->num_segments - 1];
+  }
+
+  *ptr = seg->base + seg->used;
+  seg->used += bytes;
+  seg->num_live++;
+  store->num_live++;
+
+  return SUN_SUCCESS;
+}
+
+/* Returns the index of the mapped segment holding ptr or -1 */
+static int sunMmapStore_Find(SUNMmapStore store, const void* ptr)
+{
+  const char* p = (const char*)ptr;
+  int i;
+  for (i = store->num_segments - 1; i >= 0; i--)
+  {
+    const sunMmapSegment* seg = &store->segments[i];
+    if (seg->base && p >= seg->base && p < seg->base + seg->bytes) { return i; }
+  }
+  return -1;
+}
+
+static void sunMmapStore_Release(SUNMmapStore store, void* ptr)
+{
+  int i = sunMmapStore_Find(store, ptr);
+  if (i < 0) { return; }
+
+  store->num_live--;
+  if (store->num_live == 0)
+  {
+    sunMmapStore_Reset(store);
+    return;
+  }
+
+  /* the last segment stays mapped since new leaves are appended to it */
+  if (--store->segments[i].num_live == 0 && i < store->num_segments - 1)
+  {
+    munmap(store->segments[i].base, store->segments[i].bytes);
+    store->segments[i].base = NULL;
+  }
+}
+
+/* Asks the kernel to read in the bytes written just before ptr, i.e., the
+   leaves that a backward sweep will load next */
+static void sunMmapStore_Prefetch(SUNMmapStore store, const void* ptr,
+                                  size_t bytes)
+{
+  const char* p = (const char*)ptr;
+  int i         = sunMmapStore_Find(store, ptr);
+
+  while (i >= 0 && bytes > 0)
+  {
+    const sunMmapSegment* seg = &store->segments[i];
+    size_t avail              = (size_t)(p - seg->base);
+    size_t len                = (bytes < avail) ? bytes : avail;
+    size_t start              = avail - len;
+
+    start -= start % store->page_bytes;
+    if (avail > start)
+    {
+      posix_madvise(seg->base + start, avail - start, POSIX_MADV_WILLNEED);
+    }
+    bytes -= len;
+
+    /* continue at the end of the previous mapped segment */
+    i--;
+    while (i >= 0 && store->segments[i].base == NULL) { i--; }
+    if (i >= 0) { p = store->segments[i].base + store->segments[i].used; }
+  }
+}
+
+/* Points the leaf at a new region of the file */
+static SUNErrCode sunDataNode_AllocLeaf_Mmap(SUNDataNode self, size_t bytes,
+                                             size_t stride)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  void* ptr = NULL;
+
+  if (SUNCTX_->mmap_store == NULL)
+  {
+    SUNCheckCall(
+      SUNMmapStore_Create(SUN_MMAP_SEGMENT_BYTES, &SUNCTX_->mmap_store));
+  }
+
+  SUNCheckCall(sunMmapStore_Alloc(SUNCTX_->mmap_store, bytes, &ptr));
+
+  SUNMemory leaf_data = SUNMemoryHelper_Wrap(IMPL_MEMBER(self, mem_helper), ptr,
+                                             SUNMEMTYPE_HOST);
+  SUNCheckLastErr();
+
+  leaf_data->bytes  = bytes;
+  leaf_data->stride = stride;
+
+  IMPL_MEMBER(self, leaf_data) = leaf_data;
+
+  return SUN_SUCCESS;
+}
+
+/* Returns the leaf's region of the file to the store */
+static SUNErrCode sunDataNode_FreeLeaf_Mmap(SUNDataNode self)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  /* Use the default queue for the memory helper */
+  void* queue = NULL;
+
+  SUNMemory leaf_data = IMPL_MEMBER(self, leaf_data);
+  if (leaf_data == NULL) { return SUN_SUCCESS; }
+
+  if (SUNCTX_->mmap_store)
+  {
+    sunMmapStore_Release(SUNCTX_->mmap_store, leaf_data->ptr);
+  }
+
+  /* the wrapper does not own the mapped memory */
+  SUNCheckCall(
+    SUNMemoryHelper_Dealloc(IMPL_MEMBER(self, mem_helper), leaf_data, queue));
+  IMPL_MEMBER(self, leaf_data) = NULL;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNDataNode_CreateLeaf_Mmap(SUNMemoryHelper mem_helper,
+                                       SUNContext sunctx, SUNDataNode* node_out)
+{
+  SUNFunctionBegin(sunctx);
+
+  SUNDataNode node = NULL;
+  SUNCheckCall(SUNDataNode_CreateLeaf_InMem(mem_helper, sunctx, &node));
+
+  node->ops->getdatanvector = SUNDataNode_GetDataNvector_Mmap;
+  node->ops->setdata        = SUNDataNode_SetData_Mmap;
+  node->ops->setdatanvector = SUNDataNode_SetDataNvector_Mmap;
+  node->ops->reservedata    = SUNDataNode_ReserveData_Mmap;
+  node->ops->destroy        = SUNDataNode_Destroy_Mmap;
+
+  *node_out = node;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNDataNode_GetDataNvector_Mmap(const SUNDataNode self, N_Vector v,
+                                           sunrealtype* t)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  SUNMemory leaf_data = IMPL_MEMBER(self, leaf_data);
+  SUNAssert(leaf_data, SUN_ERR_ARG_CORRUPT);
+
+  /* start reading the next leaves while this one is unpacked and used */
+  sunMmapStore_Prefetch(SUNCTX_->mmap_store, leaf_data->ptr,
+                        SUN_MMAP_READAHEAD_LEAVES * leaf_data->bytes);
+
+  SUNCheckCall(SUNDataNode_GetDataNvector_InMem(self, v, t));
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNDataNode_SetData_Mmap(
+  SUNDataNode self, SUNMemoryType src_mem_type,
+  SUNDIALS_MAYBE_UNUSED SUNMemoryType node_mem_type, void* data,
+  size_t data_stride, size_t data_bytes)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  /* Use the default queue for the memory helper */
+  void* queue = NULL;
+
+  SUNAssert(self->dtype == SUNDATANODE_LEAF, SUN_ERR_ARG_WRONGTYPE);
+
+  /* the file is only accessible from the host */
+  SUNAssert(node_mem_type == SUNMEMTYPE_HOST, SUN_ERR_ARG_INCOMPATIBLE);
+
+  SUNCheckCall(sunDataNode_FreeLeaf_Mmap(self));
+  SUNCheckCall(sunDataNode_AllocLeaf_Mmap(self, data_bytes, data_stride));
+
+  SUNMemory data_mem_src = SUNMemoryHelper_Wrap(IMPL_MEMBER(self, mem_helper),
+                                                data, src_mem_type);
+  SUNCheckLastErr();
+
+  SUNCheckCall(SUNMemoryHelper_Copy(IMPL_MEMBER(self, mem_helper),
+                                    IMPL_MEMBER(self, leaf_data), data_mem_src,
+                                    data_bytes, queue));
+
+  SUNMemoryHelper_Dealloc(IMPL_MEMBER(self, mem_helper), data_mem_src, queue);
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNDataNode_SetDataNvector_Mmap(SUNDataNode self, N_Vector v,
+                                           sunrealtype t)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  sunindextype buffer_size = 0;
+  SUNCheckCall(N_VBufSize(v, &buffer_size));
+
+  /* Same layout as the in-memory leaves: t followed by the packed vector */
+  SUNCheckCall(sunDataNode_FreeLeaf_Mmap(self));
+  SUNCheckCall(sunDataNode_AllocLeaf_Mmap(self,
+                                          buffer_size + sizeof(sunrealtype),
+                                          sizeof(sunrealtype)));
+
+  SUNMemory leaf_data   = IMPL_MEMBER(self, leaf_data);
+  sunrealtype* data_ptr = leaf_data->ptr;
+  data_ptr[0]           = t;
+  SUNCheckCall(N_VBufPack(v, &data_ptr[1]));
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNDataNode_ReserveData_Mmap(
+  SUNDataNode self, SUNDIALS_MAYBE_UNUSED SUNMemoryType node_mem_type,
+  size_t data_stride, size_t data_bytes, void** data)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  SUNAssert(self->dtype == SUNDATANODE_LEAF, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(node_mem_type == SUNMEMTYPE_HOST, SUN_ERR_ARG_INCOMPATIBLE);
+
+  SUNCheckCall(sunDataNode_FreeLeaf_Mmap(self));
+  SUNCheckCall(sunDataNode_AllocLeaf_Mmap(self, data_bytes, data_stride));
+
+  *data = IMPL_MEMBER(self, leaf_data)->ptr;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNDataNode_Destroy_Mmap(SUNDataNode* node)
+{
+  SUNFunctionBegin((*node)->sunctx);
+
+  SUNCheckCall(sunDataNode_FreeLeaf_Mmap(*node));
+  SUNCheckCall(SUNDataNode_Destroy_InMem(node));
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNDataNode_Spill_Mmap(SUNDataNode self)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  /* Use the default queue for the memory helper */
+  void* queue = NULL;
+
+  SUNAssert(self->dtype == SUNDATANODE_LEAF, SUN_ERR_ARG_WRONGTYPE);
+
+  /* already in the file */
+  if (self->ops->destroy == SUNDataNode_Destroy_Mmap) { return SUN_SUCCESS; }
+
+  SUNMemory mem_data = IMPL_MEMBER(self, leaf_data);
+  if (mem_data)
+  {
+    IMPL_MEMBER(self, leaf_data) = NULL;
+
+    SUNErrCode err = sunDataNode_AllocLeaf_Mmap(self, mem_data->bytes,
+                                                mem_data->stride);
+    if (err != SUN_SUCCESS)
+    {
+      IMPL_MEMBER(self, leaf_data) = mem_data;
+      return err;
+    }
+
+    SUNCheckCall(SUNMemoryHelper_Copy(IMPL_MEMBER(self, mem_helper),
+                                      IMPL_MEMBER(self, leaf_data), mem_data,
+                                      mem_data->bytes, queue));
+    SUNCheckCall(
+      SUNMemoryHelper_Dealloc(IMPL_MEMBER(self, mem_helper), mem_data, queue));
+  }
+
+  self->ops->getdatanvector = SUNDataNode_GetDataNvector_Mmap;
+  self->ops->setdata        = SUNDataNode_SetData_Mmap;
+  self->ops->setdatanvector = SUNDataNode_SetDataNvector_Mmap;
+  self->ops->reservedata    = SUNDataNode_ReserveData_Mmap;
+  self->ops->destroy        = SUNDataNode_Destroy_Mmap;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNDataNode_Promote_Mmap(SUNDataNode self)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  /* Use the default queue for the memory helper */
+  void* queue = NULL;
+
+  SUNAssert(self->dtype == SUNDATANODE_LEAF, SUN_ERR_ARG_WRONGTYPE);
+
+  /* already in memory */
+  if (self->ops->destroy != SUNDataNode_Destroy_Mmap) { return SUN_SUCCESS; }
+
+  SUNMemory file_data = IMPL_MEMBER(self, leaf_data);
+  if (file_data)
+  {
+    SUNMemory mem_data = NULL;
+    SUNCheckCall(SUNMemoryHelper_AllocStrided(IMPL_MEMBER(self, mem_helper),
+                                              &mem_data, file_data->bytes,
+                                              file_data->stride,
+                                              SUNMEMTYPE_HOST, queue));
+    SUNCheckCall(SUNMemoryHelper_Copy(IMPL_MEMBER(self, mem_helper), mem_data,
+                                      file_data, file_data->bytes, queue));
+    SUNCheckCall(sunDataNode_FreeLeaf_Mmap(self));
+
+    IMPL_MEMBER(self, leaf_data) = mem_data;
+  }
+
+  self->ops->getdatanvector = SUNDataNode_GetDataNvector_InMem;
+  self->ops->setdata        = SUNDataNode_SetData_InMem;
+  self->ops->setdatanvector = SUNDataNode_SetDataNvector_InMem;
+  self->ops->reservedata    = SUNDataNode_ReserveData_InMem;
+  self->ops->destroy        = SUNDataNode_Destroy_InMem;
+
+  return SUN_SUCCESS;
+}
+
+#else
+
+SUNErrCode SUNMmapStore_Create(SUNDIALS_MAYBE_UNUSED size_t segment_bytes,
+                               SUNMmapStore* store)
+{
+  *store = NULL;
+  return SUN_ERR_NOT_IMPLEMENTED;
+}
+
+SUNErrCode SUNMmapStore_Destroy(SUNDIALS_MAYBE_UNUSED SUNMmapStore* store)
+{
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNDataNode_CreateLeaf_Mmap(
+  SUNDIALS_MAYBE_UNUSED SUNMemoryHelper mem_helper,
+  SUNDIALS_MAYBE_UNUSED SUNContext sunctx, SUNDataNode* node_out)
+{
+  *node_out = NULL;
+  return SUN_ERR_NOT_IMPLEMENTED;
+}
+
+SUNErrCode SUNDataNode_GetDataNvector_Mmap(
+  SUNDIALS_MAYBE_UNUSED const SUNDataNode self,
+  SUNDIALS_MAYBE_UNUSED N_Vector v, SUNDIALS_MAYBE_UNUSED sunrealtype* t)
+{
+  return SUN_ERR_NOT_IMPLEMENTED;
+}
+
+SUNErrCode SUNDataNode_SetData_Mmap(
+  SUNDIALS_MAYBE_UNUSED SUNDataNode self,
+  SUNDIALS_MAYBE_UNUSED SUNMemoryType src_mem_type,
+  SUNDIALS_MAYBE_UNUSED SUNMemoryType node_mem_type,
+  SUNDIALS_MAYBE_UNUSED void* data, SUNDIALS_MAYBE_UNUSED size_t data_stride,
+  SUNDIALS_MAYBE_UNUSED size_t data_bytes)
+{
+  return SUN_ERR_NOT_IMPLEMENTED;
+}
+
+SUNErrCode SUNDataNode_SetDataNvector_Mmap(SUNDIALS_MAYBE_UNUSED SUNDataNode self,
+                                           SUNDIALS_MAYBE_UNUSED N_Vector v,
+                                           SUNDIALS_MAYBE_UNUSED sunrealtype t)
+{
+  return SUN_ERR_NOT_IMPLEMENTED;
+}
+
+SUNErrCode SUNDataNode_ReserveData_Mmap(
+  SUNDIALS_MAYBE_UNUSED SUNDataNode self,
+  SUNDIALS_MAYBE_UNUSED SUNMemoryType node_mem_type,
+  SUNDIALS_MAYBE_UNUSED size_t data_stride,
+  SUNDIALS_MAYBE_UNUSED size_t data_bytes, SUNDIALS_MAYBE_UNUSED void** data)
+{
+  return SUN_ERR_NOT_IMPLEMENTED;
+}
+
+SUNErrCode SUNDataNode_Destroy_Mmap(SUNDIALS_MAYBE_UNUSED SUNDataNode* node)
+{
+  return SUN_ERR_NOT_IMPLEMENTED;
+}
+
+SUNErrCode SUNDataNode_Spill_Mmap(SUNDIALS_MAYBE_UNUSED SUNDataNode self)
+{
+  return SUN_ERR_NOT_IMPLEMENTED;
+}
+
+SUNErrCode SUNDataNode_Promote_Mmap(SUNDIALS_MAYBE_UNUSED SUNDataNode self)
+{
+  return SUN_ERR_NOT_IMPLEMENTED;
+}
+
+#endif
@@ -0,0 +1,75 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * SUNDataNode leaves whose data lives in a memory-mapped file. List
+ * and object nodes are the in-memory nodes; only the leaf data is
+ * moved to the file. Leaves are appended to a temporary file owned
+ * by the SUNContext (the SUNMmapStore), which is mapped in segments
+ * so that leaf data never moves once written.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDATANODE_MMAP_H
+#define _SUNDATANODE_MMAP_H
+
+#include <sundials/sundials_memory.h>
+#include <sundials/sundials_types.h>
+
+#include "sundials_datanode.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Default size of each mapped segment of the checkpoint file */
+#define SUN_MMAP_SEGMENT_BYTES ((size_t)64 * 1024 * 1024)
+
+/* Number of leaves ahead of a load (in reverse order) to prefetch */
+#define SUN_MMAP_READAHEAD_LEAVES 4
+
+typedef struct SUNMmapStore_* SUNMmapStore;
+
+/* Creates the store and its (already unlinked) temporary file */
+SUNErrCode SUNMmapStore_Create(size_t segment_bytes, SUNMmapStore* store);
+
+/* Unmaps all segments and closes the file */
+SUNErrCode SUNMmapStore_Destroy(SUNMmapStore* store);
+
+SUNErrCode SUNDataNode_CreateLeaf_Mmap(SUNMemoryHelper mem_helper,
+                                       SUNContext sunctx, SUNDataNode* node_out);
+
+SUNErrCode SUNDataNode_GetDataNvector_Mmap(const SUNDataNode self, N_Vector v,
+                                           sunrealtype* t);
+
+SUNErrCode SUNDataNode_SetData_Mmap(SUNDataNode self, SUNMemoryType src_mem_type,
+                                    SUNMemoryType node_mem_type, void* data,
+                                    size_t data_stride, size_t data_bytes);
+
+SUNErrCode SUNDataNode_SetDataNvector_Mmap(SUNDataNode self, N_Vector v,
+                                           sunrealtype t);
+
+SUNErrCode SUNDataNode_ReserveData_Mmap(SUNDataNode self,
+                                        SUNMemoryType node_mem_type,
+                                        size_t data_stride, size_t data_bytes,
+                                        void** data);
+
+SUNErrCode SUNDataNode_Destroy_Mmap(SUNDataNode* node);
+
+/* Move the data of an in-memory leaf to the file and back. The node itself is
+   kept so that its parent and any cached references remain valid. */
+SUNErrCode SUNDataNode_Spill_Mmap(SUNDataNode self);
+
+SUNErrCode SUNDataNode_Promote_Mmap(SUNDataNode self);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _SUNDATANODE_MMAP_H
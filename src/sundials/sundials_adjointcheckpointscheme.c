@@ -40,11 +40,12 @@ SUNErrCode SUNAdjointCheckpointScheme_NewEmpty(
   ops                                = malloc(sizeof(*ops));
   SUNAssert(ops, SUN_ERR_MALLOC_FAIL);
 
-  ops->needssaving  = NULL;
-  ops->insertvector = NULL;
-  ops->loadvector   = NULL;
-  ops->enableDense  = NULL;
-  ops->destroy      = NULL;
+  ops->needssaving     = NULL;
+  ops->insertvector    = NULL;
+  ops->loadvector      = NULL;
+  ops->enableDense     = NULL;
+  ops->seterrorweights = NULL;
+  ops->destroy         = NULL;
 
   self->ops         = ops;
   *check_scheme_ptr = self;
@@ -143,6 +144,22 @@ SUNErrCode SUNAdjointCheckpointScheme_EnableDense(SUNAdjointCheckpointScheme sel
   return SUN_ERR_NOT_IMPLEMENTED;
 }
 
+SUNErrCode SUNAdjointCheckpointScheme_SetErrorWeights(
+  SUNAdjointCheckpointScheme self, N_Vector ewt)
+{
+  SUNFunctionBegin(self->sunctx);
+  SUNDIALS_MARK_FUNCTION_BEGIN(SUNCTX_->profiler);
+  if (self->ops->seterrorweights)
+  {
+    SUNErrCode err = self->ops->seterrorweights(self, ewt);
+    SUNDIALS_MARK_FUNCTION_END(SUNCTX_->profiler);
+    return err;
+  }
+  /* the weights are optional information for the scheme */
+  SUNDIALS_MARK_FUNCTION_END(SUNCTX_->profiler);
+  return SUN_SUCCESS;
+}
+
 SUNErrCode SUNAdjointCheckpointScheme_SetContent(SUNAdjointCheckpointScheme self,
                                                  void* content)
 {
@@ -198,3 +215,11 @@ SUNErrCode SUNAdjointCheckpointScheme_SetEnableDenseFn(
   self->ops->enableDense = fn;
   return SUN_SUCCESS;
 }
+
+SUNErrCode SUNAdjointCheckpointScheme_SetErrorWeightsFn(
+  SUNAdjointCheckpointScheme self, SUNAdjointCheckpointSchemeSetErrorWeightsFn fn)
+{
+  SUNFunctionBegin(self->sunctx);
+  self->ops->seterrorweights = fn;
+  return SUN_SUCCESS;
+}
@@ -28,6 +28,7 @@ struct SUNAdjointCheckpointScheme_Ops_
   SUNAdjointCheckpointSchemeLoadVectorFn loadvector;
   SUNAdjointCheckpointSchemeDestroyFn destroy;
   SUNAdjointCheckpointSchemeEnableDenseFn enableDense;
+  SUNAdjointCheckpointSchemeSetErrorWeightsFn seterrorweights;
 };
 
 struct SUNAdjointCheckpointScheme_
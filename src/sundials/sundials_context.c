@@ -27,8 +27,14 @@
 #include <sundials/sundials_profiler.h>
 #include <sundials/sundials_types.h>
 
+#include "sundatanode/sundatanode_mmap.h"
 #include "sundials_adiak_metadata.h"
 #include "sundials_macros.h"
+#include "sundials_nvector_pool.h"
+
+#if SUNDIALS_MPI_ENABLED
+#include <sundials/priv/sundials_mpi_reduce_impl.h>
+#endif
 
 SUNErrCode SUNContext_Create(SUNComm comm, SUNContext* sunctx_out)
 {
@@ -98,6 +104,9 @@ SUNErrCode SUNContext_Create(SUNComm comm, SUNContext* sunctx_out)
     sunctx->last_err     = SUN_SUCCESS;
     sunctx->err_handler  = eh;
     sunctx->comm         = comm;
+    sunctx->vector_pool  = NULL;
+    sunctx->mmap_store   = NULL;
+    sunctx->mpi_reduce   = NULL;
   }
   while (0);
 
@@ -250,6 +259,39 @@ SUNErrCode SUNContext_SetLogger(SUNContext sunctx, SUNLogger logger)
   return SUN_SUCCESS;
 }
 
+SUNErrCode SUNContext_SetVectorPoolSize(SUNContext sunctx, int max_vectors)
+{
+  if (!sunctx) { return SUN_ERR_SUNCTX_CORRUPT; }
+
+  SUNFunctionBegin(sunctx);
+
+  SUNAssert(max_vectors >= 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* idle vectors are destroyed, vectors in use return to the new pool */
+  SUNCheckCall(SUNVectorPool_Destroy(&sunctx->vector_pool));
+  if (max_vectors > 0)
+  {
+    SUNCheckCall(SUNVectorPool_Create(max_vectors, &sunctx->vector_pool));
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNContext_GetVectorPoolStats(SUNContext sunctx, long int* num_reused,
+                                         long int* num_cloned)
+{
+  if (!sunctx) { return SUN_ERR_SUNCTX_CORRUPT; }
+
+  SUNFunctionBegin(sunctx);
+
+  SUNAssert(num_reused && num_cloned, SUN_ERR_ARG_CORRUPT);
+
+  *num_reused = sunctx->vector_pool ? sunctx->vector_pool->num_reused : 0;
+  *num_cloned = sunctx->vector_pool ? sunctx->vector_pool->num_cloned : 0;
+
+  return SUN_SUCCESS;
+}
+
 SUNErrCode SUNContext_Free(SUNContext* sunctx)
 {
 #ifdef SUNDIALS_ADIAK_ENABLED
@@ -258,6 +300,12 @@ SUNErrCode SUNContext_Free(SUNContext* sunctx)
 
   if (!sunctx || !(*sunctx)) { return SUN_SUCCESS; }
 
+  SUNVectorPool_Destroy(&(*sunctx)->vector_pool);
+  SUNMmapStore_Destroy(&(*sunctx)->mmap_store);
+#if SUNDIALS_MPI_ENABLED
+  SUNMPIReduce_Destroy(&(*sunctx)->mpi_reduce);
+#endif
+
 #if defined(SUNDIALS_BUILD_WITH_PROFILING) && !defined(SUNDIALS_CALIPER_ENABLED)
   /* Find out where we are printing to */
   FILE* fp                    = NULL;
@@ -281,6 +329,13 @@ SUNErrCode SUNContext_Free(SUNContext* sunctx)
   {
     if (fp) { SUNProfiler_Print((*sunctx)->profiler, fp); }
     if (fp) { fclose(fp); }
+    /* Write the trace events if tracing was requested */
+    char* sunprofiler_trace_env = getenv("SUNPROFILER_TRACE");
+    if (sunprofiler_trace_env && (fp = fopen(sunprofiler_trace_env, "w")))
+    {
+      SUNProfiler_WriteTrace((*sunctx)->profiler, fp);
+      fclose(fp);
+    }
     if ((*sunctx)->own_profiler) { SUNProfiler_Free(&(*sunctx)->profiler); }
   }
 #endif
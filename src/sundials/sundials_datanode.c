@@ -29,10 +29,14 @@
  * checkpointing states in adjoint sensitivity analysis.
  * -----------------------------------------------------------------*/
 
+#include <stdlib.h>
+
 #include <sundials/priv/sundials_errors_impl.h>
 #include <sundials/sundials_core.h>
 
+#include "sundatanode/sundatanode_compress.h"
 #include "sundatanode/sundatanode_inmem.h"
+#include "sundatanode/sundatanode_mmap.h"
 #include "sundials/sundials_errors.h"
 #include "sundials/sundials_memory.h"
 #include "sundials_datanode.h"
@@ -63,6 +67,7 @@ SUNErrCode SUNDataNode_CreateEmpty(SUNContext sunctx, SUNDataNode* node_out)
   ops->removechild = NULL;
   ops->getdata     = NULL;
   ops->setdata     = NULL;
+  ops->reservedata = NULL;
   ops->destroy     = NULL;
 
   self->dtype   = 0;
@@ -95,6 +100,9 @@ SUNErrCode SUNDataNode_CreateLeaf(SUNDataIOMode io_mode,
   case (SUNDATAIOMODE_INMEM):
     err = SUNDataNode_CreateLeaf_InMem(mem_helper, sunctx, node_out);
     break;
+  case (SUNDATAIOMODE_MMAP):
+    err = SUNDataNode_CreateLeaf_Mmap(mem_helper, sunctx, node_out);
+    break;
   default: err = SUN_ERR_ARG_OUTOFRANGE;
   }
 
@@ -124,6 +132,7 @@ SUNErrCode SUNDataNode_CreateList(SUNDataIOMode io_mode,
   switch (io_mode)
   {
   case (SUNDATAIOMODE_INMEM):
+  case (SUNDATAIOMODE_MMAP):
     err = SUNDataNode_CreateList_InMem(num_elements, sunctx, node_out);
     break;
   default: err = SUN_ERR_ARG_OUTOFRANGE;
@@ -155,6 +164,7 @@ SUNErrCode SUNDataNode_CreateObject(SUNDataIOMode io_mode,
   switch (io_mode)
   {
   case (SUNDATAIOMODE_INMEM):
+  case (SUNDATAIOMODE_MMAP):
     err = SUNDataNode_CreateObject_InMem(num_elements, sunctx, node_out);
     break;
   default: err = SUN_ERR_ARG_OUTOFRANGE;
@@ -454,6 +464,34 @@ SUNErrCode SUNDataNode_SetData(SUNDataNode self, SUNMemoryType src_mem_type,
   return SUN_ERR_NOT_IMPLEMENTED;
 }
 
+/**
+ * :param self: The SUNDataNode.
+ * :param node_mem_type: The memory type for the data in the node.
+ * :param data_stride: The stride of the data.
+ * :param data_bytes: The size of the data in bytes.
+ * :param data: Pointer to the output leaf storage.
+ * :return: SUNErrCode indicating success or failure.
+ */
+SUNErrCode SUNDataNode_ReserveData(SUNDataNode self, SUNMemoryType node_mem_type,
+                                   size_t data_stride, size_t data_bytes,
+                                   void** data)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(SUNCTX_->profiler);
+
+  if (self->ops->reservedata)
+  {
+    SUNErrCode err = self->ops->reservedata(self, node_mem_type, data_stride,
+                                            data_bytes, data);
+    SUNDIALS_MARK_FUNCTION_END(SUNCTX_->profiler);
+    return err;
+  }
+
+  SUNDIALS_MARK_FUNCTION_END(SUNCTX_->profiler);
+  return SUN_ERR_NOT_IMPLEMENTED;
+}
+
 /**
  * :param self: The SUNDataNode.
  * :param v: The state N_Vector.
@@ -477,6 +515,86 @@ SUNErrCode SUNDataNode_SetDataNvector(SUNDataNode self, N_Vector v, sunrealtype
   return SUN_ERR_NOT_IMPLEMENTED;
 }
 
+/**
+ * :param self: The SUNDataNode.
+ * :param v: The state N_Vector.
+ * :param t: The time associated with the state vector.
+ * :param mode: The compression to apply.
+ * :param weights: The error weights for lossy compression (may be NULL).
+ * :param tol: The WRMS tolerance for lossy compression.
+ * :return: SUNErrCode indicating success or failure.
+ */
+SUNErrCode SUNDataNode_SetDataNvectorCompressed(SUNDataNode self, N_Vector v,
+                                                sunrealtype t,
+                                                SUNDataCompression mode,
+                                                N_Vector weights,
+                                                sunrealtype tol)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  if (mode == SUNDATACOMPRESSION_NONE)
+  {
+    return SUNDataNode_SetDataNvector(self, v, t);
+  }
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(SUNCTX_->profiler);
+
+  sunindextype buffer_size = 0;
+  SUNErrCode err           = N_VBufSize(v, &buffer_size);
+  size_t num_values        = (size_t)buffer_size / sizeof(sunrealtype);
+  size_t out_bytes         = 0;
+  sunbooleantype quantize  = mode == SUNDATACOMPRESSION_LOSSY && weights;
+
+  /* one extra value keeps the allocations nonempty */
+  sunrealtype* values = (sunrealtype*)malloc(buffer_size + sizeof(sunrealtype));
+  sunrealtype* ewt    = NULL;
+  char* out           = (char*)malloc(sunCompressBound(num_values));
+  if (quantize)
+  {
+    ewt = (sunrealtype*)malloc(buffer_size + sizeof(sunrealtype));
+  }
+  if (values == NULL || (quantize && ewt == NULL) || out == NULL)
+  {
+    err = SUN_ERR_MALLOC_FAIL;
+  }
+
+  /* BufPack handles any copies from the device */
+  if (err == SUN_SUCCESS) { err = N_VBufPack(v, values); }
+  if (err == SUN_SUCCESS && quantize)
+  {
+    sunindextype weights_size = 0;
+    err = N_VBufSize(weights, &weights_size);
+    if (err == SUN_SUCCESS && weights_size != buffer_size)
+    {
+      err = SUN_ERR_ARG_INCOMPATIBLE;
+    }
+  }
+  if (err == SUN_SUCCESS && quantize)
+  {
+    err = N_VBufPack(weights, ewt);
+    if (err == SUN_SUCCESS) { sunQuantizeValues(values, ewt, tol, num_values); }
+  }
+
+  if (err == SUN_SUCCESS)
+  {
+    err = sunCompressValues(t, values, num_values, out, &out_bytes);
+  }
+
+  /* the magic word in the compressed header marks the leaf as compressed */
+  if (err == SUN_SUCCESS)
+  {
+    err = SUNDataNode_SetData(self, SUNMEMTYPE_HOST, SUNMEMTYPE_HOST, out, 1,
+                              out_bytes);
+  }
+
+  free(values);
+  free(ewt);
+  free(out);
+
+  SUNDIALS_MARK_FUNCTION_END(SUNCTX_->profiler);
+  return err;
+}
+
 /**
  * :param node: Pointer to the SUNDataNode to destroy.
  * :return: SUNErrCode indicating success or failure.
@@ -64,6 +64,8 @@ struct SUNDataNode_Ops_
                         SUNMemoryType node_mem_type, void* data,
                         size_t data_stride, size_t data_bytes);
   SUNErrCode (*setdatanvector)(SUNDataNode, N_Vector v, sunrealtype t);
+  SUNErrCode (*reservedata)(SUNDataNode, SUNMemoryType node_mem_type,
+                            size_t data_stride, size_t data_bytes, void** data);
   SUNErrCode (*destroy)(SUNDataNode*);
 };
 
@@ -139,10 +141,25 @@ SUNErrCode SUNDataNode_SetData(SUNDataNode self, SUNMemoryType src_mem_type,
                                SUNMemoryType node_mem_type, void* data,
                                size_t data_stride, size_t data_bytes);
 
+/* Allocates leaf storage without filling it, the caller writes the data */
+SUNDIALS_EXPORT
+SUNErrCode SUNDataNode_ReserveData(SUNDataNode self, SUNMemoryType node_mem_type,
+                                   size_t data_stride, size_t data_bytes,
+                                   void** data);
+
 SUNDIALS_EXPORT
 SUNErrCode SUNDataNode_SetDataNvector(SUNDataNode self, N_Vector v,
                                       sunrealtype t);
 
+/* Stores a vector compressed with the given mode, the lossy mode keeps the
+   WRMS norm (with the given weights) of the error below tol */
+SUNDIALS_EXPORT
+SUNErrCode SUNDataNode_SetDataNvectorCompressed(SUNDataNode self, N_Vector v,
+                                                sunrealtype t,
+                                                SUNDataCompression mode,
+                                                N_Vector weights,
+                                                sunrealtype tol);
+
 SUNDIALS_EXPORT
 SUNErrCode SUNDataNode_Destroy(SUNDataNode* node);
 
@@ -79,9 +79,6 @@ void SUNAbortErrHandlerFn(int line, const char* func, const char* file,
                           SUNDIALS_MAYBE_UNUSED void* err_user_data,
                           SUNContext sunctx)
 {
-  /* Flush all buffered logging messages now before we abort */
-  SUNLogger_Flush(sunctx->logger, SUN_LOGLEVEL_ALL);
-
   char* file_and_line = sunCombineFileAndLine(line, file);
   if (msg == NULL) { msg = SUNGetErrMsg(err_code); }
   SUNLogger_QueueMsg(sunctx->logger, SUN_LOGLEVEL_ERROR, file_and_line, func,
@@ -94,6 +91,9 @@ void SUNAbortErrHandlerFn(int line, const char* func, const char* file,
                      "SUNAbortErrHandler: Calling abort now, use a different "
                      "error handler to avoid program termination.\n");
   free(file_and_line);
+  /* Write all buffered logging messages, including the ones above, and wait
+     for any asynchronous output to finish before we abort */
+  SUNLogger_Flush(sunctx->logger, SUN_LOGLEVEL_ALL);
   abort();
 }
 
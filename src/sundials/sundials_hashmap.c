@@ -11,10 +11,10 @@
  * SPDX-License-Identifier: BSD-3-Clause
  * SUNDIALS Copyright End
  * -----------------------------------------------------------------
- * A simple hashmap implementation for char* keys and
- * void* values. Uses linear probing to resolve collisions.
- * The values can be anything, but will be freed by
- * the hash map upon its destruction.
+ * A hashmap for char* keys and void* values using open addressing
+ * with linear probing. The map grows automatically and owns a copy
+ * of each key. The values can be anything, but will be freed by
+ * the hash map upon its destruction if a destroy function is given.
  * -----------------------------------------------------------------*/
 
 #include <limits.h>
@@ -28,39 +28,95 @@
 #include "sundials_hashmap_impl.h"
 #include "sundials_macros.h"
 
-static const uint64_t HASH_PRIME        = 14695981039346656037U;
-static const uint64_t HASH_OFFSET_BASIS = 1099511628211U;
+static const uint64_t HASH_OFFSET_BASIS = 14695981039346656037U;
+static const uint64_t HASH_PRIME        = 1099511628211U;
 
 /*
   For a nice discussion on popular hashing algorithms see:
   https://softwareengineering.stackexchange.com/questions/49550/which-hashing-algorithm-is-best-for-uniqueness-and-speed/145633#145633
 
   This is a 64-bit implementation of the 'a' modification of the
-  Fowler-Noll-Vo hash (i.e., FNV1-a).
+  Fowler-Noll-Vo hash (i.e., FNV1-a). The high bits are folded into the low
+  bits used to index the table and zero is reserved to mark empty slots.
  */
 static uint64_t fnv1a_hash(const char* str)
 {
   uint64_t hash = HASH_OFFSET_BASIS;
-  char c;
-  while ((c = *str++)) { hash = (hash ^ c) * HASH_PRIME; }
-  return hash;
+  unsigned char c;
+  while ((c = (unsigned char)*str++)) { hash = (hash ^ c) * HASH_PRIME; }
+  hash ^= hash >> 32;
+  return hash ? hash : 1;
 }
 
-static inline int64_t sunHashMapIdxFromKey(SUNHashMap map, const char* key)
+/* The first slot to probe for a hash */
+static inline int64_t sunHashMapHome(SUNHashMap map, uint64_t hash)
 {
-  /* We want the index to be in [0, SUNHashMap_Capacity(map)) */
-  int64_t end = SUNHashMap_Capacity(map) - 1;
-  int64_t idx = end == 0 ? end : (int64_t)(fnv1a_hash(key) % end);
-  return idx;
+  return (int64_t)(hash & (uint64_t)(map->capacity - 1));
 }
 
 /*
-  This function creates a new SUNHashMap object allocated to hold
-  up to 'capacity' entries.
+  Find the slot holding the key or, if the key is not in the map, the empty
+  slot that ends its probe sequence. The table always has an empty slot so the
+  search terminates.
+ */
+static int64_t sunHashMapFind(SUNHashMap map, const char* key, uint64_t hash)
+{
+  int64_t mask = map->capacity - 1;
+  int64_t idx  = sunHashMapHome(map, hash);
+
+  for (;;)
+  {
+    SUNHashMapKeyValue kv = &map->slots[idx];
+    if (!kv->hash) { return idx; }
+    if (kv->hash == hash && !strcmp(kv->key, key)) { return idx; }
+    idx = (idx + 1) & mask;
+  }
+}
+
+/* Move an entry between slots, updating the key pointer if it is inline */
+static inline void sunHashMapMoveSlot(SUNHashMapKeyValue dst,
+                                      SUNHashMapKeyValue src)
+{
+  *dst = *src;
+  if (src->key == src->inline_key) { dst->key = dst->inline_key; }
+  src->hash = 0;
+}
+
+/* Rehash the entries into a table with the given number of slots */
+static SUNErrCode sunHashMapResize(SUNHashMap map, int64_t capacity)
+{
+  struct SUNHashMapKeyValue_* old_slots = map->slots;
+  int64_t old_capacity                  = map->capacity;
+
+  map->slots = (struct SUNHashMapKeyValue_*)calloc(capacity,
+                                                   sizeof(*map->slots));
+  if (!map->slots)
+  {
+    map->slots = old_slots;
+    return SUN_ERR_MALLOC_FAIL;
+  }
+  map->capacity = capacity;
+
+  for (int64_t i = 0; i < old_capacity; i++)
+  {
+    if (!old_slots[i].hash) { continue; }
+    int64_t idx = sunHashMapHome(map, old_slots[i].hash);
+    while (map->slots[idx].hash) { idx = (idx + 1) & (capacity - 1); }
+    sunHashMapMoveSlot(&map->slots[idx], &old_slots[i]);
+  }
+
+  free(old_slots);
+
+  return SUN_SUCCESS;
+}
+
+/*
+  This function creates a new SUNHashMap object with room for at least
+  'capacity' slots. The map grows as needed when entries are inserted.
 
   **Arguments:**
-    * ``capacity`` -- the initial capactity number of the hashmap
-    * ``destroyKeyValue`` -- a callback function that frees both the key and value.
+    * ``capacity`` -- the initial capactity of the hashmap
+    * ``destroyValue`` -- a callback function that frees a value (may be NULL)
     * ``map`` -- on input, a SUNHasMap pointer, on output the SUNHashMap will be
                  allocated
 
@@ -68,38 +124,37 @@ static inline int64_t sunHashMapIdxFromKey(SUNHashMap map, const char* key)
     * A SUNErrCode indicating success or a failure
  */
 SUNErrCode SUNHashMap_New(int64_t capacity,
-                          SUNErrCode (*destroyKeyValue)(SUNHashMapKeyValue* kv_ptr),
+                          SUNErrCode (*destroyValue)(void* value),
                           SUNHashMap* map)
 {
+  int64_t nslots = 1;
+
   if (capacity <= 0) { return SUN_ERR_ARG_OUTOFRANGE; }
 
+  while (nslots < capacity) { nslots *= 2; }
+
   *map = NULL;
   *map = (SUNHashMap)malloc(sizeof(**map));
+  if (!(*map)) { return SUN_ERR_MALLOC_FAIL; }
 
-  if (!map) { return SUN_ERR_MALLOC_FAIL; }
-
-  SUNStlVector_SUNHashMapKeyValue buckets =
-    SUNStlVector_SUNHashMapKeyValue_New(capacity, destroyKeyValue);
-  if (!buckets)
+  (*map)->slots = (struct SUNHashMapKeyValue_*)calloc(nslots,
+                                                      sizeof(*(*map)->slots));
+  if (!(*map)->slots)
   {
     free(*map);
+    *map = NULL;
     return SUN_ERR_MALLOC_FAIL;
   }
 
-  /* Initialize all buckets to NULL */
-  for (int64_t i = 0; i < capacity; i++)
-  {
-    SUNErrCode err = SUNStlVector_SUNHashMapKeyValue_PushBack(buckets, NULL);
-    if (err) { return err; };
-  }
-
-  (*map)->buckets = buckets;
+  (*map)->destroyValue = destroyValue;
+  (*map)->capacity     = nslots;
+  (*map)->size         = 0;
 
   return SUN_SUCCESS;
 }
 
 /*
-  This function returns the capacity of the hashmap.
+  This function returns the capacity (number of slots) of the hashmap.
 
   **Arguments:**
     * ``map`` -- the SUNHashMap object
@@ -107,10 +162,18 @@ SUNErrCode SUNHashMap_New(int64_t capacity,
   **Returns:**
     * The capacity of the hashmap
  */
-int64_t SUNHashMap_Capacity(SUNHashMap map)
-{
-  return SUNStlVector_SUNHashMapKeyValue_Capacity(map->buckets);
-}
+int64_t SUNHashMap_Capacity(SUNHashMap map) { return map->capacity; }
+
+/*
+  This function returns the number of entries in the hashmap.
+
+  **Arguments:**
+    * ``map`` -- the SUNHashMap object
+
+  **Returns:**
+    * The number of entries in the hashmap
+ */
+int64_t SUNHashMap_Size(SUNHashMap map) { return map->size; }
 
 /*
   This function frees the SUNHashMap object.
@@ -124,10 +187,17 @@ int64_t SUNHashMap_Capacity(SUNHashMap map)
  */
 SUNErrCode SUNHashMap_Destroy(SUNHashMap* map)
 {
-  if (map == NULL) { return SUN_SUCCESS; }
+  if (map == NULL || *map == NULL) { return SUN_SUCCESS; }
+
+  for (int64_t i = 0; i < (*map)->capacity; i++)
+  {
+    SUNHashMapKeyValue kv = &(*map)->slots[i];
+    if (!kv->hash) { continue; }
+    if ((*map)->destroyValue) { (*map)->destroyValue(kv->value); }
+    if (kv->key != kv->inline_key) { free(kv->key); }
+  }
 
-  SUNErrCode err = SUNStlVector_SUNHashMapKeyValue_Destroy(&(*map)->buckets);
-  if (err) { return err; }
+  free((*map)->slots);
   free(*map);
   *map = NULL;
 
@@ -135,9 +205,9 @@ SUNErrCode SUNHashMap_Destroy(SUNHashMap* map)
 }
 
 /*
-  This function iterates the map over the range [start, N]. N is either the
-  index at which ``yieldfn`` indicates the iteration should stop, or the max
-  entries in the map.
+  This function iterates the map over the range [start, N). N is either the
+  index at which ``yieldfn`` indicates the iteration should stop, or the
+  capacity of the map.
 
   **Arguments:**
     * ``map`` -- the ``SUNHashMap`` object to operate on
@@ -145,8 +215,8 @@ SUNErrCode SUNHashMap_Destroy(SUNHashMap* map)
     * ``yieldfn`` -- the callback function to call every iteration
                      this should return SUNHASHMAP_ERROR to continue the iteration, or [0, SUNHASHMAP_KEYNOTFOUND]
                      to stop; the first argument is the current index, the second argument
-                     is the current key-value pair, and the final argument is the same
-                    pointer ``ctx`` as the final argument  to SUNHashMapIterate.
+                     is the current key-value pair (NULL for an empty slot), and the final
+                     argument is the same pointer ``ctx`` as the final argument to SUNHashMapIterate.
     * ``ctx`` -- a pointer to pass on to ``yieldfn``
 
   **Returns:**
@@ -161,65 +231,20 @@ int64_t SUNHashMap_Iterate(SUNHashMap map, int64_t start,
 {
   if (map == NULL || yieldfn == NULL) { return SUNHASHMAP_ERROR; }
 
-  for (int64_t i = start;
-       i < SUNStlVector_SUNHashMapKeyValue_Size(map->buckets); i++)
+  for (int64_t i = start; i < map->capacity; i++)
   {
-    int64_t retval =
-      yieldfn(i, *SUNStlVector_SUNHashMapKeyValue_At(map->buckets, i), ctx);
+    SUNHashMapKeyValue kv = map->slots[i].hash ? &map->slots[i] : NULL;
+    int64_t retval        = yieldfn(i, kv, ctx);
     if (retval == SUNHASHMAP_ERROR) { continue; /* keep looking */ }
     else { return (retval); /* yieldfn indicates the loop should break */ }
   }
 
-  return SUNHashMap_Capacity(map);
-}
-
-static int64_t sunHashMapLinearProbeInsert(int64_t idx, SUNHashMapKeyValue kv,
-                                           SUNDIALS_MAYBE_UNUSED const void* ctx)
-{
-  /* find the next open spot */
-  if (kv == NULL) { return (idx); /* open spot found at idx */ }
-  return SUNHASHMAP_ERROR; /* keep looking */
-}
-
-static SUNErrCode sunHashMapResize(SUNHashMap map)
-{
-  int64_t old_capacity = SUNHashMap_Capacity(map);
-  int64_t new_capacity = old_capacity == 0
-                           ? 2
-                           : (int64_t)(ceill(((long double)old_capacity) *
-                                             SUNSTLVECTOR_GROWTH_FACTOR));
-
-  SUNStlVector_SUNHashMapKeyValue old_buckets = map->buckets;
-  map->buckets = SUNStlVector_SUNHashMapKeyValue_New(new_capacity,
-                                                     map->buckets->destroyValue);
-
-  /* Set all buckets to NULL */
-  for (int64_t i = 0; i < new_capacity; i++)
-  {
-    SUNErrCode err = SUNStlVector_SUNHashMapKeyValue_PushBack(map->buckets, NULL);
-    if (err) { return err; }
-  }
-
-  /* Rehash and reinsert */
-  for (int64_t i = old_capacity - 1; i >= 0; i--)
-  {
-    SUNHashMapKeyValue kvp = *SUNStlVector_SUNHashMapKeyValue_At(old_buckets, i);
-    if (kvp)
-    {
-      SUNHashMap_Insert(map, kvp->key, kvp->value);
-      free(kvp->key);
-      free(kvp);
-    }
-    SUNErrCode err = SUNStlVector_SUNHashMapKeyValue_PopBack(old_buckets);
-    if (err) { return err; }
-  }
-
-  return SUNStlVector_SUNHashMapKeyValue_Destroy(&old_buckets);
+  return map->capacity;
 }
 
 /*
   This function creates a key-value pair and attempts to insert it into the map.
-  Will use linear probing if there is a collision.
+  The map grows when it becomes more than 3/4 full.
 
   **Arguments:**
     * ``map`` -- the ``SUNHashMap`` object to operate on
@@ -233,75 +258,40 @@ static SUNErrCode sunHashMapResize(SUNHashMap map)
  */
 int64_t SUNHashMap_Insert(SUNHashMap map, const char* key, void* value)
 {
+  uint64_t hash;
   int64_t idx;
-  int64_t retval;
-  SUNHashMapKeyValue kvp;
+  size_t len;
+  SUNHashMapKeyValue kv;
 
   if (map == NULL || key == NULL || value == NULL) { return SUNHASHMAP_ERROR; }
 
-  idx = sunHashMapIdxFromKey(map, key);
+  hash = fnv1a_hash(key);
+  idx  = sunHashMapFind(map, key, hash);
+  if (map->slots[idx].hash) { return SUNHASHMAP_DUPLICATE; }
 
-  /* Check if the bucket is already filled (i.e., we might have had a collision) */
-  kvp = *SUNStlVector_SUNHashMapKeyValue_At(map->buckets, idx);
-  if (kvp != NULL)
+  /* grow the table to keep the probe sequences short */
+  if (4 * (map->size + 1) > 3 * map->capacity)
   {
-    /* Determine if key is actually a duplicate (not allowed) */
-    if (!strcmp(key, kvp->key)) { return SUNHASHMAP_DUPLICATE; }
-
-    /* OK, it was a real collision, so find the next open spot */
-    retval = SUNHashMap_Iterate(map, idx + 1, sunHashMapLinearProbeInsert, NULL);
-    if (retval == SUNHASHMAP_ERROR)
-    {
-      /* an error occurred */
-      return retval;
-    }
-    else if (retval == SUNHashMap_Capacity(map))
-    {
-      /* the map is out of empty buckets, so we grow it */
-      SUNErrCode err = sunHashMapResize(map);
-      if (err) { return err; }
-      return SUNHashMap_Insert(map, key, value);
-    }
-
-    idx = retval;
+    if (sunHashMapResize(map, 2 * map->capacity)) { return SUNHASHMAP_ERROR; }
+    idx = sunHashMapFind(map, key, hash);
   }
 
-  /* Create the key-value pair */
-  kvp = (SUNHashMapKeyValue)malloc(sizeof(*kvp));
-
-  /* Copy the original_key so that the hashmap owns it */
-  size_t len     = strlen(key) + 1;
-  char* key_copy = malloc(sizeof(*key) * len);
-  if (!key_copy)
+  /* Copy the key so that the hashmap owns it */
+  kv  = &map->slots[idx];
+  len = strlen(key) + 1;
+  if (len <= SUNHASHMAP_INLINE_KEY_SIZE) { kv->key = kv->inline_key; }
+  else
   {
-    free(kvp);
-    return SUNHASHMAP_ERROR;
+    kv->key = (char*)malloc(len);
+    if (!kv->key) { return SUNHASHMAP_ERROR; }
   }
-  strcpy(key_copy, key);
-
-  kvp->key   = key_copy;
-  kvp->value = value;
+  memcpy(kv->key, key, len);
 
-  /* Insert the key-value pair */
-  return SUNStlVector_SUNHashMapKeyValue_Set(map->buckets, idx, kvp);
-}
-
-static int64_t sunHashMapLinearProbeGet(int64_t idx, SUNHashMapKeyValue kv,
-                                        const void* key)
-{
-  /* target key cannot be NULL */
-  if (key == NULL) { return SUNHASHMAP_KEYNOTFOUND; }
+  kv->hash  = hash;
+  kv->value = value;
+  map->size++;
 
-  /* find the matching entry */
-  if (kv == NULL)
-  {
-    return SUNHASHMAP_ERROR; /* keep looking since this bucket is empty */
-  }
-  if (!strcmp(kv->key, (const char*)key))
-  {
-    return (idx); /* found it at idx */
-  }
-  return SUNHASHMAP_ERROR; /* keep looking */
+  return (0);
 }
 
 /*
@@ -320,42 +310,20 @@ static int64_t sunHashMapLinearProbeGet(int64_t idx, SUNHashMapKeyValue kv,
 int64_t SUNHashMap_GetValue(SUNHashMap map, const char* key, void** value)
 {
   int64_t idx;
-  int64_t retval;
-  sunbooleantype collision;
 
   if (map == NULL || key == NULL || value == NULL) { return SUNHASHMAP_ERROR; }
 
-  idx = sunHashMapIdxFromKey(map, key);
+  idx = sunHashMapFind(map, key, fnv1a_hash(key));
+  if (!map->slots[idx].hash) { return SUNHASHMAP_KEYNOTFOUND; }
 
-  SUNHashMapKeyValue kvp = *SUNStlVector_SUNHashMapKeyValue_At(map->buckets, idx);
-
-  /* Check for a collision (NULL kvp means there was a collision at one point, but
-     the colliding key has since been removed)*/
-  collision = kvp ? strcmp(kvp->key, key) : SUNTRUE;
-
-  /* Resolve a collision via linear probing */
-  if (collision)
-  {
-    retval = SUNHashMap_Iterate(map, idx + 1, sunHashMapLinearProbeGet, key);
-    if (retval == SUNHASHMAP_ERROR)
-    {
-      /* the key was either not found anywhere or an error occurred */
-      return retval;
-    }
-    else { idx = retval; }
-  }
-
-  /* Return a reference to the value only */
-  SUNHashMapKeyValue* kvp_ptr = SUNStlVector_SUNHashMapKeyValue_At(map->buckets,
-                                                                   idx);
-  if (kvp_ptr) { *value = (*kvp_ptr)->value; }
-  else { return SUNHASHMAP_KEYNOTFOUND; }
+  *value = map->slots[idx].value;
 
   return (0);
 }
 
 /*
-  This function remove the key-value pair.
+  This function remove the key-value pair. The following entries in the probe
+  sequence are shifted back so no tombstones are needed.
 
   **Arguments:**
     * ``map`` -- the ``SUNHashMap`` object to operate on
@@ -369,50 +337,41 @@ int64_t SUNHashMap_GetValue(SUNHashMap map, const char* key, void** value)
  */
 int64_t SUNHashMap_Remove(SUNHashMap map, const char* key, void** value)
 {
-  int64_t idx;
-  int64_t retval;
-  sunbooleantype collision;
-
-  if (map == NULL || key == NULL) { return SUNHASHMAP_ERROR; }
+  int64_t mask, hole, idx;
+  SUNHashMapKeyValue kv;
 
-  idx = sunHashMapIdxFromKey(map, key);
+  if (map == NULL || key == NULL || value == NULL) { return SUNHASHMAP_ERROR; }
 
-  SUNHashMapKeyValue kvp = *SUNStlVector_SUNHashMapKeyValue_At(map->buckets, idx);
+  hole = sunHashMapFind(map, key, fnv1a_hash(key));
+  kv   = &map->slots[hole];
+  if (!kv->hash) { return SUNHASHMAP_KEYNOTFOUND; }
 
-  /* Check for a collision (NULL kvp means there was a collision at one point, but
-     the colliding key has since been removed)*/
-  collision = kvp ? strcmp(kvp->key, key) : SUNTRUE;
+  /* Since we are returning the value only, we must free the key */
+  *value = kv->value;
+  if (kv->key != kv->inline_key) { free(kv->key); }
+  kv->hash = 0;
+  map->size--;
 
-  /* Check to see if this is a collision */
-  if (collision)
+  /* Move back any entries whose probe sequence passes through the hole */
+  mask = map->capacity - 1;
+  for (idx = (hole + 1) & mask; map->slots[idx].hash; idx = (idx + 1) & mask)
   {
-    /* Keys did not match, so we have a collision and need to probe */
-    retval = SUNHashMap_Iterate(map, idx + 1, sunHashMapLinearProbeGet,
-                                (const void*)key);
-    if (retval == SUNHASHMAP_ERROR)
-    {
-      /* an error occurred or the key was not found anywhere */
-      return retval;
-    }
-    else { idx = retval; }
+    int64_t home = sunHashMapHome(map, map->slots[idx].hash);
+    /* the entry stays if its home is cyclically in (hole, idx] */
+    sunbooleantype stays = (hole <= idx) ? (hole < home && home <= idx)
+                                         : (hole < home || home <= idx);
+    if (stays) { continue; }
+    sunHashMapMoveSlot(&map->slots[hole], &map->slots[idx]);
+    hole = idx;
   }
 
-  /* Return a reference to the value only */
-  kvp    = *SUNStlVector_SUNHashMapKeyValue_At(map->buckets, idx);
-  *value = kvp->value;
-
-  /* Since we are returning the value only, we must free the key and the kvp itself. */
-  free(kvp->key);
-  free(kvp);
-
-  /* Clear the bucket by setting it to NULL */
-  return SUNStlVector_SUNHashMapKeyValue_Set(map->buckets, idx, NULL);
+  return (0);
 }
 
 /*
   This function allocates a new array the same max_size as the map,
   then it sorts map into a new array of key-value pairs leaving
-  the map unchanged.
+  the map unchanged. Empty slots are NULL entries in the array.
 
   **Arguments:**
     * ``map`` -- the ``SUNHashMap`` object to operate on
@@ -429,17 +388,16 @@ SUNErrCode SUNHashMap_Sort(SUNHashMap map, SUNHashMapKeyValue** sorted,
 {
   if (!map || !compar) { return SUN_ERR_ARG_CORRUPT; }
 
-  *sorted =
-    (SUNHashMapKeyValue*)malloc(SUNHashMap_Capacity(map) * sizeof(**sorted));
+  *sorted = (SUNHashMapKeyValue*)malloc(map->capacity * sizeof(**sorted));
   if (!(*sorted)) { return SUN_ERR_MALLOC_FAIL; }
 
-  /* Copy the buckets into a new array */
-  for (int64_t i = 0; i < SUNHashMap_Capacity(map); i++)
+  /* Copy the slot addresses into a new array */
+  for (int64_t i = 0; i < map->capacity; i++)
   {
-    (*sorted)[i] = *SUNStlVector_SUNHashMapKeyValue_At(map->buckets, i);
+    (*sorted)[i] = map->slots[i].hash ? &map->slots[i] : NULL;
   }
 
-  qsort(*sorted, SUNHashMap_Capacity(map), sizeof(SUNHashMapKeyValue), compar);
+  qsort(*sorted, map->capacity, sizeof(SUNHashMapKeyValue), compar);
 
   return SUN_SUCCESS;
 }
@@ -462,14 +420,13 @@ SUNErrCode SUNHashMap_Values(SUNHashMap map, void*** values, int64_t value_size)
 
   if (!map) { return SUN_ERR_ARG_CORRUPT; }
 
-  *values = (void**)malloc(SUNHashMap_Capacity(map) * value_size);
-  if (!values) { return SUN_ERR_MALLOC_FAIL; }
+  *values = (void**)malloc(map->capacity * value_size);
+  if (!(*values)) { return SUN_ERR_MALLOC_FAIL; }
 
   /* Copy the values into a new array */
-  for (int64_t i = 0; i < SUNHashMap_Capacity(map); i++)
+  for (int64_t i = 0; i < map->capacity; i++)
   {
-    SUNHashMapKeyValue kvp = *SUNStlVector_SUNHashMapKeyValue_At(map->buckets, i);
-    if (kvp) { (*values)[count++] = kvp->value; }
+    if (map->slots[i].hash) { (*values)[count++] = map->slots[i].value; }
   }
 
   return SUN_SUCCESS;
@@ -481,10 +438,9 @@ SUNErrCode SUNHashMap_PrintKeys(SUNHashMap map, FILE* file)
 
   /* Print keys into a new array */
   fprintf(file, "[");
-  for (int64_t i = 0; i < SUNHashMap_Capacity(map); i++)
+  for (int64_t i = 0; i < map->capacity; i++)
   {
-    SUNHashMapKeyValue kvp = *SUNStlVector_SUNHashMapKeyValue_At(map->buckets, i);
-    if (kvp) { fprintf(file, "%s, ", kvp->key); }
+    if (map->slots[i].hash) { fprintf(file, "%s, ", map->slots[i].key); }
   }
   fprintf(file, "]\n");
 
@@ -11,15 +11,17 @@
  * SPDX-License-Identifier: BSD-3-Clause
  * SUNDIALS Copyright End
  * -----------------------------------------------------------------
- * A simple hashmap implementation for char* keys and
- * void* values. Uses linear probing to resolve collisions.
- * The values can be anything, but will be freed by
- * the hash map upon its destruction.
+ * A hashmap for char* keys and void* values using open addressing
+ * with linear probing. The map grows automatically and owns a copy
+ * of each key. The values can be anything, but will be freed by
+ * the hash map upon its destruction if a destroy function is given.
  * -----------------------------------------------------------------*/
 
 #ifndef _SUNDIALS_HASHMAP_IMPL_H
 #define _SUNDIALS_HASHMAP_IMPL_H
 
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <sundials/sundials_types.h>
 
@@ -31,32 +33,39 @@ extern "C" {
 #define SUNHASHMAP_KEYNOTFOUND -1
 #define SUNHASHMAP_DUPLICATE   -2
 
+/* Keys (including the null terminator) up to this size are stored in the
+   table, longer keys are allocated */
+#define SUNHASHMAP_INLINE_KEY_SIZE 40
+
 typedef struct SUNHashMapKeyValue_* SUNHashMapKeyValue;
 
+/* A slot in the table (64 bytes), the slot is empty when hash is zero */
 struct SUNHashMapKeyValue_
 {
-  char* key;
+  uint64_t hash;
+  char* key; /* points to inline_key or an allocated copy of the key */
   void* value;
+  char inline_key[SUNHASHMAP_INLINE_KEY_SIZE];
 };
 
-#define TTYPE SUNHashMapKeyValue
-#include "stl/sunstl_vector.h"
-#undef TTYPE
-
 typedef struct SUNHashMap_* SUNHashMap;
 
 struct SUNHashMap_
 {
-  SUNErrCode (*destroyKeyValue)(SUNHashMapKeyValue*);
-  SUNStlVector_SUNHashMapKeyValue buckets;
+  SUNErrCode (*destroyValue)(void* value);
+  struct SUNHashMapKeyValue_* slots;
+  int64_t capacity; /* number of slots, a power of two */
+  int64_t size;     /* number of entries */
 };
 
 SUNErrCode SUNHashMap_New(int64_t capacity,
-                          SUNErrCode (*destroyValue)(SUNHashMapKeyValue* value_ptr),
+                          SUNErrCode (*destroyValue)(void* value),
                           SUNHashMap* map);
 
 int64_t SUNHashMap_Capacity(SUNHashMap map);
 
+int64_t SUNHashMap_Size(SUNHashMap map);
+
 SUNErrCode SUNHashMap_Destroy(SUNHashMap* map);
 
 int64_t SUNHashMap_Iterate(SUNHashMap map, int64_t start,
@@ -13,6 +13,8 @@
  * -----------------------------------------------------------------*/
 
 #include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -34,6 +36,15 @@
 #include "sundials_macros.h"
 #include "sundials_utils.h"
 
+/* Asynchronous logging requires Pthreads and the GNU atomic builtins */
+#if defined(SUNDIALS_PTHREADS_ENABLED) && SUNDIALS_LOGGING_LEVEL > 0 && \
+  (defined(__GNUC__) || defined(__clang__))
+#define SUN_LOGGER_ASYNC_ENABLED
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#endif
+
 /* default number of files that we allocate space for */
 #define SUN_DEFAULT_LOGFILE_HANDLES_ 8
 
@@ -88,6 +99,856 @@ static FILE* sunOpenLogFile(const char* fname, const char* mode)
 }
 #endif
 
+#if SUNDIALS_LOGGING_LEVEL > 0
+
+/*
+  Message records.
+
+  The asynchronous and binary output modes store a message as a record. The
+  arguments are copied by value, including the contents of any %s arguments.
+  A queued record also holds copies of the scope, label, and format strings as
+  callers may free these as soon as the message is queued (e.g., the error
+  handlers build the scope at runtime).
+ */
+
+#define SUN_LOGREC_MAX_ARGS    16
+#define SUN_LOGREC_STRBUF_SIZE 256
+#define SUN_LOGREC_NAMES_SIZE  128
+#define SUN_LOGREC_FMTBUF_SIZE 256
+
+/* Length modifiers of a conversion specification */
+typedef enum
+{
+  SUN_LOGARG_NONE,
+  SUN_LOGARG_HH,
+  SUN_LOGARG_H,
+  SUN_LOGARG_L,
+  SUN_LOGARG_LL,
+  SUN_LOGARG_J,
+  SUN_LOGARG_Z,
+  SUN_LOGARG_T,
+  SUN_LOGARG_BIGL
+} sunLogArgLength;
+
+typedef union
+{
+  long long i;
+  double d;
+  long double ld;
+  const void* p;
+} sunLogArg;
+
+typedef struct
+{
+  SUNLogLevel lvl;
+  int nargs; /* number of arguments or -1 if the text was preformatted */
+  const char* scope;
+  const char* label;
+  const char* fmt;
+  sunLogArg args[SUN_LOGREC_MAX_ARGS];
+  /* argument types: 'i' integer, 'd' double, 'L' long double, 's' string, or
+     'p' pointer */
+  char types[SUN_LOGREC_MAX_ARGS];
+  char strbuf[SUN_LOGREC_STRBUF_SIZE]; /* %s arguments or preformatted text */
+  char names[SUN_LOGREC_NAMES_SIZE];   /* copies of the scope and label */
+  char fmtbuf[SUN_LOGREC_FMTBUF_SIZE]; /* copy of the format */
+} sunLogRecord;
+
+/* Copy the scope, label, and format strings into a record, truncating the
+   scope and label if necessary. Returns nonzero if the format does not fit, in
+   which case the message must be preformatted. */
+static int sunCopyLogStrings(sunLogRecord* rec, const char* scope,
+                             const char* label, const char* fmt)
+{
+  size_t n, len;
+
+  if (!scope) { scope = ""; }
+  if (!label) { label = ""; }
+
+  /* the scope and label share the names buffer */
+  n = strlen(scope);
+  if (n > SUN_LOGREC_NAMES_SIZE / 2 - 1) { n = SUN_LOGREC_NAMES_SIZE / 2 - 1; }
+  memcpy(rec->names, scope, n);
+  rec->names[n] = '\0';
+  rec->scope    = rec->names;
+
+  len = strlen(label);
+  if (len > SUN_LOGREC_NAMES_SIZE - n - 2)
+  {
+    len = SUN_LOGREC_NAMES_SIZE - n - 2;
+  }
+  memcpy(rec->names + n + 1, label, len);
+  rec->names[n + 1 + len] = '\0';
+  rec->label              = rec->names + n + 1;
+
+  len      = strlen(fmt) + 1;
+  rec->fmt = NULL;
+  if (len > SUN_LOGREC_FMTBUF_SIZE) { return 1; }
+  memcpy(rec->fmtbuf, fmt, len);
+  rec->fmt = rec->fmtbuf;
+
+  return 0;
+}
+
+/* Parse the conversion specification starting after a '%', returning a
+   pointer to the conversion character or NULL if it is not supported */
+static const char* sunParseLogSpec(const char* p, sunLogArgLength* len)
+{
+  /* flags, width, and precision (the '*' forms are not supported) */
+  while (*p && strchr("-+ #0", *p)) { p++; }
+  while (*p >= '0' && *p <= '9') { p++; }
+  if (*p == '.')
+  {
+    p++;
+    while (*p >= '0' && *p <= '9') { p++; }
+  }
+
+  /* length modifier */
+  *len = SUN_LOGARG_NONE;
+  switch (*p)
+  {
+  case 'h':
+    *len = (p[1] == 'h') ? SUN_LOGARG_HH : SUN_LOGARG_H;
+    p += (p[1] == 'h') ? 2 : 1;
+    break;
+  case 'l':
+    *len = (p[1] == 'l') ? SUN_LOGARG_LL : SUN_LOGARG_L;
+    p += (p[1] == 'l') ? 2 : 1;
+    break;
+  case 'j': *len = SUN_LOGARG_J; p++; break;
+  case 'z': *len = SUN_LOGARG_Z; p++; break;
+  case 't': *len = SUN_LOGARG_T; p++; break;
+  case 'L': *len = SUN_LOGARG_BIGL; p++; break;
+  default: break;
+  }
+
+  if (*p && strchr("diouxXcfFeEgGaAsp%", *p)) { return p; }
+
+  return NULL;
+}
+
+/* Copy the arguments of a message into a record, returns nonzero if the
+   message cannot be stored by value */
+static int sunPackLogArgs(sunLogRecord* rec, const char* fmt, va_list args)
+{
+  const char* p;
+  size_t nstr = 0;
+  sunLogArgLength len;
+
+  rec->nargs = 0;
+
+  for (p = strchr(fmt, '%'); p; p = strchr(p + 1, '%'))
+  {
+    p = sunParseLogSpec(p + 1, &len);
+    if (!p) { return 1; }
+    if (*p == '%') { continue; }
+    if (rec->nargs == SUN_LOGREC_MAX_ARGS) { return 1; }
+
+    sunLogArg* arg = &rec->args[rec->nargs];
+    char* type     = &rec->types[rec->nargs++];
+
+    switch (*p)
+    {
+    case 'd':
+    case 'i':
+    case 'c':
+      *type = 'i';
+      if (len == SUN_LOGARG_L) { arg->i = va_arg(args, long); }
+      else if (len == SUN_LOGARG_LL) { arg->i = va_arg(args, long long); }
+      else if (len == SUN_LOGARG_J) { arg->i = (long long)va_arg(args, intmax_t); }
+      else if (len == SUN_LOGARG_Z) { arg->i = (long long)va_arg(args, size_t); }
+      else if (len == SUN_LOGARG_T) { arg->i = va_arg(args, ptrdiff_t); }
+      else { arg->i = va_arg(args, int); }
+      break;
+    case 'o':
+    case 'u':
+    case 'x':
+    case 'X':
+      *type = 'i';
+      if (len == SUN_LOGARG_L) { arg->i = (long long)va_arg(args, unsigned long); }
+      else if (len == SUN_LOGARG_LL)
+      {
+        arg->i = (long long)va_arg(args, unsigned long long);
+      }
+      else if (len == SUN_LOGARG_J) { arg->i = (long long)va_arg(args, uintmax_t); }
+      else if (len == SUN_LOGARG_Z) { arg->i = (long long)va_arg(args, size_t); }
+      else if (len == SUN_LOGARG_T) { arg->i = va_arg(args, ptrdiff_t); }
+      else { arg->i = va_arg(args, unsigned int); }
+      break;
+    case 's':
+    {
+      const char* str = va_arg(args, const char*);
+      size_t slen;
+      if (len != SUN_LOGARG_NONE) { return 1; }
+      if (!str) { str = "(null)"; }
+      slen = strlen(str) + 1;
+      if (nstr + slen > SUN_LOGREC_STRBUF_SIZE) { return 1; }
+      memcpy(rec->strbuf + nstr, str, slen);
+      *type  = 's';
+      arg->i = (long long)nstr;
+      nstr += slen;
+      break;
+    }
+    case 'p':
+      *type  = 'p';
+      arg->p = va_arg(args, void*);
+      break;
+    default:
+      if (len == SUN_LOGARG_BIGL)
+      {
+        *type   = 'L';
+        arg->ld = va_arg(args, long double);
+      }
+      else
+      {
+        *type  = 'd';
+        arg->d = va_arg(args, double);
+      }
+    }
+  }
+
+  return 0;
+}
+
+/* Make sure a buffer can hold size characters */
+static int sunReserveLogBuffer(char** buf, size_t* buf_size, size_t size)
+{
+  char* tmp;
+  if (size <= *buf_size) { return 0; }
+  tmp = (char*)realloc(*buf, 2 * size);
+  if (!tmp) { return 1; }
+  *buf      = tmp;
+  *buf_size = 2 * size;
+  return 0;
+}
+
+/*
+  Binary output.
+
+  Each output file starts with the header
+
+    char magic[6] = "SUNLOG", uint8 version, uint8 little_endian, int32 rank
+
+  followed by a sequence of records beginning with a one character tag
+
+    'S' uint32 id, uint32 length, char text[length]
+
+        defines the string with the given id
+
+    'M' uint8 level, uint32 scope, uint32 label, uint32 format, uint8 nargs,
+        nargs x (char type, value)
+
+        a message where the scope, label, and format are string ids and each
+        argument is an 'i' (int64), 'd' (double), or 's' (uint32 string id)
+        value
+
+    'T' uint8 level, uint32 scope, uint32 label, uint32 length,
+        char text[length]
+
+        a message that could not be stored as a record and was formatted
+
+  Values are written in the native byte order without padding. Strings are
+  interned per file so each distinct scope, label, format, and %s argument is
+  only written once.
+ */
+
+#define SUN_LOGBIN_VERSION   1
+#define SUN_LOGBIN_MAX_FILES 4
+
+typedef struct
+{
+  FILE* fp;
+  SUNHashMap strings; /* maps a string to its id + 1 */
+  uint32_t nstrings;
+} sunLogBinaryFile;
+
+struct sunLoggerBinary_
+{
+  sunLogBinaryFile files[SUN_LOGBIN_MAX_FILES];
+  int nfiles;
+  int rank;
+
+  /* output buffer, the first committed characters are complete records */
+  char* buf;
+  size_t buf_size;
+  size_t len;
+  size_t committed;
+  int err;
+};
+
+/* Append data to the output buffer */
+static void sunLogBinaryPut(struct sunLoggerBinary_* binary, const void* data,
+                            size_t size)
+{
+  if (binary->err) { return; }
+  if (sunReserveLogBuffer(&binary->buf, &binary->buf_size, binary->len + size))
+  {
+    binary->err = 1;
+    return;
+  }
+  memcpy(binary->buf + binary->len, data, size);
+  binary->len += size;
+}
+
+static void sunLogBinaryPutU8(struct sunLoggerBinary_* binary, uint8_t val)
+{
+  sunLogBinaryPut(binary, &val, sizeof(val));
+}
+
+static void sunLogBinaryPutU32(struct sunLoggerBinary_* binary, uint32_t val)
+{
+  sunLogBinaryPut(binary, &val, sizeof(val));
+}
+
+/* Get the state for an output file, writing the header on first use */
+static sunLogBinaryFile* sunLogBinaryGetFile(struct sunLoggerBinary_* binary,
+                                             FILE* fp)
+{
+  sunLogBinaryFile* file;
+  const uint16_t one = 1;
+  char header[8]     = "SUNLOG";
+  int32_t rank       = (int32_t)binary->rank;
+  int i;
+
+  for (i = 0; i < binary->nfiles; i++)
+  {
+    if (binary->files[i].fp == fp) { return &binary->files[i]; }
+  }
+
+  /* there is at most one file per log level */
+  if (binary->nfiles == SUN_LOGBIN_MAX_FILES) { return NULL; }
+
+  file = &binary->files[binary->nfiles];
+  if (SUNHashMap_New(64, NULL, &file->strings)) { return NULL; }
+  file->fp       = fp;
+  file->nstrings = 0;
+  binary->nfiles++;
+
+  header[6] = SUN_LOGBIN_VERSION;
+  header[7] = *(const char*)&one;
+  fwrite(header, 1, sizeof(header), fp);
+  fwrite(&rank, sizeof(rank), 1, fp);
+
+  return file;
+}
+
+/* Get the id of a string, defining it in the output if necessary */
+static uint32_t sunLogBinaryString(struct sunLoggerBinary_* binary,
+                                   sunLogBinaryFile* file, const char* str)
+{
+  void* value = NULL;
+  uint32_t id;
+  uint32_t len;
+
+  if (!str) { str = ""; }
+
+  if (SUNHashMap_GetValue(file->strings, str, &value) == 0)
+  {
+    return (uint32_t)((uintptr_t)value - 1);
+  }
+
+  id  = file->nstrings;
+  len = (uint32_t)strlen(str);
+  sunLogBinaryPutU8(binary, 'S');
+  sunLogBinaryPutU32(binary, id);
+  sunLogBinaryPutU32(binary, len);
+  sunLogBinaryPut(binary, str, len);
+
+  /* only use the id once the definition is in the buffer */
+  if (!binary->err &&
+      SUNHashMap_Insert(file->strings, str, (void*)((uintptr_t)id + 1)) == 0)
+  {
+    file->nstrings++;
+    binary->committed = binary->len;
+  }
+  else { binary->err = 1; }
+
+  return id;
+}
+
+/* Write a record to the file for its level, txt is the formatted message when
+   the record does not contain the arguments (NULL to use the record buffer) */
+static void sunLoggerWriteBinary(SUNLogger logger, const sunLogRecord* rec,
+                                 const char* txt)
+{
+  struct sunLoggerBinary_* binary = logger->binary;
+  sunLogBinaryFile* file          = NULL;
+  FILE* fp                        = NULL;
+  uint32_t scope, label, fmt;
+  uint32_t ids[SUN_LOGREC_MAX_ARGS];
+  int i;
+
+  switch (rec->lvl)
+  {
+  case (SUN_LOGLEVEL_DEBUG): fp = logger->debug_fp; break;
+  case (SUN_LOGLEVEL_WARNING): fp = logger->warning_fp; break;
+  case (SUN_LOGLEVEL_INFO): fp = logger->info_fp; break;
+  case (SUN_LOGLEVEL_ERROR): fp = logger->error_fp; break;
+  default: break;
+  }
+
+  if (!fp) { return; }
+
+  file = sunLogBinaryGetFile(binary, fp);
+  if (!file) { return; }
+
+  binary->len       = 0;
+  binary->committed = 0;
+  binary->err       = 0;
+
+  /* define any new strings before the message */
+  scope = sunLogBinaryString(binary, file, rec->scope);
+  label = sunLogBinaryString(binary, file, rec->label);
+
+  if (rec->nargs < 0)
+  {
+    uint32_t len;
+    if (!txt) { txt = rec->strbuf; }
+    len = (uint32_t)strlen(txt);
+    sunLogBinaryPutU8(binary, 'T');
+    sunLogBinaryPutU8(binary, (uint8_t)rec->lvl);
+    sunLogBinaryPutU32(binary, scope);
+    sunLogBinaryPutU32(binary, label);
+    sunLogBinaryPutU32(binary, len);
+    sunLogBinaryPut(binary, txt, len);
+  }
+  else
+  {
+    fmt = sunLogBinaryString(binary, file, rec->fmt);
+    for (i = 0; i < rec->nargs; i++)
+    {
+      if (rec->types[i] == 's')
+      {
+        ids[i] = sunLogBinaryString(binary, file, rec->strbuf + rec->args[i].i);
+      }
+    }
+
+    sunLogBinaryPutU8(binary, 'M');
+    sunLogBinaryPutU8(binary, (uint8_t)rec->lvl);
+    sunLogBinaryPutU32(binary, scope);
+    sunLogBinaryPutU32(binary, label);
+    sunLogBinaryPutU32(binary, fmt);
+    sunLogBinaryPutU8(binary, (uint8_t)rec->nargs);
+    for (i = 0; i < rec->nargs; i++)
+    {
+      int64_t ival;
+      double dval;
+      switch (rec->types[i])
+      {
+      case 's':
+        sunLogBinaryPutU8(binary, 's');
+        sunLogBinaryPutU32(binary, ids[i]);
+        break;
+      case 'd':
+      case 'L':
+        dval = (rec->types[i] == 'd') ? rec->args[i].d : (double)rec->args[i].ld;
+        sunLogBinaryPutU8(binary, 'd');
+        sunLogBinaryPut(binary, &dval, sizeof(dval));
+        break;
+      default:
+        ival = (rec->types[i] == 'p') ? (int64_t)(intptr_t)rec->args[i].p
+                                      : (int64_t)rec->args[i].i;
+        sunLogBinaryPutU8(binary, 'i');
+        sunLogBinaryPut(binary, &ival, sizeof(ival));
+      }
+    }
+  }
+
+  if (!binary->err) { binary->committed = binary->len; }
+  fwrite(binary->buf, 1, binary->committed, fp);
+}
+
+/* Pack a message into a record and write it in the binary format */
+static void sunLoggerWriteBinaryMsg(SUNLogger logger, SUNLogLevel lvl,
+                                    const char* scope, const char* label,
+                                    const char* msg_txt, va_list args)
+{
+  sunLogRecord rec;
+  char* txt = NULL;
+  va_list args_copy;
+
+  rec.lvl   = lvl;
+  rec.scope = scope;
+  rec.label = label;
+  rec.fmt   = msg_txt;
+
+  /* copy the arguments or, if that is not possible, format the text */
+  va_copy(args_copy, args);
+  if (sunPackLogArgs(&rec, msg_txt, args_copy))
+  {
+    rec.nargs = -1;
+    if (sunvasnprintf(&txt, msg_txt, args) < 0)
+    {
+      va_end(args_copy);
+      free(txt);
+      return;
+    }
+  }
+  va_end(args_copy);
+
+  sunLoggerWriteBinary(logger, &rec, txt);
+  free(txt);
+}
+
+static void sunLoggerFreeBinary(SUNLogger logger)
+{
+  struct sunLoggerBinary_* binary = logger->binary;
+  int i;
+
+  if (!binary) { return; }
+
+  for (i = 0; i < binary->nfiles; i++)
+  {
+    SUNHashMap_Destroy(&binary->files[i].strings);
+  }
+  free(binary->buf);
+  free(binary);
+  logger->binary = NULL;
+}
+
+#endif
+
+#ifdef SUN_LOGGER_ASYNC_ENABLED
+
+/*
+  Asynchronous logging.
+
+  The thread calling SUNLogger_QueueMsg packs the message into a record in a
+  single-producer single-consumer ring buffer and returns. A background thread
+  formats the records and writes them to the output files.
+ */
+
+#define SUN_LOGGER_DEFAULT_SIZE 4096
+
+#define SUN_ATOMIC_LOAD(ptr)       __atomic_load_n(ptr, __ATOMIC_ACQUIRE)
+#define SUN_ATOMIC_STORE(ptr, val) __atomic_store_n(ptr, val, __ATOMIC_RELEASE)
+
+struct sunLoggerAsync_
+{
+  /* ring buffer, head is written by the producer and tail by the consumer */
+  sunLogRecord* records;
+  unsigned long capacity;
+  unsigned long head;
+  unsigned long tail;
+
+  SUNLogOverflowPolicy policy;
+  long int ndropped;
+  long int nreported;
+  int rank;
+  int stop;
+
+  /* formatting buffers used by the writer thread */
+  char* txt;
+  size_t txt_size;
+  char* msg;
+  size_t msg_size;
+
+  pthread_t writer;
+  pthread_mutex_t lock;
+  pthread_cond_t work_cond;
+  pthread_cond_t done_cond;
+};
+
+/* Print one argument of a record with the given conversion specification */
+static int sunPrintLogArg(char* buf, size_t size, const char* spec,
+                          char conv, sunLogArgLength len, const sunLogRecord* rec,
+                          const sunLogArg* arg)
+{
+  switch (conv)
+  {
+  case 'd':
+  case 'i':
+  case 'c':
+  case 'o':
+  case 'u':
+  case 'x':
+  case 'X':
+    if (len == SUN_LOGARG_L) { return snprintf(buf, size, spec, (long)arg->i); }
+    if (len == SUN_LOGARG_LL) { return snprintf(buf, size, spec, arg->i); }
+    if (len == SUN_LOGARG_J)
+    {
+      return snprintf(buf, size, spec, (intmax_t)arg->i);
+    }
+    if (len == SUN_LOGARG_Z) { return snprintf(buf, size, spec, (size_t)arg->i); }
+    if (len == SUN_LOGARG_T)
+    {
+      return snprintf(buf, size, spec, (ptrdiff_t)arg->i);
+    }
+    return snprintf(buf, size, spec, (int)arg->i);
+  case 's': return snprintf(buf, size, spec, rec->strbuf + arg->i);
+  case 'p': return snprintf(buf, size, spec, arg->p);
+  default:
+    if (len == SUN_LOGARG_BIGL) { return snprintf(buf, size, spec, arg->ld); }
+    return snprintf(buf, size, spec, arg->d);
+  }
+}
+
+/* Format the message text of a record into async->txt */
+static const char* sunFormatLogRecord(struct sunLoggerAsync_* async,
+                                      const sunLogRecord* rec)
+{
+  const char* p;
+  const char* q;
+  size_t n = 0;
+  int iarg = 0;
+  char spec[32];
+  sunLogArgLength len;
+
+  if (rec->nargs < 0) { return rec->strbuf; }
+
+  for (p = rec->fmt; *p;)
+  {
+    int m;
+
+    /* copy literal text up to the next conversion */
+    q = strchr(p, '%');
+    if (!q) { q = p + strlen(p); }
+    if (sunReserveLogBuffer(&async->txt, &async->txt_size, n + (q - p) + 1))
+    {
+      return NULL;
+    }
+    memcpy(async->txt + n, p, q - p);
+    n += q - p;
+    async->txt[n] = '\0';
+    if (!*q) { break; }
+
+    /* print the conversion */
+    p = sunParseLogSpec(q + 1, &len) + 1;
+    if (*(p - 1) == '%')
+    {
+      async->txt[n++] = '%';
+      async->txt[n]   = '\0';
+      continue;
+    }
+    if ((size_t)(p - q) >= sizeof(spec)) { return NULL; }
+    memcpy(spec, q, p - q);
+    spec[p - q] = '\0';
+
+    m = sunPrintLogArg(NULL, 0, spec, *(p - 1), len, rec, &rec->args[iarg]);
+    if (m < 0 || sunReserveLogBuffer(&async->txt, &async->txt_size, n + m + 1))
+    {
+      return NULL;
+    }
+    sunPrintLogArg(async->txt + n, m + 1, spec, *(p - 1), len, rec,
+                   &rec->args[iarg++]);
+    n += m;
+  }
+
+  if (sunReserveLogBuffer(&async->txt, &async->txt_size, n + 1)) { return NULL; }
+  async->txt[n] = '\0';
+
+  return async->txt;
+}
+
+/* Write a formatted message to the file for its level */
+static void sunLoggerWriteMsg(SUNLogger logger, SUNLogLevel lvl, int rank,
+                              const char* scope, const char* label,
+                              const char* txt, char** buf, size_t* buf_size)
+{
+  const char* prefix = NULL;
+  FILE* fp           = NULL;
+  int msg_length;
+
+  switch (lvl)
+  {
+  case (SUN_LOGLEVEL_DEBUG):
+    prefix = "DEBUG";
+    fp     = logger->debug_fp;
+    break;
+  case (SUN_LOGLEVEL_WARNING):
+    prefix = "WARNING";
+    fp     = logger->warning_fp;
+    break;
+  case (SUN_LOGLEVEL_INFO):
+    prefix = "INFO";
+    fp     = logger->info_fp;
+    break;
+  case (SUN_LOGLEVEL_ERROR):
+    prefix = "ERROR";
+    fp     = logger->error_fp;
+    break;
+  default: break;
+  }
+
+  if (!fp) { return; }
+
+  msg_length = snprintf(NULL, 0, "[%s][rank %d][%s][%s] %s\n", prefix, rank,
+                        scope, label, txt);
+  if (msg_length < 0 || sunReserveLogBuffer(buf, buf_size, msg_length + 1))
+  {
+    return;
+  }
+  snprintf(*buf, msg_length + 1, "[%s][rank %d][%s][%s] %s\n", prefix, rank,
+           scope, label, txt);
+  fputs(*buf, fp);
+}
+
+/* Background thread that formats and writes the queued messages */
+static void* sunLoggerWriter(void* arg)
+{
+  SUNLogger logger               = (SUNLogger)arg;
+  struct sunLoggerAsync_* async = logger->async;
+  unsigned long tail            = async->tail;
+
+  for (;;)
+  {
+    unsigned long head = SUN_ATOMIC_LOAD(&async->head);
+
+    if (tail == head)
+    {
+      /* report any dropped messages */
+      long int ndropped = SUN_ATOMIC_LOAD(&async->ndropped);
+      if (ndropped > async->nreported)
+      {
+        char txt[64];
+        snprintf(txt, sizeof(txt), "%ld messages were dropped",
+                 ndropped - async->nreported);
+        if (logger->binary)
+        {
+          sunLogRecord rec;
+          rec.lvl   = SUN_LOGLEVEL_WARNING;
+          rec.nargs = -1;
+          rec.scope = "SUNLogger";
+          rec.label = "async";
+          sunLoggerWriteBinary(logger, &rec, txt);
+        }
+        else
+        {
+          sunLoggerWriteMsg(logger, SUN_LOGLEVEL_WARNING, async->rank,
+                            "SUNLogger", "async", txt, &async->msg,
+                            &async->msg_size);
+        }
+        async->nreported = ndropped;
+      }
+
+      /* wake any threads waiting on a flush and wait for more work */
+      pthread_mutex_lock(&async->lock);
+      pthread_cond_broadcast(&async->done_cond);
+      if (SUN_ATOMIC_LOAD(&async->stop) &&
+          tail == SUN_ATOMIC_LOAD(&async->head))
+      {
+        pthread_mutex_unlock(&async->lock);
+        break;
+      }
+      if (tail == SUN_ATOMIC_LOAD(&async->head))
+      {
+        struct timespec wake;
+        clock_gettime(CLOCK_REALTIME, &wake);
+        wake.tv_nsec += 1000000;
+        if (wake.tv_nsec >= 1000000000)
+        {
+          wake.tv_sec++;
+          wake.tv_nsec -= 1000000000;
+        }
+        pthread_cond_timedwait(&async->work_cond, &async->lock, &wake);
+      }
+      pthread_mutex_unlock(&async->lock);
+      continue;
+    }
+
+    /* write all available records */
+    for (; tail != head; tail++)
+    {
+      const sunLogRecord* rec = &async->records[tail & (async->capacity - 1)];
+      const char* txt         = NULL;
+      if (logger->binary) { sunLoggerWriteBinary(logger, rec, NULL); }
+      else if ((txt = sunFormatLogRecord(async, rec)))
+      {
+        sunLoggerWriteMsg(logger, rec->lvl, async->rank, rec->scope, rec->label,
+                          txt, &async->msg, &async->msg_size);
+      }
+      SUN_ATOMIC_STORE(&async->tail, tail + 1);
+    }
+  }
+
+  return NULL;
+}
+
+/* Queue a message in the ring buffer */
+static SUNErrCode sunLoggerPushMsg(SUNLogger logger, SUNLogLevel lvl,
+                                   const char* scope, const char* label,
+                                   const char* msg_txt, va_list args)
+{
+  struct sunLoggerAsync_* async = logger->async;
+  unsigned long head            = async->head;
+  sunLogRecord* rec;
+  va_list args_copy;
+
+  /* check for space in the buffer */
+  while (head - SUN_ATOMIC_LOAD(&async->tail) == async->capacity)
+  {
+    if (async->policy == SUN_LOGOVERFLOW_DROP)
+    {
+      SUN_ATOMIC_STORE(&async->ndropped, async->ndropped + 1);
+      return SUN_SUCCESS;
+    }
+    /* wait for the writer to make space */
+    pthread_mutex_lock(&async->lock);
+    pthread_cond_signal(&async->work_cond);
+    pthread_mutex_unlock(&async->lock);
+    sched_yield();
+  }
+
+  rec      = &async->records[head & (async->capacity - 1)];
+  rec->lvl = lvl;
+
+  /* copy the strings and arguments or, if that is not possible, format the
+     text now since the caller may free its strings once this returns */
+  va_copy(args_copy, args);
+  if (sunCopyLogStrings(rec, scope, label, msg_txt) ||
+      sunPackLogArgs(rec, msg_txt, args_copy))
+  {
+    rec->nargs = -1;
+    vsnprintf(rec->strbuf, SUN_LOGREC_STRBUF_SIZE, msg_txt, args);
+  }
+  va_end(args_copy);
+
+  SUN_ATOMIC_STORE(&async->head, head + 1);
+
+  return SUN_SUCCESS;
+}
+
+/* Wait until the writer has written all queued messages */
+static void sunLoggerDrain(SUNLogger logger)
+{
+  struct sunLoggerAsync_* async = logger->async;
+  unsigned long head            = async->head;
+
+  pthread_mutex_lock(&async->lock);
+  while (SUN_ATOMIC_LOAD(&async->tail) != head ||
+         SUN_ATOMIC_LOAD(&async->ndropped) != async->nreported)
+  {
+    pthread_cond_signal(&async->work_cond);
+    pthread_cond_wait(&async->done_cond, &async->lock);
+  }
+  pthread_mutex_unlock(&async->lock);
+}
+
+/* Stop the writer thread and free the asynchronous logging data */
+static void sunLoggerFreeAsync(SUNLogger logger)
+{
+  struct sunLoggerAsync_* async = logger->async;
+
+  if (!async) { return; }
+
+  pthread_mutex_lock(&async->lock);
+  SUN_ATOMIC_STORE(&async->stop, 1);
+  pthread_cond_signal(&async->work_cond);
+  pthread_mutex_unlock(&async->lock);
+  pthread_join(async->writer, NULL);
+
+  pthread_mutex_destroy(&async->lock);
+  pthread_cond_destroy(&async->work_cond);
+  pthread_cond_destroy(&async->done_cond);
+  free(async->records);
+  free(async->txt);
+  free(async->msg);
+  free(async);
+  logger->async = NULL;
+}
+
+#endif
+
 static void sunCloseLogFile(void* fp)
 {
   if (fp && fp != stdout && fp != stderr) { fclose((FILE*)fp); }
@@ -125,12 +986,9 @@ static sunbooleantype sunLoggerIsOutputRank(SUNDIALS_MAYBE_UNUSED SUNLogger logg
   return retval;
 }
 
-static SUNErrCode sunLoggerFreeKeyValue(SUNHashMapKeyValue* kv_ptr)
+static SUNErrCode sunLoggerFreeFile(void* fp)
 {
-  if (!kv_ptr || !(*kv_ptr)) { return SUN_SUCCESS; }
-  sunCloseLogFile((*kv_ptr)->value);
-  free((*kv_ptr)->key);
-  free(*kv_ptr);
+  sunCloseLogFile(fp);
   return SUN_SUCCESS;
 }
 
@@ -155,6 +1013,8 @@ SUNErrCode SUNLogger_Create(SUNComm comm, int output_rank, SUNLogger* logger_ptr
 #endif
   logger->output_rank = output_rank;
   logger->content     = NULL;
+  logger->async       = NULL;
+  logger->binary      = NULL;
 
   /* use default routines */
   logger->queuemsg = NULL;
@@ -172,7 +1032,7 @@ SUNErrCode SUNLogger_Create(SUNComm comm, int output_rank, SUNLogger* logger_ptr
     /* We store the FILE* in a hash map so that we can ensure
        that we do not open a file twice if the same file is used
        for multiple output levels */
-    SUNHashMap_New(SUN_DEFAULT_LOGFILE_HANDLES_, sunLoggerFreeKeyValue,
+    SUNHashMap_New(SUN_DEFAULT_LOGFILE_HANDLES_, sunLoggerFreeFile,
                    &logger->filenames);
   }
 
@@ -190,6 +1050,9 @@ SUNErrCode SUNLogger_CreateFromEnv(SUNComm comm, SUNLogger* logger_out)
   const char* warning_fname_env = getenv("SUNLOGGER_WARNING_FILENAME");
   const char* info_fname_env    = getenv("SUNLOGGER_INFO_FILENAME");
   const char* debug_fname_env   = getenv("SUNLOGGER_DEBUG_FILENAME");
+  const char* async_size_env    = getenv("SUNLOGGER_ASYNC_SIZE");
+  const char* async_policy_env  = getenv("SUNLOGGER_ASYNC_POLICY");
+  const char* format_env        = getenv("SUNLOGGER_FORMAT");
 
   if (SUNLogger_Create(comm, output_rank, &logger))
   {
@@ -205,6 +1068,23 @@ SUNErrCode SUNLogger_CreateFromEnv(SUNComm comm, SUNLogger* logger_out)
     err = SUNLogger_SetDebugFilename(logger, debug_fname_env);
     if (err) { break; }
     err = SUNLogger_SetInfoFilename(logger, info_fname_env);
+    if (err) { break; }
+    if (format_env && !strcmp(format_env, "binary"))
+    {
+      err = SUNLogger_SetFormat(logger, SUN_LOGFORMAT_BINARY);
+      if (err) { break; }
+    }
+    if (async_size_env && atoi(async_size_env) > 0)
+    {
+      SUNLogOverflowPolicy policy = SUN_LOGOVERFLOW_BLOCK;
+      if (async_policy_env && !strcmp(async_policy_env, "drop"))
+      {
+        policy = SUN_LOGOVERFLOW_DROP;
+      }
+      /* fall back to synchronous logging if it is not available */
+      err = SUNLogger_EnableAsync(logger, atoi(async_size_env), policy);
+      if (err == SUN_ERR_NOT_IMPLEMENTED) { err = SUN_SUCCESS; }
+    }
   }
   while (0);
 
@@ -356,6 +1236,25 @@ SUNErrCode SUNLogger_QueueMsg(SUNLogger logger, SUNLogLevel lvl,
       retval = logger->queuemsg(logger, lvl, scope, label, msg_txt, args);
       va_end(args);
     }
+#ifdef SUN_LOGGER_ASYNC_ENABLED
+    else if (logger->async)
+    {
+      va_list args;
+      va_start(args, msg_txt);
+      retval = sunLoggerPushMsg(logger, lvl, scope, label, msg_txt, args);
+      va_end(args);
+    }
+#endif
+    else if (logger->binary)
+    {
+      if (sunLoggerIsOutputRank(logger, NULL))
+      {
+        va_list args;
+        va_start(args, msg_txt);
+        sunLoggerWriteBinaryMsg(logger, lvl, scope, label, msg_txt, args);
+        va_end(args);
+      }
+    }
     else
     {
       /* Default implementation */
@@ -415,6 +1314,10 @@ SUNErrCode SUNLogger_Flush(SUNLogger logger, SUNLogLevel lvl)
   }
 
 #if SUNDIALS_LOGGING_LEVEL > 0
+#ifdef SUN_LOGGER_ASYNC_ENABLED
+  /* Write any queued messages before flushing the files */
+  if (logger->async) { sunLoggerDrain(logger); }
+#endif
   if (logger->flush) { retval = logger->flush(logger, lvl); }
   else
   {
@@ -453,6 +1356,116 @@ SUNErrCode SUNLogger_Flush(SUNLogger logger, SUNLogLevel lvl)
   return retval;
 }
 
+SUNErrCode SUNLogger_EnableAsync(SUNLogger logger, int buffer_size,
+                                 SUNLogOverflowPolicy policy)
+{
+  if (!logger) { return SUN_ERR_ARG_CORRUPT; }
+
+#ifdef SUN_LOGGER_ASYNC_ENABLED
+  struct sunLoggerAsync_* async = NULL;
+  unsigned long capacity        = 1;
+  int rank                      = 0;
+
+  /* only the default implementation supports asynchronous output */
+  if (logger->queuemsg || logger->flush || logger->destroy)
+  {
+    return SUN_ERR_ARG_INCOMPATIBLE;
+  }
+  if (policy != SUN_LOGOVERFLOW_BLOCK && policy != SUN_LOGOVERFLOW_DROP)
+  {
+    return SUN_ERR_ARG_OUTOFRANGE;
+  }
+
+  /* already enabled or nothing is output on this rank */
+  if (logger->async || !sunLoggerIsOutputRank(logger, &rank))
+  {
+    return SUN_SUCCESS;
+  }
+
+  /* the buffer size is rounded up to a power of two */
+  if (buffer_size <= 0) { buffer_size = SUN_LOGGER_DEFAULT_SIZE; }
+  while (capacity < (unsigned long)buffer_size) { capacity *= 2; }
+
+  async = (struct sunLoggerAsync_*)calloc(1, sizeof(*async));
+  if (!async) { return SUN_ERR_MALLOC_FAIL; }
+
+  async->records = (sunLogRecord*)malloc(capacity * sizeof(sunLogRecord));
+  if (!async->records)
+  {
+    free(async);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+  async->capacity = capacity;
+  async->policy   = policy;
+  async->rank     = rank;
+
+  pthread_mutex_init(&async->lock, NULL);
+  pthread_cond_init(&async->work_cond, NULL);
+  pthread_cond_init(&async->done_cond, NULL);
+
+  logger->async = async;
+  if (pthread_create(&async->writer, NULL, sunLoggerWriter, (void*)logger))
+  {
+    logger->async = NULL;
+    pthread_mutex_destroy(&async->lock);
+    pthread_cond_destroy(&async->work_cond);
+    pthread_cond_destroy(&async->done_cond);
+    free(async->records);
+    free(async);
+    return SUN_ERR_EXT_FAIL;
+  }
+
+  return SUN_SUCCESS;
+#else
+  ((void)buffer_size);
+  ((void)policy);
+  return SUN_ERR_NOT_IMPLEMENTED;
+#endif
+}
+
+SUNErrCode SUNLogger_GetNumDroppedMsgs(SUNLogger logger, long int* ndropped)
+{
+  if (!logger || !ndropped) { return SUN_ERR_ARG_CORRUPT; }
+
+  *ndropped = 0;
+#ifdef SUN_LOGGER_ASYNC_ENABLED
+  if (logger->async) { *ndropped = logger->async->ndropped; }
+#endif
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNLogger_SetFormat(SUNLogger logger, SUNLogFormat format)
+{
+  if (!logger) { return SUN_ERR_ARG_CORRUPT; }
+
+  if (format != SUN_LOGFORMAT_TEXT && format != SUN_LOGFORMAT_BINARY)
+  {
+    return SUN_ERR_ARG_OUTOFRANGE;
+  }
+
+#if SUNDIALS_LOGGING_LEVEL > 0
+  /* only the default implementation supports binary output and the format
+     must be set before the writer thread is started */
+  if (logger->queuemsg || logger->flush || logger->destroy || logger->async)
+  {
+    return SUN_ERR_ARG_INCOMPATIBLE;
+  }
+
+  if (format == SUN_LOGFORMAT_TEXT) { sunLoggerFreeBinary(logger); }
+  else if (!logger->binary)
+  {
+    struct sunLoggerBinary_* binary =
+      (struct sunLoggerBinary_*)calloc(1, sizeof(*binary));
+    if (!binary) { return SUN_ERR_MALLOC_FAIL; }
+    sunLoggerIsOutputRank(logger, &binary->rank);
+    logger->binary = binary;
+  }
+#endif
+
+  return SUN_SUCCESS;
+}
+
 SUNErrCode SUNLogger_GetOutputRank(SUNLogger logger, int* output_rank)
 {
   if (!logger) { return SUN_ERR_ARG_CORRUPT; }
@@ -474,6 +1487,14 @@ SUNErrCode SUNLogger_Destroy(SUNLogger* logger_ptr)
   {
     /* Default implementation */
 
+#ifdef SUN_LOGGER_ASYNC_ENABLED
+    /* Write any queued messages and stop the writer thread */
+    sunLoggerFreeAsync(logger);
+#endif
+#if SUNDIALS_LOGGING_LEVEL > 0
+    sunLoggerFreeBinary(logger);
+#endif
+
     if (sunLoggerIsOutputRank(logger, NULL))
     {
       SUNHashMap_Destroy(&logger->filenames);
@@ -484,7 +1505,7 @@ SUNErrCode SUNLogger_Destroy(SUNLogger* logger_ptr)
 #endif
 
     free(logger);
-    logger = NULL;
+    *logger_ptr = NULL;
   }
 
   return retval;
@@ -99,12 +99,17 @@
     }                                                                   \
   }                                                                     \
   while (0)
-#define SUNLogExtraDebugVec(logger, label, vec, /*msg_txt, */...)   \
-  do {                                                              \
-    SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_DEBUG, __func__, label, \
-                       /* msg_txt, */ __VA_ARGS__);                 \
-    N_VPrintFile(vec, logger->debug_fp);                            \
-  }                                                                 \
+/* vectors are printed as text and are skipped when using the binary format */
+#define SUNLogExtraDebugVec(logger, label, vec, /*msg_txt, */...)    \
+  do {                                                               \
+    SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_DEBUG, __func__, label,  \
+                       /* msg_txt, */ __VA_ARGS__);                  \
+    if (!(logger)->binary)                                           \
+    {                                                                \
+      SUNLogger_Flush(logger, SUN_LOGLEVEL_DEBUG);                   \
+      N_VPrintFile(vec, (logger)->debug_fp);                         \
+    }                                                                \
+  }                                                                  \
   while (0)
 #define SUNLogExtraDebugVecIf(condition, logger, label, vec, /* msg_txt, */...) \
   do {                                                                          \
@@ -112,7 +117,11 @@
     {                                                                           \
       SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_DEBUG, __func__, label,           \
                          /* msg_txt, */ __VA_ARGS__);                           \
-      N_VPrintFile(vec, logger->debug_fp);                                      \
+      if (!(logger)->binary)                                                    \
+      {                                                                         \
+        SUNLogger_Flush(logger, SUN_LOGLEVEL_DEBUG);                            \
+        N_VPrintFile(vec, (logger)->debug_fp);                                  \
+      }                                                                         \
     }                                                                           \
   }                                                                             \
   while (0)
@@ -122,7 +131,11 @@
     {                                                                          \
       SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_DEBUG, __func__, label, msg_txt, \
                          vi);                                                  \
-      N_VPrintFile(vecs[vi], logger->debug_fp);                                \
+      if (!(logger)->binary)                                                   \
+      {                                                                        \
+        SUNLogger_Flush(logger, SUN_LOGLEVEL_DEBUG);                           \
+        N_VPrintFile(vecs[vi], (logger)->debug_fp);                            \
+      }                                                                        \
     }                                                                          \
   }                                                                            \
   while (0)
@@ -155,6 +168,12 @@ struct SUNLogger_
   /* Content for custom implementations */
   void* content;
 
+  /* Asynchronous output data (NULL when messages are written synchronously) */
+  struct sunLoggerAsync_* async;
+
+  /* Binary output data (NULL when messages are written as text) */
+  struct sunLoggerBinary_* binary;
+
   /* Overridable operations */
   SUNErrCode (*queuemsg)(SUNLogger logger, SUNLogLevel lvl, const char* scope,
                          const char* label, const char* msg_txt, va_list args);
@@ -0,0 +1,163 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Mixed sum and max all-reduce shared by the MPI vectors.
+ * -----------------------------------------------------------------*/
+
+#include <mpi.h>
+#include <stdlib.h>
+
+#include <sundials/priv/sundials_context_impl.h>
+#include <sundials/priv/sundials_mpi_errors_impl.h>
+#include <sundials/priv/sundials_mpi_reduce_impl.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_mpi_types.h>
+
+#include "sundials_macros.h"
+
+/* Sums the first buf[0] values after the count and takes the maximum of the
+   rest, for each element of a contiguous type */
+static void sunSumMaxOp(void* in, void* inout, int* len, MPI_Datatype* dtype)
+{
+  int i, j, n, nsum, size;
+  sunrealtype* a = (sunrealtype*)in;
+  sunrealtype* b = (sunrealtype*)inout;
+
+  MPI_Type_size(*dtype, &size);
+  n = size / (int)sizeof(sunrealtype);
+
+  for (i = 0; i < *len; i++)
+  {
+    nsum = (int)b[0];
+    for (j = 1; j <= nsum; j++) { b[j] += a[j]; }
+    for (j = nsum + 1; j < n; j++) { b[j] = SUNMAX(a[j], b[j]); }
+    a += n;
+    b += n;
+  }
+}
+
+/* Makes sure the operation, a datatype of len values, and a buffer of len
+   values exist. Objects that could not be created are left unset so the
+   next call tries again. */
+static int sunMPIReduce_Setup(SUNMPIReduce reduce, int len)
+{
+  int retval = MPI_SUCCESS;
+
+  if (reduce->op == MPI_OP_NULL)
+  {
+    retval = MPI_Op_create(sunSumMaxOp, 1, &reduce->op);
+    if (retval != MPI_SUCCESS)
+    {
+      reduce->op = MPI_OP_NULL;
+      return retval;
+    }
+  }
+
+  if (reduce->dtype_len != len)
+  {
+    if (reduce->dtype != MPI_DATATYPE_NULL) { MPI_Type_free(&reduce->dtype); }
+    reduce->dtype     = MPI_DATATYPE_NULL;
+    reduce->dtype_len = 0;
+
+    retval = MPI_Type_contiguous(len, MPI_SUNREALTYPE, &reduce->dtype);
+    if (retval == MPI_SUCCESS) { retval = MPI_Type_commit(&reduce->dtype); }
+    if (retval != MPI_SUCCESS)
+    {
+      if (reduce->dtype != MPI_DATATYPE_NULL) { MPI_Type_free(&reduce->dtype); }
+      reduce->dtype = MPI_DATATYPE_NULL;
+      return retval;
+    }
+    reduce->dtype_len = len;
+  }
+
+  return MPI_SUCCESS;
+}
+
+SUNErrCode SUNMPIAllReduceSumMax(SUNContext sunctx, MPI_Comm comm, int nsum,
+                                 int nmax, sunrealtype* vals)
+{
+  SUNFunctionBegin(sunctx);
+
+  int i;
+  SUNMPIReduce reduce = NULL;
+
+  SUNAssert(nsum >= 0 && nmax >= 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  if (nsum + nmax == 0) { return SUN_SUCCESS; }
+
+  /* a single kind of reduction uses the predefined operations */
+  if (nsum == 0 || nmax == 0)
+  {
+    SUNCheckMPICall(MPI_Allreduce(MPI_IN_PLACE, vals, nsum + nmax,
+                                  MPI_SUNREALTYPE,
+                                  (nmax == 0) ? MPI_SUM : MPI_MAX, comm));
+    return SUN_SUCCESS;
+  }
+
+  if (sunctx->mpi_reduce == NULL)
+  {
+    reduce = (SUNMPIReduce)malloc(sizeof(*reduce));
+    SUNAssert(reduce, SUN_ERR_MALLOC_FAIL);
+    reduce->op         = MPI_OP_NULL;
+    reduce->dtype      = MPI_DATATYPE_NULL;
+    reduce->dtype_len  = 0;
+    reduce->buf        = NULL;
+    reduce->buf_len    = 0;
+    sunctx->mpi_reduce = reduce;
+  }
+  reduce = sunctx->mpi_reduce;
+
+  if (reduce->buf_len < nsum + nmax + 1)
+  {
+    sunrealtype* buf =
+      (sunrealtype*)realloc(reduce->buf,
+                            (nsum + nmax + 1) * sizeof(sunrealtype));
+    SUNAssert(buf, SUN_ERR_MALLOC_FAIL);
+    reduce->buf     = buf;
+    reduce->buf_len = nsum + nmax + 1;
+  }
+
+  SUNCheckMPICall(sunMPIReduce_Setup(reduce, nsum + nmax + 1));
+
+  /* the number of sums is prepended to the values and the buffer is reduced
+     as one element of a contiguous type, so it is never split */
+  reduce->buf[0] = (sunrealtype)nsum;
+  for (i = 0; i < nsum + nmax; i++) { reduce->buf[i + 1] = vals[i]; }
+
+  SUNCheckMPICall(MPI_Allreduce(MPI_IN_PLACE, reduce->buf, 1, reduce->dtype,
+                                reduce->op, comm));
+
+  for (i = 0; i < nsum + nmax; i++) { vals[i] = reduce->buf[i + 1]; }
+
+  return SUN_SUCCESS;
+}
+
+void SUNMPIReduce_Destroy(SUNMPIReduce* reduce)
+{
+  int finalized = 0;
+
+  if (reduce == NULL || *reduce == NULL) { return; }
+
+  /* MPI objects can not be freed once MPI has been finalized */
+  MPI_Finalized(&finalized);
+  if (!finalized)
+  {
+    if ((*reduce)->op != MPI_OP_NULL) { MPI_Op_free(&(*reduce)->op); }
+    if ((*reduce)->dtype != MPI_DATATYPE_NULL)
+    {
+      MPI_Type_free(&(*reduce)->dtype);
+    }
+  }
+
+  free((*reduce)->buf);
+  free(*reduce);
+  *reduce = NULL;
+}
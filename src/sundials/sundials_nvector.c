@@ -27,6 +27,7 @@
 #include "sundials/priv/sundials_errors_impl.h"
 #include "sundials/sundials_errors.h"
 #include "sundials/sundials_types.h"
+#include "sundials_nvector_pool.h"
 
 #if defined(SUNDIALS_BUILD_WITH_PROFILING)
 static inline SUNProfiler getSUNProfiler(N_Vector v)
@@ -110,6 +111,9 @@ N_Vector N_VNewEmpty(SUNContext sunctx)
   ops->nvscaleaddmulti     = NULL;
   ops->nvdotprodmulti      = NULL;
 
+  ops->nvlinearcombinationwrmsnorm = NULL;
+  ops->nvlinearcombinationmulti    = NULL;
+
   /* vector array operations (optional) */
   ops->nvlinearsumvectorarray         = NULL;
   ops->nvscalevectorarray             = NULL;
@@ -136,9 +140,14 @@ N_Vector N_VNewEmpty(SUNContext sunctx)
   ops->nvwsqrsumlocal     = NULL;
   ops->nvwsqrsummasklocal = NULL;
 
+  ops->nvlinearcombinationwsqrsumlocal = NULL;
+
   /* single buffer reduction operations */
   ops->nvdotprodmultilocal     = NULL;
   ops->nvdotprodmultiallreduce = NULL;
+  ops->nvsummaxmultiallreduce  = NULL;
+  ops->nvdotprodmultiallreducebegin = NULL;
+  ops->nvdotprodmultiallreduceend   = NULL;
 
   /* XBraid interface operations */
   ops->nvbufsize   = NULL;
@@ -152,9 +161,10 @@ N_Vector N_VNewEmpty(SUNContext sunctx)
   /* attach ops */
   v->ops = ops;
 
-  /* initialize content and sunctx to NULL */
+  /* initialize content to NULL and attach sunctx */
   v->content = NULL;
   v->sunctx  = sunctx;
+  v->pooled  = SUNFALSE;
 
   return v;
 }
@@ -234,6 +244,9 @@ SUNErrCode N_VCopyOps(N_Vector w, N_Vector v)
   v->ops->nvscaleaddmulti     = w->ops->nvscaleaddmulti;
   v->ops->nvdotprodmulti      = w->ops->nvdotprodmulti;
 
+  v->ops->nvlinearcombinationwrmsnorm = w->ops->nvlinearcombinationwrmsnorm;
+  v->ops->nvlinearcombinationmulti    = w->ops->nvlinearcombinationmulti;
+
   /* vector array operations */
   v->ops->nvlinearsumvectorarray     = w->ops->nvlinearsumvectorarray;
   v->ops->nvscalevectorarray         = w->ops->nvscalevectorarray;
@@ -258,9 +271,15 @@ SUNErrCode N_VCopyOps(N_Vector w, N_Vector v)
   v->ops->nvwsqrsumlocal     = w->ops->nvwsqrsumlocal;
   v->ops->nvwsqrsummasklocal = w->ops->nvwsqrsummasklocal;
 
+  v->ops->nvlinearcombinationwsqrsumlocal =
+    w->ops->nvlinearcombinationwsqrsumlocal;
+
   /* single buffer reduction operations */
   v->ops->nvdotprodmultilocal     = w->ops->nvdotprodmultilocal;
   v->ops->nvdotprodmultiallreduce = w->ops->nvdotprodmultiallreduce;
+  v->ops->nvsummaxmultiallreduce  = w->ops->nvsummaxmultiallreduce;
+  v->ops->nvdotprodmultiallreducebegin = w->ops->nvdotprodmultiallreducebegin;
+  v->ops->nvdotprodmultiallreduceend   = w->ops->nvdotprodmultiallreduceend;
 
   /* XBraid interface operations */
   v->ops->nvbufsize   = w->ops->nvbufsize;
@@ -284,7 +303,13 @@ N_Vector N_VClone(N_Vector w)
 {
   N_Vector result = NULL;
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(w));
-  result = w->ops->nvclone(w);
+  SUNVectorPool pool = w->sunctx ? w->sunctx->vector_pool : NULL;
+  if (pool) { result = SUNVectorPool_Checkout(pool, w); }
+  if (!result)
+  {
+    result = w->ops->nvclone(w);
+    if (result && pool) { SUNVectorPool_Track(pool, w, result); }
+  }
   if (result) { result->sunctx = w->sunctx; }
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(w));
   return result;
@@ -304,6 +329,13 @@ void N_VDestroy(N_Vector v)
 {
   if (v == NULL) { return; }
 
+  /* hand clones back to the context vector pool if it will take them */
+  if (v->pooled && v->sunctx && v->sunctx->vector_pool &&
+      SUNVectorPool_Return(v->sunctx->vector_pool, v))
+  {
+    return;
+  }
+
   /* if the destroy operation exists use it */
   if (v->ops->nvdestroy) { v->ops->nvdestroy(v); }
   else
@@ -615,6 +647,53 @@ SUNErrCode N_VDotProdMulti(int nvec, N_Vector x, N_Vector* Y,
   return (ier);
 }
 
+SUNErrCode N_VLinearCombinationWrmsNorm(int nvec, sunrealtype* c, N_Vector* X,
+                                        N_Vector z, N_Vector w,
+                                        sunrealtype* nrm)
+{
+  SUNErrCode ier;
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(z));
+
+  if (z->ops->nvlinearcombinationwrmsnorm != NULL)
+  {
+    ier = z->ops->nvlinearcombinationwrmsnorm(nvec, c, X, z, w, nrm);
+  }
+  else
+  {
+    ier = N_VLinearCombination(nvec, c, X, z);
+    if (ier == SUN_SUCCESS) { *nrm = z->ops->nvwrmsnorm(z, w); }
+  }
+
+  SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(z));
+  return (ier);
+}
+
+SUNErrCode N_VLinearCombinationMulti(int nvec, int nsum, sunrealtype* c,
+                                     N_Vector* X, N_Vector* Z)
+{
+  int j;
+  SUNErrCode ier;
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(Z[0]));
+
+  if (Z[0]->ops->nvlinearcombinationmulti != NULL)
+  {
+    ier = Z[0]->ops->nvlinearcombinationmulti(nvec, nsum, c, X, Z);
+  }
+  else
+  {
+    ier = SUN_SUCCESS;
+    for (j = 0; j < nsum && ier == SUN_SUCCESS; j++)
+    {
+      ier = N_VLinearCombination(nvec, c + j * nvec, X, Z[j]);
+    }
+  }
+
+  SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(Z[0]));
+  return (ier);
+}
+
 /* -----------------------------------------------------------------
  * OPTIONAL vector array operations
  * -----------------------------------------------------------------*/
@@ -912,6 +991,33 @@ sunrealtype N_VMinQuotientLocal(N_Vector num, N_Vector denom)
   return (result);
 }
 
+SUNErrCode N_VLinearCombinationWSqrSumLocal(int nvec, sunrealtype* c,
+                                            N_Vector* X, N_Vector z, N_Vector w,
+                                            sunrealtype* sum)
+{
+  SUNFunctionBegin(z->sunctx);
+  SUNErrCode ier = SUN_SUCCESS;
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(z));
+
+  SUNAssert(z->ops->nvlinearcombinationwsqrsumlocal || z->ops->nvwsqrsumlocal,
+            SUN_ERR_NOT_IMPLEMENTED);
+
+  if (z->ops->nvlinearcombinationwsqrsumlocal)
+  {
+    ier = z->ops->nvlinearcombinationwsqrsumlocal(nvec, c, X, z, w, sum);
+  }
+  else if (z->ops->nvwsqrsumlocal)
+  {
+    ier = N_VLinearCombination(nvec, c, X, z);
+    if (ier == SUN_SUCCESS) { *sum = z->ops->nvwsqrsumlocal(z, w); }
+  }
+
+  SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(z));
+
+  return ier;
+}
+
 /* -------------------------------------------
  * OPTIONAL single buffer reduction operations
  * -------------------------------------------*/
@@ -957,6 +1063,41 @@ SUNErrCode N_VDotProdMultiAllReduce(int nvec, N_Vector x, sunrealtype* sum)
   return ier;
 }
 
+SUNErrCode N_VSumMaxMultiAllReduce(int nsum, int nmax, N_Vector x,
+                                   sunrealtype* vals)
+{
+  SUNFunctionBegin(x->sunctx);
+  SUNErrCode ier = SUN_SUCCESS;
+  SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
+  SUNAssert(x->ops->nvsummaxmultiallreduce, SUN_ERR_NOT_IMPLEMENTED);
+  ier = x->ops->nvsummaxmultiallreduce(nsum, nmax, x, vals);
+  SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  return ier;
+}
+
+SUNErrCode N_VDotProdMultiAllReduceBegin(int nvec, N_Vector x, sunrealtype* sum,
+                                         void** request)
+{
+  SUNFunctionBegin(x->sunctx);
+  SUNErrCode ier = SUN_SUCCESS;
+  SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
+  SUNAssert(x->ops->nvdotprodmultiallreducebegin, SUN_ERR_NOT_IMPLEMENTED);
+  ier = x->ops->nvdotprodmultiallreducebegin(nvec, x, sum, request);
+  SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  return ier;
+}
+
+SUNErrCode N_VDotProdMultiAllReduceEnd(N_Vector x, void* request)
+{
+  SUNFunctionBegin(x->sunctx);
+  SUNErrCode ier = SUN_SUCCESS;
+  SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(x));
+  SUNAssert(x->ops->nvdotprodmultiallreduceend, SUN_ERR_NOT_IMPLEMENTED);
+  ier = x->ops->nvdotprodmultiallreduceend(x, request);
+  SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(x));
+  return ier;
+}
+
 /* ------------------------------------
  * OPTIONAL XBraid interface operations
  * ------------------------------------*/
@@ -0,0 +1,149 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Implementation of the SUNContext vector pool.
+ * -----------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "sundials_nvector_pool.h"
+
+/* Only vectors whose content is fully described by their operations, length,
+   and communicator can be swapped for one another. The OpenMP and Pthreads
+   vectors also carry a thread count (and the Pthreads vectors a shared thread
+   pool) that a clone inherits from its template, so they are not pooled. */
+static sunbooleantype sunIsPoolable(N_Vector w)
+{
+  if (!w->ops || !w->ops->nvgetvectorid) { return SUNFALSE; }
+  switch (w->ops->nvgetvectorid(w))
+  {
+  case SUNDIALS_NVEC_SERIAL:
+  case SUNDIALS_NVEC_PARALLEL: return SUNTRUE;
+  default: return SUNFALSE;
+  }
+}
+
+static sunbooleantype sunSameTemplate(N_Vector w, N_Vector v)
+{
+  /* the operations include the vector ID and any enabled fused operations */
+  if (memcmp(w->ops, v->ops, sizeof(*w->ops))) { return SUNFALSE; }
+
+  if (w->ops->nvgetlength && w->ops->nvgetlength(w) != v->ops->nvgetlength(v))
+  {
+    return SUNFALSE;
+  }
+
+  if (w->ops->nvgetlocallength &&
+      w->ops->nvgetlocallength(w) != v->ops->nvgetlocallength(v))
+  {
+    return SUNFALSE;
+  }
+
+  if (w->ops->nvgetcommunicator &&
+      w->ops->nvgetcommunicator(w) != v->ops->nvgetcommunicator(v))
+  {
+    return SUNFALSE;
+  }
+
+  return SUNTRUE;
+}
+
+SUNErrCode SUNVectorPool_Create(int max_vectors, SUNVectorPool* pool)
+{
+  *pool = NULL;
+
+  SUNVectorPool new_pool = (SUNVectorPool)malloc(sizeof(*new_pool));
+  if (!new_pool) { return SUN_ERR_MALLOC_FAIL; }
+
+  new_pool->idle = (N_Vector*)malloc(max_vectors * sizeof(N_Vector));
+  if (!new_pool->idle)
+  {
+    free(new_pool);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  new_pool->max_vectors = max_vectors;
+  new_pool->num_idle    = 0;
+  new_pool->num_reused  = 0;
+  new_pool->num_cloned  = 0;
+
+  *pool = new_pool;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNVectorPool_Destroy(SUNVectorPool* pool)
+{
+  if (!pool || !(*pool)) { return SUN_SUCCESS; }
+
+  for (int i = 0; i < (*pool)->num_idle; i++)
+  {
+    (*pool)->idle[i]->ops->nvdestroy((*pool)->idle[i]);
+  }
+
+  free((*pool)->idle);
+  free(*pool);
+  *pool = NULL;
+
+  return SUN_SUCCESS;
+}
+
+N_Vector SUNVectorPool_Checkout(SUNVectorPool pool, N_Vector w)
+{
+  if (!sunIsPoolable(w)) { return NULL; }
+
+  /* search the most recently returned vectors first */
+  for (int i = pool->num_idle - 1; i >= 0; i--)
+  {
+    N_Vector v = pool->idle[i];
+    if (sunSameTemplate(w, v))
+    {
+      memmove(&pool->idle[i], &pool->idle[i + 1],
+              (pool->num_idle - i - 1) * sizeof(N_Vector));
+      pool->num_idle--;
+      pool->num_reused++;
+      return v;
+    }
+  }
+
+  return NULL;
+}
+
+void SUNVectorPool_Track(SUNVectorPool pool, N_Vector w, N_Vector v)
+{
+  if (!sunIsPoolable(w)) { return; }
+  v->pooled = SUNTRUE;
+  pool->num_cloned++;
+}
+
+sunbooleantype SUNVectorPool_Return(SUNVectorPool pool, N_Vector v)
+{
+  /* vectors that allocate their own structure may not initialize pooled, so
+     also check that the vector is of a poolable type */
+  if (!v->pooled || pool->max_vectors == 0 || !sunIsPoolable(v))
+  {
+    return SUNFALSE;
+  }
+
+  /* make room by destroying the vector that has been idle the longest */
+  if (pool->num_idle == pool->max_vectors)
+  {
+    pool->idle[0]->ops->nvdestroy(pool->idle[0]);
+    memmove(&pool->idle[0], &pool->idle[1],
+            (pool->num_idle - 1) * sizeof(N_Vector));
+    pool->num_idle--;
+  }
+
+  pool->idle[pool->num_idle++] = v;
+
+  return SUNTRUE;
+}
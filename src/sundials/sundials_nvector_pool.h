@@ -0,0 +1,56 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * A pool of idle N_Vectors owned by a SUNContext. Vectors created
+ * by N_VClone are returned to the pool by N_VDestroy and handed out
+ * again by N_VClone calls with a matching template.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_NVECTOR_POOL_H
+#define _SUNDIALS_NVECTOR_POOL_H
+
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct SUNVectorPool_* SUNVectorPool;
+
+struct SUNVectorPool_
+{
+  int max_vectors;     /* maximum number of idle vectors kept */
+  int num_idle;        /* number of idle vectors in the pool  */
+  N_Vector* idle;      /* idle vectors, oldest first          */
+  long int num_reused; /* clones served from the pool         */
+  long int num_cloned; /* clones created by the clone op      */
+};
+
+SUNErrCode SUNVectorPool_Create(int max_vectors, SUNVectorPool* pool);
+
+/* Destroys the pool and all idle vectors in it */
+SUNErrCode SUNVectorPool_Destroy(SUNVectorPool* pool);
+
+/* Returns an idle vector matching the template w or NULL if there is none */
+N_Vector SUNVectorPool_Checkout(SUNVectorPool pool, N_Vector w);
+
+/* Marks a new clone of w as eligible to be returned to the pool */
+void SUNVectorPool_Track(SUNVectorPool pool, N_Vector w, N_Vector v);
+
+/* Takes ownership of v if it can be pooled, otherwise returns SUNFALSE */
+sunbooleantype SUNVectorPool_Return(SUNVectorPool pool, N_Vector v);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
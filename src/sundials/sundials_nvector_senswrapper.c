@@ -150,6 +150,7 @@ N_Vector N_VCloneEmpty_SensWrapper(N_Vector w)
   v = NULL;
   v = (N_Vector)malloc(sizeof *v);
   if (v == NULL) { return (NULL); }
+  v->pooled = SUNFALSE;
 
   /* create vector operation structure */
   ops = NULL;
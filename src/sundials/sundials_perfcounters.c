@@ -0,0 +1,143 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Hardware performance counters for the SUNProfiler.
+ * -----------------------------------------------------------------*/
+
+/* syscall is not declared when only _POSIX_C_SOURCE is defined */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <sundials/sundials_config.h>
+#include <sundials/sundials_errors.h>
+
+#include "sundials_macros.h"
+#include "sundials_perfcounters.h"
+
+#if defined(SUNDIALS_HAVE_PERF_EVENTS)
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+struct sunPerfCounters_
+{
+  int fds[SUN_NUM_PERFCOUNTERS]; /* the first counter leads the group */
+};
+
+static int sunPerfEventOpen(uint64_t config, int group_fd)
+{
+  struct perf_event_attr attr;
+
+  memset(&attr, 0, sizeof(attr));
+  attr.size           = sizeof(attr);
+  attr.type           = PERF_TYPE_HARDWARE;
+  attr.config         = config;
+  attr.disabled       = group_fd == -1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv     = 1;
+  attr.read_format    = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                     PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+  /* count the calling thread on any CPU */
+  return (int)syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0);
+}
+
+SUNErrCode sunPerfCounters_Open(sunPerfCounters* pc)
+{
+  static const uint64_t configs[SUN_NUM_PERFCOUNTERS] =
+    {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+     PERF_COUNT_HW_CACHE_MISSES};
+  int i;
+
+  *pc = (sunPerfCounters)malloc(sizeof(struct sunPerfCounters_));
+  if (!(*pc)) { return SUN_ERR_MALLOC_FAIL; }
+
+  for (i = 0; i < SUN_NUM_PERFCOUNTERS; i++)
+  {
+    (*pc)->fds[i] = sunPerfEventOpen(configs[i], i ? (*pc)->fds[0] : -1);
+    if ((*pc)->fds[i] < 0)
+    {
+      /* e.g., no PMU access in a VM or perf_event_paranoid is too high */
+      while (i--) { close((*pc)->fds[i]); }
+      free(*pc);
+      *pc = NULL;
+      return SUN_ERR_EXT_FAIL;
+    }
+  }
+
+  ioctl((*pc)->fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  ioctl((*pc)->fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+
+  return SUN_SUCCESS;
+}
+
+void sunPerfCounters_Close(sunPerfCounters* pc)
+{
+  int i;
+
+  if (!pc || !(*pc)) { return; }
+
+  for (i = 0; i < SUN_NUM_PERFCOUNTERS; i++) { close((*pc)->fds[i]); }
+  free(*pc);
+  *pc = NULL;
+}
+
+SUNErrCode sunPerfCounters_Read(sunPerfCounters pc,
+                                int64_t values[SUN_NUM_PERFCOUNTERS])
+{
+  /* nr, time enabled, time running, then one value per counter */
+  uint64_t data[3 + SUN_NUM_PERFCOUNTERS];
+  double scale = 1.0;
+  int i;
+
+  if (read(pc->fds[0], data, sizeof(data)) != (ssize_t)sizeof(data))
+  {
+    return SUN_ERR_EXT_FAIL;
+  }
+
+  /* scale up if the group was not always on the PMU */
+  if (data[2] > 0 && data[2] < data[1]) { scale = (double)data[1] / data[2]; }
+
+  for (i = 0; i < SUN_NUM_PERFCOUNTERS; i++)
+  {
+    values[i] = (int64_t)(scale * (double)data[3 + i]);
+  }
+
+  return SUN_SUCCESS;
+}
+
+#else
+
+SUNErrCode sunPerfCounters_Open(sunPerfCounters* pc)
+{
+  *pc = NULL;
+  return SUN_ERR_NOT_IMPLEMENTED;
+}
+
+void sunPerfCounters_Close(sunPerfCounters* pc)
+{
+  if (pc) { *pc = NULL; }
+}
+
+SUNErrCode sunPerfCounters_Read(SUNDIALS_MAYBE_UNUSED sunPerfCounters pc,
+                                SUNDIALS_MAYBE_UNUSED int64_t
+                                  values[SUN_NUM_PERFCOUNTERS])
+{
+  return SUN_ERR_NOT_IMPLEMENTED;
+}
+
+#endif
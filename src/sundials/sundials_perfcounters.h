@@ -0,0 +1,51 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Hardware performance counters for the SUNProfiler. On Linux the
+ * counters are read with perf_event_open, elsewhere opening the
+ * counters fails with SUN_ERR_NOT_IMPLEMENTED.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_PERFCOUNTERS_H
+#define _SUNDIALS_PERFCOUNTERS_H
+
+#include <stdint.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Counters read as a group, in this order */
+#define SUN_PERFCOUNTER_CYCLES       0
+#define SUN_PERFCOUNTER_INSTRUCTIONS 1
+#define SUN_PERFCOUNTER_CACHE_MISSES 2
+#define SUN_NUM_PERFCOUNTERS         3
+
+/* Bytes transferred per last level cache miss */
+#define SUN_PERFCOUNTER_LINE_SIZE 64
+
+typedef struct sunPerfCounters_* sunPerfCounters;
+
+/* Open the counters for the calling thread */
+SUNErrCode sunPerfCounters_Open(sunPerfCounters* pc);
+
+void sunPerfCounters_Close(sunPerfCounters* pc);
+
+/* Read the current counter values, scaled for multiplexing */
+SUNErrCode sunPerfCounters_Read(sunPerfCounters pc,
+                                int64_t values[SUN_NUM_PERFCOUNTERS]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -12,7 +12,7 @@
  * SUNDIALS Copyright End
  * -----------------------------------------------------------------*/
 
-#include <limits.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -41,9 +41,16 @@
 #include "sundials_debug.h"
 #include "sundials_hashmap_impl.h"
 #include "sundials_macros.h"
+#include "sundials_perfcounters.h"
 
 #define SUNDIALS_ROOT_TIMER ((const char*)"From profiler epoch")
 
+/* Root region and call tree node */
+#define SUNPROFILER_ROOT 0
+
+/* Size of the pointer-keyed region cache (must be a power of two) */
+#define SUNPROFILER_CACHE_SIZE 256
+
 #if defined(SUNDIALS_HAVE_POSIX_TIMERS)
 typedef struct timespec sunTimespec;
 #else
@@ -54,114 +61,122 @@ typedef struct _sunTimespec
 } sunTimespec;
 #endif
 
-/* Private functions */
-#if SUNDIALS_MPI_ENABLED
-static SUNErrCode sunCollectTimers(SUNProfiler p);
-#endif
-static void sunPrintTimer(SUNHashMapKeyValue kv, FILE* fp, void* pvoid);
-static int sunCompareTimes(const void* l, const void* r);
-static int sunclock_gettime_monotonic(sunTimespec* tp);
-
 /*
-  sunTimerStruct.
-  A private structure holding timing information.
+  sunRegion.
+  A private structure holding the flat (inclusive) timing information for a
+  named region. Handles returned by SUNProfiler_RegisterRegion index into the
+  array of regions.
  */
 
-struct _sunTimerStruct
+typedef struct _sunRegion
 {
-  sunTimespec* tic;
-  sunTimespec* toc;
-  double average;
-  double maximum;
-  double elapsed;
-  long count;
-};
+  char* name;      /* region name                                  */
+  int64_t tic;     /* start time of the outermost open instance    */
+  int64_t elapsed; /* total inclusive time in nanoseconds          */
+  int depth;       /* number of open (nested) instances            */
+  long count;      /* number of times the region was entered       */
+  double average;  /* average time per rank (set by sunCollectTimers) */
+  double maximum;  /* maximum time per rank (set by sunCollectTimers) */
+  int64_t counters[SUN_NUM_PERFCOUNTERS];     /* total counter values  */
+  int64_t counters_tic[SUN_NUM_PERFCOUNTERS]; /* values at region start */
+} sunRegion;
 
-typedef struct _sunTimerStruct sunTimerStruct;
+/*
+  sunNode.
+  A private structure holding the timing information for a region in a specific
+  calling context (i.e., a node in the call tree). Children of a node are stored
+  as a singly linked list.
+ */
 
-static sunTimerStruct* sunTimerStructNew(void)
+typedef struct _sunNode
 {
-  sunTimerStruct* ts = (sunTimerStruct*)malloc(sizeof(sunTimerStruct));
-  ts->tic            = (sunTimespec*)malloc(sizeof(sunTimespec));
-  ts->toc            = (sunTimespec*)malloc(sizeof(sunTimespec));
-  ts->tic->tv_sec    = 0;
-  ts->tic->tv_nsec   = 0;
-  ts->elapsed        = 0.0;
-  ts->average        = 0.0;
-  ts->maximum        = 0.0;
-  ts->count          = 0;
-  return ts;
-}
+  int region;       /* region timed by this node   */
+  int parent;       /* parent node                 */
+  int first_child;  /* first child node (or -1)    */
+  int next_sibling; /* next sibling node (or -1)   */
+  int64_t tic;      /* start time of current entry */
+  int64_t elapsed;  /* total inclusive time        */
+  long count;       /* number of entries           */
+} sunNode;
 
-static void sunTimerStructFree(void* TS)
-{
-  sunTimerStruct* ts = (sunTimerStruct*)TS;
-  if (ts)
-  {
-    if (ts->tic) { free(ts->tic); }
-    if (ts->toc) { free(ts->toc); }
-    free(ts);
-  }
-}
+/*
+  sunTraceEvent.
+  A private structure holding a completed region instance for trace output.
+ */
 
-static SUNErrCode sunProfilerDestroyKeyValue(SUNHashMapKeyValue* kv_ptr)
+typedef struct _sunTraceEvent
 {
-  if (!kv_ptr || !(*kv_ptr)) { return SUN_SUCCESS; }
-  sunTimerStructFree((*kv_ptr)->value);
-  free((*kv_ptr)->key);
-  free(*kv_ptr);
-  return SUN_SUCCESS;
-}
+  int node;      /* call tree node of the event */
+  int64_t start; /* start time since the epoch  */
+  int64_t dur;   /* duration                    */
+} sunTraceEvent;
 
-static void sunStartTiming(sunTimerStruct* entry)
-{
-  sunclock_gettime_monotonic(entry->tic);
-}
+/*
+  sunCacheEntry.
+  Maps the address of a region name string to a region handle so that repeated
+  calls with the same string (e.g., __func__ or a literal) skip the hash map.
+ */
 
-static void sunStopTiming(sunTimerStruct* entry)
+typedef struct _sunCacheEntry
 {
-  long s_difference  = 0;
-  long ns_difference = 0;
-
-  sunclock_gettime_monotonic(entry->toc);
-
-  s_difference  = entry->toc->tv_sec - entry->tic->tv_sec;
-  ns_difference = entry->toc->tv_nsec - entry->tic->tv_nsec;
-  if (ns_difference < 0)
-  {
-    s_difference--;
-    ns_difference = 1000000000 + entry->toc->tv_nsec - entry->tic->tv_nsec;
-  }
+  const char* name;
+  int region;
+} sunCacheEntry;
 
-  entry->elapsed += ((double)s_difference) + ((double)ns_difference) * 1e-9;
-  entry->average = entry->elapsed;
-  entry->maximum = entry->elapsed;
-}
-
-static void sunResetTiming(sunTimerStruct* entry)
-{
-  entry->tic->tv_sec  = 0;
-  entry->tic->tv_nsec = 0;
-  entry->toc->tv_sec  = 0;
-  entry->toc->tv_nsec = 0;
-  entry->elapsed      = 0.0;
-  entry->average      = 0.0;
-  entry->maximum      = 0.0;
-  entry->count        = 0;
-}
+/* Private functions */
+#if SUNDIALS_MPI_ENABLED
+static SUNErrCode sunCollectTimers(SUNProfiler p);
+static int sunCompareNames(const void* l, const void* r);
+#endif
+static void sunPrintTimer(sunRegion* region, FILE* fp, SUNProfiler p);
+static int sunCompareTimes(const void* l, const void* r);
+static int sunclock_gettime_monotonic(sunTimespec* tp);
+static int64_t sunNow(void);
+static SUNErrCode sunAddNode(SUNProfiler p, int parent, int region, int* node);
+static void sunCloseNode(SUNProfiler p, int node, int64_t toc);
+static void sunPrintJSONString(FILE* fp, const char* str);
+static void sunPrintStack(SUNProfiler p, int node, FILE* fp);
+static void sunFlushCounters(SUNProfiler p);
 
 /*
   SUNProfiler.
 
-  This structure holds all of the timers in a map.s
+  This structure holds the named regions, the call tree, and (optionally) a
+  trace of completed region instances.
  */
 
 struct SUNProfiler_
 {
   SUNComm comm;
   char* title;
+
+  /* name to region handle lookup */
   SUNHashMap map;
-  sunTimerStruct* overhead;
+  sunCacheEntry cache[SUNPROFILER_CACHE_SIZE];
+
+  /* regions */
+  sunRegion* regions;
+  int nregions;
+  int max_regions;
+
+  /* call tree */
+  sunNode* nodes;
+  int nnodes;
+  int max_nodes;
+  int current;
+
+  /* trace events */
+  sunbooleantype trace;
+  sunTraceEvent* events;
+  int64_t nevents;
+  int64_t max_events;
+
+  /* hardware counters (NULL if disabled) */
+  sunPerfCounters counters;
+
+  /* profiler epoch and overhead estimate */
+  int64_t epoch;
+  long ncalls;
   double sundials_time;
 };
 
@@ -169,32 +184,28 @@ SUNErrCode SUNProfiler_Create(SUNComm comm, const char* title, SUNProfiler* p)
 {
   SUNProfiler profiler;
   int max_entries;
+  int root;
   char* max_entries_env;
+  char* counters_env;
 
   *p = profiler = (SUNProfiler)malloc(sizeof(struct SUNProfiler_));
 
-  if (profiler == NULL) { return SUN_SUCCESS; }
-
-  profiler->overhead = sunTimerStructNew();
-  if (!profiler->overhead)
-  {
-    free(profiler);
-    *p = profiler = NULL;
-    return SUN_ERR_MALLOC_FAIL;
-  }
+  if (profiler == NULL) { return SUN_ERR_MALLOC_FAIL; }
 
-  sunStartTiming(profiler->overhead);
+  memset(profiler, 0, sizeof(struct SUNProfiler_));
+  profiler->current = SUNPROFILER_ROOT;
+  profiler->epoch   = sunNow();
 
-  /* Check to see if max entries env variable was set, and use if it was. */
-  max_entries     = 2560;
+  /* Check to see if max entries env variable was set, and use if it was. This
+     is now only the initial size of the region storage which grows as needed. */
+  max_entries     = 256;
   max_entries_env = getenv("SUNPROFILER_MAX_ENTRIES");
   if (max_entries_env) { max_entries = atoi(max_entries_env); }
-  if (max_entries <= 0) { max_entries = 2560; }
+  if (max_entries <= 0) { max_entries = 256; }
 
-  /* Create the hashmap used to store the timers */
-  if (SUNHashMap_New(max_entries, sunProfilerDestroyKeyValue, &profiler->map))
+  /* Create the hashmap used to look up regions by name */
+  if (SUNHashMap_New(max_entries, NULL, &profiler->map))
   {
-    sunTimerStructFree((void*)profiler->overhead);
     free(profiler);
     *p = profiler = NULL;
     return SUN_ERR_MALLOC_FAIL;
@@ -207,7 +218,9 @@ SUNErrCode SUNProfiler_Create(SUNComm comm, const char* title, SUNProfiler* p)
 #else
   if (comm != SUN_COMM_NULL)
   {
+    SUNHashMap_Destroy(&profiler->map);
     free(profiler);
+    *p = profiler = NULL;
     return -1;
   }
   profiler->comm = SUN_COMM_NULL;
@@ -218,91 +231,258 @@ SUNErrCode SUNProfiler_Create(SUNComm comm, const char* title, SUNProfiler* p)
   profiler->title = malloc((strlen(title) + 1) * sizeof(char));
   strcpy(profiler->title, title);
 
-  /* Initialize the overall timer to 0. */
-  profiler->sundials_time = 0.0;
-
-  SUNDIALS_MARK_BEGIN(profiler, SUNDIALS_ROOT_TIMER);
-  sunStopTiming(profiler->overhead);
+  /* Create the root region, which is always open, and the root of the call
+     tree */
+  if (SUNProfiler_RegisterRegion(profiler, SUNDIALS_ROOT_TIMER, &root) ||
+      sunAddNode(profiler, -1, root, &root))
+  {
+    SUNProfiler_Free(p);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+  profiler->regions[SUNPROFILER_ROOT].tic   = profiler->epoch;
+  profiler->regions[SUNPROFILER_ROOT].depth = 1;
+  profiler->regions[SUNPROFILER_ROOT].count = 1;
+  profiler->nodes[SUNPROFILER_ROOT].tic     = profiler->epoch;
+  profiler->nodes[SUNPROFILER_ROOT].count   = 1;
+
+  /* Enable tracing if requested */
+  if (getenv("SUNPROFILER_TRACE")) { profiler->trace = SUNTRUE; }
+
+  /* Enable hardware counters if requested and available */
+  counters_env = getenv("SUNPROFILER_COUNTERS");
+  if (counters_env && strcmp(counters_env, "0"))
+  {
+    (void)SUNProfiler_EnableCounters(profiler, SUNTRUE);
+  }
 
   return SUN_SUCCESS;
 }
 
 SUNErrCode SUNProfiler_Free(SUNProfiler* p)
 {
-  if (!p || !(*p)) { return SUN_SUCCESS; }
+  int i;
 
-  SUNDIALS_MARK_END(*p, SUNDIALS_ROOT_TIMER);
+  if (!p || !(*p)) { return SUN_SUCCESS; }
 
-  if (*p)
-  {
-    SUNHashMap_Destroy(&(*p)->map);
-    sunTimerStructFree((void*)(*p)->overhead);
+  sunPerfCounters_Close(&(*p)->counters);
+  SUNHashMap_Destroy(&(*p)->map);
+  for (i = 0; i < (*p)->nregions; i++) { free((*p)->regions[i].name); }
+  free((*p)->regions);
+  free((*p)->nodes);
+  free((*p)->events);
 #if SUNDIALS_MPI_ENABLED
-    if ((*p)->comm != SUN_COMM_NULL) { MPI_Comm_free(&(*p)->comm); }
+  if ((*p)->comm != SUN_COMM_NULL) { MPI_Comm_free(&(*p)->comm); }
 #endif
-    free((*p)->title);
-    free(*p);
-  }
+  free((*p)->title);
+  free(*p);
   *p = NULL;
 
   return SUN_SUCCESS;
 }
 
-SUNErrCode SUNProfiler_Begin(SUNProfiler p, const char* name)
+SUNErrCode SUNProfiler_RegisterRegion(SUNProfiler p, const char* name,
+                                      int* region)
 {
   int64_t ier;
-  sunTimerStruct* timer = NULL;
+  void* value;
+  sunRegion* regions;
+
+  if (!p || !name || !region) { return SUN_ERR_ARG_CORRUPT; }
+
+  /* Return the existing handle if the name was already registered */
+  if (!SUNHashMap_GetValue(p->map, name, &value))
+  {
+    *region = (int)((intptr_t)value - 1);
+    return SUN_SUCCESS;
+  }
+
+  /* Grow the region storage if necessary */
+  if (p->nregions == p->max_regions)
+  {
+    int max_regions = p->max_regions ? 2 * p->max_regions : 64;
+    regions = (sunRegion*)realloc(p->regions, max_regions * sizeof(sunRegion));
+    if (!regions) { return SUN_ERR_MALLOC_FAIL; }
+    p->regions     = regions;
+    p->max_regions = max_regions;
+  }
+
+  /* Handles are stored offset by one since the map does not allow NULL */
+  ier = SUNHashMap_Insert(p->map, name, (void*)((intptr_t)p->nregions + 1));
+  if (ier) { return SUN_ERR_PROFILER_MAPINSERT; }
+
+  regions = &p->regions[p->nregions];
+  memset(regions, 0, sizeof(sunRegion));
+  regions->name = malloc((strlen(name) + 1) * sizeof(char));
+  if (!regions->name) { return SUN_ERR_MALLOC_FAIL; }
+  strcpy(regions->name, name);
+
+  *region = p->nregions++;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNProfiler_BeginRegion(SUNProfiler p, int region)
+{
+  int node;
+  int64_t tic;
+  sunRegion* r;
+
+  if (!p) { return SUN_ERR_ARG_CORRUPT; }
+  if (region <= SUNPROFILER_ROOT || region >= p->nregions)
+  {
+    return SUN_ERR_ARG_OUTOFRANGE;
+  }
+
+  tic = sunNow();
+  p->ncalls++;
+
+  /* Find the node for this region under the current node */
+  for (node = p->nodes[p->current].first_child; node >= 0;
+       node = p->nodes[node].next_sibling)
+  {
+    if (p->nodes[node].region == region) { break; }
+  }
+  if (node < 0)
+  {
+    SUNErrCode err = sunAddNode(p, p->current, region, &node);
+    if (err) { return err; }
+  }
+
+  p->nodes[node].tic = tic;
+  p->nodes[node].count++;
+  p->current = node;
+
+  /* Update the flat timer, only the outermost instance is timed */
+  r = &p->regions[region];
+  if (r->depth++ == 0)
+  {
+    r->tic = tic;
+    if (p->counters) { sunPerfCounters_Read(p->counters, r->counters_tic); }
+  }
+  r->count++;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNProfiler_EndRegion(SUNProfiler p, int region)
+{
+  int node;
+  int64_t toc;
+  sunRegion* r;
 
   if (!p) { return SUN_ERR_ARG_CORRUPT; }
+  if (region <= SUNPROFILER_ROOT || region >= p->nregions)
+  {
+    return SUN_ERR_ARG_OUTOFRANGE;
+  }
 
-  sunStartTiming(p->overhead);
+  toc = sunNow();
+  p->ncalls++;
 
-  if (SUNHashMap_GetValue(p->map, name, (void**)&timer))
+  /* Ending a region that is not open is a no-op */
+  r = &p->regions[region];
+  if (r->depth == 0) { return SUN_SUCCESS; }
+  if (--r->depth == 0)
   {
-    timer = sunTimerStructNew();
-    ier   = SUNHashMap_Insert(p->map, name, (void*)timer);
-    if (ier)
+    r->elapsed += toc - r->tic;
+    if (p->counters)
     {
-      sunTimerStructFree(timer);
-      sunStopTiming(p->overhead);
-      if (ier == SUNHASHMAP_ERROR) { return SUN_ERR_PROFILER_MAPINSERT; }
-      if (ier == SUNHASHMAP_DUPLICATE) { return SUN_ERR_PROFILER_MAPFULL; }
+      int k;
+      int64_t counters[SUN_NUM_PERFCOUNTERS];
+      if (!sunPerfCounters_Read(p->counters, counters))
+      {
+        for (k = 0; k < SUN_NUM_PERFCOUNTERS; k++)
+        {
+          r->counters[k] += counters[k] - r->counters_tic[k];
+        }
+      }
     }
   }
 
-  timer->count++;
-  sunStartTiming(timer);
+  /* Find the innermost open node for this region. With properly nested
+     regions this is the current node. Otherwise, any nodes opened after it
+     are closed too. */
+  for (node = p->current; node != SUNPROFILER_ROOT; node = p->nodes[node].parent)
+  {
+    if (p->nodes[node].region == region) { break; }
+  }
+  if (node == SUNPROFILER_ROOT) { return SUN_SUCCESS; }
+
+  while (p->current != node)
+  {
+    sunCloseNode(p, p->current, toc);
+    p->current = p->nodes[p->current].parent;
+  }
+  sunCloseNode(p, node, toc);
+  p->current = p->nodes[node].parent;
 
-  sunStopTiming(p->overhead);
   return SUN_SUCCESS;
 }
 
-SUNErrCode SUNProfiler_End(SUNProfiler p, const char* name)
+/* Look up the handle for a region name, optionally registering it on first
+   use */
+static SUNErrCode sunGetRegion(SUNProfiler p, const char* name,
+                               sunbooleantype create, int* region)
 {
-  int64_t ier;
-  sunTimerStruct* timer;
+  SUNErrCode err;
+  void* value;
+  sunCacheEntry* entry;
 
-  if (!p) { return SUN_ERR_ARG_CORRUPT; }
+  entry = &p->cache[((uintptr_t)name >> 3) & (SUNPROFILER_CACHE_SIZE - 1)];
 
-  sunStartTiming(p->overhead);
+  /* Check that the cached name matches in case the string was reused */
+  if (entry->name == name && !strcmp(p->regions[entry->region].name, name))
+  {
+    *region = entry->region;
+    return SUN_SUCCESS;
+  }
 
-  ier = SUNHashMap_GetValue(p->map, name, (void**)&timer);
-  if (ier)
+  if (create)
+  {
+    err = SUNProfiler_RegisterRegion(p, name, region);
+    if (err) { return err; }
+  }
+  else
   {
-    sunStopTiming(p->overhead);
-    if (ier == SUNHASHMAP_ERROR) { return SUN_ERR_PROFILER_MAPGET; }
-    if (ier == SUNHASHMAP_KEYNOTFOUND)
+    if (SUNHashMap_GetValue(p->map, name, &value))
     {
       return SUN_ERR_PROFILER_MAPKEYNOTFOUND;
     }
+    *region = (int)((intptr_t)value - 1);
   }
 
-  sunStopTiming(timer);
+  entry->name   = name;
+  entry->region = *region;
 
-  sunStopTiming(p->overhead);
   return SUN_SUCCESS;
 }
 
+SUNErrCode SUNProfiler_Begin(SUNProfiler p, const char* name)
+{
+  int region;
+  SUNErrCode err;
+
+  if (!p || !name) { return SUN_ERR_ARG_CORRUPT; }
+
+  err = sunGetRegion(p, name, SUNTRUE, &region);
+  if (err) { return err; }
+
+  return SUNProfiler_BeginRegion(p, region);
+}
+
+SUNErrCode SUNProfiler_End(SUNProfiler p, const char* name)
+{
+  int region;
+  SUNErrCode err;
+
+  if (!p || !name) { return SUN_ERR_ARG_CORRUPT; }
+
+  err = sunGetRegion(p, name, SUNFALSE, &region);
+  if (err) { return err; }
+
+  return SUNProfiler_EndRegion(p, region);
+}
+
 SUNErrCode SUNProfiler_GetTimerResolution(SUNProfiler p, double* resolution)
 {
   if (!p) { return SUN_ERR_ARG_CORRUPT; }
@@ -333,64 +513,187 @@ SUNErrCode SUNProfiler_GetTimerResolution(SUNProfiler p, double* resolution)
 SUNErrCode SUNProfiler_GetElapsedTime(SUNProfiler p, const char* name,
                                       double* time)
 {
-  sunTimerStruct* timer;
+  int64_t elapsed;
+  void* value;
+  sunRegion* region;
+
+  if (!p) { return SUN_ERR_ARG_CORRUPT; }
+
+  if (SUNHashMap_GetValue(p->map, name, &value)) { return (-1); }
+
+  region = &p->regions[(intptr_t)value - 1];
+
+  /* Include the time so far if the region is open */
+  elapsed = region->elapsed;
+  if (region->depth > 0) { elapsed += sunNow() - region->tic; }
+
+  *time = 1e-9 * (double)elapsed;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNProfiler_GetCounters(SUNProfiler p, const char* name,
+                                   long int* cycles, long int* instructions,
+                                   long int* cache_misses)
+{
+  void* value;
+  sunRegion* region;
+
+  if (!p || !name || !cycles || !instructions || !cache_misses)
+  {
+    return SUN_ERR_ARG_CORRUPT;
+  }
+
+  if (SUNHashMap_GetValue(p->map, name, &value))
+  {
+    return SUN_ERR_PROFILER_MAPKEYNOTFOUND;
+  }
+
+  /* Include the counts so far in open regions */
+  sunFlushCounters(p);
+
+  region        = &p->regions[(intptr_t)value - 1];
+  *cycles       = (long int)region->counters[SUN_PERFCOUNTER_CYCLES];
+  *instructions = (long int)region->counters[SUN_PERFCOUNTER_INSTRUCTIONS];
+  *cache_misses = (long int)region->counters[SUN_PERFCOUNTER_CACHE_MISSES];
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNProfiler_EnableCounters(SUNProfiler p, sunbooleantype onoff)
+{
+  int i;
+  SUNErrCode err;
+  int64_t counters[SUN_NUM_PERFCOUNTERS];
 
   if (!p) { return SUN_ERR_ARG_CORRUPT; }
 
-  if (SUNHashMap_GetValue(p->map, name, (void**)&timer)) { return (-1); }
+  if (!onoff)
+  {
+    sunFlushCounters(p);
+    sunPerfCounters_Close(&p->counters);
+    return SUN_SUCCESS;
+  }
+
+  if (p->counters) { return SUN_SUCCESS; }
+
+  err = sunPerfCounters_Open(&p->counters);
+  if (err) { return err; }
+
+  /* Regions that are already open, including the root, count from now */
+  err = sunPerfCounters_Read(p->counters, counters);
+  if (err)
+  {
+    sunPerfCounters_Close(&p->counters);
+    return err;
+  }
+  for (i = 0; i < p->nregions; i++)
+  {
+    if (p->regions[i].depth > 0)
+    {
+      memcpy(p->regions[i].counters_tic, counters, sizeof(counters));
+    }
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNProfiler_EnableTrace(SUNProfiler p, sunbooleantype onoff)
+{
+  if (!p) { return SUN_ERR_ARG_CORRUPT; }
 
-  *time = timer->elapsed;
+  p->trace = onoff;
 
   return SUN_SUCCESS;
 }
 
 SUNErrCode SUNProfiler_Reset(SUNProfiler p)
 {
+  int i;
+  int64_t now;
+
   if (!p) { return SUN_ERR_ARG_CORRUPT; }
 
-  /* Reset the overhead timer */
-  sunResetTiming(p->overhead);
-  sunStartTiming(p->overhead);
+  now      = sunNow();
+  p->epoch = now;
 
-  /* Reset all timers */
-  for (int64_t i = 0; i < SUNHashMap_Capacity(p->map); i++)
+  /* Reset all timers, restarting any open regions from now */
+  for (i = 0; i < p->nregions; i++)
   {
-    SUNHashMapKeyValue* kvp =
-      SUNStlVector_SUNHashMapKeyValue_At(p->map->buckets, i);
+    p->regions[i].elapsed = 0;
+    p->regions[i].count   = p->regions[i].depth > 0 ? 1 : 0;
+    p->regions[i].average = 0.0;
+    p->regions[i].maximum = 0.0;
+    p->regions[i].tic     = now;
+    memset(p->regions[i].counters, 0, sizeof(p->regions[i].counters));
+  }
+  if (p->counters)
+  {
+    int64_t counters[SUN_NUM_PERFCOUNTERS];
+    if (!sunPerfCounters_Read(p->counters, counters))
+    {
+      for (i = 0; i < p->nregions; i++)
+      {
+        memcpy(p->regions[i].counters_tic, counters, sizeof(counters));
+      }
+    }
+  }
 
-    if (!kvp || !(*kvp)) { continue; }
-    sunTimerStruct* timer = (*kvp)->value;
-    if (timer) { sunResetTiming(timer); }
+  for (i = 0; i < p->nnodes; i++)
+  {
+    p->nodes[i].elapsed = 0;
+    p->nodes[i].count   = 0;
+    p->nodes[i].tic     = now;
   }
+  for (i = p->current; i >= 0; i = p->nodes[i].parent) { p->nodes[i].count = 1; }
+
+  p->nevents = 0;
+  p->ncalls  = 0;
 
   /* Reset the overall timer. */
   p->sundials_time = 0.0;
 
-  SUNDIALS_MARK_BEGIN(p, SUNDIALS_ROOT_TIMER);
-  sunStopTiming(p->overhead);
-
   return SUN_SUCCESS;
 }
 
 SUNErrCode SUNProfiler_Print(SUNProfiler p, FILE* fp)
 {
-  int64_t ier                = 0;
-  int rank                   = 0;
-  sunTimerStruct* timer      = NULL;
-  SUNHashMapKeyValue* sorted = NULL;
+  int i;
+  int rank            = 0;
+  double overhead     = 0.0;
+  sunRegion** sorted  = NULL;
+  sunRegion* root     = NULL;
+  int64_t now         = 0;
+  int64_t clock_start = 0;
 
   if (!p) { return SUN_ERR_ARG_CORRUPT; }
 
-  sunStartTiming(p->overhead);
-
   /* Get the total SUNDIALS time up to this point */
-  SUNDIALS_MARK_END(p, SUNDIALS_ROOT_TIMER);
-  SUNDIALS_MARK_BEGIN(p, SUNDIALS_ROOT_TIMER);
+  now                                = sunNow();
+  root                               = &p->regions[SUNPROFILER_ROOT];
+  root->elapsed                      = now - root->tic;
+  p->nodes[SUNPROFILER_ROOT].elapsed = now - p->nodes[SUNPROFILER_ROOT].tic;
+
+  /* Estimate the profiler overhead from the cost of reading the clock, which
+     dominates the cost of beginning or ending a region */
+  clock_start = sunNow();
+  for (i = 0; i < 100; i++) { (void)sunNow(); }
+  if (p->counters)
+  {
+    /* plus the cost of reading the counters */
+    int64_t counters[SUN_NUM_PERFCOUNTERS];
+    for (i = 0; i < 100; i++) { sunPerfCounters_Read(p->counters, counters); }
+  }
+  overhead = 1e-11 * (double)(sunNow() - clock_start) * (double)p->ncalls;
+
+  sunFlushCounters(p);
 
-  ier = SUNHashMap_GetValue(p->map, SUNDIALS_ROOT_TIMER, (void**)&timer);
-  if (ier == SUNHASHMAP_ERROR) { return SUN_ERR_PROFILER_MAPGET; }
-  if (ier == SUNHASHMAP_KEYNOTFOUND) { return SUN_ERR_PROFILER_MAPKEYNOTFOUND; }
-  p->sundials_time = timer->elapsed;
+  p->sundials_time = 1e-9 * (double)root->elapsed;
+  for (i = 0; i < p->nregions; i++)
+  {
+    p->regions[i].average = 1e-9 * (double)p->regions[i].elapsed;
+    p->regions[i].maximum = p->regions[i].average;
+  }
 
 #if SUNDIALS_MPI_ENABLED
   if (p->comm != SUN_COMM_NULL)
@@ -405,18 +708,31 @@ SUNErrCode SUNProfiler_Print(SUNProfiler p, FILE* fp)
   {
     double resolution;
     /* Sort the timers in descending order */
-    if (SUNHashMap_Sort(p->map, &sorted, sunCompareTimes))
-    {
-      return SUN_ERR_PROFILER_MAPSORT;
-    }
+    sorted = (sunRegion**)malloc(p->nregions * sizeof(sunRegion*));
+    if (!sorted) { return SUN_ERR_PROFILER_MAPSORT; }
+    for (i = 0; i < p->nregions; i++) { sorted[i] = &p->regions[i]; }
+    qsort(sorted, p->nregions, sizeof(sunRegion*), sunCompareTimes);
+
     SUNProfiler_GetTimerResolution(p, &resolution);
     fprintf(fp, "\n============================================================"
                 "====================================================\n");
     fprintf(fp, "SUNDIALS GIT VERSION: %s\n", SUNDIALS_GIT_VERSION);
     fprintf(fp, "SUNDIALS PROFILER: %s\n", p->title);
     fprintf(fp, "TIMER RESOLUTION: %gs\n", resolution);
-    fprintf(fp, "%-40s\t %% time (inclusive) \t max/rank \t average/rank \t count \n",
-            "RESULTS:");
+    if (p->counters)
+    {
+      fprintf(fp,
+              "%-40s\t %% time (inclusive) \t max/rank \t average/rank \t "
+              "count \t IPC \t est. GB/s\n",
+              "RESULTS:");
+    }
+    else
+    {
+      fprintf(fp,
+              "%-40s\t %% time (inclusive) \t max/rank \t average/rank \t "
+              "count \n",
+              "RESULTS:");
+    }
     fprintf(fp, "=============================================================="
                 "==================================================\n");
 
@@ -429,21 +745,17 @@ SUNErrCode SUNProfiler_Print(SUNProfiler p, FILE* fp)
 #endif
 
     /* Print all the other timers out */
-    for (int64_t i = 0; i < SUNHashMap_Capacity(p->map); i++)
+    for (i = 0; i < p->nregions; i++)
     {
-      if (sorted[i]) { sunPrintTimer(sorted[i], fp, (void*)p); }
+      if (sorted[i]->count > 0) { sunPrintTimer(sorted[i], fp, p); }
     }
     free(sorted);
-  }
-
-  sunStopTiming(p->overhead);
 
-  if (rank == 0)
-  {
     /* Print out the total time and the profiler overhead */
     fprintf(fp, "%-40s\t %6.2f%% \t         %.6fs \t -- \t\t -- \n",
-            "Est. profiler overhead", p->overhead->elapsed / p->sundials_time,
-            p->overhead->elapsed);
+            "Est. profiler overhead",
+            p->sundials_time > 0.0 ? overhead / p->sundials_time * 100 : 0.0,
+            overhead);
 
     /* End of output */
     fprintf(fp, "\n");
@@ -452,91 +764,238 @@ SUNErrCode SUNProfiler_Print(SUNProfiler p, FILE* fp)
   return SUN_SUCCESS;
 }
 
+SUNErrCode SUNProfiler_WriteTrace(SUNProfiler p, FILE* fp)
+{
+  int64_t i;
+  int rank = 0;
+
+  if (!p || !fp) { return SUN_ERR_ARG_CORRUPT; }
+
 #if SUNDIALS_MPI_ENABLED
-static void sunTimerStructReduceMaxAndSum(void* a, void* b, int* len,
-                                          SUNDIALS_MAYBE_UNUSED MPI_Datatype* dType)
+  if (p->comm != SUN_COMM_NULL) { MPI_Comm_rank(p->comm, &rank); }
+#endif
+
+  /* Chrome trace event format with one complete ("X") event per region
+     instance, times are in microseconds */
+  fprintf(fp, "{\"traceEvents\":[\n");
+  for (i = 0; i < p->nevents; i++)
+  {
+    sunTraceEvent* event = &p->events[i];
+    fprintf(fp, "%s{\"name\":", i > 0 ? ",\n" : "");
+    sunPrintJSONString(fp, p->regions[p->nodes[event->node].region].name);
+    fprintf(fp,
+            ",\"cat\":\"sundials\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+            "\"pid\":%d,\"tid\":0}",
+            1e-3 * (double)event->start, 1e-3 * (double)event->dur, rank);
+  }
+  fprintf(fp, "\n],\"displayTimeUnit\":\"ms\",\"otherData\":{\"title\":");
+  sunPrintJSONString(fp, p->title);
+  fprintf(fp, "}}\n");
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNProfiler_WriteFlameGraph(SUNProfiler p, FILE* fp)
 {
-  sunTimerStruct* a_ts = (sunTimerStruct*)a;
-  sunTimerStruct* b_ts = (sunTimerStruct*)b;
-  int i;
-  for (i = 0; i < *len; ++i)
+  int i, child;
+  int64_t self;
+
+  if (!p || !fp) { return SUN_ERR_ARG_CORRUPT; }
+
+  /* Collapsed stack format, one line per call path with the exclusive time
+     in microseconds */
+  for (i = 0; i < p->nnodes; i++)
   {
-    b_ts[i].average += a_ts[i].elapsed;
-    b_ts[i].maximum = SUNMAX(a_ts[i].maximum, b_ts[i].maximum);
+    if (i == SUNPROFILER_ROOT || p->nodes[i].count == 0) { continue; }
+
+    self = p->nodes[i].elapsed;
+    for (child = p->nodes[i].first_child; child >= 0;
+         child = p->nodes[child].next_sibling)
+    {
+      self -= p->nodes[child].elapsed;
+    }
+    if (self < 0) { self = 0; }
+
+    sunPrintStack(p, i, fp);
+    fprintf(fp, " %lld\n", (long long)(self / 1000));
   }
+
+  return SUN_SUCCESS;
 }
 
+/* Add a node for region under the parent node */
+static SUNErrCode sunAddNode(SUNProfiler p, int parent, int region, int* node)
+{
+  sunNode* nodes;
+
+  if (p->nnodes == p->max_nodes)
+  {
+    int max_nodes = p->max_nodes ? 2 * p->max_nodes : 64;
+    nodes         = (sunNode*)realloc(p->nodes, max_nodes * sizeof(sunNode));
+    if (!nodes) { return SUN_ERR_MALLOC_FAIL; }
+    p->nodes     = nodes;
+    p->max_nodes = max_nodes;
+  }
+
+  *node = p->nnodes++;
+
+  nodes               = &p->nodes[*node];
+  nodes->region       = region;
+  nodes->parent       = parent;
+  nodes->first_child  = -1;
+  nodes->next_sibling = -1;
+  nodes->tic          = 0;
+  nodes->elapsed      = 0;
+  nodes->count        = 0;
+
+  if (parent >= 0)
+  {
+    nodes->next_sibling         = p->nodes[parent].first_child;
+    p->nodes[parent].first_child = *node;
+  }
+
+  return SUN_SUCCESS;
+}
+
+/* Stop timing a node and record the trace event if tracing */
+static void sunCloseNode(SUNProfiler p, int node, int64_t toc)
+{
+  int64_t dur = toc - p->nodes[node].tic;
+
+  p->nodes[node].elapsed += dur;
+
+  if (!p->trace) { return; }
+
+  if (p->nevents == p->max_events)
+  {
+    int64_t max_events = p->max_events ? 2 * p->max_events : 4096;
+    sunTraceEvent* events =
+      (sunTraceEvent*)realloc(p->events, max_events * sizeof(sunTraceEvent));
+    if (!events)
+    {
+      /* stop tracing rather than fail the timed operation */
+      p->trace = SUNFALSE;
+      return;
+    }
+    p->events     = events;
+    p->max_events = max_events;
+  }
+
+  p->events[p->nevents].node  = node;
+  p->events[p->nevents].start = p->nodes[node].tic - p->epoch;
+  p->events[p->nevents].dur   = dur;
+  p->nevents++;
+}
+
+/* Add the counts so far in open regions to their totals */
+static void sunFlushCounters(SUNProfiler p)
+{
+  int i, k;
+  int64_t counters[SUN_NUM_PERFCOUNTERS];
+
+  if (!p->counters || sunPerfCounters_Read(p->counters, counters)) { return; }
+
+  for (i = 0; i < p->nregions; i++)
+  {
+    if (p->regions[i].depth == 0) { continue; }
+    for (k = 0; k < SUN_NUM_PERFCOUNTERS; k++)
+    {
+      p->regions[i].counters[k] += counters[k] - p->regions[i].counters_tic[k];
+      p->regions[i].counters_tic[k] = counters[k];
+    }
+  }
+}
+
+/* Print the semicolon separated call path to a node (excluding the root) */
+static void sunPrintStack(SUNProfiler p, int node, FILE* fp)
+{
+  int parent = p->nodes[node].parent;
+  if (parent != SUNPROFILER_ROOT)
+  {
+    sunPrintStack(p, parent, fp);
+    fputc(';', fp);
+  }
+  fputs(p->regions[p->nodes[node].region].name, fp);
+}
+
+/* Print a string as a JSON string literal */
+static void sunPrintJSONString(FILE* fp, const char* str)
+{
+  fputc('"', fp);
+  for (; *str; str++)
+  {
+    if (*str == '"' || *str == '\\') { fprintf(fp, "\\%c", *str); }
+    else if ((unsigned char)*str < 0x20) { fprintf(fp, "\\u%04x", *str); }
+    else { fputc(*str, fp); }
+  }
+  fputc('"', fp);
+}
+
+#if SUNDIALS_MPI_ENABLED
 /* Find the max and average time across all ranks */
 SUNErrCode sunCollectTimers(SUNProfiler p)
 {
-  int rank, nranks;
+  int i, rank, nranks, min_regions, max_regions;
+  double* times;
+  sunRegion** sorted;
 
   MPI_Comm comm = p->comm;
   MPI_Comm_rank(comm, &rank);
   MPI_Comm_size(comm, &nranks);
 
-  sunTimerStruct** values = NULL;
+  /* The timers are matched by name so every rank must have the same regions */
+  MPI_Allreduce(&p->nregions, &min_regions, 1, MPI_INT, MPI_MIN, comm);
+  MPI_Allreduce(&p->nregions, &max_regions, 1, MPI_INT, MPI_MAX, comm);
+  if (min_regions != max_regions) { return SUN_ERR_PROFILER_MAPGET; }
 
-  /* MPI restricts us to int, but the hashmap allows int64_t.
-     We add a check here to make sure that the capacity does
-     not exceed an int, although it is unlikely we ever will. */
-  if (SUNHashMap_Capacity(p->map) > INT_MAX)
+  sorted = (sunRegion**)malloc(p->nregions * sizeof(sunRegion*));
+  times  = (double*)malloc(2 * p->nregions * sizeof(double));
+  if (!sorted || !times)
   {
-    return SUN_ERR_PROFILER_MAPFULL;
+    free(sorted);
+    free(times);
+    return SUN_ERR_MALLOC_FAIL;
   }
-  int map_size = (int)SUNHashMap_Capacity(p->map);
-
-  /* Extract the elapsed times from the hash map */
-  SUNHashMap_Values(p->map, (void***)&values, sizeof(sunTimerStruct));
-  sunTimerStruct* reduced =
-    (sunTimerStruct*)malloc(map_size * sizeof(sunTimerStruct));
-  if (!reduced) { return SUN_ERR_MALLOC_FAIL; }
-  for (int i = 0; i < map_size; ++i) { reduced[i] = *values[i]; }
-
-  /* Register MPI datatype for sunTimerStruct */
-  MPI_Datatype tmp_type, MPI_sunTimerStruct;
-  const int block_lens[2]     = {5, 1};
-  const MPI_Datatype types[2] = {MPI_DOUBLE, MPI_LONG};
-  const MPI_Aint displ[2]     = {offsetof(sunTimerStruct, tic),
-                                 offsetof(sunTimerStruct, count)};
-  MPI_Aint lb, extent;
 
-  MPI_Type_create_struct(2, block_lens, displ, types, &tmp_type);
-  MPI_Type_get_extent(tmp_type, &lb, &extent);
-  extent = sizeof(sunTimerStruct);
-  MPI_Type_create_resized(tmp_type, lb, extent, &MPI_sunTimerStruct);
-  MPI_Type_commit(&MPI_sunTimerStruct);
-
-  /* Register max and sum MPI reduction operations for our datatype */
-  MPI_Op MPI_sunTimerStruct_MAXANDSUM;
-  MPI_Op_create(sunTimerStructReduceMaxAndSum, 1, &MPI_sunTimerStruct_MAXANDSUM);
+  for (i = 0; i < p->nregions; i++) { sorted[i] = &p->regions[i]; }
+  qsort(sorted, p->nregions, sizeof(sunRegion*), sunCompareNames);
 
   /* Compute max and average time across all ranks */
+  for (i = 0; i < p->nregions; i++) { times[i] = sorted[i]->average; }
   if (rank == 0)
   {
-    MPI_Reduce(MPI_IN_PLACE, reduced, map_size, MPI_sunTimerStruct,
-               MPI_sunTimerStruct_MAXANDSUM, 0, comm);
+    MPI_Reduce(MPI_IN_PLACE, times, p->nregions, MPI_DOUBLE, MPI_SUM, 0, comm);
+  }
+  else { MPI_Reduce(times, times, p->nregions, MPI_DOUBLE, MPI_SUM, 0, comm); }
+
+  for (i = 0; i < p->nregions; i++)
+  {
+    times[p->nregions + i] = sorted[i]->maximum;
+  }
+  if (rank == 0)
+  {
+    MPI_Reduce(MPI_IN_PLACE, times + p->nregions, p->nregions, MPI_DOUBLE,
+               MPI_MAX, 0, comm);
   }
   else
   {
-    MPI_Reduce(reduced, reduced, map_size, MPI_sunTimerStruct,
-               MPI_sunTimerStruct_MAXANDSUM, 0, comm);
+    MPI_Reduce(times + p->nregions, times + p->nregions, p->nregions,
+               MPI_DOUBLE, MPI_MAX, 0, comm);
   }
 
-  /* Cleanup custom MPI datatype and operations */
-  MPI_Type_free(&tmp_type);
-  MPI_Type_free(&MPI_sunTimerStruct);
-  MPI_Op_free(&MPI_sunTimerStruct_MAXANDSUM);
-
-  /* Update the values that are in this rank's hash map. */
-  for (int i = 0; i < map_size; ++i)
+  /* Update the values on this rank */
+  if (rank == 0)
   {
-    values[i]->average = reduced[i].average / (double)nranks;
-    values[i]->maximum = reduced[i].maximum;
+    for (i = 0; i < p->nregions; i++)
+    {
+      sorted[i]->average = times[i] / (double)nranks;
+      sorted[i]->maximum = times[p->nregions + i];
+    }
+    p->sundials_time = p->regions[SUNPROFILER_ROOT].maximum;
   }
 
-  free(reduced);
-  free(values);
+  free(sorted);
+  free(times);
 
   return SUN_SUCCESS;
 }
@@ -544,35 +1003,39 @@ SUNErrCode sunCollectTimers(SUNProfiler p)
 
 /* Print out the: timer name, percentage of exec time (based on the max),
    max across ranks, average across ranks, and the timer counter. */
-void sunPrintTimer(SUNHashMapKeyValue kv, FILE* fp, void* pvoid)
+void sunPrintTimer(sunRegion* region, FILE* fp, SUNProfiler p)
 {
-  SUNProfiler p      = (SUNProfiler)pvoid;
-  sunTimerStruct* ts = (sunTimerStruct*)kv->value;
-  double maximum     = ts->maximum;
-  double average     = ts->average;
-  double percent = strcmp((const char*)kv->key, (const char*)SUNDIALS_ROOT_TIMER)
+  double maximum = region->maximum;
+  double average = region->average;
+  double percent = strcmp(region->name, (const char*)SUNDIALS_ROOT_TIMER)
                      ? maximum / p->sundials_time * 100
                      : 100;
-  fprintf(fp, "%-40s\t %6.2f%% \t         %.6fs \t %.6fs \t %ld\n", kv->key,
-          percent, maximum, average, ts->count);
+  fprintf(fp, "%-40s\t %6.2f%% \t         %.6fs \t %.6fs \t %ld",
+          region->name, percent, maximum, average, region->count);
+
+  /* Instructions per cycle and the memory bandwidth implied by the last level
+     cache misses on this rank */
+  if (p->counters)
+  {
+    double cycles  = (double)region->counters[SUN_PERFCOUNTER_CYCLES];
+    double instrs  = (double)region->counters[SUN_PERFCOUNTER_INSTRUCTIONS];
+    double bytes   = (double)region->counters[SUN_PERFCOUNTER_CACHE_MISSES] *
+                   SUN_PERFCOUNTER_LINE_SIZE;
+    double elapsed = (double)region->elapsed;
+    if (cycles > 0.0) { fprintf(fp, " \t %.2f", instrs / cycles); }
+    else { fprintf(fp, " \t --"); }
+    if (elapsed > 0.0) { fprintf(fp, " \t %.3f", bytes / elapsed); }
+    else { fprintf(fp, " \t --"); }
+  }
+
+  fprintf(fp, "\n");
 }
 
-/* Comparator for qsort that compares key-value pairs
-   based on the maximum time in the sunTimerStruct. */
+/* Comparator for qsort that compares regions based on the maximum time. */
 int sunCompareTimes(const void* l, const void* r)
 {
-  double left_max;
-  double right_max;
-
-  const SUNHashMapKeyValue left  = *((const SUNHashMapKeyValue*)l);
-  const SUNHashMapKeyValue right = *((const SUNHashMapKeyValue*)r);
-
-  if (left == NULL && right == NULL) { return 0; }
-  if (left == NULL) { return 1; }
-  if (right == NULL) { return -1; }
-
-  left_max  = ((sunTimerStruct*)left->value)->maximum;
-  right_max = ((sunTimerStruct*)right->value)->maximum;
+  double left_max  = (*((sunRegion* const*)l))->maximum;
+  double right_max = (*((sunRegion* const*)r))->maximum;
 
   if (left_max < right_max) { return 1; }
   if (left_max > right_max) { return -1; }
@@ -580,6 +1043,23 @@ int sunCompareTimes(const void* l, const void* r)
   return 0;
 }
 
+#if SUNDIALS_MPI_ENABLED
+/* Comparator for qsort that compares regions based on the name. */
+int sunCompareNames(const void* l, const void* r)
+{
+  return strcmp((*((sunRegion* const*)l))->name,
+                (*((sunRegion* const*)r))->name);
+}
+#endif
+
+/* Current time in nanoseconds */
+int64_t sunNow(void)
+{
+  sunTimespec ts;
+  sunclock_gettime_monotonic(&ts);
+  return (int64_t)ts.tv_sec * 1000000000 + (int64_t)ts.tv_nsec;
+}
+
 int sunclock_gettime_monotonic(sunTimespec* ts)
 {
 #if defined(SUNDIALS_HAVE_POSIX_TIMERS)
@@ -0,0 +1,243 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Helpers for combining several global reductions into a single
+ * MPI Allreduce.
+ *
+ * The packages register the norms they need with the
+ * sunReduceBatch_* functions, which compute the task-local values
+ * right away, and then call sunReduceBatch_Finalize to combine all
+ * local values with one N_VSumMaxMultiAllReduce call and write the
+ * results to the locations given at registration. A reduction that
+ * cannot be deferred (the vector has no communicator or lacks the
+ * needed operations, uses a different communicator than the earlier
+ * reductions, or the batch is full) is computed with the global
+ * operation when it is registered. The results are therefore
+ * only available after sunReduceBatch_Finalize returns.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_REDUCEBATCH_H
+#define _SUNDIALS_REDUCEBATCH_H
+
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_types.h>
+
+#define SUN_REDUCEBATCH_MAX 64
+
+/* How a combined value gives the result */
+#define SUN_REDUCE_WRMS 0 /* sqrt(sum / length) */
+#define SUN_REDUCE_MAX  1 /* max                */
+#define SUN_REDUCE_MIN  2 /* -max of negation   */
+
+typedef struct
+{
+  int kind;           /* SUN_REDUCE_WRMS, SUN_REDUCE_MAX or SUN_REDUCE_MIN */
+  sunrealtype local;  /* task-local value                                  */
+  sunrealtype length; /* global vector length for a norm                   */
+  sunrealtype* out;   /* where to store the result                         */
+} sunReduceItem;
+
+typedef struct
+{
+  N_Vector x;  /* vector used to combine the deferred values */
+  SUNErrCode err;
+  int nitems;
+  sunReduceItem items[SUN_REDUCEBATCH_MAX];
+} sunReduceBatch;
+
+static inline void sunReduceBatch_Init(sunReduceBatch* rb)
+{
+  rb->x      = NULL;
+  rb->err    = SUN_SUCCESS;
+  rb->nitems = 0;
+}
+
+/* Checks if n reductions of x can be deferred, has_local indicates if x
+   provides the needed local reduction */
+static inline sunbooleantype sunReduceBatch_CanDefer(sunReduceBatch* rb,
+                                                     N_Vector x, int n,
+                                                     sunbooleantype has_local)
+{
+  SUNComm comm;
+
+  if (!has_local || x->ops->nvsummaxmultiallreduce == NULL) { return SUNFALSE; }
+  if (rb->nitems + n > SUN_REDUCEBATCH_MAX) { return SUNFALSE; }
+
+  comm = N_VGetCommunicator(x);
+  if (comm == SUN_COMM_NULL) { return SUNFALSE; }
+
+  if (rb->x == NULL) { rb->x = x; }
+  else if (N_VGetCommunicator(rb->x) != comm) { return SUNFALSE; }
+
+  return SUNTRUE;
+}
+
+static inline void sunReduceBatch_Add(sunReduceBatch* rb, int kind,
+                                      sunrealtype local, N_Vector x,
+                                      sunrealtype* out)
+{
+  sunReduceItem* item = &rb->items[rb->nitems++];
+  item->kind          = kind;
+  item->local         = local;
+  item->length = (kind == SUN_REDUCE_WRMS) ? (sunrealtype)N_VGetLength(x) : 0;
+  item->out    = out;
+}
+
+/* *nrm = N_VWrmsNorm(x, w) */
+static inline void sunReduceBatch_WrmsNorm(sunReduceBatch* rb, N_Vector x,
+                                           N_Vector w, sunrealtype* nrm)
+{
+  if (sunReduceBatch_CanDefer(rb, x, 1, x->ops->nvwsqrsumlocal != NULL))
+  {
+    sunReduceBatch_Add(rb, SUN_REDUCE_WRMS, N_VWSqrSumLocal(x, w), x, nrm);
+  }
+  else { *nrm = N_VWrmsNorm(x, w); }
+}
+
+/* *nrm = N_VWrmsNormMask(x, w, id) */
+static inline void sunReduceBatch_WrmsNormMask(sunReduceBatch* rb, N_Vector x,
+                                               N_Vector w, N_Vector id,
+                                               sunrealtype* nrm)
+{
+  if (sunReduceBatch_CanDefer(rb, x, 1, x->ops->nvwsqrsummasklocal != NULL))
+  {
+    sunReduceBatch_Add(rb, SUN_REDUCE_WRMS, N_VWSqrSumMaskLocal(x, w, id), x,
+                       nrm);
+  }
+  else { *nrm = N_VWrmsNormMask(x, w, id); }
+}
+
+/* z = sum_j c[j] X[j] and *nrm = N_VWrmsNorm(z, w), c and X are only used
+   during the call */
+static inline void sunReduceBatch_LinearCombinationWrmsNorm(
+  sunReduceBatch* rb, int nvec, sunrealtype* c, N_Vector* X, N_Vector z,
+  N_Vector w, sunrealtype* nrm)
+{
+  SUNErrCode err;
+  sunrealtype sum = SUN_RCONST(0.0);
+
+  if (sunReduceBatch_CanDefer(rb, z, 1,
+                              z->ops->nvlinearcombinationwsqrsumlocal != NULL ||
+                                z->ops->nvwsqrsumlocal != NULL))
+  {
+    err = N_VLinearCombinationWSqrSumLocal(nvec, c, X, z, w, &sum);
+    sunReduceBatch_Add(rb, SUN_REDUCE_WRMS, sum, z, nrm);
+  }
+  else { err = N_VLinearCombinationWrmsNorm(nvec, c, X, z, w, nrm); }
+
+  if (err && !rb->err) { rb->err = err; }
+}
+
+/* nrm[i] = N_VWrmsNorm(X[i], W[i]) for i = 0, ..., nvec - 1 */
+static inline void sunReduceBatch_WrmsNormVectorArray(sunReduceBatch* rb,
+                                                      int nvec, N_Vector* X,
+                                                      N_Vector* W,
+                                                      sunrealtype* nrm)
+{
+  SUNErrCode err;
+  int i;
+
+  if (sunReduceBatch_CanDefer(rb, X[0], nvec,
+                              X[0]->ops->nvwsqrsumlocal != NULL))
+  {
+    for (i = 0; i < nvec; i++)
+    {
+      sunReduceBatch_Add(rb, SUN_REDUCE_WRMS, N_VWSqrSumLocal(X[i], W[i]), X[i],
+                         &nrm[i]);
+    }
+  }
+  else
+  {
+    err = N_VWrmsNormVectorArray(nvec, X, W, nrm);
+    if (err && !rb->err) { rb->err = err; }
+  }
+}
+
+/* *nrm = N_VMaxNorm(x) */
+static inline void sunReduceBatch_MaxNorm(sunReduceBatch* rb, N_Vector x,
+                                          sunrealtype* nrm)
+{
+  if (sunReduceBatch_CanDefer(rb, x, 1, x->ops->nvmaxnormlocal != NULL))
+  {
+    sunReduceBatch_Add(rb, SUN_REDUCE_MAX, N_VMaxNormLocal(x), x, nrm);
+  }
+  else { *nrm = N_VMaxNorm(x); }
+}
+
+/* *min = N_VMin(x). Returns the task-local minimum when the reduction is
+   deferred and the global minimum otherwise. */
+static inline sunrealtype sunReduceBatch_Min(sunReduceBatch* rb, N_Vector x,
+                                             sunrealtype* min)
+{
+  sunrealtype local;
+
+  if (sunReduceBatch_CanDefer(rb, x, 1, x->ops->nvminlocal != NULL))
+  {
+    local = N_VMinLocal(x);
+    sunReduceBatch_Add(rb, SUN_REDUCE_MIN, -local, x, min);
+    return local;
+  }
+
+  *min = N_VMin(x);
+  return *min;
+}
+
+/* Combines the deferred reductions and stores their results. Returns the first
+   error from a registered operation or from the reduction. */
+static inline SUNErrCode sunReduceBatch_Finalize(sunReduceBatch* rb)
+{
+  sunrealtype vals[SUN_REDUCEBATCH_MAX];
+  sunReduceItem* item;
+  SUNErrCode err;
+  int i, n, nsum;
+
+  if (rb->err || rb->nitems == 0) { return rb->err; }
+
+  /* the sums come first, followed by the maxima */
+  n = 0;
+  for (i = 0; i < rb->nitems; i++)
+  {
+    item = &rb->items[i];
+    if (item->kind == SUN_REDUCE_WRMS) { vals[n++] = item->local; }
+  }
+  nsum = n;
+  for (i = 0; i < rb->nitems; i++)
+  {
+    item = &rb->items[i];
+    if (item->kind != SUN_REDUCE_WRMS) { vals[n++] = item->local; }
+  }
+
+  err = N_VSumMaxMultiAllReduce(nsum, n - nsum, rb->x, vals);
+  if (err) { return err; }
+
+  n = 0;
+  for (i = 0; i < rb->nitems; i++)
+  {
+    item = &rb->items[i];
+    if (item->kind == SUN_REDUCE_WRMS)
+    {
+      *item->out = SUNRsqrt(vals[n++] / item->length);
+    }
+  }
+  for (i = 0; i < rb->nitems; i++)
+  {
+    item = &rb->items[i];
+    if (item->kind == SUN_REDUCE_MAX) { *item->out = vals[n++]; }
+    else if (item->kind == SUN_REDUCE_MIN) { *item->out = -vals[n++]; }
+  }
+
+  rb->nitems = 0;
+
+  return SUN_SUCCESS;
+}
+
+#endif
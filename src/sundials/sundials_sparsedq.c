@@ -0,0 +1,257 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Column grouping and pattern detection for difference quotient
+ * approximations of sparse Jacobians, see sundials_sparsedq.h.
+ * -----------------------------------------------------------------*/
+
+#include <stdlib.h>
+#include <sundials/sundials_math.h>
+
+#include "sundials_sparsedq.h"
+
+/* Stores the transpose of the pattern given by ptrs and vals in tptrs and
+   tvals, and the transposed position of entry p in tpos[p] */
+static void sunSparseDQ_Transpose(sunindextype N, const sunindextype* ptrs,
+                                  const sunindextype* vals, sunindextype* tptrs,
+                                  sunindextype* tvals, sunindextype* tpos)
+{
+  sunindextype i, j, p;
+
+  for (i = 0; i <= N; i++) { tptrs[i] = 0; }
+  for (p = 0; p < ptrs[N]; p++) { tptrs[vals[p] + 1]++; }
+  for (i = 0; i < N; i++) { tptrs[i + 1] += tptrs[i]; }
+
+  /* tptrs[i] is used as the next free position in row i and shifted back */
+  for (j = 0; j < N; j++)
+  {
+    for (p = ptrs[j]; p < ptrs[j + 1]; p++)
+    {
+      tpos[p]        = tptrs[vals[p]]++;
+      tvals[tpos[p]] = j;
+    }
+  }
+  for (i = N; i > 0; i--) { tptrs[i] = tptrs[i - 1]; }
+  tptrs[0] = 0;
+}
+
+/* Computes the column groups */
+static SUNErrCode sunSparseDQ_Color(sunSparseDQ sdq)
+{
+  sunindextype N = sdq->N;
+  sunindextype *order, *color, *mark;
+  sunindextype i, j, k, c, p, q, maxdeg;
+
+  order = (sunindextype*)malloc((N + 1) * sizeof(sunindextype));
+  color = (sunindextype*)malloc((N + 1) * sizeof(sunindextype));
+  mark  = (sunindextype*)malloc((N + 1) * sizeof(sunindextype));
+  if (order == NULL || color == NULL || mark == NULL)
+  {
+    free(order);
+    free(color);
+    free(mark);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  /* Order the columns by decreasing number of nonzeros (counting sort) */
+  maxdeg = 0;
+  for (j = 0; j < N; j++)
+  {
+    maxdeg = SUNMAX(maxdeg, sdq->colptrs[j + 1] - sdq->colptrs[j]);
+  }
+  for (k = 0; k <= N; k++) { mark[k] = 0; }
+  for (j = 0; j < N; j++)
+  {
+    mark[maxdeg - (sdq->colptrs[j + 1] - sdq->colptrs[j])]++;
+  }
+  for (k = 0, p = 0; k <= maxdeg; k++)
+  {
+    q       = mark[k];
+    mark[k] = p;
+    p += q;
+  }
+  for (j = 0; j < N; j++)
+  {
+    order[mark[maxdeg - (sdq->colptrs[j + 1] - sdq->colptrs[j])]++] = j;
+  }
+
+  /* Give each column the smallest color not used by a column sharing a row
+     with it, mark[c] == j flags color c as taken for column j */
+  for (k = 0; k <= N; k++)
+  {
+    color[k] = -1;
+    mark[k]  = -1;
+  }
+  sdq->ncolors = 0;
+  for (k = 0; k < N; k++)
+  {
+    j = order[k];
+    for (p = sdq->colptrs[j]; p < sdq->colptrs[j + 1]; p++)
+    {
+      i = sdq->rowvals[p];
+      for (q = sdq->rowptrs[i]; q < sdq->rowptrs[i + 1]; q++)
+      {
+        c = color[sdq->colvals[q]];
+        if (c >= 0) { mark[c] = j; }
+      }
+    }
+    for (c = 0; mark[c] == j; c++) {}
+    color[j]     = c;
+    sdq->ncolors = SUNMAX(sdq->ncolors, c + 1);
+  }
+
+  /* Group the columns by color */
+  sdq->colorptrs = (sunindextype*)malloc((sdq->ncolors + 1) *
+                                         sizeof(sunindextype));
+  sdq->colorcols = (sunindextype*)malloc((N + 1) * sizeof(sunindextype));
+  if (sdq->colorptrs == NULL || sdq->colorcols == NULL)
+  {
+    free(order);
+    free(color);
+    free(mark);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  for (c = 0; c <= sdq->ncolors; c++) { sdq->colorptrs[c] = 0; }
+  for (j = 0; j < N; j++) { sdq->colorptrs[color[j] + 1]++; }
+  for (c = 0; c < sdq->ncolors; c++)
+  {
+    sdq->colorptrs[c + 1] += sdq->colorptrs[c];
+  }
+  for (c = 0; c < sdq->ncolors; c++) { mark[c] = sdq->colorptrs[c]; }
+  for (j = 0; j < N; j++) { sdq->colorcols[mark[color[j]]++] = j; }
+
+  free(order);
+  free(color);
+  free(mark);
+
+  return SUN_SUCCESS;
+}
+
+void sunSparseDQ_Destroy(sunSparseDQ* sdq)
+{
+  if (sdq == NULL || *sdq == NULL) { return; }
+  free((*sdq)->colptrs);
+  free((*sdq)->rowvals);
+  free((*sdq)->rowptrs);
+  free((*sdq)->colvals);
+  free((*sdq)->csrpos);
+  free((*sdq)->colorptrs);
+  free((*sdq)->colorcols);
+  free(*sdq);
+  *sdq = NULL;
+}
+
+/* Creates the column groups for the nonzero pattern of the square sparse
+   matrix S, the values of S are not used */
+SUNErrCode sunSparseDQ_Create(SUNMatrix S, sunSparseDQ* sdq_out)
+{
+  sunSparseDQ sdq;
+  sunindextype *ptrs, *vals, *tpos;
+  sunindextype N, nnz, j, p;
+  SUNErrCode err;
+
+  *sdq_out = NULL;
+
+  if (SUNMatGetID(S) != SUNMATRIX_SPARSE || SM_ROWS_S(S) != SM_COLUMNS_S(S))
+  {
+    return SUN_ERR_ARG_INCOMPATIBLE;
+  }
+
+  N    = SM_COLUMNS_S(S);
+  ptrs = SM_INDEXPTRS_S(S);
+  vals = SM_INDEXVALS_S(S);
+  nnz  = ptrs[N];
+
+  /* Check that the pattern is well formed */
+  if (ptrs[0] != 0 || nnz > SM_NNZ_S(S)) { return SUN_ERR_ARG_OUTOFRANGE; }
+  for (j = 0; j < N; j++)
+  {
+    if (ptrs[j + 1] < ptrs[j]) { return SUN_ERR_ARG_OUTOFRANGE; }
+  }
+  for (p = 0; p < nnz; p++)
+  {
+    if (vals[p] < 0 || vals[p] >= N) { return SUN_ERR_ARG_OUTOFRANGE; }
+  }
+
+  sdq = (sunSparseDQ)calloc(1, sizeof(*sdq));
+  if (sdq == NULL) { return SUN_ERR_MALLOC_FAIL; }
+
+  sdq->N   = N;
+  sdq->nnz = nnz;
+
+  /* one extra entry so the arrays are not empty when nnz = 0 */
+  sdq->colptrs = (sunindextype*)malloc((N + 1) * sizeof(sunindextype));
+  sdq->rowptrs = (sunindextype*)malloc((N + 1) * sizeof(sunindextype));
+  sdq->rowvals = (sunindextype*)malloc((nnz + 1) * sizeof(sunindextype));
+  sdq->colvals = (sunindextype*)malloc((nnz + 1) * sizeof(sunindextype));
+  sdq->csrpos  = (sunindextype*)malloc((nnz + 1) * sizeof(sunindextype));
+  tpos         = (sunindextype*)malloc((nnz + 1) * sizeof(sunindextype));
+  if (sdq->colptrs == NULL || sdq->rowptrs == NULL || sdq->rowvals == NULL ||
+      sdq->colvals == NULL || sdq->csrpos == NULL || tpos == NULL)
+  {
+    free(tpos);
+    sunSparseDQ_Destroy(&sdq);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  /* Store both the CSC and CSR form of the pattern */
+  if (SM_SPARSETYPE_S(S) == CSC_MAT)
+  {
+    for (j = 0; j <= N; j++) { sdq->colptrs[j] = ptrs[j]; }
+    for (p = 0; p < nnz; p++) { sdq->rowvals[p] = vals[p]; }
+    sunSparseDQ_Transpose(N, sdq->colptrs, sdq->rowvals, sdq->rowptrs,
+                          sdq->colvals, sdq->csrpos);
+  }
+  else
+  {
+    for (j = 0; j <= N; j++) { sdq->rowptrs[j] = ptrs[j]; }
+    for (p = 0; p < nnz; p++) { sdq->colvals[p] = vals[p]; }
+    sunSparseDQ_Transpose(N, sdq->rowptrs, sdq->colvals, sdq->colptrs,
+                          sdq->rowvals, tpos);
+    for (p = 0; p < nnz; p++) { sdq->csrpos[tpos[p]] = p; }
+  }
+  free(tpos);
+
+  err = sunSparseDQ_Color(sdq);
+  if (err)
+  {
+    sunSparseDQ_Destroy(&sdq);
+    return err;
+  }
+
+  *sdq_out = sdq;
+  return SUN_SUCCESS;
+}
+
+/* Checks that the square sparse matrix J has the size of the pattern */
+sunbooleantype sunSparseDQ_Compatible(sunSparseDQ sdq, SUNMatrix J)
+{
+  if (SUNMatGetID(J) != SUNMATRIX_SPARSE) { return SUNFALSE; }
+  return (SM_ROWS_S(J) == sdq->N && SM_COLUMNS_S(J) == sdq->N);
+}
+
+/* Returns a pseudo-random number in [1, 2) from a linear congruential
+   generator, so the probes are reproducible for a given initial state */
+static sunrealtype sunSparseDQ_Random(unsigned long* state)
+{
+  *state = (*state * 1103515245UL + 12345UL) & 0x7fffffffUL;
+  return SUN_RCONST(1.0) + (sunrealtype)(*state) / SUN_RCONST(2147483648.0);
+}
+
+/* Random perturbation of y_j for detecting its nonzeros. It is much larger
+   than a difference quotient increment so that any dependence on y_j
+   changes f in spite of roundoff. */
+sunrealtype sunSparseDQ_ProbeIncrement(sunrealtype yj, unsigned long* state)
+{
+  return sunSparseDQ_Random(state) * SUN_RCONST(1.0e-3) *
+         (SUNRabs(yj) + SUN_RCONST(1.0));
+}
@@ -0,0 +1,163 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Helpers for difference quotient approximations of sparse
+ * Jacobians.
+ *
+ * sunSparseDQ_Create takes the nonzero pattern of a square sparse
+ * Jacobian (the index arrays of a CSC or CSR SUNSparseMatrix) and
+ * splits its columns into groups, or colors, such that no two
+ * columns in a group have a nonzero in the same row (a distance-2
+ * coloring of the column graph). All columns of a group can then be
+ * perturbed at the same time, so the packages approximate the
+ * Jacobian with one function evaluation per color rather than one
+ * per column. The colors are assigned greedily, visiting the columns
+ * with the most nonzeros first.
+ *
+ * Before filling a Jacobian, sunSparseDQ_SetPattern writes the
+ * pattern into the matrix, as SUNMatZero clears the index arrays of
+ * sparse matrices. The entries are then set by column using the CSC
+ * copy of the pattern, where sunSparseDQ_Position maps an entry to
+ * its location in the data array of the matrix.
+ *
+ * When the pattern is not known, the packages can detect it by
+ * probing the function at the initial state. Each y_j is set to NaN
+ * and then perturbed by a random amount, and sunSparseDQ_DetectColumn
+ * records the rows of f that are NaN or change as the nonzeros of
+ * column j in a CSC matrix given to sunSparseDQ_Create.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_SPARSEDQ_H
+#define _SUNDIALS_SPARSEDQ_H
+
+#include <math.h>
+#include <stdlib.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_matrix.h>
+#include <sundials/sundials_types.h>
+#include <sunmatrix/sunmatrix_sparse.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct sunSparseDQ_* sunSparseDQ;
+
+struct sunSparseDQ_
+{
+  sunindextype N;          /* number of rows and columns                */
+  sunindextype nnz;        /* number of nonzeros in the pattern         */
+  sunindextype* colptrs;   /* CSC pattern                               */
+  sunindextype* rowvals;   /*                                           */
+  sunindextype* rowptrs;   /* CSR pattern                               */
+  sunindextype* colvals;   /*                                           */
+  sunindextype* csrpos;    /* CSR position of each CSC entry            */
+  sunindextype ncolors;    /* number of column groups                   */
+  sunindextype* colorptrs; /* the columns of color c are colorcols[k]   */
+  sunindextype* colorcols; /* for colorptrs[c] <= k < colorptrs[c + 1]  */
+};
+
+/* Creates the column groups for the nonzero pattern of the square sparse
+   matrix S, the values of S are not used */
+SUNDIALS_EXPORT
+SUNErrCode sunSparseDQ_Create(SUNMatrix S, sunSparseDQ* sdq_out);
+
+SUNDIALS_EXPORT
+void sunSparseDQ_Destroy(sunSparseDQ* sdq);
+
+/* Checks that the square sparse matrix J has the size of the pattern */
+SUNDIALS_EXPORT
+sunbooleantype sunSparseDQ_Compatible(sunSparseDQ sdq, SUNMatrix J);
+
+/* Random perturbation of y_j for detecting its nonzeros. It is much larger
+   than a difference quotient increment so that any dependence on y_j
+   changes f in spite of roundoff. */
+SUNDIALS_EXPORT
+sunrealtype sunSparseDQ_ProbeIncrement(sunrealtype yj, unsigned long* state);
+
+/* The functions below stay inline. Position is called for every Jacobian
+   entry, and SetPattern and DetectColumn grow the matrix with the sparse
+   matrix module, which the packages link but the core library does not. */
+
+/* Writes the pattern into J and zeros its entries */
+static inline SUNErrCode sunSparseDQ_SetPattern(sunSparseDQ sdq, SUNMatrix J)
+{
+  sunindextype *ptrs, *vals, *indexptrs, *indexvals;
+  sunindextype j, p;
+  SUNErrCode err;
+
+  if (SM_NNZ_S(J) < sdq->nnz)
+  {
+    err = SUNSparseMatrix_Reallocate(J, sdq->nnz);
+    if (err) { return err; }
+  }
+
+  ptrs = (SM_SPARSETYPE_S(J) == CSC_MAT) ? sdq->colptrs : sdq->rowptrs;
+  vals = (SM_SPARSETYPE_S(J) == CSC_MAT) ? sdq->rowvals : sdq->colvals;
+
+  indexptrs = SM_INDEXPTRS_S(J);
+  indexvals = SM_INDEXVALS_S(J);
+  for (j = 0; j <= sdq->N; j++) { indexptrs[j] = ptrs[j]; }
+  for (p = 0; p < sdq->nnz; p++) { indexvals[p] = vals[p]; }
+  for (p = 0; p < SM_NNZ_S(J); p++) { SM_DATA_S(J)[p] = SUN_RCONST(0.0); }
+
+  return SUN_SUCCESS;
+}
+
+/* Location of the CSC pattern entry p in the data array of J */
+static inline sunindextype sunSparseDQ_Position(sunSparseDQ sdq, SUNMatrix J,
+                                                sunindextype p)
+{
+  return (SM_SPARSETYPE_S(J) == CSC_MAT) ? p : sdq->csrpos[p];
+}
+
+/* Appends column j of a detected pattern to the square CSC matrix P,
+   growing P as needed. Row i is a nonzero if fnan[i], computed with y_j
+   set to NaN, is NaN or if fpert[i], computed with y_j perturbed, differs
+   from the unperturbed f0[i]. Either probe may be NULL if the function
+   failed for it. The diagonal is always included, as it is needed in the
+   Newton matrix. The columns must be added in order starting with 0. */
+static inline SUNErrCode sunSparseDQ_DetectColumn(SUNMatrix P, sunindextype j,
+                                                  const sunrealtype* f0,
+                                                  const sunrealtype* fnan,
+                                                  const sunrealtype* fpert)
+{
+  sunindextype i, nnz;
+  sunbooleantype nonzero;
+  SUNErrCode err;
+
+  if (j == 0) { SM_INDEXPTRS_S(P)[0] = 0; }
+  nnz = SM_INDEXPTRS_S(P)[j];
+
+  for (i = 0; i < SM_ROWS_S(P); i++)
+  {
+    nonzero = (i == j);
+    if (fnan != NULL && isnan(fnan[i])) { nonzero = SUNTRUE; }
+    if (fpert != NULL && fpert[i] != f0[i]) { nonzero = SUNTRUE; }
+    if (!nonzero) { continue; }
+
+    if (nnz == SM_NNZ_S(P))
+    {
+      err = SUNSparseMatrix_Reallocate(P, 2 * nnz + 1);
+      if (err) { return err; }
+    }
+    SM_INDEXVALS_S(P)[nnz++] = i;
+  }
+  SM_INDEXPTRS_S(P)[j + 1] = nnz;
+
+  return SUN_SUCCESS;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
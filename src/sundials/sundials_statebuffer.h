@@ -0,0 +1,176 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Helpers for packing integrator state into a flat binary buffer.
+ *
+ * The packages describe their state once, as a sequence of
+ * sunStateBuffer_Item and sunStateBuffer_Vector calls, and the same
+ * routine then computes the buffer size (no buffer), saves the
+ * state (load is false) or loads it (load is true). Values are
+ * stored in the native byte order, so a buffer may only be loaded
+ * by a build with the same precision and index sizes.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_STATEBUFFER_H
+#define _SUNDIALS_STATEBUFFER_H
+
+#include <stdint.h>
+#include <string.h>
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_types.h>
+
+/* "SUNS" in ASCII */
+#define SUN_STATEBUFFER_MAGIC   UINT32_C(0x534E5553)
+#define SUN_STATEBUFFER_VERSION UINT32_C(1)
+
+typedef struct
+{
+  const char* src;        /* buffer loaded from, NULL when not loading  */
+  char* dst;              /* buffer saved into, NULL when not saving    */
+  size_t bytes;           /* size of the buffer                         */
+  size_t pos;             /* current offset in the buffer               */
+  sunbooleantype load;    /* copy from src instead of into dst          */
+  sunbooleantype invalid; /* buffer is too small or does not match      */
+} sunStateBuffer;
+
+/* Starts a pass over a writable buffer, or computes the size when data is
+   NULL */
+static inline void sunStateBuffer_Init(sunStateBuffer* sb, void* data,
+                                       size_t bytes, sunbooleantype load)
+{
+  sb->src     = load ? (const char*)data : NULL;
+  sb->dst     = load ? NULL : (char*)data;
+  sb->bytes   = bytes;
+  sb->pos     = 0;
+  sb->load    = load;
+  sb->invalid = SUNFALSE;
+}
+
+/* Starts a load from a buffer that is only read */
+static inline void sunStateBuffer_InitLoad(sunStateBuffer* sb,
+                                           const void* data, size_t bytes)
+{
+  sb->src     = (const char*)data;
+  sb->dst     = NULL;
+  sb->bytes   = bytes;
+  sb->pos     = 0;
+  sb->load    = SUNTRUE;
+  sb->invalid = SUNFALSE;
+}
+
+static inline sunbooleantype sunStateBuffer_HasData(const sunStateBuffer* sb)
+{
+  return (sb->src != NULL || sb->dst != NULL) ? SUNTRUE : SUNFALSE;
+}
+
+/* Saves or loads the n bytes at ptr */
+static inline void sunStateBuffer_Item(sunStateBuffer* sb, void* ptr, size_t n)
+{
+  if (sb->invalid) { return; }
+
+  if (sunStateBuffer_HasData(sb))
+  {
+    if (sb->pos + n > sb->bytes)
+    {
+      sb->invalid = SUNTRUE;
+      return;
+    }
+    if (sb->load) { memcpy(ptr, sb->src + sb->pos, n); }
+    else { memcpy(sb->dst + sb->pos, ptr, n); }
+  }
+
+  sb->pos += n;
+}
+
+/* Saves a value or checks that the loaded value matches it */
+static inline void sunStateBuffer_Check(sunStateBuffer* sb, const void* ptr,
+                                        size_t n)
+{
+  char value[sizeof(sunrealtype) > 8 ? sizeof(sunrealtype) : 8];
+
+  if (n > sizeof(value))
+  {
+    sb->invalid = SUNTRUE;
+    return;
+  }
+
+  memcpy(value, ptr, n);
+  sunStateBuffer_Item(sb, value, n);
+  if (sb->load && sb->src != NULL && memcmp(value, ptr, n) != 0)
+  {
+    sb->invalid = SUNTRUE;
+  }
+}
+
+/* Saves or checks the leading tag identifying the buffer layout. The tag
+   holds the package name and the sizes of the numeric types. */
+static inline void sunStateBuffer_Header(sunStateBuffer* sb,
+                                         const char* package)
+{
+  const uint32_t magic   = SUN_STATEBUFFER_MAGIC;
+  const uint32_t version = SUN_STATEBUFFER_VERSION;
+  const uint32_t sizes   = (uint32_t)(sizeof(sunrealtype) |
+                                    (sizeof(sunindextype) << 8) |
+                                    (sizeof(long int) << 16));
+  char name[8];
+
+  memset(name, 0, sizeof(name));
+  strncpy(name, package, sizeof(name) - 1);
+
+  sunStateBuffer_Check(sb, &magic, sizeof(magic));
+  sunStateBuffer_Check(sb, &version, sizeof(version));
+  sunStateBuffer_Check(sb, &sizes, sizeof(sizes));
+  sunStateBuffer_Check(sb, name, sizeof(name));
+}
+
+/* Saves or loads the data of a vector */
+static inline SUNErrCode sunStateBuffer_Vector(sunStateBuffer* sb, N_Vector v)
+{
+  sunindextype bufsize = 0;
+  int64_t length       = 0;
+  SUNErrCode err       = SUN_SUCCESS;
+
+  if (sb->invalid) { return SUN_SUCCESS; }
+
+  err = N_VBufSize(v, &bufsize);
+  if (err != SUN_SUCCESS) { return err; }
+
+  /* the length guards against loading into a vector of another size */
+  length = (int64_t)bufsize;
+  sunStateBuffer_Check(sb, &length, sizeof(length));
+
+  /* keep the vector data aligned within the buffer */
+  sb->pos += (sizeof(sunrealtype) - sb->pos % sizeof(sunrealtype)) %
+             sizeof(sunrealtype);
+
+  if (sb->invalid) { return SUN_SUCCESS; }
+
+  if (sunStateBuffer_HasData(sb))
+  {
+    if (sb->pos + (size_t)bufsize > sb->bytes)
+    {
+      sb->invalid = SUNTRUE;
+      return SUN_SUCCESS;
+    }
+    /* N_VBufUnpack only reads the buffer but does not take a const pointer */
+    if (sb->load)
+    {
+      err = N_VBufUnpack(v, (void*)(uintptr_t)(sb->src + sb->pos));
+    }
+    else { err = N_VBufPack(v, sb->dst + sb->pos); }
+    if (err != SUN_SUCCESS) { return err; }
+  }
+
+  sb->pos += (size_t)bufsize;
+  return SUN_SUCCESS;
+}
+
+#endif
@@ -0,0 +1,319 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Implementation of the SUNStepStats per-step statistics stream.
+ *
+ * Records are buffered column by column. When the buffer fills (or
+ * on Flush/Destroy) the block is passed to the sink function and,
+ * if a file was set, appended to it in the layout
+ *
+ *   header: "SUNSTATS" | uint32 version | uint8 sizeof(sunrealtype)
+ *           | uint8 sizeof(int) | uint8 sizeof(long int) | uint8 0
+ *   block:  uint32 n | t[n] | h[n] | order[n] | netf[n] | nni[n]
+ *           | nli[n] | nsetups[n] | double wall_time[n]
+ *
+ * using the native byte order.
+ * -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_config.h>
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_futils.h>
+#include <sundials/sundials_stepstats.h>
+
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+#include <time.h>
+#elif defined(WIN32) || defined(_WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#define SUNSTEPSTATS_VERSION 1
+
+struct SUNStepStats_
+{
+  SUNContext sunctx;
+
+  /* record buffer (one array per column) */
+  int buffer_size;
+  int num_buffered;
+  sunrealtype* t;
+  sunrealtype* h;
+  int* order;
+  long int* netf;
+  long int* nni;
+  long int* nli;
+  long int* nsetups;
+  double* wall_time;
+
+  /* counter values and time at the previous record */
+  long int last_netf;
+  long int last_nni;
+  long int last_nli;
+  long int last_nsetups;
+  double last_time;
+
+  /* total number of records */
+  long int num_records;
+
+  /* output */
+  FILE* fp;
+  SUNStepStatsSinkFn sink;
+  void* sink_data;
+};
+
+/* Current monotonic time in seconds */
+static double sunStepStatsNow(void)
+{
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+#elif defined(WIN32) || defined(_WIN32)
+  static LARGE_INTEGER ticks_per_sec;
+  LARGE_INTEGER ticks;
+  if (!ticks_per_sec.QuadPart) { QueryPerformanceFrequency(&ticks_per_sec); }
+  QueryPerformanceCounter(&ticks);
+  return (double)ticks.QuadPart / (double)ticks_per_sec.QuadPart;
+#else
+  return (double)clock() / (double)CLOCKS_PER_SEC;
+#endif
+}
+
+/* Change in a cumulative counter, a drop means the integrator was reset */
+static long int sunStepStatsDelta(long int current, long int last)
+{
+  return (current >= last) ? current - last : current;
+}
+
+static SUNErrCode sunStepStatsWriteBlock(SUNStepStats stats)
+{
+  size_t n     = (size_t)stats->num_buffered;
+  uint32_t n32 = (uint32_t)n;
+  size_t count = 0;
+
+  count += fwrite(&n32, sizeof(n32), 1, stats->fp);
+  count += fwrite(stats->t, sizeof(sunrealtype), n, stats->fp);
+  count += fwrite(stats->h, sizeof(sunrealtype), n, stats->fp);
+  count += fwrite(stats->order, sizeof(int), n, stats->fp);
+  count += fwrite(stats->netf, sizeof(long int), n, stats->fp);
+  count += fwrite(stats->nni, sizeof(long int), n, stats->fp);
+  count += fwrite(stats->nli, sizeof(long int), n, stats->fp);
+  count += fwrite(stats->nsetups, sizeof(long int), n, stats->fp);
+  count += fwrite(stats->wall_time, sizeof(double), n, stats->fp);
+
+  return (count == 1 + 8 * n) ? SUN_SUCCESS : SUN_ERR_FILE_OPEN;
+}
+
+SUNErrCode SUNStepStats_Create(SUNContext sunctx, int buffer_size,
+                               SUNStepStats* stats_out)
+{
+  SUNStepStats stats = NULL;
+  size_t n;
+
+  if (sunctx == NULL || stats_out == NULL) { return SUN_ERR_ARG_CORRUPT; }
+  if (buffer_size <= 0) { return SUN_ERR_ARG_OUTOFRANGE; }
+
+  *stats_out = NULL;
+  n          = (size_t)buffer_size;
+
+  stats = (SUNStepStats)calloc(1, sizeof(*stats));
+  if (stats == NULL) { return SUN_ERR_MALLOC_FAIL; }
+
+  stats->sunctx      = sunctx;
+  stats->buffer_size = buffer_size;
+  stats->t           = (sunrealtype*)malloc(n * sizeof(sunrealtype));
+  stats->h           = (sunrealtype*)malloc(n * sizeof(sunrealtype));
+  stats->order       = (int*)malloc(n * sizeof(int));
+  stats->netf        = (long int*)malloc(n * sizeof(long int));
+  stats->nni         = (long int*)malloc(n * sizeof(long int));
+  stats->nli         = (long int*)malloc(n * sizeof(long int));
+  stats->nsetups     = (long int*)malloc(n * sizeof(long int));
+  stats->wall_time   = (double*)malloc(n * sizeof(double));
+
+  if (!stats->t || !stats->h || !stats->order || !stats->netf || !stats->nni ||
+      !stats->nli || !stats->nsetups || !stats->wall_time)
+  {
+    SUNStepStats_Destroy(&stats);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  stats->last_time = sunStepStatsNow();
+
+  *stats_out = stats;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNStepStats_SetFilename(SUNStepStats stats, const char* fname)
+{
+  static const char magic[8] = {'S', 'U', 'N', 'S', 'T', 'A', 'T', 'S'};
+  uint32_t version           = SUNSTEPSTATS_VERSION;
+  unsigned char sizes[4]     = {(unsigned char)sizeof(sunrealtype),
+                                (unsigned char)sizeof(int),
+                                (unsigned char)sizeof(long int), 0};
+  size_t count               = 0;
+  SUNErrCode err;
+
+  if (stats == NULL) { return SUN_ERR_ARG_CORRUPT; }
+  SUNFunctionBegin(stats->sunctx);
+
+  /* write out anything buffered for the previous file */
+  SUNCheckCall(SUNStepStats_Flush(stats));
+  SUNCheckCall(SUNDIALSFileClose(&stats->fp));
+  stats->fp = NULL;
+
+  if (fname == NULL || fname[0] == '\0') { return SUN_SUCCESS; }
+
+  err = SUNDIALSFileOpen(fname, "wb", &stats->fp);
+  if (err != SUN_SUCCESS) { return err; }
+
+  count += fwrite(magic, sizeof(magic), 1, stats->fp);
+  count += fwrite(&version, sizeof(version), 1, stats->fp);
+  count += fwrite(sizes, sizeof(sizes), 1, stats->fp);
+
+  return (count == 3) ? SUN_SUCCESS : SUN_ERR_FILE_OPEN;
+}
+
+SUNErrCode SUNStepStats_SetSink(SUNStepStats stats, SUNStepStatsSinkFn sink,
+                                void* user_data)
+{
+  if (stats == NULL) { return SUN_ERR_ARG_CORRUPT; }
+  SUNFunctionBegin(stats->sunctx);
+
+  SUNCheckCall(SUNStepStats_Flush(stats));
+  stats->sink      = sink;
+  stats->sink_data = user_data;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNStepStats_SetBaseline(SUNStepStats stats, long int netf,
+                                    long int nni, long int nli, long int nsetups)
+{
+  if (stats == NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  stats->last_netf    = netf;
+  stats->last_nni     = nni;
+  stats->last_nli     = nli;
+  stats->last_nsetups = nsetups;
+  stats->last_time    = sunStepStatsNow();
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNStepStats_Record(SUNStepStats stats, sunrealtype t, sunrealtype h,
+                               int order, long int netf, long int nni,
+                               long int nli, long int nsetups)
+{
+  double now;
+  int i;
+
+  if (stats == NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  if (stats->num_buffered == stats->buffer_size)
+  {
+    SUNErrCode err = SUNStepStats_Flush(stats);
+    if (err != SUN_SUCCESS) { return err; }
+  }
+
+  now = sunStepStatsNow();
+  i   = stats->num_buffered++;
+
+  stats->t[i]         = t;
+  stats->h[i]         = h;
+  stats->order[i]     = order;
+  stats->netf[i]      = sunStepStatsDelta(netf, stats->last_netf);
+  stats->nni[i]       = sunStepStatsDelta(nni, stats->last_nni);
+  stats->nli[i]       = sunStepStatsDelta(nli, stats->last_nli);
+  stats->nsetups[i]   = sunStepStatsDelta(nsetups, stats->last_nsetups);
+  stats->wall_time[i] = now - stats->last_time;
+
+  stats->last_netf    = netf;
+  stats->last_nni     = nni;
+  stats->last_nli     = nli;
+  stats->last_nsetups = nsetups;
+  stats->last_time    = now;
+  stats->num_records++;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNStepStats_Flush(SUNStepStats stats)
+{
+  SUNStepStatsBlock block;
+  SUNErrCode err = SUN_SUCCESS;
+
+  if (stats == NULL) { return SUN_ERR_ARG_CORRUPT; }
+  if (stats->num_buffered == 0) { return SUN_SUCCESS; }
+
+  if (stats->sink)
+  {
+    block.num_records = stats->num_buffered;
+    block.t           = stats->t;
+    block.h           = stats->h;
+    block.order       = stats->order;
+    block.netf        = stats->netf;
+    block.nni         = stats->nni;
+    block.nli         = stats->nli;
+    block.nsetups     = stats->nsetups;
+    block.wall_time   = stats->wall_time;
+    if (stats->sink(&block, stats->sink_data)) { err = SUN_ERR_USER_FCN_FAIL; }
+  }
+
+  if (stats->fp)
+  {
+    SUNErrCode write_err = sunStepStatsWriteBlock(stats);
+    if (err == SUN_SUCCESS) { err = write_err; }
+    fflush(stats->fp);
+  }
+
+  /* the buffer is reused even if an output failed */
+  stats->num_buffered = 0;
+
+  return err;
+}
+
+SUNErrCode SUNStepStats_GetNumRecords(SUNStepStats stats, long int* num_records)
+{
+  if (stats == NULL || num_records == NULL) { return SUN_ERR_ARG_CORRUPT; }
+  *num_records = stats->num_records;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNStepStats_Destroy(SUNStepStats* stats_ptr)
+{
+  SUNStepStats stats;
+  SUNErrCode err;
+
+  if (stats_ptr == NULL || *stats_ptr == NULL) { return SUN_SUCCESS; }
+  stats = *stats_ptr;
+
+  err = SUNStepStats_Flush(stats);
+  SUNDIALSFileClose(&stats->fp);
+
+  free(stats->t);
+  free(stats->h);
+  free(stats->order);
+  free(stats->netf);
+  free(stats->nni);
+  free(stats->nli);
+  free(stats->nsetups);
+  free(stats->wall_time);
+  free(stats);
+
+  *stats_ptr = NULL;
+  return err;
+}
@@ -0,0 +1,384 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation file for the block-diagonal dense
+ * implementation of the SUNLINSOL package.
+ * -----------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_math.h>
+#include <sunlinsol/sunlinsol_blockdense.h>
+
+#include "sundials_macros.h"
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+/*
+ * -----------------------------------------------------------------
+ * Block-diagonal dense solver structure accessibility macros:
+ * -----------------------------------------------------------------
+ */
+
+#define BLOCKDENSE_CONTENT(S) ((SUNLinearSolverContent_BlockDense)(S->content))
+#define PIVOTS(S)             (BLOCKDENSE_CONTENT(S)->pivots)
+#define WORK(S)               (BLOCKDENSE_CONTENT(S)->work)
+#define LASTFLAG(S)           (BLOCKDENSE_CONTENT(S)->last_flag)
+
+/* Private function prototypes */
+static sunindextype blockGETRF(sunrealtype* a, sunindextype n,
+                               sunindextype nb, sunindextype* p,
+                               sunrealtype* work);
+static void blockGETRS(sunrealtype* a, sunindextype n, sunindextype nb,
+                       sunindextype* p, sunrealtype* x);
+
+/*
+ * -----------------------------------------------------------------
+ * exported functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new block-diagonal dense linear solver
+ */
+
+SUNLinearSolver SUNLinSol_BlockDense(SUNDIALS_MAYBE_UNUSED N_Vector y,
+                                     SUNMatrix A, SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  SUNLinearSolver S;
+  SUNLinearSolverContent_BlockDense content;
+  sunindextype BlockRows, NumBlocks;
+
+  SUNAssertNull(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssertNull(SUNBlockDenseMatrix_BlockRows(A) ==
+                  SUNBlockDenseMatrix_BlockColumns(A),
+                SUN_ERR_ARG_DIMSMISMATCH);
+  SUNAssertNull(y->ops->nvgetarraypointer, SUN_ERR_ARG_INCOMPATIBLE);
+
+  BlockRows = SUNBlockDenseMatrix_BlockRows(A);
+  NumBlocks = SUNBlockDenseMatrix_NumBlocks(A);
+  SUNAssertNull(BlockRows * NumBlocks == N_VGetLength(y),
+                SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* Create an empty linear solver */
+  S = NULL;
+  S = SUNLinSolNewEmpty(sunctx);
+  SUNCheckLastErrNull();
+
+  /* Attach operations */
+  S->ops->gettype    = SUNLinSolGetType_BlockDense;
+  S->ops->getid      = SUNLinSolGetID_BlockDense;
+  S->ops->initialize = SUNLinSolInitialize_BlockDense;
+  S->ops->setup      = SUNLinSolSetup_BlockDense;
+  S->ops->solve      = SUNLinSolSolve_BlockDense;
+  S->ops->lastflag   = SUNLinSolLastFlag_BlockDense;
+  S->ops->space      = SUNLinSolSpace_BlockDense;
+  S->ops->free       = SUNLinSolFree_BlockDense;
+
+  /* Create content */
+  content = NULL;
+  content = (SUNLinearSolverContent_BlockDense)malloc(sizeof *content);
+  SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
+
+  /* Attach content */
+  S->content = content;
+
+  /* Fill content */
+  content->N         = BlockRows;
+  content->nblocks   = NumBlocks;
+  content->last_flag = 0;
+  content->pivots    = NULL;
+  content->work      = NULL;
+
+  /* Allocate content */
+  content->pivots =
+    (sunindextype*)malloc(BlockRows * NumBlocks * sizeof(sunindextype));
+  SUNAssertNull(content->pivots, SUN_ERR_MALLOC_FAIL);
+
+  content->work = (sunrealtype*)malloc(NumBlocks * sizeof(sunrealtype));
+  SUNAssertNull(content->work, SUN_ERR_MALLOC_FAIL);
+
+  return (S);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * implementation of linear solver operations
+ * -----------------------------------------------------------------
+ */
+
+SUNLinearSolver_Type SUNLinSolGetType_BlockDense(
+  SUNDIALS_MAYBE_UNUSED SUNLinearSolver S)
+{
+  return (SUNLINEARSOLVER_DIRECT);
+}
+
+SUNLinearSolver_ID SUNLinSolGetID_BlockDense(
+  SUNDIALS_MAYBE_UNUSED SUNLinearSolver S)
+{
+  return (SUNLINEARSOLVER_BLOCKDENSE);
+}
+
+SUNErrCode SUNLinSolInitialize_BlockDense(SUNLinearSolver S)
+{
+  /* all solver-specific memory has already been allocated */
+  LASTFLAG(S) = SUN_SUCCESS;
+  return SUN_SUCCESS;
+}
+
+int SUNLinSolSetup_BlockDense(SUNLinearSolver S, SUNMatrix A)
+{
+  SUNFunctionBegin(S->sunctx);
+  sunrealtype* A_data;
+
+  SUNAssert(A, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(SUNBlockDenseMatrix_BlockRows(A) == BLOCKDENSE_CONTENT(S)->N &&
+              SUNBlockDenseMatrix_NumBlocks(A) ==
+                BLOCKDENSE_CONTENT(S)->nblocks,
+            SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* access data pointers (return with failure on NULL) */
+  A_data = NULL;
+  A_data = SUNBlockDenseMatrix_Data(A);
+  SUNAssert(A_data, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(PIVOTS(S), SUN_ERR_ARG_CORRUPT);
+
+  /* perform LU factorization of all blocks */
+  LASTFLAG(S) = blockGETRF(A_data, BLOCKDENSE_CONTENT(S)->N,
+                           BLOCKDENSE_CONTENT(S)->nblocks, PIVOTS(S), WORK(S));
+
+  /* store error flag (if nonzero, this column has a zero pivot in a block) */
+  if (LASTFLAG(S) > 0) { return (SUNLS_LUFACT_FAIL); }
+  return SUN_SUCCESS;
+}
+
+int SUNLinSolSolve_BlockDense(SUNLinearSolver S, SUNMatrix A, N_Vector x,
+                              N_Vector b, SUNDIALS_MAYBE_UNUSED sunrealtype tol)
+{
+  SUNFunctionBegin(S->sunctx);
+  sunrealtype *A_data, *xdata;
+
+  /* copy b into x */
+  N_VScale(ONE, b, x);
+  SUNCheckLastErr();
+
+  /* access data pointers (return with failure on NULL) */
+  A_data = NULL;
+  xdata  = NULL;
+  A_data = SUNBlockDenseMatrix_Data(A);
+  SUNCheckLastErr();
+  xdata = N_VGetArrayPointer(x);
+  SUNCheckLastErr();
+
+  SUNAssert(A_data, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(xdata, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(PIVOTS(S), SUN_ERR_ARG_CORRUPT);
+
+  /* solve using LU factors */
+  blockGETRS(A_data, BLOCKDENSE_CONTENT(S)->N, BLOCKDENSE_CONTENT(S)->nblocks,
+             PIVOTS(S), xdata);
+  LASTFLAG(S) = SUN_SUCCESS;
+  return SUN_SUCCESS;
+}
+
+sunindextype SUNLinSolLastFlag_BlockDense(SUNLinearSolver S)
+{
+  /* return the stored 'last_flag' value */
+  return (LASTFLAG(S));
+}
+
+SUNErrCode SUNLinSolSpace_BlockDense(SUNLinearSolver S, long int* lenrwLS,
+                                     long int* leniwLS)
+{
+  SUNFunctionBegin(S->sunctx);
+  SUNAssert(SUNLinSolGetID(S) == SUNLINEARSOLVER_BLOCKDENSE,
+            SUN_ERR_ARG_WRONGTYPE);
+  *leniwLS = 3 + BLOCKDENSE_CONTENT(S)->N * BLOCKDENSE_CONTENT(S)->nblocks;
+  *lenrwLS = BLOCKDENSE_CONTENT(S)->nblocks;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNLinSolFree_BlockDense(SUNLinearSolver S)
+{
+  /* return if S is already free */
+  if (S == NULL) { return SUN_SUCCESS; }
+
+  /* delete items from contents, then delete generic structure */
+  if (S->content)
+  {
+    if (PIVOTS(S))
+    {
+      free(PIVOTS(S));
+      PIVOTS(S) = NULL;
+    }
+    if (WORK(S))
+    {
+      free(WORK(S));
+      WORK(S) = NULL;
+    }
+    free(S->content);
+    S->content = NULL;
+  }
+  if (S->ops)
+  {
+    free(S->ops);
+    S->ops = NULL;
+  }
+  free(S);
+  S = NULL;
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * private functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * LU factorization with partial pivoting of nb interleaved n by n blocks,
+ * following SUNDlsMat_denseGETRF. Entry (i,j) of block k is a[(j*n+i)*nb+k]
+ * and the pivot row of column j of block k is stored in p[j*nb+k]. Each inner
+ * loop runs over the blocks with unit stride. Returns 0 on success or the
+ * (1-based) column of the first zero pivot found in any block.
+ */
+
+static sunindextype blockGETRF(sunrealtype* a, sunindextype n,
+                               sunindextype nb, sunindextype* p,
+                               sunrealtype* work)
+{
+  sunindextype i, j, k, b, pk, *p_k;
+  sunrealtype *col_k, *col_j, *a_ik, *a_ij, *a_kj, v;
+
+  for (k = 0; k < n; k++)
+  {
+    col_k = a + k * n * nb;
+    p_k   = p + k * nb;
+
+    /* find the pivot row of column k in every block */
+    for (b = 0; b < nb; b++)
+    {
+      p_k[b]  = k;
+      work[b] = SUNRabs(col_k[k * nb + b]);
+    }
+    for (i = k + 1; i < n; i++)
+    {
+      a_ik = col_k + i * nb;
+      for (b = 0; b < nb; b++)
+      {
+        v = SUNRabs(a_ik[b]);
+        if (v > work[b])
+        {
+          work[b] = v;
+          p_k[b]  = i;
+        }
+      }
+    }
+
+    /* check for a zero pivot in any block */
+    for (b = 0; b < nb; b++)
+    {
+      if (work[b] == ZERO) { return (k + 1); }
+    }
+
+    /* swap rows k and p_k in every block */
+    for (j = 0; j < n; j++)
+    {
+      col_j = a + j * n * nb;
+      for (b = 0; b < nb; b++)
+      {
+        pk                 = p_k[b];
+        v                  = col_j[k * nb + b];
+        col_j[k * nb + b]  = col_j[pk * nb + b];
+        col_j[pk * nb + b] = v;
+      }
+    }
+
+    /* scale the elements below the diagonal in column k */
+    for (b = 0; b < nb; b++) { work[b] = ONE / col_k[k * nb + b]; }
+    for (i = k + 1; i < n; i++)
+    {
+      a_ik = col_k + i * nb;
+      for (b = 0; b < nb; b++) { a_ik[b] *= work[b]; }
+    }
+
+    /* row_i = row_i - [a(i,k)/a(k,k)] row_k, i=k+1, ..., n-1 */
+    for (j = k + 1; j < n; j++)
+    {
+      col_j = a + j * n * nb;
+      a_kj  = col_j + k * nb;
+      for (i = k + 1; i < n; i++)
+      {
+        a_ij = col_j + i * nb;
+        a_ik = col_k + i * nb;
+        for (b = 0; b < nb; b++) { a_ij[b] -= a_ik[b] * a_kj[b]; }
+      }
+    }
+  }
+
+  return (0);
+}
+
+/* ----------------------------------------------------------------------------
+ * Solves the nb interleaved systems with the factors from blockGETRF,
+ * following SUNDlsMat_denseGETRS. Component i of system k is x[i*nb+k].
+ */
+
+static void blockGETRS(sunrealtype* a, sunindextype n, sunindextype nb,
+                       sunindextype* p, sunrealtype* x)
+{
+  sunindextype i, k, b, pk, *p_k;
+  sunrealtype *col_k, *x_i, *x_k, v;
+
+  /* permute x, based on pivot information in p */
+  for (k = 0; k < n; k++)
+  {
+    p_k = p + k * nb;
+    for (b = 0; b < nb; b++)
+    {
+      pk             = p_k[b];
+      v              = x[k * nb + b];
+      x[k * nb + b]  = x[pk * nb + b];
+      x[pk * nb + b] = v;
+    }
+  }
+
+  /* solve Ly = x, store solution y in x */
+  for (k = 0; k < n - 1; k++)
+  {
+    col_k = a + k * n * nb;
+    x_k   = x + k * nb;
+    for (i = k + 1; i < n; i++)
+    {
+      x_i = x + i * nb;
+      for (b = 0; b < nb; b++) { x_i[b] -= col_k[i * nb + b] * x_k[b]; }
+    }
+  }
+
+  /* solve Ux = y, store solution x in x */
+  for (k = n - 1; k >= 0; k--)
+  {
+    col_k = a + k * n * nb;
+    x_k   = x + k * nb;
+    for (b = 0; b < nb; b++) { x_k[b] /= col_k[k * nb + b]; }
+    for (i = 0; i < k; i++)
+    {
+      x_i = x + i * nb;
+      for (b = 0; b < nb; b++) { x_i[b] -= col_k[i * nb + b] * x_k[b]; }
+    }
+  }
+}
@@ -36,9 +36,38 @@
  * -----------------------------------------------------------------
  */
 
+/*
+ * Content with the pipelined Gram-Schmidt workspace, which is kept out of the
+ * public content structure. The public content is the first member, so
+ * S->content can be used as either type.
+ */
+
+struct spgmrContentPriv
+{
+  struct _SUNLinearSolverContent_SPGMR content;
+
+  N_Vector* Z;        /* A-tilde applied to the Krylov basis vectors   */
+  sunrealtype* zdots; /* inner products of Z[k] with V[0..k] and Z[k] */
+  sunrealtype* zerr;  /* estimated rounding errors in Z                */
+};
+
 #define SPGMR_CONTENT(S) ((SUNLinearSolverContent_SPGMR)(S->content))
+#define SPGMR_PRIV(S)    ((struct spgmrContentPriv*)(S->content))
 #define LASTFLAG(S)      (SPGMR_CONTENT(S)->last_flag)
 
+/*
+ * -----------------------------------------------------------------
+ * private functions
+ * -----------------------------------------------------------------
+ */
+
+static int spgmrATilde(SUNLinearSolver S, N_Vector v, N_Vector w,
+                       sunrealtype delta);
+static SUNErrCode spgmrDotsBegin(SUNLinearSolver S, int k, void** request);
+static int spgmrPipelinedArnoldi(SUNLinearSolver S, sunrealtype delta,
+                                 sunrealtype r_norm, int* krydim,
+                                 sunrealtype* rho, sunbooleantype* converged);
+
 /*
  * -----------------------------------------------------------------
  * exported functions
@@ -94,7 +123,8 @@ SUNLinearSolver SUNLinSol_SPGMR(N_Vector y, int pretype, int maxl,
 
   /* Create content */
   content = NULL;
-  content = (SUNLinearSolverContent_SPGMR)malloc(sizeof *content);
+  content =
+    (SUNLinearSolverContent_SPGMR)malloc(sizeof(struct spgmrContentPriv));
   SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
 
   /* Attach content */
@@ -124,6 +154,9 @@ SUNLinearSolver SUNLinSol_SPGMR(N_Vector y, int pretype, int maxl,
   content->yg           = NULL;
   content->cv           = NULL;
   content->Xv           = NULL;
+  SPGMR_PRIV(S)->Z     = NULL;
+  SPGMR_PRIV(S)->zdots = NULL;
+  SPGMR_PRIV(S)->zerr  = NULL;
 
   /* Allocate content */
   content->xcor = N_VClone(y);
@@ -159,7 +192,8 @@ SUNErrCode SUNLinSol_SPGMRSetGSType(SUNLinearSolver S, int gstype)
 {
   SUNFunctionBegin(S->sunctx);
   /* Check for legal gstype */
-  SUNAssert(gstype == SUN_MODIFIED_GS || gstype == SUN_CLASSICAL_GS,
+  SUNAssert(gstype == SUN_MODIFIED_GS || gstype == SUN_CLASSICAL_GS ||
+              gstype == SUN_PIPELINED_GS,
             SUN_ERR_ARG_OUTOFRANGE);
 
   /* Set pretype */
@@ -277,6 +311,31 @@ SUNErrCode SUNLinSolInitialize_SPGMR(SUNLinearSolver S)
     SUNAssert(content->Xv, SUN_ERR_MALLOC_FAIL);
   }
 
+  /*    Z vectors, inner products, and error estimates for pipelined
+        Gram-Schmidt */
+  if (content->gstype == SUN_PIPELINED_GS)
+  {
+    if (SPGMR_PRIV(S)->Z == NULL)
+    {
+      SPGMR_PRIV(S)->Z = N_VCloneVectorArray(content->maxl, content->vtemp);
+      SUNCheckLastErr();
+    }
+
+    if (SPGMR_PRIV(S)->zdots == NULL)
+    {
+      SPGMR_PRIV(S)->zdots =
+        (sunrealtype*)malloc((content->maxl + 1) * sizeof(sunrealtype));
+      SUNAssert(SPGMR_PRIV(S)->zdots, SUN_ERR_MALLOC_FAIL);
+    }
+
+    if (SPGMR_PRIV(S)->zerr == NULL)
+    {
+      SPGMR_PRIV(S)->zerr =
+        (sunrealtype*)malloc(content->maxl * sizeof(sunrealtype));
+      SUNAssert(SPGMR_PRIV(S)->zerr, SUN_ERR_MALLOC_FAIL);
+    }
+  }
+
   return SUN_SUCCESS;
 }
 
@@ -410,6 +469,13 @@ int SUNLinSolSolve_SPGMR(SUNLinearSolver S, SUNDIALS_MAYBE_UNUSED SUNMatrix A,
   /* If preconditioning, check if psolve has been set */
   SUNAssert(!(preOnLeft || preOnRight) || psolve, SUN_ERR_ARG_CORRUPT);
 
+  /* Allocate the pipelined Gram-Schmidt workspace if the Gram-Schmidt type
+     was changed after initialization */
+  if (gstype == SUN_PIPELINED_GS && SPGMR_PRIV(S)->Z == NULL)
+  {
+    SUNCheckCall(SUNLinSolInitialize_SPGMR(S));
+  }
+
   SUNLogInfo(S->sunctx->logger, "linear-solver", "solver = spgmr");
 
   SUNLogInfo(S->sunctx->logger, "begin-linear-iterate", "");
@@ -516,8 +582,21 @@ int SUNLinSolSolve_SPGMR(SUNLinearSolver S, SUNDIALS_MAYBE_UNUSED SUNMatrix A,
     N_VScale(ONE / r_norm, V[0], V[0]);
     SUNCheckLastErr();
 
-    /* Inner loop: generate Krylov sequence and Arnoldi basis */
-    for (l = 0; l < l_max; l++)
+    /* Inner loop: generate Krylov sequence and Arnoldi basis. The pipelined
+       variant runs its own loop, so the one below is skipped. */
+    if (gstype == SUN_PIPELINED_GS)
+    {
+      status = spgmrPipelinedArnoldi(S, delta, r_norm, &krydim, &rho,
+                                     &converged);
+      if (status != SUN_SUCCESS)
+      {
+        *zeroguess  = SUNFALSE;
+        LASTFLAG(S) = status;
+        return (LASTFLAG(S));
+      }
+    }
+
+    for (l = 0; gstype != SUN_PIPELINED_GS && l < l_max; l++)
     {
       SUNLogInfo(S->sunctx->logger, "begin-linear-iterate", "");
 
@@ -854,6 +933,11 @@ SUNErrCode SUNLinSolSpace_SPGMR(SUNLinearSolver S, long int* lenrwLS,
   else { lrw1 = liw1 = 0; }
   *lenrwLS = lrw1 * (maxl + 5) + maxl * (maxl + 5) + 2;
   *leniwLS = liw1 * (maxl + 5);
+  if (SPGMR_PRIV(S)->Z)
+  {
+    *lenrwLS += lrw1 * maxl + 2 * maxl + 1;
+    *leniwLS += liw1 * maxl;
+  }
   return SUN_SUCCESS;
 }
 
@@ -912,6 +996,21 @@ SUNErrCode SUNLinSolFree_SPGMR(SUNLinearSolver S)
       free(SPGMR_CONTENT(S)->Xv);
       SPGMR_CONTENT(S)->Xv = NULL;
     }
+    if (SPGMR_PRIV(S)->Z)
+    {
+      N_VDestroyVectorArray(SPGMR_PRIV(S)->Z, SPGMR_CONTENT(S)->maxl);
+      SPGMR_PRIV(S)->Z = NULL;
+    }
+    if (SPGMR_PRIV(S)->zdots)
+    {
+      free(SPGMR_PRIV(S)->zdots);
+      SPGMR_PRIV(S)->zdots = NULL;
+    }
+    if (SPGMR_PRIV(S)->zerr)
+    {
+      free(SPGMR_PRIV(S)->zerr);
+      SPGMR_PRIV(S)->zerr = NULL;
+    }
     free(S->content);
     S->content = NULL;
   }
@@ -924,3 +1023,324 @@ SUNErrCode SUNLinSolFree_SPGMR(SUNLinearSolver S)
   S = NULL;
   return SUN_SUCCESS;
 }
+
+/*
+ * -----------------------------------------------------------------
+ * private functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Function to apply A-tilde = s1 P1_inv A P2_inv s2_inv to v, storing the
+ * result in w. The vtemp vector is used as workspace, so v and w must differ
+ * from vtemp and from each other.
+ */
+
+static int spgmrATilde(SUNLinearSolver S, N_Vector v, N_Vector w,
+                       sunrealtype delta)
+{
+  SUNFunctionBegin(S->sunctx);
+  N_Vector vtemp, s1, s2;
+  void *A_data, *P_data;
+  SUNATimesFn atimes;
+  SUNPSolveFn psolve;
+  int pretype, status;
+
+  vtemp   = SPGMR_CONTENT(S)->vtemp;
+  s1      = SPGMR_CONTENT(S)->s1;
+  s2      = SPGMR_CONTENT(S)->s2;
+  A_data  = SPGMR_CONTENT(S)->ATData;
+  P_data  = SPGMR_CONTENT(S)->PData;
+  atimes  = SPGMR_CONTENT(S)->ATimes;
+  psolve  = SPGMR_CONTENT(S)->Psolve;
+  pretype = SPGMR_CONTENT(S)->pretype;
+
+  /* Apply right scaling: vtemp = s2_inv v */
+  if (s2)
+  {
+    N_VDiv(v, s2, vtemp);
+    SUNCheckLastErr();
+  }
+  else
+  {
+    N_VScale(ONE, v, vtemp);
+    SUNCheckLastErr();
+  }
+
+  /* Apply right preconditioner: vtemp = P2_inv s2_inv v */
+  if (pretype == SUN_PREC_RIGHT || pretype == SUN_PREC_BOTH)
+  {
+    N_VScale(ONE, vtemp, w);
+    SUNCheckLastErr();
+    status = psolve(P_data, w, vtemp, delta, SUN_PREC_RIGHT);
+    if (status != 0)
+    {
+      SUNLogInfo(S->sunctx->logger, "end-linear-iterate",
+                 "status = failed preconditioner solve, retval = %d", status);
+
+      return (status < 0) ? SUNLS_PSOLVE_FAIL_UNREC : SUNLS_PSOLVE_FAIL_REC;
+    }
+  }
+
+  /* Apply A: w = A P2_inv s2_inv v */
+  status = atimes(A_data, vtemp, w);
+  if (status != 0)
+  {
+    SUNLogInfo(S->sunctx->logger, "end-linear-iterate",
+               "status = failed matvec, retval = %d", status);
+
+    return (status < 0) ? SUNLS_ATIMES_FAIL_UNREC : SUNLS_ATIMES_FAIL_REC;
+  }
+
+  /* Apply left preconditioning: vtemp = P1_inv A P2_inv s2_inv v */
+  if (pretype == SUN_PREC_LEFT || pretype == SUN_PREC_BOTH)
+  {
+    status = psolve(P_data, w, vtemp, delta, SUN_PREC_LEFT);
+    if (status != 0)
+    {
+      SUNLogInfo(S->sunctx->logger, "end-linear-iterate",
+                 "status = failed preconditioner solve, retval = %d", status);
+
+      return (status < 0) ? SUNLS_PSOLVE_FAIL_UNREC : SUNLS_PSOLVE_FAIL_REC;
+    }
+  }
+  else
+  {
+    N_VScale(ONE, w, vtemp);
+    SUNCheckLastErr();
+  }
+
+  /* Apply left scaling: w = s1 P1_inv A P2_inv s2_inv v */
+  if (s1)
+  {
+    N_VProd(s1, vtemp, w);
+    SUNCheckLastErr();
+  }
+  else
+  {
+    N_VScale(ONE, vtemp, w);
+    SUNCheckLastErr();
+  }
+
+  return SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to start computing the inner products of Z[k] with V[0], ..., V[k]
+ * and with itself, stored in zdots[0], ..., zdots[k+1]. When the vector
+ * supports non-blocking reductions, request is set to the pending reduction
+ * and zdots must not be accessed until it is completed with
+ * N_VDotProdMultiAllReduceEnd. Otherwise, the inner products are computed
+ * right away and request is set to NULL.
+ */
+
+static SUNErrCode spgmrDotsBegin(SUNLinearSolver S, int k, void** request)
+{
+  SUNFunctionBegin(S->sunctx);
+  N_Vector *V, z, *Xv;
+  sunrealtype* dots;
+  int j;
+
+  V    = SPGMR_CONTENT(S)->V;
+  z    = SPGMR_PRIV(S)->Z[k];
+  Xv   = SPGMR_CONTENT(S)->Xv;
+  dots = SPGMR_PRIV(S)->zdots;
+
+  for (j = 0; j <= k; j++) { Xv[j] = V[j]; }
+  Xv[k + 1] = z;
+
+  if (z->ops->nvdotprodmultilocal && z->ops->nvdotprodmultiallreducebegin &&
+      z->ops->nvdotprodmultiallreduceend)
+  {
+    SUNCheckCall(N_VDotProdMultiLocal(k + 2, z, Xv, dots));
+    SUNCheckCall(N_VDotProdMultiAllReduceBegin(k + 2, z, dots, request));
+  }
+  else
+  {
+    SUNCheckCall(N_VDotProdMulti(k + 2, z, Xv, dots));
+    *request = NULL;
+  }
+
+  return SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to run the inner GMRES iterations with a pipelined classical
+ * Gram-Schmidt process (p1-GMRES). Alongside the Arnoldi vectors it keeps
+ * Z[k] = A-tilde V[k], so the inner products for column k can be computed
+ * from Z[k] before V[k+1] is known. Their global reduction is overlapped with
+ * computing A-tilde Z[k], from which Z[k+1] is obtained by the same recurrence
+ * that defines V[k+1]. The norm of the orthogonalized vector follows from the
+ * inner products and is recomputed explicitly when cancellation makes it
+ * unreliable.
+ *
+ * Rounding errors in the recurrence for Z are amplified by up to
+ * ||A-tilde|| / Hes[k+1][k] in each iteration. A running estimate of the
+ * error is kept and, once it could limit the attainable residual norm, the
+ * remaining iterations of the cycle use classical Gram-Schmidt with a
+ * blocking reduction. On entry, V[0] must be normalized and Hes must be zero.
+ */
+
+static int spgmrPipelinedArnoldi(SUNLinearSolver S, sunrealtype delta,
+                                 sunrealtype r_norm, int* krydim,
+                                 sunrealtype* rho, sunbooleantype* converged)
+{
+  SUNFunctionBegin(S->sunctx);
+  N_Vector *V, *Z, *Xv;
+  sunrealtype **Hes, *givens, *dots, *zerr, *cv;
+  sunrealtype rotation_product, znorm2, hsq, hinv, opnorm, err;
+  sunbooleantype pipelined;
+  int j, k, l_max, status;
+  int* nli;
+  void* request = NULL;
+
+  l_max  = SPGMR_CONTENT(S)->maxl;
+  V      = SPGMR_CONTENT(S)->V;
+  Z      = SPGMR_PRIV(S)->Z;
+  Hes    = SPGMR_CONTENT(S)->Hes;
+  givens = SPGMR_CONTENT(S)->givens;
+  dots   = SPGMR_PRIV(S)->zdots;
+  zerr   = SPGMR_PRIV(S)->zerr;
+  cv     = SPGMR_CONTENT(S)->cv;
+  Xv     = SPGMR_CONTENT(S)->Xv;
+  nli    = &(SPGMR_CONTENT(S)->numiters);
+
+  rotation_product = ONE;
+  pipelined        = SUNTRUE;
+  opnorm           = ZERO;
+
+  /* Z[0] = A-tilde V[0] and start the inner products for the first column */
+  status = spgmrATilde(S, V[0], Z[0], delta);
+  if (status != SUN_SUCCESS) { return status; }
+  zerr[0] = ZERO;
+
+  SUNCheckCall(spgmrDotsBegin(S, 0, &request));
+
+  for (k = 0; k < l_max; k++)
+  {
+    SUNLogInfo(S->sunctx->logger, "begin-linear-iterate", "");
+
+    (*nli)++;
+    *krydim = k + 1;
+
+    if (pipelined)
+    {
+      /* Apply A-tilde to Z[k] while the inner products are reduced */
+      if (k + 1 < l_max)
+      {
+        status = spgmrATilde(S, Z[k], Z[k + 1], delta);
+        if (status != SUN_SUCCESS)
+        {
+          if (request) { (void)N_VDotProdMultiAllReduceEnd(Z[k], request); }
+          return status;
+        }
+      }
+
+      if (request)
+      {
+        SUNCheckCall(N_VDotProdMultiAllReduceEnd(Z[k], request));
+        request = NULL;
+      }
+
+      /* Hes[j][k] = <Z[k], V[j]> and the squared norm of the orthogonalized
+         vector from the Pythagorean theorem */
+      znorm2 = dots[k + 1];
+      hsq    = znorm2;
+      for (j = 0; j <= k; j++)
+      {
+        Hes[j][k] = dots[j];
+        hsq -= dots[j] * dots[j];
+      }
+      opnorm = SUNMAX(opnorm, SUNRsqrt(znorm2));
+
+      /* V[k+1] = Z[k] - sum_j Hes[j][k] V[j] */
+      cv[0] = ONE;
+      Xv[0] = Z[k];
+      for (j = 0; j <= k; j++)
+      {
+        cv[j + 1] = -Hes[j][k];
+        Xv[j + 1] = V[j];
+      }
+      SUNCheckCall(N_VLinearCombination(k + 2, cv, Xv, V[k + 1]));
+
+      if (hsq <= SUNRsqrt(SUN_UNIT_ROUNDOFF) * znorm2)
+      {
+        hsq = N_VDotProd(V[k + 1], V[k + 1]);
+        SUNCheckLastErr();
+      }
+      Hes[k + 1][k] = SUNRsqrt(hsq);
+    }
+    else
+    {
+      /* V[k+1] = A-tilde V[k] orthogonalized against previous V[j] */
+      status = spgmrATilde(S, V[k], V[k + 1], delta);
+      if (status != SUN_SUCCESS) { return status; }
+
+      SUNCheckCall(
+        SUNClassicalGS(V, Hes, k + 1, l_max, &(Hes[k + 1][k]), cv, Xv));
+    }
+
+    /* Update the QR factorization of Hes */
+    if (SUNQRfact(*krydim, Hes, givens, k) != 0)
+    {
+      SUNLogInfo(S->sunctx->logger, "end-linear-iterate",
+                 "status = failed QR factorization");
+
+      return SUNLS_QRFACT_FAIL;
+    }
+
+    /* Update residual norm estimate; break if convergence test passes */
+    rotation_product *= givens[2 * k + 1];
+    SPGMR_CONTENT(S)->resnorm = *rho = SUNRabs(rotation_product * r_norm);
+
+    SUNLogInfo(S->sunctx->logger, "linear-iterate",
+               "cur-iter = %i, total-iters = %i, res-norm = %.16g", k + 1,
+               *nli, *rho);
+
+    if (*rho <= delta)
+    {
+      *converged = SUNTRUE;
+      break;
+    }
+
+    /* Normalize V[k+1] */
+    hinv = ONE / Hes[k + 1][k];
+    N_VScale(hinv, V[k + 1], V[k + 1]);
+    SUNCheckLastErr();
+
+    /* Z[k+1] = A-tilde V[k+1] = (A-tilde Z[k] - sum_j h[j][k] Z[j]) / h and
+       start the inner products for the next column. The QR factorization has
+       overwritten Hes[j][k], so the inner products are used for h[j][k]. */
+    if (pipelined && k + 1 < l_max)
+    {
+      err = opnorm * (zerr[k] + SUN_UNIT_ROUNDOFF);
+      for (j = 0; j <= k; j++) { err += SUNRabs(dots[j]) * zerr[j]; }
+      zerr[k + 1] = err * hinv;
+
+      /* Continue without pipelining if the error in Z[k+1] could keep the
+         residual norm from reaching the tolerance */
+      if (zerr[k + 1] * r_norm > SUN_RCONST(0.1) * delta)
+      {
+        pipelined = SUNFALSE;
+      }
+      else
+      {
+        cv[0] = hinv;
+        Xv[0] = Z[k + 1];
+        for (j = 0; j <= k; j++)
+        {
+          cv[j + 1] = -dots[j] * hinv;
+          Xv[j + 1] = Z[j];
+        }
+        SUNCheckCall(N_VLinearCombination(k + 2, cv, Xv, Z[k + 1]));
+
+        SUNCheckCall(spgmrDotsBegin(S, k + 1, &request));
+      }
+    }
+
+    SUNLogInfoIf(k < l_max - 1, S->sunctx->logger, "end-linear-iterate",
+                 "status = continue");
+  }
+
+  return SUN_SUCCESS;
+}
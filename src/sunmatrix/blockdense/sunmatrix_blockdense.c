@@ -0,0 +1,430 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation file for the block-diagonal dense
+ * implementation of the SUNMATRIX package.
+ * -----------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_errors.h>
+#include <sunmatrix/sunmatrix_blockdense.h>
+
+#include "sundials_macros.h"
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+/* Private function prototypes */
+static sunbooleantype compatibleMatrices(SUNMatrix A, SUNMatrix B);
+static sunbooleantype compatibleMatrixAndVectors(SUNMatrix A, N_Vector x,
+                                                 N_Vector y);
+
+/*
+ * -----------------------------------------------------------------
+ * exported functions
+ * -----------------------------------------------------------------
+ */
+
+/* ----------------------------------------------------------------------------
+ * Function to create a new block-diagonal dense matrix
+ */
+
+SUNMatrix SUNBlockDenseMatrix(sunindextype nblocks, sunindextype M,
+                              sunindextype N, SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+  SUNMatrix A;
+  SUNMatrixContent_BlockDense content;
+
+  /* return with NULL matrix on illegal dimension input */
+  SUNAssertNull(nblocks > 0 && N > 0 && M > 0, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* Create an empty matrix object */
+  A = NULL;
+  A = SUNMatNewEmpty(sunctx);
+  SUNCheckLastErrNull();
+
+  /* Attach operations */
+  A->ops->getid                    = SUNMatGetID_BlockDense;
+  A->ops->clone                    = SUNMatClone_BlockDense;
+  A->ops->destroy                  = SUNMatDestroy_BlockDense;
+  A->ops->zero                     = SUNMatZero_BlockDense;
+  A->ops->copy                     = SUNMatCopy_BlockDense;
+  A->ops->scaleadd                 = SUNMatScaleAdd_BlockDense;
+  A->ops->scaleaddi                = SUNMatScaleAddI_BlockDense;
+  A->ops->matvec                   = SUNMatMatvec_BlockDense;
+  A->ops->mathermitiantransposevec = SUNMatHermitianTransposeVec_BlockDense;
+  A->ops->space                    = SUNMatSpace_BlockDense;
+
+  /* Create content */
+  content = NULL;
+  content = (SUNMatrixContent_BlockDense)malloc(sizeof *content);
+  SUNAssertNull(content, SUN_ERR_MALLOC_FAIL);
+
+  /* Attach content */
+  A->content = content;
+
+  /* Fill content */
+  content->nblocks = nblocks;
+  content->M       = M;
+  content->N       = N;
+  content->ldata   = nblocks * M * N;
+  content->data    = NULL;
+
+  /* Allocate content */
+  content->data = (sunrealtype*)calloc(content->ldata, sizeof(sunrealtype));
+  SUNAssertNull(content->data, SUN_ERR_MALLOC_FAIL);
+
+  return (A);
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to print the block-diagonal dense matrix
+ */
+
+void SUNBlockDenseMatrix_Print(SUNMatrix A, FILE* outfile)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i, j, k;
+
+  SUNAssertVoid(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+
+  /* perform operation */
+  for (k = 0; k < SM_NBLOCKS_BD(A); k++)
+  {
+    fprintf(outfile, "\nBlock %ld:\n", (long int)k);
+    for (i = 0; i < SM_BLOCKROWS_BD(A); i++)
+    {
+      for (j = 0; j < SM_BLOCKCOLUMNS_BD(A); j++)
+      {
+        fprintf(outfile, SUN_FORMAT_E "  ", SM_ELEMENT_BD(A, k, i, j));
+      }
+      fprintf(outfile, "\n");
+    }
+  }
+  return;
+}
+
+/* ----------------------------------------------------------------------------
+ * Functions to access the contents of the block-diagonal dense matrix
+ */
+
+sunindextype SUNBlockDenseMatrix_Rows(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  return SM_NBLOCKS_BD(A) * SM_BLOCKROWS_BD(A);
+}
+
+sunindextype SUNBlockDenseMatrix_Columns(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  return SM_NBLOCKS_BD(A) * SM_BLOCKCOLUMNS_BD(A);
+}
+
+sunindextype SUNBlockDenseMatrix_BlockRows(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  return SM_BLOCKROWS_BD(A);
+}
+
+sunindextype SUNBlockDenseMatrix_BlockColumns(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  return SM_BLOCKCOLUMNS_BD(A);
+}
+
+sunindextype SUNBlockDenseMatrix_NumBlocks(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  return SM_NBLOCKS_BD(A);
+}
+
+sunindextype SUNBlockDenseMatrix_LData(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNoRet(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  return SM_LDATA_BD(A);
+}
+
+sunrealtype* SUNBlockDenseMatrix_Data(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNull(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  return SM_DATA_BD(A);
+}
+
+sunrealtype* SUNBlockDenseMatrix_Entry(SUNMatrix A, sunindextype i,
+                                       sunindextype j)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssertNull(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  return SM_ENTRY_BD(A, i, j);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * implementation of matrix operations
+ * -----------------------------------------------------------------
+ */
+
+SUNMatrix_ID SUNMatGetID_BlockDense(SUNDIALS_MAYBE_UNUSED SUNMatrix A)
+{
+  return SUNMATRIX_BLOCKDENSE;
+}
+
+SUNMatrix SUNMatClone_BlockDense(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNMatrix B = SUNBlockDenseMatrix(SM_NBLOCKS_BD(A), SM_BLOCKROWS_BD(A),
+                                    SM_BLOCKCOLUMNS_BD(A), A->sunctx);
+  SUNCheckLastErrNull();
+  return (B);
+}
+
+void SUNMatDestroy_BlockDense(SUNMatrix A)
+{
+  if (A == NULL) { return; }
+
+  /* free content */
+  if (A->content != NULL)
+  {
+    /* free data array */
+    if (SM_DATA_BD(A) != NULL)
+    {
+      free(SM_DATA_BD(A));
+      SM_DATA_BD(A) = NULL;
+    }
+    /* free content struct */
+    free(A->content);
+    A->content = NULL;
+  }
+
+  /* free ops and matrix */
+  if (A->ops)
+  {
+    free(A->ops);
+    A->ops = NULL;
+  }
+  free(A);
+  A = NULL;
+
+  return;
+}
+
+SUNErrCode SUNMatZero_BlockDense(SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i;
+  sunrealtype* Adata;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+
+  /* Perform operation A_ij = 0 */
+  Adata = SM_DATA_BD(A);
+  for (i = 0; i < SM_LDATA_BD(A); i++) { Adata[i] = ZERO; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatCopy_BlockDense(SUNMatrix A, SUNMatrix B)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i;
+  sunrealtype *Adata, *Bdata;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(SUNMatGetID(B) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrices(A, B), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* Perform operation B_ij = A_ij */
+  Adata = SM_DATA_BD(A);
+  Bdata = SM_DATA_BD(B);
+  for (i = 0; i < SM_LDATA_BD(A); i++) { Bdata[i] = Adata[i]; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatScaleAddI_BlockDense(sunrealtype c, SUNMatrix A)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i, j, k, nblocks;
+  sunrealtype* Aij;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+
+  /* Perform operation A = c*A + I */
+  nblocks = SM_NBLOCKS_BD(A);
+  for (j = 0; j < SM_BLOCKCOLUMNS_BD(A); j++)
+  {
+    for (i = 0; i < SM_BLOCKROWS_BD(A); i++)
+    {
+      Aij = SM_ENTRY_BD(A, i, j);
+      if (i == j)
+      {
+        for (k = 0; k < nblocks; k++) { Aij[k] = c * Aij[k] + ONE; }
+      }
+      else
+      {
+        for (k = 0; k < nblocks; k++) { Aij[k] *= c; }
+      }
+    }
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatScaleAdd_BlockDense(sunrealtype c, SUNMatrix A, SUNMatrix B)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i;
+  sunrealtype *Adata, *Bdata;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(SUNMatGetID(B) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrices(A, B), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* Perform operation A = c*A + B */
+  Adata = SM_DATA_BD(A);
+  Bdata = SM_DATA_BD(B);
+  for (i = 0; i < SM_LDATA_BD(A); i++) { Adata[i] = c * Adata[i] + Bdata[i]; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatMatvec_BlockDense(SUNMatrix A, N_Vector x, N_Vector y)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i, j, k, nblocks;
+  sunrealtype *xd, *yd, *Aij, *xj, *yi;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrixAndVectors(A, x, y), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* access vector data (return if NULL data pointers) */
+  xd = N_VGetArrayPointer(x);
+  SUNCheckLastErr();
+  yd = N_VGetArrayPointer(y);
+  SUNCheckLastErr();
+
+  SUNAssert(xd, SUN_ERR_MEM_FAIL);
+  SUNAssert(yd, SUN_ERR_MEM_FAIL);
+  SUNAssert(xd != yd, SUN_ERR_MEM_FAIL);
+
+  /* Perform operation y = Ax, one entry of all blocks at a time */
+  nblocks = SM_NBLOCKS_BD(A);
+  for (i = 0; i < SM_BLOCKROWS_BD(A) * nblocks; i++) { yd[i] = ZERO; }
+  for (j = 0; j < SM_BLOCKCOLUMNS_BD(A); j++)
+  {
+    xj = xd + j * nblocks;
+    for (i = 0; i < SM_BLOCKROWS_BD(A); i++)
+    {
+      Aij = SM_ENTRY_BD(A, i, j);
+      yi  = yd + i * nblocks;
+      for (k = 0; k < nblocks; k++) { yi[k] += Aij[k] * xj[k]; }
+    }
+  }
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatHermitianTransposeVec_BlockDense(SUNMatrix A, N_Vector x,
+                                                  N_Vector y)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i, j, k, nblocks;
+  sunrealtype *xd, *yd, *Aij, *xi, *yj;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNCheck(compatibleMatrixAndVectors(A, y, x), SUN_ERR_ARG_DIMSMISMATCH);
+
+  /* access vector data (return if NULL data pointers) */
+  xd = N_VGetArrayPointer(x);
+  SUNCheckLastErr();
+  yd = N_VGetArrayPointer(y);
+  SUNCheckLastErr();
+
+  SUNAssert(xd, SUN_ERR_MEM_FAIL);
+  SUNAssert(yd, SUN_ERR_MEM_FAIL);
+  SUNAssert(xd != yd, SUN_ERR_MEM_FAIL);
+
+  /* Perform operation y = A^T x, one entry of all blocks at a time */
+  nblocks = SM_NBLOCKS_BD(A);
+  for (j = 0; j < SM_BLOCKCOLUMNS_BD(A); j++)
+  {
+    yj = yd + j * nblocks;
+    for (k = 0; k < nblocks; k++) { yj[k] = ZERO; }
+    for (i = 0; i < SM_BLOCKROWS_BD(A); i++)
+    {
+      Aij = SM_ENTRY_BD(A, i, j);
+      xi  = xd + i * nblocks;
+      for (k = 0; k < nblocks; k++) { yj[k] += Aij[k] * xi[k]; }
+    }
+  }
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMatSpace_BlockDense(SUNMatrix A, long int* lenrw, long int* leniw)
+{
+  SUNFunctionBegin(A->sunctx);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BLOCKDENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(lenrw, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(leniw, SUN_ERR_ARG_CORRUPT);
+  *lenrw = SM_LDATA_BD(A);
+  *leniw = 4;
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * private functions
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_MAYBE_UNUSED
+static sunbooleantype compatibleMatrices(SUNMatrix A, SUNMatrix B)
+{
+  /* both matrices must have the same number and shape of blocks */
+  if ((SM_NBLOCKS_BD(A) != SM_NBLOCKS_BD(B)) ||
+      (SM_BLOCKROWS_BD(A) != SM_BLOCKROWS_BD(B)) ||
+      (SM_BLOCKCOLUMNS_BD(A) != SM_BLOCKCOLUMNS_BD(B)))
+  {
+    return SUNFALSE;
+  }
+
+  return SUNTRUE;
+}
+
+SUNDIALS_MAYBE_UNUSED
+static sunbooleantype compatibleMatrixAndVectors(SUNMatrix A, N_Vector x,
+                                                 N_Vector y)
+{
+  /* Vectors must provide nvgetarraypointer and cannot be a parallel vector */
+  if (!x->ops->nvgetarraypointer || !y->ops->nvgetarraypointer)
+  {
+    return SUNFALSE;
+  }
+
+  /* Check that the dimensions agree */
+  if ((N_VGetLength(x) != SM_NBLOCKS_BD(A) * SM_BLOCKCOLUMNS_BD(A)) ||
+      (N_VGetLength(y) != SM_NBLOCKS_BD(A) * SM_BLOCKROWS_BD(A)))
+  {
+    return SUNFALSE;
+  }
+
+  return SUNTRUE;
+}
@@ -45,6 +45,13 @@ static SUNErrCode Matvec_SparseCSR(SUNMatrix A, N_Vector x, N_Vector y);
 static SUNErrCode MatTransposeVec_SparseCSC(SUNMatrix A, N_Vector x, N_Vector y);
 static SUNErrCode MatTransposeVec_SparseCSR(SUNMatrix A, N_Vector x, N_Vector y);
 static SUNErrCode format_convert(const SUNMatrix A, SUNMatrix B);
+static sunindextype buildScaleAddMap(SUNMatrix A, SUNMatrix B, sunindextype N,
+                                     sunindextype* w, sunindextype* map);
+static sunbooleantype validScaleAddMap(SUNMatrix A, SUNMatrix B,
+                                       sunindextype N);
+static void scaleAddNumeric(sunrealtype c, SUNMatrix A, SUNMatrix B,
+                            sunindextype N);
+static int compareIndices(const void* a, const void* b);
 
 /*
  * -----------------------------------------------------------------
@@ -123,9 +130,11 @@ SUNMatrix SUNSparseMatrix(sunindextype M, sunindextype N, sunindextype NNZ,
     content->rowvals = NULL;
     content->colptrs = NULL;
   }
-  content->data      = NULL;
-  content->indexvals = NULL;
-  content->indexptrs = NULL;
+  content->data         = NULL;
+  content->indexvals    = NULL;
+  content->indexptrs    = NULL;
+  content->scaleadd_map = NULL;
+  content->scaleadd_nnz = 0;
 
   /* Allocate content */
   content->data = (sunrealtype*)calloc(NNZ, sizeof(sunrealtype));
@@ -537,6 +546,12 @@ void SUNMatDestroy_Sparse(SUNMatrix A)
       SM_CONTENT_S(A)->colptrs = NULL;
       SM_CONTENT_S(A)->rowptrs = NULL;
     }
+    /* free cached ScaleAdd map */
+    if (SM_CONTENT_S(A)->scaleadd_map)
+    {
+      free(SM_CONTENT_S(A)->scaleadd_map);
+      SM_CONTENT_S(A)->scaleadd_map = NULL;
+    }
     /* free content struct */
     free(A->content);
     A->content = NULL;
@@ -689,11 +704,9 @@ SUNErrCode SUNMatScaleAddI_Sparse(sunrealtype c, SUNMatrix A)
 
 SUNErrCode SUNMatScaleAdd_Sparse(sunrealtype c, SUNMatrix A, SUNMatrix B)
 {
-  sunindextype j, i, p, nz, newvals, M, N, cend;
-  sunbooleantype newmat;
-  sunindextype *w, *Ap, *Ai, *Bp, *Bi, *Cp, *Ci;
-  sunrealtype *x, *Ax, *Bx, *Cx;
-  SUNMatrix C;
+  sunindextype j, i, k, p, nz, newvals, M, N, cend, len;
+  sunindextype *w, *rows, *map, *Ap, *Ai, *Bp, *Bi;
+  sunrealtype *x, *Ax, *Bx;
   SUNFunctionBegin(A->sunctx);
 
   SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
@@ -728,61 +741,56 @@ SUNErrCode SUNMatScaleAdd_Sparse(sunrealtype c, SUNMatrix A, SUNMatrix B)
   Bx = SM_DATA_S(B);
   SUNAssert(Bx, SUN_ERR_ARG_CORRUPT);
 
-  /* create work arrays for row indices and nonzero column values */
-  w = (sunindextype*)malloc(M * sizeof(sunindextype));
-  SUNAssert(w, SUN_ERR_MALLOC_FAIL);
-  x = (sunrealtype*)malloc(M * sizeof(sunrealtype));
-  SUNAssert(x, SUN_ERR_MALLOC_FAIL);
-
-  /* determine if A already contains the sparsity pattern of B */
-  newvals = 0;
-  for (j = 0; j < N; j++)
+  /* if A and B are the same matrix, the patterns trivially match */
+  if (Ax == Bx)
   {
-    /* clear work array */
-    for (i = 0; i < M; i++) { w[i] = 0; }
-
-    /* scan column of A, incrementing w by one */
-    for (i = Ap[j]; i < Ap[j + 1]; i++) { w[Ai[i]] += 1; }
-
-    /* scan column of B, decrementing w by one */
-    for (i = Bp[j]; i < Bp[j + 1]; i++) { w[Bi[i]] -= 1; }
+    for (p = 0; p < Ap[N]; p++) { Ax[p] = c * Ax[p] + Ax[p]; }
+    return SUN_SUCCESS;
+  }
 
-    /* if any entry of w is negative, A doesn't contain B's sparsity,
-       so increment necessary storage counter */
-    for (i = 0; i < M; i++)
-    {
-      if (w[i] < 0) { newvals += 1; }
-    }
+  /* if the map from a previous call is still consistent with the sparsity
+     patterns of A and B, only the O(nnz) numeric phase is needed */
+  if (validScaleAddMap(A, B, N))
+  {
+    scaleAddNumeric(c, A, B, N);
+    return SUN_SUCCESS;
   }
 
-  /* If extra nonzeros required, check whether A has sufficient storage space
-     for new nonzero entries (so B can be inserted into existing storage) */
-  newmat = SUNFALSE; /* no reallocation needed */
-  if (newvals > (SM_NNZ_S(A) - Ap[N])) { newmat = SUNTRUE; }
+  /* otherwise, discard the stale map and perform the symbolic phase */
+  free(SM_CONTENT_S(A)->scaleadd_map);
+  SM_CONTENT_S(A)->scaleadd_map = NULL;
+  SM_CONTENT_S(A)->scaleadd_nnz = 0;
 
-  /* perform operation based on existing/necessary structure */
+  /* create work array for row (column) positions and the new map */
+  w = (sunindextype*)malloc(M * sizeof(sunindextype));
+  SUNAssert(w, SUN_ERR_MALLOC_FAIL);
+  map = (sunindextype*)malloc(SUNMAX(Bp[N], 1) * sizeof(sunindextype));
+  SUNAssert(map, SUN_ERR_MALLOC_FAIL);
 
-  /*   case 1: A already contains sparsity pattern of B */
-  if (newvals == 0)
+  /* locate B's nonzeros in A, counting those A is missing */
+  for (i = 0; i < M; i++) { w[i] = -1; }
+  newvals = buildScaleAddMap(A, B, N, w, map);
+
+  /* if extra nonzeros are required, insert them into A with zero values */
+  if (newvals > 0)
   {
-    /* iterate through columns, adding matrices */
-    for (j = 0; j < N; j++)
+    /* reallocate A if it has insufficient storage for the new entries */
+    if (newvals > (SM_NNZ_S(A) - Ap[N]))
     {
-      /* clear work array */
-      for (i = 0; i < M; i++) { x[i] = ZERO; }
+      SUNCheckCall(SUNSparseMatrix_Reallocate(A, Ap[N] + newvals));
+      Ai = SM_INDEXVALS_S(A);
+      Ax = SM_DATA_S(A);
+    }
 
-      /* scan column of B, updating work array */
-      for (i = Bp[j]; i < Bp[j + 1]; i++) { x[Bi[i]] = Bx[i]; }
+    /* create work arrays for the merged indices and values of a column */
+    rows = (sunindextype*)malloc(M * sizeof(sunindextype));
+    SUNAssert(rows, SUN_ERR_MALLOC_FAIL);
+    x = (sunrealtype*)malloc(M * sizeof(sunrealtype));
+    SUNAssert(x, SUN_ERR_MALLOC_FAIL);
 
-      /* scan column of A, updating array entries appropriately */
-      for (i = Ap[j]; i < Ap[j + 1]; i++) { Ax[i] = c * Ax[i] + x[Ai[i]]; }
-    }
+    /* w[i] == j marks row (column) i as already present in column (row) j */
+    for (i = 0; i < M; i++) { w[i] = -1; }
 
-    /*   case 2: A has sufficient storage, but does not already contain B's
-     * sparsity */
-  }
-  else if (!newmat)
-  {
     /* determine storage location where last column (row) should end */
     nz = Ap[N] + newvals;
 
@@ -794,35 +802,35 @@ SUNErrCode SUNMatScaleAdd_Sparse(sunrealtype c, SUNMatrix A, SUNMatrix B)
     /* iterate through columns (rows) backwards */
     for (j = N - 1; j >= 0; j--)
     {
-      /* clear out temporary arrays for this column (row) */
-      for (i = 0; i < M; i++)
-      {
-        w[i] = 0;
-        x[i] = SUN_RCONST(0.0);
-      }
+      len = 0;
 
       /* iterate down column (row) of A, collecting nonzeros */
       for (p = Ap[j]; p < cend; p++)
       {
-        w[Ai[p]] += 1;        /* indicate that row (column) is filled */
-        x[Ai[p]] = c * Ax[p]; /* collect/scale value */
+        w[Ai[p]]    = j;
+        rows[len++] = Ai[p];
+        x[Ai[p]]    = Ax[p];
       }
 
-      /* iterate down column of B, collecting nonzeros */
+      /* iterate down column (row) of B, collecting new nonzeros */
       for (p = Bp[j]; p < Bp[j + 1]; p++)
       {
-        w[Bi[p]] += 1;     /* indicate that row is filled */
-        x[Bi[p]] += Bx[p]; /* collect value */
+        if (w[Bi[p]] != j)
+        {
+          w[Bi[p]]    = j;
+          rows[len++] = Bi[p];
+          x[Bi[p]]    = ZERO;
+        }
       }
 
+      /* keep the indices within the column (row) sorted */
+      qsort(rows, (size_t)len, sizeof(sunindextype), compareIndices);
+
       /* fill entries of A with this column's (row's) data */
-      for (i = M - 1; i >= 0; i--)
+      for (k = len - 1; k >= 0; k--)
       {
-        if (w[i] > 0)
-        {
-          Ai[--nz] = i;
-          Ax[nz]   = x[i];
-        }
+        Ai[--nz] = rows[k];
+        Ax[nz]   = x[rows[k]];
       }
 
       /* store ptr past this col (row) from orig A, update value for new A */
@@ -830,92 +838,22 @@ SUNErrCode SUNMatScaleAdd_Sparse(sunrealtype c, SUNMatrix A, SUNMatrix B)
       Ap[j] = nz;
     }
 
-    /*   case 3: A must be reallocated with sufficient storage */
-  }
-  else
-  {
-    /* create new matrix for sum */
-    C = SUNSparseMatrix(SM_ROWS_S(A), SM_COLUMNS_S(A), Ap[N] + newvals,
-                        SM_SPARSETYPE_S(A), A->sunctx);
-    SUNCheckLastErr();
-
-    /* access data from CSR structures (return if failure) */
-    Cp = NULL;
-    Ci = NULL;
-    Cx = NULL;
-    Cp = SM_INDEXPTRS_S(C);
-    SUNAssert(Cp, SUN_ERR_ARG_CORRUPT);
-    Ci = SM_INDEXVALS_S(C);
-    SUNAssert(Ci, SUN_ERR_ARG_CORRUPT);
-    Cx = SM_DATA_S(C);
-    SUNAssert(Cx, SUN_ERR_ARG_CORRUPT);
-
-    /* initialize total nonzero count */
-    nz = 0;
-
-    /* iterate through columns (rows) */
-    for (j = 0; j < N; j++)
-    {
-      /* set current column (row) pointer to current # nonzeros */
-      Cp[j] = nz;
-
-      /* clear out temporary arrays for this column (row) */
-      for (i = 0; i < M; i++)
-      {
-        w[i] = 0;
-        x[i] = SUN_RCONST(0.0);
-      }
-
-      /* iterate down column of A, collecting nonzeros */
-      for (p = Ap[j]; p < Ap[j + 1]; p++)
-      {
-        w[Ai[p]] += 1;        /* indicate that row is filled */
-        x[Ai[p]] = c * Ax[p]; /* collect/scale value */
-      }
-
-      /* iterate down column of B, collecting nonzeros */
-      for (p = Bp[j]; p < Bp[j + 1]; p++)
-      {
-        w[Bi[p]] += 1;     /* indicate that row is filled */
-        x[Bi[p]] += Bx[p]; /* collect value */
-      }
-
-      /* fill entries of C with this column's data */
-      for (i = 0; i < M; i++)
-      {
-        if (w[i] > 0)
-        {
-          Ci[nz]   = i;
-          Cx[nz++] = x[i];
-        }
-      }
-    }
-
-    /* indicate end of data */
-    Cp[N] = nz;
-
-    /* update A's structure with C's values; nullify C's pointers */
-    SM_NNZ_S(A) = SM_NNZ_S(C);
-
-    free(SM_DATA_S(A));
-    SM_DATA_S(A) = SM_DATA_S(C);
-    SM_DATA_S(C) = NULL;
+    free(rows);
+    free(x);
 
-    free(SM_INDEXVALS_S(A));
-    SM_INDEXVALS_S(A) = SM_INDEXVALS_S(C);
-    SM_INDEXVALS_S(C) = NULL;
-
-    free(SM_INDEXPTRS_S(A));
-    SM_INDEXPTRS_S(A) = SM_INDEXPTRS_S(C);
-    SM_INDEXPTRS_S(C) = NULL;
-
-    /* clean up */
-    SUNMatDestroy_Sparse(C);
+    /* A now contains the sparsity pattern of B, rebuild the map */
+    for (i = 0; i < M; i++) { w[i] = -1; }
+    newvals = buildScaleAddMap(A, B, N, w, map);
+    SUNAssert(newvals == 0, SUN_ERR_ARG_CORRUPT);
   }
 
-  /* clean up */
   free(w);
-  free(x);
+
+  /* cache the map for subsequent calls and perform the numeric phase */
+  SM_CONTENT_S(A)->scaleadd_map = map;
+  SM_CONTENT_S(A)->scaleadd_nnz = Bp[N];
+
+  scaleAddNumeric(c, A, B, N);
 
   /* return success */
   return SUN_SUCCESS;
@@ -988,6 +926,106 @@ static sunbooleantype compatibleMatrices(SUNMatrix A, SUNMatrix B)
   return SUNTRUE;
 }
 
+/* -----------------------------------------------------------------
+ * Function to locate each nonzero of B within the sparsity pattern of A
+ * for SUNMatScaleAdd. On input, the work array w (length of the inner
+ * dimension) must be filled with -1. On output, map[k] holds the position
+ * in A of the k-th nonzero of B (when present) and the number of nonzeros
+ * of B missing from A is returned. The cost is O(nnz(A) + nnz(B)).
+ */
+
+static sunindextype buildScaleAddMap(SUNMatrix A, SUNMatrix B, sunindextype N,
+                                     sunindextype* w, sunindextype* map)
+{
+  sunindextype j, k, p, newvals;
+  sunindextype* Ap = SM_INDEXPTRS_S(A);
+  sunindextype* Ai = SM_INDEXVALS_S(A);
+  sunindextype* Bp = SM_INDEXPTRS_S(B);
+  sunindextype* Bi = SM_INDEXVALS_S(B);
+
+  newvals = 0;
+  for (j = 0; j < N; j++)
+  {
+    /* record the position of each row (column) index in this column (row) of
+       A; positions stored for earlier columns (rows) are all below Ap[j] */
+    for (p = Ap[j]; p < Ap[j + 1]; p++) { w[Ai[p]] = p; }
+
+    /* scan column (row) of B, marking missing entries with -(j+2) so that
+       they are only counted once */
+    for (k = Bp[j]; k < Bp[j + 1]; k++)
+    {
+      p = w[Bi[k]];
+      if (p >= Ap[j]) { map[k] = p; }
+      else if (p != -(j + 2))
+      {
+        w[Bi[k]] = -(j + 2);
+        newvals++;
+      }
+    }
+  }
+
+  return newvals;
+}
+
+/* -----------------------------------------------------------------
+ * Function to check if the cached SUNMatScaleAdd map of A still
+ * describes where every nonzero of B lives in A. This detects any
+ * change in the sparsity pattern of A or B since the map was built.
+ */
+
+static sunbooleantype validScaleAddMap(SUNMatrix A, SUNMatrix B, sunindextype N)
+{
+  sunindextype j, k, p;
+  sunindextype* map = SM_CONTENT_S(A)->scaleadd_map;
+  sunindextype* Ap  = SM_INDEXPTRS_S(A);
+  sunindextype* Ai  = SM_INDEXVALS_S(A);
+  sunindextype* Bp  = SM_INDEXPTRS_S(B);
+  sunindextype* Bi  = SM_INDEXVALS_S(B);
+
+  if (map == NULL) { return SUNFALSE; }
+  if (SM_CONTENT_S(A)->scaleadd_nnz != Bp[N]) { return SUNFALSE; }
+
+  for (j = 0; j < N; j++)
+  {
+    for (k = Bp[j]; k < Bp[j + 1]; k++)
+    {
+      p = map[k];
+      if (p < Ap[j] || p >= Ap[j + 1] || Ai[p] != Bi[k]) { return SUNFALSE; }
+    }
+  }
+
+  return SUNTRUE;
+}
+
+/* -----------------------------------------------------------------
+ * Function to compute A = c*A + B using the cached map of B into A
+ */
+
+static void scaleAddNumeric(sunrealtype c, SUNMatrix A, SUNMatrix B,
+                            sunindextype N)
+{
+  sunindextype p, k;
+  sunindextype* map = SM_CONTENT_S(A)->scaleadd_map;
+  sunindextype A_nz = (SM_INDEXPTRS_S(A))[N];
+  sunindextype B_nz = (SM_INDEXPTRS_S(B))[N];
+  sunrealtype* Ax   = SM_DATA_S(A);
+  sunrealtype* Bx   = SM_DATA_S(B);
+
+  for (p = 0; p < A_nz; p++) { Ax[p] *= c; }
+  for (k = 0; k < B_nz; k++) { Ax[map[k]] += Bx[k]; }
+}
+
+/* -----------------------------------------------------------------
+ * Comparison function for sorting sparse matrix indices with qsort
+ */
+
+static int compareIndices(const void* a, const void* b)
+{
+  sunindextype ia = *((const sunindextype*)a);
+  sunindextype ib = *((const sunindextype*)b);
+  return (ia > ib) - (ia < ib);
+}
+
 /* -----------------------------------------------------------------
  * Function to check compatibility of a SUNMatrix object with two
  * N_Vectors (A*x = b)
@@ -12,9 +12,11 @@
  * SUNDIALS Copyright End
  * -----------------------------------------------------------------
  * SUNDIALS memory helper implementation that uses the standard
- * system memory allocators.
+ * system memory allocators, optionally through size-class pools
+ * and a bump arena.
  * ----------------------------------------------------------------*/
 
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -27,19 +29,168 @@
 #include "sundials_debug.h"
 #include "sundials_macros.h"
 
+/* Alignment of pooled and arena allocations (one cache line) */
+#define SYSPOOL_ALIGNMENT 64
+
+/* Size classes: 64, 128, 192, 256, then four classes per power of two */
+#define SYSPOOL_NUM_CLASSES (4 + 4 * (8 * sizeof(size_t) - 9))
+
+/* A chunk of the bump arena; the usable memory follows the header */
+typedef struct sunArenaChunk_
+{
+  struct sunArenaChunk_* next;
+  char* base;
+  size_t size;
+  size_t used;
+}* sunArenaChunk;
+
 struct SUNMemoryHelper_Content_Sys_
 {
   unsigned long num_allocations;
   unsigned long num_deallocations;
   size_t bytes_allocated;
   size_t bytes_high_watermark;
+
+  /* size-class free lists of aligned blocks and a cache of SUNMemory objects */
+  sunbooleantype pooled;
+  void* free_blocks[SYSPOOL_NUM_CLASSES];
+  SUNMemory free_mems;
+
+  /* optional bump arena */
+  size_t arena_size;
+  sunArenaChunk arena_chunks;
+  sunArenaChunk arena_current;
+  unsigned long arena_num_live;
+  size_t arena_bytes_live;
 };
 
 typedef struct SUNMemoryHelper_Content_Sys_ SUNMemoryHelper_Content_Sys;
 
 #define SUNHELPER_CONTENT(h) ((SUNMemoryHelper_Content_Sys*)h->content)
 
-SUNMemoryHelper SUNMemoryHelper_Sys(SUNContext sunctx)
+static size_t sunRoundUp(size_t bytes, size_t align)
+{
+  return (bytes + align - 1) / align * align;
+}
+
+static void* sunAlignedAlloc(size_t bytes)
+{
+  void* raw = malloc(bytes + SYSPOOL_ALIGNMENT + sizeof(void*));
+  if (!raw) { return NULL; }
+  uintptr_t aligned = ((uintptr_t)raw + sizeof(void*) + SYSPOOL_ALIGNMENT - 1) &
+                      ~((uintptr_t)SYSPOOL_ALIGNMENT - 1);
+  ((void**)aligned)[-1] = raw;
+  return (void*)aligned;
+}
+
+static void sunAlignedFree(void* ptr)
+{
+  if (ptr) { free(((void**)ptr)[-1]); }
+}
+
+/* Returns the size class of an allocation and the block size of that class */
+static int sunSizeClass(size_t bytes, size_t* class_bytes)
+{
+  if (bytes <= 64)
+  {
+    *class_bytes = 64;
+    return 0;
+  }
+
+  int k = 7;
+  while (((size_t)1 << k) < bytes) { k++; }
+
+  size_t granularity = (k >= 9) ? ((size_t)1 << (k - 3)) : 64;
+  *class_bytes       = sunRoundUp(bytes, granularity);
+
+  if (k == 7) { return 1; }
+  if (k == 8) { return (int)(*class_bytes / 64) - 1; }
+  return 4 + 4 * (k - 9) +
+         (int)((*class_bytes - ((size_t)1 << (k - 1))) / granularity) - 1;
+}
+
+static sunbooleantype sunInArena(SUNMemoryHelper_Content_Sys* content, void* ptr)
+{
+  for (sunArenaChunk chunk = content->arena_chunks; chunk; chunk = chunk->next)
+  {
+    if ((char*)ptr >= chunk->base && (char*)ptr < chunk->base + chunk->size)
+    {
+      return SUNTRUE;
+    }
+  }
+  return SUNFALSE;
+}
+
+/* Carves a SUNMemory object and its data out of the arena */
+static SUNMemory sunArenaAlloc(SUNMemoryHelper_Content_Sys* content,
+                               size_t mem_size)
+{
+  size_t header = sunRoundUp(sizeof(struct SUNMemory_), SYSPOOL_ALIGNMENT);
+  size_t needed = header + sunRoundUp(mem_size, SYSPOOL_ALIGNMENT);
+
+  /* find a chunk with room, reusing chunks left over from a reset */
+  sunArenaChunk chunk = content->arena_current;
+  while (chunk && chunk->size - chunk->used < needed) { chunk = chunk->next; }
+
+  if (!chunk)
+  {
+    size_t size  = SUNMAX(content->arena_size, needed);
+    size_t chead = sunRoundUp(sizeof(struct sunArenaChunk_), SYSPOOL_ALIGNMENT);
+    chunk        = (sunArenaChunk)sunAlignedAlloc(chead + size);
+    if (!chunk) { return NULL; }
+    chunk->next = NULL;
+    chunk->base = (char*)chunk + chead;
+    chunk->size = size;
+    chunk->used = 0;
+
+    if (!content->arena_chunks) { content->arena_chunks = chunk; }
+    else
+    {
+      sunArenaChunk tail = content->arena_chunks;
+      while (tail->next) { tail = tail->next; }
+      tail->next = chunk;
+    }
+  }
+
+  content->arena_current = chunk;
+
+  SUNMemory mem = (SUNMemory)(chunk->base + chunk->used);
+  mem->ptr      = chunk->base + chunk->used + header;
+  mem->stride   = 1;
+  chunk->used += needed;
+
+  content->arena_num_live++;
+  content->arena_bytes_live += mem_size;
+
+  return mem;
+}
+
+static void sunArenaRewind(SUNMemoryHelper_Content_Sys* content)
+{
+  for (sunArenaChunk chunk = content->arena_chunks; chunk; chunk = chunk->next)
+  {
+    chunk->used = 0;
+  }
+  content->arena_current    = content->arena_chunks;
+  content->arena_num_live   = 0;
+  content->arena_bytes_live = 0;
+}
+
+static void sunArenaFree(SUNMemoryHelper_Content_Sys* content)
+{
+  sunArenaChunk chunk = content->arena_chunks;
+  while (chunk)
+  {
+    sunArenaChunk next = chunk->next;
+    sunAlignedFree(chunk);
+    chunk = next;
+  }
+  content->arena_chunks  = NULL;
+  content->arena_current = NULL;
+}
+
+static SUNMemoryHelper sunMemoryHelper_NewSys(SUNContext sunctx,
+                                              sunbooleantype pooled)
 {
   SUNFunctionBegin(sunctx);
 
@@ -67,10 +218,45 @@ SUNMemoryHelper SUNMemoryHelper_Sys(SUNContext sunctx)
   SUNHELPER_CONTENT(helper)->num_deallocations    = 0;
   SUNHELPER_CONTENT(helper)->bytes_allocated      = 0;
   SUNHELPER_CONTENT(helper)->bytes_high_watermark = 0;
+  SUNHELPER_CONTENT(helper)->pooled               = pooled;
+  SUNHELPER_CONTENT(helper)->free_mems            = NULL;
+  SUNHELPER_CONTENT(helper)->arena_size           = 0;
+  SUNHELPER_CONTENT(helper)->arena_chunks         = NULL;
+  SUNHELPER_CONTENT(helper)->arena_current        = NULL;
+  SUNHELPER_CONTENT(helper)->arena_num_live       = 0;
+  SUNHELPER_CONTENT(helper)->arena_bytes_live     = 0;
+  memset(SUNHELPER_CONTENT(helper)->free_blocks, 0,
+         sizeof(SUNHELPER_CONTENT(helper)->free_blocks));
 
   return helper;
 }
 
+SUNMemoryHelper SUNMemoryHelper_Sys(SUNContext sunctx)
+{
+  return sunMemoryHelper_NewSys(sunctx, SUNFALSE);
+}
+
+SUNMemoryHelper SUNMemoryHelper_SysPool(SUNContext sunctx)
+{
+  return sunMemoryHelper_NewSys(sunctx, SUNTRUE);
+}
+
+SUNErrCode SUNMemoryHelper_SetArenaSize_Sys(SUNMemoryHelper helper,
+                                            size_t arena_size)
+{
+  SUNFunctionBegin(helper->sunctx);
+
+  SUNMemoryHelper_Content_Sys* content = SUNHELPER_CONTENT(helper);
+
+  /* the arena cannot be resized while it holds live allocations */
+  if (content->arena_num_live > 0) { return SUN_ERR_ARG_INCOMPATIBLE; }
+
+  sunArenaFree(content);
+  content->arena_size = arena_size;
+
+  return SUN_SUCCESS;
+}
+
 SUNErrCode SUNMemoryHelper_Alloc_Sys(SUNMemoryHelper helper, SUNMemory* memptr,
                                      size_t mem_size, SUNMemoryType mem_type,
                                      SUNDIALS_MAYBE_UNUSED void* queue)
@@ -79,24 +265,54 @@ SUNErrCode SUNMemoryHelper_Alloc_Sys(SUNMemoryHelper helper, SUNMemory* memptr,
 
   SUNAssert(mem_type == SUNMEMTYPE_HOST, SUN_ERR_ARG_INCOMPATIBLE);
 
-  SUNMemory mem = SUNMemoryNewEmpty(helper->sunctx);
-  SUNCheckLastErr();
+  SUNMemoryHelper_Content_Sys* content = SUNHELPER_CONTENT(helper);
+
+  SUNMemory mem = NULL;
+
+  if (content->arena_size > 0)
+  {
+    mem = sunArenaAlloc(content, mem_size);
+    SUNAssert(mem, SUN_ERR_MALLOC_FAIL);
+  }
+  else
+  {
+    void* ptr = NULL;
+    if (content->pooled)
+    {
+      size_t class_bytes = 0;
+      int size_class     = sunSizeClass(mem_size, &class_bytes);
+      if (content->free_blocks[size_class])
+      {
+        ptr                              = content->free_blocks[size_class];
+        content->free_blocks[size_class] = *(void**)ptr;
+      }
+      else { ptr = sunAlignedAlloc(class_bytes); }
+    }
+    else { ptr = malloc(mem_size); }
+    SUNAssert(ptr, SUN_ERR_MALLOC_FAIL);
+
+    if (content->free_mems)
+    {
+      mem                = content->free_mems;
+      content->free_mems = (SUNMemory)mem->ptr;
+      mem->stride        = 1;
+    }
+    else
+    {
+      mem = SUNMemoryNewEmpty(helper->sunctx);
+      SUNCheckLastErr();
+    }
+    mem->ptr = ptr;
+  }
 
-  mem->ptr   = NULL;
   mem->own   = SUNTRUE;
   mem->type  = mem_type;
   mem->bytes = mem_size;
 
-  if (mem_type == SUNMEMTYPE_HOST)
-  {
-    mem->ptr = malloc(mem_size);
-    SUNAssert(mem->ptr, SUN_ERR_MALLOC_FAIL);
-    SUNHELPER_CONTENT(helper)->bytes_allocated += mem_size;
-    SUNHELPER_CONTENT(helper)->num_allocations++;
-    SUNHELPER_CONTENT(helper)->bytes_high_watermark =
-      SUNMAX(SUNHELPER_CONTENT(helper)->bytes_allocated,
-             SUNHELPER_CONTENT(helper)->bytes_high_watermark);
-  }
+  content->bytes_allocated += mem_size;
+  content->num_allocations++;
+  content->bytes_high_watermark = SUNMAX(content->bytes_allocated,
+                                         content->bytes_high_watermark);
 
   *memptr = mem;
   return SUN_SUCCESS;
@@ -126,18 +342,40 @@ SUNErrCode SUNMemoryHelper_Dealloc_Sys(SUNMemoryHelper helper, SUNMemory mem,
 
   SUNAssert(mem->type == SUNMEMTYPE_HOST, SUN_ERR_ARG_INCOMPATIBLE);
 
+  SUNMemoryHelper_Content_Sys* content = SUNHELPER_CONTENT(helper);
+
+  /* Arena memory is only reclaimed in bulk, once all of it is returned */
+  if (content->arena_chunks && sunInArena(content, mem))
+  {
+    content->num_deallocations++;
+    content->bytes_allocated -= mem->bytes;
+    content->arena_bytes_live -= mem->bytes;
+    if (--content->arena_num_live == 0) { sunArenaRewind(content); }
+    return SUN_SUCCESS;
+  }
+
   if (mem->ptr != NULL && mem->own)
   {
-    if (mem->type == SUNMEMTYPE_HOST)
+    content->num_deallocations++;
+    content->bytes_allocated -= mem->bytes;
+    if (content->pooled)
     {
-      SUNHELPER_CONTENT(helper)->num_deallocations++;
-      SUNHELPER_CONTENT(helper)->bytes_allocated -= mem->bytes;
-      free(mem->ptr);
-      mem->ptr = NULL;
+      size_t class_bytes = 0;
+      int size_class     = sunSizeClass(mem->bytes, &class_bytes);
+      *(void**)mem->ptr  = content->free_blocks[size_class];
+      content->free_blocks[size_class] = mem->ptr;
     }
+    else { free(mem->ptr); }
+    mem->ptr = NULL;
   }
 
-  free(mem);
+  if (content->pooled)
+  {
+    mem->ptr           = content->free_mems;
+    content->free_mems = mem;
+  }
+  else { free(mem); }
+
   return SUN_SUCCESS;
 }
 
@@ -169,8 +407,10 @@ SUNErrCode SUNMemoryHelper_GetAllocStats_Sys(
 SUNMemoryHelper SUNMemoryHelper_Clone_Sys(SUNMemoryHelper helper)
 {
   SUNFunctionBegin(helper->sunctx);
-  SUNMemoryHelper hclone = SUNMemoryHelper_Sys(helper->sunctx);
+  SUNMemoryHelper hclone =
+    sunMemoryHelper_NewSys(helper->sunctx, SUNHELPER_CONTENT(helper)->pooled);
   SUNCheckLastErrNull();
+  SUNHELPER_CONTENT(hclone)->arena_size = SUNHELPER_CONTENT(helper)->arena_size;
   return hclone;
 }
 
@@ -178,7 +418,28 @@ SUNErrCode SUNMemoryHelper_Destroy_Sys(SUNMemoryHelper helper)
 {
   if (helper)
   {
-    if (helper->content) { free(helper->content); }
+    if (helper->content)
+    {
+      SUNMemoryHelper_Content_Sys* content = SUNHELPER_CONTENT(helper);
+      for (size_t i = 0; i < SYSPOOL_NUM_CLASSES; i++)
+      {
+        void* block = content->free_blocks[i];
+        while (block)
+        {
+          void* next = *(void**)block;
+          sunAlignedFree(block);
+          block = next;
+        }
+      }
+      while (content->free_mems)
+      {
+        SUNMemory next = (SUNMemory)content->free_mems->ptr;
+        free(content->free_mems);
+        content->free_mems = next;
+      }
+      sunArenaFree(content);
+      free(helper->content);
+    }
     if (helper->ops) { free(helper->ops); }
     free(helper);
   }
@@ -32,6 +32,7 @@
 
 #include <nvector/nvector_manyvector.h>
 #include <nvector/nvector_serial.h>
+#include <sunadjointcheckpointscheme/sunadjointcheckpointscheme_binomial.h>
 #include <sunadjointcheckpointscheme/sunadjointcheckpointscheme_fixed.h>
 #include <sundials/sundials_adjointstepper.h>
 #include <sunmatrix/sunmatrix_dense.h>
@@ -62,6 +63,10 @@ struct ProgramArgs
   int order;
   int check_freq;
   sunbooleantype keep_checks;
+  int async_buffers;
+  int binomial_checks;
+  int multilevel_steps;
+  SUNDataCompression compression;
 };
 
 static int neg_rhs(sunrealtype t, N_Vector uvec, N_Vector udotvec, void* user_data)
@@ -186,6 +191,43 @@ static int adjoint_solution(SUNContext sunctx, SUNAdjointStepper adj_stepper,
   return 0;
 }
 
+static SUNAdjointCheckpointScheme create_checkpoint_scheme(
+  const ProgramArgs& args, int ncheck, SUNMemoryHelper mem_helper,
+  SUNContext sunctx)
+{
+  SUNAdjointCheckpointScheme checkpoint_scheme = NULL;
+  if (args.binomial_checks > 0)
+  {
+    SUNAdjointCheckpointScheme_Create_Binomial(SUNDATAIOMODE_INMEM, mem_helper,
+                                               args.binomial_checks, sunctx,
+                                               &checkpoint_scheme);
+    return checkpoint_scheme;
+  }
+
+  SUNAdjointCheckpointScheme_Create_Fixed(SUNDATAIOMODE_INMEM, mem_helper,
+                                          args.check_freq, ncheck,
+                                          args.keep_checks, sunctx,
+                                          &checkpoint_scheme);
+  if (args.async_buffers > 0)
+  {
+    SUNAdjointCheckpointScheme_EnableAsync_Fixed(checkpoint_scheme,
+                                                 args.async_buffers);
+  }
+  if (args.multilevel_steps > 0)
+  {
+    SUNAdjointCheckpointScheme_EnableMultilevel_Fixed(checkpoint_scheme,
+                                                      args.multilevel_steps, 2);
+  }
+  if (args.compression != SUNDATACOMPRESSION_NONE)
+  {
+    // lossy compression keeps the error of the states within the tolerances
+    SUNAdjointCheckpointScheme_EnableCompression_Fixed(checkpoint_scheme,
+                                                       args.compression,
+                                                       SUN_RCONST(1.0));
+  }
+  return checkpoint_scheme;
+}
+
 static void print_help(int argc, char* argv[], int exit_code)
 {
   if (exit_code) { fprintf(stderr, "%s: option not recognized\n", argv[0]); }
@@ -197,6 +239,15 @@ static void print_help(int argc, char* argv[], int exit_code)
   fprintf(stderr, "--check-freq <int>  how often to checkpoint (in steps)\n");
   fprintf(stderr,
           "--dont-keep         don't keep checkpoints around after loading\n");
+  fprintf(stderr,
+          "--async <int>       checkpoint asynchronously with n buffers\n");
+  fprintf(stderr,
+          "--binomial <int>    use binomial checkpointing with n checkpoints\n");
+  fprintf(stderr,
+          "--multilevel <int>  keep n checkpointed steps in memory, the rest "
+          "in a file\n");
+  fprintf(stderr,
+          "--compress <mode>   compress checkpoints (lossless or lossy)\n");
   fprintf(stderr, "--help              print these options\n");
   exit(exit_code);
 }
@@ -214,6 +265,33 @@ static void parse_args(int argc, char* argv[], ProgramArgs* args)
       args->check_freq = atoi(argv[++argi]);
     }
     else if (!strcmp(arg, "--dont-keep")) { args->keep_checks = SUNFALSE; }
+    else if (!strcmp(arg, "--async"))
+    {
+      args->async_buffers = atoi(argv[++argi]);
+    }
+    else if (!strcmp(arg, "--binomial"))
+    {
+      args->binomial_checks = atoi(argv[++argi]);
+      // binomial checkpoints are always released once they are loaded
+      args->keep_checks = SUNFALSE;
+    }
+    else if (!strcmp(arg, "--multilevel"))
+    {
+      args->multilevel_steps = atoi(argv[++argi]);
+    }
+    else if (!strcmp(arg, "--compress"))
+    {
+      const char* mode = argv[++argi];
+      if (!strcmp(mode, "lossless"))
+      {
+        args->compression = SUNDATACOMPRESSION_LOSSLESS;
+      }
+      else if (!strcmp(mode, "lossy"))
+      {
+        args->compression = SUNDATACOMPRESSION_LOSSY;
+      }
+      else { print_help(argc, argv, 1); }
+    }
     else if (!strcmp(arg, "--help")) { print_help(argc, argv, 0); }
     else { print_help(argc, argv, 1); }
   }
@@ -228,11 +306,15 @@ int main(int argc, char* argv[])
   SUNContext_PushErrHandler(sunctx, SUNAbortErrHandlerFn, NULL);
 
   ProgramArgs args;
-  args.tf          = SUN_RCONST(1.0);
-  args.dt          = SUN_RCONST(1e-4);
-  args.order       = 4;
-  args.keep_checks = SUNTRUE;
-  args.check_freq  = 2;
+  args.tf               = SUN_RCONST(1.0);
+  args.dt               = SUN_RCONST(1e-4);
+  args.order            = 4;
+  args.keep_checks      = SUNTRUE;
+  args.check_freq       = 2;
+  args.async_buffers    = 0;
+  args.binomial_checks  = 0;
+  args.multilevel_steps = 0;
+  args.compression      = SUNDATACOMPRESSION_NONE;
   parse_args(argc, argv, &args);
 
   // Create UserData and set the params
@@ -266,14 +348,12 @@ int main(int argc, char* argv[])
   // Enable checkpointing during the forward solution.
   // ncheck will be more than nsteps, but for testing purposes we try setting it
   // to nsteps and allow things to be resized automatically.
-  const int check_interval                     = args.check_freq;
   const int ncheck                             = nsteps;
   const sunbooleantype keep_check              = args.keep_checks;
   SUNAdjointCheckpointScheme checkpoint_scheme = NULL;
   SUNMemoryHelper mem_helper                   = SUNMemoryHelper_Sys(sunctx);
-  SUNAdjointCheckpointScheme_Create_Fixed(SUNDATAIOMODE_INMEM, mem_helper,
-                                          check_interval, ncheck, keep_check,
-                                          sunctx, &checkpoint_scheme);
+  checkpoint_scheme = create_checkpoint_scheme(args, ncheck, mem_helper,
+                                               sunctx);
   ARKodeSetAdjointCheckpointScheme(arkode_mem, checkpoint_scheme);
 
   //
@@ -364,9 +444,8 @@ int main(int argc, char* argv[])
   arkode_mem = ERKStepCreate(neg_rhs, tau0, u, sunctx);
   ARKodeSetOrder(arkode_mem, order);
   ARKodeSetMaxNumSteps(arkode_mem, nsteps + 1);
-  SUNAdjointCheckpointScheme_Create_Fixed(SUNDATAIOMODE_INMEM, mem_helper,
-                                          check_interval, ncheck, keep_check,
-                                          sunctx, &checkpoint_scheme);
+  checkpoint_scheme = create_checkpoint_scheme(args, ncheck, mem_helper,
+                                               sunctx);
   ARKodeSetAdjointCheckpointScheme(arkode_mem, checkpoint_scheme);
 
   forward_solution(sunctx, arkode_mem, tau0, tauf, -dt, u);
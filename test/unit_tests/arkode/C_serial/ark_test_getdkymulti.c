@@ -0,0 +1,172 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for ARKodeGetDkyMulti. A system of decoupled linear equations is
+ * integrated in one-step mode with the Hermite and Lagrange interpolants of
+ * each degree. After each step the derivatives of the interpolating polynomial
+ * are evaluated at several times within the last step with ARKodeGetDkyMulti
+ * and with repeated calls to ARKodeGetDky. The results must agree to roundoff,
+ * relative to the scale of the interpolation coefficients.
+ * ---------------------------------------------------------------------------*/
+
+#include <arkode/arkode_erkstep.h>
+#include <nvector/nvector_serial.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sundials/sundials_math.h>
+
+#define NEQ   20
+#define NT    5
+#define NSTEP 20
+#define ZERO  SUN_RCONST(0.0)
+#define ONE   SUN_RCONST(1.0)
+
+/* y_i' = -(i + 1) y_i / 10 */
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* y_data    = N_VGetArrayPointer(y);
+  sunrealtype* ydot_data = N_VGetArrayPointer(ydot);
+  sunindextype i;
+
+  for (i = 0; i < NEQ; i++)
+  {
+    ydot_data[i] = -(i + 1) * y_data[i] / SUN_RCONST(10.0);
+  }
+  return 0;
+}
+
+/* Integrates the problem with the given interpolant and returns the maximum
+   relative difference between ARKodeGetDkyMulti and ARKodeGetDky, or a
+   negative value if an error occurs */
+static sunrealtype run(int itype, int degree, SUNContext sunctx)
+{
+  void* arkode_mem   = NULL;
+  N_Vector y         = NULL;
+  N_Vector tmp       = NULL;
+  N_Vector* dky      = NULL;
+  sunrealtype tret   = ZERO;
+  sunrealtype hlast  = ZERO;
+  sunrealtype t[NT]  = {ZERO};
+  sunrealtype err    = ZERO;
+  sunrealtype maxerr = ZERO;
+  int flag, k, m, n;
+
+  y = N_VNew_Serial(NEQ, sunctx);
+  if (!y) { return -ONE; }
+  N_VConst(ONE, y);
+
+  tmp = N_VClone(y);
+  if (!tmp) { return -ONE; }
+
+  dky = N_VCloneVectorArray(NT, y);
+  if (!dky) { return -ONE; }
+
+  arkode_mem = ERKStepCreate(ode_rhs, ZERO, y, sunctx);
+  if (!arkode_mem) { return -ONE; }
+
+  /* use a sixth order method so the interpolant degree is not limited */
+  if (ARKodeSetOrder(arkode_mem, 6)) { return -ONE; }
+  if (ARKodeSetInterpolantType(arkode_mem, itype)) { return -ONE; }
+  if (ARKodeSetInterpolantDegree(arkode_mem, degree)) { return -ONE; }
+  if (ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-10)))
+  {
+    return -ONE;
+  }
+
+  for (n = 0; n < NSTEP; n++)
+  {
+    flag = ARKodeEvolve(arkode_mem, SUN_RCONST(100.0), y, &tret, ARK_ONE_STEP);
+    if (flag < 0) { return -ONE; }
+
+    ARKodeGetLastStep(arkode_mem, &hlast);
+
+    /* times spanning the last step, including both end points */
+    for (m = 0; m < NT; m++) { t[m] = tret - hlast + (m * hlast) / (NT - 1); }
+
+    for (k = 0; k <= 3; k++)
+    {
+      flag = ARKodeGetDkyMulti(arkode_mem, NT, t, k, dky);
+      if (flag != ARK_SUCCESS)
+      {
+        fprintf(stderr, "ARKodeGetDkyMulti failed with flag %d\n", flag);
+        return -ONE;
+      }
+
+      for (m = 0; m < NT; m++)
+      {
+        flag = ARKodeGetDky(arkode_mem, t[m], k, tmp);
+        if (flag != ARK_SUCCESS)
+        {
+          fprintf(stderr, "ARKodeGetDky failed with flag %d\n", flag);
+          return -ONE;
+        }
+
+        /* difference scaled by hlast^k, since the interpolation
+           coefficients and their roundoff grow like hlast^{-k} */
+        N_VLinearSum(ONE, dky[m], -ONE, tmp, tmp);
+        err = N_VMaxNorm(tmp) * SUNRpowerI(SUNRabs(hlast), k);
+        if (err > maxerr) { maxerr = err; }
+      }
+    }
+  }
+
+  /* times outside of the last step are illegal */
+  t[NT - 1] = tret + SUN_RCONST(2.0) * hlast;
+  flag      = ARKodeGetDkyMulti(arkode_mem, NT, t, 0, dky);
+  if (flag != ARK_BAD_T)
+  {
+    fprintf(stderr, "Expected ARK_BAD_T, got %d\n", flag);
+    return -ONE;
+  }
+
+  ARKodeFree(&arkode_mem);
+  N_VDestroyVectorArray(dky, NT);
+  N_VDestroy(tmp);
+  N_VDestroy(y);
+
+  return maxerr;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  sunrealtype err   = ZERO;
+  int itype, degree;
+  int fails = 0;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx)) { return 1; }
+
+  for (itype = ARK_INTERP_HERMITE; itype <= ARK_INTERP_LAGRANGE; itype++)
+  {
+    for (degree = 0; degree <= ARK_INTERP_MAX_DEGREE; degree++)
+    {
+      err = run(itype, degree, sunctx);
+      printf("%s degree %d: max difference = %g\n",
+             (itype == ARK_INTERP_HERMITE) ? "Hermite" : "Lagrange", degree,
+             (double)err);
+      if (err < ZERO || err > SUN_RCONST(1.0e-10)) { fails++; }
+    }
+  }
+
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    fprintf(stderr, "ARKodeGetDkyMulti and ARKodeGetDky differ\n");
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
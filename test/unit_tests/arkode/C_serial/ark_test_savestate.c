@@ -0,0 +1,185 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for saving and loading the integrator state
+ * ---------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_erkstep.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+/* Forced nonlinear problem with a slow and a moderately fast component */
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* y_data    = N_VGetArrayPointer(y);
+  sunrealtype* ydot_data = N_VGetArrayPointer(ydot);
+  sunrealtype forcing    = (sunrealtype)cos((double)t);
+  ydot_data[0]           = -y_data[0] + y_data[1] * y_data[1];
+  ydot_data[1]           = SUN_RCONST(-10.0) * (y_data[1] - forcing);
+  return 0;
+}
+
+/* Creates an integrator with the settings shared by all runs */
+static void* create_arkode(N_Vector y, SUNContext sunctx)
+{
+  void* arkode_mem = NULL;
+
+  N_VConst(ONE, y);
+  arkode_mem = ERKStepCreate(ode_rhs, ZERO, y, sunctx);
+  if (!arkode_mem) { return NULL; }
+
+  if (ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-8)))
+  {
+    return NULL;
+  }
+
+  return arkode_mem;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx         = NULL;
+  N_Vector y                = NULL;
+  N_Vector y_ref            = NULL;
+  N_Vector y_other          = NULL;
+  void* arkode_mem          = NULL;
+  void* restart_mem         = NULL;
+  void* other_mem           = NULL;
+  void* buffer              = NULL;
+  size_t bytes              = 0;
+  long int nst_save         = 0;
+  long int nst_ref          = 0;
+  long int nst              = 0;
+  sunrealtype h_save        = ZERO;
+  sunrealtype h             = ZERO;
+  sunrealtype tret          = ZERO;
+  sunrealtype err           = ZERO;
+  const sunrealtype t_save  = SUN_RCONST(5.0);
+  const sunrealtype t_final = SUN_RCONST(10.0);
+  int flag                  = 0;
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (flag) { return 1; }
+
+  y = N_VNew_Serial(2, sunctx);
+  if (!y) { return 1; }
+
+  y_ref = N_VClone(y);
+  if (!y_ref) { return 1; }
+
+  y_other = N_VNew_Serial(3, sunctx);
+  if (!y_other) { return 1; }
+
+  /* Reference run, saving the state part way through */
+  arkode_mem = create_arkode(y, sunctx);
+  if (!arkode_mem) { return 1; }
+
+  flag = ARKodeEvolve(arkode_mem, t_save, y, &tret, ARK_NORMAL);
+  if (flag < 0) { return 1; }
+
+  flag = ARKodeGetStateSize(arkode_mem, &bytes);
+  if (flag) { return 1; }
+
+  buffer = malloc(bytes);
+  if (!buffer) { return 1; }
+
+  flag = ARKodeSaveState(arkode_mem, buffer, bytes - 1);
+  if (flag != ARK_ILL_INPUT)
+  {
+    fprintf(stderr, "Saving into a short buffer did not fail\n");
+    return 1;
+  }
+
+  flag = ARKodeSaveState(arkode_mem, buffer, bytes);
+  if (flag) { return 1; }
+
+  ARKodeGetNumSteps(arkode_mem, &nst_save);
+  ARKodeGetCurrentStep(arkode_mem, &h_save);
+
+  /* Loading the state into the same integrator only restarts the controller,
+     so the reference and restarted runs take identical steps */
+  flag = ARKodeLoadState(arkode_mem, buffer, bytes);
+  if (flag) { return 1; }
+
+  flag = ARKodeEvolve(arkode_mem, t_final, y_ref, &tret, ARK_NORMAL);
+  if (flag < 0) { return 1; }
+
+  ARKodeGetNumSteps(arkode_mem, &nst_ref);
+
+  /* Restarted run in a new integrator */
+  restart_mem = create_arkode(y, sunctx);
+  if (!restart_mem) { return 1; }
+
+  flag = ARKodeLoadState(restart_mem, buffer, bytes);
+  if (flag) { return 1; }
+
+  ARKodeGetNumSteps(restart_mem, &nst);
+  ARKodeGetCurrentStep(restart_mem, &h);
+
+  printf("saved:  nst = %ld, h = %g\n", nst_save, (double)h_save);
+  printf("loaded: nst = %ld, h = %g\n", nst, (double)h);
+
+  if (nst != nst_save || h != h_save)
+  {
+    fprintf(stderr, "The loaded state does not match the saved state\n");
+    return 1;
+  }
+
+  flag = ARKodeEvolve(restart_mem, t_final, y, &tret, ARK_NORMAL);
+  if (flag < 0) { return 1; }
+
+  ARKodeGetNumSteps(restart_mem, &nst);
+
+  N_VLinearSum(ONE, y, -ONE, y_ref, y);
+  err = N_VMaxNorm(y);
+
+  printf("steps after restart: %ld (reference %ld), max error = %g\n",
+         nst - nst_save, nst_ref - nst_save, (double)err);
+
+  if (err != ZERO || nst != nst_ref)
+  {
+    fprintf(stderr, "The restarted run does not match the reference run\n");
+    return 1;
+  }
+
+  /* A state of a problem with another size is rejected */
+  other_mem = create_arkode(y_other, sunctx);
+  if (!other_mem) { return 1; }
+
+  flag = ARKodeLoadState(other_mem, buffer, bytes);
+  if (flag != ARK_ILL_INPUT)
+  {
+    fprintf(stderr, "Loading a state of another size did not fail\n");
+    return 1;
+  }
+
+  free(buffer);
+  ARKodeFree(&other_mem);
+  ARKodeFree(&restart_mem);
+  ARKodeFree(&arkode_mem);
+  N_VDestroy(y_other);
+  N_VDestroy(y_ref);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
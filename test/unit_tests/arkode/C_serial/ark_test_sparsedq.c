@@ -0,0 +1,312 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the sparse difference quotient Jacobian with a given and a
+ * detected sparsity pattern. The solution and the number of RHS evaluations are
+ * compared to a run with a dense Jacobian. As a sparse direct solver may not be
+ * available, the sparse runs use a linear solver that copies the matrix into a
+ * dense matrix.
+ * ---------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_arkstep.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+#include "sunmatrix/sunmatrix_sparse.h"
+
+#define NEQ  40
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+/* Stiff reaction-diffusion problem with a tridiagonal Jacobian */
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* y_data    = N_VGetArrayPointer(y);
+  sunrealtype* ydot_data = N_VGetArrayPointer(ydot);
+  sunrealtype d          = SUN_RCONST(100.0);
+  sunrealtype left, right;
+  sunindextype i;
+
+  for (i = 0; i < NEQ; i++)
+  {
+    left         = (i > 0) ? y_data[i - 1] : ZERO;
+    right        = (i < NEQ - 1) ? y_data[i + 1] : ZERO;
+    ydot_data[i] = d * (left - SUN_RCONST(2.0) * y_data[i] + right) -
+                   y_data[i] * y_data[i];
+  }
+  return 0;
+}
+
+/* Linear solver copying a sparse matrix into a dense matrix */
+typedef struct
+{
+  SUNMatrix D;
+  SUNLinearSolver LS;
+}* DenseCopyContent;
+
+static SUNLinearSolver_Type DenseCopy_GetType(SUNLinearSolver S)
+{
+  return SUNLINEARSOLVER_DIRECT;
+}
+
+static int DenseCopy_Setup(SUNLinearSolver S, SUNMatrix A)
+{
+  DenseCopyContent content = (DenseCopyContent)S->content;
+  sunindextype* ptrs       = SUNSparseMatrix_IndexPointers(A);
+  sunindextype* vals       = SUNSparseMatrix_IndexValues(A);
+  sunrealtype* data        = SUNSparseMatrix_Data(A);
+  sunindextype j, p;
+
+  SUNMatZero(content->D);
+  for (j = 0; j < SUNSparseMatrix_NP(A); j++)
+  {
+    for (p = ptrs[j]; p < ptrs[j + 1]; p++)
+    {
+      if (SUNSparseMatrix_SparseType(A) == CSC_MAT)
+      {
+        SM_ELEMENT_D(content->D, vals[p], j) = data[p];
+      }
+      else { SM_ELEMENT_D(content->D, j, vals[p]) = data[p]; }
+    }
+  }
+
+  return SUNLinSolSetup(content->LS, content->D);
+}
+
+static int DenseCopy_Solve(SUNLinearSolver S, SUNMatrix A, N_Vector x,
+                           N_Vector b, sunrealtype tol)
+{
+  DenseCopyContent content = (DenseCopyContent)S->content;
+  return SUNLinSolSolve(content->LS, content->D, x, b, tol);
+}
+
+static SUNLinearSolver DenseCopy(N_Vector y, SUNMatrix D, SUNContext sunctx)
+{
+  SUNLinearSolver S        = NULL;
+  DenseCopyContent content = NULL;
+
+  S = SUNLinSolNewEmpty(sunctx);
+  if (!S) { return NULL; }
+
+  content = (DenseCopyContent)malloc(sizeof(*content));
+  if (!content) { return NULL; }
+
+  content->D  = D;
+  content->LS = SUNLinSol_Dense(y, D, sunctx);
+  if (!content->LS) { return NULL; }
+
+  S->content      = content;
+  S->ops->gettype = DenseCopy_GetType;
+  S->ops->setup   = DenseCopy_Setup;
+  S->ops->solve   = DenseCopy_Solve;
+
+  return S;
+}
+
+static void DenseCopy_Free(SUNLinearSolver S)
+{
+  DenseCopyContent content = (DenseCopyContent)S->content;
+  SUNLinSolFree(content->LS);
+  SUNLinSolFree(S);
+}
+
+/* Creates the tridiagonal pattern */
+static SUNMatrix tridiagonal_pattern(int sparsetype, SUNContext sunctx)
+{
+  SUNMatrix P        = SUNSparseMatrix(NEQ, NEQ, 3 * NEQ, sparsetype, sunctx);
+  sunindextype* ptrs = NULL;
+  sunindextype* vals = NULL;
+  sunindextype i, k, nnz = 0;
+
+  if (!P) { return NULL; }
+
+  /* the pattern is symmetric, so the CSC and CSR index arrays agree */
+  ptrs = SUNSparseMatrix_IndexPointers(P);
+  vals = SUNSparseMatrix_IndexValues(P);
+  for (i = 0; i < NEQ; i++)
+  {
+    ptrs[i] = nnz;
+    for (k = SUNMAX(0, i - 1); k <= SUNMIN(NEQ - 1, i + 1); k++)
+    {
+      vals[nnz++] = k;
+    }
+  }
+  ptrs[NEQ] = nnz;
+
+  return P;
+}
+
+/* Integrates the problem and returns the Jacobian and linear solver RHS
+   evaluation counts, or 1 if the integration fails */
+static int run(SUNMatrix A, SUNLinearSolver LS, SUNMatrix P,
+               sunbooleantype detect, N_Vector y, long int* nje,
+               long int* nfeLS, SUNContext sunctx)
+{
+  void* arkode_mem = NULL;
+  sunrealtype tret = ZERO;
+  sunindextype i;
+  int flag;
+
+  for (i = 0; i < NEQ; i++)
+  {
+    NV_Ith_S(y, i) = (sunrealtype)sin(3.14159265358979 * (i + 1) / (NEQ + 1));
+  }
+
+  arkode_mem = ARKStepCreate(NULL, ode_rhs, ZERO, y, sunctx);
+  if (!arkode_mem) { return 1; }
+
+  if (ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-8)))
+  {
+    return 1;
+  }
+  if (ARKodeSetLinearSolver(arkode_mem, LS, A)) { return 1; }
+  if (ARKodeSetJacEvalFrequency(arkode_mem, 5)) { return 1; }
+  if (P && ARKodeSetJacSparsity(arkode_mem, P)) { return 1; }
+  if (ARKodeSetJacSparsityDetection(arkode_mem, detect)) { return 1; }
+
+  flag = ARKodeEvolve(arkode_mem, ONE, y, &tret, ARK_NORMAL);
+  if (flag < 0) { return 1; }
+
+  ARKodeGetNumJacEvals(arkode_mem, nje);
+  ARKodeGetNumLinRhsEvals(arkode_mem, nfeLS);
+
+  ARKodeFree(&arkode_mem);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx  = NULL;
+  N_Vector y         = NULL;
+  N_Vector y_ref     = NULL;
+  SUNMatrix A        = NULL;
+  SUNMatrix D        = NULL;
+  SUNMatrix P        = NULL;
+  SUNLinearSolver LS = NULL;
+  void* arkode_mem   = NULL;
+  long int nje       = 0;
+  long int nfeLS     = 0;
+  sunrealtype tret   = ZERO;
+  sunrealtype err    = ZERO;
+  int sparsetypes[2] = {CSC_MAT, CSR_MAT};
+  int sparsetype     = 0;
+  sunbooleantype detect;
+  int flag           = 0;
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (flag) { return 1; }
+
+  y = N_VNew_Serial(NEQ, sunctx);
+  if (!y) { return 1; }
+
+  y_ref = N_VClone(y);
+  if (!y_ref) { return 1; }
+
+  D = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  if (!D) { return 1; }
+
+  /* Reference run with a dense Jacobian */
+  LS = SUNLinSol_Dense(y, D, sunctx);
+  if (!LS) { return 1; }
+
+  if (run(D, LS, NULL, SUNFALSE, y_ref, &nje, &nfeLS, sunctx)) { return 1; }
+  SUNLinSolFree(LS);
+
+  printf("dense:  nje = %ld, nfeLS = %ld\n", nje, nfeLS);
+
+  if (nfeLS != NEQ * nje)
+  {
+    fprintf(stderr, "Unexpected number of dense DQ RHS evaluations\n");
+    return 1;
+  }
+
+  LS = DenseCopy(y, D, sunctx);
+  if (!LS) { return 1; }
+
+  /* Runs with CSC and CSR matrices and a given or detected pattern. A
+     tridiagonal pattern needs 3 colors and detecting it 2 NEQ + 1 RHS
+     evaluations. */
+  for (int k = 0; k < 4; k++)
+  {
+    sparsetype = sparsetypes[k % 2];
+    detect     = (k >= 2);
+
+    A = SUNSparseMatrix(NEQ, NEQ, NEQ, sparsetype, sunctx);
+    if (!A) { return 1; }
+
+    P = detect ? NULL : tridiagonal_pattern(sparsetype, sunctx);
+    if (!detect && !P) { return 1; }
+
+    if (run(A, LS, P, detect, y, &nje, &nfeLS, sunctx)) { return 1; }
+
+    N_VLinearSum(ONE, y, -ONE, y_ref, y);
+    err = N_VMaxNorm(y);
+
+    printf("%s %s: nje = %ld, nfeLS = %ld, max difference = %g\n",
+           (sparsetype == CSC_MAT) ? "CSC" : "CSR",
+           detect ? "detected" : "given", nje, nfeLS, (double)err);
+
+    if (nfeLS != 3 * nje + (detect ? 2 * NEQ + 1 : 0))
+    {
+      fprintf(stderr, "Unexpected number of sparse DQ RHS evaluations\n");
+      return 1;
+    }
+
+    if (err > SUN_RCONST(1.0e-10))
+    {
+      fprintf(stderr, "The sparse and dense Jacobian runs differ\n");
+      return 1;
+    }
+
+    if (P) { SUNMatDestroy(P); }
+    SUNMatDestroy(A);
+  }
+
+  /* A sparse matrix without a pattern is rejected */
+  A = SUNSparseMatrix(NEQ, NEQ, 3 * NEQ, CSC_MAT, sunctx);
+  if (!A) { return 1; }
+
+  arkode_mem = ARKStepCreate(NULL, ode_rhs, ZERO, y, sunctx);
+  if (!arkode_mem) { return 1; }
+
+  if (ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-8)))
+  {
+    return 1;
+  }
+  if (ARKodeSetLinearSolver(arkode_mem, LS, A)) { return 1; }
+
+  flag = ARKodeEvolve(arkode_mem, ONE, y, &tret, ARK_NORMAL);
+  if (flag != ARK_LINIT_FAIL)
+  {
+    fprintf(stderr, "A sparse matrix without a pattern was not rejected\n");
+    return 1;
+  }
+
+  ARKodeFree(&arkode_mem);
+  DenseCopy_Free(LS);
+  SUNMatDestroy(A);
+  SUNMatDestroy(D);
+  N_VDestroy(y_ref);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,172 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the block-diagonal dense difference quotient Jacobian. An
+ * ensemble of Robertson problems with different rate constants is integrated
+ * with a block-dense matrix and linear solver. The solution and the number of
+ * RHS evaluations are compared to a run with a band Jacobian of the whole
+ * ensemble, which performs the same operations on the nonzero entries.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_blockdense.h"
+#include "sunlinsol/sunlinsol_band.h"
+#include "sunmatrix/sunmatrix_blockdense.h"
+#include "sunmatrix/sunmatrix_band.h"
+
+#define NBLOCKS  50
+#define NSPECIES 3
+#define NEQ      (NBLOCKS * NSPECIES)
+#define ZERO     SUN_RCONST(0.0)
+#define ONE      SUN_RCONST(1.0)
+
+/* Robertson problems, species i of system k is stored at i * NBLOCKS + k */
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* y_data    = N_VGetArrayPointer(y);
+  sunrealtype* ydot_data = N_VGetArrayPointer(ydot);
+  sunrealtype k1, r1, r2, r3;
+  sunindextype k;
+
+  for (k = 0; k < NBLOCKS; k++)
+  {
+    k1 = SUN_RCONST(0.04) * (ONE + SUN_RCONST(0.1) * k);
+    r1 = k1 * y_data[k];
+    r2 = SUN_RCONST(1.0e4) * y_data[NBLOCKS + k] * y_data[2 * NBLOCKS + k];
+    r3 = SUN_RCONST(3.0e7) * y_data[NBLOCKS + k] * y_data[NBLOCKS + k];
+
+    ydot_data[k]               = -r1 + r2;
+    ydot_data[NBLOCKS + k]     = r1 - r2 - r3;
+    ydot_data[2 * NBLOCKS + k] = r3;
+  }
+  return 0;
+}
+
+/* Integrates the problem and returns the Jacobian and linear solver RHS
+   evaluation counts, or 1 if the integration fails */
+static int run(SUNMatrix A, SUNLinearSolver LS, N_Vector y, long int* nje,
+               long int* nfeLS, SUNContext sunctx)
+{
+  void* cvode_mem  = NULL;
+  sunrealtype tret = ZERO;
+  sunindextype k;
+  int flag;
+
+  N_VConst(ZERO, y);
+  for (k = 0; k < NBLOCKS; k++) { NV_Ith_S(y, k) = ONE; }
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  if (CVodeInit(cvode_mem, ode_rhs, ZERO, y)) { return 1; }
+  if (CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-10)))
+  {
+    return 1;
+  }
+  if (CVodeSetLinearSolver(cvode_mem, LS, A)) { return 1; }
+
+  flag = CVode(cvode_mem, SUN_RCONST(10.0), y, &tret, CV_NORMAL);
+  if (flag < 0) { return 1; }
+
+  CVodeGetNumJacEvals(cvode_mem, nje);
+  CVodeGetNumLinRhsEvals(cvode_mem, nfeLS);
+
+  CVodeFree(&cvode_mem);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx  = NULL;
+  N_Vector y         = NULL;
+  N_Vector y_ref     = NULL;
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  long int nje       = 0;
+  long int nfeLS     = 0;
+  sunrealtype err    = ZERO;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx)) { return 1; }
+
+  y = N_VNew_Serial(NEQ, sunctx);
+  if (!y) { return 1; }
+
+  y_ref = N_VClone(y);
+  if (!y_ref) { return 1; }
+
+  /* Reference run with a band Jacobian of the whole ensemble. The species of
+     a system are NBLOCKS entries apart. */
+  A = SUNBandMatrix(NEQ, (NSPECIES - 1) * NBLOCKS, (NSPECIES - 1) * NBLOCKS,
+                    sunctx);
+  if (!A) { return 1; }
+
+  LS = SUNLinSol_Band(y, A, sunctx);
+  if (!LS) { return 1; }
+
+  if (run(A, LS, y_ref, &nje, &nfeLS, sunctx)) { return 1; }
+
+  printf("band:       nje = %ld, nfeLS = %ld\n", nje, nfeLS);
+
+  if (nfeLS != NEQ * nje)
+  {
+    fprintf(stderr, "Unexpected number of band DQ RHS evaluations\n");
+    return 1;
+  }
+
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+
+  /* Run with a block-dense Jacobian, which needs one RHS evaluation per
+     species rather than one per equation */
+  A = SUNBlockDenseMatrix(NBLOCKS, NSPECIES, NSPECIES, sunctx);
+  if (!A) { return 1; }
+
+  LS = SUNLinSol_BlockDense(y, A, sunctx);
+  if (!LS) { return 1; }
+
+  if (run(A, LS, y, &nje, &nfeLS, sunctx)) { return 1; }
+
+  N_VLinearSum(ONE, y, -ONE, y_ref, y);
+  err = N_VMaxNorm(y);
+
+  printf("blockdense: nje = %ld, nfeLS = %ld, max difference = %g\n", nje,
+         nfeLS, (double)err);
+
+  if (nfeLS != NSPECIES * nje)
+  {
+    fprintf(stderr, "Unexpected number of block-dense DQ RHS evaluations\n");
+    return 1;
+  }
+
+  if (err > SUN_RCONST(1.0e-10))
+  {
+    fprintf(stderr, "The block-dense and band Jacobian runs differ\n");
+    return 1;
+  }
+
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(y_ref);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,143 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the fused CPU kernels. A stiff system of uncoupled equations is
+ * integrated with the diagonal linear solver, vector absolute tolerances, and
+ * positivity constraints, with and without the fused kernels. The fused kernels
+ * apply the same arithmetic as the unfused vector operations, so the solutions
+ * and integrator statistics must match.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "cvode/cvode_diag.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+
+#define NEQ  100
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+#define TWO  SUN_RCONST(2.0)
+
+/* y_i' = -k_i (y_i - 1 - exp(-t)) / 2 with k_i between 1 and 1e4 */
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* y_data    = N_VGetArrayPointer(y);
+  sunrealtype* ydot_data = N_VGetArrayPointer(ydot);
+  sunrealtype k;
+  sunindextype i;
+
+  for (i = 0; i < NEQ; i++)
+  {
+    k            = SUNRpowerI(SUN_RCONST(10.0), (int)(4 * i / (NEQ - 1)));
+    ydot_data[i] = -k * (y_data[i] - ONE - SUNRexp(-t)) / TWO;
+  }
+  return 0;
+}
+
+/* Integrates the problem and returns the number of steps and RHS evaluations,
+   or 1 if the integration fails */
+static int run(sunbooleantype fused, N_Vector y, long int* nst, long int* nfe,
+               SUNContext sunctx)
+{
+  void* cvode_mem     = NULL;
+  N_Vector abstol     = NULL;
+  N_Vector constraint = NULL;
+  sunrealtype tret    = ZERO;
+  int flag;
+
+  N_VConst(TWO, y);
+
+  abstol = N_VClone(y);
+  if (!abstol) { return 1; }
+  N_VConst(SUN_RCONST(1.0e-8), abstol);
+
+  /* all components must remain positive */
+  constraint = N_VClone(y);
+  if (!constraint) { return 1; }
+  N_VConst(TWO, constraint);
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  if (CVodeInit(cvode_mem, ode_rhs, ZERO, y)) { return 1; }
+  if (CVodeSVtolerances(cvode_mem, SUN_RCONST(1.0e-6), abstol)) { return 1; }
+  if (CVodeSetConstraints(cvode_mem, constraint)) { return 1; }
+  if (CVDiag(cvode_mem)) { return 1; }
+  if (CVodeSetUseIntegratorFusedKernels(cvode_mem, fused)) { return 1; }
+
+  flag = CVode(cvode_mem, SUN_RCONST(10.0), y, &tret, CV_NORMAL);
+  if (flag < 0) { return 1; }
+
+  CVodeGetNumSteps(cvode_mem, nst);
+  CVodeGetNumRhsEvals(cvode_mem, nfe);
+
+  CVodeFree(&cvode_mem);
+  N_VDestroy(constraint);
+  N_VDestroy(abstol);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  N_Vector y        = NULL;
+  N_Vector y_ref    = NULL;
+  long int nst_ref  = 0;
+  long int nfe_ref  = 0;
+  long int nst      = 0;
+  long int nfe      = 0;
+  sunrealtype err   = ZERO;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx)) { return 1; }
+
+  y = N_VNew_Serial(NEQ, sunctx);
+  if (!y) { return 1; }
+
+  y_ref = N_VClone(y);
+  if (!y_ref) { return 1; }
+
+  if (run(SUNFALSE, y_ref, &nst_ref, &nfe_ref, sunctx)) { return 1; }
+  printf("unfused: nst = %ld, nfe = %ld\n", nst_ref, nfe_ref);
+
+  if (run(SUNTRUE, y, &nst, &nfe, sunctx)) { return 1; }
+
+  N_VLinearSum(ONE, y, -ONE, y_ref, y);
+  err = N_VMaxNorm(y);
+
+  printf("fused:   nst = %ld, nfe = %ld, max difference = %g\n", nst, nfe,
+         (double)err);
+
+  if (nst != nst_ref || nfe != nfe_ref)
+  {
+    fprintf(stderr, "The fused and unfused integrator statistics differ\n");
+    return 1;
+  }
+
+  if (err > SUN_RCONST(1.0e-10))
+  {
+    fprintf(stderr, "The fused and unfused runs differ\n");
+    return 1;
+  }
+
+  N_VDestroy(y_ref);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
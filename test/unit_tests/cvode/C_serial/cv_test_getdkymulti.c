@@ -0,0 +1,149 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for CVodeGetDkyMulti. A system of decoupled linear equations is
+ * integrated in one-step mode and after each step the derivatives of the
+ * interpolating polynomial are evaluated at several times within the last step
+ * with CVodeGetDkyMulti and with repeated calls to CVodeGetDky. The results
+ * must agree to roundoff.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "cvode/cvode_diag.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+
+#define NEQ   20
+#define NT    5
+#define NSTEP 40
+#define ZERO  SUN_RCONST(0.0)
+#define ONE   SUN_RCONST(1.0)
+
+/* y_i' = -(i + 1) y_i / 10 */
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* y_data    = N_VGetArrayPointer(y);
+  sunrealtype* ydot_data = N_VGetArrayPointer(ydot);
+  sunindextype i;
+
+  for (i = 0; i < NEQ; i++)
+  {
+    ydot_data[i] = -(i + 1) * y_data[i] / SUN_RCONST(10.0);
+  }
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx  = NULL;
+  void* cvode_mem    = NULL;
+  N_Vector y         = NULL;
+  N_Vector tmp       = NULL;
+  N_Vector* dky      = NULL;
+  sunrealtype tret   = ZERO;
+  sunrealtype hu     = ZERO;
+  sunrealtype t[NT]  = {ZERO};
+  sunrealtype err    = ZERO;
+  sunrealtype maxerr = ZERO;
+  int flag, k, m, n, q;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx)) { return 1; }
+
+  y = N_VNew_Serial(NEQ, sunctx);
+  if (!y) { return 1; }
+  N_VConst(ONE, y);
+
+  tmp = N_VClone(y);
+  if (!tmp) { return 1; }
+
+  dky = N_VCloneVectorArray(NT, y);
+  if (!dky) { return 1; }
+
+  cvode_mem = CVodeCreate(CV_ADAMS, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  if (CVodeInit(cvode_mem, ode_rhs, ZERO, y)) { return 1; }
+  if (CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-8), SUN_RCONST(1.0e-10)))
+  {
+    return 1;
+  }
+  if (CVDiag(cvode_mem)) { return 1; }
+
+  for (n = 0; n < NSTEP; n++)
+  {
+    flag = CVode(cvode_mem, SUN_RCONST(100.0), y, &tret, CV_ONE_STEP);
+    if (flag < 0) { return 1; }
+
+    CVodeGetLastOrder(cvode_mem, &q);
+    CVodeGetLastStep(cvode_mem, &hu);
+
+    /* times spanning the last step, including both end points */
+    for (m = 0; m < NT; m++) { t[m] = tret - hu + (m * hu) / (NT - 1); }
+
+    for (k = 0; k <= q; k++)
+    {
+      flag = CVodeGetDkyMulti(cvode_mem, NT, t, k, dky);
+      if (flag != CV_SUCCESS)
+      {
+        fprintf(stderr, "CVodeGetDkyMulti failed with flag %d\n", flag);
+        return 1;
+      }
+
+      for (m = 0; m < NT; m++)
+      {
+        flag = CVodeGetDky(cvode_mem, t[m], k, tmp);
+        if (flag != CV_SUCCESS)
+        {
+          fprintf(stderr, "CVodeGetDky failed with flag %d\n", flag);
+          return 1;
+        }
+
+        /* relative difference */
+        err = N_VMaxNorm(tmp);
+        N_VLinearSum(ONE, dky[m], -ONE, tmp, tmp);
+        err = N_VMaxNorm(tmp) / SUNMAX(err, ONE);
+        if (err > maxerr) { maxerr = err; }
+      }
+    }
+  }
+
+  /* times outside of the last step are illegal */
+  t[NT - 1] = tret + SUN_RCONST(2.0) * hu;
+  flag      = CVodeGetDkyMulti(cvode_mem, NT, t, 0, dky);
+  if (flag != CV_BAD_T)
+  {
+    fprintf(stderr, "Expected CV_BAD_T, got %d\n", flag);
+    return 1;
+  }
+
+  printf("max difference = %g\n", (double)maxerr);
+
+  if (maxerr > SUN_RCONST(1.0e-12))
+  {
+    fprintf(stderr, "CVodeGetDkyMulti and CVodeGetDky differ\n");
+    return 1;
+  }
+
+  CVodeFree(&cvode_mem);
+  N_VDestroyVectorArray(dky, NT);
+  N_VDestroy(tmp);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,208 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for saving and loading the integrator state
+ * ---------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+/* Stiff forced problem with a slow and a fast component */
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* y_data    = N_VGetArrayPointer(y);
+  sunrealtype* ydot_data = N_VGetArrayPointer(ydot);
+  sunrealtype forcing    = (sunrealtype)cos((double)t);
+  ydot_data[0]           = -y_data[0] + y_data[1] * y_data[1];
+  ydot_data[1]           = SUN_RCONST(-1000.0) * (y_data[1] - forcing);
+  return 0;
+}
+
+/* Creates an integrator with the settings shared by all runs */
+static void* create_cvode(int lmm, N_Vector y, SUNMatrix A, SUNLinearSolver LS,
+                          SUNContext sunctx)
+{
+  void* cvode_mem = CVodeCreate(lmm, sunctx);
+  if (!cvode_mem) { return NULL; }
+
+  N_VConst(ONE, y);
+  if (CVodeInit(cvode_mem, ode_rhs, ZERO, y)) { return NULL; }
+  if (CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-8)))
+  {
+    return NULL;
+  }
+  if (CVodeSetLinearSolver(cvode_mem, LS, A)) { return NULL; }
+
+  return cvode_mem;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx         = NULL;
+  N_Vector y                = NULL;
+  N_Vector y_ref            = NULL;
+  SUNMatrix A               = NULL;
+  SUNLinearSolver LS        = NULL;
+  void* cvode_mem           = NULL;
+  void* restart_mem         = NULL;
+  void* adams_mem           = NULL;
+  void* buffer              = NULL;
+  size_t bytes              = 0;
+  long int nst_save         = 0;
+  long int nst_ref          = 0;
+  long int nst              = 0;
+  int q_save                = 0;
+  int q                     = 0;
+  sunrealtype h_save        = ZERO;
+  sunrealtype h             = ZERO;
+  sunrealtype tret          = ZERO;
+  sunrealtype err           = ZERO;
+  const sunrealtype t_save  = SUN_RCONST(5.0);
+  const sunrealtype t_final = SUN_RCONST(10.0);
+  int flag                  = 0;
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (flag) { return 1; }
+
+  y = N_VNew_Serial(2, sunctx);
+  if (!y) { return 1; }
+
+  y_ref = N_VClone(y);
+  if (!y_ref) { return 1; }
+
+  A = SUNDenseMatrix(2, 2, sunctx);
+  if (!A) { return 1; }
+
+  LS = SUNLinSol_Dense(y, A, sunctx);
+  if (!LS) { return 1; }
+
+  /* Reference run, saving the state part way through */
+  cvode_mem = create_cvode(CV_BDF, y, A, LS, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  flag = CVode(cvode_mem, t_save, y, &tret, CV_NORMAL);
+  if (flag < 0) { return 1; }
+
+  flag = CVodeGetStateSize(cvode_mem, &bytes);
+  if (flag) { return 1; }
+
+  buffer = malloc(bytes);
+  if (!buffer) { return 1; }
+
+  flag = CVodeSaveState(cvode_mem, buffer, bytes - 1);
+  if (flag != CV_ILL_INPUT)
+  {
+    fprintf(stderr, "Saving into a short buffer did not fail\n");
+    return 1;
+  }
+
+  flag = CVodeSaveState(cvode_mem, buffer, bytes);
+  if (flag) { return 1; }
+
+  CVodeGetNumSteps(cvode_mem, &nst_save);
+  CVodeGetCurrentOrder(cvode_mem, &q_save);
+  CVodeGetCurrentStep(cvode_mem, &h_save);
+
+  /* Loading the state into the same integrator only drops the Jacobian, so the
+     reference and restarted runs take identical steps */
+  flag = CVodeLoadState(cvode_mem, buffer, bytes);
+  if (flag) { return 1; }
+
+  flag = CVode(cvode_mem, t_final, y_ref, &tret, CV_NORMAL);
+  if (flag < 0) { return 1; }
+
+  CVodeGetNumSteps(cvode_mem, &nst_ref);
+
+  /* Restarted run in a new integrator */
+  restart_mem = create_cvode(CV_BDF, y, A, LS, sunctx);
+  if (!restart_mem) { return 1; }
+
+  flag = CVodeLoadState(restart_mem, buffer, bytes);
+  if (flag) { return 1; }
+
+  CVodeGetNumSteps(restart_mem, &nst);
+  CVodeGetCurrentOrder(restart_mem, &q);
+  CVodeGetCurrentStep(restart_mem, &h);
+
+  printf("saved:  nst = %ld, q = %d, h = %g\n", nst_save, q_save,
+         (double)h_save);
+  printf("loaded: nst = %ld, q = %d, h = %g\n", nst, q, (double)h);
+
+  if (nst != nst_save || q != q_save || h != h_save)
+  {
+    fprintf(stderr, "The loaded state does not match the saved state\n");
+    return 1;
+  }
+
+  flag = CVode(restart_mem, t_final, y, &tret, CV_NORMAL);
+  if (flag < 0) { return 1; }
+
+  CVodeGetNumSteps(restart_mem, &nst);
+
+  N_VLinearSum(ONE, y, -ONE, y_ref, y);
+  err = N_VMaxNorm(y);
+
+  printf("steps after restart: %ld (reference %ld), max error = %g\n",
+         nst - nst_save, nst_ref - nst_save, (double)err);
+
+  if (err != ZERO || nst != nst_ref)
+  {
+    fprintf(stderr, "The restarted run does not match the reference run\n");
+    return 1;
+  }
+
+  /* A state of another method is rejected, even when the sizes agree */
+  adams_mem = create_cvode(CV_ADAMS, y, A, LS, sunctx);
+  if (!adams_mem) { return 1; }
+
+  flag = CVodeSetMaxOrd(adams_mem, 5);
+  if (flag) { return 1; }
+
+  flag = CVodeLoadState(adams_mem, buffer, bytes);
+  if (flag != CV_ILL_INPUT)
+  {
+    fprintf(stderr, "Loading a BDF state into Adams integrator did not fail\n");
+    return 1;
+  }
+
+  CVodeGetNumSteps(adams_mem, &nst);
+  if (nst != 0)
+  {
+    fprintf(stderr, "A failed load modified the integrator\n");
+    return 1;
+  }
+
+  free(buffer);
+  CVodeFree(&adams_mem);
+  CVodeFree(&restart_mem);
+  CVodeFree(&cvode_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(y_ref);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
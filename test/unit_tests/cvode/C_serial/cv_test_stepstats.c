@@ -0,0 +1,170 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the per-step statistics stream
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_stepstats.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#define ZERO   SUN_RCONST(0.0)
+#define ONE    SUN_RCONST(1.0)
+#define LAMBDA SUN_RCONST(-100.0)
+
+/* Totals accumulated from the records passed to the sink */
+typedef struct
+{
+  long int nrecords;
+  long int netf;
+  long int nni;
+  long int nsetups;
+  sunrealtype tlast;
+  int monotonic;
+} Totals;
+
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* y_data    = N_VGetArrayPointer(y);
+  sunrealtype* ydot_data = N_VGetArrayPointer(ydot);
+  ydot_data[0]           = LAMBDA * (y_data[0] - t) + ONE;
+  return 0;
+}
+
+static int sink(const SUNStepStatsBlock* block, void* user_data)
+{
+  Totals* totals = (Totals*)user_data;
+  int i;
+
+  for (i = 0; i < block->num_records; i++)
+  {
+    if (block->t[i] <= totals->tlast || block->h[i] <= ZERO)
+    {
+      totals->monotonic = 0;
+    }
+    totals->tlast = block->t[i];
+    totals->netf += block->netf[i];
+    totals->nni += block->nni[i];
+    totals->nsetups += block->nsetups[i];
+  }
+  totals->nrecords += block->num_records;
+
+  return 0;
+}
+
+static int check_totals(void* cvode_mem, SUNStepStats stats, Totals* totals)
+{
+  long int nst, netf, nni, nsetups;
+
+  if (SUNStepStats_Flush(stats)) { return 1; }
+
+  CVodeGetNumSteps(cvode_mem, &nst);
+  CVodeGetNumErrTestFails(cvode_mem, &netf);
+  CVodeGetNumNonlinSolvIters(cvode_mem, &nni);
+  CVodeGetNumLinSolvSetups(cvode_mem, &nsetups);
+
+  printf("steps: %ld/%ld, netf: %ld/%ld, nni: %ld/%ld, nsetups: %ld/%ld\n",
+         totals->nrecords, nst, totals->netf, netf, totals->nni, nni,
+         totals->nsetups, nsetups);
+
+  if (totals->nrecords != nst || totals->netf != netf || totals->nni != nni ||
+      totals->nsetups != nsetups || !totals->monotonic)
+  {
+    fprintf(stderr, "Step statistics do not match the integrator counters\n");
+    return 1;
+  }
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx  = NULL;
+  N_Vector y         = NULL;
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  SUNStepStats stats = NULL;
+  void* cvode_mem    = NULL;
+  Totals totals      = {0, 0, 0, 0, -ONE, 1};
+  sunrealtype tret;
+  int flag = 0;
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (flag) { return 1; }
+
+  y = N_VNew_Serial(1, sunctx);
+  if (!y) { return 1; }
+  N_VConst(ONE, y);
+
+  A = SUNDenseMatrix(1, 1, sunctx);
+  if (!A) { return 1; }
+
+  LS = SUNLinSol_Dense(y, A, sunctx);
+  if (!LS) { return 1; }
+
+  /* a small buffer so that several blocks are delivered */
+  flag = SUNStepStats_Create(sunctx, 16, &stats);
+  if (flag) { return 1; }
+
+  flag = SUNStepStats_SetSink(stats, sink, &totals);
+  if (flag) { return 1; }
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  flag = CVodeInit(cvode_mem, ode_rhs, ZERO, y);
+  if (flag) { return 1; }
+
+  flag = CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-8));
+  if (flag) { return 1; }
+
+  flag = CVodeSetLinearSolver(cvode_mem, LS, A);
+  if (flag) { return 1; }
+
+  flag = CVodeSetStepStats(cvode_mem, stats);
+  if (flag) { return 1; }
+
+  flag = CVode(cvode_mem, SUN_RCONST(10.0), y, &tret, CV_NORMAL);
+  if (flag < 0) { return 1; }
+
+  if (check_totals(cvode_mem, stats, &totals)) { return 1; }
+
+  /* counts restart from zero after reinitialization */
+  totals.nrecords = totals.netf = totals.nni = totals.nsetups = 0;
+  totals.tlast = -ONE;
+
+  N_VConst(ONE, y);
+  flag = CVodeReInit(cvode_mem, ZERO, y);
+  if (flag) { return 1; }
+
+  flag = CVode(cvode_mem, SUN_RCONST(5.0), y, &tret, CV_NORMAL);
+  if (flag < 0) { return 1; }
+
+  if (check_totals(cvode_mem, stats, &totals)) { return 1; }
+
+  CVodeFree(&cvode_mem);
+  SUNStepStats_Destroy(&stats);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,216 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for saving and loading the integrator state
+ * ---------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ida/ida.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+/* Semi-explicit index-1 DAE with one differential and one algebraic
+   component */
+static int dae_res(sunrealtype t, N_Vector yy, N_Vector yp, N_Vector rr,
+                   void* user_data)
+{
+  sunrealtype* y_data  = N_VGetArrayPointer(yy);
+  sunrealtype* yp_data = N_VGetArrayPointer(yp);
+  sunrealtype* r_data  = N_VGetArrayPointer(rr);
+  sunrealtype forcing  = (sunrealtype)cos((double)t);
+  r_data[0]            = yp_data[0] + y_data[0] - y_data[1] * y_data[1];
+  r_data[1]            = y_data[1] - forcing;
+  return 0;
+}
+
+/* Creates an integrator with the settings shared by all runs */
+static void* create_ida(int maxord, N_Vector yy, N_Vector yp, SUNMatrix A,
+                        SUNLinearSolver LS, SUNContext sunctx)
+{
+  void* ida_mem = IDACreate(sunctx);
+  if (!ida_mem) { return NULL; }
+
+  /* consistent initial condition */
+  N_VConst(ONE, yy);
+  N_VConst(ZERO, yp);
+  if (IDAInit(ida_mem, dae_res, ZERO, yy, yp)) { return NULL; }
+  if (IDASStolerances(ida_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-8)))
+  {
+    return NULL;
+  }
+  if (IDASetLinearSolver(ida_mem, LS, A)) { return NULL; }
+  if (IDASetMaxOrd(ida_mem, maxord)) { return NULL; }
+
+  return ida_mem;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx         = NULL;
+  N_Vector y                = NULL;
+  N_Vector y_ref            = NULL;
+  N_Vector yp               = NULL;
+  SUNMatrix A               = NULL;
+  SUNLinearSolver LS        = NULL;
+  void* ida_mem             = NULL;
+  void* restart_mem         = NULL;
+  void* other_mem           = NULL;
+  void* buffer              = NULL;
+  size_t bytes              = 0;
+  long int nst_save         = 0;
+  long int nst_ref          = 0;
+  long int nst              = 0;
+  int q_save                = 0;
+  int q                     = 0;
+  sunrealtype h_save        = ZERO;
+  sunrealtype h             = ZERO;
+  sunrealtype tret          = ZERO;
+  sunrealtype err           = ZERO;
+  const sunrealtype t_save  = SUN_RCONST(5.0);
+  const sunrealtype t_final = SUN_RCONST(10.0);
+  int flag                  = 0;
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (flag) { return 1; }
+
+  y = N_VNew_Serial(2, sunctx);
+  if (!y) { return 1; }
+
+  y_ref = N_VClone(y);
+  if (!y_ref) { return 1; }
+
+  yp = N_VClone(y);
+  if (!yp) { return 1; }
+
+  A = SUNDenseMatrix(2, 2, sunctx);
+  if (!A) { return 1; }
+
+  LS = SUNLinSol_Dense(y, A, sunctx);
+  if (!LS) { return 1; }
+
+  /* Reference run, saving the state part way through */
+  ida_mem = create_ida(5, y, yp, A, LS, sunctx);
+  if (!ida_mem) { return 1; }
+
+  flag = IDASolve(ida_mem, t_save, &tret, y, yp, IDA_NORMAL);
+  if (flag < 0) { return 1; }
+
+  flag = IDAGetStateSize(ida_mem, &bytes);
+  if (flag) { return 1; }
+
+  buffer = malloc(bytes);
+  if (!buffer) { return 1; }
+
+  flag = IDASaveState(ida_mem, buffer, bytes - 1);
+  if (flag != IDA_ILL_INPUT)
+  {
+    fprintf(stderr, "Saving into a short buffer did not fail\n");
+    return 1;
+  }
+
+  flag = IDASaveState(ida_mem, buffer, bytes);
+  if (flag) { return 1; }
+
+  IDAGetNumSteps(ida_mem, &nst_save);
+  IDAGetCurrentOrder(ida_mem, &q_save);
+  IDAGetCurrentStep(ida_mem, &h_save);
+
+  /* Loading the state into the same integrator only drops the Jacobian, so the
+     reference and restarted runs take identical steps */
+  flag = IDALoadState(ida_mem, buffer, bytes);
+  if (flag) { return 1; }
+
+  flag = IDASolve(ida_mem, t_final, &tret, y_ref, yp, IDA_NORMAL);
+  if (flag < 0) { return 1; }
+
+  IDAGetNumSteps(ida_mem, &nst_ref);
+
+  /* Restarted run in a new integrator */
+  restart_mem = create_ida(5, y, yp, A, LS, sunctx);
+  if (!restart_mem) { return 1; }
+
+  flag = IDALoadState(restart_mem, buffer, bytes);
+  if (flag) { return 1; }
+
+  IDAGetNumSteps(restart_mem, &nst);
+  IDAGetCurrentOrder(restart_mem, &q);
+  IDAGetCurrentStep(restart_mem, &h);
+
+  printf("saved:  nst = %ld, q = %d, h = %g\n", nst_save, q_save,
+         (double)h_save);
+  printf("loaded: nst = %ld, q = %d, h = %g\n", nst, q, (double)h);
+
+  if (nst != nst_save || q != q_save || h != h_save)
+  {
+    fprintf(stderr, "The loaded state does not match the saved state\n");
+    return 1;
+  }
+
+  flag = IDASolve(restart_mem, t_final, &tret, y, yp, IDA_NORMAL);
+  if (flag < 0) { return 1; }
+
+  IDAGetNumSteps(restart_mem, &nst);
+
+  N_VLinearSum(ONE, y, -ONE, y_ref, y);
+  err = N_VMaxNorm(y);
+
+  printf("steps after restart: %ld (reference %ld), max error = %g\n",
+         nst - nst_save, nst_ref - nst_save, (double)err);
+
+  if (err != ZERO || nst != nst_ref)
+  {
+    fprintf(stderr, "The restarted run does not match the reference run\n");
+    return 1;
+  }
+
+  /* A state with another maximum order is rejected */
+  other_mem = create_ida(4, y, yp, A, LS, sunctx);
+  if (!other_mem) { return 1; }
+
+  flag = IDALoadState(other_mem, buffer, bytes);
+  if (flag != IDA_ILL_INPUT)
+  {
+    fprintf(stderr, "Loading a state with another order did not fail\n");
+    return 1;
+  }
+
+  IDAGetNumSteps(other_mem, &nst);
+  if (nst != 0)
+  {
+    fprintf(stderr, "A failed load modified the integrator\n");
+    return 1;
+  }
+
+  free(buffer);
+  IDAFree(&other_mem);
+  IDAFree(&restart_mem);
+  IDAFree(&ida_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(yp);
+  N_VDestroy(y_ref);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
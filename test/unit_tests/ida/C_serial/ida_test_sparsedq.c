@@ -0,0 +1,327 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the sparse difference quotient Jacobian with a given and a
+ * detected sparsity pattern. The solution and the number of residual
+ * evaluations are compared to a run with a dense Jacobian. As a sparse direct
+ * solver may not be available, the sparse runs use a linear solver that copies
+ * the matrix into a dense matrix.
+ * ---------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ida/ida.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+#include "sunmatrix/sunmatrix_sparse.h"
+
+#define NEQ  40
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+/* Stiff reaction-diffusion problem with a tridiagonal Jacobian */
+static void ode_rhs(N_Vector y, N_Vector ydot)
+{
+  sunrealtype* y_data    = N_VGetArrayPointer(y);
+  sunrealtype* ydot_data = N_VGetArrayPointer(ydot);
+  sunrealtype d          = SUN_RCONST(100.0);
+  sunrealtype left, right;
+  sunindextype i;
+
+  for (i = 0; i < NEQ; i++)
+  {
+    left         = (i > 0) ? y_data[i - 1] : ZERO;
+    right        = (i < NEQ - 1) ? y_data[i + 1] : ZERO;
+    ydot_data[i] = d * (left - SUN_RCONST(2.0) * y_data[i] + right) -
+                   y_data[i] * y_data[i];
+  }
+}
+
+/* Residual of the problem in implicit form, F = y' - f(y) */
+static int dae_res(sunrealtype t, N_Vector yy, N_Vector yp, N_Vector rr,
+                   void* user_data)
+{
+  ode_rhs(yy, rr);
+  N_VLinearSum(ONE, yp, -ONE, rr, rr);
+  return 0;
+}
+
+/* Linear solver copying a sparse matrix into a dense matrix */
+typedef struct
+{
+  SUNMatrix D;
+  SUNLinearSolver LS;
+}* DenseCopyContent;
+
+static SUNLinearSolver_Type DenseCopy_GetType(SUNLinearSolver S)
+{
+  return SUNLINEARSOLVER_DIRECT;
+}
+
+static int DenseCopy_Setup(SUNLinearSolver S, SUNMatrix A)
+{
+  DenseCopyContent content = (DenseCopyContent)S->content;
+  sunindextype* ptrs       = SUNSparseMatrix_IndexPointers(A);
+  sunindextype* vals       = SUNSparseMatrix_IndexValues(A);
+  sunrealtype* data        = SUNSparseMatrix_Data(A);
+  sunindextype j, p;
+
+  SUNMatZero(content->D);
+  for (j = 0; j < SUNSparseMatrix_NP(A); j++)
+  {
+    for (p = ptrs[j]; p < ptrs[j + 1]; p++)
+    {
+      if (SUNSparseMatrix_SparseType(A) == CSC_MAT)
+      {
+        SM_ELEMENT_D(content->D, vals[p], j) = data[p];
+      }
+      else { SM_ELEMENT_D(content->D, j, vals[p]) = data[p]; }
+    }
+  }
+
+  return SUNLinSolSetup(content->LS, content->D);
+}
+
+static int DenseCopy_Solve(SUNLinearSolver S, SUNMatrix A, N_Vector x,
+                           N_Vector b, sunrealtype tol)
+{
+  DenseCopyContent content = (DenseCopyContent)S->content;
+  return SUNLinSolSolve(content->LS, content->D, x, b, tol);
+}
+
+static SUNLinearSolver DenseCopy(N_Vector y, SUNMatrix D, SUNContext sunctx)
+{
+  SUNLinearSolver S        = NULL;
+  DenseCopyContent content = NULL;
+
+  S = SUNLinSolNewEmpty(sunctx);
+  if (!S) { return NULL; }
+
+  content = (DenseCopyContent)malloc(sizeof(*content));
+  if (!content) { return NULL; }
+
+  content->D  = D;
+  content->LS = SUNLinSol_Dense(y, D, sunctx);
+  if (!content->LS) { return NULL; }
+
+  S->content      = content;
+  S->ops->gettype = DenseCopy_GetType;
+  S->ops->setup   = DenseCopy_Setup;
+  S->ops->solve   = DenseCopy_Solve;
+
+  return S;
+}
+
+static void DenseCopy_Free(SUNLinearSolver S)
+{
+  DenseCopyContent content = (DenseCopyContent)S->content;
+  SUNLinSolFree(content->LS);
+  SUNLinSolFree(S);
+}
+
+/* Creates the tridiagonal pattern */
+static SUNMatrix tridiagonal_pattern(int sparsetype, SUNContext sunctx)
+{
+  SUNMatrix P        = SUNSparseMatrix(NEQ, NEQ, 3 * NEQ, sparsetype, sunctx);
+  sunindextype* ptrs = NULL;
+  sunindextype* vals = NULL;
+  sunindextype i, k, nnz = 0;
+
+  if (!P) { return NULL; }
+
+  /* the pattern is symmetric, so the CSC and CSR index arrays agree */
+  ptrs = SUNSparseMatrix_IndexPointers(P);
+  vals = SUNSparseMatrix_IndexValues(P);
+  for (i = 0; i < NEQ; i++)
+  {
+    ptrs[i] = nnz;
+    for (k = SUNMAX(0, i - 1); k <= SUNMIN(NEQ - 1, i + 1); k++)
+    {
+      vals[nnz++] = k;
+    }
+  }
+  ptrs[NEQ] = nnz;
+
+  return P;
+}
+
+/* Integrates the problem and returns the Jacobian and linear solver
+   residual evaluation counts, or 1 if the integration fails */
+static int run(SUNMatrix A, SUNLinearSolver LS, SUNMatrix P,
+               sunbooleantype detect, N_Vector y, long int* nje,
+               long int* nreLS, SUNContext sunctx)
+{
+  void* ida_mem    = NULL;
+  N_Vector yp      = NULL;
+  sunrealtype tret = ZERO;
+  sunindextype i;
+  int flag;
+
+  for (i = 0; i < NEQ; i++)
+  {
+    NV_Ith_S(y, i) = (sunrealtype)sin(3.14159265358979 * (i + 1) / (NEQ + 1));
+  }
+
+  yp = N_VClone(y);
+  if (!yp) { return 1; }
+  ode_rhs(y, yp);
+
+  ida_mem = IDACreate(sunctx);
+  if (!ida_mem) { return 1; }
+
+  if (IDAInit(ida_mem, dae_res, ZERO, y, yp)) { return 1; }
+  if (IDASStolerances(ida_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-8)))
+  {
+    return 1;
+  }
+  if (IDASetLinearSolver(ida_mem, LS, A)) { return 1; }
+  if (P && IDASetJacSparsity(ida_mem, P)) { return 1; }
+  if (IDASetJacSparsityDetection(ida_mem, detect)) { return 1; }
+
+  flag = IDASolve(ida_mem, ONE, &tret, y, yp, IDA_NORMAL);
+  if (flag < 0) { return 1; }
+
+  IDAGetNumJacEvals(ida_mem, nje);
+  IDAGetNumLinResEvals(ida_mem, nreLS);
+
+  IDAFree(&ida_mem);
+  N_VDestroy(yp);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx  = NULL;
+  N_Vector y         = NULL;
+  N_Vector y_ref     = NULL;
+  SUNMatrix A        = NULL;
+  SUNMatrix D        = NULL;
+  SUNMatrix P        = NULL;
+  SUNLinearSolver LS = NULL;
+  void* ida_mem      = NULL;
+  long int nje       = 0;
+  long int nreLS     = 0;
+  sunrealtype tret   = ZERO;
+  sunrealtype err    = ZERO;
+  int sparsetypes[2] = {CSC_MAT, CSR_MAT};
+  int sparsetype     = 0;
+  sunbooleantype detect;
+  int flag           = 0;
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (flag) { return 1; }
+
+  y = N_VNew_Serial(NEQ, sunctx);
+  if (!y) { return 1; }
+
+  y_ref = N_VClone(y);
+  if (!y_ref) { return 1; }
+
+  D = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  if (!D) { return 1; }
+
+  /* Reference run with a dense Jacobian */
+  LS = SUNLinSol_Dense(y, D, sunctx);
+  if (!LS) { return 1; }
+
+  if (run(D, LS, NULL, SUNFALSE, y_ref, &nje, &nreLS, sunctx)) { return 1; }
+  SUNLinSolFree(LS);
+
+  printf("dense:  nje = %ld, nreLS = %ld\n", nje, nreLS);
+
+  if (nreLS != NEQ * nje)
+  {
+    fprintf(stderr, "Unexpected number of dense DQ residual evaluations\n");
+    return 1;
+  }
+
+  LS = DenseCopy(y, D, sunctx);
+  if (!LS) { return 1; }
+
+  /* Runs with CSC and CSR matrices and a given or detected pattern. A
+     tridiagonal pattern needs 3 colors and detecting it 2 NEQ + 1 residual
+     evaluations. */
+  for (int k = 0; k < 4; k++)
+  {
+    sparsetype = sparsetypes[k % 2];
+    detect     = (k >= 2);
+
+    A = SUNSparseMatrix(NEQ, NEQ, NEQ, sparsetype, sunctx);
+    if (!A) { return 1; }
+
+    P = detect ? NULL : tridiagonal_pattern(sparsetype, sunctx);
+    if (!detect && !P) { return 1; }
+
+    if (run(A, LS, P, detect, y, &nje, &nreLS, sunctx)) { return 1; }
+
+    N_VLinearSum(ONE, y, -ONE, y_ref, y);
+    err = N_VMaxNorm(y);
+
+    printf("%s %s: nje = %ld, nreLS = %ld, max difference = %g\n",
+           (sparsetype == CSC_MAT) ? "CSC" : "CSR",
+           detect ? "detected" : "given", nje, nreLS, (double)err);
+
+    if (nreLS != 3 * nje + (detect ? 2 * NEQ + 1 : 0))
+    {
+      fprintf(stderr, "Unexpected number of sparse DQ residual evaluations\n");
+      return 1;
+    }
+
+    if (err > SUN_RCONST(1.0e-10))
+    {
+      fprintf(stderr, "The sparse and dense Jacobian runs differ\n");
+      return 1;
+    }
+
+    if (P) { SUNMatDestroy(P); }
+    SUNMatDestroy(A);
+  }
+
+  /* A sparse matrix without a pattern is rejected */
+  A = SUNSparseMatrix(NEQ, NEQ, 3 * NEQ, CSC_MAT, sunctx);
+  if (!A) { return 1; }
+
+  ida_mem = IDACreate(sunctx);
+  if (!ida_mem) { return 1; }
+
+  if (IDAInit(ida_mem, dae_res, ZERO, y, y_ref)) { return 1; }
+  if (IDASStolerances(ida_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-8)))
+  {
+    return 1;
+  }
+  if (IDASetLinearSolver(ida_mem, LS, A)) { return 1; }
+
+  flag = IDASolve(ida_mem, ONE, &tret, y, y_ref, IDA_NORMAL);
+  if (flag != IDA_LINIT_FAIL)
+  {
+    fprintf(stderr, "A sparse matrix without a pattern was not rejected\n");
+    return 1;
+  }
+
+  IDAFree(&ida_mem);
+  DenseCopy_Free(LS);
+  SUNMatDestroy(A);
+  SUNMatDestroy(D);
+  N_VDestroy(y_ref);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
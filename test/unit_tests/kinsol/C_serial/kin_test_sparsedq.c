@@ -0,0 +1,288 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the sparse difference quotient Jacobian with a given and a
+ * detected sparsity pattern. The solution and the number of function
+ * evaluations are compared to a run with a dense Jacobian. As a sparse direct
+ * solver may not be available, the sparse runs use a linear solver that copies
+ * the matrix into a dense matrix.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "kinsol/kinsol.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+#include "sunmatrix/sunmatrix_sparse.h"
+
+#define NEQ  40
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+/* Nonlinear system with a tridiagonal Jacobian */
+static int F(N_Vector u, N_Vector f, void* user_data)
+{
+  sunrealtype* u_data = N_VGetArrayPointer(u);
+  sunrealtype* f_data = N_VGetArrayPointer(f);
+  sunrealtype left, right;
+  sunindextype i;
+
+  for (i = 0; i < NEQ; i++)
+  {
+    left      = (i > 0) ? u_data[i - 1] : ZERO;
+    right     = (i < NEQ - 1) ? u_data[i + 1] : ZERO;
+    f_data[i] = SUN_RCONST(4.0) * u_data[i] - left - right +
+                u_data[i] * u_data[i] * u_data[i] - ONE;
+  }
+  return 0;
+}
+
+/* Linear solver copying a sparse matrix into a dense matrix */
+typedef struct
+{
+  SUNMatrix D;
+  SUNLinearSolver LS;
+}* DenseCopyContent;
+
+static SUNLinearSolver_Type DenseCopy_GetType(SUNLinearSolver S)
+{
+  return SUNLINEARSOLVER_DIRECT;
+}
+
+static int DenseCopy_Setup(SUNLinearSolver S, SUNMatrix A)
+{
+  DenseCopyContent content = (DenseCopyContent)S->content;
+  sunindextype* ptrs       = SUNSparseMatrix_IndexPointers(A);
+  sunindextype* vals       = SUNSparseMatrix_IndexValues(A);
+  sunrealtype* data        = SUNSparseMatrix_Data(A);
+  sunindextype j, p;
+
+  SUNMatZero(content->D);
+  for (j = 0; j < SUNSparseMatrix_NP(A); j++)
+  {
+    for (p = ptrs[j]; p < ptrs[j + 1]; p++)
+    {
+      if (SUNSparseMatrix_SparseType(A) == CSC_MAT)
+      {
+        SM_ELEMENT_D(content->D, vals[p], j) = data[p];
+      }
+      else { SM_ELEMENT_D(content->D, j, vals[p]) = data[p]; }
+    }
+  }
+
+  return SUNLinSolSetup(content->LS, content->D);
+}
+
+static int DenseCopy_Solve(SUNLinearSolver S, SUNMatrix A, N_Vector x,
+                           N_Vector b, sunrealtype tol)
+{
+  DenseCopyContent content = (DenseCopyContent)S->content;
+  return SUNLinSolSolve(content->LS, content->D, x, b, tol);
+}
+
+static SUNLinearSolver DenseCopy(N_Vector y, SUNMatrix D, SUNContext sunctx)
+{
+  SUNLinearSolver S        = NULL;
+  DenseCopyContent content = NULL;
+
+  S = SUNLinSolNewEmpty(sunctx);
+  if (!S) { return NULL; }
+
+  content = (DenseCopyContent)malloc(sizeof(*content));
+  if (!content) { return NULL; }
+
+  content->D  = D;
+  content->LS = SUNLinSol_Dense(y, D, sunctx);
+  if (!content->LS) { return NULL; }
+
+  S->content      = content;
+  S->ops->gettype = DenseCopy_GetType;
+  S->ops->setup   = DenseCopy_Setup;
+  S->ops->solve   = DenseCopy_Solve;
+
+  return S;
+}
+
+static void DenseCopy_Free(SUNLinearSolver S)
+{
+  DenseCopyContent content = (DenseCopyContent)S->content;
+  SUNLinSolFree(content->LS);
+  SUNLinSolFree(S);
+}
+
+/* Creates the tridiagonal pattern */
+static SUNMatrix tridiagonal_pattern(int sparsetype, SUNContext sunctx)
+{
+  SUNMatrix P        = SUNSparseMatrix(NEQ, NEQ, 3 * NEQ, sparsetype, sunctx);
+  sunindextype* ptrs = NULL;
+  sunindextype* vals = NULL;
+  sunindextype i, k, nnz = 0;
+
+  if (!P) { return NULL; }
+
+  /* the pattern is symmetric, so the CSC and CSR index arrays agree */
+  ptrs = SUNSparseMatrix_IndexPointers(P);
+  vals = SUNSparseMatrix_IndexValues(P);
+  for (i = 0; i < NEQ; i++)
+  {
+    ptrs[i] = nnz;
+    for (k = SUNMAX(0, i - 1); k <= SUNMIN(NEQ - 1, i + 1); k++)
+    {
+      vals[nnz++] = k;
+    }
+  }
+  ptrs[NEQ] = nnz;
+
+  return P;
+}
+
+/* Solves the system and returns the Jacobian and linear solver function
+   evaluation counts, or 1 if the solve fails */
+static int run(SUNMatrix A, SUNLinearSolver LS, SUNMatrix P,
+               sunbooleantype detect, N_Vector u, N_Vector scale,
+               long int* nje, long int* nfeLS, SUNContext sunctx)
+{
+  void* kin_mem = NULL;
+  int flag;
+
+  N_VConst(ZERO, u);
+  N_VConst(ONE, scale);
+
+  kin_mem = KINCreate(sunctx);
+  if (!kin_mem) { return 1; }
+
+  if (KINInit(kin_mem, F, u)) { return 1; }
+  if (KINSetFuncNormTol(kin_mem, SUN_RCONST(1.0e-12))) { return 1; }
+  if (KINSetMaxSetupCalls(kin_mem, 1)) { return 1; }
+  if (KINSetLinearSolver(kin_mem, LS, A)) { return 1; }
+  if (P && KINSetJacSparsity(kin_mem, P)) { return 1; }
+  if (KINSetJacSparsityDetection(kin_mem, detect)) { return 1; }
+
+  flag = KINSol(kin_mem, u, KIN_NONE, scale, scale);
+  if (flag < 0) { return 1; }
+
+  KINGetNumJacEvals(kin_mem, nje);
+  KINGetNumLinFuncEvals(kin_mem, nfeLS);
+
+  KINFree(&kin_mem);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx  = NULL;
+  N_Vector u         = NULL;
+  N_Vector u_ref     = NULL;
+  N_Vector scale     = NULL;
+  SUNMatrix A        = NULL;
+  SUNMatrix D        = NULL;
+  SUNMatrix P        = NULL;
+  SUNLinearSolver LS = NULL;
+  long int nje       = 0;
+  long int nfeLS     = 0;
+  sunrealtype err    = ZERO;
+  int sparsetypes[2] = {CSC_MAT, CSR_MAT};
+  int sparsetype     = 0;
+  int flag           = 0;
+  sunbooleantype detect;
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (flag) { return 1; }
+
+  u = N_VNew_Serial(NEQ, sunctx);
+  if (!u) { return 1; }
+
+  u_ref = N_VClone(u);
+  if (!u_ref) { return 1; }
+
+  scale = N_VClone(u);
+  if (!scale) { return 1; }
+
+  D = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  if (!D) { return 1; }
+
+  /* Reference run with a dense Jacobian */
+  LS = SUNLinSol_Dense(u, D, sunctx);
+  if (!LS) { return 1; }
+
+  if (run(D, LS, NULL, SUNFALSE, u_ref, scale, &nje, &nfeLS, sunctx))
+  {
+    return 1;
+  }
+  SUNLinSolFree(LS);
+
+  printf("dense:  nje = %ld, nfeLS = %ld\n", nje, nfeLS);
+
+  if (nfeLS != NEQ * nje)
+  {
+    fprintf(stderr, "Unexpected number of dense DQ function evaluations\n");
+    return 1;
+  }
+
+  LS = DenseCopy(u, D, sunctx);
+  if (!LS) { return 1; }
+
+  /* Runs with CSC and CSR matrices and a given or detected pattern. A
+     tridiagonal pattern needs 3 colors and detecting it 2 NEQ + 1 function
+     evaluations. */
+  for (int k = 0; k < 4; k++)
+  {
+    sparsetype = sparsetypes[k % 2];
+    detect     = (k >= 2);
+
+    A = SUNSparseMatrix(NEQ, NEQ, NEQ, sparsetype, sunctx);
+    if (!A) { return 1; }
+
+    P = detect ? NULL : tridiagonal_pattern(sparsetype, sunctx);
+    if (!detect && !P) { return 1; }
+
+    if (run(A, LS, P, detect, u, scale, &nje, &nfeLS, sunctx)) { return 1; }
+
+    N_VLinearSum(ONE, u, -ONE, u_ref, u);
+    err = N_VMaxNorm(u);
+
+    printf("%s %s: nje = %ld, nfeLS = %ld, max difference = %g\n",
+           (sparsetype == CSC_MAT) ? "CSC" : "CSR",
+           detect ? "detected" : "given", nje, nfeLS, (double)err);
+
+    if (nfeLS != 3 * nje + (detect ? 2 * NEQ + 1 : 0))
+    {
+      fprintf(stderr, "Unexpected number of sparse DQ function evaluations\n");
+      return 1;
+    }
+
+    if (err > SUN_RCONST(1.0e-10))
+    {
+      fprintf(stderr, "The sparse and dense Jacobian runs differ\n");
+      return 1;
+    }
+
+    if (P) { SUNMatDestroy(P); }
+    SUNMatDestroy(A);
+  }
+
+  DenseCopy_Free(LS);
+  SUNMatDestroy(D);
+  N_VDestroy(scale);
+  N_VDestroy(u_ref);
+  N_VDestroy(u);
+  SUNContext_Free(&sunctx);
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
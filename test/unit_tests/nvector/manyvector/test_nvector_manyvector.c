@@ -218,6 +218,8 @@ int main(int argc, char* argv[])
   fails += Test_N_VLinearCombination(V, length, 0);
   fails += Test_N_VScaleAddMulti(V, length, 0);
   fails += Test_N_VDotProdMulti(V, length, 0);
+  fails += Test_N_VLinearCombinationWrmsNorm(V, length, 0);
+  fails += Test_N_VLinearCombinationMulti(V, length, 0);
 
   /* vector array operations */
   fails += Test_N_VLinearSumVectorArray(V, length, 0);
@@ -244,6 +246,7 @@ int main(int argc, char* argv[])
   /* local fused reduction operations */
   printf("\nTesting local fused reduction operations:\n\n");
   fails += Test_N_VDotProdMultiLocal(V, length, 0);
+  fails += Test_N_VLinearCombinationWSqrSumLocal(V, length, 0);
 
   /* XBraid interface operations */
   printf("\nTesting XBraid interface operations:\n\n");
@@ -320,6 +320,8 @@ int main(int argc, char* argv[])
   fails += Test_N_VLinearCombination(V, local_length, myid);
   fails += Test_N_VScaleAddMulti(V, local_length, myid);
   fails += Test_N_VDotProdMulti(V, local_length, myid);
+  fails += Test_N_VLinearCombinationWrmsNorm(V, local_length, myid);
+  fails += Test_N_VLinearCombinationMulti(V, local_length, myid);
 
   /* vector array operations */
   fails += Test_N_VLinearSumVectorArray(V, local_length, myid);
@@ -346,7 +348,10 @@ int main(int argc, char* argv[])
   /* local fused reduction operations */
   if (myid == 0) { printf("\nTesting local fused reduction operations:\n\n"); }
   fails += Test_N_VDotProdMultiLocal(V, local_length, myid);
+  fails += Test_N_VLinearCombinationWSqrSumLocal(V, local_length, myid);
   fails += Test_N_VDotProdMultiAllReduce(V, local_length, myid);
+  fails += Test_N_VSumMaxMultiAllReduce(V, local_length, myid);
+  fails += Test_N_VDotProdMultiAllReduceBegin(V, local_length, myid);
 
   /* XBraid interface operations */
   if (myid == 0) { printf("\nTesting XBraid interface operations:\n\n"); }
@@ -2694,6 +2694,278 @@ int Test_N_VDotProdMulti(N_Vector X, sunindextype local_length, int myid)
   return (fails);
 }
 
+/* ----------------------------------------------------------------------
+ * N_VLinearCombinationWrmsNorm Test
+ * --------------------------------------------------------------------*/
+int Test_N_VLinearCombinationWrmsNorm(N_Vector X, sunindextype local_length,
+                                      int myid)
+{
+  int fails = 0, failure = 0, ierr = 0;
+  double start_time, stop_time, maxt;
+
+  N_Vector Y1, Y2, Y3, W;
+  N_Vector V[3];
+  sunrealtype c[3];
+  sunrealtype nrm;
+
+  /* create vectors for testing */
+  Y1 = N_VClone(X);
+  Y2 = N_VClone(X);
+  Y3 = N_VClone(X);
+  W  = N_VClone(X);
+
+  /* set vectors in vector array */
+  V[0] = Y1;
+  V[1] = Y2;
+  V[2] = Y3;
+
+  /* set weights */
+  N_VConst(HALF, W);
+
+  /*
+   * Case 1: X = a V[0], ||X||_W
+   */
+
+  /* fill vector data and scaling factors */
+  N_VConst(TWO, Y1);
+  N_VConst(ZERO, X);
+
+  c[0] = HALF;
+  nrm  = ZERO;
+
+  start_time = get_time();
+  ierr       = N_VLinearCombinationWrmsNorm(1, c, V, X, W, &nrm);
+  sync_device(X);
+  stop_time = get_time();
+
+  /* X should be vector of +1 and nrm should equal 1/2 */
+  if (ierr == 0)
+  {
+    failure = check_ans(ONE, X, local_length) || SUNRCompare(nrm, HALF);
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VLinearCombinationWrmsNorm Case 1, Proc %d \n",
+           myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VLinearCombinationWrmsNorm Case 1 \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VLinearCombinationWrmsNorm", maxt);
+
+  /*
+   * Case 2: V[0] = a V[0] + b V[1] + c V[2], ||V[0]||_W
+   */
+
+  /* fill vector data and scaling factors */
+  N_VConst(ONE, Y1);
+  N_VConst(NEG_TWO, Y2);
+  N_VConst(ONE, Y3);
+
+  c[0] = TWO;
+  c[1] = HALF;
+  c[2] = ONE;
+  nrm  = ZERO;
+
+  start_time = get_time();
+  ierr       = N_VLinearCombinationWrmsNorm(3, c, V, Y1, W, &nrm);
+  sync_device(X);
+  stop_time = get_time();
+
+  /* Y1 should be vector of +2 and nrm should equal 1 */
+  if (ierr == 0)
+  {
+    failure = check_ans(TWO, Y1, local_length) || SUNRCompare(nrm, ONE);
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VLinearCombinationWrmsNorm Case 2, Proc %d \n",
+           myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VLinearCombinationWrmsNorm Case 2 \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VLinearCombinationWrmsNorm", maxt);
+
+  /*
+   * Case 3: X = a V[0] + b V[1] + c V[2], ||X||_W
+   */
+
+  /* fill vector data and scaling factors */
+  N_VConst(ONE, Y1);
+  N_VConst(NEG_TWO, Y2);
+  N_VConst(ONE, Y3);
+  N_VConst(ZERO, X);
+
+  nrm = ZERO;
+
+  start_time = get_time();
+  ierr       = N_VLinearCombinationWrmsNorm(3, c, V, X, W, &nrm);
+  sync_device(X);
+  stop_time = get_time();
+
+  /* X should be vector of +2 and nrm should equal 1 */
+  if (ierr == 0)
+  {
+    failure = check_ans(TWO, X, local_length) || SUNRCompare(nrm, ONE);
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VLinearCombinationWrmsNorm Case 3, Proc %d \n",
+           myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VLinearCombinationWrmsNorm Case 3 \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VLinearCombinationWrmsNorm", maxt);
+
+  /* Free vectors */
+  N_VDestroy(Y1);
+  N_VDestroy(Y2);
+  N_VDestroy(Y3);
+  N_VDestroy(W);
+
+  return (fails);
+}
+
+/* ----------------------------------------------------------------------
+ * N_VLinearCombinationMulti Test
+ * --------------------------------------------------------------------*/
+int Test_N_VLinearCombinationMulti(N_Vector X, sunindextype local_length,
+                                   int myid)
+{
+  int fails = 0, failure = 0, ierr = 0;
+  double start_time, stop_time, maxt;
+
+  N_Vector* V;
+  N_Vector* Z;
+  sunrealtype c[9];
+
+  /* create vectors for testing */
+  V = N_VCloneVectorArray(3, X);
+  Z = N_VCloneVectorArray(3, X);
+
+  /*
+   * Case 1: Z[k] = c[k] V[0], k = 0,1
+   */
+
+  /* fill vector data and scaling factors */
+  N_VConst(TWO, V[0]);
+  N_VConst(ZERO, Z[0]);
+  N_VConst(ZERO, Z[1]);
+
+  c[0] = HALF;
+  c[1] = NEG_ONE;
+
+  start_time = get_time();
+  ierr       = N_VLinearCombinationMulti(1, 2, c, V, Z);
+  sync_device(X);
+  stop_time = get_time();
+
+  /* Z[0] should be vector of +1 and Z[1] should be vector of -2 */
+  if (ierr == 0)
+  {
+    failure = check_ans(ONE, Z[0], local_length) ||
+              check_ans(NEG_TWO, Z[1], local_length);
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VLinearCombinationMulti Case 1, Proc %d \n",
+           myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VLinearCombinationMulti Case 1 \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VLinearCombinationMulti", maxt);
+
+  /*
+   * Case 2: Z[k] = c[3k] V[0] + c[3k+1] V[1] + c[3k+2] V[2], k = 0,1,2
+   */
+
+  /* fill vector data and scaling factors */
+  N_VConst(ONE, V[0]);
+  N_VConst(NEG_TWO, V[1]);
+  N_VConst(ONE, V[2]);
+  N_VConst(ZERO, Z[0]);
+  N_VConst(ZERO, Z[1]);
+  N_VConst(ZERO, Z[2]);
+
+  c[0] = TWO;
+  c[1] = HALF;
+  c[2] = ONE;
+
+  c[3] = ONE;
+  c[4] = ONE;
+  c[5] = ONE;
+
+  c[6] = NEG_ONE;
+  c[7] = NEG_HALF;
+  c[8] = NEG_ONE;
+
+  start_time = get_time();
+  ierr       = N_VLinearCombinationMulti(3, 3, c, V, Z);
+  sync_device(X);
+  stop_time = get_time();
+
+  /* Z[0] should be vector of +2, Z[1] of 0, and Z[2] of -1 */
+  if (ierr == 0)
+  {
+    failure = check_ans(TWO, Z[0], local_length) ||
+              check_ans(ZERO, Z[1], local_length) ||
+              check_ans(NEG_ONE, Z[2], local_length);
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VLinearCombinationMulti Case 2, Proc %d \n",
+           myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VLinearCombinationMulti Case 2 \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VLinearCombinationMulti", maxt);
+
+  /* Free vectors */
+  N_VDestroyVectorArray(V, 3);
+  N_VDestroyVectorArray(Z, 3);
+
+  return (fails);
+}
+
 /* ----------------------------------------------------------------------
  * N_VLinearSumVectorArray Test
  * --------------------------------------------------------------------*/
@@ -5562,6 +5834,76 @@ int Test_N_VMinQuotientLocal(N_Vector NUM, N_Vector DENOM,
   return (fails);
 }
 
+/* ----------------------------------------------------------------------
+ * N_VLinearCombinationWSqrSumLocal Test
+ * --------------------------------------------------------------------*/
+int Test_N_VLinearCombinationWSqrSumLocal(N_Vector X, sunindextype local_length,
+                                          int myid)
+{
+  int fails = 0, failure = 0, ierr = 0;
+  double start_time, stop_time, maxt;
+
+  N_Vector Y1, Y2, W;
+  N_Vector V[2];
+  sunrealtype c[2];
+  sunrealtype sum;
+
+  /* create vectors for testing */
+  Y1 = N_VClone(X);
+  Y2 = N_VClone(X);
+  W  = N_VClone(X);
+
+  /* set vectors in vector array */
+  V[0] = Y1;
+  V[1] = Y2;
+
+  /* fill vector data and scaling factors */
+  N_VConst(ONE, Y1);
+  N_VConst(ONE, Y2);
+  N_VConst(HALF, W);
+  N_VConst(ZERO, X);
+
+  c[0] = ONE;
+  c[1] = ONE;
+  sum  = ZERO;
+
+  start_time = get_time();
+  ierr       = N_VLinearCombinationWSqrSumLocal(2, c, V, X, W, &sum);
+  sync_device(X);
+  stop_time = get_time();
+
+  /* X should be vector of +2 and sum should equal local_length */
+  if (ierr == 0)
+  {
+    failure = check_ans(TWO, X, local_length) ||
+              SUNRCompareTol(sum, (sunrealtype)local_length,
+                             SUNRsqrt(SUN_UNIT_ROUNDOFF));
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VLinearCombinationWSqrSumLocal, Proc %d \n",
+           myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VLinearCombinationWSqrSumLocal \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VLinearCombinationWSqrSumLocal", maxt);
+
+  /* Free vectors */
+  N_VDestroy(Y1);
+  N_VDestroy(Y2);
+  N_VDestroy(W);
+
+  return (fails);
+}
+
 /* ----------------------------------------------------------------------
  * N_VDotProdMultiLocal Test
  * --------------------------------------------------------------------*/
@@ -5813,6 +6155,248 @@ int Test_N_VDotProdMultiAllReduce(N_Vector X, sunindextype local_length, int myi
   return (fails);
 }
 
+/* ----------------------------------------------------------------------
+ * N_VSumMaxMultiAllReduce Test
+ * --------------------------------------------------------------------*/
+int Test_N_VSumMaxMultiAllReduce(N_Vector X, sunindextype local_length, int myid)
+{
+  int fails = 0, failure = 0, ierr = 0;
+  double start_time, stop_time, maxt;
+
+  sunindextype global_length;
+  sunrealtype vals[4];
+
+  /* only test if the operation is implemented, local vectors (non-MPI) do not
+     provide this function */
+  if (!(X->ops->nvsummaxmultiallreduce)) { return 0; }
+
+  /* get global length */
+  global_length = N_VGetLength(X);
+
+  /*
+   * Case 1: sums only
+   */
+
+  vals[0] = ONE;
+  vals[1] = (sunrealtype)local_length;
+
+  start_time = get_time();
+  ierr       = N_VSumMaxMultiAllReduce(2, 0, X, vals);
+  stop_time  = get_time();
+
+  /* vals[0] should equal the number of processes (at least 1) and vals[1]
+     should equal the global vector length */
+  if (ierr == 0)
+  {
+    failure = (vals[0] < ONE) ? 1 : 0;
+    failure += SUNRCompare(vals[1], (sunrealtype)global_length);
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VSumMaxMultiAllReduce Case 1, Proc %d \n",
+           myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VSumMaxMultiAllReduce Case 1 \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VSumMaxMultiAllReduce", maxt);
+
+  /*
+   * Case 2: maxima only
+   */
+
+  vals[0] = (sunrealtype)myid;
+  vals[1] = (sunrealtype)-myid;
+
+  start_time = get_time();
+  ierr       = N_VSumMaxMultiAllReduce(0, 2, X, vals);
+  stop_time  = get_time();
+
+  /* vals[0] should be at least the process id and vals[1] should be zero */
+  if (ierr == 0)
+  {
+    failure = (vals[0] < (sunrealtype)myid) ? 1 : 0;
+    failure += SUNRCompare(vals[1], ZERO);
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VSumMaxMultiAllReduce Case 2, Proc %d \n",
+           myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VSumMaxMultiAllReduce Case 2 \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VSumMaxMultiAllReduce", maxt);
+
+  /*
+   * Case 3: sums and maxima
+   */
+
+  vals[0] = ONE;
+  vals[1] = (sunrealtype)local_length;
+  vals[2] = (sunrealtype)myid;
+  vals[3] = (sunrealtype)-myid;
+
+  start_time = get_time();
+  ierr       = N_VSumMaxMultiAllReduce(2, 2, X, vals);
+  stop_time  = get_time();
+
+  /* vals[0] should equal the number of processes, vals[1] the global vector
+     length, vals[2] the largest process id, and vals[3] zero */
+  if (ierr == 0)
+  {
+    failure = SUNRCompare(vals[1], (sunrealtype)global_length);
+    failure += SUNRCompare(vals[2], vals[0] - ONE);
+    failure += SUNRCompare(vals[3], ZERO);
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VSumMaxMultiAllReduce Case 3, Proc %d \n",
+           myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VSumMaxMultiAllReduce Case 3 \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VSumMaxMultiAllReduce", maxt);
+
+  /*
+   * Case 4: sums and maxima of another length, reusing the cached reduction
+   */
+
+  vals[0] = ONE;
+  vals[1] = (sunrealtype)myid;
+  vals[2] = (sunrealtype)-myid;
+
+  start_time = get_time();
+  ierr       = N_VSumMaxMultiAllReduce(1, 2, X, vals);
+  stop_time  = get_time();
+
+  /* vals[0] should equal the number of processes, vals[1] the largest process
+     id, and vals[2] zero */
+  if (ierr == 0)
+  {
+    failure = SUNRCompare(vals[1], vals[0] - ONE);
+    failure += SUNRCompare(vals[2], ZERO);
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VSumMaxMultiAllReduce Case 4, Proc %d \n",
+           myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VSumMaxMultiAllReduce Case 4 \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VSumMaxMultiAllReduce", maxt);
+
+  return (fails);
+}
+
+/* ----------------------------------------------------------------------
+ * N_VDotProdMultiAllReduceBegin and N_VDotProdMultiAllReduceEnd Test
+ * --------------------------------------------------------------------*/
+int Test_N_VDotProdMultiAllReduceBegin(N_Vector X, sunindextype local_length,
+                                       int myid)
+{
+  int fails = 0, failure = 0, ierr = 0;
+  double start_time, stop_time, maxt;
+
+  sunindextype global_length;
+  N_Vector* V;
+  sunrealtype dotprods[3];
+  void* request = NULL;
+
+  /* only test if the operations are implemented, local vectors (non-MPI) do
+     not provide these functions */
+  if (!(X->ops->nvdotprodmultiallreducebegin)) { return 0; }
+
+  /* get global length */
+  global_length = N_VGetLength(X);
+
+  /* create vectors for testing */
+  V = N_VCloneVectorArray(3, X);
+
+  /* fill vector data */
+  N_VConst(TWO, X);
+  N_VConst(NEG_HALF, V[0]);
+  N_VConst(HALF, V[1]);
+  N_VConst(ONE, V[2]);
+
+  ierr = N_VDotProdMultiLocal(3, X, V, dotprods);
+  sync_device(X);
+
+  /* start the reduction, update the vectors while it is in progress, and then
+     complete the reduction */
+  start_time = get_time();
+  if (ierr == 0)
+  {
+    ierr = N_VDotProdMultiAllReduceBegin(3, X, dotprods, &request);
+  }
+  if (ierr == 0)
+  {
+    N_VConst(ZERO, V[0]);
+    ierr = N_VDotProdMultiAllReduceEnd(X, request);
+  }
+  sync_device(X);
+  stop_time = get_time();
+
+  /* dotprod[i] should equal -1, +1, and 2 times the global vector length */
+  if (ierr == 0)
+  {
+    failure = SUNRCompare(dotprods[0], (sunrealtype)-1 * global_length);
+    failure += SUNRCompare(dotprods[1], (sunrealtype)global_length);
+    failure += SUNRCompare(dotprods[2], (sunrealtype)2 * global_length);
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VDotProdMultiAllReduceBegin, Proc %d \n",
+           myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VDotProdMultiAllReduceBegin \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VDotProdMultiAllReduceBegin", maxt);
+
+  /* Free vectors */
+  N_VDestroyVectorArray(V, 3);
+
+  return (fails);
+}
+
 /* ----------------------------------------------------------------------
  * N_VBufSize test
  * --------------------------------------------------------------------*/
@@ -103,6 +103,10 @@ int Test_N_VMinQuotient(N_Vector NUM, N_Vector DENOM, sunindextype local_length,
 int Test_N_VLinearCombination(N_Vector X, sunindextype local_length, int myid);
 int Test_N_VScaleAddMulti(N_Vector X, sunindextype local_length, int myid);
 int Test_N_VDotProdMulti(N_Vector X, sunindextype local_length, int myid);
+int Test_N_VLinearCombinationWrmsNorm(N_Vector X, sunindextype local_length,
+                                      int myid);
+int Test_N_VLinearCombinationMulti(N_Vector X, sunindextype local_length,
+                                   int myid);
 
 /* Vector array operation tests */
 int Test_N_VLinearSumVectorArray(N_Vector X, sunindextype local_length, int myid);
@@ -132,11 +136,17 @@ int Test_N_VConstrMaskLocal(N_Vector C, N_Vector X, N_Vector M,
                             sunindextype local_length, int myid);
 int Test_N_VMinQuotientLocal(N_Vector NUM, N_Vector DENOM,
                              sunindextype local_length, int myid);
+int Test_N_VLinearCombinationWSqrSumLocal(N_Vector X, sunindextype local_length,
+                                          int myid);
 
 /* Single buffer reduction tests */
 int Test_N_VDotProdMultiLocal(N_Vector X, sunindextype local_length, int myid);
 int Test_N_VDotProdMultiAllReduce(N_Vector X, sunindextype local_length,
                                   int myid);
+int Test_N_VSumMaxMultiAllReduce(N_Vector X, sunindextype local_length,
+                                 int myid);
+int Test_N_VDotProdMultiAllReduceBegin(N_Vector X, sunindextype local_length,
+                                       int myid);
 
 /* XBraid interface operations */
 int Test_N_VBufSize(N_Vector x, sunindextype local_length, int myid);
@@ -19,6 +19,7 @@
 #include <string>
 #include <thread>
 
+#include "sundials/sundials_errors.h"
 #include "sundials/sundials_math.h"
 #include "sundials/sundials_profiler.h"
 #include "sundials/sundials_types.h"
@@ -223,6 +224,146 @@ int main()
 
   std::fclose(fout);
 
+  // ------
+  // Test 4
+  // ------
+
+  std::cout << "\nTest 4: nested regions with handles, write trace output\n";
+
+  flag = SUNProfiler_Reset(prof);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_Reset returned " << flag << "\n";
+    return 1;
+  }
+
+  flag = SUNProfiler_EnableTrace(prof, SUNTRUE);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_EnableTrace returned " << flag << "\n";
+    return 1;
+  }
+
+  int outer = -1;
+  int inner = -1;
+  flag      = SUNProfiler_RegisterRegion(prof, "outer", &outer);
+  flag += SUNProfiler_RegisterRegion(prof, "inner", &inner);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_RegisterRegion returned " << flag << "\n";
+    return 1;
+  }
+
+  // registering an existing name returns the same handle
+  int outer_again = -1;
+  flag            = SUNProfiler_RegisterRegion(prof, "outer", &outer_again);
+  if (flag || outer_again != outer)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_RegisterRegion returned a different handle\n";
+    return 1;
+  }
+
+  SUNProfiler_BeginRegion(prof, outer);
+  for (int i = 0; i < 2; i++)
+  {
+    SUNProfiler_BeginRegion(prof, inner);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    SUNProfiler_EndRegion(prof, inner);
+  }
+  SUNProfiler_EndRegion(prof, outer);
+
+  double outer_time = 0;
+  double inner_time = 0;
+  flag              = SUNProfiler_GetElapsedTime(prof, "outer", &outer_time);
+  flag += SUNProfiler_GetElapsedTime(prof, "inner", &inner_time);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_GetElapsedTime returned " << flag << "\n";
+    return 1;
+  }
+
+  if (inner_time < 0.2 || outer_time < inner_time)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "inner time " << inner_time << "s, outer time " << outer_time
+              << "s are inconsistent\n";
+    return 1;
+  }
+
+  fout = std::fopen("profiling_test_trace.json", "w");
+  if (fout == nullptr)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "fopen returned a null pointer\n";
+    return 1;
+  }
+  flag = SUNProfiler_WriteTrace(prof, fout);
+  std::fclose(fout);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_WriteTrace returned " << flag << "\n";
+    return 1;
+  }
+
+  flag = SUNProfiler_WriteFlameGraph(prof, stdout);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_WriteFlameGraph returned " << flag << "\n";
+    return 1;
+  }
+
+  // ------
+  // Test 5
+  // ------
+
+  std::cout << "\nTest 5: hardware counters\n";
+
+  flag = SUNProfiler_EnableCounters(prof, SUNTRUE);
+  if (flag == SUN_ERR_NOT_IMPLEMENTED || flag == SUN_ERR_EXT_FAIL)
+  {
+    // no perf events support or no access to the hardware counters
+    std::cout << "hardware counters are not available, skipping\n";
+  }
+  else if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_EnableCounters returned " << flag << "\n";
+    return 1;
+  }
+  else
+  {
+    volatile double sum = 0.0;
+    SUNProfiler_BeginRegion(prof, inner);
+    for (int i = 0; i < 1000000; i++) { sum = sum + 1.0 / (i + 1); }
+    SUNProfiler_EndRegion(prof, inner);
+
+    long int cycles = 0, instructions = 0, cache_misses = 0;
+    flag = SUNProfiler_GetCounters(prof, "inner", &cycles, &instructions,
+                                   &cache_misses);
+    if (flag || cycles <= 0 || instructions < 1000000)
+    {
+      std::cerr << ">>> FAILURE: "
+                << "SUNProfiler_GetCounters returned " << flag << ", "
+                << cycles << " cycles, " << instructions << " instructions\n";
+      return 1;
+    }
+
+    flag = print_timings(prof);
+    if (flag)
+    {
+      std::cerr << ">>> FAILURE: "
+                << "print_timings returned " << flag << "\n";
+      return 1;
+    }
+  }
+
   // --------
   // Clean up
   // --------
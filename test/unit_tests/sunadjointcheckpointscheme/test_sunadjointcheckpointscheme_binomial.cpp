@@ -0,0 +1,179 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------*/
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <nvector/nvector_serial.h>
+#include <sunadjointcheckpointscheme/sunadjointcheckpointscheme_binomial.h>
+#include <sundials/sundials_adjointcheckpointscheme.h>
+#include <sundials/sundials_core.h>
+#include <sunmemory/sunmemory_system.h>
+
+class SUNAdjointCheckpointSchemeBinomial : public testing::Test
+{
+protected:
+  SUNAdjointCheckpointSchemeBinomial()
+  {
+    SUNContext_Create(SUN_COMM_NULL, &sunctx);
+    state        = N_VNew_Serial(10, sunctx);
+    loaded_state = N_VClone(state);
+    mem_helper   = SUNMemoryHelper_Sys(sunctx);
+  }
+
+  ~SUNAdjointCheckpointSchemeBinomial()
+  {
+    N_VDestroy(state);
+    N_VDestroy(loaded_state);
+    SUNMemoryHelper_Destroy(mem_helper);
+    SUNContext_Free(&sunctx);
+  }
+
+  // Fakes a one stage method: each step stores the state at its start (stage
+  // 0) and at its end (stage 1). The state after step i is i + 1.
+  void take_steps(SUNAdjointCheckpointScheme cs, int first, int last)
+  {
+    for (int step = first; step <= last; ++step)
+    {
+      for (int stage = 0; stage <= 1; ++stage)
+      {
+        sunbooleantype save = SUNFALSE;
+        sunrealtype t       = step + stage;
+        SUNErrCode err = SUNAdjointCheckpointScheme_NeedsSaving(cs, step, stage,
+                                                                t, &save);
+        EXPECT_EQ(err, SUN_SUCCESS);
+        if (save)
+        {
+          N_VConst(t, state);
+          err = SUNAdjointCheckpointScheme_InsertVector(cs, step, stage, t,
+                                                        state);
+          EXPECT_EQ(err, SUN_SUCCESS);
+        }
+      }
+    }
+  }
+
+  // Loads the states of a step in the order the adjoint integration does,
+  // recomputing from the closest checkpoint when the step was not stored.
+  // Returns the number of recomputed steps.
+  int reverse_step(SUNAdjointCheckpointScheme cs, int step)
+  {
+    sunrealtype tout = SUN_RCONST(0.0);
+    SUNErrCode err = SUNAdjointCheckpointScheme_LoadVector(cs, step, 1, 0,
+                                                           &loaded_state, &tout);
+    if (err == SUN_ERR_CHECKPOINT_NOT_FOUND)
+    {
+      int start = step - 1;
+      while (SUNAdjointCheckpointScheme_LoadVector(cs, start, 1, 1,
+                                                   &loaded_state, &tout))
+      {
+        start--;
+      }
+      EXPECT_GE(start, 0);
+      EXPECT_EQ(tout, start + 1);
+
+      SUNAdjointCheckpointScheme_EnableDense(cs, SUNTRUE);
+      take_steps(cs, start + 1, step);
+      SUNAdjointCheckpointScheme_EnableDense(cs, SUNFALSE);
+
+      return (step - start) + reverse_step(cs, step);
+    }
+    EXPECT_EQ(err, SUN_SUCCESS);
+    EXPECT_EQ(tout, step + 1);
+    EXPECT_EQ(N_VGetArrayPointer(loaded_state)[0], step + 1);
+
+    err = SUNAdjointCheckpointScheme_LoadVector(cs, step, 0, 0, &loaded_state,
+                                                &tout);
+    EXPECT_EQ(err, SUN_SUCCESS);
+    EXPECT_EQ(tout, step);
+
+    return 0;
+  }
+
+  SUNContext sunctx;
+  SUNMemoryHelper mem_helper;
+  N_Vector state;
+  N_Vector loaded_state;
+};
+
+TEST_F(SUNAdjointCheckpointSchemeBinomial, CreateNeedsTwoCheckpoints)
+{
+  SUNAdjointCheckpointScheme cs = NULL;
+
+  SUNErrCode err = SUNAdjointCheckpointScheme_Create_Binomial(SUNDATAIOMODE_INMEM,
+                                                              mem_helper, 1,
+                                                              sunctx, &cs);
+  EXPECT_EQ(err, SUN_ERR_ARG_OUTOFRANGE);
+}
+
+TEST_F(SUNAdjointCheckpointSchemeBinomial, ForwardKeepsFirstAndLastSteps)
+{
+  SUNAdjointCheckpointScheme cs = NULL;
+  const int max_checks          = 5;
+  const int num_steps           = 200;
+
+  SUNErrCode err = SUNAdjointCheckpointScheme_Create_Binomial(SUNDATAIOMODE_INMEM,
+                                                              mem_helper,
+                                                              max_checks,
+                                                              sunctx, &cs);
+  ASSERT_EQ(err, SUN_SUCCESS);
+
+  take_steps(cs, 0, num_steps - 1);
+
+  suncountertype num_checks = 0;
+  SUNAdjointCheckpointScheme_GetNumCheckpoints_Binomial(cs, &num_checks);
+  EXPECT_EQ(num_checks, max_checks);
+
+  sunrealtype tout = SUN_RCONST(0.0);
+  err = SUNAdjointCheckpointScheme_LoadVector(cs, 0, 1, 1, &loaded_state, &tout);
+  EXPECT_EQ(err, SUN_SUCCESS);
+  err = SUNAdjointCheckpointScheme_LoadVector(cs, num_steps - 1, 1, 1,
+                                              &loaded_state, &tout);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  SUNAdjointCheckpointScheme_Destroy(&cs);
+}
+
+TEST_F(SUNAdjointCheckpointSchemeBinomial, ReverseStaysWithinBudget)
+{
+  SUNAdjointCheckpointScheme cs = NULL;
+  const int max_checks          = 10;
+  const int num_steps           = 128;
+
+  SUNErrCode err = SUNAdjointCheckpointScheme_Create_Binomial(SUNDATAIOMODE_INMEM,
+                                                              mem_helper,
+                                                              max_checks,
+                                                              sunctx, &cs);
+  ASSERT_EQ(err, SUN_SUCCESS);
+
+  take_steps(cs, 0, num_steps - 1);
+
+  int num_recompute = 0;
+  for (int step = num_steps - 1; step >= 0; --step)
+  {
+    num_recompute += reverse_step(cs, step);
+
+    suncountertype num_checks = 0;
+    SUNAdjointCheckpointScheme_GetNumCheckpoints_Binomial(cs, &num_checks);
+    EXPECT_LE(num_checks, max_checks);
+  }
+
+  // 10 checkpoints reverse up to C(10 + 3, 3) = 286 steps with at most three
+  // forward evaluations of each step, i.e., at most two recomputations
+  EXPECT_LE(num_recompute, 2 * num_steps);
+
+  suncountertype num_checks = 0;
+  SUNAdjointCheckpointScheme_GetNumCheckpoints_Binomial(cs, &num_checks);
+  EXPECT_EQ(num_checks, 0);
+
+  SUNAdjointCheckpointScheme_Destroy(&cs);
+}
@@ -338,3 +338,78 @@ TEST_F(SUNAdjointCheckpointSchemeFixed, CanStillInsertAfterDeleting)
   err = SUNAdjointCheckpointScheme_Destroy(&cs);
   EXPECT_EQ(err, SUN_SUCCESS);
 }
+
+TEST_F(SUNAdjointCheckpointSchemeFixed, MultilevelWorks)
+{
+  SUNErrCode err;
+  SUNAdjointCheckpointScheme cs     = NULL;
+  suncountertype interval           = 1;
+  suncountertype estimate           = 100;
+  sunbooleantype keep_after_loading = SUNFALSE;
+  suncountertype num_spilled        = 0;
+  suncountertype num_promoted       = 0;
+
+  err = SUNAdjointCheckpointScheme_Create_Fixed(SUNDATAIOMODE_INMEM, mem_helper,
+                                                interval, estimate,
+                                                keep_after_loading, sunctx, &cs);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  err = SUNAdjointCheckpointScheme_EnableMultilevel_Fixed(cs, 3, 1);
+  if (err == SUN_ERR_NOT_IMPLEMENTED)
+  {
+    SUNAdjointCheckpointScheme_Destroy(&cs);
+    GTEST_SKIP() << "memory-mapped files are not supported";
+  }
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  // The earliest steps are spilled to the file during the forward sweep and
+  // promoted back to memory when the backward sweep reaches them (dt is exact
+  // so that the loaded times match after 20 steps)
+  fake_mutlistage_method(sunctx, cs, 20, 2, true, /*dt=*/0.125);
+
+  err = SUNAdjointCheckpointScheme_GetMultilevelStats_Fixed(cs, &num_spilled,
+                                                            &num_promoted);
+  EXPECT_EQ(err, SUN_SUCCESS);
+  EXPECT_EQ(num_spilled, 17);
+  EXPECT_EQ(num_promoted, 17);
+
+  err = SUNAdjointCheckpointScheme_Destroy(&cs);
+  EXPECT_EQ(err, SUN_SUCCESS);
+}
+
+TEST_F(SUNAdjointCheckpointSchemeFixed, CompressionWorks)
+{
+  SUNErrCode err;
+  SUNAdjointCheckpointScheme cs     = NULL;
+  suncountertype interval           = 1;
+  suncountertype estimate           = 100;
+  sunbooleantype keep_after_loading = SUNFALSE;
+  size_t raw_bytes                  = 0;
+  size_t stored_bytes               = 0;
+
+  err = SUNAdjointCheckpointScheme_Create_Fixed(SUNDATAIOMODE_INMEM, mem_helper,
+                                                interval, estimate,
+                                                keep_after_loading, sunctx, &cs);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  err = SUNAdjointCheckpointScheme_EnableCompression_Fixed(
+    cs, SUNDATACOMPRESSION_LOSSY, -SUN_RCONST(1.0));
+  EXPECT_EQ(err, SUN_ERR_ARG_OUTOFRANGE);
+
+  err = SUNAdjointCheckpointScheme_EnableCompression_Fixed(
+    cs, SUNDATACOMPRESSION_LOSSLESS, SUN_RCONST(0.0));
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  // The loaded states must match the inserted ones exactly
+  fake_mutlistage_method(sunctx, cs, 20, 2, true, /*dt=*/0.125);
+
+  // The constant states are stored in a fraction of their size
+  err = SUNAdjointCheckpointScheme_GetCompressionStats_Fixed(cs, &raw_bytes,
+                                                             &stored_bytes);
+  EXPECT_EQ(err, SUN_SUCCESS);
+  EXPECT_EQ(raw_bytes, 61 * 11 * sizeof(sunrealtype));
+  EXPECT_LT(2 * stored_bytes, raw_bytes);
+
+  err = SUNAdjointCheckpointScheme_Destroy(&cs);
+  EXPECT_EQ(err, SUN_SUCCESS);
+}
@@ -10,6 +10,8 @@
  * SUNDIALS Copyright End
  * -----------------------------------------------------------------*/
 
+#include <cmath>
+#include <cstring>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <nvector/nvector_serial.h>
@@ -18,6 +20,8 @@
 #include "sundials_datanode.h"
 
 #include "sundatanode/sundatanode_inmem.h"
+#include "sundatanode/sundatanode_mmap.h"
+#include "sundials/priv/sundials_context_impl.h"
 #include "sundials/sundials_memory.h"
 #include "sundials/sundials_nvector.h"
 #include "sundials/sundials_types.h"
@@ -477,3 +481,233 @@ TEST_F(SUNDataNodeTest, SetAndGetDataNvectorWhenLeaf)
   N_VDestroy(v);
   N_VDestroy(vec_we_got);
 }
+
+TEST_F(SUNDataNodeTest, ByteLeafIsNotTakenAsCompressed)
+{
+  SUNErrCode err;
+  SUNDataNode leaf;
+  N_Vector v = N_VNew_Serial(2, sunctx);
+
+  // the time and vector values stored as plain bytes
+  sunrealtype values[3] = {SUN_RCONST(1.0), SUN_RCONST(2.0), SUN_RCONST(3.0)};
+
+  err = SUNDataNode_CreateLeaf(SUNDATAIOMODE_INMEM, mem_helper, sunctx, &leaf);
+  EXPECT_EQ(err, SUN_SUCCESS);
+  err = SUNDataNode_SetData(leaf, SUNMEMTYPE_HOST, SUNMEMTYPE_HOST, values, 1,
+                            sizeof(values));
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  sunrealtype tout = SUN_RCONST(0.0);
+  err              = SUNDataNode_GetDataNvector(leaf, v, &tout);
+  EXPECT_EQ(err, SUN_SUCCESS);
+  EXPECT_EQ(tout, values[0]);
+  EXPECT_EQ(N_VGetArrayPointer(v)[0], values[1]);
+  EXPECT_EQ(N_VGetArrayPointer(v)[1], values[2]);
+
+  err = SUNDataNode_Destroy(&leaf);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  N_VDestroy(v);
+}
+
+// Fills v with a smooth profile spanning several compression blocks
+static void fill_smooth(N_Vector v)
+{
+  sunrealtype* data = N_VGetArrayPointer(v);
+  sunindextype n    = N_VGetLength(v);
+  for (sunindextype i = 0; i < n; i++)
+  {
+    sunrealtype x = SUN_RCONST(4.0) * i / n;
+    data[i]       = SUN_RCONST(2.0) + std::sin(x) * std::exp(-x);
+  }
+}
+
+TEST_F(SUNDataNodeTest, LosslessCompressedNvectorRoundTrips)
+{
+  SUNErrCode err;
+  SUNDataNode leaf;
+  N_Vector v          = N_VNew_Serial(5000, sunctx);
+  N_Vector vec_we_got = N_VClone(v);
+
+  fill_smooth(v);
+  // runs of repeated values and zeros
+  sunrealtype* vdata = N_VGetArrayPointer(v);
+  for (int i = 1000; i < 2000; i++) { vdata[i] = SUN_RCONST(0.0); }
+  for (int i = 3000; i < 3500; i++) { vdata[i] = SUN_RCONST(7.0); }
+
+  err = SUNDataNode_CreateLeaf(SUNDATAIOMODE_INMEM, mem_helper, sunctx, &leaf);
+  EXPECT_EQ(err, SUN_SUCCESS);
+  err = SUNDataNode_SetDataNvectorCompressed(leaf, v, SUN_RCONST(0.5),
+                                             SUNDATACOMPRESSION_LOSSLESS,
+                                             nullptr, SUN_RCONST(0.0));
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  void* data        = nullptr;
+  size_t stride     = 0;
+  size_t data_bytes = 0;
+  err = SUNDataNode_GetData(leaf, &data, &stride, &data_bytes);
+  EXPECT_EQ(err, SUN_SUCCESS);
+  EXPECT_LT(data_bytes, 5000 * sizeof(sunrealtype));
+
+  sunrealtype tout = SUN_RCONST(0.0);
+  err              = SUNDataNode_GetDataNvector(leaf, vec_we_got, &tout);
+  EXPECT_EQ(err, SUN_SUCCESS);
+  EXPECT_EQ(tout, SUN_RCONST(0.5));
+  EXPECT_EQ(memcmp(N_VGetArrayPointer(v), N_VGetArrayPointer(vec_we_got),
+                   5000 * sizeof(sunrealtype)),
+            0);
+
+  // a vector of another length cannot be loaded from the leaf
+  N_Vector w = N_VNew_Serial(4999, sunctx);
+  err        = SUNDataNode_GetDataNvector(leaf, w, &tout);
+  EXPECT_EQ(err, SUN_ERR_ARG_INCOMPATIBLE);
+  N_VDestroy(w);
+
+  err = SUNDataNode_Destroy(&leaf);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  N_VDestroy(v);
+  N_VDestroy(vec_we_got);
+}
+
+TEST_F(SUNDataNodeTest, LossyCompressedNvectorIsWithinTolerance)
+{
+  SUNErrCode err;
+  SUNDataNode leaf;
+  N_Vector v          = N_VNew_Serial(5000, sunctx);
+  N_Vector vec_we_got = N_VClone(v);
+  N_Vector ewt        = N_VClone(v);
+
+  // error weights as the integrators compute them
+  const sunrealtype rtol = SUN_RCONST(1.0e-4);
+  const sunrealtype atol = SUN_RCONST(1.0e-8);
+  fill_smooth(v);
+  N_VAbs(v, ewt);
+  N_VScale(rtol, ewt, ewt);
+  N_VAddConst(ewt, atol, ewt);
+  N_VInv(ewt, ewt);
+
+  err = SUNDataNode_CreateLeaf(SUNDATAIOMODE_INMEM, mem_helper, sunctx, &leaf);
+  EXPECT_EQ(err, SUN_SUCCESS);
+  err = SUNDataNode_SetDataNvectorCompressed(leaf, v, SUN_RCONST(0.5),
+                                             SUNDATACOMPRESSION_LOSSY, ewt,
+                                             SUN_RCONST(1.0));
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  void* data        = nullptr;
+  size_t stride     = 0;
+  size_t data_bytes = 0;
+  err = SUNDataNode_GetData(leaf, &data, &stride, &data_bytes);
+  EXPECT_EQ(err, SUN_SUCCESS);
+  EXPECT_LT(3 * data_bytes, 5000 * sizeof(sunrealtype));
+
+  sunrealtype tout = SUN_RCONST(0.0);
+  err              = SUNDataNode_GetDataNvector(leaf, vec_we_got, &tout);
+  EXPECT_EQ(err, SUN_SUCCESS);
+  EXPECT_EQ(tout, SUN_RCONST(0.5));
+
+  N_VLinearSum(SUN_RCONST(1.0), v, -SUN_RCONST(1.0), vec_we_got, vec_we_got);
+  // every entry is within its bound, so the WRMS norm is too
+  N_VProd(vec_we_got, ewt, vec_we_got);
+  EXPECT_LE(N_VMaxNorm(vec_we_got), SUN_RCONST(1.0));
+
+  err = SUNDataNode_Destroy(&leaf);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  N_VDestroy(v);
+  N_VDestroy(vec_we_got);
+  N_VDestroy(ewt);
+}
+
+#if defined(SUNDIALS_HAVE_MMAP)
+
+TEST_F(SUNDataNodeTest, MmapSetAndGetDataNvectorWhenLeaf)
+{
+  SUNErrCode err;
+  SUNDataNode leaf;
+  N_Vector v          = N_VNew_Serial(3, sunctx);
+  N_Vector vec_we_got = N_VClone(v);
+
+  N_VConst(SUN_RCONST(2.0), v);
+  N_VConst(SUN_RCONST(0.0), vec_we_got);
+
+  err = SUNDataNode_CreateLeaf(SUNDATAIOMODE_MMAP, mem_helper, sunctx, &leaf);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  err = SUNDataNode_SetDataNvector(leaf, v, SUN_RCONST(1.0));
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  sunrealtype tout = SUN_RCONST(0.0);
+  err              = SUNDataNode_GetDataNvector(leaf, vec_we_got, &tout);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  EXPECT_EQ(tout, SUN_RCONST(1.0));
+  EXPECT_EQ(N_VGetArrayPointer(vec_we_got)[2], SUN_RCONST(2.0));
+
+  err = SUNDataNode_Destroy(&leaf);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  N_VDestroy(v);
+  N_VDestroy(vec_we_got);
+}
+
+TEST_F(SUNDataNodeTest, MmapLeavesLoadInReverseAcrossSegments)
+{
+  SUNErrCode err;
+  const int num_leaves = 50;
+  SUNDataNode list;
+  N_Vector v          = N_VNew_Serial(100, sunctx);
+  N_Vector vec_we_got = N_VClone(v);
+
+  // use small segments so the leaves span several mappings
+  ASSERT_EQ(SUNMmapStore_Create(4096, &sunctx->mmap_store), SUN_SUCCESS);
+
+  err = SUNDataNode_CreateList(SUNDATAIOMODE_MMAP, 0, sunctx, &list);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  for (int i = 0; i < num_leaves; i++)
+  {
+    SUNDataNode leaf;
+    err = SUNDataNode_CreateLeaf(SUNDATAIOMODE_MMAP, mem_helper, sunctx, &leaf);
+    EXPECT_EQ(err, SUN_SUCCESS);
+    N_VConst(SUN_RCONST(10.0) * i, v);
+    err = SUNDataNode_SetDataNvector(leaf, v, SUN_RCONST(1.0) * i);
+    EXPECT_EQ(err, SUN_SUCCESS);
+    err = SUNDataNode_AddChild(list, leaf);
+    EXPECT_EQ(err, SUN_SUCCESS);
+  }
+
+  // load and free the leaves the way a backward sweep would
+  for (int i = num_leaves - 1; i >= 0; i--)
+  {
+    SUNDataNode leaf = nullptr;
+    err              = SUNDataNode_RemoveChild(list, i, &leaf);
+    ASSERT_EQ(err, SUN_SUCCESS);
+
+    sunrealtype tout = SUN_RCONST(-1.0);
+    err              = SUNDataNode_GetDataNvector(leaf, vec_we_got, &tout);
+    EXPECT_EQ(err, SUN_SUCCESS);
+    EXPECT_EQ(tout, SUN_RCONST(1.0) * i);
+    EXPECT_EQ(N_VGetArrayPointer(vec_we_got)[99], SUN_RCONST(10.0) * i);
+
+    err = SUNDataNode_Destroy(&leaf);
+    EXPECT_EQ(err, SUN_SUCCESS);
+  }
+
+  // leaves still in a list are released with it
+  SUNDataNode leaf;
+  err = SUNDataNode_CreateLeaf(SUNDATAIOMODE_MMAP, mem_helper, sunctx, &leaf);
+  EXPECT_EQ(err, SUN_SUCCESS);
+  err = SUNDataNode_SetDataNvector(leaf, v, SUN_RCONST(0.0));
+  EXPECT_EQ(err, SUN_SUCCESS);
+  err = SUNDataNode_AddChild(list, leaf);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  err = SUNDataNode_Destroy(&list);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  N_VDestroy(v);
+  N_VDestroy(vec_we_got);
+}
+
+#endif
@@ -17,18 +17,10 @@
 #include <nvector/nvector_serial.h>
 #include <string>
 #include <sundials/sundials_core.hpp>
+#include <vector>
 
 #include "sundials_hashmap_impl.h"
 
-// Helper function to free memory for value
-static SUNErrCode freeKeyValue(SUNHashMapKeyValue* ptr)
-{
-  if (!ptr || !(*ptr)) { return SUN_SUCCESS; }
-  free((*ptr)->key);
-  free(*ptr);
-  return SUN_SUCCESS;
-}
-
 class SUNHashMapTest : public testing::Test
 {
 protected:
@@ -36,7 +28,7 @@ protected:
 
   virtual void SetUp(size_t init_capacity)
   {
-    SUNHashMap_New(init_capacity, freeKeyValue, &map);
+    SUNHashMap_New(init_capacity, nullptr, &map);
   }
 
   virtual void TearDown() override { SUNHashMap_Destroy(&map); }
@@ -85,14 +77,14 @@ TEST_F(SUNHashMapTest, InsertRequiringResizeWorks)
   ASSERT_EQ(err, 0);
   ASSERT_EQ(SUNHashMap_Capacity(map), 2); // Ensure no resize happened
 
+  // This should trigger a resize since the map is kept at most 3/4 full
   err = SUNHashMap_Insert(map, key2, &value2);
   ASSERT_EQ(err, 0);
-  ASSERT_EQ(SUNHashMap_Capacity(map), 2); // Ensure no resize happened
+  ASSERT_GT(SUNHashMap_Capacity(map), 2); // Ensure resize happened
 
-  // This should trigger a resize since init_capacity is 2
   err = SUNHashMap_Insert(map, key3, &value3);
   ASSERT_EQ(err, 0);
-  ASSERT_EQ(SUNHashMap_Capacity(map), 3); // Ensure resize happened
+  ASSERT_EQ(SUNHashMap_Size(map), 3);
 
   void* retrieved_value;
   err = SUNHashMap_GetValue(map, key1, &retrieved_value);
@@ -148,3 +140,42 @@ TEST_F(SUNHashMapTest, RemoveWorks)
   err = SUNHashMap_GetValue(map, key, &retrieved_value);
   ASSERT_EQ(err, -1);
 }
+
+TEST_F(SUNHashMapTest, ManyInsertsAndRemovesWork)
+{
+  SetUp(1);
+
+  // Use short keys stored in the table and long keys that are allocated
+  const int n = 1000;
+  std::vector<std::string> keys;
+  std::vector<int> values(n);
+  for (int i = 0; i < n; i++)
+  {
+    keys.push_back((i % 2 ? "a_key_that_is_too_long_to_store_inline_" : "key_") +
+                   std::to_string(i));
+    values[i] = i;
+    ASSERT_EQ(SUNHashMap_Insert(map, keys[i].c_str(), &values[i]), 0);
+  }
+  EXPECT_EQ(SUNHashMap_Size(map), n);
+
+  // Remove every third key, the other keys in a probe sequence must remain
+  for (int i = 0; i < n; i += 3)
+  {
+    void* removed_value;
+    ASSERT_EQ(SUNHashMap_Remove(map, keys[i].c_str(), &removed_value), 0);
+    EXPECT_EQ(removed_value, &values[i]);
+  }
+
+  for (int i = 0; i < n; i++)
+  {
+    void* retrieved_value = nullptr;
+    int64_t err = SUNHashMap_GetValue(map, keys[i].c_str(), &retrieved_value);
+    if (i % 3 == 0) { EXPECT_EQ(err, SUNHASHMAP_KEYNOTFOUND); }
+    else
+    {
+      ASSERT_EQ(err, 0);
+      EXPECT_EQ(retrieved_value, &values[i]);
+    }
+  }
+  EXPECT_EQ(SUNHashMap_Size(map), n - (n + 2) / 3);
+}
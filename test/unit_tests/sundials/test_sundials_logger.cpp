@@ -0,0 +1,217 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------*/
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <sundials/sundials_core.hpp>
+#include <sundials/sundials_logger.h>
+
+// Queue a fixed set of messages covering the supported argument types
+static void queueMessages(SUNLogger logger, int n)
+{
+  char name[16];
+  for (int i = 0; i < n; i++)
+  {
+    std::snprintf(name, sizeof(name), "msg-%d", i);
+    SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_WARNING, "scope", "label",
+                       "i = %d, j = %5ld, t = %.6e, h = %g, p = %3.0f%%, s = %s",
+                       i, 2L * i, 0.1 * i, 1.0 / (i + 1), 50.0, name);
+  }
+  SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_WARNING, "scope", "label",
+                     "no arguments");
+}
+
+static std::string readFile(const char* fname)
+{
+  std::ifstream file(fname, std::ios::binary);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  return contents.str();
+}
+
+class SUNLoggerTest : public testing::Test
+{
+protected:
+  SUNLogger logger = nullptr;
+
+  void TearDown() override { SUNLogger_Destroy(&logger); }
+
+  bool create(const char* fname)
+  {
+    if (SUNLogger_Create(SUN_COMM_NULL, 0, &logger)) { return false; }
+    return SUNLogger_SetWarningFilename(logger, fname) == SUN_SUCCESS;
+  }
+};
+
+TEST_F(SUNLoggerTest, OutputMatchesSynchronous)
+{
+  ASSERT_TRUE(create("sunlogger_sync.txt"));
+  queueMessages(logger, 100);
+  SUNLogger_Destroy(&logger);
+
+  ASSERT_TRUE(create("sunlogger_async.txt"));
+  SUNErrCode err = SUNLogger_EnableAsync(logger, 16, SUN_LOGOVERFLOW_BLOCK);
+  if (err == SUN_ERR_NOT_IMPLEMENTED) { GTEST_SKIP(); }
+  ASSERT_EQ(err, SUN_SUCCESS);
+  queueMessages(logger, 100);
+  SUNLogger_Destroy(&logger);
+
+  std::string sync_output  = readFile("sunlogger_sync.txt");
+  std::string async_output = readFile("sunlogger_async.txt");
+  EXPECT_FALSE(sync_output.empty());
+  EXPECT_EQ(sync_output, async_output);
+}
+
+TEST_F(SUNLoggerTest, FlushWritesQueuedMessages)
+{
+  ASSERT_TRUE(create("sunlogger_flush.txt"));
+  SUNErrCode err = SUNLogger_EnableAsync(logger, 0, SUN_LOGOVERFLOW_BLOCK);
+  if (err == SUN_ERR_NOT_IMPLEMENTED) { GTEST_SKIP(); }
+  ASSERT_EQ(err, SUN_SUCCESS);
+
+  queueMessages(logger, 10);
+  ASSERT_EQ(SUNLogger_Flush(logger, SUN_LOGLEVEL_ALL), SUN_SUCCESS);
+
+  std::string output = readFile("sunlogger_flush.txt");
+  EXPECT_NE(output.find("s = msg-9"), std::string::npos);
+  EXPECT_NE(output.find("no arguments"), std::string::npos);
+}
+
+TEST_F(SUNLoggerTest, QueuedMessagesCopyStrings)
+{
+  ASSERT_TRUE(create("sunlogger_copy.txt"));
+  SUNErrCode err = SUNLogger_EnableAsync(logger, 0, SUN_LOGOVERFLOW_BLOCK);
+  if (err == SUN_ERR_NOT_IMPLEMENTED) { GTEST_SKIP(); }
+  ASSERT_EQ(err, SUN_SUCCESS);
+
+  // the caller may overwrite or free its strings once the message is queued,
+  // as the error handlers do
+  char scope[32], label[32], fmt[32];
+  for (int i = 0; i < 10; i++)
+  {
+    std::snprintf(scope, sizeof(scope), "file.c:%d", i);
+    std::snprintf(label, sizeof(label), "func%d", i);
+    std::snprintf(fmt, sizeof(fmt), "message %d, i = %%d", i);
+    SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_WARNING, scope, label, fmt, i);
+  }
+  std::memset(scope, 0, sizeof(scope));
+  std::memset(label, 0, sizeof(label));
+  std::memset(fmt, 0, sizeof(fmt));
+  ASSERT_EQ(SUNLogger_Flush(logger, SUN_LOGLEVEL_ALL), SUN_SUCCESS);
+
+  std::string output = readFile("sunlogger_copy.txt");
+  for (int i = 0; i < 10; i++)
+  {
+    std::ostringstream expected;
+    expected << "[file.c:" << i << "][func" << i << "] message " << i
+             << ", i = " << i;
+    EXPECT_NE(output.find(expected.str()), std::string::npos) << expected.str();
+  }
+}
+
+TEST_F(SUNLoggerTest, DropPolicyCountsDroppedMessages)
+{
+  ASSERT_TRUE(create("sunlogger_drop.txt"));
+  SUNErrCode err = SUNLogger_EnableAsync(logger, 1, SUN_LOGOVERFLOW_DROP);
+  if (err == SUN_ERR_NOT_IMPLEMENTED) { GTEST_SKIP(); }
+  ASSERT_EQ(err, SUN_SUCCESS);
+
+  queueMessages(logger, 1000);
+  ASSERT_EQ(SUNLogger_Flush(logger, SUN_LOGLEVEL_ALL), SUN_SUCCESS);
+
+  long int ndropped = 0;
+  ASSERT_EQ(SUNLogger_GetNumDroppedMsgs(logger, &ndropped), SUN_SUCCESS);
+
+  // every message is either written or counted as dropped
+  std::string output = readFile("sunlogger_drop.txt");
+  long int nwritten  = 0;
+  for (size_t pos = output.find("[scope]"); pos != std::string::npos;
+       pos        = output.find("[scope]", pos + 1))
+  {
+    nwritten++;
+  }
+  EXPECT_EQ(nwritten + ndropped, 1001);
+  if (ndropped > 0)
+  {
+    EXPECT_NE(output.find("messages were dropped"), std::string::npos);
+  }
+}
+
+// Count the string definitions and messages in a binary log file
+static bool parseBinaryLog(const std::string& data, int& nstrings, int& nmsgs,
+                           std::string& last_string)
+{
+  size_t pos = 12;
+  nstrings   = 0;
+  nmsgs      = 0;
+  if (data.compare(0, 6, "SUNLOG") != 0) { return false; }
+  while (pos < data.size())
+  {
+    char tag = data[pos++];
+    uint32_t len;
+    if (tag == 'S')
+    {
+      std::memcpy(&len, &data[pos + 4], sizeof(len));
+      last_string = data.substr(pos + 8, len);
+      pos += 8 + len;
+      nstrings++;
+    }
+    else if (tag == 'M')
+    {
+      int nargs = static_cast<unsigned char>(data[pos + 13]);
+      pos += 14;
+      for (int i = 0; i < nargs; i++) { pos += (data[pos] == 's') ? 5 : 9; }
+      nmsgs++;
+    }
+    else if (tag == 'T')
+    {
+      std::memcpy(&len, &data[pos + 9], sizeof(len));
+      pos += 13 + len;
+      nmsgs++;
+    }
+    else { return false; }
+  }
+  return pos == data.size();
+}
+
+TEST_F(SUNLoggerTest, BinaryFormatInternsStrings)
+{
+  ASSERT_TRUE(create("sunlogger_binary.bin"));
+  ASSERT_EQ(SUNLogger_SetFormat(logger, SUN_LOGFORMAT_BINARY), SUN_SUCCESS);
+  queueMessages(logger, 100);
+  SUNLogger_Destroy(&logger);
+
+  std::string data = readFile("sunlogger_binary.bin");
+  int nstrings = 0, nmsgs = 0;
+  std::string last_string;
+  ASSERT_TRUE(parseBinaryLog(data, nstrings, nmsgs, last_string));
+  EXPECT_EQ(nmsgs, 101);
+  // scope, label, two formats, and the 100 distinct %s arguments
+  EXPECT_EQ(nstrings, 104);
+  EXPECT_EQ(last_string, "no arguments");
+
+  // the asynchronous writer produces the same file
+  ASSERT_TRUE(create("sunlogger_binary_async.bin"));
+  ASSERT_EQ(SUNLogger_SetFormat(logger, SUN_LOGFORMAT_BINARY), SUN_SUCCESS);
+  SUNErrCode err = SUNLogger_EnableAsync(logger, 16, SUN_LOGOVERFLOW_BLOCK);
+  if (err == SUN_ERR_NOT_IMPLEMENTED) { GTEST_SKIP(); }
+  ASSERT_EQ(err, SUN_SUCCESS);
+  queueMessages(logger, 100);
+  SUNLogger_Destroy(&logger);
+
+  EXPECT_EQ(data, readFile("sunlogger_binary_async.bin"));
+}
@@ -0,0 +1,150 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------*/
+
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <nvector/nvector_serial.h>
+#include <sundials/sundials_core.hpp>
+
+static int num_custom_destroyed = 0;
+
+static N_Vector_ID customGetVectorID(N_Vector) { return SUNDIALS_NVEC_CUSTOM; }
+
+static void customDestroy(N_Vector v)
+{
+  num_custom_destroyed++;
+  std::free(v->ops);
+  std::free(v);
+}
+
+class SUNVectorPoolTest : public testing::Test
+{
+protected:
+  sundials::Context sunctx;
+  N_Vector tmpl = nullptr;
+
+  void SetUp() override { tmpl = N_VNew_Serial(10, sunctx); }
+
+  void TearDown() override { N_VDestroy(tmpl); }
+
+  void expectStats(long int reused, long int cloned)
+  {
+    long int num_reused = -1, num_cloned = -1;
+    ASSERT_EQ(SUNContext_GetVectorPoolStats(sunctx, &num_reused, &num_cloned),
+              SUN_SUCCESS);
+    EXPECT_EQ(num_reused, reused);
+    EXPECT_EQ(num_cloned, cloned);
+  }
+};
+
+TEST_F(SUNVectorPoolTest, DisabledByDefault)
+{
+  N_Vector v = N_VClone(tmpl);
+  N_VDestroy(v);
+  expectStats(0, 0);
+}
+
+TEST_F(SUNVectorPoolTest, ClonesAreReused)
+{
+  ASSERT_EQ(SUNContext_SetVectorPoolSize(sunctx, 4), SUN_SUCCESS);
+
+  N_Vector* vs = N_VCloneVectorArray(3, tmpl);
+  N_Vector first = vs[0];
+  N_VDestroyVectorArray(vs, 3);
+  expectStats(0, 3);
+
+  // the clones come back out of the pool, most recently returned first
+  N_Vector v = N_VClone(tmpl);
+  N_Vector w = N_VClone(tmpl);
+  N_Vector u = N_VClone(tmpl);
+  EXPECT_EQ(u, first);
+  EXPECT_EQ(N_VGetLength(u), 10);
+  expectStats(3, 3);
+
+  N_VDestroy(u);
+  N_VDestroy(w);
+  N_VDestroy(v);
+}
+
+TEST_F(SUNVectorPoolTest, OnlyMatchingTemplatesAreReused)
+{
+  ASSERT_EQ(SUNContext_SetVectorPoolSize(sunctx, 4), SUN_SUCCESS);
+
+  N_Vector other = N_VNew_Serial(20, sunctx);
+  N_Vector v     = N_VClone(other);
+  N_VDestroy(v);
+
+  // different length
+  v = N_VClone(tmpl);
+  expectStats(0, 2);
+  N_VDestroy(v);
+
+  // different enabled operations
+  ASSERT_EQ(N_VEnableFusedOps_Serial(other, SUNTRUE), SUN_SUCCESS);
+  v = N_VClone(other);
+  expectStats(0, 3);
+  N_VDestroy(v);
+
+  N_VDestroy(other);
+}
+
+TEST_F(SUNVectorPoolTest, UserVectorsAreNotPooled)
+{
+  ASSERT_EQ(SUNContext_SetVectorPoolSize(sunctx, 4), SUN_SUCCESS);
+
+  sunrealtype data[10];
+  N_Vector v = N_VMake_Serial(10, data, sunctx);
+  N_VDestroy(v);
+  N_Vector w = N_VNew_Serial(10, sunctx);
+  N_VDestroy(w);
+
+  v = N_VClone(tmpl);
+  expectStats(0, 1);
+  N_VDestroy(v);
+}
+
+TEST_F(SUNVectorPoolTest, CustomVectorsAreNotPooled)
+{
+  ASSERT_EQ(SUNContext_SetVectorPoolSize(sunctx, 4), SUN_SUCCESS);
+
+  // a vector that allocates the structure itself and leaves pooled set
+  N_Vector v = static_cast<N_Vector>(std::calloc(1, sizeof(*v)));
+  v->ops     = static_cast<N_Vector_Ops>(std::calloc(1, sizeof(*v->ops)));
+  v->ops->nvgetvectorid = customGetVectorID;
+  v->ops->nvdestroy     = customDestroy;
+  v->sunctx             = sunctx;
+  v->pooled             = SUNTRUE;
+
+  num_custom_destroyed = 0;
+  N_VDestroy(v);
+  EXPECT_EQ(num_custom_destroyed, 1);
+
+  v = N_VClone(tmpl);
+  expectStats(0, 1);
+  N_VDestroy(v);
+}
+
+TEST_F(SUNVectorPoolTest, OldestIdleVectorIsEvicted)
+{
+  ASSERT_EQ(SUNContext_SetVectorPoolSize(sunctx, 2), SUN_SUCCESS);
+
+  N_Vector* vs = N_VCloneVectorArray(3, tmpl);
+  N_VDestroyVectorArray(vs, 3);
+
+  vs = N_VCloneVectorArray(3, tmpl);
+  expectStats(2, 4);
+  N_VDestroyVectorArray(vs, 3);
+
+  // disabling the pool releases the idle vectors
+  ASSERT_EQ(SUNContext_SetVectorPoolSize(sunctx, 0), SUN_SUCCESS);
+  expectStats(0, 0);
+}
@@ -0,0 +1,140 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------*/
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <sundials/sundials_core.hpp>
+#include <sundials/sundials_stepstats.h>
+#include <vector>
+
+// Accumulates every block handed to the sink
+struct SinkData
+{
+  int num_blocks = 0;
+  std::vector<sunrealtype> t;
+  std::vector<long int> nni;
+  std::vector<long int> nsetups;
+};
+
+static int sink(const SUNStepStatsBlock* block, void* user_data)
+{
+  auto data = static_cast<SinkData*>(user_data);
+  data->num_blocks++;
+  for (int i = 0; i < block->num_records; i++)
+  {
+    data->t.push_back(block->t[i]);
+    data->nni.push_back(block->nni[i]);
+    data->nsetups.push_back(block->nsetups[i]);
+  }
+  return 0;
+}
+
+class SUNStepStatsTest : public testing::Test
+{
+protected:
+  sundials::Context sunctx;
+  SUNStepStats stats = nullptr;
+
+  void TearDown() override { SUNStepStats_Destroy(&stats); }
+};
+
+TEST_F(SUNStepStatsTest, SinkReceivesPerStepDeltas)
+{
+  SinkData data;
+  ASSERT_EQ(SUNStepStats_Create(sunctx, 4, &stats), SUN_SUCCESS);
+  ASSERT_EQ(SUNStepStats_SetSink(stats, sink, &data), SUN_SUCCESS);
+
+  // cumulative counters as an integrator would report them
+  for (int i = 1; i <= 10; i++)
+  {
+    ASSERT_EQ(SUNStepStats_Record(stats, 0.1 * i, 0.1, 2, 0, 3L * i, 0, i / 2),
+              SUN_SUCCESS);
+  }
+  EXPECT_EQ(data.num_blocks, 2);
+  ASSERT_EQ(SUNStepStats_Flush(stats), SUN_SUCCESS);
+  EXPECT_EQ(data.num_blocks, 3);
+
+  ASSERT_EQ(data.t.size(), 10u);
+  long int nsetups = 0;
+  for (int i = 0; i < 10; i++)
+  {
+    EXPECT_EQ(data.nni[i], 3);
+    nsetups += data.nsetups[i];
+  }
+  EXPECT_EQ(nsetups, 5);
+
+  long int num_records = 0;
+  ASSERT_EQ(SUNStepStats_GetNumRecords(stats, &num_records), SUN_SUCCESS);
+  EXPECT_EQ(num_records, 10);
+}
+
+TEST_F(SUNStepStatsTest, BaselineAndCounterResets)
+{
+  SinkData data;
+  ASSERT_EQ(SUNStepStats_Create(sunctx, 8, &stats), SUN_SUCCESS);
+  ASSERT_EQ(SUNStepStats_SetSink(stats, sink, &data), SUN_SUCCESS);
+
+  // attached part way through a run
+  ASSERT_EQ(SUNStepStats_SetBaseline(stats, 0, 100, 0, 10), SUN_SUCCESS);
+  ASSERT_EQ(SUNStepStats_Record(stats, 1.0, 0.1, 1, 0, 102, 0, 10), SUN_SUCCESS);
+
+  // the integrator was reinitialized and its counters restarted
+  ASSERT_EQ(SUNStepStats_Record(stats, 0.1, 0.1, 1, 0, 2, 0, 1), SUN_SUCCESS);
+  ASSERT_EQ(SUNStepStats_Flush(stats), SUN_SUCCESS);
+
+  ASSERT_EQ(data.nni.size(), 2u);
+  EXPECT_EQ(data.nni[0], 2);
+  EXPECT_EQ(data.nsetups[0], 0);
+  EXPECT_EQ(data.nni[1], 2);
+  EXPECT_EQ(data.nsetups[1], 1);
+}
+
+TEST_F(SUNStepStatsTest, FileIsColumnar)
+{
+  ASSERT_EQ(SUNStepStats_Create(sunctx, 3, &stats), SUN_SUCCESS);
+  ASSERT_EQ(SUNStepStats_SetFilename(stats, "sunstepstats.bin"), SUN_SUCCESS);
+  for (int i = 0; i < 5; i++)
+  {
+    ASSERT_EQ(SUNStepStats_Record(stats, i, 0.5, i, i, i, i, i), SUN_SUCCESS);
+  }
+  SUNStepStats_Destroy(&stats);
+
+  std::ifstream file("sunstepstats.bin", std::ios::binary);
+  std::stringstream contents;
+  contents << file.rdbuf();
+  std::string data = contents.str();
+
+  // header and two blocks of 3 and 2 records
+  const size_t record_size = 2 * sizeof(sunrealtype) + sizeof(int) +
+                             4 * sizeof(long int) + sizeof(double);
+  ASSERT_EQ(data.size(), 16 + 2 * sizeof(uint32_t) + 5 * record_size);
+  EXPECT_EQ(data.compare(0, 8, "SUNSTATS"), 0);
+  EXPECT_EQ(static_cast<size_t>(data[12]), sizeof(sunrealtype));
+
+  uint32_t n = 0;
+  std::memcpy(&n, &data[16], sizeof(n));
+  EXPECT_EQ(n, 3u);
+
+  // the t column of the first block is contiguous
+  sunrealtype t[3];
+  std::memcpy(t, &data[20], sizeof(t));
+  EXPECT_EQ(t[0], 0);
+  EXPECT_EQ(t[1], 1);
+  EXPECT_EQ(t[2], 2);
+
+  std::memcpy(&n, &data[20 + 3 * record_size], sizeof(n));
+  EXPECT_EQ(n, 2u);
+}
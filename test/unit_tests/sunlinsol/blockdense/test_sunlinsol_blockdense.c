@@ -0,0 +1,215 @@
+/*
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the testing routine to check the SUNLinSol BlockDense
+ * module implementation.
+ * -----------------------------------------------------------------
+ */
+
+#include <nvector/nvector_serial.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+#include <sunlinsol/sunlinsol_blockdense.h>
+#include <sunmatrix/sunmatrix_blockdense.h>
+
+#include "test_sunlinsol.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+/* ----------------------------------------------------------------------
+ * SUNLinSol_BlockDense Testing Routine
+ * --------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+  int fails = 0;                /* counter for test failures  */
+  sunindextype nblocks, cols;   /* number of blocks, columns  */
+  SUNLinearSolver LS;           /* solver object              */
+  SUNMatrix A, B;               /* test matrices              */
+  N_Vector x, y, b;             /* test vectors               */
+  int print_timing;
+  int print_on_fail;
+  sunindextype i, j, k;
+  sunrealtype* xdata;
+  SUNContext sunctx;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    printf("ERROR: SUNContext_Create failed\n");
+    return (-1);
+  }
+
+  /* check input and set matrix dimensions */
+  if (argc < 4)
+  {
+    printf("ERROR: THREE (3) Inputs required: number of blocks, block cols, "
+           "print timing \n");
+    return (-1);
+  }
+
+  nblocks = (sunindextype)atol(argv[1]);
+  if (nblocks <= 0)
+  {
+    printf("ERROR: number of blocks must be a positive integer \n");
+    return (-1);
+  }
+
+  cols = (sunindextype)atol(argv[2]);
+  if (cols <= 0)
+  {
+    printf("ERROR: number of block columns must be a positive integer \n");
+    return (-1);
+  }
+
+  print_timing = atoi(argv[3]);
+  SetTiming(print_timing);
+
+  print_on_fail = 0;
+  if (argc == 5) { print_on_fail = atoi(argv[4]); }
+
+  printf("\nBlock-diagonal dense linear solver test: %ld blocks of size "
+         "%ld\n\n",
+         (long int)nblocks, (long int)cols);
+
+  /* Create matrices and vectors */
+  A = SUNBlockDenseMatrix(nblocks, cols, cols, sunctx);
+  B = SUNBlockDenseMatrix(nblocks, cols, cols, sunctx);
+  x = N_VNew_Serial(nblocks * cols, sunctx);
+  y = N_VNew_Serial(nblocks * cols, sunctx);
+  b = N_VNew_Serial(nblocks * cols, sunctx);
+
+  /* Fill the blocks of A with uniform random data in [0,1/cols] and add an
+     anti-identity to ensure the solver needs to do row-swapping. Each block
+     is filled separately, so the blocks need different pivots. */
+  for (k = 0; k < nblocks; k++)
+  {
+    for (j = 0; j < cols; j++)
+    {
+      for (i = 0; i < cols; i++)
+      {
+        SM_ELEMENT_BD(A, k, i, j) =
+          (sunrealtype)rand() / (sunrealtype)RAND_MAX / cols;
+        if (i + j == cols - 1) { SM_ELEMENT_BD(A, k, i, j) += ONE; }
+      }
+    }
+  }
+
+  /* Fill x vector with uniform random data in [0,1] */
+  xdata = N_VGetArrayPointer(x);
+  for (i = 0; i < nblocks * cols; i++)
+  {
+    xdata[i] = (sunrealtype)rand() / (sunrealtype)RAND_MAX;
+  }
+
+  /* copy A and x into B and y to print in case of solver failure */
+  SUNMatCopy(A, B);
+  N_VScale(ONE, x, y);
+
+  /* create right-hand side vector for linear solve */
+  fails = SUNMatMatvec(A, x, b);
+  if (fails)
+  {
+    printf("FAIL: SUNLinSol SUNMatMatvec failure\n");
+
+    /* Free matrices and vectors */
+    SUNMatDestroy(A);
+    SUNMatDestroy(B);
+    N_VDestroy(x);
+    N_VDestroy(y);
+    N_VDestroy(b);
+
+    return (1);
+  }
+
+  /* Create block-diagonal dense linear solver */
+  LS = SUNLinSol_BlockDense(x, A, sunctx);
+
+  /* Run Tests */
+  fails += Test_SUNLinSolInitialize(LS, 0);
+  fails += Test_SUNLinSolSetup(LS, A, 0);
+  fails += Test_SUNLinSolSolve(LS, A, x, b, 100 * SUN_UNIT_ROUNDOFF, SUNTRUE,
+                               0);
+
+  fails += Test_SUNLinSolGetType(LS, SUNLINEARSOLVER_DIRECT, 0);
+  fails += Test_SUNLinSolGetID(LS, SUNLINEARSOLVER_BLOCKDENSE, 0);
+  fails += Test_SUNLinSolLastFlag(LS, 0);
+  fails += Test_SUNLinSolSpace(LS, 0);
+
+  /* Print result */
+  if (fails)
+  {
+    printf("FAIL: SUNLinSol module failed %i tests \n \n", fails);
+    if (print_on_fail)
+    {
+      printf("\nA (original) =\n");
+      SUNBlockDenseMatrix_Print(B, stdout);
+      printf("\nA (factored) =\n");
+      SUNBlockDenseMatrix_Print(A, stdout);
+      printf("\nx (original) =\n");
+      N_VPrint_Serial(y);
+      printf("\nx (computed) =\n");
+      N_VPrint_Serial(x);
+    }
+  }
+  else { printf("SUCCESS: SUNLinSol module passed all tests \n \n"); }
+
+  /* Free solver, matrix and vectors */
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  SUNMatDestroy(B);
+  N_VDestroy(x);
+  N_VDestroy(y);
+  N_VDestroy(b);
+  SUNContext_Free(&sunctx);
+
+  return (fails);
+}
+
+/* ----------------------------------------------------------------------
+ * Implementation-specific 'check' routines
+ * --------------------------------------------------------------------*/
+int check_vector(N_Vector X, N_Vector Y, sunrealtype tol)
+{
+  int failure = 0;
+  sunindextype i, local_length;
+  sunrealtype *Xdata, *Ydata, maxerr;
+
+  Xdata        = N_VGetArrayPointer(X);
+  Ydata        = N_VGetArrayPointer(Y);
+  local_length = N_VGetLength_Serial(X);
+
+  /* check vector data */
+  for (i = 0; i < local_length; i++)
+  {
+    failure += SUNRCompareTol(Xdata[i], Ydata[i], tol);
+  }
+
+  if (failure > ZERO)
+  {
+    maxerr = ZERO;
+    for (i = 0; i < local_length; i++)
+    {
+      maxerr = SUNMAX(SUNRabs(Xdata[i] - Ydata[i]), maxerr);
+    }
+    printf("check err failure: maxerr = %" GSYM " (tol = %" GSYM ")\n", maxerr,
+           tol);
+    return (1);
+  }
+  else { return (0); }
+}
+
+void sync_device(void) {}
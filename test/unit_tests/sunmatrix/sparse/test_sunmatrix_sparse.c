@@ -717,6 +717,93 @@ int Test_SUNMatScaleAdd2(SUNMatrix A, SUNMatrix B, N_Vector x, N_Vector y,
   }
   else { printf("    PASSED test -- SUNMatScaleAdd2 check 3 \n"); }
 
+  /* test 4: repeat the previous sum, reusing the cached map of B into E */
+  failure = SUNMatScaleAdd(NEG_ONE, E, B); /* E = A+B */
+  if (!failure) { failure = SUNMatScaleAdd(ONE, E, B); } /* E = A+2B */
+  if (failure)
+  {
+    printf(">>> FAILED test -- SUNMatScaleAdd returned %d \n", failure);
+    SUNMatDestroy(C);
+    SUNMatDestroy(D);
+    SUNMatDestroy(E);
+    N_VDestroy(u);
+    N_VDestroy(v);
+    return (1);
+  }
+  failure = SUNMatMatvec(E, x, u); /* u = Ex = Ax+2Bx */
+  if (failure)
+  {
+    printf(">>> FAILED test -- SUNMatMatvec returned %d \n", failure);
+    SUNMatDestroy(C);
+    SUNMatDestroy(D);
+    SUNMatDestroy(E);
+    N_VDestroy(u);
+    N_VDestroy(v);
+    return (1);
+  }
+  N_VLinearSum(ONE, y, TWO, z, v);   /* v = y+2z */
+  failure = check_vector(u, v, tol); /* v ?= u */
+  if (failure)
+  {
+    printf(">>> FAILED test -- SUNMatScaleAdd2 check 4 \n");
+    printf("\nE =\n");
+    SUNSparseMatrix_Print(E, stdout);
+    printf("\nu =\n");
+    N_VPrint_Serial(u);
+    printf("\nv =\n");
+    N_VPrint_Serial(v);
+    SUNMatDestroy(C);
+    SUNMatDestroy(D);
+    SUNMatDestroy(E);
+    N_VDestroy(u);
+    N_VDestroy(v);
+    return (1);
+  }
+  else { printf("    PASSED test -- SUNMatScaleAdd2 check 4 \n"); }
+
+  /* test 5: add a matrix with a different pattern (invalidates the map) */
+  failure = SUNMatScaleAdd(ONE, E, A); /* E = 2A+2B */
+  if (failure)
+  {
+    printf(">>> FAILED test -- SUNMatScaleAdd returned %d \n", failure);
+    SUNMatDestroy(C);
+    SUNMatDestroy(D);
+    SUNMatDestroy(E);
+    N_VDestroy(u);
+    N_VDestroy(v);
+    return (1);
+  }
+  failure = SUNMatMatvec(E, x, u); /* u = Ex = 2Ax+2Bx */
+  if (failure)
+  {
+    printf(">>> FAILED test -- SUNMatMatvec returned %d \n", failure);
+    SUNMatDestroy(C);
+    SUNMatDestroy(D);
+    SUNMatDestroy(E);
+    N_VDestroy(u);
+    N_VDestroy(v);
+    return (1);
+  }
+  N_VLinearSum(TWO, y, TWO, z, v);   /* v = 2y+2z */
+  failure = check_vector(u, v, tol); /* v ?= u */
+  if (failure)
+  {
+    printf(">>> FAILED test -- SUNMatScaleAdd2 check 5 \n");
+    printf("\nE =\n");
+    SUNSparseMatrix_Print(E, stdout);
+    printf("\nu =\n");
+    N_VPrint_Serial(u);
+    printf("\nv =\n");
+    N_VPrint_Serial(v);
+    SUNMatDestroy(C);
+    SUNMatDestroy(D);
+    SUNMatDestroy(E);
+    N_VDestroy(u);
+    N_VDestroy(v);
+    return (1);
+  }
+  else { printf("    PASSED test -- SUNMatScaleAdd2 check 5 \n"); }
+
   SUNMatDestroy(C);
   SUNMatDestroy(D);
   SUNMatDestroy(E);
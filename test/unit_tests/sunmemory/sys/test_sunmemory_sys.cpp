@@ -10,6 +10,7 @@
  * SUNDIALS Copyright End
  *-----------------------------------------------------------------*/
 
+#include <cstdint>
 #include <iostream>
 #include <sundials/sundials_core.hpp>
 #include <sunmemory/sunmemory_system.h>
@@ -164,6 +165,91 @@ static int test_instance(SUNMemoryHelper helper, SUNMemoryType mem_type,
   return retval;
 }
 
+static int test_pool(SUNMemoryHelper helper)
+{
+  std::cout << "  SUNMemoryHelper_SysPool reuse... \n";
+
+  // Freed blocks are handed back out for requests in the same size class
+  SUNMemory a = nullptr, b = nullptr;
+  if (SUNMemoryHelper_Alloc(helper, &a, 1000, SUNMEMTYPE_HOST, nullptr))
+  {
+    std::cout << "  SUNMemoryHelper_SysPool reuse... FAILED\n";
+    return -1;
+  }
+  void* block = a->ptr;
+  SUNMemoryHelper_Dealloc(helper, a, nullptr);
+  SUNMemoryHelper_Alloc(helper, &b, 990, SUNMEMTYPE_HOST, nullptr);
+  if (b->ptr != block || reinterpret_cast<uintptr_t>(b->ptr) % 64 != 0)
+  {
+    std::cout << "  SUNMemoryHelper_SysPool reuse... FAILED\n";
+    return -1;
+  }
+  SUNMemoryHelper_Dealloc(helper, b, nullptr);
+  std::cout << "  SUNMemoryHelper_SysPool reuse... PASSED\n";
+
+  std::cout << "  SUNMemoryHelper_SysPool arena... \n";
+  if (SUNMemoryHelper_SetArenaSize_Sys(helper, 4096))
+  {
+    std::cout << "  SUNMemoryHelper_SysPool arena... FAILED\n";
+    return -1;
+  }
+
+  // Fill more than one arena chunk
+  SUNMemory mems[16];
+  for (int i = 0; i < 16; i++)
+  {
+    SUNMemoryHelper_Alloc(helper, &mems[i], 500, SUNMEMTYPE_HOST, nullptr);
+    if (reinterpret_cast<uintptr_t>(mems[i]->ptr) % 64 != 0)
+    {
+      std::cout << "  SUNMemoryHelper_SysPool arena... FAILED\n";
+      return -1;
+    }
+    static_cast<char*>(mems[i]->ptr)[499] = 1;
+  }
+  void* first = mems[0]->ptr;
+
+  // The arena cannot be resized while it holds live allocations
+  if (SUNMemoryHelper_SetArenaSize_Sys(helper, 0) == SUN_SUCCESS)
+  {
+    std::cout << "  SUNMemoryHelper_SysPool arena... FAILED\n";
+    return -1;
+  }
+
+  // Returning every allocation rewinds the arena
+  for (int i = 15; i >= 0; i--)
+  {
+    SUNMemoryHelper_Dealloc(helper, mems[i], nullptr);
+  }
+
+  unsigned long num_allocations, num_deallocations;
+  size_t bytes_allocated, bytes_high_watermark;
+  SUNMemoryHelper_GetAllocStats(helper, SUNMEMTYPE_HOST, &num_allocations,
+                                &num_deallocations, &bytes_allocated,
+                                &bytes_high_watermark);
+  if (num_allocations != 20 || num_deallocations != 20 || bytes_allocated != 0)
+  {
+    std::cout << "  SUNMemoryHelper_SysPool arena... FAILED\n";
+    return -1;
+  }
+
+  // After a rewind the arena starts over from the beginning
+  SUNMemoryHelper_Alloc(helper, &a, 500, SUNMEMTYPE_HOST, nullptr);
+  if (a->ptr != first)
+  {
+    std::cout << "  SUNMemoryHelper_SysPool arena... FAILED\n";
+    return -1;
+  }
+  SUNMemoryHelper_Dealloc(helper, a, nullptr);
+  if (SUNMemoryHelper_SetArenaSize_Sys(helper, 0))
+  {
+    std::cout << "  SUNMemoryHelper_SysPool arena... FAILED\n";
+    return -1;
+  }
+  std::cout << "  SUNMemoryHelper_SysPool arena... PASSED\n";
+
+  return 0;
+}
+
 int main(int argc, char* argv[])
 {
   sundials::Context sunctx;
@@ -199,5 +285,17 @@ int main(int argc, char* argv[])
   }
   std::cout << "  SUNMemoryHelper_Destroy... PASSED\n";
 
+  std::cout << "  SUNMemoryHelper_SysPool... \n";
+  helper = SUNMemoryHelper_SysPool(sunctx);
+  if (!helper || test_instance(helper, SUNMEMTYPE_HOST, false))
+  {
+    std::cout << "  SUNMemoryHelper_SysPool... FAILED\n";
+    return -1;
+  }
+  std::cout << "  SUNMemoryHelper_SysPool... PASSED\n";
+
+  if (test_pool(helper)) { return -1; }
+  SUNMemoryHelper_Destroy(helper);
+
   return 0;
 }
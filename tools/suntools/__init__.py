@@ -3,5 +3,7 @@ This is a Python library of utilities SUNDIALS developer may find useful.
 Right now it consists of the following modules:
 
 - `logs`: this module has functions for parsing logs produced by `SUNLogger`.
+- `stepstats`: this module reads the per-step statistics files written by
+  `SUNStepStats`.
 
 """
@@ -17,12 +17,15 @@
 # -----------------------------------------------------------------------------
 
 import re
+import struct
 import numpy as np
 from collections import ChainMap
 
 
 def convert_to_num(s):
     """Try to convert a string to an int or float"""
+    if not isinstance(s, str):
+        return s
     try:
         return np.longlong(s)
     except ValueError:
@@ -85,6 +88,173 @@ def parse_logfile_line(line, line_number, all_lines):
     return line_dict
 
 
+# Conversion specifications in a C format string
+_C_CONVERSION = re.compile(r"%[-+ #0]*\d*(?:\.\d*)?(hh|h|ll|l|j|z|t|L)?([diouxXcfFeEgGaAsp%])")
+
+_LOG_LEVELS = {1: "ERROR", 2: "WARNING", 3: "INFO", 4: "DEBUG"}
+
+
+def is_binary_logfile(filename):
+    """Check if a file is a binary SUNDIALS log file"""
+    with open(filename, "rb") as logfile:
+        return logfile.read(6) == b"SUNLOG"
+
+
+def parse_binary_format(fmt):
+    """
+    Split a C format string from a binary log file into the key-value pairs of
+    the payload. Returns a list of (key, spec, first, last) tuples where spec is
+    the value format string using the arguments first to last - 1, or the value
+    itself when first == last.
+    """
+    fields = []
+    iarg = 0
+    for kvpstr in fmt.split(","):
+        kvp = kvpstr.split("=", 1)
+        key = kvp[0].strip()
+        value = kvp[1].strip() if len(kvp) > 1 else ""
+        nargs = len([m for m in _C_CONVERSION.finditer(kvpstr) if m.group(2) != "%"])
+        if not key and not nargs:
+            continue
+        if nargs == 0:
+            fields.append((key, value, iarg, iarg))
+        else:
+            # drop length modifiers not supported by Python formatting
+            spec = _C_CONVERSION.sub(lambda m: m.group(0).replace(m.group(1) or "", ""), value)
+            fields.append((key, spec, iarg, iarg + nargs))
+        iarg += nargs
+    return fields
+
+
+def _binary_payload(fields, args):
+    """Create the payload dictionary for a message from a binary log file"""
+    payload = {}
+    for key, spec, first, last in fields:
+        if first == last:
+            payload[key] = spec
+        elif last - first == 1 and _C_CONVERSION.fullmatch(spec):
+            payload[key] = args[first]
+        else:
+            payload[key] = spec % args[first:last]
+    return payload
+
+
+def read_binary_logfile(filename):
+    """
+    Read the messages from a binary SUNDIALS log file (see SUNLogger_SetFormat).
+    This is a generator yielding one dictionary per message with the same
+    entries as parse_logfile_line except numeric payload values are numbers
+    rather than strings.
+    """
+    with open(filename, "rb") as logfile:
+        data = logfile.read()
+
+    if data[:6] != b"SUNLOG":
+        raise ValueError(f"{filename} is not a binary SUNDIALS log file")
+    if data[6] != 1:
+        raise ValueError(f"Unsupported binary log file version {data[6]}")
+    order = "<" if data[7] else ">"
+
+    unpack_u32 = struct.Struct(order + "I").unpack_from
+    unpack_i64 = struct.Struct(order + "q").unpack_from
+    unpack_f64 = struct.Struct(order + "d").unpack_from
+    unpack_msg = struct.Struct(order + "BIII").unpack_from
+
+    (rank,) = struct.unpack_from(order + "i", data, 8)
+    pos = 12
+
+    strings = []
+    formats = {}
+
+    while pos < len(data):
+        tag = data[pos]
+        pos += 1
+        if tag == ord("S"):
+            (length,) = unpack_u32(data, pos + 4)
+            pos += 8
+            strings.append(data[pos : pos + length].decode())
+            pos += length
+        elif tag == ord("M"):
+            lvl, scope, label, fmt = unpack_msg(data, pos)
+            nargs = data[pos + 13]
+            pos += 14
+            args = []
+            for _ in range(nargs):
+                arg_type = data[pos]
+                if arg_type == ord("i"):
+                    args.append(unpack_i64(data, pos + 1)[0])
+                    pos += 9
+                elif arg_type == ord("d"):
+                    args.append(unpack_f64(data, pos + 1)[0])
+                    pos += 9
+                else:
+                    args.append(strings[unpack_u32(data, pos + 1)[0]])
+                    pos += 5
+            if fmt not in formats:
+                formats[fmt] = parse_binary_format(strings[fmt])
+            yield {
+                "loglvl": _LOG_LEVELS.get(lvl, ""),
+                "rank": rank,
+                "scope": strings[scope],
+                "label": strings[label],
+                "payload": _binary_payload(formats[fmt], tuple(args)),
+            }
+        elif tag == ord("T"):
+            lvl, scope, label, length = unpack_msg(data, pos)
+            pos += 13
+            text = data[pos : pos + length].decode()
+            pos += length
+            yield {
+                "loglvl": _LOG_LEVELS.get(lvl, ""),
+                "rank": rank,
+                "scope": strings[scope],
+                "label": strings[label],
+                "payload": parse_logfile_payload(text, 0, []),
+            }
+        else:
+            raise ValueError(f"Corrupt binary log file at byte {pos - 1}")
+
+
+def get_step_arrays(filename, level=0):
+    """
+    Load the step attempt data from a binary SUNDIALS log file into numpy
+    arrays. Returns a dictionary mapping each payload key of the
+    begin-step-attempt and end-step-attempt messages (e.g., step, tn, h, q,
+    status, dsm) to an array with one entry per step attempt at the given time
+    level. Missing numeric values are NaN and missing strings are empty.
+    """
+    columns = {}
+    nattempts = 0
+    depth = 0
+    for line_dict in read_binary_logfile(filename):
+        label = line_dict["label"]
+        if label == "begin-fast-steps":
+            depth += 1
+        elif label == "end-fast-steps":
+            depth -= 1
+        elif depth != level:
+            continue
+        elif label == "begin-step-attempt":
+            nattempts += 1
+        elif label != "end-step-attempt":
+            continue
+        for key, value in line_dict["payload"].items():
+            columns.setdefault(key, {})[nattempts - 1] = value
+
+    arrays = {}
+    for key, values in columns.items():
+        if all(isinstance(v, str) for v in values.values()):
+            array = np.full(nattempts, "", dtype=object)
+        elif len(values) == nattempts and all(isinstance(v, int) for v in values.values()):
+            array = np.empty(nattempts, dtype=np.longlong)
+        else:
+            array = np.full(nattempts, np.nan)
+        for idx, value in values.items():
+            array[idx] = value
+        arrays[key] = array
+    return arrays
+
+
 class StepData:
     """
     Helper class for parsing a step attempt from a SUNDIALS log file into a
@@ -141,6 +311,22 @@ class StepData:
         return tmp
 
 
+def read_logfile(filename):
+    """
+    Read the messages from a text or binary SUNDIALS log file. This is a
+    generator yielding one dictionary per message (see parse_logfile_line).
+    """
+    if is_binary_logfile(filename):
+        yield from read_binary_logfile(filename)
+        return
+    with open(filename, "r") as logfile:
+        all_lines = logfile.readlines()
+    for line_number, line in enumerate(all_lines):
+        line_dict = parse_logfile_line(line.rstrip(), line_number, all_lines)
+        if line_dict:
+            yield line_dict
+
+
 def log_file_to_list(filename):
     """
     This function takes a SUNDIALS log file and creates a list where each list
@@ -156,157 +342,147 @@ def log_file_to_list(filename):
         }, ...
       ]
     """
-    with open(filename, "r") as logfile:
-
-        # List of step attempts, each entry is a dictionary for one attempt
-        step_attempts = []
-
-        # Time level for nested integrators e.g., MRI methods
-        level = 0
-
-        # Partition for split integrators e.g., operator splitting methods
-        partition = 0
+    # List of step attempts, each entry is a dictionary for one attempt
+    step_attempts = []
 
-        # Read the log file
-        all_lines = logfile.readlines()
-
-        # Create instance of helper class for building attempt dictionary
-        s = StepData()
+    # Time level for nested integrators e.g., MRI methods
+    level = 0
 
-        for line_number, line in enumerate(all_lines):
+    # Partition for split integrators e.g., operator splitting methods
+    partition = 0
 
-            line_dict = parse_logfile_line(line.rstrip(), line_number, all_lines)
+    # Create instance of helper class for building attempt dictionary
+    s = StepData()
 
-            if not line_dict:
-                continue
+    for line_dict in read_logfile(filename):
 
-            label = line_dict["label"]
+        label = line_dict["label"]
 
-            if label == "begin-step-attempt":
-                line_dict["payload"]["level"] = level
-                if level > 0:
-                    s.open_list(f"time-level-{level}")
-                if partition > 0:
-                    s.open_list(f"evolve")
-                s.update(line_dict["payload"])
-                continue
-            elif label == "end-step-attempt":
-                s.update(line_dict["payload"])
-                if level > 0 or partition > 0:
-                    s.close_list()
-                else:
-                    step_attempts.append(s.get_step())
-                continue
-
-            if label == "begin-sequential-method":
-                s.open_list("sequential methods")
-                s.update(line_dict["payload"])
-                continue
-            elif label == "end-sequential-method":
-                s.update(line_dict["payload"])
+        if label == "begin-step-attempt":
+            line_dict["payload"]["level"] = level
+            if level > 0:
+                s.open_list(f"time-level-{level}")
+            if partition > 0:
+                s.open_list(f"evolve")
+            s.update(line_dict["payload"])
+            continue
+        elif label == "end-step-attempt":
+            s.update(line_dict["payload"])
+            if level > 0 or partition > 0:
                 s.close_list()
-                continue
+            else:
+                step_attempts.append(s.get_step())
+            continue
 
-            if label == "begin-partition":
-                s.open_list("partitions")
-                s.update(line_dict["payload"])
-                partition += 1
-                continue
-            elif label == "end-partition":
-                s.update(line_dict["payload"])
-                s.close_list()
-                partition -= 1
-                continue
+        if label == "begin-sequential-method":
+            s.open_list("sequential methods")
+            s.update(line_dict["payload"])
+            continue
+        elif label == "end-sequential-method":
+            s.update(line_dict["payload"])
+            s.close_list()
+            continue
 
-            if label == "begin-nonlinear-solve":
-                s.open_dict("nonlinear-solve")
-                s.update(line_dict["payload"])
-                continue
-            elif label == "end-nonlinear-solve":
-                s.update(line_dict["payload"])
-                s.close_dict()
-                continue
+        if label == "begin-partition":
+            s.open_list("partitions")
+            s.update(line_dict["payload"])
+            partition += 1
+            continue
+        elif label == "end-partition":
+            s.update(line_dict["payload"])
+            s.close_list()
+            partition -= 1
+            continue
 
-            if label == "begin-nonlinear-iterate":
-                s.open_list("iterations")
-                s.update(line_dict["payload"])
-                continue
-            elif label == "end-nonlinear-iterate":
-                s.update(line_dict["payload"])
-                s.close_list()
-                continue
+        if label == "begin-nonlinear-solve":
+            s.open_dict("nonlinear-solve")
+            s.update(line_dict["payload"])
+            continue
+        elif label == "end-nonlinear-solve":
+            s.update(line_dict["payload"])
+            s.close_dict()
+            continue
 
-            if label == "begin-linear-solve":
-                s.open_dict("linear-solve")
-                s.update(line_dict["payload"])
-                continue
-            elif label == "end-linear-solve":
-                s.update(line_dict["payload"])
-                s.close_dict()
-                continue
+        if label == "begin-nonlinear-iterate":
+            s.open_list("iterations")
+            s.update(line_dict["payload"])
+            continue
+        elif label == "end-nonlinear-iterate":
+            s.update(line_dict["payload"])
+            s.close_list()
+            continue
 
-            if label == "begin-linear-iterate":
-                s.open_list("iterations")
-                s.update(line_dict["payload"])
-                continue
-            elif label == "end-linear-iterate":
-                s.update(line_dict["payload"])
-                s.close_list()
-                continue
+        if label == "begin-linear-solve":
+            s.open_dict("linear-solve")
+            s.update(line_dict["payload"])
+            continue
+        elif label == "end-linear-solve":
+            s.update(line_dict["payload"])
+            s.close_dict()
+            continue
 
-            if label == "begin-group":
-                s.open_list("groups")
-                s.update(line_dict["payload"])
-                continue
-            elif label == "end-group":
-                s.update(line_dict["payload"])
-                s.close_list()
-                continue
+        if label == "begin-linear-iterate":
+            s.open_list("iterations")
+            s.update(line_dict["payload"])
+            continue
+        elif label == "end-linear-iterate":
+            s.update(line_dict["payload"])
+            s.close_list()
+            continue
 
-            if label == "begin-stage":
-                s.open_list("stages")
-                s.update(line_dict["payload"])
-                continue
-            elif label == "end-stage":
-                s.update(line_dict["payload"])
-                s.close_list()
-                continue
+        if label == "begin-group":
+            s.open_list("groups")
+            s.update(line_dict["payload"])
+            continue
+        elif label == "end-group":
+            s.update(line_dict["payload"])
+            s.close_list()
+            continue
 
-            if label == "begin-fast-steps":
-                level += 1
-                continue
-            elif label == "end-fast-steps":
-                level -= 1
-                continue
+        if label == "begin-stage":
+            s.open_list("stages")
+            s.update(line_dict["payload"])
+            continue
+        elif label == "end-stage":
+            s.update(line_dict["payload"])
+            s.close_list()
+            continue
 
-            if label == "begin-mass-linear-solve":
-                s.open_dict("mass-linear-solve")
-                s.update(line_dict["payload"])
-                continue
-            elif label == "end-mass-linear-solve":
-                s.update(line_dict["payload"])
-                s.close_dict()
-                continue
+        if label == "begin-fast-steps":
+            level += 1
+            continue
+        elif label == "end-fast-steps":
+            level -= 1
+            continue
 
-            if label == "begin-compute-solution":
-                s.open_dict("compute-solution")
-                s.update(line_dict["payload"])
-                continue
-            elif label == "end-compute-solution":
-                s.update(line_dict["payload"])
-                s.close_dict()
-                continue
+        if label == "begin-mass-linear-solve":
+            s.open_dict("mass-linear-solve")
+            s.update(line_dict["payload"])
+            continue
+        elif label == "end-mass-linear-solve":
+            s.update(line_dict["payload"])
+            s.close_dict()
+            continue
 
-            if label == "begin-compute-embedding":
-                s.open_dict("compute-embedding")
-                s.update(line_dict["payload"])
-                continue
-            elif label == "end-compute-embedding":
-                s.update(line_dict["payload"])
-                s.close_dict()
-                continue
+        if label == "begin-compute-solution":
+            s.open_dict("compute-solution")
+            s.update(line_dict["payload"])
+            continue
+        elif label == "end-compute-solution":
+            s.update(line_dict["payload"])
+            s.close_dict()
+            continue
 
+        if label == "begin-compute-embedding":
+            s.open_dict("compute-embedding")
             s.update(line_dict["payload"])
+            continue
+        elif label == "end-compute-embedding":
+            s.update(line_dict["payload"])
+            s.close_dict()
+            continue
+
+        s.update(line_dict["payload"])
 
     return step_attempts
 
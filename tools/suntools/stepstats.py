@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+# SUNDIALS Copyright Start
+# Copyright (c) 2002-2025, Lawrence Livermore National Security
+# and Southern Methodist University.
+# All rights reserved.
+#
+# See the top-level LICENSE and NOTICE files for details.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+# SUNDIALS Copyright End
+# -----------------------------------------------------------------------------
+# Module of Python functions for reading the per-step statistics files written
+# by SUNStepStats.
+# -----------------------------------------------------------------------------
+
+import struct
+import numpy as np
+
+COLUMNS = ("t", "h", "order", "netf", "nni", "nli", "nsetups", "wall_time")
+
+_REAL_TYPES = {4: np.float32, 8: np.float64, 16: np.longdouble}
+_INT_TYPES = {4: np.int32, 8: np.int64}
+
+
+def read_stepstats(filename):
+    """
+    Read a SUNStepStats file (see SUNStepStats_SetFilename). Returns a
+    dictionary mapping each column name to a NumPy array with one entry per
+    recorded step. The counter columns hold the change since the previous
+    record and wall_time is the elapsed time in seconds.
+    """
+    with open(filename, "rb") as statsfile:
+        data = statsfile.read()
+
+    if data[:8] != b"SUNSTATS":
+        raise ValueError(f"{filename} is not a SUNDIALS step statistics file")
+    (version,) = struct.unpack_from("=I", data, 8)
+    if version != 1:
+        raise ValueError(f"Unsupported step statistics file version {version}")
+
+    real_type = np.dtype(_REAL_TYPES[data[12]])
+    int_type = np.dtype(_INT_TYPES[data[13]])
+    long_type = np.dtype(_INT_TYPES[data[14]])
+    types = (real_type, real_type, int_type, long_type, long_type, long_type,
+             long_type, np.dtype(np.float64))
+
+    blocks = {name: [] for name in COLUMNS}
+    pos = 16
+    while pos < len(data):
+        (n,) = struct.unpack_from("=I", data, pos)
+        pos += 4
+        for name, dtype in zip(COLUMNS, types):
+            blocks[name].append(np.frombuffer(data, dtype=dtype, count=n, offset=pos))
+            pos += n * dtype.itemsize
+
+    return {
+        name: np.concatenate(arrays) if arrays else np.empty(0, dtype)
+        for (name, arrays), dtype in zip(blocks.items(), types)
+    }
+
+
+def find_step_collapses(steps, factor=10.0):
+    """
+    Return the indices of steps whose size dropped by more than factor relative
+    to the previous step, e.g., to locate sudden step size reductions.
+    """
+    h = np.abs(steps["h"])
+    return np.nonzero(h[1:] * factor < h[:-1])[0] + 1